@@ -884,6 +884,12 @@ void achievements_tracker::clear()
     achievements_status_.clear();
 }
 
+bool achievements_tracker::is_interested_in( event_type type )
+{
+    // progress is tracked by the watchers registered with the stats_tracker
+    return type == event_type::game_start;
+}
+
 void achievements_tracker::notify( const cata::event &e )
 {
     if( e.type() == event_type::game_start ) {
@@ -1,6 +1,8 @@
 #include "active_item_cache.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <numeric>
 #include <utility>
 
 #include "item.h"
@@ -15,6 +17,81 @@ float item_reference::spoil_multiplier()
     } );
 }
 
+size_t active_item_cache::item_index::slot_of( const item *it ) const
+{
+    // Items are heap allocated, so the low bits of their address carry no information.
+    const size_t hash = static_cast<size_t>( reinterpret_cast<std::uintptr_t>( it ) >> 4 ) *
+                        0x9E3779B97F4A7C15ULL;
+    size_t slot = hash & ( slots.size() - 1 );
+    while( slots[slot] != nullptr && slots[slot] != it ) {
+        slot = ( slot + 1 ) & ( slots.size() - 1 );
+    }
+    return slot;
+}
+
+bool active_item_cache::item_index::contains( const item *it ) const
+{
+    return !slots.empty() && slots[slot_of( it )] == it;
+}
+
+void active_item_cache::item_index::insert( const item *it )
+{
+    // Keep the table at most half full so probe sequences stay short.
+    if( ( used + 1 ) * 2 > slots.size() ) {
+        std::vector<const item *> old_slots( std::max<size_t>( 16, slots.size() * 2 ), nullptr );
+        old_slots.swap( slots );
+        for( const item *old : old_slots ) {
+            if( old != nullptr ) {
+                slots[slot_of( old )] = old;
+            }
+        }
+    }
+    const size_t slot = slot_of( it );
+    if( slots[slot] == nullptr ) {
+        slots[slot] = it;
+        ++used;
+    }
+}
+
+void active_item_cache::item_index::clear()
+{
+    std::fill( slots.begin(), slots.end(), nullptr );
+    used = 0;
+}
+
+void active_item_cache::prune( item_queue &queue )
+{
+    size_t live = 0;
+    size_t next = 0;
+    for( size_t i = 0; i < queue.refs.size(); ++i ) {
+        if( i == queue.next ) {
+            next = live;
+        }
+        if( queue.refs[i].item_ref ) {
+            if( live != i ) {
+                queue.refs[live] = std::move( queue.refs[i] );
+            }
+            ++live;
+        }
+    }
+    queue.refs.erase( queue.refs.begin() + live, queue.refs.end() );
+    queue.next = live == 0 ? 0 : next % live;
+    index_stale = true;
+}
+
+void active_item_cache::rebuild_index()
+{
+    index.clear();
+    for( const std::pair<const int, item_queue> &kv : active_items ) {
+        for( const item_reference &ref : kv.second.refs ) {
+            if( item *const it = ref.item_ref.get() ) {
+                index.insert( it );
+            }
+        }
+    }
+    index_stale = false;
+}
+
 bool active_item_cache::add( item &it, point location, item *parent,
                              std::vector<item_pocket const *> const &pocket_chain )
 {
@@ -30,22 +107,17 @@ bool active_item_cache::add( item &it, point location, item *parent,
     if( speed == item::NO_PROCESSING ) {
         return ret;
     }
-    std::unordered_map<item *, safe_reference<item>> &target_index = active_items_index[speed];
-    std::list<item_reference> &target_list = active_items[speed];
-    if( target_index.empty() && !target_index.empty() ) {
-        // If the index has been cleared, rebuild it first.
-        for( item_reference &iter : target_list ) {
-            // Omit those expired references
-            if( iter.item_ref ) {
-                target_index.emplace( iter.item_ref.get(), iter.item_ref );
-            }
-        }
+    std::vector<item_reference> &target_list = active_items[speed].refs;
+    if( index_stale ) {
+        rebuild_index();
     }
     // If the item is already in the cache for some reason, don't add a second reference
-    auto iter = target_index.find( &it );
-    if( iter != target_index.end() ) {
-        // Ensure it's really what we want, and hasn't expired
-        if( iter->second && iter->second.get() == &it ) {
+    if( index.contains( &it ) ) {
+        // The index only learns about destroyed items when it's rebuilt, so make sure the entry
+        // isn't left over from another item that used to live at the same address.
+        if( std::any_of( target_list.begin(), target_list.end(), [&it]( const item_reference & ref ) {
+        return ref.item_ref.get() == &it;
+    } ) ) {
             return true;
         }
     }
@@ -57,30 +129,32 @@ bool active_item_cache::add( item &it, point location, item *parent,
         special_items[special_item_type::explosive].emplace_back( ref );
     }
     target_list.emplace_back( std::move( ref ) );
-    target_index.emplace( &it, it.get_safe_reference() );
+    index.insert( &it );
     return true;
 }
 
 bool active_item_cache::empty() const
 {
     return std::all_of( active_items.begin(), active_items.end(), []( const auto & active_queue ) {
-        return active_queue.second.empty();
+        return active_queue.second.refs.empty();
     } );
 }
 
 std::vector<item_reference> active_item_cache::get()
 {
     std::vector<item_reference> all_cached_items;
-    for( std::pair<const int, std::list<item_reference>> &kv : active_items ) {
-        for( std::list<item_reference>::iterator it = kv.second.begin(); it != kv.second.end(); ) {
-            if( it->item_ref ) {
-                all_cached_items.emplace_back( *it );
-                ++it;
+    for( std::pair<const int, item_queue> &kv : active_items ) {
+        bool found_broken = false;
+        for( const item_reference &ref : kv.second.refs ) {
+            if( ref.item_ref ) {
+                all_cached_items.emplace_back( ref );
             } else {
-                active_items_index[kv.first].clear();
-                it = kv.second.erase( it );
+                found_broken = true;
             }
         }
+        if( found_broken ) {
+            prune( kv.second );
+        }
     }
     return all_cached_items;
 }
@@ -88,51 +162,72 @@ std::vector<item_reference> active_item_cache::get()
 std::vector<item_reference> active_item_cache::get_for_processing()
 {
     std::vector<item_reference> items_to_process;
+    get_for_processing( items_to_process );
+    return items_to_process;
+}
+
+void active_item_cache::get_for_processing( std::vector<item_reference> &items_to_process,
+        const int low_priority_stretch )
+{
+    items_to_process.clear();
     items_to_process.reserve( std::accumulate( active_items.begin(), active_items.end(), std::size_t{ 0 },
     []( size_t prev, const auto & kv ) {
-        return prev + kv.second.size() / static_cast<size_t>( kv.first );
+        return prev + kv.second.refs.size() / static_cast<size_t>( kv.first ) + 1;
     } ) );
-    for( std::pair<const int, std::list<item_reference>> &kv : active_items ) {
-        // Rely on iteration logic to make sure the number is sane.
-        int num_to_process = kv.second.size() / kv.first;
-        std::list<item_reference>::iterator it = kv.second.begin();
-        for( ; it != kv.second.end() && num_to_process >= 0; ) {
-            if( it->item_ref ) {
-                items_to_process.push_back( *it );
+    for( std::pair<const int, item_queue> &kv : active_items ) {
+        item_queue &queue = kv.second;
+        const size_t count = queue.refs.size();
+        if( count == 0 ) {
+            continue;
+        }
+        const int interval = kv.first > 1 ? kv.first * low_priority_stretch : kv.first;
+        size_t num_to_process = count / interval + 1;
+        bool found_broken = false;
+        size_t pos = queue.next;
+        for( size_t visited = 0; visited < count && num_to_process > 0; ++visited ) {
+            const item_reference &ref = queue.refs[pos];
+            if( ref.item_ref ) {
+                items_to_process.push_back( ref );
                 --num_to_process;
-                ++it;
             } else {
-                // The item has been destroyed, so remove the reference from the cache
-                active_items_index[kv.first].clear();
-                it = kv.second.erase( it );
+                // The item has been destroyed, the reference is dropped below.
+                found_broken = true;
             }
+            pos = pos + 1 == count ? 0 : pos + 1;
+        }
+        // Continue after the returned items next time, so the ones that weren't returned this
+        // time will be first in line on the next call
+        queue.next = pos;
+        if( found_broken ) {
+            prune( queue );
         }
-        // Rotate the returned items to the end of their list so that the items that weren't
-        // returned this time will be first in line on the next call
-        kv.second.splice( kv.second.end(), kv.second, kv.second.begin(), it );
     }
-    return items_to_process;
 }
 
-std::vector<item_reference> active_item_cache::get_special( special_item_type type )
+size_t active_item_cache::low_priority_per_turn() const
 {
-    std::vector<item_reference> matching_items;
-    std::list<item_reference> &items = special_items[type];
-    for( auto it = items.begin(); it != items.end(); ) {
-        if( it->item_ref ) {
-            matching_items.push_back( *it );
-            ++it;
-        } else {
-            it = items.erase( it );
+    size_t count = 0;
+    for( const std::pair<const int, item_queue> &kv : active_items ) {
+        if( kv.first > 1 ) {
+            count += kv.second.refs.size() / kv.first + 1;
         }
     }
-    return matching_items;
+    return count;
+}
+
+std::vector<item_reference> active_item_cache::get_special( special_item_type type )
+{
+    std::vector<item_reference> &items = special_items[type];
+    items.erase( std::remove_if( items.begin(), items.end(), []( const item_reference & ref ) {
+        return !ref.item_ref;
+    } ), items.end() );
+    return items;
 }
 
 void active_item_cache::subtract_locations( const point &delta )
 {
-    for( std::pair<const int, std::list<item_reference>> &pair : active_items ) {
-        for( item_reference &ir : pair.second ) {
+    for( std::pair<const int, item_queue> &pair : active_items ) {
+        for( item_reference &ir : pair.second.refs ) {
             ir.location -= delta;
         }
     }
@@ -140,8 +235,8 @@ void active_item_cache::subtract_locations( const point &delta )
 
 void active_item_cache::rotate_locations( int turns, const point &dim )
 {
-    for( std::pair<const int, std::list<item_reference>> &pair : active_items ) {
-        for( item_reference &ir : pair.second ) {
+    for( std::pair<const int, item_queue> &pair : active_items ) {
+        for( item_reference &ir : pair.second.refs ) {
             ir.location = ir.location.rotate( turns, dim );
         }
     }
@@ -149,8 +244,8 @@ void active_item_cache::rotate_locations( int turns, const point &dim )
 
 void active_item_cache::mirror( const point &dim, bool horizontally )
 {
-    for( std::pair<const int, std::list<item_reference>> &pair : active_items ) {
-        for( item_reference &ir : pair.second ) {
+    for( std::pair<const int, item_queue> &pair : active_items ) {
+        for( item_reference &ir : pair.second.refs ) {
             if( horizontally ) {
                 ir.location.x = dim.x - 1 - ir.location.x;
             } else {
@@ -3,7 +3,6 @@
 #define CATA_SRC_ACTIVE_ITEM_CACHE_H
 
 #include <cstddef>
-#include <list>
 #include <unordered_map>
 #include <vector>
 
@@ -50,9 +49,37 @@ struct hash<special_item_type> {
 class active_item_cache
 {
     private:
-        std::unordered_map<int, std::list<item_reference>> active_items;
-        std::unordered_map<special_item_type, std::list<item_reference>> special_items;
-        std::unordered_map<int, std::unordered_map<item *, safe_reference<item>>> active_items_index;
+        // References to items sharing a processing speed. They take turns being processed,
+        // starting at @ref next and wrapping around at the end.
+        struct item_queue {
+            std::vector<item_reference> refs;
+            size_t next = 0;
+        };
+
+        // A flat, open-addressing set of the items in the cache, so adding one twice is cheap to
+        // detect. Entries are never removed one by one; the whole set is rebuilt instead once
+        // references have been dropped from the queues.
+        class item_index
+        {
+            public:
+                bool contains( const item *it ) const;
+                void insert( const item *it );
+                void clear();
+            private:
+                size_t slot_of( const item *it ) const;
+                std::vector<const item *> slots;
+                size_t used = 0;
+        };
+
+        // Drops broken references from the queue, keeping the order of the others.
+        void prune( item_queue &queue );
+        void rebuild_index();
+
+        std::unordered_map<int, item_queue> active_items;
+        std::unordered_map<special_item_type, std::vector<item_reference>> special_items;
+        item_index index;
+        // Set when references were dropped, so the index has to be rebuilt before it's used again.
+        bool index_stale = false;
     public:
         /**
          * Adds the reference to the cache. Does nothing if the reference is already in the cache.
@@ -73,14 +100,27 @@ class active_item_cache
         std::vector<item_reference> get();
 
         /**
-         * Returns the first size() / processing_speed() elements of each list, rounded up.
-         * Items returned are rotated to the back of their respective lists, otherwise only the
-         * first n items will ever be processed.
+         * Returns the next size() / processing_speed() elements of each queue, rounded up.
+         * The following call continues after the items returned, otherwise only the first n items
+         * would ever be processed.
          * Broken references encountered when collecting the items to be processed are removed from
          * the cache.
          * Relies on the fact that item::processing_speed() is a constant.
          */
         std::vector<item_reference> get_for_processing();
+        /**
+         * Same as above, but fills @p items_to_process (after clearing it) so the caller can
+         * reuse its storage from turn to turn.
+         * Lists of items that are processed less often than every turn are handed out
+         * @p low_priority_stretch times slower, see @ref low_priority_per_turn.
+         */
+        void get_for_processing( std::vector<item_reference> &items_to_process,
+                                 int low_priority_stretch = 1 );
+        /**
+         * Roughly how many items with a processing_speed() above 1 (food, corpses) a call to
+         * get_for_processing() hands out per turn.
+         */
+        size_t low_priority_per_turn() const;
 
         /**
          * Returns the currently tracked list of special active items.
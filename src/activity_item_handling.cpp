@@ -136,6 +136,7 @@ static const zone_type_id zone_type_LOOT_CORPSE( "LOOT_CORPSE" );
 static const zone_type_id zone_type_LOOT_CUSTOM( "LOOT_CUSTOM" );
 static const zone_type_id zone_type_LOOT_IGNORE( "LOOT_IGNORE" );
 static const zone_type_id zone_type_LOOT_IGNORE_FAVORITES( "LOOT_IGNORE_FAVORITES" );
+static const zone_type_id zone_type_LOOT_ITEM_GROUP( "LOOT_ITEM_GROUP" );
 static const zone_type_id zone_type_LOOT_UNSORTED( "LOOT_UNSORTED" );
 static const zone_type_id zone_type_LOOT_WOOD( "LOOT_WOOD" );
 static const zone_type_id zone_type_MINING( "MINING" );
@@ -2155,6 +2156,26 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
         }
     }
     if( stage == DO ) {
+        // Destinations only depend on the item for filtered zone types, so look the others
+        // up once for all items on the tile instead of once per item.
+        std::unordered_map<zone_type_id, std::unordered_set<tripoint_abs_ms>> dest_sets;
+        std::unordered_set<tripoint_abs_ms> item_dest_set;
+        const auto get_dest_set = [&]( const zone_type_id & id,
+        const item & thisitem ) -> const std::unordered_set<tripoint_abs_ms> & {
+            if( id == zone_type_LOOT_CUSTOM || id == zone_type_LOOT_ITEM_GROUP )
+            {
+                item_dest_set = mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE, &thisitem,
+                                              _fac_id( you ) );
+                return item_dest_set;
+            }
+            auto iter = dest_sets.find( id );
+            if( iter == dest_sets.end() )
+            {
+                iter = dest_sets.emplace( id, mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE, nullptr,
+                                          _fac_id( you ) ) ).first;
+            }
+            return iter->second;
+        };
         // TODO: fix point types
         const tripoint_abs_ms src( act.placement );
         const tripoint_bub_ms src_loc = here.bub_from_abs( src );
@@ -2238,8 +2259,7 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
                 continue;
             }
 
-            const std::unordered_set<tripoint_abs_ms> dest_set =
-                mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE, &thisitem, _fac_id( you ) );
+            const std::unordered_set<tripoint_abs_ms> &dest_set = get_dest_set( id, thisitem );
 
             // if this item isn't going anywhere and its not sealed
             // check if it is in a unload zone or a strip corpse zone
@@ -1669,6 +1669,13 @@ bool advanced_inventory::action_move_item( advanced_inv_listitem *sitem,
     return exit;
 }
 
+void advanced_inventory::forget_listings()
+{
+    for( advanced_inv_area &square : squares ) {
+        square.forget_listings();
+    }
+}
+
 void advanced_inventory::action_examine( advanced_inv_listitem *sitem,
         advanced_inventory_pane &spane )
 {
@@ -1707,6 +1714,7 @@ void advanced_inventory::action_examine( advanced_inv_listitem *sitem,
         if( spane.get_area() == AIM_INVENTORY ) {
             player_character.inv->restack( player_character );
         }
+        forget_listings();
         recalc = true;
     } else {
         item &it = *sitem->items.front();
@@ -1920,6 +1928,7 @@ void advanced_inventory::display()
                 get_auto_pickup().add_rule( &*sitem->items.front(), true );
                 sitem->autopickup = true;
             }
+            forget_listings();
             recalc = true;
         } else if( action == "EXAMINE" ) {
             if( sitem == nullptr ) {
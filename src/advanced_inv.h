@@ -128,6 +128,8 @@ class advanced_inventory
                                const std::string &action );
 
         void action_examine( advanced_inv_listitem *sitem, advanced_inventory_pane &spane );
+        /** Rebuilds the listings of all squares on the next recalculation. */
+        void forget_listings();
 
         // store/load settings (such as index, filter, etc)
         void save_settings( bool only_panes );
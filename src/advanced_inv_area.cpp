@@ -18,6 +18,7 @@
 #include "field.h"
 #include "field_type.h"
 #include "game_constants.h"
+#include "hash_utils.h"
 #include "inventory.h"
 #include "item.h"
 #include "map.h"
@@ -316,3 +317,77 @@ advanced_inv_area::itemstack advanced_inv_area::i_stacked<vehicle_stack>( vehicl
 
 template
 advanced_inv_area::itemstack advanced_inv_area::i_stacked<map_stack>( map_stack items );
+
+// Covers the changes to the items that show in their entries. Other changes, like renaming an
+// item, need a call to forget_listings.
+template <typename T>
+static size_t listing_fingerprint( T &items )
+{
+    size_t fingerprint = 0;
+    for( const item &it : items ) {
+        cata::hash_combine( fingerprint, &it );
+        cata::hash_combine( fingerprint, it.typeId() );
+        cata::hash_combine( fingerprint, it.charges );
+        cata::hash_combine( fingerprint, it.damage() );
+        cata::hash_combine( fingerprint, to_turns<int>( it.get_rot() ) );
+        cata::hash_combine( fingerprint, to_milligram( it.weight() ) );
+    }
+    return fingerprint;
+}
+
+template <typename T>
+const std::vector<advanced_inv_listitem> &advanced_inv_area::get_listing( T items,
+        bool in_vehicle )
+{
+    listing &cached = listings[in_vehicle ? 1 : 0];
+    const size_t fingerprint = listing_fingerprint( items );
+    if( cached.valid && cached.fingerprint == fingerprint && cached.pos == pos &&
+        cached.veh == veh && cached.vstor == vstor ) {
+        return cached.entries;
+    }
+    cached.fingerprint = fingerprint;
+    cached.pos = pos;
+    cached.veh = veh;
+    cached.vstor = vstor;
+    cached.valid = true;
+    cached.entries.clear();
+
+    const itemstack stacks = i_stacked( items );
+    map_cursor loc_cursor( pos );
+    for( size_t x = 0; x < stacks.size(); ++x ) {
+        std::vector<item_location> locs;
+        locs.reserve( stacks[x].size() );
+        for( item *const it : stacks[x] ) {
+            if( in_vehicle ) {
+                locs.emplace_back( vehicle_cursor( *veh, vstor ), it );
+            } else {
+                locs.emplace_back( loc_cursor, it );
+                if( it->is_corpse() ) {
+                    for( item *loot : it->all_items_top( pocket_type::CONTAINER ) ) {
+                        cached.entries.emplace_back(
+                            item_location( item_location( loc_cursor, it ), loot ), 0, 1, id,
+                            in_vehicle );
+                    }
+                }
+            }
+        }
+        cached.entries.emplace_back( locs, x, id, in_vehicle );
+    }
+    return cached.entries;
+}
+
+template
+const std::vector<advanced_inv_listitem> &advanced_inv_area::get_listing<vehicle_stack>(
+    vehicle_stack items, bool in_vehicle );
+
+template
+const std::vector<advanced_inv_listitem> &advanced_inv_area::get_listing<map_stack>(
+    map_stack items, bool in_vehicle );
+
+void advanced_inv_area::forget_listings()
+{
+    for( listing &cached : listings ) {
+        cached.valid = false;
+        cached.entries.clear();
+    }
+}
@@ -6,6 +6,7 @@
 #include <iosfwd>
 #include <vector>
 
+#include "advanced_inv_listitem.h"
 #include "item_location.h"
 #include "point.h"
 #include "units.h" // IWYU pragma: keep
@@ -32,7 +33,6 @@ enum aim_location : char {
     AIM_AROUND_END = AIM_NORTHEAST
 };
 
-class advanced_inv_listitem;
 class item;
 class vehicle;
 class vehicle_stack;
@@ -82,6 +82,20 @@ class advanced_inv_area
         // used for isometric view
         const aim_location relative_location;
 
+        /**
+         * Unfiltered listing of the items on the ground or in the vehicle cargo, kept across
+         * recalculations of the panes, see @ref get_listing.
+         */
+        struct listing {
+            // of the items the entries were made from, see @ref get_listing
+            size_t fingerprint = 0;
+            tripoint pos;
+            const vehicle *veh = nullptr;
+            int vstor = -1;
+            bool valid = false;
+            std::vector<advanced_inv_listitem> entries;
+        };
+
         // NOLINTNEXTLINE(google-explicit-constructor)
         advanced_inv_area( aim_location id ) : id( id ), relative_location( id ) {}
         advanced_inv_area(
@@ -93,6 +107,15 @@ class advanced_inv_area
 
         template <typename T>
         advanced_inv_area::itemstack i_stacked( T items );
+        /**
+         * The stacked entries of the items in @p items, which are on the ground or in the
+         * vehicle cargo of this area. The entries are only rebuilt if the items were added,
+         * removed, or changed their charges, damage, rot or weight since the last call.
+         */
+        template <typename T>
+        const std::vector<advanced_inv_listitem> &get_listing( T items, bool in_vehicle );
+        /** Makes @ref get_listing rebuild the entries, for changes it can't notice. */
+        void forget_listings();
         int get_item_count() const;
         // Other area is actually the same item source, e.g. dragged vehicle to the south and AIM_SOUTH
         bool is_same( const advanced_inv_area &other ) const;
@@ -103,5 +126,9 @@ class advanced_inv_area
         bool can_store_in_vehicle() const;
         // @return vehicle_stack for this area, call only if can_store_in_vehicle is true
         vehicle_stack get_vehicle_stack() const;
+
+    private:
+        // of the ground and the vehicle cargo
+        std::array<listing, 2> listings;
 };
 #endif // CATA_SRC_ADVANCED_INV_AREA_H
@@ -11,7 +11,9 @@
 #include "cata_assert.h"
 #include "flag.h"
 #include "item.h"
+#include "item_pocket.h"
 #include "item_search.h"
+#include "item_tname.h"
 #include "make_static.h"
 #include "map.h"
 #include "map_selector.h"
@@ -194,6 +196,9 @@ void advanced_inventory_pane::add_items_from_area( advanced_inv_area &square,
     if( !square.canputitems( container ) ) {
         return;
     }
+    // items are named and weighed several times while filtering and listing them
+    tname::cache_scope const names;
+    item_pocket::totals_scope const totals;
     map &m = get_map();
     avatar &u = get_avatar();
     // Existing items are *not* cleared on purpose, this might be called
@@ -244,33 +249,10 @@ void advanced_inventory_pane::add_items_from_area( advanced_inv_area &square,
             square.volume = 0_ml;
             square.weight = 0_gram;
         }
-        const advanced_inv_area::itemstack &stacks = is_in_vehicle ?
-                square.i_stacked( square.get_vehicle_stack() ) :
-                square.i_stacked( m.i_at( square.pos ) );
-
-        map_cursor loc_cursor( square.pos );
-        for( size_t x = 0; x < stacks.size(); ++x ) {
-            std::vector<item_location> locs;
-            locs.reserve( stacks[x].size() );
-            for( item *const it : stacks[x] ) {
-                if( is_in_vehicle ) {
-                    locs.emplace_back( vehicle_cursor( *square.veh, square.vstor ), it );
-                } else {
-                    locs.emplace_back( loc_cursor, it );
-                    if( it->is_corpse() ) {
-                        for( item *loot : it->all_items_top( pocket_type::CONTAINER ) ) {
-                            if( !is_filtered( *loot ) ) {
-                                advanced_inv_listitem aim_item( item_location( item_location( loc_cursor, it ), loot ),
-                                                                0, 1, square.id, is_in_vehicle );
-                                square.volume += aim_item.volume;
-                                square.weight += aim_item.weight;
-                                items.push_back( aim_item );
-                            }
-                        }
-                    }
-                }
-            }
-            advanced_inv_listitem it( locs, x, square.id, is_in_vehicle );
+        const std::vector<advanced_inv_listitem> &listing = is_in_vehicle ?
+                square.get_listing( square.get_vehicle_stack(), true ) :
+                square.get_listing( m.i_at( square.pos ), false );
+        for( const advanced_inv_listitem &it : listing ) {
             if( is_filtered( *it.items.front() ) ) {
                 continue;
             }
@@ -68,22 +68,8 @@ static bool within_autopickup_limits( const item *pickup_item )
  */
 static rule_state get_autopickup_rule( const item *pickup_item )
 {
-    std::string item_name = pickup_item->tname( 1, false );
-    rule_state pickup_state = get_auto_pickup().check_item( item_name );
-
-    if( pickup_state == rule_state::WHITELISTED ) {
-        return rule_state::WHITELISTED;
-    } else if( pickup_state != rule_state::BLACKLISTED ) {
-        //No prematched pickup rule found, check rules in more detail
-        get_auto_pickup().create_rule( pickup_item );
-
-        if( get_auto_pickup().check_item( item_name ) == rule_state::WHITELISTED ) {
-            return rule_state::WHITELISTED;
-        }
-    } else {
-        return rule_state::BLACKLISTED;
-    }
-    return rule_state::NONE;
+    const std::string item_name = pickup_item->tname( 1, false );
+    return get_auto_pickup().match_item( *pickup_item, item_name );
 }
 
 /**
@@ -746,6 +732,8 @@ bool player_settings::has_rule( const item *it )
 void player_settings::add_rule( const item *it, bool include )
 {
     character_rules.push_back( rule( it->tname( 1, false ), true, !include ) );
+    // The new rule may match names that no rule matched before
+    map_items.unmatched.clear();
     create_rule( it );
 
     if( !get_option<bool>( "AUTO_PICKUP" ) &&
@@ -810,7 +798,13 @@ bool check_special_rule( const std::map<material_id, int> &materials, const std:
 //Special case. Required for NPC harvest auto pickup. Ignores material rules.
 void npc_settings::create_rule( const std::string &to_match )
 {
+    if( map_items.unmatched.count( to_match ) ) {
+        return;
+    }
     rules.create_rule( map_items, to_match );
+    if( map_items.find( to_match ) == map_items.end() ) {
+        map_items.unmatched.insert( to_match );
+    }
 }
 
 void rule_list::create_rule( cache &map_items, const std::string &to_match )
@@ -827,19 +821,35 @@ void rule_list::create_rule( cache &map_items, const std::string &to_match )
 void player_settings::create_rule( const item *it )
 {
     // TODO: change it to be a reference
-    global_rules.create_rule( map_items, *it );
-    character_rules.create_rule( map_items, *it );
+    const std::string to_match = it->tname( 1, false );
+    global_rules.create_rule( map_items, *it, to_match );
+    character_rules.create_rule( map_items, *it, to_match );
 }
 
-void rule_list::create_rule( cache &map_items, const item &it )
+rule_state player_settings::match_item( const item &it, const std::string &name )
 {
-    const std::string to_match = it.tname( 1, false );
+    const rule_state state = check_item( name );
+    if( state != rule_state::NONE || map_items.unmatched.count( name ) ) {
+        return state;
+    }
+    //No prematched pickup rule found, check rules in more detail
+    global_rules.create_rule( map_items, it, name );
+    character_rules.create_rule( map_items, it, name );
+    const rule_state matched = check_item( name );
+    if( matched == rule_state::NONE ) {
+        map_items.unmatched.insert( name );
+    }
+    return matched;
+}
 
+void rule_list::create_rule( cache &map_items, const item &it, const std::string &to_match )
+{
+    const std::map<material_id, int> &materials = it.made_of();
     for( const rule &elem : *this ) {
         if( !elem.bActive ) {
             continue;
         }
-        if( !check_special_rule( it.made_of(), elem.sRule ) &&
+        if( !check_special_rule( materials, elem.sRule ) &&
             !wildcard_match( to_match, elem.sRule ) ) {
             continue;
         }
@@ -1038,6 +1048,7 @@ void base_settings::recreate() const
 {
     map_items.clear();
     map_items.temp_items.clear();
+    map_items.unmatched.clear();
     refresh_map_items( map_items );
     map_items.ready = true;
     map_items.temp_items.clear();
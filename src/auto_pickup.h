@@ -6,6 +6,7 @@
 #include <iosfwd>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "enums.h"
@@ -36,6 +37,9 @@ class cache : public std::unordered_map<std::string, rule_state>
 
         /// Temporary data used while filling the cache.
         std::unordered_map<std::string, const itype *> temp_items;
+
+        /// Names that were checked against every rule in detail without any rule matching.
+        std::unordered_set<std::string> unmatched;
 };
 
 /**
@@ -72,7 +76,7 @@ class rule_list : public std::vector<rule>
         void refresh_map_items( cache &map_items ) const;
 
         void create_rule( cache &map_items, const std::string &to_match );
-        void create_rule( cache &map_items, const item &it );
+        void create_rule( cache &map_items, const item &it, const std::string &to_match );
 };
 
 class user_interface
@@ -127,6 +131,12 @@ class player_settings : public base_settings
     public:
         ~player_settings() override = default;
         void create_rule( const item *it );
+        /**
+         * The rule for @p it, whose name is @p name, checking the rules in detail if no
+         * prematched rule applies. Each name is only checked in detail once until the rules
+         * change, even if no rule matched it.
+         */
+        rule_state match_item( const item &it, const std::string &name );
         bool has_rule( const item *it );
         void add_rule( const item *it, bool include );
         void remove_rule( const item *it );
@@ -50,6 +50,7 @@
 #include "map.h"
 #include "map_memory.h"
 #include "martialarts.h"
+#include "memory_accounting.h"
 #include "messages.h"
 #include "mission.h"
 #include "morale.h"
@@ -245,6 +246,11 @@ bool avatar::is_map_memory_valid() const
     return player_map_memory->is_valid();
 }
 
+memory_accounting::usage avatar::map_memory_usage() const
+{
+    return player_map_memory->memory_usage();
+}
+
 bool avatar::should_show_map_memory() const
 {
     if( get_timed_events().get( timed_event_type::OVERRIDE_PLACE ) ) {
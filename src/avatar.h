@@ -51,6 +51,10 @@ namespace debug_menu
 {
 class mission_debug;
 }  // namespace debug_menu
+namespace memory_accounting
+{
+struct usage;
+}  // namespace memory_accounting
 struct mtype;
 enum class pool_type;
 
@@ -144,6 +148,8 @@ class avatar : public Character
         void toggle_map_memory();
         //! @copydoc map_memory::is_valid() const
         bool is_map_memory_valid() const;
+        //! @copydoc map_memory::memory_usage() const
+        memory_accounting::usage map_memory_usage() const;
         bool should_show_map_memory() const;
         void prepare_map_memory_region( const tripoint_abs_ms &p1, const tripoint_abs_ms &p2 );
         const memorized_tile &get_memorized_tile( const tripoint_abs_ms &p ) const;
@@ -0,0 +1,146 @@
+#include "background_file_writer.h"
+
+#include <exception>
+#include <system_error>
+#include <utility>
+
+#include "debug.h"
+#include "ofstream_wrapper.h"
+#include "path_info.h"
+#include "string_formatter.h"
+
+background_file_writer::~background_file_writer()
+{
+    {
+        std::lock_guard<std::mutex> lock( mut );
+        stopping = true;
+    }
+    job_ready.notify_all();
+    // The thread finishes the queue before leaving, so nothing queued is lost on exit.
+    if( writer.joinable() ) {
+        writer.join();
+    }
+}
+
+void background_file_writer::write( const cata_path &path, std::string contents )
+{
+    push( { path.get_unrelative_path(), std::move( contents ) } );
+}
+
+void background_file_writer::remove( const cata_path &path )
+{
+    push( { path.get_unrelative_path(), std::nullopt } );
+}
+
+void background_file_writer::push( job &&j )
+{
+    report_errors();
+    {
+        std::lock_guard<std::mutex> lock( mut );
+        jobs.emplace_back( std::move( j ) );
+        if( !writer.joinable() ) {
+            writer = std::thread( &background_file_writer::thread_loop, this );
+        }
+    }
+    job_ready.notify_one();
+}
+
+void background_file_writer::flush()
+{
+    {
+        std::unique_lock<std::mutex> lock( mut );
+        jobs_done.wait( lock, [this] {
+            return jobs.empty() && !job_running;
+        } );
+    }
+    report_errors();
+}
+
+void background_file_writer::flush( const cata_path &path )
+{
+    const fs::path p = path.get_unrelative_path();
+    {
+        std::unique_lock<std::mutex> lock( mut );
+        jobs_done.wait( lock, [&] {
+            return !is_queued( p );
+        } );
+    }
+    report_errors();
+}
+
+bool background_file_writer::is_queued( const fs::path &path ) const
+{
+    if( job_running && running_path == path ) {
+        return true;
+    }
+    for( const job &j : jobs ) {
+        if( j.path == path ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool background_file_writer::idle()
+{
+    std::lock_guard<std::mutex> lock( mut );
+    return jobs.empty() && !job_running;
+}
+
+void background_file_writer::report_errors()
+{
+    std::vector<std::string> failed;
+    {
+        std::lock_guard<std::mutex> lock( mut );
+        failed.swap( errors );
+    }
+    for( const std::string &msg : failed ) {
+        debugmsg( "%s", msg );
+    }
+}
+
+void background_file_writer::thread_loop()
+{
+    std::unique_lock<std::mutex> lock( mut );
+    while( true ) {
+        job_ready.wait( lock, [this] {
+            return stopping || !jobs.empty();
+        } );
+        if( jobs.empty() ) {
+            return;
+        }
+        job j = std::move( jobs.front() );
+        jobs.pop_front();
+        job_running = true;
+        running_path = j.path;
+        lock.unlock();
+
+        std::string error;
+        try {
+            if( j.contents ) {
+                ofstream_wrapper fout( j.path, std::ios::binary );
+                fout.stream() << *j.contents;
+                fout.close();
+            } else {
+                std::error_code ec;
+                fs::remove( j.path, ec );
+            }
+        } catch( const std::exception &err ) {
+            error = string_format( "Failed to write \"%s\": %s", j.path.u8string(), err.what() );
+        }
+
+        lock.lock();
+        if( !error.empty() ) {
+            errors.emplace_back( std::move( error ) );
+        }
+        job_running = false;
+        // flush( path ) may be waiting for this very job
+        jobs_done.notify_all();
+    }
+}
+
+background_file_writer &get_background_file_writer()
+{
+    static background_file_writer writer;
+    return writer;
+}
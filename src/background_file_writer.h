@@ -0,0 +1,84 @@
+#pragma once
+#ifndef CATA_SRC_BACKGROUND_FILE_WRITER_H
+#define CATA_SRC_BACKGROUND_FILE_WRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#else
+#   include <thread>
+#endif
+
+#include "filesystem.h"
+
+class cata_path;
+
+/**
+ * Writes files from a background thread, so the game can continue while
+ * slow disks catch up.
+ *
+ * The data is serialized on the main thread and only the finished file
+ * contents are handed over, which keeps the writer thread away from any game
+ * state. Files are written through @ref ofstream_wrapper, so each one is
+ * replaced atomically. Jobs are run in the order they were queued.
+ */
+class background_file_writer
+{
+    public:
+        background_file_writer() = default;
+        ~background_file_writer();
+
+        background_file_writer( const background_file_writer & ) = delete;
+        background_file_writer &operator=( const background_file_writer & ) = delete;
+
+        /** Queues writing @p contents to @p path, replacing any existing file. */
+        void write( const cata_path &path, std::string contents );
+        /** Queues removing the file at @p path, after any writes queued before it. */
+        void remove( const cata_path &path );
+
+        /**
+         * Blocks until all queued jobs are done and reports any failures
+         * since the last call. Must be called before reading back a file that
+         * may still be queued.
+         */
+        void flush();
+        /** Like @ref flush, but only waits for the jobs for @p path. */
+        void flush( const cata_path &path );
+
+        /** @returns true if no job is queued or running. */
+        bool idle();
+
+    private:
+        struct job {
+            fs::path path;
+            // nullopt removes the file
+            std::optional<std::string> contents;
+        };
+
+        void push( job &&j );
+        // Expects @ref mut to be held.
+        bool is_queued( const fs::path &path ) const;
+        void thread_loop();
+        void report_errors();
+
+        std::thread writer;
+        std::mutex mut;
+        std::condition_variable job_ready;
+        std::condition_variable jobs_done;
+        std::deque<job> jobs;
+        bool job_running = false;
+        fs::path running_path;
+        bool stopping = false;
+        std::vector<std::string> errors;
+};
+
+/** The writer used for saving the game in the background. */
+background_file_writer &get_background_file_writer();
+
+#endif // CATA_SRC_BACKGROUND_FILE_WRITER_H
@@ -1,6 +1,7 @@
 #include "behavior.h"
 
 #include <list>
+#include <optional>
 #include <set>
 #include <unordered_map>
 #include <utility>
@@ -22,7 +23,7 @@ void node_t::add_predicate( const
                             std::function<status_t ( const oracle_t *, const std::string & )> &
                             new_predicate, const std::string &argument, const bool &invert_result )
 {
-    conditions.emplace_back( new_predicate, argument, invert_result );
+    conditions.push_back( { new_predicate, argument, invert_result } );
 }
 void node_t::set_goal( const std::string &new_goal )
 {
@@ -37,14 +38,10 @@ status_t node_t::process_predicates( const oracle_t *subject ) const
 {
     status_t result = status_t::running;
 
-    for( const std::tuple< predicate_type, std::string, bool > &predicate_tuple : conditions ) {
-        predicate_type pt = std::get<0>( predicate_tuple );
-        std::string pargs = std::get<1>( predicate_tuple );
-        bool pinvert = std::get<2>( predicate_tuple );
+    for( const condition &cond : conditions ) {
+        result = evaluate( cond, subject );
 
-        result = pt( subject, pargs );
-
-        if( pinvert ) {
+        if( cond.invert_result ) {
             if( result == status_t::running ) {
                 result = status_t::failure;
             } else if( result == status_t::failure ) {
@@ -60,6 +57,23 @@ status_t node_t::process_predicates( const oracle_t *subject ) const
     return result;
 }
 
+status_t node_t::evaluate( const condition &cond, const oracle_t *subject )
+{
+    if( cond.name == nullptr || subject == nullptr ) {
+        return cond.predicate( subject, cond.argument );
+    }
+    const std::optional<status_t> known = subject->remembered( cond.name, cond.argument );
+    if( predicate_counting() ) {
+        count_predicate( *cond.name, known.has_value() );
+    }
+    if( known ) {
+        return *known;
+    }
+    const status_t result = cond.predicate( subject, cond.argument );
+    subject->remember( cond.name, cond.argument, result );
+    return result;
+}
+
 behavior_return node_t::tick( const oracle_t *subject ) const
 {
     if( children.empty() ) {
@@ -84,6 +98,9 @@ std::string node_t::goal() const
 
 std::string tree::tick( const oracle_t *subject )
 {
+    if( subject != nullptr ) {
+        subject->forget();
+    }
     behavior_return result = root->tick( subject );
     active_node = result.result == status_t::running ? result.selection : nullptr;
     return goal();
@@ -162,8 +179,8 @@ void node_t::load( const JsonObject &jo, const std::string_view )
         }
         const std::string predicate_argument = predicate_object.get_string( "argument", "" );
         const bool invert_result = predicate_object.get_bool( "invert_result", false );
-        conditions.emplace_back( new_predicate->second, predicate_argument,
-                                 invert_result );
+        conditions.push_back( { new_predicate->second, predicate_argument, invert_result,
+                                &new_predicate->first } );
     }
     optional( jo, was_loaded, "goal", _goal );
 }
@@ -80,8 +80,16 @@ class node_t
         std::vector<const node_t *> children;
         const strategy_t *strategy = nullptr;
         using predicate_type = std::function<status_t( const oracle_t *, const std::string & )>;
-        std::vector<std::tuple<predicate_type, std::string, bool>> conditions;
+        struct condition {
+            predicate_type predicate;
+            std::string argument;
+            bool invert_result = false;
+            // Key in predicate_map for loaded predicates, whose results the subject remembers
+            const std::string *name = nullptr;
+        };
+        std::vector<condition> conditions;
         status_t process_predicates( const oracle_t *subject ) const;
+        static status_t evaluate( const condition &cond, const oracle_t *subject );
         // TODO: make into an ID?
         std::string _goal;
 };
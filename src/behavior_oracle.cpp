@@ -1,8 +1,11 @@
 #include "behavior_oracle.h"
 
 #include <functional>
+#include <map>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "behavior.h"
 #include "character_oracle.h"
@@ -11,11 +14,69 @@
 namespace behavior
 {
 
+std::optional<status_t> oracle_t::remembered( const std::string *predicate,
+        const std::string_view argument ) const
+{
+    for( const remembered_result &entry : results ) {
+        if( entry.predicate == predicate && entry.argument == argument ) {
+            return entry.result;
+        }
+    }
+    return std::nullopt;
+}
+
+void oracle_t::remember( const std::string *predicate, const std::string_view argument,
+                         const status_t result ) const
+{
+    results.push_back( { predicate, std::string( argument ), result } );
+}
+
+void oracle_t::forget() const
+{
+    results.clear();
+}
+
 status_t return_running( const oracle_t *, const std::string_view )
 {
     return status_t::running;
 }
 
+namespace
+{
+bool counting_predicates = false;
+std::map<std::string, predicate_count> counted_predicates;
+} // namespace
+
+void set_predicate_counting( const bool enabled )
+{
+    counting_predicates = enabled;
+}
+
+bool predicate_counting()
+{
+    return counting_predicates;
+}
+
+const std::map<std::string, predicate_count> &predicate_counts()
+{
+    return counted_predicates;
+}
+
+void reset_predicate_counts()
+{
+    counted_predicates.clear();
+}
+
+void count_predicate( const std::string &predicate, const bool reused )
+{
+    predicate_count &count = counted_predicates[predicate];
+    if( reused ) {
+        count.reused++;
+    } else {
+        count.evaluated++;
+    }
+}
+
 // Just a little helper to make populating predicate_map slightly less gross.
 static std::function < status_t( const oracle_t *, std::string_view ) >
 make_function( status_t ( character_oracle_t::* fun )( std::string_view ) const )
@@ -4,8 +4,11 @@
 
 #include <functional>
 #include <iosfwd>
+#include <map>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace behavior
 {
@@ -20,10 +23,43 @@ enum class status_t : char;
  */
 class oracle_t
 {
+    public:
+        /**
+         * Result @p predicate gave for @p argument since the last @ref forget, so trees asking the
+         * same question in several nodes only have it answered once per tick.
+         * @p predicate is the name of an entry of @ref predicate_map.
+         */
+        std::optional<status_t> remembered( const std::string *predicate,
+                                            std::string_view argument ) const;
+        void remember( const std::string *predicate, std::string_view argument,
+                       status_t result ) const;
+        /** Drops remembered results. Trees do this on each tick, the subject may have changed. */
+        void forget() const;
+    private:
+        struct remembered_result {
+            const std::string *predicate;
+            std::string argument;
+            status_t result;
+        };
+        // Few predicates are asked per tick, a vector beats any map here
+        mutable std::vector<remembered_result> results;
 };
 
 status_t return_running( const oracle_t *, std::string_view );
 
+/** How often a predicate was evaluated, and how often a remembered result was used instead. */
+struct predicate_count {
+    int evaluated = 0;
+    int reused = 0;
+};
+
+/** Profiling hook, counts predicate calls by name while enabled. Off by default. */
+void set_predicate_counting( bool enabled );
+bool predicate_counting();
+const std::map<std::string, predicate_count> &predicate_counts();
+void reset_predicate_counts();
+void count_predicate( const std::string &predicate, bool reused );
+
 extern std::unordered_map<std::string, std::function<status_t( const oracle_t *, std::string_view )>>
         predicate_map;
 
@@ -1268,7 +1268,7 @@ bool Character::activate_bionic( bionic &bio, bool eff_only, bool *close_bionics
     }
     bio_flag_cache.clear();
     // Recalculate stats (strength, mods from pain etc.) that could have been affected
-    calc_encumbrance();
+    calc_encumbrance_modifiers();
     reset();
 
     // Also reset crafting inventory cache if this bionic spawned a fake item
@@ -1366,7 +1366,7 @@ bool Character::deactivate_bionic( bionic &bio, bool eff_only )
     }
 
     // Recalculate stats (strength, mods from pain etc.) that could have been affected
-    calc_encumbrance();
+    calc_encumbrance_modifiers();
     reset();
     if( !bio.id->enchantments.empty() ) {
         recalculate_enchantment_cache();
@@ -1,6 +1,15 @@
 #include "cached_options.h"
 
 int fov_3d_z_range;
+bool parallel_map_cache;
+bool parallel_monster_planning;
+bool memoize_sight;
+bool dormant_monsters;
+int item_processing_budget;
+bool fast_rot_catch_up;
+bool deferred_gas_spread;
+int redraw_rate_cap;
+bool simulation_priority;
 bool keycode_mode;
 bool log_from_top;
 int message_ttl;
@@ -11,6 +11,15 @@
 // options.cpp).
 
 extern int fov_3d_z_range;
+extern bool parallel_map_cache;
+extern bool parallel_monster_planning;
+extern bool memoize_sight;
+extern bool dormant_monsters;
+extern int item_processing_budget;
+extern bool fast_rot_catch_up;
+extern bool deferred_gas_spread;
+extern int redraw_rate_cap;
+extern bool simulation_priority;
 extern bool keycode_mode;
 extern bool log_from_top;
 extern int message_ttl;
@@ -44,15 +44,18 @@
 #include "map_extras.h"
 #include "map_memory.h"
 #include "mapdata.h"
+#include "memory_accounting.h"
 #include "mod_tileset.h"
 #include "monster.h"
 #include "monstergenerator.h"
 #include "mtype.h"
 #include "npc.h"
+#include "options.h"
 #include "output.h"
 #include "overlay_ordering.h"
 #include "path_info.h"
 #include "pixel_minimap.h"
+#include "profile_zones.h"
 #include "rect_range.h"
 #include "scent_map.h"
 #include "sdl_utils.h"
@@ -72,6 +75,7 @@
 #include "vpart_position.h"
 #include "weather.h"
 #include "weighted_list.h"
+#include "worker_pool.h"
 
 #define dbg(x) DebugLog((x),D_SDL) << __FILE__ << ":" << __LINE__ << ": "
 
@@ -97,6 +101,10 @@ static const std::array<std::string, 8> multitile_keys = {{
 };
 
 static const std::string empty_string;
+
+static const option_handle<std::string> opt_use_celsius( "USE_CELSIUS" );
+static const option_handle<bool> opt_nv_green_toggle( "NV_GREEN_TOGGLE" );
+static const option_handle<bool> opt_animation_sct_use_font( "ANIMATION_SCT_USE_FONT" );
 static const std::array<std::string, 15> TILE_CATEGORY_IDS = {{
         "", // TILE_CATEGORY::NONE,
         "vehicle_part", // TILE_CATEGORY::VEHICLE_PART,
@@ -193,11 +201,96 @@ formatted_text::formatted_text( const std::string &text, const int color,
     }
 }
 
+int sprite_batch::add( const texture &tex, const SDL_Rect &dstrect, const SDL_RendererFlip flip )
+{
+    int ret = 0;
+    if( tex.sdl_texture_ptr != current ) {
+        ret = flush();
+        current = tex.sdl_texture_ptr;
+    }
+    pending.push_back( { tex.srcrect, dstrect, flip } );
+    return ret;
+}
+
+int sprite_batch::flush()
+{
+    if( pending.empty() ) {
+        return 0;
+    }
+#if SDL_VERSION_ATLEAST(2,0,18)
+    if( !geometry_supported ) {
+        return render_one_by_one();
+    }
+    int tex_w = 0;
+    int tex_h = 0;
+    if( SDL_QueryTexture( current.get(), nullptr, nullptr, &tex_w, &tex_h ) != 0 ) {
+        return render_one_by_one();
+    }
+    const float inv_w = 1.0f / tex_w;
+    const float inv_h = 1.0f / tex_h;
+    const SDL_Color white = { 255, 255, 255, 255 };
+    vertices.clear();
+    indices.clear();
+    vertices.reserve( pending.size() * 4 );
+    indices.reserve( pending.size() * 6 );
+    for( const quad &q : pending ) {
+        float u0 = q.src.x * inv_w;
+        float u1 = ( q.src.x + q.src.w ) * inv_w;
+        float v0 = q.src.y * inv_h;
+        float v1 = ( q.src.y + q.src.h ) * inv_h;
+        if( q.flip & SDL_FLIP_HORIZONTAL ) {
+            std::swap( u0, u1 );
+        }
+        if( q.flip & SDL_FLIP_VERTICAL ) {
+            std::swap( v0, v1 );
+        }
+        const float x0 = q.dst.x;
+        const float x1 = q.dst.x + q.dst.w;
+        const float y0 = q.dst.y;
+        const float y1 = q.dst.y + q.dst.h;
+        const int base = static_cast<int>( vertices.size() );
+        vertices.push_back( { { x0, y0 }, white, { u0, v0 } } );
+        vertices.push_back( { { x1, y0 }, white, { u1, v0 } } );
+        vertices.push_back( { { x1, y1 }, white, { u1, v1 } } );
+        vertices.push_back( { { x0, y1 }, white, { u0, v1 } } );
+        for( const int i : {
+                 0, 1, 2, 0, 2, 3
+             } ) {
+            indices.push_back( base + i );
+        }
+    }
+    if( SDL_RenderGeometry( renderer.get(), current.get(), vertices.data(),
+                            static_cast<int>( vertices.size() ), indices.data(),
+                            static_cast<int>( indices.size() ) ) != 0 ) {
+        // Some render drivers don't implement geometry, stick to plain copies from now on
+        DebugLog( D_INFO, DC_ALL ) << "SDL_RenderGeometry failed, not batching sprites: " <<
+                                   SDL_GetError();
+        geometry_supported = false;
+        return render_one_by_one();
+    }
+    pending.clear();
+    return 0;
+#else
+    return render_one_by_one();
+#endif
+}
+
+int sprite_batch::render_one_by_one()
+{
+    int ret = 0;
+    for( const quad &q : pending ) {
+        ret |= SDL_RenderCopyEx( renderer.get(), current.get(), &q.src, &q.dst, 0, nullptr, q.flip );
+    }
+    pending.clear();
+    return ret;
+}
+
 cata_tiles::cata_tiles( const SDL_Renderer_Ptr &renderer, const GeometryRenderer_Ptr &geometry,
                         tileset_cache &cache ) :
     renderer( renderer ),
     geometry( geometry ),
     cache( cache ),
+    batch( renderer ),
     minimap( renderer, geometry )
 {
     cata_assert( renderer );
@@ -241,13 +334,43 @@ void cata_tiles::on_options_changed()
     minimap->set_settings( settings );
 }
 
+static SDL_Surface_Ptr copy_surface_32( const SDL_Surface_Ptr &original )
+{
+    cata_assert( original );
+    SDL_Surface_Ptr surf = create_surface_32( original->w, original->h );
+    cata_assert( surf );
+    throwErrorIf( SDL_BlitSurface( original.get(), nullptr, surf.get(), nullptr ) != 0,
+                  "SDL_BlitSurface failed" );
+    return surf;
+}
+
+/** Converts the pixels of a surface made by @ref copy_surface_32 in place. */
+template<typename PixelConverter>
+static void apply_color_filter( const SDL_Surface_Ptr &surf, PixelConverter pixel_converter )
+{
+    cata_assert( surf );
+    SDL_Color *pix = static_cast<SDL_Color *>( surf->pixels );
+
+    for( int y = 0, ey = surf->h; y < ey; ++y ) {
+        for( int x = 0, ex = surf->w; x < ex; ++x, ++pix ) {
+            if( pix->a == 0x00 ) {
+                // This check significantly improves the performance since
+                // vast majority of pixels in the tilesets are completely transparent.
+                continue;
+            }
+            *pix = pixel_converter( *pix );
+        }
+    }
+}
+
 void tileset::clear()
 {
     tile_values.clear();
-    shadow_tile_values.clear();
-    night_tile_values.clear();
-    overexposed_tile_values.clear();
-    memory_tile_values.clear();
+    sprite_atlas_part.clear();
+    atlas_parts.clear();
+    for( std::vector<texture> &values : variant_tile_values ) {
+        values.clear();
+    }
     duplicate_ids.clear();
     tile_ids.clear();
     for( std::unordered_map<std::string, season_tile_value> &m : tile_ids_by_season ) {
@@ -257,6 +380,67 @@ void tileset::clear()
     field_layer_data.clear();
 }
 
+memory_accounting::usage tileset::memory_usage() const
+{
+    // Sprites are parts of a few atlas textures, count every texture once
+    std::unordered_set<SDL_Texture *> textures;
+    for( const texture &tex : tile_values ) {
+        textures.insert( tex.sdl_texture() );
+    }
+    for( const atlas_part &part : atlas_parts ) {
+        for( const std::shared_ptr<SDL_Texture> &tex : part.variant_textures ) {
+            textures.insert( tex.get() );
+        }
+    }
+    memory_accounting::usage ret;
+    for( SDL_Texture *tex : textures ) {
+        int w = 0;
+        int h = 0;
+        if( tex != nullptr && SDL_QueryTexture( tex, nullptr, nullptr, &w, &h ) == 0 ) {
+            ++ret.count;
+            // Textures are 32 bits per pixel
+            ret.bytes += static_cast<size_t>( w ) * h * 4;
+        }
+    }
+    // The decoded images kept around to create the filtered variants from
+    for( const atlas_part &part : atlas_parts ) {
+        if( part.surface ) {
+            ret.bytes += static_cast<size_t>( part.surface->pitch ) * part.surface->h;
+        }
+    }
+    return ret;
+}
+
+const texture *tileset::get_variant_tile( const size_t index, const tile_variant variant ) const
+{
+    if( index >= tile_values.size() || sprite_atlas_part[index] < 0 ) {
+        return nullptr;
+    }
+    const size_t v = static_cast<size_t>( variant );
+    const color_pixel_function_pointer filter = variant_filters[v];
+    if( !filter ) {
+        return &tile_values[index];
+    }
+    std::vector<texture> &values = variant_tile_values[v];
+    if( values.size() < tile_values.size() ) {
+        values.resize( tile_values.size() );
+    }
+    texture &tex = values[index];
+    if( tex.dimension() == std::make_pair( 0, 0 ) ) {
+        atlas_part &part = atlas_parts[sprite_atlas_part[index]];
+        std::shared_ptr<SDL_Texture> &variant_texture = part.variant_textures[v];
+        if( !variant_texture ) {
+            cata_assert( renderer );
+            const SDL_Surface_Ptr surf = copy_surface_32( part.surface );
+            apply_color_filter( surf, filter );
+            variant_texture = CreateTextureFromSurface( *renderer, surf );
+            cata_assert( variant_texture );
+        }
+        tex = tile_values[index].with_texture( variant_texture );
+    }
+    return &tex;
+}
+
 const tile_type *tileset::find_tile_type( const std::string &id ) const
 {
     const auto iter = tile_ids.find( id );
@@ -331,6 +515,7 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
     tileset_mutation_overlay_ordering.clear();
 
     tileset_ptr = cache.load_tileset( tileset_id, renderer, precheck, force, pump_events );
+    looks_like_cache.clear();
 
     set_draw_scale( 16 );
 
@@ -395,32 +580,6 @@ static void get_tile_information( const cata_path &config_path, std::string &jso
     }
 }
 
-template<typename PixelConverter>
-static SDL_Surface_Ptr apply_color_filter( const SDL_Surface_Ptr &original,
-        PixelConverter pixel_converter )
-{
-    cata_assert( original );
-    SDL_Surface_Ptr surf = create_surface_32( original->w, original->h );
-    cata_assert( surf );
-    throwErrorIf( SDL_BlitSurface( original.get(), nullptr, surf.get(), nullptr ) != 0,
-                  "SDL_BlitSurface failed" );
-
-    SDL_Color *pix = static_cast<SDL_Color *>( surf->pixels );
-
-    for( int y = 0, ey = surf->h; y < ey; ++y ) {
-        for( int x = 0, ex = surf->w; x < ex; ++x, ++pix ) {
-            if( pix->a == 0x00 ) {
-                // This check significantly improves the performance since
-                // vast majority of pixels in the tilesets are completely transparent.
-                continue;
-            }
-            *pix = pixel_converter( *pix );
-        }
-    }
-
-    return surf;
-}
-
 static bool is_contained( const SDL_Rect &smaller, const SDL_Rect &larger )
 {
     return smaller.x >= larger.x &&
@@ -430,7 +589,7 @@ static bool is_contained( const SDL_Rect &smaller, const SDL_Rect &larger )
 }
 
 void tileset_cache::loader::copy_surface_to_texture( const SDL_Surface_Ptr &surf,
-        const point &offset, std::vector<texture> &target )
+        const point &offset, const int atlas_part )
 {
     cata_assert( surf );
     const rect_range<SDL_Rect> input_range( sprite_width, sprite_height,
@@ -448,9 +607,10 @@ void tileset_cache::loader::copy_surface_to_texture( const SDL_Surface_Ptr &surf
         cata_assert( pos.y % sprite_height == 0 );
         const size_t index = this->offset + ( pos.x / sprite_width ) + ( pos.y / sprite_height ) *
                              ( tile_atlas_width / sprite_width );
-        cata_assert( index < target.size() );
-        cata_assert( target[index].dimension() == std::make_pair( 0, 0 ) );
-        target[index] = texture( texture_ptr, rect );
+        cata_assert( index < ts.tile_values.size() );
+        cata_assert( ts.tile_values[index].dimension() == std::make_pair( 0, 0 ) );
+        ts.tile_values[index] = texture( texture_ptr, rect );
+        ts.sprite_atlas_part[index] = atlas_part;
     }
 }
 
@@ -459,28 +619,11 @@ void tileset_cache::loader::create_textures_from_tile_atlas( const SDL_Surface_P
 {
     cata_assert( tile_atlas );
 
-    /** perform color filter conversion here */
-    using tiles_pixel_color_entry = std::tuple<std::vector<texture>*, std::string>;
-    std::array<tiles_pixel_color_entry, 5> tile_values_data = {{
-            { std::make_tuple( &ts.tile_values, "color_pixel_none" ) },
-            { std::make_tuple( &ts.shadow_tile_values, "color_pixel_grayscale" ) },
-            { std::make_tuple( &ts.night_tile_values, "color_pixel_nightvision" ) },
-            { std::make_tuple( &ts.overexposed_tile_values, "color_pixel_overexposed" ) },
-            { std::make_tuple( &ts.memory_tile_values, tilecontext->memory_map_mode ) }
-        }
-    };
-    for( tiles_pixel_color_entry &entry : tile_values_data ) {
-        std::vector<texture> *tile_values = std::get<0>( entry );
-        color_pixel_function_pointer color_pixel_function = get_color_pixel_function( std::get<1>
-                ( entry ) );
-        if( !color_pixel_function ) {
-            // TODO: Move it inside apply_color_filter.
-            copy_surface_to_texture( tile_atlas, offset, *tile_values );
-        } else {
-            copy_surface_to_texture( apply_color_filter( tile_atlas, color_pixel_function ), offset,
-                                     *tile_values );
-        }
-    }
+    // Only the unfiltered sprites are uploaded now, see tileset::get_variant_tile()
+    const int part = static_cast<int>( ts.atlas_parts.size() );
+    ts.atlas_parts.emplace_back();
+    ts.atlas_parts.back().surface = copy_surface_32( tile_atlas );
+    copy_surface_to_texture( tile_atlas, offset, part );
 }
 
 template<typename T>
@@ -490,10 +633,14 @@ static void extend_vector_by( std::vector<T> &vec, const size_t additional_size
 }
 
 void tileset_cache::loader::load_tileset( const cata_path &img_path, const bool pump_events )
+{
+    load_tileset( load_image( img_path.get_unrelative_path().u8string().c_str() ), pump_events );
+}
+
+void tileset_cache::loader::load_tileset( const SDL_Surface_Ptr &tile_atlas, const bool pump_events )
 {
     cata_assert( sprite_width > 0 );
     cata_assert( sprite_height > 0 );
-    const SDL_Surface_Ptr tile_atlas = load_image( img_path.get_unrelative_path().u8string().c_str() );
     cata_assert( tile_atlas );
     tile_atlas_width = tile_atlas->w;
 
@@ -559,10 +706,7 @@ void tileset_cache::loader::load_tileset( const cata_path &img_path, const bool
     const int expected_tilecount = ( tile_atlas->w / sprite_width ) *
                                    ( tile_atlas->h / sprite_height );
     extend_vector_by( ts.tile_values, expected_tilecount );
-    extend_vector_by( ts.shadow_tile_values, expected_tilecount );
-    extend_vector_by( ts.night_tile_values, expected_tilecount );
-    extend_vector_by( ts.overexposed_tile_values, expected_tilecount );
-    extend_vector_by( ts.memory_tile_values, expected_tilecount );
+    ts.sprite_atlas_part.resize( ts.tile_values.size(), -1 );
 
     for( const SDL_Rect sub_rect : output_range ) {
         cata_assert( sub_rect.x % sprite_width == 0 );
@@ -684,6 +828,14 @@ void tileset_cache::loader::load( const std::string &tileset_id, const bool prec
     }
 
     ts.clear();
+    ts.renderer = &renderer;
+    ts.variant_filters = {{
+            get_color_pixel_function( "color_pixel_grayscale" ),
+            get_color_pixel_function( "color_pixel_nightvision" ),
+            get_color_pixel_function( "color_pixel_overexposed" ),
+            get_color_pixel_function( tilecontext->memory_map_mode )
+        }
+    };
 
     // Load tile information if available.
     offset = 0;
@@ -783,10 +935,24 @@ void tileset_cache::loader::load_internal( const JsonObject &config,
 {
     if( config.has_array( "tiles-new" ) ) {
         // new system, several entries
+        // Decode all the tileset images up front on the worker pool, PNG decoding is
+        // independent of everything else and the bulk of the loading time.
+        std::vector<cata_path> image_paths;
+        for( const JsonObject tile_part_def : config.get_array( "tiles-new" ) ) {
+            tile_part_def.allow_omitted_members();
+            image_paths.push_back( tileset_root / tile_part_def.get_string( "file" ) );
+        }
+        std::vector<SDL_Surface_Ptr> images( image_paths.size() );
+        get_worker_pool().parallel_for( image_paths.size(), [&]( const size_t i ) {
+            images[i] = load_image( image_paths[i].get_unrelative_path().u8string().c_str() );
+        } );
+        size_t image_index = 0;
         // When loading multiple tileset images this defines where
         // the tiles from the most recently loaded image start from.
         for( const JsonObject tile_part_def : config.get_array( "tiles-new" ) ) {
-            const cata_path tileset_image_path = tileset_root / tile_part_def.get_string( "file" );
+            const cata_path &tileset_image_path = image_paths[image_index];
+            const SDL_Surface_Ptr &tileset_image = images[image_index];
+            ++image_index;
             R = -1;
             G = -1;
             B = -1;
@@ -820,7 +986,7 @@ void tileset_cache::loader::load_internal( const JsonObject &config,
             };
             // First load the tileset image to get the number of available tiles.
             dbg( D_INFO ) << "Attempting to Load Tileset file " << tileset_image_path;
-            load_tileset( tileset_image_path, pump_events );
+            load_tileset( tileset_image, pump_events );
             load_tilejson_from_file( tile_part_def );
             if( tile_part_def.has_member( "ascii" ) ) {
                 load_ascii( tile_part_def );
@@ -1253,6 +1419,7 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
                        std::multimap<point, formatted_text> &overlay_strings,
                        color_block_overlay_container &color_blocks )
 {
+    CATA_PROFILE_ZONE( profile_zones::zone::draw_tiles );
     if( !g ) {
         return;
     }
@@ -1270,6 +1437,7 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         SDL_Rect clipRect = {dest.x, dest.y, width, height};
         printErrorIf( SDL_RenderSetClipRect( renderer.get(), &clipRect ) != 0,
                       "SDL_RenderSetClipRect failed" );
+        draw_clip = clipRect;
 
         //fill render area with black to prevent artifacts where no new pixels are drawn
         geometry->rect( renderer, clipRect, SDL_Color() );
@@ -1553,9 +1721,9 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
                             }
 
                             std::string temp_str;
-                            if( get_option<std::string>( "USE_CELSIUS" ) == "celsius" ) {
+                            if( opt_use_celsius.get() == "celsius" ) {
                                 temp_str = string_format( "%.0f", celsius_temp_value );
-                            } else if( get_option<std::string>( "USE_CELSIUS" ) == "kelvin" ) {
+                            } else if( opt_use_celsius.get() == "kelvin" ) {
                                 temp_str = string_format( "%.0f", units::to_kelvin( temp_value ) );
                             } else {
                                 temp_str = string_format( "%.0f", units::to_fahrenheit( temp_value ) );
@@ -1898,8 +2066,10 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         }
     }
 
+    printErrorIf( batch.flush() != 0, "Drawing queued sprites failed" );
     printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
                   "SDL_RenderSetClipRect failed" );
+    draw_clip.reset();
 }
 
 void cata_tiles::set_draw_cache_dirty()
@@ -2191,6 +2361,23 @@ cata_tiles::find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
         return std::nullopt;
     }
 
+    // The same sprites are looked up for every tile of every frame, and a lookup may go through
+    // several string concatenations and looks_like jumps, so remember the outcome.
+    auto key = std::make_tuple( id, category, variant, season_of_year( calendar::turn ),
+                                looks_like_jumps_limit );
+    auto cached = looks_like_cache.find( key );
+    if( cached == looks_like_cache.end() ) {
+        std::optional<tile_lookup_res> ret = find_tile_looks_like_uncached( id, category, variant,
+                                             looks_like_jumps_limit );
+        cached = looks_like_cache.emplace( std::move( key ), ret ).first;
+    }
+    return cached->second;
+}
+
+std::optional<tile_lookup_res>
+cata_tiles::find_tile_looks_like_uncached( const std::string &id, TILE_CATEGORY category,
+        const std::string &variant, const int looks_like_jumps_limit ) const
+{
     /*
     *  Note on memory management:
     *  This method must returns pointers to the objects (std::string *id  and tile_type * tile)
@@ -2373,7 +2560,7 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
         int intensity_level, const std::string &variant,
         const point &offset )
 {
-    bool nv_color_active = apply_night_vision_goggles && get_option<bool>( "NV_GREEN_TOGGLE" );
+    bool nv_color_active = apply_night_vision_goggles && opt_nv_green_toggle.get();
     // If the ID string does not produce a drawable tile
     // it will revert to the "unknown" tile.
     // The "unknown" tile is one that is highly visible so you kinda can't miss it :D
@@ -2877,19 +3064,39 @@ bool cata_tiles::draw_sprite_at(
     destination.w = width * tile_width * tile.pixelscale / tileset_ptr->get_tile_width();
     destination.h = height * tile_height * tile.pixelscale / tileset_ptr->get_tile_height();
 
+    if( draw_clip ) {
+        // Rotation happens around the center, so allow for the longer side in every direction
+        const int reach = std::max( destination.w, destination.h );
+        const int center_x = destination.x + destination.w / 2;
+        const int center_y = destination.y + destination.h / 2;
+        if( center_x + reach < draw_clip->x || center_x - reach > draw_clip->x + draw_clip->w ||
+            center_y + reach < draw_clip->y || center_y - reach > draw_clip->y + draw_clip->h ) {
+            // SDL would clip it away entirely, don't queue a copy for it
+            height_3d += tile.height_3d;
+            return true;
+        }
+    }
+
+    // Copies without rotation are queued while draw() is active, rotated ones have to keep
+    // their place in the drawing order
+    const auto render_copy = [&]( const double angle, const SDL_RendererFlip flip ) {
+        if( angle == 0 && draw_clip ) {
+            return batch.add( *sprite_tex, destination, flip );
+        }
+        const int flushed = batch.flush();
+        return flushed | sprite_tex->render_copy_ex( renderer, &destination, angle, nullptr, flip );
+    };
+
     if( rotate_sprite ) {
         if( rota == -1 ) {
             // flip horizontally
-            ret = sprite_tex->render_copy_ex(
-                      renderer, &destination, 0, nullptr,
-                      static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL ) );
+            ret = render_copy( 0, SDL_FLIP_HORIZONTAL );
         } else {
             switch( rota % 4 ) {
                 default:
                 case 0:
                     // unrotated (and 180, with just two sprites)
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                      SDL_FLIP_NONE );
+                    ret = render_copy( 0, SDL_FLIP_NONE );
                     break;
                 case 1:
                     // 90 degrees (and 270, with just two sprites)
@@ -2902,23 +3109,19 @@ bool cata_tiles::draw_sprite_at(
 #endif
                     if( !is_isometric() ) {
                         // never rotate isometric tiles
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, -90, nullptr,
-                                                          SDL_FLIP_NONE );
+                        ret = render_copy( -90, SDL_FLIP_NONE );
                     } else {
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                          SDL_FLIP_NONE );
+                        ret = render_copy( 0, SDL_FLIP_NONE );
                     }
                     break;
                 case 2:
                     // 180 degrees, implemented with flips instead of rotation
                     if( !is_isometric() ) {
                         // never flip isometric tiles vertically
-                        ret = sprite_tex->render_copy_ex(
-                                  renderer, &destination, 0, nullptr,
-                                  static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL ) );
+                        ret = render_copy( 0, static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL |
+                                           SDL_FLIP_VERTICAL ) );
                     } else {
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                          SDL_FLIP_NONE );
+                        ret = render_copy( 0, SDL_FLIP_NONE );
                     }
                     break;
                 case 3:
@@ -2932,18 +3135,16 @@ bool cata_tiles::draw_sprite_at(
 #endif
                     if( !is_isometric() ) {
                         // never rotate isometric tiles
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 90, nullptr,
-                                                          SDL_FLIP_NONE );
+                        ret = render_copy( 90, SDL_FLIP_NONE );
                     } else {
-                        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                          SDL_FLIP_NONE );
+                        ret = render_copy( 0, SDL_FLIP_NONE );
                     }
                     break;
             }
         }
     } else {
         // don't rotate, same as case 0 above
-        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr, SDL_FLIP_NONE );
+        ret = render_copy( 0, SDL_FLIP_NONE );
     }
 
     printErrorIf( ret != 0, "SDL_RenderCopyEx() failed" );
@@ -3084,6 +3285,7 @@ void cata_tiles::draw_square_below( const point &p, const nc_color &col, const i
         sdlrect.x = screen.x + divide_round_down( tile_width - sdlrect.w, 2 );
         sdlrect.y = screen.y + divide_round_down( tile_height - sdlrect.h, 2 );
     }
+    batch.flush();
     geometry->rect( renderer, sdlrect, sdlcol );
 }
 
@@ -4194,6 +4396,7 @@ void cata_tiles::draw_zlevel_overlay( const tripoint &p, const lit_level ll, int
 
     // Change blend mode for transparency to work
     // Disable after to avoid visual bugs
+    batch.flush();
     SetRenderDrawBlendMode( renderer, SDL_BLENDMODE_BLEND );
     geometry->rect( renderer, draw_rect, fog_color );
     SetRenderDrawBlendMode( renderer, SDL_BLENDMODE_NONE );
@@ -4286,6 +4489,7 @@ void tileset_cache::loader::ensure_default_item_highlight()
                                 highlight_alpha ) ) != 0, "SDL_FillRect failed" );
     ts.tile_values.emplace_back( CreateTextureFromSurface( renderer, surface ),
                                  SDL_Rect{ 0, 0, ts.tile_width, ts.tile_height } );
+    ts.sprite_atlas_part.push_back( -1 );
     ts.tile_ids[ITEM_HIGHLIGHT].fg.add( std::vector<int>( {index} ), 1 );
 }
 
@@ -4695,7 +4899,7 @@ void cata_tiles::draw_weather_frame()
 
 void cata_tiles::draw_sct_frame( std::multimap<point, formatted_text> &overlay_strings )
 {
-    const bool use_font = get_option<bool>( "ANIMATION_SCT_USE_FONT" );
+    const bool use_font = opt_animation_sct_use_font.get();
     tripoint player_pos = get_player_character().pos();
 
     for( const scrollingcombattext::cSCT &sct : SCT.vSCT ) {
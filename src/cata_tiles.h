@@ -2,9 +2,11 @@
 #ifndef CATA_SRC_CATA_TILES_H
 #define CATA_SRC_CATA_TILES_H
 
+#include <array>
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -16,6 +18,7 @@
 #include "creature.h"
 #include "cuboid_rectangle.h"
 #include "enums.h"
+#include "hash_utils.h"
 #include "lightmap.h"
 #include "line.h"
 #include "map_memory.h"
@@ -23,6 +26,7 @@
 #include "options.h"
 #include "pimpl.h"
 #include "point.h"
+#include "sdl_utils.h"
 #include "sdl_wrappers.h"
 #include "sdl_geometry.h"
 #include "type_id.h"
@@ -33,6 +37,11 @@ class Character;
 class JsonObject;
 class pixel_minimap;
 
+namespace memory_accounting
+{
+struct usage;
+} // namespace memory_accounting
+
 extern void set_displaybuffer_rendertarget();
 
 /** Structures */
@@ -109,6 +118,13 @@ class texture
         std::pair<int, int> dimension() const {
             return std::make_pair( srcrect.w, srcrect.h );
         }
+        SDL_Texture *sdl_texture() const {
+            return sdl_texture_ptr.get();
+        }
+        /// The same part of another texture with the same layout.
+        texture with_texture( std::shared_ptr<SDL_Texture> ptr ) const {
+            return texture( std::move( ptr ), srcrect );
+        }
         /// Interface to @ref SDL_RenderCopyEx, using this as the texture, and
         /// null as source rectangle (render the whole texture). Other parameters
         /// are simply passed through.
@@ -118,6 +134,46 @@ class texture
             return SDL_RenderCopyEx( renderer.get(), sdl_texture_ptr.get(), &srcrect, dstrect, angle, center,
                                      flip );
         }
+
+        friend class sprite_batch;
+};
+
+/**
+ * Collects unrotated sprite copies that share an atlas texture and submits them
+ * with a single @ref SDL_RenderGeometry call (SDL 2.0.18 and later).
+ * Copies from a different texture flush the pending ones first, so the drawing
+ * order is the same as with one @ref SDL_RenderCopyEx per sprite. Anything else
+ * that draws to the renderer must call @ref flush before doing so.
+ * On older SDL versions, or renderers without geometry support, sprites are
+ * copied one by one as before.
+ */
+class sprite_batch
+{
+    public:
+        explicit sprite_batch( const SDL_Renderer_Ptr &renderer ) : renderer( renderer ) { }
+
+        /// Queues a copy of @p tex to @p dstrect, drawing any pending copies of another texture first.
+        int add( const texture &tex, const SDL_Rect &dstrect, SDL_RendererFlip flip );
+        /// Draws all pending copies.
+        int flush();
+
+    private:
+        struct quad {
+            SDL_Rect src;
+            SDL_Rect dst;
+            SDL_RendererFlip flip;
+        };
+
+        int render_one_by_one();
+
+        const SDL_Renderer_Ptr &renderer;
+        std::shared_ptr<SDL_Texture> current;
+        std::vector<quad> pending;
+#if SDL_VERSION_ATLEAST(2,0,18)
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+        bool geometry_supported = true;
+#endif
 };
 
 class layer_variant
@@ -155,11 +211,34 @@ class tileset
         // multiplier for pixel-doubling tilesets
         float tile_pixelscale = 1.0f;
 
+        // Color filtered versions of the sprites, see get_variant_tile()
+        enum class tile_variant : int {
+            shadow,
+            night,
+            overexposed,
+            memory,
+            num_variants
+        };
+        static constexpr size_t num_tile_variants = static_cast<size_t>( tile_variant::num_variants );
+
+        /**
+         * A part of a tileset image that fits into one SDL texture. The decoded image is
+         * kept around, so the filtered variants of its sprites only take up video memory
+         * once they are actually drawn.
+         */
+        struct atlas_part {
+            SDL_Surface_Ptr surface;
+            std::array<std::shared_ptr<SDL_Texture>, num_tile_variants> variant_textures;
+        };
+
         std::vector<texture> tile_values;
-        std::vector<texture> shadow_tile_values;
-        std::vector<texture> night_tile_values;
-        std::vector<texture> overexposed_tile_values;
-        std::vector<texture> memory_tile_values;
+        // Index into atlas_parts for every entry in tile_values, -1 for sprites without variants
+        std::vector<int> sprite_atlas_part;
+        mutable std::vector<atlas_part> atlas_parts;
+        mutable std::array<std::vector<texture>, num_tile_variants> variant_tile_values;
+        // nullptr if the variant looks like the unfiltered sprite
+        std::array<color_pixel_function_pointer, num_tile_variants> variant_filters = {};
+        const SDL_Renderer_Ptr *renderer = nullptr;
 
         std::unordered_set<std::string> duplicate_ids;
 
@@ -170,9 +249,11 @@ class tileset
         tile_ids_by_season;
 
         static const texture *get_if_available( const size_t index,
-                                                const decltype( shadow_tile_values ) &tiles ) {
+                                                const std::vector<texture> &tiles ) {
             return index < tiles.size() ? & tiles[index] : nullptr;
         }
+        /** Returns the filtered sprite, creating the texture of its atlas part on first use. */
+        const texture *get_variant_tile( size_t index, tile_variant variant ) const;
 
         friend class tileset_cache;
 
@@ -182,6 +263,8 @@ class tileset
         std::unordered_map<std::string, std::vector<layer_variant>> field_layer_data;
 
         void clear();
+        /** Textures created so far and an estimate of their size, see memory_accounting.h. */
+        memory_accounting::usage memory_usage() const;
 
         bool is_isometric() const {
             return tile_isometric;
@@ -215,16 +298,16 @@ class tileset
             return get_if_available( index, tile_values );
         }
         const texture *get_night_tile( const size_t index ) const {
-            return get_if_available( index, night_tile_values );
+            return get_variant_tile( index, tile_variant::night );
         }
         const texture *get_shadow_tile( const size_t index ) const {
-            return get_if_available( index, shadow_tile_values );
+            return get_variant_tile( index, tile_variant::shadow );
         }
         const texture *get_overexposed_tile( const size_t index ) const {
-            return get_if_available( index, overexposed_tile_values );
+            return get_variant_tile( index, tile_variant::overexposed );
         }
         const texture *get_memory_tile( const size_t index ) const {
-            return get_if_available( index, memory_tile_values );
+            return get_variant_tile( index, tile_variant::memory );
         }
 
         const std::unordered_set<std::string> &get_duplicate_ids() const {
@@ -290,7 +373,7 @@ class tileset_cache::loader
         void ensure_default_item_highlight();
 
         void copy_surface_to_texture( const SDL_Surface_Ptr &surf, const point &offset,
-                                      std::vector<texture> &target );
+                                      int atlas_part );
         void create_textures_from_tile_atlas( const SDL_Surface_Ptr &tile_atlas, const point &offset );
 
         void process_variations_after_loading( weighted_int_list<std::vector<int>> &v ) const;
@@ -319,6 +402,8 @@ class tileset_cache::loader
          * @throw std::exception If the image can not be loaded.
          */
         void load_tileset( const cata_path &path, bool pump_events );
+        /** As above, but for a tileset image that has already been decoded. */
+        void load_tileset( const SDL_Surface_Ptr &tile_atlas, bool pump_events );
         /**
          * Load tiles from json data.This expects a "tiles" array in
          * <B>config</B>. That array should contain all the tile definition that
@@ -406,6 +491,9 @@ class cata_tiles
         bool is_valid() {
             return tileset_ptr != nullptr;
         }
+        const tileset *get_tileset() const {
+            return tileset_ptr.get();
+        }
 
         /** Draw to screen */
         void draw( const point &dest, const tripoint &center, int width, int height,
@@ -439,6 +527,9 @@ class cata_tiles
         std::optional<tile_lookup_res>
         find_tile_looks_like( const std::string &id, TILE_CATEGORY category, const std::string &variant,
                               int looks_like_jumps_limit = 10 ) const;
+        std::optional<tile_lookup_res>
+        find_tile_looks_like_uncached( const std::string &id, TILE_CATEGORY category,
+                                       const std::string &variant, int looks_like_jumps_limit ) const;
 
         // this templated method is used only from it's own cpp file, so it's ok to declare it here
         template<typename T>
@@ -717,6 +808,10 @@ class cata_tiles
         const GeometryRenderer_Ptr &geometry;
         tileset_cache &cache;
         std::shared_ptr<const tileset> tileset_ptr;
+        // Results of find_tile_looks_like() for the current tileset, cleared when one is loaded.
+        // Keyed by id, category, variant, season and remaining looks_like jumps.
+        mutable std::unordered_map<std::tuple<std::string, TILE_CATEGORY, std::string, season_type, int>,
+                std::optional<tile_lookup_res>, cata::tuple_hash> looks_like_cache;
 
         // the scaled default sprite width and height. in non-isometric mode,
         // the basic tile width and height equal the default sprite width and
@@ -731,6 +826,10 @@ class cata_tiles
         // (see get_window_base_tile_counts for detail).
         int screentile_width = 0;
         int screentile_height = 0;
+        // Screen area cata_tiles::draw() is drawing into, sprites entirely outside of it are skipped
+        std::optional<SDL_Rect> draw_clip;
+        // Unrotated sprites drawn by cata_tiles::draw() are queued here, see sprite_batch
+        sprite_batch batch;
 
         int fog_alpha = 0;
 
@@ -14,6 +14,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 
 #include "cached_options.h"
 #include "catacharset.h"
@@ -90,10 +91,24 @@ bool lcmatch( const std::string_view str, const std::string_view qry )
         return true;
     }
 
-    std::u32string u32_str = utf8_to_utf32( str );
+    return lcmatch( str, lcmatch_prepare( qry ) );
+}
+
+std::u32string lcmatch_prepare( const std::string_view qry )
+{
     std::u32string u32_qry = utf8_to_utf32( qry );
-    std::for_each( u32_str.begin(), u32_str.end(), u32_to_lowercase );
     std::for_each( u32_qry.begin(), u32_qry.end(), u32_to_lowercase );
+    return u32_qry;
+}
+
+bool lcmatch( const std::string_view str, const std::u32string &u32_qry )
+{
+    if( u32_qry.empty() ) {
+        return true;
+    }
+
+    std::u32string u32_str = utf8_to_utf32( str );
+    std::for_each( u32_str.begin(), u32_str.end(), u32_to_lowercase );
     // First try match their lowercase forms
     if( u32_str.find( u32_qry ) != std::u32string::npos ) {
         return true;
@@ -340,6 +355,134 @@ bool write_to_file( const cata_path &path, const std::function<void( std::ostrea
     }
 }
 
+namespace
+{
+
+// Deflates everything written through it into a gzip stream on another stream.
+class gzip_streambuf : public std::streambuf
+{
+    public:
+        explicit gzip_streambuf( std::ostream &out ) : out( out ) {
+            memset( &zs, 0, sizeof( zs ) );
+            if( deflateInit2( &zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS | 16, 8,
+                              Z_DEFAULT_STRATEGY ) != Z_OK ) {
+                throw std::runtime_error( "deflateInit failed while compressing." );
+            }
+            setp( inbuffer.data(), inbuffer.data() + inbuffer.size() );
+        }
+        gzip_streambuf( const gzip_streambuf & ) = delete;
+        gzip_streambuf &operator=( const gzip_streambuf & ) = delete;
+        ~gzip_streambuf() override {
+            deflateEnd( &zs );
+        }
+
+        // Writes out the rest of the data and the gzip trailer.
+        void finish() {
+            deflate_buffer( Z_FINISH );
+        }
+
+    protected:
+        int_type overflow( int_type ch ) override {
+            deflate_buffer( Z_NO_FLUSH );
+            if( !traits_type::eq_int_type( ch, traits_type::eof() ) ) {
+                *pptr() = traits_type::to_char_type( ch );
+                pbump( 1 );
+            }
+            return traits_type::not_eof( ch );
+        }
+
+    private:
+        void deflate_buffer( int flush ) {
+            zs.next_in = reinterpret_cast<Bytef *>( pbase() );
+            zs.avail_in = pptr() - pbase();
+            int ret;
+            do {
+                zs.next_out = reinterpret_cast<Bytef *>( outbuffer.data() );
+                zs.avail_out = outbuffer.size();
+                ret = deflate( &zs, flush );
+                if( ret == Z_STREAM_ERROR ) {
+                    throw std::runtime_error( "Exception during zlib compression." );
+                }
+                out.write( outbuffer.data(), outbuffer.size() - zs.avail_out );
+            } while( flush == Z_FINISH ? ret != Z_STREAM_END : zs.avail_out == 0 );
+            setp( inbuffer.data(), inbuffer.data() + inbuffer.size() );
+        }
+
+        std::ostream &out;
+        z_stream zs;
+        std::array<char, 32768> inbuffer;
+        std::array<char, 32768> outbuffer;
+};
+
+// Runs @p writer on a stream that compresses into @p out.
+void write_compressed( std::ostream &out, const std::function<void( std::ostream & )> &writer )
+{
+    gzip_streambuf buf( out );
+    std::ostream zout( &buf );
+    // Errors while deflating would otherwise only set the badbit
+    zout.exceptions( std::ios::badbit );
+    writer( zout );
+    zout.flush();
+    buf.finish();
+}
+
+} // namespace
+
+void write_to_file_compressed( const cata_path &path,
+                               const std::function<void( std::ostream & )> &writer )
+{
+    ofstream_wrapper fout( path.get_unrelative_path(), std::ios::binary );
+    write_compressed( fout.stream(), writer );
+    fout.close();
+}
+
+bool write_to_file_if_changed( const std::string &path,
+                               const std::function<void( std::ostream & )> &writer,
+                               const char *const fail_message )
+{
+    // Hash of what was last written to each file
+    static std::unordered_map<std::string, size_t> written;
+    std::string contents;
+    try {
+        std::ostringstream out;
+        writer( out );
+        contents = out.str();
+    } catch( const std::exception & ) {
+        // Let write_to_file report the error
+        written.erase( path );
+        return write_to_file( path, writer, fail_message );
+    }
+    const size_t hash = std::hash<std::string>()( contents );
+    const auto iter = written.find( path );
+    if( iter != written.end() && iter->second == hash && file_exist( path ) ) {
+        return true;
+    }
+    const auto write_contents = [&contents]( std::ostream & fout ) {
+        fout << contents;
+    };
+    if( !write_to_file( path, write_contents, fail_message ) ) {
+        written.erase( path );
+        return false;
+    }
+    written[path] = hash;
+    return true;
+}
+
+std::string gzip_compress( const std::string &data )
+{
+    std::ostringstream out;
+    write_compressed( out, [&data]( std::ostream & zout ) {
+        zout.write( data.data(), data.size() );
+    } );
+    return out.str();
+}
+
+bool is_gzip( const std::string &data )
+{
+    // (byte1 == 0x1f) && (byte2 == 0x8b)
+    return data.size() >= 2 && data[0] == '\x1f' && data[1] == '\x8b';
+}
+
 ofstream_wrapper::ofstream_wrapper( const fs::path &path, const std::ios::openmode mode )
     : path( path )
 
@@ -388,13 +531,16 @@ namespace
 
 std::string read_compressed_file_to_string( std::istream &fin )
 {
-    std::string outstring;
-
     std::ostringstream deflated_contents_stream;
-    std::string str;
-
     deflated_contents_stream << fin.rdbuf();
-    str = deflated_contents_stream.str();
+    return gzip_decompress( deflated_contents_stream.str() );
+}
+
+} // namespace
+
+std::string gzip_decompress( const std::string &str )
+{
+    std::string outstring;
 
     z_stream zs;
     memset( &zs, 0, sizeof( zs ) );
@@ -428,14 +574,12 @@ std::string read_compressed_file_to_string( std::istream &fin )
     if( ret != Z_STREAM_END ) { // an error occurred that was not EOF
         std::ostringstream oss;
         oss << "Exception during zlib decompression: (" << ret << ") "
-            << zs.msg;
+            << ( zs.msg ? zs.msg : "" );
         throw std::runtime_error( oss.str() );
     }
     return outstring;
 }
 
-} // namespace
-
 bool read_from_file( const cata_path &path, const std::function<void( std::istream & )> &reader )
 {
     return read_from_file( path.get_unrelative_path(), reader );
@@ -111,6 +111,13 @@ bool isBetween( int test, int down, int up );
  */
 bool lcmatch( std::string_view str, std::string_view qry );
 bool lcmatch( const translation &str, std::string_view qry );
+/**
+ * Lowercases a query for lcmatch() once, so that it can be matched against many
+ * subject strings without converting it every time.
+ */
+std::u32string lcmatch_prepare( std::string_view qry );
+/** lcmatch() with a query returned by lcmatch_prepare() */
+bool lcmatch( std::string_view str, const std::u32string &u32_qry );
 
 /**
  * Matches text case insensitive with the include/exclude rules of the filter
@@ -325,6 +332,31 @@ bool write_to_file( const cata_path &path, const std::function<void( std::ostrea
 void write_to_file( const cata_path &path, const std::function<void( std::ostream & )> &writer );
 ///@}
 
+/**
+ * Like @ref write_to_file, but gzip compresses what @p writer writes on its way to the file.
+ * The data is deflated as it is written, so it is never held in memory as a whole.
+ * The functions reading files detect compressed files and inflate them on their own.
+ * @throw When writing fails or when the @p writer throws.
+ */
+void write_to_file_compressed( const cata_path &path,
+                               const std::function<void( std::ostream & )> &writer );
+
+/**
+ * Like @ref write_to_file, but skips writing if the file was written with the same data
+ * before in this session, for files that are saved often but rarely change.
+ * The data is still serialized every time to find out whether it changed.
+ */
+bool write_to_file_if_changed( const std::string &path,
+                               const std::function<void( std::ostream & )> &writer,
+                               const char *fail_message );
+
+/** @returns @p data compressed into the gzip format. */
+std::string gzip_compress( const std::string &data );
+/** @returns @p data decompressed from the gzip format. Throws on corrupt data. */
+std::string gzip_decompress( const std::string &data );
+/** @returns whether @p data starts with the magic bytes of the gzip format. */
+bool is_gzip( const std::string &data );
+
 /**
  * Try to open and read from given file using the given callback.
  *
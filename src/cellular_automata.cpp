@@ -1,5 +1,8 @@
 #include "cellular_automata.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace CellularAutomata
 {
 /**
@@ -33,49 +36,63 @@ int neighbor_count( const std::vector<std::vector<int>> &cells, const int width,
     return neighbors;
 }
 
-std::vector<std::vector<int>> generate_cellular_automaton(
-                               const int width, const int height, const int alive, const int iterations,
-                               const int birth_limit, const int stasis_limit )
+cell_grid generate_cell_grid( const int width, const int height, const int alive,
+                              const int iterations, const int birth_limit, const int stasis_limit )
 {
-    std::vector<std::vector<int>> current( width, std::vector<int>( height, 0 ) );
-    std::vector<std::vector<int>> next( width, std::vector<int>( height, 0 ) );
+    cell_grid current( width, height );
+    cell_grid next( width, height );
 
     // Initialize our initial set of cells.
     for( int i = 0; i < width; i++ ) {
         for( int j = 0; j < height; j++ ) {
-            current[i][j] = x_in_y( alive, 100 );
+            current.at( point( i, j ) ) = x_in_y( alive, 100 );
         }
     }
 
+    // Alive cells of columns i - 1, i and i + 1 for each j
+    std::vector<std::uint8_t> column_sums( height, 0 );
     for( int iteration = 0; iteration < iterations; iteration++ ) {
-        for( int i = 0; i < width; i++ ) {
+        // Keep the edges dead, no need to complicate this with more complex neighbor
+        // calculations.
+        std::fill( next.cells.begin(), next.cells.end(), 0 );
+        for( int i = 1; i < width - 1 && height > 2; i++ ) {
+            const std::uint8_t *left = &current.cells[static_cast<size_t>( i - 1 ) * height];
+            const std::uint8_t *mid = left + height;
+            const std::uint8_t *right = mid + height;
             for( int j = 0; j < height; j++ ) {
-                // Skip the edges--no need to complicate this with more complex neighbor
-                // calculations, just keep them constant.
-                if( i == 0 || i == width - 1 || j == 0 || j == height - 1 ) {
-                    next[i][j] = 0;
-                    continue;
-                }
-
-                // Count our neighbors.
-                const int neighbors = neighbor_count( current, width, height, point( i, j ) );
-
+                column_sums[j] = left[j] + mid[j] + right[j];
+            }
+            std::uint8_t *out = &next.cells[static_cast<size_t>( i ) * height];
+            for( int j = 1; j < height - 1; j++ ) {
+                // The 3x3 block minus ourselves
+                const int neighbors = column_sums[j - 1] + column_sums[j] + column_sums[j + 1] -
+                                      mid[j];
                 // Dead and > birth_limit neighbors, become alive.
                 // Alive and > stasis_limit neighbors, stay alive.
-                const int to_live = current[i][j] ? stasis_limit : birth_limit;
-                if( neighbors > to_live ) {
-                    next[i][j] = 1;
-                    // Else, die.
-                } else {
-                    next[i][j] = 0;
-                }
+                // Else, die.
+                out[j] = neighbors > ( mid[j] ? stasis_limit : birth_limit );
             }
         }
 
-        // Swap our current and next vectors and repeat.
+        // Swap our current and next grids and repeat.
         std::swap( current, next );
     }
 
     return current;
 }
+
+std::vector<std::vector<int>> generate_cellular_automaton(
+                               const int width, const int height, const int alive, const int iterations,
+                               const int birth_limit, const int stasis_limit )
+{
+    const cell_grid grid = generate_cell_grid( width, height, alive, iterations, birth_limit,
+                           stasis_limit );
+    std::vector<std::vector<int>> ret( width, std::vector<int>( height, 0 ) );
+    for( int i = 0; i < width; i++ ) {
+        for( int j = 0; j < height; j++ ) {
+            ret[i][j] = grid.at( point( i, j ) );
+        }
+    }
+    return ret;
+}
 } // namespace CellularAutomata
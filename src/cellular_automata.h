@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_CELLULAR_AUTOMATA_H
 #define CATA_SRC_CELLULAR_AUTOMATA_H
 
+#include <cstdint>
 #include <vector>
 
 #include "point.h"
@@ -10,6 +11,28 @@
 namespace CellularAutomata
 {
 
+/**
+* The cells of an automaton in one flat block, a byte per cell, 0 if dead or 1 if alive.
+* Stored column by column, so cells of the same x are next to each other like in the nested
+* vectors of @ref generate_cellular_automaton.
+*/
+struct cell_grid {
+    int width = 0;
+    int height = 0;
+    std::vector<std::uint8_t> cells;
+
+    cell_grid() = default;
+    cell_grid( int width, int height ) : width( width ), height( height ),
+        cells( static_cast<size_t>( width ) * height, 0 ) {}
+
+    std::uint8_t &at( const point &p ) {
+        return cells[static_cast<size_t>( p.x ) * height + p.y];
+    }
+    std::uint8_t at( const point &p ) const {
+        return cells[static_cast<size_t>( p.x ) * height + p.y];
+    }
+};
+
 /**
 * Calculates the number of alive neighbors by looking at the Moore neighborhood (3x3 grid of cells).
 * @param cells The cells to look at. Assumed to be of a consistent width/height equal to the specified
@@ -42,6 +65,14 @@ std::vector<std::vector<int>> generate_cellular_automaton(
                                int width, int height, int alive, int iterations,
                                int birth_limit, int stasis_limit );
 
+/**
+* Same as @ref generate_cellular_automaton, and rolls the same cells for the same random state,
+* but builds a flat grid. Neighbors are counted from running sums of three columns, so each
+* cell costs a few additions instead of nine checked lookups.
+*/
+cell_grid generate_cell_grid( int width, int height, int alive, int iterations,
+                              int birth_limit, int stasis_limit );
+
 } // namespace CellularAutomata
 
 #endif // CATA_SRC_CELLULAR_AUTOMATA_H
@@ -494,6 +494,14 @@ static const trait_id trait_WEB_WEAVER( "WEB_WEAVER" );
 static const vitamin_id vitamin_calcium( "calcium" );
 static const vitamin_id vitamin_iron( "iron" );
 
+static const option_handle<int> opt_player_base_stamina_burn_rate( "PLAYER_BASE_STAMINA_BURN_RATE" );
+static const option_handle<float> opt_weary_bmr_mult( "WEARY_BMR_MULT" );
+static const option_handle<float> opt_weary_initial_step( "WEARY_INITIAL_STEP" );
+static const option_handle<float> opt_weary_thresh_scaling( "WEARY_THRESH_SCALING" );
+static const option_handle<float> opt_player_healing_rate( "PLAYER_HEALING_RATE" );
+static const option_handle<float> opt_npc_healing_rate( "NPC_HEALING_RATE" );
+static const option_handle<bool> opt_no_npc_food( "NO_NPC_FOOD" );
+
 static const std::set<material_id> ferric = { material_iron, material_steel, material_budget_steel, material_ch_steel, material_hc_steel, material_lc_steel, material_mc_steel, material_qt_steel };
 
 namespace io
@@ -529,6 +537,106 @@ void Character::queue_effect( const std::string &name, const time_duration &dela
             ctx );
 }
 
+queued_eocs::queued_eocs( const queued_eocs &rhs ) : list( rhs.list ),
+    current_slot( rhs.current_slot )
+{
+    for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
+        schedule( it );
+    }
+}
+
+queued_eocs &queued_eocs::operator=( const queued_eocs &rhs )
+{
+    if( this == &rhs ) {
+        return *this;
+    }
+    clear();
+    list = rhs.list;
+    current_slot = rhs.current_slot;
+    for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
+        schedule( it );
+    }
+    return *this;
+}
+
+void queued_eocs::push( const queued_eoc &eoc )
+{
+    schedule( list.emplace( list.end(), eoc ) );
+}
+
+void queued_eocs::clear()
+{
+    list.clear();
+    slots.clear();
+    overflow = {};
+}
+
+std::vector<queued_eocs::storage_iter> queued_eocs::take_due( const time_point &until )
+{
+    std::vector<storage_iter> due;
+    const int last = slot_of( until );
+    if( !slots.empty() ) {
+        // Every slot the clock has moved past is due in full
+        const int end = std::min( last, current_slot + num_slots );
+        for( int s = current_slot; s < end; ++s ) {
+            std::vector<storage_iter> &slot = slots[s % num_slots];
+            due.insert( due.end(), slot.begin(), slot.end() );
+            slot.clear();
+        }
+    }
+    if( last > current_slot ) {
+        current_slot = last;
+        pull_overflow();
+    }
+    if( !slots.empty() ) {
+        // The slot the clock is in now may also hold entries due later on
+        std::vector<storage_iter> &slot = slots[current_slot % num_slots];
+        const auto later_end = std::partition( slot.begin(), slot.end(),
+        [&until]( const storage_iter & it ) {
+            return it->time > until;
+        } );
+        due.insert( due.end(), later_end, slot.end() );
+        slot.erase( later_end, slot.end() );
+    }
+    std::sort( due.begin(), due.end(), []( const storage_iter & lhs, const storage_iter & rhs ) {
+        return lhs->time < rhs->time;
+    } );
+    return due;
+}
+
+void queued_eocs::reschedule( storage_iter it )
+{
+    schedule( it );
+}
+
+int queued_eocs::slot_of( const time_point &t )
+{
+    return to_turn<int>( t ) / turns_per_slot;
+}
+
+void queued_eocs::schedule( storage_iter it )
+{
+    // Anything already overdue goes in the current slot and is picked up by the next take_due
+    const int slot = std::max( slot_of( it->time ), current_slot );
+    if( slot >= current_slot + num_slots ) {
+        overflow.push( it );
+        return;
+    }
+    if( slots.empty() ) {
+        slots.resize( num_slots );
+    }
+    slots[slot % num_slots].push_back( it );
+}
+
+void queued_eocs::pull_overflow()
+{
+    while( !overflow.empty() && slot_of( overflow.top()->time ) < current_slot + num_slots ) {
+        const storage_iter it = overflow.top();
+        overflow.pop();
+        schedule( it );
+    }
+}
+
 int Character::count_queued_effects( const std::string &effect ) const
 {
     return std::count_if( queued_effect_on_conditions.list.begin(),
@@ -681,6 +789,7 @@ item_location Character::get_wielded_item()
 void Character::set_wielded_item( const item &to_wield )
 {
     weapon = to_wield;
+    invalidate_weight_carried_cache();
 }
 
 std::vector<matype_id> Character::known_styles( bool teachable_only ) const
@@ -1923,7 +2032,7 @@ void Character::on_try_dodge()
     // Each attempt consumes an available dodge
     consume_dodge_attempts();
 
-    const int base_burn_rate = get_option<int>( STATIC( "PLAYER_BASE_STAMINA_BURN_RATE" ) );
+    const int base_burn_rate = opt_player_base_stamina_burn_rate.get();
     const float dodge_skill_modifier = ( 20.0f - get_skill_level( skill_dodge ) ) / 20.0f;
     mod_stamina( std::floor( -static_cast<float>( base_burn_rate ) * 6.0f * dodge_skill_modifier ) );
     set_activity_level( EXTRA_EXERCISE );
@@ -3083,6 +3192,7 @@ units::mass Character::weight_carried() const
 void Character::invalidate_weight_carried_cache()
 {
     cached_weight_carried = std::nullopt;
+    ++inventory_version;
 }
 
 units::mass Character::best_nearby_lifting_assist() const
@@ -3312,6 +3422,7 @@ ret_val<void> Character::can_unwield( const item &it ) const
 void Character::invalidate_inventory_validity_cache()
 {
     cache_inventory_is_valid = false;
+    ++inventory_version;
 }
 bool Character::is_wielding( const item &target ) const
 {
@@ -3865,11 +3976,33 @@ void Character::calc_encumbrance()
     calc_encumbrance( item() );
 }
 
+void Character::calc_encumbrance_modifiers()
+{
+    if( !worn_encumbrance_valid || get_check_encumbrance() || worn.encumbrance_update_pending() ) {
+        calc_encumbrance();
+        return;
+    }
+    std::map<bodypart_id, encumbrance_data> enc = worn_encumbrance;
+    mut_cbm_encumb( enc );
+    calc_bmi_encumb( enc );
+
+    for( const std::pair<const bodypart_id, encumbrance_data> &elem : enc ) {
+        set_part_encumbrance_data( elem.first, elem.second );
+    }
+}
+
 void Character::calc_encumbrance( const item &new_item )
 {
+    // containers are weighed several times per body part
+    item_pocket::totals_scope const totals;
 
     std::map<bodypart_id, encumbrance_data> enc;
     worn.item_encumb( enc, new_item, *this );
+    // Only the actual outfit can be reused by calc_encumbrance_modifiers
+    worn_encumbrance_valid = new_item.is_null();
+    if( worn_encumbrance_valid ) {
+        worn_encumbrance = enc;
+    }
     mut_cbm_encumb( enc );
     calc_bmi_encumb( enc );
 
@@ -4170,11 +4303,11 @@ int Character::get_int_bonus() const
 
 static int get_speedydex_bonus( const int dex )
 {
-    static const std::string speedydex_min_dex( "SPEEDYDEX_MIN_DEX" );
-    static const std::string speedydex_dex_speed( "SPEEDYDEX_DEX_SPEED" );
+    static const option_handle<int> opt_speedydex_min_dex( "SPEEDYDEX_MIN_DEX" );
+    static const option_handle<int> opt_speedydex_dex_speed( "SPEEDYDEX_DEX_SPEED" );
     // this is the number to be multiplied by the increment
-    const int modified_dex = std::max( dex - get_option<int>( speedydex_min_dex ), 0 );
-    return modified_dex * get_option<int>( speedydex_dex_speed );
+    const int modified_dex = std::max( dex - opt_speedydex_min_dex.get(), 0 );
+    return modified_dex * opt_speedydex_dex_speed.get();
 }
 
 int Character::get_enchantment_speed_bonus() const
@@ -4459,7 +4592,7 @@ void Character::set_stored_calories( int cal )
         recalc_hp();
         //need to check obesity penalties when this happens if BMI changed
         if( std::floor( get_bmi_fat() ) != cached_bmi ) {
-            calc_encumbrance();
+            calc_encumbrance_modifiers();
         }
     }
 }
@@ -4850,7 +4983,7 @@ int Character::weariness() const
 int Character::weary_threshold() const
 {
     const int bmr = base_bmr();
-    int threshold = bmr * get_option<float>( "WEARY_BMR_MULT" );
+    int threshold = bmr * opt_weary_bmr_mult.get();
     // reduce by 1% per 14 points of fatigue after 150 points
     threshold *= 1.0f - ( ( std::max( fatigue, -20 ) - 150 ) / 1400.0f );
     // Each 2 points of morale increase or decrease by 1%
@@ -4865,11 +4998,11 @@ std::pair<int, int> Character::weariness_transition_progress() const
     // Mostly a duplicate of the below function. No real way to clean this up
     int amount = weariness();
     int threshold = weary_threshold();
-    amount -= threshold * get_option<float>( "WEARY_INITIAL_STEP" );
+    amount -= threshold * opt_weary_initial_step.get();
     while( amount >= 0 ) {
         amount -= threshold;
         if( threshold > 20 ) {
-            threshold *= get_option<float>( "WEARY_THRESH_SCALING" );
+            threshold *= opt_weary_thresh_scaling.get();
         }
     }
 
@@ -4883,11 +5016,11 @@ int Character::weariness_level() const
     int amount = weariness();
     int threshold = weary_threshold();
     int level = 0;
-    amount -= threshold * get_option<float>( "WEARY_INITIAL_STEP" );
+    amount -= threshold * opt_weary_initial_step.get();
     while( amount >= 0 ) {
         amount -= threshold;
         if( threshold > 20 ) {
-            threshold *= get_option<float>( "WEARY_THRESH_SCALING" );
+            threshold *= opt_weary_thresh_scaling.get();
         }
         ++level;
     }
@@ -4899,11 +5032,11 @@ int Character::weariness_transition_level() const
 {
     int amount = weariness();
     int threshold = weary_threshold();
-    amount -= threshold * get_option<float>( "WEARY_INITIAL_STEP" );
+    amount -= threshold * opt_weary_initial_step.get();
     while( amount >= 0 ) {
         amount -= threshold;
         if( threshold > 20 ) {
-            threshold *= get_option<float>( "WEARY_THRESH_SCALING" );
+            threshold *= opt_weary_thresh_scaling.get();
         }
     }
 
@@ -4965,7 +5098,7 @@ float Character::activity_level() const
 
 bool Character::needs_food() const
 {
-    return !( is_npc() && get_option<bool>( "NO_NPC_FOOD" ) );
+    return !( is_npc() && opt_no_npc_food.get() );
 }
 
 void Character::update_needs( int rate_multiplier )
@@ -5134,16 +5267,16 @@ needs_rates Character::calc_needs_rates() const
 
     add_msg_debug_if( is_avatar(), debugmode::DF_CHAR_CALORIES, "Metabolic rate: %.2f", rates.hunger );
 
-    static const std::string player_thirst_rate( "PLAYER_THIRST_RATE" );
-    rates.thirst = get_option< float >( player_thirst_rate );
+    static const option_handle<float> opt_player_thirst_rate( "PLAYER_THIRST_RATE" );
+    rates.thirst = opt_player_thirst_rate.get();
     static const std::string thirst_modifier( "thirst_modifier" );
     rates.thirst *= 1.0f + mutation_value( thirst_modifier );
     if( worn_with_flag( flag_SLOWS_THIRST ) ) {
         rates.thirst *= 0.7f;
     }
 
-    static const std::string player_fatigue_rate( "PLAYER_FATIGUE_RATE" );
-    rates.fatigue = get_option< float >( player_fatigue_rate );
+    static const option_handle<float> opt_player_fatigue_rate( "PLAYER_FATIGUE_RATE" );
+    rates.fatigue = opt_player_fatigue_rate.get();
     static const std::string fatigue_modifier( "fatigue_modifier" );
     rates.fatigue *= 1.0f + mutation_value( fatigue_modifier );
 
@@ -6399,8 +6532,8 @@ float Character::healing_rate( float at_rest_quality ) const
 {
     float const rest = clamp( at_rest_quality, 0.0f, 1.0f );
     // TODO: Cache
-    float const base_heal_rate = is_avatar() ? get_option<float>( "PLAYER_HEALING_RATE" )
-                                 : get_option<float>( "NPC_HEALING_RATE" );
+    float const base_heal_rate = is_avatar() ? opt_player_healing_rate.get()
+                                 : opt_npc_healing_rate.get();
     float const heal_rate =
         base_heal_rate * mutation_value( "healing_multiplier" );
     float const awake_rate = ( 1.0f - rest ) * heal_rate * mutation_value( "healing_awake" );
@@ -6911,13 +7044,13 @@ int Character::get_stamina_max() const
     // Since adding cardio, 'player_max_stamina' is really 'base max stamina' and gets further modified
     // by your CV fitness.  Name has been kept this way to avoid needing to change the code.
     // Default base maximum stamina and cardio scaling are defined in data/core/game_balance.json
-    static const std::string player_max_stamina( "PLAYER_MAX_STAMINA_BASE" );
-    static const std::string player_cardiofit_stamina_scale( "PLAYER_CARDIOFIT_STAMINA_SCALING" );
+    static const option_handle<int> opt_player_max_stamina( "PLAYER_MAX_STAMINA_BASE" );
+    static const option_handle<int> opt_player_cardiofit_stamina_scale( "PLAYER_CARDIOFIT_STAMINA_SCALING" );
 
     // Cardiofit stamina mod defaults to 5, and get_cardiofit() should return a value in the vicinity
     // of 1000-3000, so this should add somewhere between 3000 to 15000 stamina.
-    int max_stamina = get_option<int>( player_max_stamina ) +
-                      get_option<int>( player_cardiofit_stamina_scale ) * get_cardiofit();
+    int max_stamina = opt_player_max_stamina.get() +
+                      opt_player_cardiofit_stamina_scale.get() * get_cardiofit();
     max_stamina = enchantment_cache->modify_value( enchant_vals::mod::MAX_STAMINA, max_stamina );
 
     return max_stamina;
@@ -6972,7 +7105,7 @@ void Character::burn_move_stamina( int moves )
         overburden_percentage = ( current_weight - max_weight ) * 100 / max_weight;
     }
 
-    int burn_ratio = get_option<int>( "PLAYER_BASE_STAMINA_BURN_RATE" );
+    int burn_ratio = opt_player_base_stamina_burn_rate.get();
     for( const bionic_id &bid : get_bionic_fueled_with_muscle() ) {
         if( has_active_bionic( bid ) ) {
             burn_ratio = burn_ratio * 2 - 3;
@@ -7009,8 +7142,8 @@ void Character::burn_move_stamina( int moves )
 
 void Character::update_stamina( int turns )
 {
-    static const std::string player_base_stamina_regen_rate( "PLAYER_BASE_STAMINA_REGEN_RATE" );
-    const float base_regen_rate = get_option<float>( player_base_stamina_regen_rate );
+    static const option_handle<float> opt_player_base_stamina_regen_rate( "PLAYER_BASE_STAMINA_REGEN_RATE" );
+    const float base_regen_rate = opt_player_base_stamina_regen_rate.get();
     // Your stamina regen rate works as a function of how fit you are compared to your body size.
     // This allows it to scale more quickly than your stamina, so that at higher fitness levels you
     // recover stamina faster.
@@ -7737,18 +7870,48 @@ void Character::recalculate_bodyparts()
     calc_encumbrance();
 }
 
+// Effects that grant enchantments, in the order of the effects map
+static std::vector<efftype_id> enchanted_effects( const effects_map &effects )
+{
+    std::vector<efftype_id> ret;
+    for( const auto &elem : effects ) {
+        if( !elem.first->enchantments.empty() ) {
+            ret.push_back( elem.first );
+        }
+    }
+    return ret;
+}
+
+void Character::update_enchantment_cache()
+{
+    if( enchantment_cache_depends_on_state ||
+        enchantment_cache_inventory_version != inventory_version ||
+        enchantment_cache_effects != enchanted_effects( *effects ) ) {
+        recalculate_enchantment_cache();
+    }
+}
+
 void Character::recalculate_enchantment_cache()
 {
+    // Stamp the inputs first, so changes made while recalculating (bodyparts, hp) are picked
+    // up by the next update
+    enchantment_cache_inventory_version = inventory_version;
+    enchantment_cache_effects = enchanted_effects( *effects );
+    bool depends_on_state = false;
+
     // start by resetting the cache to all inventory items
-    *enchantment_cache = inv->get_active_enchantment_cache( *this );
+    *enchantment_cache = inv->get_active_enchantment_cache( *this, depends_on_state );
 
-    cache_visit_items_with( "is_relic", &item::is_relic, [this]( const item & it ) {
+    cache_visit_items_with( "is_relic", &item::is_relic,
+    [this, &depends_on_state]( const item & it ) {
         for( const enchant_cache &ench : it.get_proc_enchantments() ) {
+            depends_on_state = depends_on_state || ench.depends_on_state();
             if( ench.is_active( *this, it ) ) {
                 enchantment_cache->force_add( ench );
             }
         }
         for( const enchantment &ench : it.get_defined_enchantments() ) {
+            depends_on_state = depends_on_state || ench.depends_on_state();
             if( ench.is_active( *this, it ) ) {
                 enchantment_cache->force_add( ench, *this );
             }
@@ -7761,6 +7924,7 @@ void Character::recalculate_enchantment_cache()
 
         for( const enchantment_id &ench_id : mut.enchantments ) {
             const enchantment &ench = ench_id.obj();
+            depends_on_state = depends_on_state || ench.depends_on_state();
             if( ench.is_active( *this, mut.activated && mut_map.second.powered ) ) {
                 enchantment_cache->force_add( ench, *this );
             }
@@ -7772,6 +7936,7 @@ void Character::recalculate_enchantment_cache()
 
         for( const enchantment_id &ench_id : bid->enchantments ) {
             const enchantment &ench = ench_id.obj();
+            depends_on_state = depends_on_state || ench.depends_on_state();
             if( ench.is_active( *this, bio.powered &&
                                 bid->has_flag( STATIC( json_character_flag( "BIONIC_TOGGLED" ) ) ) ) ) {
                 enchantment_cache->force_add( ench, *this );
@@ -7782,11 +7947,13 @@ void Character::recalculate_enchantment_cache()
     for( const auto &elem : *effects ) {
         for( const enchantment_id &ench_id : elem.first->enchantments ) {
             const enchantment &ench = ench_id.obj();
+            depends_on_state = depends_on_state || ench.depends_on_state();
             if( ench.is_active( *this, true ) ) {
                 enchantment_cache->force_add( ench, *this );
             }
         }
     }
+    enchantment_cache_depends_on_state = depends_on_state;
 
     if( enchantment_cache->modifies_bodyparts() ) {
         recalculate_bodyparts();
@@ -9326,34 +9493,25 @@ void Character::cache_visit_items_with( const std::string &key, const itype_id &
                                         const flag_id &type_flag, bool( item::*filter_func )() const,
                                         const std::function<void( item & )> &do_func )
 {
-    // If the cache already exists, use it. Remove all invalid item references.
-    auto found_cache = inv_search_caches.find( key );
-    if( found_cache != inv_search_caches.end() ) {
-        inv_search_caches[key].items.erase( std::remove_if( inv_search_caches[key].items.begin(),
-        inv_search_caches[key].items.end(), [&do_func]( const safe_reference<item> &it ) {
-            if( it ) {
-                do_func( *it );
-                return false;
-            }
-            return true;
-        } ), inv_search_caches[key].items.end() );
+    const auto [found_cache, created] = inv_search_caches.try_emplace( key );
+    inv_search_cache &cache = found_cache->second;
+    if( created ) {
+        // Populate a new cache with all matching items in the inventory. Empty lists are kept too.
+        cache.type = type;
+        cache.type_flag = type_flag;
+        cache.filter_func = filter_func;
+        fill_inv_search_cache( cache, do_func );
         return;
-    } else {
-        // Otherwise, add a new cache and populate with all appropriate items in the inventory. Empty lists are still created.
-        inv_search_caches[key].type = type;
-        inv_search_caches[key].type_flag = type_flag;
-        inv_search_caches[key].filter_func = filter_func;
-        visit_items( [&]( item * it, item * ) {
-            if( ( !type.is_valid() || it->typeId() == type ) &&
-                ( !type_flag.is_valid() || it->type->has_flag( type_flag ) ) &&
-                ( filter_func == nullptr || ( it->*filter_func )() ) ) {
-
-                inv_search_caches[key].items.push_back( it->get_safe_reference() );
-                do_func( *it );
-            }
-            return VisitResponse::NEXT;
-        } );
     }
+    // The cache already exists, use it. Remove all invalid item references.
+    cache.items.erase( std::remove_if( cache.items.begin(), cache.items.end(),
+    [&do_func]( const safe_reference<item> &it ) {
+        if( it ) {
+            do_func( *it );
+            return false;
+        }
+        return true;
+    } ), cache.items.end() );
 }
 
 void Character::cache_visit_items_with( const itype_id &type,
@@ -9378,34 +9536,25 @@ void Character::cache_visit_items_with( const std::string &key, const itype_id &
                                         const flag_id &type_flag, bool( item::*filter_func )() const,
                                         const std::function<void( const item & )> &do_func ) const
 {
-    // If the cache already exists, use it. Remove all invalid item references.
-    auto found_cache = inv_search_caches.find( key );
-    if( found_cache != inv_search_caches.end() ) {
-        inv_search_caches[key].items.erase( std::remove_if( inv_search_caches[key].items.begin(),
-        inv_search_caches[key].items.end(), [&do_func]( const safe_reference<item> &it ) {
-            if( it ) {
-                do_func( *it );
-                return false;
-            }
-            return true;
-        } ), inv_search_caches[key].items.end() );
+    const auto [found_cache, created] = inv_search_caches.try_emplace( key );
+    inv_search_cache &cache = found_cache->second;
+    if( created ) {
+        // Populate a new cache with all matching items in the inventory. Empty lists are kept too.
+        cache.type = type;
+        cache.type_flag = type_flag;
+        cache.filter_func = filter_func;
+        fill_inv_search_cache( cache, do_func );
         return;
-    } else {
-        // Otherwise, add a new cache and populate with all appropriate items in the inventory. Empty lists are still created.
-        inv_search_caches[key].type = type;
-        inv_search_caches[key].type_flag = type_flag;
-        inv_search_caches[key].filter_func = filter_func;
-        visit_items( [&]( item * it, item * ) {
-            if( ( !type.is_valid() || it->typeId() == type ) &&
-                ( !type_flag.is_valid() || it->type->has_flag( type_flag ) ) &&
-                ( filter_func == nullptr || ( it->*filter_func )() ) ) {
-
-                inv_search_caches[key].items.push_back( it->get_safe_reference() );
-                do_func( *it );
-            }
-            return VisitResponse::NEXT;
-        } );
     }
+    // The cache already exists, use it. Remove all invalid item references.
+    cache.items.erase( std::remove_if( cache.items.begin(), cache.items.end(),
+    [&do_func]( const safe_reference<item> &it ) {
+        if( it ) {
+            do_func( *it );
+            return false;
+        }
+        return true;
+    } ), cache.items.end() );
 }
 
 bool Character::cache_has_item_with( const itype_id &type,
@@ -9432,39 +9581,33 @@ bool Character::cache_has_item_with( const std::string &key, const itype_id &typ
 {
     bool aborted = false;
 
-    // If the cache already exists, use it. Stop iterating if the check_func ever returns true. Remove any invalid item references encountered.
-    auto found_cache = inv_search_caches.find( key );
-    if( found_cache != inv_search_caches.end() ) {
-        for( auto iter = found_cache->second.items.begin();
-             iter != found_cache->second.items.end(); ) {
-            if( *iter ) {
-                if( check_func( **iter ) ) {
-                    aborted = true;
-                    break;
-                }
-                ++iter;
-            } else {
-                iter = inv_search_caches[found_cache->first].items.erase( iter );
-            }
-        }
-    } else {
-        // Otherwise, add a new cache and populate with all appropriate items in the inventory. Empty lists are still created.
-        inv_search_caches[key].type = type;
-        inv_search_caches[key].type_flag = type_flag;
-        inv_search_caches[key].filter_func = filter_func;
-        visit_items( [&]( item * it, item * ) {
-            if( ( !type.is_valid() || it->typeId() == type ) &&
-                ( !type_flag.is_valid() || it->type->has_flag( type_flag ) ) &&
-                ( filter_func == nullptr || ( it->*filter_func )() ) ) {
-
-                inv_search_caches[key].items.push_back( it->get_safe_reference() );
-                // If check_func returns true, stop running it but keep populating the cache.
-                if( !aborted && check_func( *it ) ) {
-                    aborted = true;
-                }
+    const auto [found_cache, created] = inv_search_caches.try_emplace( key );
+    inv_search_cache &cache = found_cache->second;
+    if( created ) {
+        // Populate a new cache with all matching items in the inventory. Empty lists are kept too.
+        cache.type = type;
+        cache.type_flag = type_flag;
+        cache.filter_func = filter_func;
+        fill_inv_search_cache( cache, [&]( const item & it ) {
+            // If check_func returns true, stop running it but keep populating the cache.
+            if( !aborted && check_func( it ) ) {
+                aborted = true;
             }
-            return VisitResponse::NEXT;
         } );
+        return aborted;
+    }
+    // The cache already exists, use it. Stop iterating if the check_func ever returns true.
+    // Remove any invalid item references encountered.
+    for( auto iter = cache.items.begin(); iter != cache.items.end(); ) {
+        if( *iter ) {
+            if( check_func( **iter ) ) {
+                aborted = true;
+                break;
+            }
+            ++iter;
+        } else {
+            iter = cache.items.erase( iter );
+        }
     }
     return aborted;
 }
@@ -9551,6 +9694,23 @@ std::vector<const item *> Character::cache_get_items_with( const std::string &ke
     return ret;
 }
 
+void Character::fill_inv_search_cache( inv_search_cache &cache,
+                                       const std::function<void( item & )> &on_match ) const
+{
+    // Resolved once here rather than for every visited item
+    const bool any_type = !cache.type.is_valid();
+    const bool any_flag = !cache.type_flag.is_valid();
+    visit_items( [&]( item * it, item * ) {
+        if( ( any_type || it->typeId() == cache.type ) &&
+            ( any_flag || it->type->has_flag( cache.type_flag ) ) &&
+            ( cache.filter_func == nullptr || ( it->*cache.filter_func )() ) ) {
+            cache.items.push_back( it->get_safe_reference() );
+            on_match( *it );
+        }
+        return VisitResponse::NEXT;
+    } );
+}
+
 void Character::add_to_inv_search_caches( item &it ) const
 {
     for( auto &cache : inv_search_caches ) {
@@ -9563,7 +9723,7 @@ void Character::add_to_inv_search_caches( item &it ) const
         // If item is already in the cache, remove it so it can be re-added in its current state.
         for( auto iter = cache.second.items.begin(); iter != cache.second.items.end(); ) {
             if( *iter && iter->get() == &it ) {
-                iter = inv_search_caches[cache.first].items.erase( iter );
+                iter = cache.second.items.erase( iter );
             } else {
                 ++iter;
             }
@@ -293,71 +293,61 @@ struct queued_eoc {
         std::unordered_map<std::string, std::string> context;
 };
 
-struct eoc_compare {
-    bool operator()( const queued_eoc &lhs, const queued_eoc &rhs ) const {
-        return lhs.time > rhs.time;
-    }
-};
-
+/**
+ * Effect on conditions waiting for their time to come.
+ *
+ * The entries live in `list`; the schedule only holds iterators into it. Entries due
+ * within the next couple of hours are kept in a timing wheel of one minute slots, so
+ * queuing one is O(1) and collecting everything due only looks at the slots the clock
+ * has passed since the last call. Entries further out wait in a heap and are moved into
+ * the wheel as it turns.
+ */
 struct queued_eocs {
-    using storage_iter = std::list<queued_eoc>::iterator;
+    public:
+        using storage_iter = std::list<queued_eoc>::iterator;
 
-    struct eoc_compare : ::eoc_compare {
-        bool operator()( const storage_iter &lhs, const storage_iter &rhs ) const {
-            return ::eoc_compare::operator()( *lhs, *rhs );
-        }
-    };
-    std::priority_queue<storage_iter, std::vector<storage_iter>, eoc_compare> queue;
-    std::list<queued_eoc> list;
+        std::list<queued_eoc> list;
 
-    queued_eocs() = default;
+        queued_eocs() = default;
+        queued_eocs( const queued_eocs &rhs );
+        queued_eocs( queued_eocs && ) noexcept = default;
+        queued_eocs &operator=( const queued_eocs &rhs );
+        queued_eocs &operator=( queued_eocs && ) noexcept = default;
 
-    queued_eocs( const queued_eocs &rhs ) {
-        list = rhs.list;
-        for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
-            queue.emplace( it );
+        bool empty() const {
+            return list.empty();
         }
-    };
-    queued_eocs( queued_eocs &&rhs ) noexcept {
-        queue.swap( rhs.queue );
-        list.swap( rhs.list );
-    }
 
-    queued_eocs &operator=( const queued_eocs &rhs ) {
-        list = rhs.list;
-        // Why doesn't std::priority_queue have a clear() function.
-        queue = {};
-        for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
-            queue.emplace( it );
-        }
-        return *this;
-    }
-    queued_eocs &operator=( queued_eocs &&rhs ) noexcept {
-        queue.swap( rhs.queue );
-        list.swap( rhs.list );
-        return *this;
-    }
+        void push( const queued_eoc &eoc );
+        void clear();
 
-    /* std::priority_queue compatibility layer where performance is less relevant */
+        /**
+         * Takes every entry due at or before @p until off the schedule, earliest first.
+         * The entries stay in `list`: erase them from there or hand them to @ref reschedule.
+         */
+        std::vector<storage_iter> take_due( const time_point &until );
+        /** Puts an entry returned by @ref take_due back on the schedule at its current time. */
+        void reschedule( storage_iter it );
 
-    bool empty() const {
-        return queue.empty();
-    }
+    private:
+        static constexpr int num_slots = 128;
+        static constexpr int turns_per_slot = 60;
 
-    const queued_eoc &top() const {
-        return *queue.top();
-    }
+        struct later_first {
+            bool operator()( const storage_iter &lhs, const storage_iter &rhs ) const {
+                return lhs->time > rhs->time;
+            }
+        };
 
-    void push( const queued_eoc &eoc ) {
-        auto it = list.emplace( list.end(), eoc );
-        queue.push( it );
-    }
+        static int slot_of( const time_point &t );
+        void schedule( storage_iter it );
+        void pull_overflow();
 
-    void pop() {
-        auto it = queue.top();
-        queue.pop();
-        list.erase( it );
-    }
+        // allocated on first use, most NPCs never queue anything
+        std::vector<std::vector<storage_iter>> slots;
+        std::priority_queue<storage_iter, std::vector<storage_iter>, later_first> overflow;
+        // Slot the clock is in; slots before it have been emptied
+        int current_slot = 0;
 };
 
 struct aim_type {
@@ -1501,6 +1491,11 @@ class Character : public Creature, public visitable
     public:
         /** Recalculate encumbrance for all body parts. */
         void calc_encumbrance();
+        /**
+         * Recalculate encumbrance after a change that can't affect worn items (body mass,
+         * active bionics), reusing the layering of worn items from the last calc_encumbrance.
+         */
+        void calc_encumbrance_modifiers();
         /** Calculate any discomfort your current clothes are causing. */
         void calc_discomfort();
         /** Recalculate encumbrance for all body parts as if `new_item` was also worn. */
@@ -1509,6 +1504,9 @@ class Character : public Creature, public visitable
         void recalculate_bodyparts();
         // recalculates enchantment cache by iterating through all held, worn, and wielded items
         void recalculate_enchantment_cache();
+        // recalculates the enchantment cache only if the items, the enchanted effects or any
+        // state an enchantment depends on (see enchantment::depends_on_state) may have changed
+        void update_enchantment_cache();
         // gets add and mult value from enchantment cache
         double calculate_by_enchantment( double modify, enchant_vals::mod value,
                                          bool round_output = false ) const;
@@ -2312,6 +2310,14 @@ class Character : public Creature, public visitable
         void invalidate_inventory_validity_cache();
 
         void invalidate_weight_carried_cache();
+        /**
+         * Changes whenever one of the two caches above is invalidated, i.e. whenever items may
+         * have been added, removed or changed. Results derived from the inventory can compare
+         * it to tell when they have to be redone.
+         */
+        unsigned int get_inventory_version() const {
+            return inventory_version;
+        }
         /** Returns all items that must be taken off before taking off this item */
         std::list<item *> get_dependent_worn_items( const item &it );
         /** Drops an item to the specified location */
@@ -3402,6 +3408,13 @@ class Character : public Creature, public visitable
         const inventory &crafting_inventory( const tripoint &src_pos = tripoint_zero,
                                              int radius = PICKUP_RANGE, bool clear_path = true ) const;
         void invalidate_crafting_inventory();
+        /**
+         * Identifies the contents of the last inventory returned by @ref crafting_inventory.
+         * It is different after the inventory has been formed again, also for other characters.
+         */
+        int crafting_inventory_generation() const {
+            return crafting_cache.generation;
+        }
 
         /** Returns a value from 1.0 to 11.0 that acts as a multiplier
          * for the time taken to perform tasks that require detail vision,
@@ -3634,6 +3647,13 @@ class Character : public Creature, public visitable
         bool leak_level_dirty = true;
         // Cache if current bionic layout has certain json flag. Refreshed upon bionics add/remove, activation/deactivation.
         mutable std::map<const json_character_flag, bool> bio_flag_cache;
+        // How many of @ref my_mutations have each json flag that doesn't depend on the mutation
+        // being active. Rebuilt on demand after mutations were added or removed.
+        mutable std::optional<std::unordered_map<json_character_flag, int>> trait_flag_counts;
+        // Mutations in @ref my_mutations with flags that depend on them being active, rebuilt along
+        // with @ref trait_flag_counts
+        mutable std::vector<const mutation_branch *> activated_mutations;
+        void build_trait_flag_cache() const;
     public:
         float get_leak_level() const;
         /** Iterate through the character inventory to get its leak level */
@@ -3864,6 +3884,7 @@ class Character : public Creature, public visitable
          * If it is nullopt, needs to be recalculated
          */
         mutable std::optional<units::mass> cached_weight_carried = std::nullopt;
+        unsigned int inventory_version = 0;
 
         void store( JsonOut &json ) const;
         void load( const JsonObject &data );
@@ -4003,6 +4024,8 @@ class Character : public Creature, public visitable
             int moves;
             tripoint position;
             int radius;
+            // Unique among all characters, changes whenever the inventory is formed again
+            int generation = 0;
             pimpl<inventory> crafting_inventory;
         };
         mutable crafting_cache_type crafting_cache;
@@ -4020,6 +4043,9 @@ class Character : public Creature, public visitable
             std::list<safe_reference<item>> items;
         };
         mutable std::unordered_map<std::string, inv_search_cache> inv_search_caches;
+        /** Fills a new @p cache from the whole inventory, calls @p on_match for each item added. */
+        void fill_inv_search_cache( inv_search_cache &cache,
+                                    const std::function<void( item & )> &on_match ) const;
     protected:
         // Bionic IDs are unique only within a character. Used to unambiguously identify bionics in a character
         bionic_uid weapon_bionic_uid = 0;
@@ -4039,8 +4065,43 @@ class Character : public Creature, public visitable
         bool last_climate_control_ret;
 
         // a cache of all active enchantment values.
-        // is recalculated every turn in Character::recalculate_enchantment_cache
+        // is checked every turn in Character::update_enchantment_cache
         pimpl<enchant_cache> enchantment_cache;
+    private:
+        // what enchantment_cache was last calculated from, see update_enchantment_cache
+        unsigned int enchantment_cache_inventory_version = 0;
+        std::vector<efftype_id> enchantment_cache_effects;
+        bool enchantment_cache_depends_on_state = true;
+        // Encumbrance of worn items alone, before mutations, bionics and BMI are applied
+        std::map<bodypart_id, encumbrance_data> worn_encumbrance;
+        bool worn_encumbrance_valid = false;
+
+        /** Everything @ref update_bodytemp works from, see @ref bodytemp_steady_inputs. */
+        struct bodytemp_inputs {
+            tripoint pos;
+            weather_type_id weather;
+            double humidity = 0.0;
+            int windpower = 0;
+            int best_fire = 0;
+            std::pair<int, int> climate_control;
+            furn_id furn;
+            bool boardable = false;
+            // Flags read by update_bodytemp, one bit each
+            std::bitset<10> flags;
+            std::vector<units::temperature> temperatures;
+            std::vector<units::temperature_delta> warmth;
+            std::map<bodypart_id, int> clothing_warmth;
+            std::map<bodypart_id, int> bonus_warmth;
+            std::map<bodypart_id, int> wind_resistance;
+            std::map<bodypart_id, units::temperature> temp_cur;
+
+            bool operator==( const bodytemp_inputs &rhs ) const;
+        };
+        // Inputs of the last update_bodytemp if it changed no temperature and had no other
+        // effect, further updates are skipped for as long as the inputs stay the same
+        std::optional<bodytemp_inputs> bodytemp_steady_inputs;
+        // Body parts that got comfort morale from that update, it still has to be handed out
+        int bodytemp_steady_comfy_parts = 0;
 };
 
 Character &get_player_character();
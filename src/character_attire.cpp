@@ -1100,6 +1100,13 @@ bool outfit::check_item_encumbrance_flag( bool update_required )
     return update_required;
 }
 
+bool outfit::encumbrance_update_pending() const
+{
+    return std::any_of( worn.begin(), worn.end(), []( const item & i ) {
+        return i.encumbrance_update_;
+    } );
+}
+
 static bool check_natural_attack_restricted_on_worn( const item &i )
 {
     return !i.has_flag( flag_ALLOWS_NATURAL_ATTACKS ) &&
@@ -2088,7 +2095,7 @@ void outfit::best_pocket( Character &guy, const item &it, const item *avoid,
                           std::pair<item_location, item_pocket *> &current_best, bool ignore_settings )
 {
     for( item &worn_it : worn ) {
-        if( &worn_it == &it || &worn_it == avoid ) {
+        if( &worn_it == &it || &worn_it == avoid || !worn_it.is_container() ) {
             continue;
         }
         item_location loc( guy, &worn_it );
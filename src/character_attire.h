@@ -158,6 +158,8 @@ class outfit
         void get_overlay_ids( std::vector<std::pair<std::string, std::string>> &overlay_ids ) const;
         body_part_set exclusive_flag_coverage( body_part_set bps, const flag_id &flag ) const;
         bool check_item_encumbrance_flag( bool update_required );
+        /** Whether a worn item changed in a way that affects encumbrance since the last check. */
+        bool encumbrance_update_pending() const;
         // creates a list of items dependent upon @it
         void add_dependent_item( std::list<item *> &dependent, const item &it );
         std::list<item> remove_worn_items_with( const std::function<bool( item & )> &filter,
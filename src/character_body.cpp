@@ -1,3 +1,6 @@
+#include <array>
+#include <tuple>
+
 #include "avatar.h"
 #include "character.h"
 #include "display.h"
@@ -213,10 +216,11 @@ void Character::update_body( const time_point &from, const time_point &to )
         oxygen = std::min( oxygen, get_oxygen_max() );
     }
     update_stomach( from, to );
-    recalculate_enchantment_cache();
+    update_enchantment_cache();
     update_enchantment_mutations();
-    if( ticks_between( from, to, 3_minutes ) > 0 ) {
-        magic->update_mana( *this, to_turns<float>( 3_minutes ) );
+    const int three_mins = ticks_between( from, to, 3_minutes );
+    if( three_mins > 0 ) {
+        magic->update_mana( *this, to_turns<float>( 3_minutes ) * three_mins );
     }
     const int five_mins = ticks_between( from, to, 5_minutes );
     if( five_mins > 0 ) {
@@ -500,6 +504,52 @@ void Character::update_bodytemp()
     std::map<bodypart_id, int> warmth_per_bp = worn.warmth( *this );
     std::map<bodypart_id, int> bonus_warmth_per_bp = bonus_item_warmth();
     std::map<bodypart_id, int> wind_res_per_bp = get_wind_resistance( clothing_map );
+    const bool pyromania = has_trait( trait_PYROMANIA );
+    const bool deep_water = here.has_flag_ter( ter_furn_flag::TFLAG_DEEP_WATER, pos() );
+    const bool shallow_water = here.has_flag_ter( ter_furn_flag::TFLAG_SHALLOW_WATER, pos() );
+
+    bodytemp_inputs inputs;
+    inputs.pos = pos();
+    inputs.weather = weather_man.weather_id;
+    inputs.humidity = weather.humidity;
+    inputs.windpower = bp_windpower;
+    inputs.best_fire = best_fire;
+    inputs.climate_control = climate_control;
+    inputs.furn = furn_at_pos;
+    inputs.boardable = static_cast<bool>( boardable );
+    const std::array<bool, 10> flags = {{
+            has_sleep, has_sleep_state, has_bark, heat_immune, has_heatsink, has_common_cold,
+            has_effect( effect_flu ), pyromania, deep_water, shallow_water
+        }
+    };
+    for( size_t i = 0; i < flags.size(); ++i ) {
+        inputs.flags[i] = flags[i];
+    }
+    inputs.temperatures = { player_local_temp, water_temperature };
+    inputs.warmth = { hunger_warmth, metabolism_warmth, fatigue_warmth, sunlight_warmth,
+                      lying_warmth, mutation_heat_low, mutation_heat_high, h_radiation,
+                      bmi_heat_bonus
+                    };
+    inputs.clothing_warmth = warmth_per_bp;
+    inputs.bonus_warmth = bonus_warmth_per_bp;
+    inputs.wind_resistance = wind_res_per_bp;
+    for( const bodypart_id &bp : get_all_body_parts() ) {
+        inputs.temp_cur.emplace( bp, get_part_temp_cur( bp ) );
+    }
+    if( bodytemp_steady_inputs && *bodytemp_steady_inputs == inputs && !has_effect( effect_cold ) &&
+        !has_effect( effect_hot ) && !has_effect( effect_frostbite ) ) {
+        // Same as the last update, which left every temperature where it was
+        if( bodytemp_steady_comfy_parts > 0 && calendar::once_every( 1_minutes ) ) {
+            for( int i = 0; i < bodytemp_steady_comfy_parts; ++i ) {
+                add_morale( MORALE_COMFY, 1, 10, 2_minutes, 1_minutes, true );
+            }
+        }
+        return;
+    }
+    // Whether this update changes nothing, so the next ones with the same inputs can be skipped
+    bool steady = true;
+    int comfy_parts = 0;
+
     // We might not use this at all, so leave it empty
     // If we do need to use it, we'll initialize it (once) there
     std::map<bodypart_id, int> fire_armor_per_bp;
@@ -509,6 +559,8 @@ void Character::update_bodytemp()
         if( bp->has_flag( json_flag_IGNORE_TEMP ) ) {
             continue;
         }
+        const units::temperature temp_at_start = get_part_temp_cur( bp );
+        const units::temperature conv_at_start = get_part_temp_conv( bp );
 
         // Represents the fact that the body generates heat when it is cold.
         // TODO: : should this increase hunger?
@@ -541,8 +593,7 @@ void Character::update_bodytemp()
         // Change the ambient temperature into a delta based on our comfortable temperature.
         units::temperature_delta adjusted_temp = player_local_temp - ambient_norm;
         // If you're standing in water, air temperature is replaced by water temperature. No wind.
-        if( here.has_flag_ter( ter_furn_flag::TFLAG_DEEP_WATER, pos() ) ||
-            ( here.has_flag_ter( ter_furn_flag::TFLAG_SHALLOW_WATER, pos() ) && is_lower( bp ) ) ) {
+        if( deep_water || ( shallow_water && is_lower( bp ) ) ) {
             adjusted_temp = water_temperature - ambient_norm; // Swap out air temp for water temp.
             windchill = 0_C_delta;
         }
@@ -580,7 +631,6 @@ void Character::update_bodytemp()
         }
         blister_count += radiation_blister_count;
 
-        const bool pyromania = has_trait( trait_PYROMANIA );
         // BLISTERS : Skin gets blisters from intense heat exposure.
         // Fire protection protects from blisters.
         // Heatsinks give near-immunity.
@@ -591,6 +641,7 @@ void Character::update_bodytemp()
             fire_armor_per_bp = get_all_armor_type( STATIC( damage_type_id( "heat" ) ), clothing_map );
         }
         if( blister_count - fire_armor_per_bp[bp] > 0 ) {
+            steady = false;
             add_effect( effect_blisters, 1_turns, bp );
             if( pyromania ) {
                 add_morale( MORALE_PYROMANIA_NEARFIRE, 10, 10, 1_hours,
@@ -598,6 +649,7 @@ void Character::update_bodytemp()
                 rem_morale( MORALE_PYROMANIA_NOFIRE );
             }
         } else if( pyromania && best_fire >= 1 ) { // Only give us fire bonus if there's actually fire
+            steady = false;
             add_morale( MORALE_PYROMANIA_NEARFIRE, 5, 5, 30_minutes,
                         15_minutes ); // Gain a much smaller mood boost even if it doesn't hurt us
             rem_morale( MORALE_PYROMANIA_NOFIRE );
@@ -671,11 +723,13 @@ void Character::update_bodytemp()
 
             // Morale bonus for comfiness - only if actually comfy (not too warm/cold)
             // Spread the morale bonus in time.
-            if( comfortable_warmth > 0_C_delta &&
-                calendar::once_every( 1_minutes ) && get_effect_int( effect_cold ) == 0 &&
+            if( comfortable_warmth > 0_C_delta && get_effect_int( effect_cold ) == 0 &&
                 get_effect_int( effect_hot ) == 0 &&
                 get_part_temp_conv( bp ) > BODYTEMP_COLD && get_part_temp_conv( bp ) <= BODYTEMP_NORM ) {
-                add_morale( MORALE_COMFY, 1, 10, 2_minutes, 1_minutes, true );
+                comfy_parts++;
+                if( calendar::once_every( 1_minutes ) ) {
+                    add_morale( MORALE_COMFY, 1, 10, 2_minutes, 1_minutes, true );
+                }
             }
         }
 
@@ -787,6 +841,10 @@ void Character::update_bodytemp()
         }
 
         const units::temperature conv_temp = get_part_temp_conv( bp );
+        // Nothing but the comfort morale happens to a part at rest between cold and hot
+        steady = steady && temp_after == temp_at_start && conv_temp == conv_at_start &&
+                 temp_after > BODYTEMP_COLD && temp_after <= BODYTEMP_HOT &&
+                 conv_temp > BODYTEMP_COLD && get_part_frostbite_timer( bp ) == 0;
         // Warn the player that wind is going to be a problem.
         // But only if it can be a problem, no need to spam player with "wind chills your scorching body"
         if( conv_temp <= BODYTEMP_COLD && windchill < units::from_fahrenheit_delta( -10 ) &&
@@ -804,6 +862,23 @@ void Character::update_bodytemp()
                      body_part_name( bp ) );
         }
     }
+    if( steady ) {
+        bodytemp_steady_inputs = std::move( inputs );
+        bodytemp_steady_comfy_parts = comfy_parts;
+    } else {
+        bodytemp_steady_inputs.reset();
+    }
+}
+
+bool Character::bodytemp_inputs::operator==( const bodytemp_inputs &rhs ) const
+{
+    return std::tie( pos, weather, humidity, windpower, best_fire, climate_control, furn, boardable,
+                     flags, temperatures, warmth, clothing_warmth, bonus_warmth, wind_resistance,
+                     temp_cur ) ==
+           std::tie( rhs.pos, rhs.weather, rhs.humidity, rhs.windpower, rhs.best_fire,
+                     rhs.climate_control, rhs.furn, rhs.boardable, rhs.flags, rhs.temperatures,
+                     rhs.warmth, rhs.clothing_warmth, rhs.bonus_warmth, rhs.wind_resistance,
+                     rhs.temp_cur );
 }
 
 void Character::update_frostbite( const bodypart_id &bp, const int FBwindPower,
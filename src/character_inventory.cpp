@@ -148,9 +148,9 @@ units::volume Character::max_single_item_volume() const
 std::pair<item_location, item_pocket *> Character::best_pocket( const item &it, const item *avoid,
         bool ignore_settings )
 {
-    item_location weapon_loc( *this, &weapon );
     std::pair<item_location, item_pocket *> ret = std::make_pair( item_location(), nullptr );
-    if( &weapon != &it && &weapon != avoid ) {
+    if( &weapon != &it && &weapon != avoid && weapon.is_container() ) {
+        item_location weapon_loc( *this, &weapon );
         ret = weapon.best_pocket( it, weapon_loc, avoid, false, ignore_settings );
     }
     worn.best_pocket( *this, it, avoid, ret, ignore_settings );
@@ -9,6 +9,7 @@
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 
 #include "cata_utility.h"
 #include "character.h"
@@ -103,6 +104,8 @@ void zone_manager::clear()
     // Do not clear types since it is needed for the next games.
     area_cache.clear();
     vzone_cache.clear();
+    area_boxes.clear();
+    vzone_boxes.clear();
 }
 
 std::string zone_type::name() const
@@ -843,9 +846,77 @@ bool zone_manager::has_defined( const zone_type_id &type, const faction_id &fac
     return type_iter != area_cache.end();
 }
 
+// square_dist() from p to the closest point of the box from lo to hi
+static int square_dist_to_box( const tripoint_abs_ms &p, const tripoint_abs_ms &lo,
+                               const tripoint_abs_ms &hi )
+{
+    const auto axis_dist = []( int v, int min, int max ) {
+        return v < min ? min - v : v > max ? v - max : 0;
+    };
+    return std::max( { axis_dist( p.x(), lo.x(), hi.x() ), axis_dist( p.y(), lo.y(), hi.y() ),
+                       axis_dist( p.z(), lo.z(), hi.z() )
+                     } );
+}
+
+// Whether the item belongs in a LOOT_CUSTOM or LOOT_ITEM_GROUP zone with this filter
+static bool loot_mark_matches( const zone_type_id &ztype, const std::string &mark, const item &it )
+{
+    item const *const check_it = it.this_or_single_content();
+    if( ztype == zone_type_LOOT_CUSTOM ) {
+        // compiling a filter isn't free and this runs for every item being sorted
+        static std::unordered_map<std::string, std::function<bool( const item & )>> compiled;
+        auto iter = compiled.find( mark );
+        if( iter == compiled.end() ) {
+            iter = compiled.emplace( mark, item_filter_from_string( mark ) ).first;
+        }
+        auto const &z = iter->second;
+        return z( *check_it ) || ( check_it != &it && z( it ) );
+    } else if( ztype == zone_type_LOOT_ITEM_GROUP ) {
+        return item_group::group_contains_item( item_group_id( mark ), check_it->typeId() ) ||
+               ( check_it != &it && item_group::group_contains_item( item_group_id( mark ), it.typeId() ) );
+    }
+    return false;
+}
+
+void zone_manager::cache_zone( const zone_data &zone,
+                               std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> &points,
+                               std::unordered_map<std::string, std::vector<zone_box>> &boxes )
+{
+    const std::string &type_hash = zone.get_type_hash();
+    auto &cache = points[type_hash];
+
+    // Draw marked area
+    for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
+             zone.get_start_point(), zone.get_end_point() ) ) {
+        cache.insert( p );
+    }
+
+    const tripoint_abs_ms start = zone.get_start_point();
+    const tripoint_abs_ms end = zone.get_end_point();
+    zone_box box{ tripoint_abs_ms( std::min( start.x(), end.x() ), std::min( start.y(), end.y() ),
+                                   std::min( start.z(), end.z() ) ),
+                  tripoint_abs_ms( std::max( start.x(), end.x() ), std::max( start.y(), end.y() ),
+                                   std::max( start.z(), end.z() ) ),
+                  std::string() };
+    if( zone.get_type() == zone_type_LOOT_CUSTOM || zone.get_type() == zone_type_LOOT_ITEM_GROUP ) {
+        box.mark = dynamic_cast<const loot_options &>( zone.get_options() ).get_mark();
+    }
+    boxes[type_hash].emplace_back( std::move( box ) );
+}
+
+const std::vector<zone_manager::zone_box> &zone_manager::get_boxes(
+    const std::unordered_map<std::string, std::vector<zone_box>> &boxes, const zone_type_id &type,
+    const faction_id &fac )
+{
+    static const std::vector<zone_box> none;
+    const auto iter = boxes.find( zone_data::make_type_hash( type, fac ) );
+    return iter == boxes.end() ? none : iter->second;
+}
+
 void zone_manager::cache_data( bool update_avatar )
 {
     area_cache.clear();
+    area_boxes.clear();
     avatar &player_character = get_avatar();
     tripoint_abs_ms cached_shift = player_character.get_location();
     for( zone_data &elem : zones ) {
@@ -859,14 +930,7 @@ void zone_manager::cache_data( bool update_avatar )
             elem.update_cached_shift( cached_shift );
         }
 
-        const std::string &type_hash = elem.get_type_hash();
-        auto &cache = area_cache[type_hash];
-
-        // Draw marked area
-        for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
-                 elem.get_start_point(), elem.get_end_point() ) ) {
-            cache.insert( p );
-        }
+        cache_zone( elem, area_cache, area_boxes );
     }
 }
 
@@ -901,6 +965,7 @@ void zone_manager::cache_avatar_location()
 void zone_manager::cache_vzones( map *pmap )
 {
     vzone_cache.clear();
+    vzone_boxes.clear();
     map &here = pmap == nullptr ? get_map() : *pmap;
     auto vzones = here.get_vehicle_zones( here.get_abs_sub().z() );
     for( zone_data *elem : vzones ) {
@@ -908,25 +973,17 @@ void zone_manager::cache_vzones( map *pmap )
             continue;
         }
 
-        const std::string &type_hash = elem->get_type_hash();
-        auto &cache = vzone_cache[type_hash];
-
-        // TODO: looks very similar to the above cache_data - maybe merge it?
-
-        // Draw marked area
-        for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
-                 elem->get_start_point(), elem->get_end_point() ) ) {
-            cache.insert( p );
-        }
+        cache_zone( *elem, vzone_cache, vzone_boxes );
     }
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_point_set( const zone_type_id &type,
+const std::unordered_set<tripoint_abs_ms> &zone_manager::get_point_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const std::unordered_set<tripoint_abs_ms> none;
     const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return none;
     }
 
     return type_iter->second;
@@ -943,7 +1000,7 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
 {
     std::unordered_set<tripoint> res;
     map &here = get_map();
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : area_cache ) {
+    for( const std::pair<const std::string, std::unordered_set<tripoint_abs_ms>> &cache : area_cache ) {
         zone_type_id type = zone_data::unhash_type( cache.first );
         faction_id z_fac = zone_data::unhash_fac( cache.first );
         if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
@@ -954,7 +1011,7 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
             }
         }
     }
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
+    for( const std::pair<const std::string, std::unordered_set<tripoint_abs_ms>> &cache : vzone_cache ) {
         zone_type_id type = zone_data::unhash_type( cache.first );
         faction_id z_fac = zone_data::unhash_fac( cache.first );
         if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
@@ -967,7 +1024,7 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
     }
 
     if( npc_search ) {
-        for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
+        for( const std::pair<const std::string, std::unordered_set<tripoint_abs_ms>> &cache : vzone_cache ) {
             zone_type_id type = zone_data::unhash_type( cache.first );
             if( type == zone_type_NO_NPC_PICKUP ) {
                 for( tripoint_abs_ms point : cache.second ) {
@@ -980,13 +1037,14 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
     return res;
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_vzone_set( const zone_type_id &type,
+const std::unordered_set<tripoint_abs_ms> &zone_manager::get_vzone_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const std::unordered_set<tripoint_abs_ms> none;
     //Only regenerate the vehicle zone cache if any vehicles have moved
     const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return none;
     }
 
     return type_iter->second;
@@ -1003,19 +1061,16 @@ bool zone_manager::has( const zone_type_id &type, const tripoint_abs_ms &where,
 bool zone_manager::has_near( const zone_type_id &type, const tripoint_abs_ms &where, int range,
                              const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
+    for( const zone_box &box : get_boxes( area_boxes, type, fac ) ) {
+        if( square_dist_to_box( where, box.min, box.max ) <= range ) {
             return true;
         }
     }
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
-            }
+    for( const zone_box &box : get_boxes( vzone_boxes, type, fac ) ) {
+        if( box.min.z() <= where.z() && where.z() <= box.max.z() &&
+            square_dist_to_box( where, box.min, box.max ) <= range ) {
+            return true;
         }
     }
 
@@ -1100,22 +1155,9 @@ bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it
     if( zones.empty() || !it ) {
         return false;
     }
-    item const *const check_it = it->this_or_single_content();
     for( zone_data const *zone : zones ) {
         loot_options const &options = dynamic_cast<const loot_options &>( zone->get_options() );
-        std::string const filter_string = options.get_mark();
-        bool has = false;
-        if( ztype == zone_type_LOOT_CUSTOM ) {
-            auto const z = item_filter_from_string( filter_string );
-            has = z( *check_it ) || ( check_it != it && z( *it ) );
-        } else if( ztype == zone_type_LOOT_ITEM_GROUP ) {
-            has = item_group::group_contains_item( item_group_id( filter_string ),
-                                                   check_it->typeId() ) ||
-                  ( check_it != it &&
-                    item_group::group_contains_item( item_group_id( filter_string ),
-                            it->typeId() ) );
-        }
-        if( has ) {
+        if( loot_mark_matches( ztype, options.get_mark(), *it ) ) {
             return true;
         }
     }
@@ -1126,28 +1168,36 @@ bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it
 std::unordered_set<tripoint_abs_ms> zone_manager::get_near( const zone_type_id &type,
         const tripoint_abs_ms &where, int range, const item *it, const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
     std::unordered_set<tripoint_abs_ms> near_point_set;
-
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
-            if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                near_point_set.insert( point );
-            }
-        }
+    const bool filtered = type == zone_type_LOOT_CUSTOM || type == zone_type_LOOT_ITEM_GROUP;
+    if( filtered && it == nullptr ) {
+        return near_point_set;
     }
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                    ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                    near_point_set.insert( point );
-                }
-            }
+    // only the part of each zone that is in range has to be looked at
+    const auto add_points = [&]( const zone_box & box, int min_z, int max_z ) {
+        if( filtered && !loot_mark_matches( type, box.mark, *it ) ) {
+            return;
+        }
+        const tripoint_abs_ms lo( std::max( box.min.x(), where.x() - range ),
+                                  std::max( box.min.y(), where.y() - range ),
+                                  std::max( box.min.z(), min_z ) );
+        const tripoint_abs_ms hi( std::min( box.max.x(), where.x() + range ),
+                                  std::min( box.max.y(), where.y() + range ),
+                                  std::min( box.max.z(), max_z ) );
+        if( lo.x() > hi.x() || lo.y() > hi.y() || lo.z() > hi.z() ) {
+            return;
         }
+        for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>( lo, hi ) ) {
+            near_point_set.insert( p );
+        }
+    };
+
+    for( const zone_box &box : get_boxes( area_boxes, type, fac ) ) {
+        add_points( box, where.z() - range, where.z() + range );
+    }
+    for( const zone_box &box : get_boxes( vzone_boxes, type, fac ) ) {
+        add_points( box, where.z(), where.z() );
     }
 
     return near_point_set;
@@ -1162,26 +1212,21 @@ std::optional<tripoint_abs_ms> zone_manager::get_nearest( const zone_type_id &ty
 
     tripoint_abs_ms nearest_pos( INT_MIN, INT_MIN, INT_MIN );
     int nearest_dist = range + 1;
-    const std::unordered_set<tripoint_abs_ms> &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &p : point_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
-            }
-        }
-    }
-
-    const std::unordered_set<tripoint_abs_ms> &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &p : vzone_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
+    for( const auto *boxes : {
+             &get_boxes( area_boxes, type, fac ), &get_boxes( vzone_boxes, type, fac )
+         } ) {
+        for( const zone_box &box : *boxes ) {
+            // the point of the zone closest to where
+            const tripoint_abs_ms p( clamp( where.x(), box.min.x(), box.max.x() ),
+                                     clamp( where.y(), box.min.y(), box.max.y() ),
+                                     clamp( where.z(), box.min.z(), box.max.z() ) );
+            const int cur_dist = square_dist( p, where );
+            if( cur_dist < nearest_dist ) {
+                nearest_dist = cur_dist;
+                nearest_pos = p;
+                if( nearest_dist == 0 ) {
+                    return nearest_pos;
+                }
             }
         }
     }
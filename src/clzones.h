@@ -536,10 +536,29 @@ class zone_manager
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> area_cache;
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> vzone_cache;
-        std::unordered_set<tripoint_abs_ms> get_point_set( const zone_type_id &type,
+        const std::unordered_set<tripoint_abs_ms> &get_point_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint_abs_ms> get_vzone_set( const zone_type_id &type,
+        const std::unordered_set<tripoint_abs_ms> &get_vzone_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
+
+        /** Bounds of an enabled zone, cached next to its points for range queries */
+        struct zone_box {
+            tripoint_abs_ms min;
+            tripoint_abs_ms max;
+            // filter of LOOT_CUSTOM and LOOT_ITEM_GROUP zones
+            std::string mark;
+        };
+        // Same keys as area_cache and vzone_cache, one box per zone
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<std::string, std::vector<zone_box>> area_boxes;
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<std::string, std::vector<zone_box>> vzone_boxes;
+        static void cache_zone( const zone_data &zone,
+                                std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> &points,
+                                std::unordered_map<std::string, std::vector<zone_box>> &boxes );
+        static const std::vector<zone_box> &get_boxes(
+            const std::unordered_map<std::string, std::vector<zone_box>> &boxes, const zone_type_id &type,
+            const faction_id &fac );
     public:
         zone_manager();
         ~zone_manager() = default;
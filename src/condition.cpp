@@ -385,7 +385,7 @@ void write_var_value( var_type type, const std::string &name, talker *talk, dial
         case var_type::var:
             ret = d->get_value( name );
             vinfo = process_variable( ret );
-            write_var_value( vinfo.type, vinfo.name, talk, d, value );
+            write_var_value( vinfo, talk, d, value );
             break;
         case var_type::u:
         case var_type::npc:
@@ -413,6 +413,28 @@ void write_var_value( var_type type, const std::string &name, talker *talk, dial
     write_var_value( type, name, talk, d, string_format( "%g", value ) );
 }
 
+void write_var_value( const var_info &info, talker *talk, dialogue *d, const std::string &value )
+{
+    switch( info.type ) {
+        case var_type::global:
+            get_globals().set_global_value( info.key, value );
+            break;
+        case var_type::u:
+        case var_type::npc:
+            talk->set_var( info.key, value );
+            break;
+        default:
+            write_var_value( info.type, info.name, talk, d, value );
+            break;
+    }
+}
+
+void write_var_value( const var_info &info, talker *talk, dialogue *d, double value )
+{
+    // NOLINTNEXTLINE(cata-translate-string-literal)
+    write_var_value( info, talk, d, string_format( "%g", value ) );
+}
+
 static bodypart_id get_bp_from_str( const std::string &ctxt )
 {
     bodypart_id bid = bodypart_str_id::NULL_ID();
@@ -466,16 +488,42 @@ namespace conditional_fun
 namespace
 {
 
+/**
+ * A str_or_var naming an id. When the JSON gives a plain string the id is built once at
+ * load time, instead of re-interning the string on every evaluation.
+ */
+template<typename Id>
+struct id_or_var {
+    explicit id_or_var( str_or_var &&source_ ) : source( std::move( source_ ) ) {
+        if( source.str_val && !source.function ) {
+            constant = Id( *source.str_val );
+        }
+    }
+
+    Id evaluate( dialogue const &d ) const {
+        return constant ? *constant : Id( source.evaluate( d ) );
+    }
+
+    str_or_var source;
+    std::optional<Id> constant;
+};
+
+template<typename Id>
+id_or_var<Id> get_id_or_var( const JsonValue &jv, std::string_view member )
+{
+    return id_or_var<Id>( get_str_or_var( jv, member, true ) );
+}
+
 conditional_t::func f_has_any_trait( const JsonObject &jo, std::string_view member, bool is_npc )
 {
-    std::vector<str_or_var> traits_to_check;
+    std::vector<id_or_var<trait_id>> traits_to_check;
     for( JsonValue jv : jo.get_array( member ) ) {
-        traits_to_check.emplace_back( get_str_or_var( jv, member ) );
+        traits_to_check.emplace_back( get_id_or_var<trait_id>( jv, member ) );
     }
     return [traits_to_check, is_npc]( dialogue const & d ) {
         const talker *actor = d.actor( is_npc );
-        for( const str_or_var &trait : traits_to_check ) {
-            if( actor->has_trait( trait_id( trait.evaluate( d ) ) ) ) {
+        for( const id_or_var<trait_id> &trait : traits_to_check ) {
+            if( actor->has_trait( trait.evaluate( d ) ) ) {
                 return true;
             }
         }
@@ -485,23 +533,23 @@ conditional_t::func f_has_any_trait( const JsonObject &jo, std::string_view memb
 
 conditional_t::func f_has_trait( const JsonObject &jo, std::string_view member, bool is_npc )
 {
-    str_or_var trait_to_check = get_str_or_var( jo.get_member( member ), member, true );
+    const auto trait_to_check = get_id_or_var<trait_id>( jo.get_member( member ), member );
     return [trait_to_check, is_npc]( dialogue const & d ) {
-        return d.actor( is_npc )->has_trait( trait_id( trait_to_check.evaluate( d ) ) );
+        return d.actor( is_npc )->has_trait( trait_to_check.evaluate( d ) );
     };
 }
 
 conditional_t::func f_has_visible_trait( const JsonObject &jo, std::string_view member,
         bool is_npc )
 {
-    str_or_var trait_to_check = get_str_or_var( jo.get_member( member ), member, true );
+    const auto trait_to_check = get_id_or_var<trait_id>( jo.get_member( member ), member );
     return [trait_to_check, is_npc]( dialogue const & d ) {
         const talker *observer = d.actor( !is_npc );
         const talker *observed = d.actor( is_npc );
         int visibility_cap = observer->get_character()->get_mutation_visibility_cap(
                                  observed->get_character() );
-        bool observed_has = observed->has_trait( trait_id( trait_to_check.evaluate( d ) ) );
-        const mutation_branch &mut_branch = trait_id( trait_to_check.evaluate( d ) ).obj();
+        bool observed_has = observed->has_trait( trait_to_check.evaluate( d ) );
+        const mutation_branch &mut_branch = trait_to_check.evaluate( d ).obj();
         bool is_visible = mut_branch.visibility > 0 && mut_branch.visibility >= visibility_cap;
         return observed_has && is_visible;
     };
@@ -510,42 +558,43 @@ conditional_t::func f_has_visible_trait( const JsonObject &jo, std::string_view
 conditional_t::func f_has_martial_art( const JsonObject &jo, std::string_view member,
                                        bool is_npc )
 {
-    str_or_var style_to_check = get_str_or_var( jo.get_member( member ), member, true );
+    const auto style_to_check = get_id_or_var<matype_id>( jo.get_member( member ), member );
     return [style_to_check, is_npc]( dialogue const & d ) {
-        return d.actor( is_npc )->knows_martial_art( matype_id( style_to_check.evaluate( d ) ) );
+        return d.actor( is_npc )->knows_martial_art( style_to_check.evaluate( d ) );
     };
 }
 
 conditional_t::func f_has_flag( const JsonObject &jo, std::string_view member,
                                 bool is_npc )
 {
-    str_or_var trait_flag_to_check = get_str_or_var( jo.get_member( member ), member, true );
+    const auto trait_flag_to_check =
+        get_id_or_var<json_character_flag>( jo.get_member( member ), member );
     return [trait_flag_to_check, is_npc]( dialogue const & d ) {
         const talker *actor = d.actor( is_npc );
-        if( json_character_flag( trait_flag_to_check.evaluate( d ) ) == json_flag_MUTATION_THRESHOLD ) {
+        if( trait_flag_to_check.evaluate( d ) == json_flag_MUTATION_THRESHOLD ) {
             return actor->crossed_threshold();
         }
-        return actor->has_flag( json_character_flag( trait_flag_to_check.evaluate( d ) ) );
+        return actor->has_flag( trait_flag_to_check.evaluate( d ) );
     };
 }
 
 conditional_t::func f_has_species( const JsonObject &jo, std::string_view member,
                                    bool is_npc )
 {
-    str_or_var species_to_check = get_str_or_var( jo.get_member( member ), member, true );
+    const auto species_to_check = get_id_or_var<species_id>( jo.get_member( member ), member );
     return [species_to_check, is_npc]( dialogue const & d ) {
         const talker *actor = d.actor( is_npc );
-        return actor->has_species( species_id( species_to_check.evaluate( d ) ) );
+        return actor->has_species( species_to_check.evaluate( d ) );
     };
 }
 
 conditional_t::func f_bodytype( const JsonObject &jo, std::string_view member,
                                 bool is_npc )
 {
-    str_or_var bt_to_check = get_str_or_var( jo.get_member( member ), member, true );
+    const auto bt_to_check = get_id_or_var<bodytype_id>( jo.get_member( member ), member );
     return [bt_to_check, is_npc]( dialogue const & d ) {
         const talker *actor = d.actor( is_npc );
-        return actor->bodytype( bodytype_id( bt_to_check.evaluate( d ) ) );
+        return actor->bodytype( bt_to_check.evaluate( d ) );
     };
 }
 
@@ -564,9 +613,10 @@ conditional_t::func f_has_activity( const JsonObject &, std::string_view, bool i
 conditional_t::func f_has_proficiency( const JsonObject &jo, std::string_view member,
                                        bool is_npc )
 {
-    str_or_var proficiency_to_check = get_str_or_var( jo.get_member( member ), member, true );
+    const auto proficiency_to_check =
+        get_id_or_var<proficiency_id>( jo.get_member( member ), member );
     return [proficiency_to_check, is_npc]( dialogue const & d ) {
-        return d.actor( is_npc )->knows_proficiency( proficiency_id( proficiency_to_check.evaluate( d ) ) );
+        return d.actor( is_npc )->knows_proficiency( proficiency_to_check.evaluate( d ) );
     };
 }
 
@@ -585,9 +635,9 @@ conditional_t::func f_is_riding( const JsonObject &, std::string_view, bool is_n
 conditional_t::func f_npc_has_class( const JsonObject &jo, std::string_view member,
                                      bool is_npc )
 {
-    str_or_var class_to_check = get_str_or_var( jo.get_member( member ), member, true );
+    const auto class_to_check = get_id_or_var<npc_class_id>( jo.get_member( member ), member );
     return [class_to_check, is_npc]( dialogue const & d ) {
-        return d.actor( is_npc )->is_myclass( npc_class_id( class_to_check.evaluate( d ) ) );
+        return d.actor( is_npc )->is_myclass( class_to_check.evaluate( d ) );
     };
 }
 
@@ -702,19 +752,19 @@ conditional_t::func f_has_part_temp( const JsonObject &jo, std::string_view memb
 conditional_t::func f_is_wearing( const JsonObject &jo, std::string_view member,
                                   bool is_npc )
 {
-    str_or_var item_id = get_str_or_var( jo.get_member( member ), member, true );
+    const auto item_id = get_id_or_var<itype_id>( jo.get_member( member ), member );
     return [item_id, is_npc]( dialogue const & d ) {
-        return d.actor( is_npc )->is_wearing( itype_id( item_id.evaluate( d ) ) );
+        return d.actor( is_npc )->is_wearing( item_id.evaluate( d ) );
     };
 }
 
 conditional_t::func f_has_item( const JsonObject &jo, std::string_view member, bool is_npc )
 {
-    str_or_var item_id = get_str_or_var( jo.get_member( member ), member, true );
+    const auto item_id = get_id_or_var<itype_id>( jo.get_member( member ), member );
     return [item_id, is_npc]( dialogue const & d ) {
         const talker *actor = d.actor( is_npc );
-        return actor->charges_of( itype_id( item_id.evaluate( d ) ) ) > 0 ||
-               actor->has_amount( itype_id( item_id.evaluate( d ) ), 1 );
+        return actor->charges_of( item_id.evaluate( d ) ) > 0 ||
+               actor->has_amount( item_id.evaluate( d ), 1 );
     };
 }
 
@@ -752,16 +802,16 @@ conditional_t::func f_has_items( const JsonObject &jo, const std::string_view me
 conditional_t::func f_has_item_with_flag( const JsonObject &jo, std::string_view member,
         bool is_npc )
 {
-    str_or_var flag = get_str_or_var( jo.get_member( member ), member, true );
+    const auto flag = get_id_or_var<flag_id>( jo.get_member( member ), member );
     return [flag, is_npc]( dialogue const & d ) {
-        return d.actor( is_npc )->has_item_with_flag( flag_id( flag.evaluate( d ) ) );
+        return d.actor( is_npc )->has_item_with_flag( flag.evaluate( d ) );
     };
 }
 
 conditional_t::func f_has_item_category( const JsonObject &jo, std::string_view member,
         bool is_npc )
 {
-    str_or_var category_id = get_str_or_var( jo.get_member( member ), member, true );
+    const auto category_id = get_id_or_var<item_category_id>( jo.get_member( member ), member );
     size_t count = 1;
     if( jo.has_int( "count" ) ) {
         int tcount = jo.get_int( "count" );
@@ -772,7 +822,7 @@ conditional_t::func f_has_item_category( const JsonObject &jo, std::string_view
 
     return [category_id, count, is_npc]( dialogue const & d ) {
         const talker *actor = d.actor( is_npc );
-        const item_category_id cat_id = item_category_id( category_id.evaluate( d ) );
+        const item_category_id cat_id = category_id.evaluate( d );
         const auto items_with = actor->const_items_with( [cat_id]( const item & it ) {
             return it.get_category_shallow().get_id() == cat_id;
         } );
@@ -796,9 +846,9 @@ conditional_t::func f_has_bionics( const JsonObject &jo, std::string_view member
 conditional_t::func f_has_any_effect( const JsonObject &jo, std::string_view member,
                                       bool is_npc )
 {
-    std::vector<str_or_var> effects_to_check;
+    std::vector<id_or_var<efftype_id>> effects_to_check;
     for( JsonValue jv : jo.get_array( member ) ) {
-        effects_to_check.emplace_back( get_str_or_var( jv, member ) );
+        effects_to_check.emplace_back( get_id_or_var<efftype_id>( jv, member ) );
     }
     dbl_or_var intensity = get_dbl_or_var( jo, "intensity", false, -1 );
     str_or_var bp;
@@ -810,8 +860,8 @@ conditional_t::func f_has_any_effect( const JsonObject &jo, std::string_view mem
     return [effects_to_check, intensity, bp, is_npc]( dialogue & d ) {
         bodypart_id bid = bp.evaluate( d ).empty() ? get_bp_from_str( d.reason ) :
                           bodypart_id( bp.evaluate( d ) );
-        for( const str_or_var &effect_id : effects_to_check ) {
-            effect target = d.actor( is_npc )->get_effect( efftype_id( effect_id.evaluate( d ) ), bid );
+        for( const id_or_var<efftype_id> &effect_id : effects_to_check ) {
+            effect target = d.actor( is_npc )->get_effect( effect_id.evaluate( d ), bid );
             if( !target.is_null() && intensity.evaluate( d ) <= target.get_intensity() ) {
                 return true;
             }
@@ -823,7 +873,7 @@ conditional_t::func f_has_any_effect( const JsonObject &jo, std::string_view mem
 conditional_t::func f_has_effect( const JsonObject &jo, std::string_view member,
                                   bool is_npc )
 {
-    str_or_var effect_id = get_str_or_var( jo.get_member( member ), member, true );
+    const auto effect_id = get_id_or_var<efftype_id>( jo.get_member( member ), member );
     dbl_or_var intensity = get_dbl_or_var( jo, "intensity", false, -1 );
     str_or_var bp;
     if( jo.has_member( "bodypart" ) ) {
@@ -834,7 +884,7 @@ conditional_t::func f_has_effect( const JsonObject &jo, std::string_view member,
     return [effect_id, intensity, bp, is_npc]( dialogue & d ) {
         bodypart_id bid = bp.evaluate( d ).empty() ? get_bp_from_str( d.reason ) :
                           bodypart_id( bp.evaluate( d ) );
-        effect target = d.actor( is_npc )->get_effect( efftype_id( effect_id.evaluate( d ) ), bid );
+        effect target = d.actor( is_npc )->get_effect( effect_id.evaluate( d ), bid );
         return !target.is_null() && intensity.evaluate( d ) <= target.get_intensity();
     };
 }
@@ -1440,7 +1490,7 @@ conditional_t::func f_query_tile( const JsonObject &jo, std::string_view member,
         }
         if( loc.has_value() ) {
             tripoint_abs_ms pos_global = get_map().getglobal( *loc );
-            write_var_value( target_var.type, target_var.name, d.actor( target_var.type == var_type::npc ), &d,
+            write_var_value( target_var, d.actor( target_var.type == var_type::npc ), &d,
                              pos_global.to_string() );
         }
         return loc.has_value();
@@ -1460,9 +1510,9 @@ conditional_t::func f_x_in_y_chance( const JsonObject &jo, const std::string_vie
 
 conditional_t::func f_is_weather( const JsonObject &jo, std::string_view member )
 {
-    str_or_var weather = get_str_or_var( jo.get_member( member ), member, true );
+    const auto weather = get_id_or_var<weather_type_id>( jo.get_member( member ), member );
     return [weather]( dialogue const & d ) {
-        return get_weather().weather_id == weather_type_id( weather.evaluate( d ) );
+        return get_weather().weather_id == weather.evaluate( d );
     };
 }
 
@@ -1641,21 +1691,21 @@ conditional_t::func f_mission_has_generic_rewards()
 conditional_t::func f_has_worn_with_flag( const JsonObject &jo, std::string_view member,
         bool is_npc )
 {
-    str_or_var flag = get_str_or_var( jo.get_member( member ), member, true );
+    const auto flag = get_id_or_var<flag_id>( jo.get_member( member ), member );
     std::optional<bodypart_id> bp;
     optional( jo, false, "bodypart", bp );
     return [flag, bp, is_npc]( dialogue const & d ) {
         bodypart_id bid = bp.value_or( get_bp_from_str( d.reason ) );
-        return d.actor( is_npc )->worn_with_flag( flag_id( flag.evaluate( d ) ), bid );
+        return d.actor( is_npc )->worn_with_flag( flag.evaluate( d ), bid );
     };
 }
 
 conditional_t::func f_has_wielded_with_flag( const JsonObject &jo, std::string_view member,
         bool is_npc )
 {
-    str_or_var flag = get_str_or_var( jo.get_member( member ), member, true );
+    const auto flag = get_id_or_var<flag_id>( jo.get_member( member ), member );
     return [flag, is_npc]( dialogue const & d ) {
-        return d.actor( is_npc )->wielded_with_flag( flag_id( flag.evaluate( d ) ) );
+        return d.actor( is_npc )->wielded_with_flag( flag.evaluate( d ) );
     };
 }
 
@@ -1663,9 +1713,9 @@ conditional_t::func f_has_wielded_with_weapon_category( const JsonObject &jo,
         std::string_view member,
         bool is_npc )
 {
-    str_or_var w_cat = get_str_or_var( jo.get_member( member ), member, true );
+    const auto w_cat = get_id_or_var<weapon_category_id>( jo.get_member( member ), member );
     return [w_cat, is_npc]( dialogue const & d ) {
-        return d.actor( is_npc )->wielded_with_weapon_category( weapon_category_id( w_cat.evaluate( d ) ) );
+        return d.actor( is_npc )->wielded_with_weapon_category( w_cat.evaluate( d ) );
     };
 }
 
@@ -1723,9 +1773,9 @@ conditional_t::func f_is_in_field( const JsonObject &jo, std::string_view member
 conditional_t::func f_has_move_mode( const JsonObject &jo, std::string_view member,
                                      bool is_npc )
 {
-    str_or_var mode = get_str_or_var( jo.get_member( member ), member, true );
+    const auto mode = get_id_or_var<move_mode_id>( jo.get_member( member ), member );
     return [mode, is_npc]( dialogue const & d ) {
-        return d.actor( is_npc )->get_move_mode() == move_mode_id( mode.evaluate( d ) );
+        return d.actor( is_npc )->get_move_mode() == mode.evaluate( d );
     };
 }
 
@@ -1742,9 +1792,9 @@ conditional_t::func f_can_see_location( const JsonObject &jo, std::string_view m
 conditional_t::func f_using_martial_art( const JsonObject &jo, std::string_view member,
         bool is_npc )
 {
-    str_or_var style_to_check = get_str_or_var( jo.get_member( member ), member, true );
+    const auto style_to_check = get_id_or_var<matype_id>( jo.get_member( member ), member );
     return [style_to_check, is_npc]( dialogue const & d ) {
-        return d.actor( is_npc )->using_martial_art( matype_id( style_to_check.evaluate( d ) ) );
+        return d.actor( is_npc )->using_martial_art( style_to_check.evaluate( d ) );
     };
 }
 
@@ -51,6 +51,8 @@ void write_var_value( var_type type, const std::string &name, talker *talk, dial
                       const std::string &value );
 void write_var_value( var_type type, const std::string &name, talker *talk, dialogue *d,
                       double value );
+void write_var_value( const var_info &info, talker *talk, dialogue *d, const std::string &value );
+void write_var_value( const var_info &info, talker *talk, dialogue *d, double value );
 std::string get_talk_varname( const JsonObject &jo, std::string_view member,
                               bool check_value, dbl_or_var &default_val );
 std::string get_talk_var_basename( const JsonObject &jo, std::string_view member,
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "calendar.h"
+#include "cata_scope_helpers.h"
 #include "cata_utility.h"
 #include "catacharset.h"
 #include "character.h"
@@ -310,6 +311,38 @@ struct availability {
             return false;
         }
 };
+
+using availability_map = std::map<const recipe *, availability>;
+
+// Availability worked out while the menu was last open, by crafter. Opening the menu again
+// reuses it as long as the crafter's crafting inventory hasn't been formed again since.
+struct saved_availability {
+    const Character *crafter;
+    int inventory_generation;
+    availability_map cache;
+};
+std::map<character_id, saved_availability> saved_availability_cache;
+
+// Returns the availability cache for the crafter, restoring the saved one if it is still valid.
+availability_map &get_availability_cache( std::map<character_id, availability_map> &caches,
+        std::map<character_id, int> &generations, Character &crafter )
+{
+    const auto found = caches.find( crafter.getID() );
+    if( found != caches.end() ) {
+        return found->second;
+    }
+    availability_map &cache = caches[crafter.getID()];
+    // Make sure the generation is the one of the inventory availability will be checked against
+    crafter.crafting_inventory();
+    const int generation = crafter.crafting_inventory_generation();
+    generations[crafter.getID()] = generation;
+    const auto saved = saved_availability_cache.find( crafter.getID() );
+    if( saved != saved_availability_cache.end() && saved->second.crafter == &crafter &&
+        saved->second.inventory_generation == generation ) {
+        cache = std::move( saved->second.cache );
+    }
+    return cache;
+}
 } // namespace
 
 static std::string craft_success_chance_string( const recipe &recp, const Character &guy )
@@ -1308,10 +1341,21 @@ std::pair<Character *, const recipe *> select_crafter_and_crafting_recipe( int &
         assemble_available_recipes.include( guy->get_available_recipes( crafting_inv ) );
     }
     const recipe_subset &available_recipes = assemble_available_recipes;
-    std::map<character_id, std::map<const recipe *, availability>> guy_availability_cache;
-    // next line also inserts empty cache for crafter->getID()
-    std::map<const recipe *, availability> *availability_cache =
-        &guy_availability_cache[crafter->getID()];
+    std::map<character_id, availability_map> guy_availability_cache;
+    std::map<character_id, int> guy_inventory_generation;
+    availability_map *availability_cache =
+        &get_availability_cache( guy_availability_cache, guy_inventory_generation, *crafter );
+    // Keep what was worked out for the next time the menu is opened
+    on_out_of_scope save_availability( [&]() {
+        saved_availability_cache.clear();
+        for( Character *guy : crafting_group ) {
+            const auto found = guy_availability_cache.find( guy->getID() );
+            if( found != guy_availability_cache.end() ) {
+                saved_availability_cache.emplace( guy->getID(), saved_availability{
+                    guy, guy_inventory_generation[guy->getID()], std::move( found->second ) } );
+            }
+        }
+    } );
 
     const std::string new_recipe_str = pgettext( "crafting gui", "NEW!" );
     const nc_color new_recipe_str_col = c_light_green;
@@ -1915,8 +1959,8 @@ std::pair<Character *, const recipe *> select_crafter_and_crafting_recipe( int &
             if( new_crafter_i >= 0 && new_crafter_i != crafter_i ) {
                 crafter_i = new_crafter_i;
                 crafter = crafting_group[crafter_i];
-                // next line also inserts empty cache for crafter->getID() if non existant
-                availability_cache = &guy_availability_cache[crafter->getID()];
+                availability_cache = &get_availability_cache( guy_availability_cache,
+                                     guy_inventory_generation, *crafter );
                 recalc = true;
                 keepline = true;
             }
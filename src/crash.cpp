@@ -59,6 +59,7 @@ extern "C" {
 #if defined(_WIN32)
         dump_to( ".core" );
 #endif
+        flushDebugLog();
         const std::string crash_log_file = PATH_INFO::crash();
         std::ostringstream log_text;
 #if defined(__ANDROID__)
@@ -11,6 +11,7 @@
 #include <stack>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 
 #include "anatomy.h"
 #include "avatar.h"
@@ -32,6 +33,7 @@
 #include "flat_set.h"
 #include "game.h"
 #include "game_constants.h"
+#include "hash_utils.h"
 #include "item.h"
 #include "json.h"
 #include "level_cache.h"
@@ -118,6 +120,9 @@ static const species_id species_ROBOT( "ROBOT" );
 static const trait_id trait_DEBUG_CLOAK( "DEBUG_CLOAK" );
 static const trait_id trait_PYROMANIA( "PYROMANIA" );
 
+static const option_handle<bool> opt_log_monster_attack_monster( "LOG_MONSTER_ATTACK_MONSTER" );
+static const option_handle<bool> opt_animations( "ANIMATIONS" );
+
 const std::map<std::string, creature_size> Creature::size_map = {
     {"TINY",   creature_size::tiny},
     {"SMALL",  creature_size::small},
@@ -195,7 +200,10 @@ void Creature::set_location( const tripoint_abs_ms &loc )
     location = loc;
 }
 
-void Creature::on_move( const tripoint_abs_ms & ) {}
+void Creature::on_move( const tripoint_abs_ms & )
+{
+    get_creature_tracker().note_creatures_changed();
+}
 
 std::vector<std::string> Creature::get_grammatical_genders() const
 {
@@ -341,12 +349,87 @@ static bool majority_rule( const bool a_vote, const bool b_vote, const bool c_vo
     return ( a_vote + b_vote + c_vote ) > 1;
 }
 
+namespace
+{
+struct sight_memo_key {
+    const Creature *observer;
+    const Creature *target;
+    tripoint from;
+    tripoint to;
+
+    bool operator==( const sight_memo_key &rhs ) const {
+        return observer == rhs.observer && target == rhs.target && from == rhs.from && to == rhs.to;
+    }
+};
+
+struct sight_memo_key_hash {
+    std::size_t operator()( const sight_memo_key &k ) const {
+        std::size_t seed = 0;
+        cata::hash_combine( seed, k.observer );
+        cata::hash_combine( seed, k.target );
+        cata::hash_combine( seed, k.from );
+        cata::hash_combine( seed, k.to );
+        return seed;
+    }
+};
+
+struct sight_memo_data {
+    std::unordered_map<sight_memo_key, bool, sight_memo_key_hash> results;
+    time_point turn = calendar::before_time_starts;
+    sight_memo::counters stats;
+};
+
+sight_memo_data &get_sight_memo()
+{
+    static sight_memo_data memo;
+    return memo;
+}
+} // namespace
+
+void sight_memo::clear()
+{
+    get_sight_memo().results.clear();
+}
+
+const sight_memo::counters &sight_memo::get_counters()
+{
+    return get_sight_memo().stats;
+}
+
+void sight_memo::reset_counters()
+{
+    get_sight_memo().stats = counters();
+}
+
 bool Creature::sees( const Creature &critter ) const
 {
     // Creatures always see themselves (simplifies drawing).
     if( &critter == this ) {
         return true;
     }
+    if( !memoize_sight ) {
+        return sees_unmemoized( critter );
+    }
+
+    sight_memo_data &memo = get_sight_memo();
+    if( memo.turn != calendar::turn ) {
+        memo.results.clear();
+        memo.turn = calendar::turn;
+    }
+    // The positions are part of the key, so anything that moved is looked at again.
+    const sight_memo_key key{ this, &critter, pos(), critter.pos() };
+    if( const auto it = memo.results.find( key ); it != memo.results.end() ) {
+        ++memo.stats.hits;
+        return it->second;
+    }
+    ++memo.stats.misses;
+    const bool result = sees_unmemoized( critter );
+    memo.results.emplace( key, result );
+    return result;
+}
+
+bool Creature::sees_unmemoized( const Creature &critter ) const
+{
 
     if( std::abs( posz() - critter.posz() ) > fov_3d_z_range ) {
         return false;
@@ -1139,14 +1222,14 @@ void Creature::deal_projectile_attack( Creature *source, dealt_projectile_attack
             add_msg_player_or_npc(
                 m_warning,
                 _( "You avoid %s projectile!" ),
-                get_option<bool>( "LOG_MONSTER_ATTACK_MONSTER" ) ? _( "<npcname> avoids %s projectile." ) : "",
+                opt_log_monster_attack_monster.get() ? _( "<npcname> avoids %s projectile." ) : "",
                 source->disp_name( true ) );
         } else {
             add_msg_player_or_npc(
                 m_warning,
                 _( "You avoid an incoming projectile!" ),
-                get_option<bool>( "LOG_MONSTER_ATTACK_MONSTER" ) ? _( "<npcname> avoids an incoming projectile." ) :
-                "" );
+                opt_log_monster_attack_monster.get() ?
+                _( "<npcname> avoids an incoming projectile." ) : "" );
         }
         return;
     }
@@ -1406,7 +1489,7 @@ bool Creature::attack_air( const tripoint &p )
     mod_moves( -move_cost );
 
     // Attack animation
-    if( get_option<bool>( "ANIMATIONS" ) ) {
+    if( opt_animations.get() ) {
         std::map<tripoint, nc_color> area_color;
         area_color[p] = c_black;
         explosion_handler::draw_custom_explosion( p, area_color, "animation_hit" );
@@ -1780,6 +1863,9 @@ void Creature::schedule_effect_removal( const efftype_id &eff_id )
 
 bool Creature::has_effect( const efftype_id &eff_id, const bodypart_id &bp ) const
 {
+    if( !effects->may_contain( eff_id ) ) {
+        return false;
+    }
     // bp_null means anything targeted or not
     if( bp.id() == bodypart_str_id::NULL_ID() ) {
         return effects->count( eff_id );
@@ -1862,6 +1948,9 @@ effect &Creature::get_effect( const efftype_id &eff_id, const bodypart_id &bp )
 
 const effect &Creature::get_effect( const efftype_id &eff_id, const bodypart_id &bp ) const
 {
+    if( !effects->may_contain( eff_id ) ) {
+        return effect::null_effect;
+    }
     auto got_outer = effects->find( eff_id );
     if( got_outer != effects->end() ) {
         auto got_inner = got_outer->second.find( bp );
@@ -1959,12 +2048,22 @@ bool Creature::has_trait( const trait_id &/*flag*/ ) const
 // Methods for setting/getting misc key/value pairs.
 void Creature::set_value( const std::string &key, const std::string &value )
 {
-    values[ key ] = value;
+    values.set( key, value );
 }
 
 void Creature::remove_value( const std::string &key )
 {
-    values.erase( key );
+    values.remove( key );
+}
+
+void Creature::set_value( const var_key &key, const std::string &value )
+{
+    values.set( key, value );
+}
+
+void Creature::remove_value( const var_key &key )
+{
+    values.remove( key );
 }
 
 std::string Creature::get_value( const std::string &key ) const
@@ -1974,8 +2073,12 @@ std::string Creature::get_value( const std::string &key ) const
 
 std::optional<std::string> Creature::maybe_get_value( const std::string &key ) const
 {
-    auto it = values.find( key );
-    return it == values.end() ? std::nullopt : std::optional<std::string> { it->second };
+    return values.get( key );
+}
+
+std::optional<std::string> Creature::maybe_get_value( const var_key &key ) const
+{
+    return values.get( key );
 }
 
 void Creature::clear_values()
@@ -2988,9 +3091,9 @@ bool Creature::is_symbol_highlighted() const
     return false;
 }
 
-std::unordered_map<std::string, std::string> &Creature::get_values()
+std::unordered_map<std::string, std::string> Creature::get_values() const
 {
-    return values;
+    return values.to_map();
 }
 
 bodypart_id Creature::get_max_hitsize_bodypart() const
@@ -25,6 +25,7 @@
 #include "talker.h"
 #include "type_id.h"
 #include "units_fwd.h"
+#include "var_storage.h"
 #include "viewer.h"
 #include "weakpoint.h"
 
@@ -389,6 +390,10 @@ class Creature : public viewer
         bool sees( const tripoint &t, bool is_avatar = false, int range_mod = 0 ) const override;
         bool sees( const tripoint_bub_ms &t, bool is_avatar = false, int range_mod = 0 ) const override;
         /*@}*/
+    private:
+        // The actual check behind sees( const Creature & ), without the sight memo.
+        bool sees_unmemoized( const Creature &critter ) const;
+    public:
 
         /**
          * How far the creature sees under the given light. Creature cannot see places outside this range.
@@ -679,6 +684,9 @@ class Creature : public viewer
         void remove_value( const std::string &key );
         std::string get_value( const std::string &key ) const;
         std::optional<std::string> maybe_get_value( const std::string &key ) const;
+        void set_value( const var_key &key, const std::string &value );
+        void remove_value( const var_key &key );
+        std::optional<std::string> maybe_get_value( const var_key &key ) const;
         void clear_values();
 
         virtual units::mass get_weight() const = 0;
@@ -1181,7 +1189,7 @@ class Creature : public viewer
         virtual const std::string &symbol() const = 0;
         virtual bool is_symbol_highlighted() const;
 
-        std::unordered_map<std::string, std::string> &get_values();
+        std::unordered_map<std::string, std::string> get_values() const;
         void clear_killer();
         // summoned creatures via spells
         void set_summon_time( const time_duration &length );
@@ -1198,13 +1206,14 @@ class Creature : public viewer
         virtual void process_one_effect( effect &e, bool is_new ) = 0;
 
         pimpl<effects_map> effects;
-        std::queue<scheduled_effect, std::list<scheduled_effect>> scheduled_effects;
-        std::queue<terminating_effect, std::list<terminating_effect>> terminating_effects;
+        // deque backed: elements stay put while new ones are pushed during processing
+        std::queue<scheduled_effect> scheduled_effects;
+        std::queue<terminating_effect> terminating_effects;
 
         std::vector<damage_over_time_data> damage_over_time_map;
 
         // Miscellaneous key/value pairs.
-        std::unordered_map<std::string, std::string> values;
+        var_storage values;
 
         // used for innate bonuses like effects. weapon bonuses will be
         // handled separately
@@ -1327,6 +1336,24 @@ class Creature : public viewer
         void messaging_projectile_attack( const Creature *source,
                                           const projectile_attack_results &hit_selection, int total_damage ) const;
 };
+/**
+ * When the SIGHT_MEMO option is set, the results of Creature::sees( const Creature & ) are
+ * remembered until the end of the turn or until the map's vision caches change, whichever comes
+ * first. Changes to the creatures themselves (e.g. being blinded) only show up after that.
+ */
+namespace sight_memo
+{
+struct counters {
+    unsigned long long hits = 0;
+    unsigned long long misses = 0;
+};
+
+/** Forgets all remembered results. */
+void clear();
+const counters &get_counters();
+void reset_counters();
+} // namespace sight_memo
+
 std::unique_ptr<talker> get_talker_for( Creature &me );
 std::unique_ptr<talker> get_talker_for( const Creature &me );
 std::unique_ptr<talker> get_talker_for( Creature *me );
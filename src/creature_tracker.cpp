@@ -1,6 +1,7 @@
 #include "creature_tracker.h"
 
 #include <algorithm>
+#include <memory>
 #include <ostream>
 #include <utility>
 
@@ -8,6 +9,7 @@
 #include "cata_assert.h"
 #include "debug.h"
 #include "flood_fill.h"
+#include "line.h"
 #include "game.h"
 #include "map.h"
 #include "mongroup.h"
@@ -91,10 +93,22 @@ bool creature_tracker::add( const shared_ptr_fast<monster> &critter_ptr )
     }
 
     monsters_list.emplace_back( critter_ptr );
-    monsters_by_location[critter.get_location()] = critter_ptr;
+    set_location( critter.get_location(), critter_ptr );
     return true;
 }
 
+void creature_tracker::reserve( const size_t count )
+{
+    // Grow geometrically, many small batches must not reallocate every time
+    const size_t needed = monsters_list.size() + count;
+    if( needed > monsters_list.capacity() ) {
+        monsters_list.reserve( std::max( needed, monsters_list.capacity() * 2 ) );
+    }
+    if( needed > monsters_by_location.bucket_count() * monsters_by_location.max_load_factor() ) {
+        monsters_by_location.reserve( std::max( needed, monsters_by_location.size() * 2 ) );
+    }
+}
+
 size_t creature_tracker::size() const
 {
     return monsters_list.size();
@@ -126,8 +140,8 @@ bool creature_tracker::update_pos( const monster &critter, const tripoint_abs_ms
         return ptr.get() == &critter;
     } );
     if( iter != monsters_list.end() ) {
-        monsters_by_location.erase( old_pos );
-        monsters_by_location[new_pos] = *iter;
+        erase_location( old_pos );
+        set_location( new_pos, *iter );
         return true;
     } else {
         // We're changing the x/y/z coordinates of a zombie that hasn't been added
@@ -144,7 +158,7 @@ void creature_tracker::remove_from_location_map( const monster &critter )
 {
     const auto pos_iter = monsters_by_location.find( critter.get_location() );
     if( pos_iter != monsters_by_location.end() && pos_iter->second.get() == &critter ) {
-        monsters_by_location.erase( pos_iter );
+        erase_location( pos_iter );
         return;
     }
 
@@ -155,10 +169,105 @@ void creature_tracker::remove_from_location_map( const monster &critter )
         return v.second.get() == &critter;
     } );
     if( iter != monsters_by_location.end() ) {
-        monsters_by_location.erase( iter );
+        erase_location( iter );
+    }
+}
+
+void creature_tracker::set_location( const tripoint_abs_ms &pos,
+                                     const shared_ptr_fast<monster> &critter )
+{
+    erase_location( pos );
+    monsters_by_location.emplace( pos, critter );
+    monsters_by_submap[project_to<coords::sm>( pos )].push_back( critter );
+    note_creatures_changed();
+}
+
+void creature_tracker::erase_location(
+    const std::unordered_map<tripoint_abs_ms, shared_ptr_fast<monster>>::iterator iter )
+{
+    const auto cell = monsters_by_submap.find( project_to<coords::sm>( iter->first ) );
+    if( cell != monsters_by_submap.end() ) {
+        std::vector<shared_ptr_fast<monster>> &critters = cell->second;
+        const auto it = std::find( critters.begin(), critters.end(), iter->second );
+        if( it != critters.end() ) {
+            critters.erase( it );
+        }
+        if( critters.empty() ) {
+            monsters_by_submap.erase( cell );
+        }
+    }
+    monsters_by_location.erase( iter );
+    note_creatures_changed();
+}
+
+void creature_tracker::erase_location( const tripoint_abs_ms &pos )
+{
+    const auto iter = monsters_by_location.find( pos );
+    if( iter != monsters_by_location.end() ) {
+        erase_location( iter );
+    }
+}
+
+std::vector<shared_ptr_fast<monster>> creature_tracker::find_all_in(
+                                       const inclusive_cuboid<tripoint_abs_ms> &area ) const
+{
+    std::vector<shared_ptr_fast<monster>> result;
+    const auto add_from = [&]( const std::vector<shared_ptr_fast<monster>> &critters ) {
+        for( const shared_ptr_fast<monster> &critter : critters ) {
+            if( !critter->is_dead() && area.contains( critter->get_location() ) ) {
+                result.push_back( critter );
+            }
+        }
+    };
+
+    const tripoint_abs_sm min_sm = project_to<coords::sm>( area.p_min );
+    const tripoint_abs_sm max_sm = project_to<coords::sm>( area.p_max );
+    const tripoint extent = max_sm.raw() - min_sm.raw() + tripoint( 1, 1, 1 );
+    if( static_cast<size_t>( extent.x ) * extent.y * extent.z > monsters_by_submap.size() ) {
+        // Large areas have more submaps than there are submaps with monsters.
+        const inclusive_cuboid<tripoint_abs_sm> area_sm( min_sm, max_sm );
+        for( const auto &[sm, critters] : monsters_by_submap ) {
+            if( area_sm.contains( sm ) ) {
+                add_from( critters );
+            }
+        }
+        return result;
+    }
+    for( int z = min_sm.z(); z <= max_sm.z(); z++ ) {
+        for( int y = min_sm.y(); y <= max_sm.y(); y++ ) {
+            for( int x = min_sm.x(); x <= max_sm.x(); x++ ) {
+                const auto cell = monsters_by_submap.find( tripoint_abs_sm( x, y, z ) );
+                if( cell != monsters_by_submap.end() ) {
+                    add_from( cell->second );
+                }
+            }
+        }
+    }
+    return result;
+}
+
+void creature_tracker::for_each_in_rect( const inclusive_cuboid<tripoint_abs_ms> &area,
+        const std::function<void( monster & )> &visit_fn ) const
+{
+    for( const shared_ptr_fast<monster> &critter : find_all_in( area ) ) {
+        if( !critter->is_dead() ) {
+            visit_fn( *critter );
+        }
     }
 }
 
+void creature_tracker::for_each_in_radius( const tripoint_abs_ms &center, const int radius,
+        const std::function<void( monster & )> &visit_fn ) const
+{
+    const tripoint offset( radius, radius, radius );
+    for_each_in_rect( inclusive_cuboid<tripoint_abs_ms>( center - offset, center + offset ),
+    [&]( monster & critter ) {
+        if( rl_dist( center, critter.get_location() ) <= radius ) {
+            visit_fn( critter );
+        }
+    } );
+}
+
 void creature_tracker::remove( const monster &critter )
 {
     const auto iter = std::find_if( monsters_list.begin(), monsters_list.end(),
@@ -179,16 +288,19 @@ void creature_tracker::clear()
 {
     monsters_list.clear();
     monsters_by_location.clear();
+    monsters_by_submap.clear();
     removed_this_turn_.clear();
     creatures_by_zone_and_faction_.clear();
     invalidate_reachability_cache();
+    sight_memo::clear();
 }
 
 void creature_tracker::rebuild_cache()
 {
     monsters_by_location.clear();
+    monsters_by_submap.clear();
     for( const shared_ptr_fast<monster> &mon_ptr : monsters_list ) {
-        monsters_by_location[mon_ptr->get_location()] = mon_ptr;
+        set_location( mon_ptr->get_location(), mon_ptr );
     }
 }
 
@@ -231,13 +343,13 @@ void creature_tracker::swap_positions( monster &first, monster &second )
     shared_ptr_fast<monster> first_ptr;
     if( first_iter != monsters_by_location.end() ) {
         first_ptr = first_iter->second;
-        monsters_by_location.erase( first_iter );
+        erase_location( first_iter );
     }
 
     shared_ptr_fast<monster> second_ptr;
     if( second_iter != monsters_by_location.end() ) {
         second_ptr = second_iter->second;
-        monsters_by_location.erase( second_iter );
+        erase_location( second_iter );
     }
     // implied: (first_ptr != second_ptr) or (first_ptr == nullptr && second_ptr == nullptr)
 
@@ -247,10 +359,10 @@ void creature_tracker::swap_positions( monster &first, monster &second )
 
     // If the pointers have been taken out of the list, put them back in.
     if( first_ptr ) {
-        monsters_by_location[first.get_location()] = first_ptr;
+        set_location( first.get_location(), first_ptr );
     }
     if( second_ptr ) {
-        monsters_by_location[second.get_location()] = second_ptr;
+        set_location( second.get_location(), second_ptr );
     }
 }
 
@@ -259,6 +371,13 @@ bool creature_tracker::kill_marked_for_death()
     // Important: `Creature::die` must not be called after creature objects (NPCs, monsters) have
     // been removed, the dying creature could still have a pointer (the killer) to another creature.
     bool monster_is_dead = false;
+    // Called after every player action, almost always with nobody dead
+    if( std::none_of( monsters_list.begin(), monsters_list.end(),
+    []( const shared_ptr_fast<monster> &mon_ptr ) {
+    return mon_ptr->is_dead();
+    } ) ) {
+        return monster_is_dead;
+    }
     // Copy the list so we can iterate the copy safely *and* add new monsters from within monster::die
     // This happens for example with blob monsters (they split into two smaller monsters).
     const auto copy = monsters_list;
@@ -281,16 +400,18 @@ bool creature_tracker::kill_marked_for_death()
 void creature_tracker::remove_dead()
 {
     // Can't use game::all_monsters() as it would not contain *dead* monsters.
-    for( auto iter = monsters_list.begin(); iter != monsters_list.end(); ) {
-        monster *const critter = iter->get();
-        if( critter->is_dead() ) {
-            remove_from_location_map( *critter );
-            iter = monsters_list.erase( iter );
-        } else {
-            ++iter;
+    // One pass over the list, erasing one by one is quadratic when many died at once.
+    monsters_list.erase( std::remove_if( monsters_list.begin(), monsters_list.end(),
+    [this]( const shared_ptr_fast<monster> &mon_ptr ) {
+        if( !mon_ptr->is_dead() ) {
+            return false;
         }
-    }
+        remove_from_location_map( *mon_ptr );
+        return true;
+    } ), monsters_list.end() );
     removed_this_turn_.clear();
+    // Freed monsters may be replaced by new ones at the same address.
+    sight_memo::clear();
 }
 
 template<typename T>
@@ -364,6 +485,9 @@ void creature_tracker::flood_fill_zone( const Creature &origin )
     }
 
     map &map = get_map();
+    // Every zone is filled separately each turn, so the working memory is kept between fills
+    static std::unique_ptr<ff::flood_fill_scratch> scratch =
+        std::make_unique<ff::flood_fill_scratch>();
     ff::flood_fill_visit_10_connected( origin.pos_bub(),
     [&map]( const tripoint_bub_ms & loc, int direction ) {
         if( direction == 0 ) {
@@ -411,7 +535,7 @@ void creature_tracker::flood_fill_zone( const Creature &origin )
                 creature->set_reachable_zone( n );
             }
         }
-    } );
+    }, *scratch );
     if( zone_number_ == std::numeric_limits<int>::max() ) {
         zone_number_ = 1;
     } else {
@@ -3,6 +3,7 @@
 #define CATA_SRC_CREATURE_TRACKER_H
 
 #include <cstddef>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -12,6 +13,7 @@
 
 #include "coordinates.h"
 #include "creature.h"
+#include "cuboid_rectangle.h"
 #include "memory_fast.h"
 #include "point.h"
 #include "type_id.h"
@@ -87,6 +89,8 @@ class creature_tracker
          * another monster at the location of the new monster.
          */
         bool add( const shared_ptr_fast<monster> &critter );
+        /** Makes room for @p count more monsters, before adding many at once. */
+        void reserve( size_t count );
         size_t size() const;
         /** Updates the position of the given monster to the given point. Returns whether the operation
          *  was successful. */
@@ -130,6 +134,26 @@ class creature_tracker
             return monsters_list;
         }
 
+        /**
+         * Returns the living monsters inside @p area. Only the monsters on the submaps
+         * overlapping it are looked at, so this is much cheaper than going through all the
+         * monsters for small areas.
+         */
+        std::vector<shared_ptr_fast<monster>> find_all_in( const inclusive_cuboid<tripoint_abs_ms> &area )
+                                           const;
+        /**
+         * Visits the living monsters inside @p area.
+         * The monsters are collected before the first one is visited, so @p visit_fn may move,
+         * add or kill monsters. Monsters that die before their turn are skipped.
+         */
+        void for_each_in_rect( const inclusive_cuboid<tripoint_abs_ms> &area,
+                               const std::function<void( monster & )> &visit_fn ) const;
+        /**
+         * Like @ref for_each_in_rect, for the monsters within @p radius (by rl_dist) of @p center.
+         */
+        void for_each_in_radius( const tripoint_abs_ms &center, int radius,
+                                 const std::function<void( monster & )> &visit_fn ) const;
+
         void serialize( JsonOut &jsout ) const;
         void deserialize( const JsonArray &ja );
 
@@ -140,9 +164,26 @@ class creature_tracker
             dirty_ = true;
         }
 
+        /**
+         * Changes whenever a creature moves or dies, or a monster is added to or removed from
+         * the tracker. Caches that depend on where the creatures around are can compare it to
+         * tell whether they have to be redone.
+         */
+        unsigned int creatures_version() const {
+            return creatures_version_;
+        }
+        void note_creatures_changed() {
+            ++creatures_version_;
+        }
+
     private:
         /** Remove the monsters entry in @ref monsters_by_location */
         void remove_from_location_map( const monster &critter );
+        /** Puts @p critter into @ref monsters_by_location at @p pos, replacing whatever was there. */
+        void set_location( const tripoint_abs_ms &pos, const shared_ptr_fast<monster> &critter );
+        /** Erases an entry of @ref monsters_by_location. */
+        void erase_location( std::unordered_map<tripoint_abs_ms, shared_ptr_fast<monster>>::iterator iter );
+        void erase_location( const tripoint_abs_ms &pos );
 
         void flood_fill_zone( const Creature &origin );
 
@@ -155,6 +196,9 @@ class creature_tracker
         std::vector<shared_ptr_fast<monster>> monsters_list;
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<tripoint_abs_ms, shared_ptr_fast<monster>> monsters_by_location;
+        // The entries of monsters_by_location grouped by submap, for find_all_in.
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<tripoint_abs_sm, std::vector<shared_ptr_fast<monster>>> monsters_by_submap;
 
         /**
          * Creatures that get removed via @ref remove are stored here until the end of the turn.
@@ -168,6 +212,7 @@ class creature_tracker
         bool dirty_ = true;  // NOLINT(cata-serialize)
         int zone_tick_ = 1;  // NOLINT(cata-serialize)
         int zone_number_ = 0;  // NOLINT(cata-serialize)
+        unsigned int creatures_version_ = 0;  // NOLINT(cata-serialize)
         std::unordered_map<int, std::unordered_map<mfaction_id, std::vector<shared_ptr_fast<Creature>>>>
         creatures_by_zone_and_faction_;  // NOLINT(cata-serialize)
 
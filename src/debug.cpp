@@ -6,7 +6,9 @@
 // IWYU pragma: no_include <sys/unistd.h>
 #include <clocale>
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
@@ -16,6 +18,7 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <optional>
 #include <regex>
@@ -49,6 +52,12 @@
 #include <sys/time.h>
 #endif
 
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#else
+#   include <thread>
+#endif
+
 #if defined(_WIN32)
 #   if 1 // HACK: Hack to prevent reordering of #include "platform_win.h" by IWYU
 #       include "platform_win.h"
@@ -629,6 +638,142 @@ static time_info get_time() noexcept
 }
 #endif
 
+/**
+ * Stream buffer that hands the log text to a background thread, which writes it to the file.
+ *
+ * Log entries start with std::endl, so writing straight to the file flushed it for every
+ * entry. Here a flush only moves the text to the writer thread. If the writer can't keep up,
+ * the text is dropped instead of blocking the game, and the number of dropped bytes is noted
+ * in the log.
+ */
+class async_log_buf : public std::streambuf
+{
+    public:
+        explicit async_log_buf( const std::string &filename ) :
+            file( fs::u8path( filename ), std::ios::out | std::ios::app ) {
+            setp( buffer.data(), buffer.data() + buffer.size() );
+            writer = std::thread( &async_log_buf::thread_loop, this );
+        }
+        ~async_log_buf() override {
+            hand_over();
+            {
+                std::lock_guard<std::mutex> lock( mut );
+                stopping = true;
+            }
+            text_ready.notify_one();
+            writer.join();
+        }
+
+        async_log_buf( const async_log_buf & ) = delete;
+        async_log_buf &operator=( const async_log_buf & ) = delete;
+
+        /** Writes all text on the calling thread, for when the writer thread can't be relied on. */
+        void write_now() {
+            hand_over();
+            std::lock_guard<std::mutex> file_lock( file_mut );
+            std::lock_guard<std::mutex> lock( mut );
+            write_out( pending, dropped );
+            pending.clear();
+            dropped = 0;
+        }
+
+    protected:
+        int_type overflow( int_type ch ) override {
+            hand_over();
+            if( !traits_type::eq_int_type( ch, traits_type::eof() ) ) {
+                *pptr() = traits_type::to_char_type( ch );
+                pbump( 1 );
+            }
+            return traits_type::not_eof( ch );
+        }
+        int sync() override {
+            hand_over();
+            return 0;
+        }
+
+    private:
+        // Text not yet taken by the writer thread beyond this is dropped
+        static constexpr size_t max_pending = 16 * 1024 * 1024;
+
+        void hand_over() {
+            const size_t size = pptr() - pbase();
+            if( size == 0 ) {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock( mut );
+                if( pending.size() + size > max_pending ) {
+                    dropped += size;
+                } else {
+                    pending.append( pbase(), size );
+                }
+            }
+            setp( buffer.data(), buffer.data() + buffer.size() );
+            text_ready.notify_one();
+        }
+
+        // Expects file_mut to be held.
+        void write_out( const std::string &text, size_t dropped_bytes ) {
+            if( dropped_bytes > 0 ) {
+                file << "\n[ " << dropped_bytes << " bytes of log output were dropped ]";
+            }
+            file << text;
+            file.flush();
+        }
+
+        void thread_loop() {
+            std::string text;
+            std::unique_lock<std::mutex> lock( mut );
+            while( true ) {
+                text_ready.wait( lock, [this]() {
+                    return stopping || !pending.empty() || dropped > 0;
+                } );
+                if( pending.empty() && dropped == 0 ) {
+                    return;
+                }
+                text.swap( pending );
+                const size_t dropped_bytes = dropped;
+                dropped = 0;
+                lock.unlock();
+                {
+                    std::lock_guard<std::mutex> file_lock( file_mut );
+                    write_out( text, dropped_bytes );
+                }
+                text.clear();
+                lock.lock();
+            }
+        }
+
+        std::ofstream file;
+        // Held while writing to the file, so write_now doesn't interleave with the writer thread
+        std::mutex file_mut;
+        std::array<char, 4096> buffer;
+
+        std::mutex mut;
+        std::condition_variable text_ready;
+        std::string pending;
+        size_t dropped = 0;
+        bool stopping = false;
+
+        std::thread writer;
+};
+
+class async_log_file : public std::ostream
+{
+    public:
+        explicit async_log_file( const std::string &filename ) :
+            std::ostream( nullptr ), buf( filename ) {
+            rdbuf( &buf );
+        }
+
+        void write_now() {
+            buf.write_now();
+        }
+
+    private:
+        async_log_buf buf;
+};
+
 struct DebugFile {
     DebugFile();
     ~DebugFile();
@@ -702,8 +847,7 @@ void DebugFile::init( DebugOutput output_mode, const std::string &filename )
                     rename_failed = !rename_file( filename, oldfile );
                 }
             }
-            file = std::make_shared<std::ofstream>(
-                       fs::u8path( filename ), std::ios::out | std::ios::app );
+            file = std::make_shared<async_log_file>( filename );
             *file << "\n\n-----------------------------------------\n";
             *file << get_time() << " : Starting log.";
             DebugLog( D_INFO, D_MAIN ) << "Cataclysm DDA version " << getVersionString();
@@ -781,6 +925,15 @@ void deinitDebug()
     debugFile().deinit();
 }
 
+void flushDebugLog()
+{
+    if( async_log_file *file = dynamic_cast<async_log_file *>( debugFile().file.get() ) ) {
+        file->write_now();
+    } else if( debugFile().file ) {
+        debugFile().file->flush();
+    }
+}
+
 // OStream Operators                                                {{{2
 // ---------------------------------------------------------------------
 
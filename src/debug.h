@@ -184,6 +184,11 @@ enum class DebugOutput : int {
 void setupDebug( DebugOutput );
 /** Opposite of setupDebug, shuts the debugging system down. */
 void deinitDebug();
+/**
+ * Writes all buffered log output to the log file on the calling thread. Used when crashing,
+ * as the thread that normally writes the log might not get to it.
+ */
+void flushDebugLog();
 
 // Function Declarations                                            {{{1
 // ---------------------------------------------------------------------
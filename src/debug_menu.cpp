@@ -71,6 +71,7 @@
 #include "mapgen.h"
 #include "mapgendata.h"
 #include "martialarts.h"
+#include "memory_accounting.h"
 #include "memory_fast.h"
 #include "messages.h"
 #include "mission.h"
@@ -90,6 +91,7 @@
 #include "pimpl.h"
 #include "point.h"
 #include "popup.h"
+#include "profile_zones.h"
 #include "recipe_dictionary.h"
 #include "relic.h"
 #include "skill.h"
@@ -228,6 +230,8 @@ std::string enum_to_string<debug_menu::debug_menu_index>( debug_menu::debug_menu
         case debug_menu::debug_menu_index::DISPLAY_TRANSPARENCY: return "DISPLAY_TRANSPARENCY";
         case debug_menu::debug_menu_index::DISPLAY_RADIATION: return "DISPLAY_RADIATION";
         case debug_menu::debug_menu_index::HOUR_TIMER: return "HOUR_TIMER";
+        case debug_menu::debug_menu_index::PROFILE_ZONES: return "PROFILE_ZONES";
+        case debug_menu::debug_menu_index::MEMORY_USAGE: return "MEMORY_USAGE";
         case debug_menu::debug_menu_index::CHANGE_SPELLS: return "CHANGE_SPELLS";
         case debug_menu::debug_menu_index::TEST_MAP_EXTRA_DISTRIBUTION: return "TEST_MAP_EXTRA_DISTRIBUTION";
         case debug_menu::debug_menu_index::NESTED_MAPGEN: return "NESTED_MAPGEN";
@@ -479,6 +483,8 @@ static int info_uilist( bool display_all_entries = true )
             { uilist_entry( debug_menu_index::SHOW_MUT_CAT, true, 'm', _( "Show mutation category levels" ) ) },
             { uilist_entry( debug_menu_index::BENCHMARK, true, 'b', _( "Draw benchmark (X seconds)" ) ) },
             { uilist_entry( debug_menu_index::HOUR_TIMER, true, 'E', _( "Toggle hour timer" ) ) },
+            { uilist_entry( debug_menu_index::PROFILE_ZONES, true, 'P', _( "Turn profiling…" ) ) },
+            { uilist_entry( debug_menu_index::MEMORY_USAGE, true, 'u', _( "Show memory usage estimates" ) ) },
             { uilist_entry( debug_menu_index::TRAIT_GROUP, true, 't', _( "Test trait group" ) ) },
             { uilist_entry( debug_menu_index::DISPLAY_NPC_PATH, true, 'n', _( "Toggle NPC pathfinding on map" ) ) },
             { uilist_entry( debug_menu_index::DISPLAY_NPC_ATTACK, true, 'A', _( "Toggle NPC attack potential values on map" ) ) },
@@ -2581,6 +2587,48 @@ static void draw_benchmark( const int max_difference )
              difference / 1000.0, 1000.0 * draw_counter / static_cast<double>( difference ) );
 }
 
+static void debug_menu_profile_zones()
+{
+    enum {
+        PZ_TOGGLE, PZ_REPORT, PZ_TRACE, PZ_WRITE_TRACE, PZ_RESET
+    };
+    uilist pzmenu;
+    pzmenu.title = _( "Turn profiling" );
+    pzmenu.addentry( PZ_TOGGLE, true, 'e', profile_zones::enabled() ?
+                     _( "Disable profiling" ) : _( "Enable profiling" ) );
+    pzmenu.addentry( PZ_REPORT, true, 'r', _( "Show per-turn timings" ) );
+    pzmenu.addentry( PZ_TRACE, true, 't', profile_zones::tracing() ?
+                     _( "Stop recording trace" ) : _( "Start recording trace" ) );
+    pzmenu.addentry( PZ_WRITE_TRACE, true, 'w', _( "Write trace to profile_trace.json" ) );
+    pzmenu.addentry( PZ_RESET, true, 'c', _( "Clear collected timings" ) );
+    pzmenu.query();
+    switch( pzmenu.ret ) {
+        case PZ_TOGGLE:
+            profile_zones::set_enabled( !profile_zones::enabled() );
+            add_msg( m_info, profile_zones::enabled() ? _( "Turn profiling enabled." ) :
+                     _( "Turn profiling disabled." ) );
+            break;
+        case PZ_REPORT:
+            popup_top( "%s", profile_zones::report() );
+            break;
+        case PZ_TRACE:
+            profile_zones::set_tracing( !profile_zones::tracing() );
+            break;
+        case PZ_WRITE_TRACE: {
+            const cata_path path = PATH_INFO::config_dir_path() / "profile_trace.json";
+            if( profile_zones::write_trace( path ) ) {
+                popup( _( "Trace written to %s" ), path.generic_u8string() );
+            }
+            break;
+        }
+        case PZ_RESET:
+            profile_zones::reset();
+            break;
+        default:
+            break;
+    }
+}
+
 static void debug_menu_game_state()
 {
     avatar &player_character = get_avatar();
@@ -2821,6 +2869,8 @@ void debug()
         debug_menu_index::ENABLE_ACHIEVEMENTS,
         debug_menu_index::UNLOCK_ALL,
         debug_menu_index::BENCHMARK,
+        debug_menu_index::PROFILE_ZONES,
+        debug_menu_index::MEMORY_USAGE,
         debug_menu_index::SHOW_MSG,
         debug_menu_index::QUICKLOAD,
         debug_menu_index::QUIT_NOSAVE,
@@ -3271,6 +3321,12 @@ void debug()
         case debug_menu_index::HOUR_TIMER:
             g->toggle_debug_hour_timer();
             break;
+        case debug_menu_index::PROFILE_ZONES:
+            debug_menu_profile_zones();
+            break;
+        case debug_menu_index::MEMORY_USAGE:
+            popup_top( "%s", memory_accounting::report() );
+            break;
         case debug_menu_index::CHANGE_TIME:
             calendar::turn = calendar_ui::select_time_point( calendar::turn );
             break;
@@ -83,6 +83,8 @@ enum class debug_menu_index : int {
     DISPLAY_TRANSPARENCY,
     DISPLAY_RADIATION,
     HOUR_TIMER,
+    PROFILE_ZONES,
+    MEMORY_USAGE,
     CHANGE_SPELLS,
     TEST_MAP_EXTRA_DISTRIBUTION,
     NESTED_MAPGEN,
@@ -5,6 +5,7 @@
 #include <functional>
 #include <iosfwd>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <type_traits>
@@ -384,7 +385,13 @@ class json_talk_response
          * Callback from @ref json_talk_topic::gen_responses, see there.
          */
         bool gen_responses( dialogue &d, bool switch_done ) const;
-        bool gen_repeat_response( dialogue &d, const itype_id &item_id, bool switch_done ) const;
+        /**
+         * Adds the response for @p item_id to @p repeated. The condition doesn't depend on the
+         * item, so it is tested once and kept in @p condition_met for the following items.
+         */
+        bool gen_repeat_response( dialogue &d, const itype_id &item_id, bool switch_done,
+                                  std::optional<bool> &condition_met,
+                                  std::vector<talk_response> &repeated ) const;
 };
 
 /**
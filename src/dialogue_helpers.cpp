@@ -9,13 +9,13 @@ std::optional<std::string> maybe_read_var_value( const var_info &info, const dia
     global_variables &globvars = get_globals();
     switch( info.type ) {
         case var_type::global:
-            return globvars.maybe_get_global_value( info.name );
+            return globvars.maybe_get_global_value( info.key );
         case var_type::context:
             return d.maybe_get_value( info.name );
         case var_type::u:
-            return d.actor( false )->maybe_get_value( info.name );
+            return d.actor( false )->maybe_get_var( info.key );
         case var_type::npc:
-            return d.actor( true )->maybe_get_value( info.name );
+            return d.actor( true )->maybe_get_var( info.key );
         case var_type::var: {
             std::optional<std::string> const var_val = d.maybe_get_value( info.name );
             return var_val ? maybe_read_var_value( process_variable( *var_val ), d ) : std::nullopt;
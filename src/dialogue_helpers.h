@@ -22,13 +22,15 @@ struct dbl_or_var;
 
 struct var_info {
     var_info( var_type in_type, std::string in_name ): type( in_type ),
-        name( std::move( in_name ) ) {}
+        name( std::move( in_name ) ), key( name ) {}
     var_info( var_type in_type, std::string in_name, std::string in_default_val ): type( in_type ),
-        name( std::move( in_name ) ), default_val( std::move( in_default_val ) ) {}
+        name( std::move( in_name ) ), default_val( std::move( in_default_val ) ), key( name ) {}
     var_info() : type( var_type::global ) {}
     var_type type;
     std::string name;
     std::string default_val;
+    // name, interned when the var_info is made; rebuild the var_info to change the name
+    var_key key;
 };
 
 template<class T>
@@ -683,7 +683,7 @@ bool diary::store()
 {
     std::string name = base64_encode( get_avatar().get_save_id() + "_diary" );
     std::string path = PATH_INFO::world_base_save_path() +  "/" + name + ".json";
-    const bool iswriten = write_to_file( path, [&]( std::ostream & fout ) {
+    const bool iswriten = write_to_file_if_changed( path, [&]( std::ostream & fout ) {
         serialize( fout );
     }, _( "diary data" ) );
     return iswriten;
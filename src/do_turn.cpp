@@ -1,5 +1,11 @@
 #include "do_turn.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
 #if defined(EMSCRIPTEN)
 #include <emscripten.h>
 #endif
@@ -9,6 +15,8 @@
 #include "bionics.h"
 #include "cached_options.h"
 #include "calendar.h"
+#include "creature_tracker.h"
+#include "cuboid_rectangle.h"
 #include "event_bus.h"
 #include "explosion.h"
 #include "game.h"
@@ -16,12 +24,17 @@
 #include "help.h"
 #include "input.h"
 #include "input_context.h"
+#include "input_replay.h"
+#include "line.h"
 #include "make_static.h"
 #include "map.h"
 #include "mapbuffer.h"
+#include "mapgen_queue.h"
 #include "memorial_logger.h"
 #include "messages.h"
 #include "mission.h"
+#include "monfaction.h"
+#include "monster.h"
 #include "mtype.h"
 #include "music.h"
 #include "npc.h"
@@ -29,6 +42,7 @@
 #include "output.h"
 #include "overmapbuffer.h"
 #include "popup.h"
+#include "profile_zones.h"
 #include "scent_map.h"
 #include "sdlsound.h"
 #include "stats_tracker.h"
@@ -53,6 +67,12 @@ static const event_statistic_id event_statistic_last_words( "last_words" );
 
 static const trait_id trait_HAS_NEMESIS( "HAS_NEMESIS" );
 
+static const option_handle<std::string> opt_eternal_weather( "ETERNAL_WEATHER" );
+static const option_handle<bool> opt_wander_spawns( "WANDER_SPAWNS" );
+static const option_handle<bool> opt_autosave( "AUTOSAVE" );
+static const option_handle<int> opt_autosave_turns( "AUTOSAVE_TURNS" );
+static const option_handle<bool> opt_force_redraw( "FORCE_REDRAW" );
+
 #if defined(__ANDROID__)
 extern std::map<std::string, std::list<input_event>> quick_shortcuts_map;
 extern bool add_best_key_for_action_to_quick_shortcuts( action_id action,
@@ -223,12 +243,100 @@ void handle_key_blocking_activity()
 
 namespace
 {
+// Traces the lines of sight the monsters are about to check while planning their moves, while
+// nothing has moved yet, so plan() mostly finds them in the map's cache. Only the sight lines
+// are done up front; plan() itself changes the monster and has to run in order.
+void prime_monster_sight( map &m )
+{
+    const float daylight = default_daylight_level();
+    std::vector<std::pair<tripoint, tripoint>> lines;
+    creature_tracker &creatures = get_creature_tracker();
+    for( monster &critter : g->all_monsters() ) {
+        if( critter.is_dead() || critter.moves <= 0 || critter.has_effect( effect_ridden ) ||
+            critter.has_effect( effect_controlled ) ) {
+            continue;
+        }
+        const tripoint pos = critter.pos();
+        const int range = std::min( MAX_VIEW_DISTANCE,
+                                    std::max( critter.sight_range( daylight ), critter.sight_range( 0.0f ) ) );
+        const auto add_line = [&]( const Creature & other ) {
+            const int dist = rl_dist( pos, other.pos() );
+            if( dist > 1 && dist <= range ) {
+                lines.emplace_back( pos, other.pos() );
+            }
+        };
+        const auto hostile = [&critter]( const mfaction_id & other ) {
+            const mf_attitude att = critter.faction.obj().attitude( other );
+            return att != MFA_NEUTRAL && att != MFA_FRIENDLY;
+        };
+        if( critter.scans_for_targets() ) {
+            const tripoint_abs_ms center = critter.get_location();
+            const inclusive_cuboid<tripoint_abs_ms> area( center - tripoint( range, range, 0 ),
+                    center + tripoint( range, range, 0 ) );
+            for( const shared_ptr_fast<monster> &other : creatures.find_all_in( area ) ) {
+                if( other.get() != &critter && hostile( other->faction ) ) {
+                    add_line( *other );
+                }
+            }
+        }
+        for( const npc &guy : g->all_npcs() ) {
+            if( guy.posz() == pos.z && hostile( guy.get_monster_faction() ) ) {
+                add_line( guy );
+            }
+        }
+    }
+    m.prime_sees_cache( lines );
+}
+
+// Same for the NPCs, which look at every creature around them when assessing danger. Done
+// after the monsters have moved, so the lines start from where they ended up.
+void prime_npc_sight( map &m )
+{
+    const float daylight = default_daylight_level();
+    const Character &player_character = get_player_character();
+    std::vector<std::pair<tripoint, tripoint>> lines;
+    creature_tracker &creatures = get_creature_tracker();
+    for( const npc &guy : g->all_npcs() ) {
+        if( guy.is_dead() || guy.moves <= 0 ) {
+            continue;
+        }
+        const tripoint pos = guy.pos();
+        const int range = std::min( MAX_VIEW_DISTANCE,
+                                    std::max( guy.sight_range( daylight ), guy.sight_range( 0.0f ) ) );
+        const auto add_line = [&]( const Creature & other ) {
+            const int dist = rl_dist( pos, other.pos() );
+            if( dist > 1 && dist <= range ) {
+                lines.emplace_back( pos, other.pos() );
+            }
+        };
+        const tripoint_abs_ms center = guy.get_location();
+        const inclusive_cuboid<tripoint_abs_ms> area( center - tripoint( range, range, 0 ),
+                center + tripoint( range, range, 0 ) );
+        for( const shared_ptr_fast<monster> &critter : creatures.find_all_in( area ) ) {
+            add_line( *critter );
+        }
+        for( const npc &other : g->all_npcs() ) {
+            if( &other != &guy && other.posz() == pos.z ) {
+                add_line( other );
+            }
+        }
+        add_line( player_character );
+    }
+    m.prime_sees_cache( lines );
+}
+
 void monmove()
 {
+    CATA_PROFILE_ZONE( profile_zones::zone::monmove );
     g->cleanup_dead();
     map &m = get_map();
     avatar &u = get_avatar();
 
+    if( parallel_monster_planning ) {
+        prime_monster_sight( m );
+    }
+
+    const bool new_day = calendar::once_every( 1_days );
     for( monster &critter : g->all_monsters() ) {
         // Critters in impassable tiles get pushed away, unless it's not impassable for them
         if( !critter.is_dead() && m.impassable( critter.pos() ) && !critter.can_move_to( critter.pos() ) ) {
@@ -258,13 +366,16 @@ void monmove()
         }
 
         m.creature_in_field( critter );
-        if( calendar::once_every( 1_days ) ) {
+        if( new_day ) {
             if( critter.has_flag( mon_flag_MILKABLE ) ) {
                 critter.refill_udders();
             }
             critter.try_biosignature();
             critter.try_reproduce();
         }
+        if( dormant_monsters && !critter.is_dead() && critter.skip_dormant_turn() ) {
+            critter.moves = 0;
+        }
         while( critter.moves > 0 && !critter.is_dead() && !critter.has_effect( effect_ridden ) ) {
             critter.made_footstep = false;
             // Controlled critters don't make their own plans
@@ -280,11 +391,12 @@ void monmove()
             m.creature_in_field( critter );
         }
 
+        // Cheap per-monster checks first, the bionic lookup scans all of the avatar's bionics
         if( !critter.is_dead() &&
-            u.has_active_bionic( bio_alarm ) &&
-            u.get_power_level() >= bio_alarm->power_trigger &&
+            !critter.is_hallucination() &&
             rl_dist( u.pos(), critter.pos() ) <= 5 &&
-            !critter.is_hallucination() ) {
+            u.has_active_bionic( bio_alarm ) &&
+            u.get_power_level() >= bio_alarm->power_trigger ) {
             u.mod_power_level( -bio_alarm->power_trigger );
             add_msg( m_warning, _( "Your motion alarm goes off!" ) );
             g->cancel_activity_or_ignore_query( distraction_type::motion_alarm,
@@ -302,6 +414,10 @@ void monmove()
     // monster::die function is not called.
     g->despawn_nonlocal_monsters();
 
+    if( parallel_monster_planning ) {
+        prime_npc_sight( m );
+    }
+
     // Now, do active NPCs.
     for( npc &guy : g->all_npcs() ) {
         int turns = 0;
@@ -364,18 +480,39 @@ void overmap_npc_move()
             travelling_npcs.push_back( npc_to_add );
         }
     }
+    // Overmap pathfinding is what costs, so only this many npcs plan a route per call. The
+    // others keep waiting with an empty route and go first next time.
+    static constexpr int max_routes_per_move = 4;
+    static size_t first_planner = 0;
+    int routes_left = max_routes_per_move;
+    std::optional<size_t> next_planner;
+    if( first_planner >= travelling_npcs.size() ) {
+        first_planner = 0;
+    }
+    std::rotate( travelling_npcs.begin(), travelling_npcs.begin() + first_planner,
+                 travelling_npcs.end() );
     bool npcs_need_reload = false;
-    for( npc *&elem : travelling_npcs ) {
+    for( size_t i = 0; i < travelling_npcs.size(); ++i ) {
+        npc *elem = travelling_npcs[i];
         if( elem->has_omt_destination() ) {
             if( !elem->omt_path.empty() ) {
-                if( rl_dist( elem->omt_path.back(), elem->global_omt_location() ) > 2 ) {
+                if( rl_dist( elem->omt_path.back(), elem->global_omt_location() ) > 2 ||
+                    elem->omt_path.front() != elem->goal ) {
                     // recalculate path, we got distracted doing something else probably
+                    // or are headed somewhere else now
                     elem->omt_path.clear();
                 } else if( elem->omt_path.back() == elem->global_omt_location() ) {
                     elem->omt_path.pop_back();
                 }
             }
+            if( elem->omt_path.empty() && routes_left == 0 ) {
+                if( !next_planner ) {
+                    next_planner = ( first_planner + i ) % travelling_npcs.size();
+                }
+                continue;
+            }
             if( elem->omt_path.empty() ) {
+                routes_left--;
                 elem->omt_path = overmap_buffer.get_travel_path( elem->global_omt_location(), elem->goal,
                                  overmap_path_params::for_npc() );
                 if( elem->omt_path.empty() ) { // goal is unreachable, or already reached goal, reset it
@@ -391,6 +528,7 @@ void overmap_npc_move()
             elem->set_omt_destination();
         }
     }
+    first_planner = next_planner.value_or( 0 );
     if( npcs_need_reload ) {
         g->reload_npcs();
     }
@@ -410,9 +548,9 @@ bool do_turn()
     // Actual stuff
     if( g->new_game ) {
         g->new_game = false;
-        if( get_option<std::string>( "ETERNAL_WEATHER" ) != "normal" ) {
+        if( opt_eternal_weather.get() != "normal" ) {
             weather.weather_override = static_cast<weather_type_id>
-                                       ( get_option<std::string>( "ETERNAL_WEATHER" ) );
+                                       ( opt_eternal_weather.get() );
             weather.set_nextweather( calendar::turn );
         } else {
             weather.weather_override = WEATHER_NULL;
@@ -426,7 +564,7 @@ bool do_turn()
     play_music( music::get_music_id_string() );
 
     // starting a new turn, clear out temperature cache
-    weather.temperature_cache.clear();
+    weather.clear_temp_cache();
 
     if( g->npcs_dirty ) {
         g->load_npcs();
@@ -464,7 +602,7 @@ bool do_turn()
     // Move hordes every 2.5 min
     if( calendar::once_every( time_duration::from_minutes( 2.5 ) ) ) {
 
-        if( get_option<bool>( "WANDER_SPAWNS" ) ) {
+        if( opt_wander_spawns.get() ) {
             overmap_buffer.move_hordes();
         }
         if( u.has_trait( trait_HAS_NEMESIS ) ) {
@@ -480,8 +618,8 @@ bool do_turn()
     u.update_body();
 
     // Auto-save if autosave is enabled
-    if( get_option<bool>( "AUTOSAVE" ) &&
-        calendar::once_every( 1_turns * get_option<int>( "AUTOSAVE_TURNS" ) ) &&
+    if( opt_autosave.get() &&
+        calendar::once_every( 1_turns * opt_autosave_turns.get() ) &&
         !u.is_dead_state() ) {
         g->autosave();
     }
@@ -528,9 +666,10 @@ bool do_turn()
                 explosion_handler::process_explosions();
                 sounds::process_sound_markers( &u );
                 if( !u.activity && g->uquit != QUIT_WATCH
-                    && ( !u.has_distant_destination() || calendar::once_every( 10_seconds ) ) ) {
+                    && ( !u.has_distant_destination() || ( !simulation_priority &&
+                            calendar::once_every( 10_seconds ) ) ) ) {
                     g->wait_popup.reset();
-                    ui_manager::redraw();
+                    ui_manager::redraw_scheduled();
                 }
 
                 if( g->queue_screenshot ) {
@@ -613,10 +752,16 @@ bool do_turn()
     // Apply sounds from previous turn to monster and NPC AI.
     sounds::process_sounds();
     const int levz = m.get_abs_sub().z();
-    // Update vision caches for monsters. If this turns out to be expensive,
-    // consider a stripped down cache just for monsters.
-    m.build_map_cache( levz, true );
-    monmove();
+    // While the player works through an activity with nobody else in the bubble there are
+    // no monsters or NPCs to plan for, so their vision caches and AI pass can wait until
+    // one shows up (spawns earlier this turn are already counted).
+    const bool quiet_activity = u.activity && g->num_creatures() == 1;
+    if( !quiet_activity ) {
+        // Update vision caches for monsters. If this turns out to be expensive,
+        // consider a stripped down cache just for monsters.
+        m.build_map_cache( levz, true );
+        monmove();
+    }
     if( calendar::once_every( 5_minutes ) ) {
         overmap_npc_move();
     }
@@ -636,8 +781,9 @@ bool do_turn()
     }
     g->mon_info_update();
     u.process_turn();
-    if( u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
-        ui_manager::redraw();
+    if( u.moves < 0 && opt_force_redraw.get() &&
+        !( simulation_priority && u.has_distant_destination() ) &&
+        ui_manager::redraw_scheduled() ) {
         refresh_display();
     }
 
@@ -721,6 +867,18 @@ bool do_turn()
     u.power_balance = u.get_power_level() - u.power_prev_turn;
     u.power_prev_turn = u.get_power_level();
 
+    // Hordes react once to all the noise made this turn
+    overmap_buffer.process_horde_signals();
+    // Spread the generation of the map ahead of a fast vehicle over the turns before it
+    // gets there
+    mapgen_queue::process( std::chrono::milliseconds( 10 ) );
+    // Between turns no map but the main one holds on to submaps
+    MAPBUFFER.evict_over_budget();
+    overmap_buffer.evict_over_budget();
+
+    profile_zones::end_turn();
+    input_replay::end_turn();
+
 #if defined(EMSCRIPTEN)
     // This will cause a prompt to be shown if the window is closed, until the
     // game is saved.
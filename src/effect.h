@@ -2,6 +2,8 @@
 #ifndef CATA_SRC_EFFECT_H
 #define CATA_SRC_EFFECT_H
 
+#include <cstdint>
+#include <functional>
 #include <iosfwd>
 #include <map>
 #include <set>
@@ -16,6 +18,7 @@
 #include "effect_source.h"
 #include "flat_set.h"
 #include "hash_utils.h"
+#include "string_id.h"
 #include "translations.h"
 #include "type_id.h"
 
@@ -250,9 +253,31 @@ class effect;
 
 // Inheritance here allows forward declaration of the map in class Creature.
 // Storing body_part as an int_id to make things easier for hash and JSON
+// The members hiding those of std::map keep a bitmask of the effect types present, so that
+// asking for an effect that isn't there, by far the usual answer, needs no map lookup.
+// Add and remove effect types only through them.
 class effects_map : public
     std::map<efftype_id, std::map<bodypart_id, effect>>
 {
+        using base = std::map<efftype_id, std::map<bodypart_id, effect>>;
+    public:
+        std::map<bodypart_id, effect> &operator[]( const efftype_id &id );
+        size_type erase( const efftype_id &id );
+        iterator erase( const_iterator it );
+        void clear();
+
+        /** False if there is certainly no effect of type @p id, true if there may be one. */
+        bool may_contain( const efftype_id &id ) const {
+            return ( present & bit( id ) ) != 0;
+        }
+
+    private:
+        static std::uint64_t bit( const efftype_id &id ) {
+            return std::uint64_t( 1 ) << ( std::hash<efftype_id>()( id ) & 63 );
+        }
+        void update_present();
+
+        std::uint64_t present = 0;
 };
 
 class effect
@@ -442,6 +467,40 @@ class effect
 
 };
 
+inline std::map<bodypart_id, effect> &effects_map::operator[]( const efftype_id &id )
+{
+    present |= bit( id );
+    return base::operator[]( id );
+}
+
+inline effects_map::size_type effects_map::erase( const efftype_id &id )
+{
+    const size_type erased = base::erase( id );
+    update_present();
+    return erased;
+}
+
+inline effects_map::iterator effects_map::erase( const_iterator it )
+{
+    const iterator next = base::erase( it );
+    update_present();
+    return next;
+}
+
+inline void effects_map::clear()
+{
+    base::clear();
+    present = 0;
+}
+
+inline void effects_map::update_present()
+{
+    present = 0;
+    for( const value_type &elem : *this ) {
+        present |= bit( elem.first );
+    }
+}
+
 void load_effect_type( const JsonObject &jo );
 void reset_effect_types();
 const std::map<efftype_id, effect_type> &get_effect_types();
@@ -148,15 +148,14 @@ static void process_new_eocs( queued_eocs &eoc_queue,
                               std::map<effect_on_condition_id, bool> &new_eocs, bool global_queue )
 {
     queued_eocs temp_queued_eocs;
-    while( !eoc_queue.empty() ) {
+    for( const queued_eoc &queued : eoc_queue.list ) {
         // Check if EoC is moved from global to local, or vice versa
-        if( global_queue == eoc_queue.top().eoc->global ) {
-            if( eoc_queue.top().eoc.is_valid() ) {
-                temp_queued_eocs.push( eoc_queue.top() );
+        if( global_queue == queued.eoc->global ) {
+            if( queued.eoc.is_valid() ) {
+                temp_queued_eocs.push( queued );
             }
-            new_eocs[eoc_queue.top().eoc] = false;
+            new_eocs[queued.eoc] = false;
         }
-        eoc_queue.pop();
     }
     eoc_queue = std::move( temp_queued_eocs );
     for( auto eoc = eoc_vector.begin();
@@ -216,37 +215,39 @@ static void process_eocs( queued_eocs &eoc_queue, std::vector<effect_on_conditio
     static std::vector<queued_eocs::storage_iter> eocs_to_queue;
     eocs_to_queue.clear();
 
-    while( !eoc_queue.empty() &&
-           eoc_queue.top().time <= calendar::turn ) {
-        queued_eocs::storage_iter it = eoc_queue.queue.top();
-        queued_eoc &top = *it;
-        eoc_queue.queue.pop();
+    // EOCs run here may queue more EOCs that are already due, so keep going until
+    // nothing due is left
+    for( std::vector<queued_eocs::storage_iter> due = eoc_queue.take_due( calendar::turn );
+         !due.empty(); due = eoc_queue.take_due( calendar::turn ) ) {
+        for( const queued_eocs::storage_iter &it : due ) {
+            queued_eoc &top = *it;
 
-        dialogue nested_d{ d };
-        for( const auto &val : top.context ) {
-            nested_d.set_value( val.first, val.second );
-        }
-        bool activated = top.eoc->activate( nested_d );
-        if( top.eoc->type == eoc_type::RECURRING ) {
-            if( activated ) { // It worked so add it back
-                it->time = calendar::turn + next_recurrence( top.eoc, d );
-                eocs_to_queue.emplace_back( it );
-            } else {
-                if( !top.eoc->check_deactivate(
-                        nested_d ) ) { // It failed but shouldn't be deactivated so add it back
+            dialogue nested_d{ d };
+            for( const auto &val : top.context ) {
+                nested_d.set_value( val.first, val.second );
+            }
+            bool activated = top.eoc->activate( nested_d );
+            if( top.eoc->type == eoc_type::RECURRING ) {
+                if( activated ) { // It worked so add it back
                     it->time = calendar::turn + next_recurrence( top.eoc, d );
                     eocs_to_queue.emplace_back( it );
-                } else { // It failed and should be deactivated for now
-                    eoc_vector.push_back( top.eoc );
-                    eoc_queue.list.erase( it );
+                } else {
+                    if( !top.eoc->check_deactivate(
+                            nested_d ) ) { // It failed but shouldn't be deactivated so add it back
+                        it->time = calendar::turn + next_recurrence( top.eoc, d );
+                        eocs_to_queue.emplace_back( it );
+                    } else { // It failed and should be deactivated for now
+                        eoc_vector.push_back( top.eoc );
+                        eoc_queue.list.erase( it );
+                    }
                 }
+            } else {
+                eoc_queue.list.erase( it );
             }
-        } else {
-            eoc_queue.list.erase( it );
         }
     }
     for( queued_eocs::storage_iter &q_eoc : eocs_to_queue ) {
-        eoc_queue.queue.emplace( q_eoc );
+        eoc_queue.reschedule( q_eoc );
     }
 }
 
@@ -345,13 +346,9 @@ void effect_on_condition::apply_true_effects( dialogue &d )  const
 
 void effect_on_conditions::clear( Character &you )
 {
-    while( !you.queued_effect_on_conditions.empty() ) {
-        you.queued_effect_on_conditions.pop();
-    }
+    you.queued_effect_on_conditions.clear();
     you.inactive_effect_on_condition_vector.clear();
-    while( !g->queued_global_effect_on_conditions.empty() ) {
-        g->queued_global_effect_on_conditions.pop();
-    }
+    g->queued_global_effect_on_conditions.clear();
     g->inactive_global_effect_on_condition_vector.clear();
 }
 
@@ -362,21 +359,18 @@ void effect_on_conditions::write_eocs_to_file( Character &you )
         testfile << "id;timepoint;recurring" << std::endl;
 
         testfile << "queued eocs:" << std::endl;
-        std::vector<queued_eoc> temp_queue;
-        while( !you.queued_effect_on_conditions.empty() ) {
-            temp_queue.push_back( you.queued_effect_on_conditions.top() );
-            you.queued_effect_on_conditions.pop();
-        }
+        std::vector<queued_eoc> temp_queue( you.queued_effect_on_conditions.list.begin(),
+                                            you.queued_effect_on_conditions.list.end() );
+        std::sort( temp_queue.begin(), temp_queue.end(), []( const queued_eoc & lhs,
+        const queued_eoc & rhs ) {
+            return lhs.time < rhs.time;
+        } );
 
         for( const queued_eoc &queue_entry : temp_queue ) {
             time_duration temp = queue_entry.time - calendar::turn;
             testfile << queue_entry.eoc.c_str() << ";" << to_string( temp ) << std::endl;
         }
 
-        for( const queued_eoc &queued : temp_queue ) {
-            you.queued_effect_on_conditions.push( queued );
-        }
-
         testfile << "inactive eocs:" << std::endl;
         for( const effect_on_condition_id &eoc : you.inactive_effect_on_condition_vector ) {
             testfile << eoc.c_str() << std::endl;
@@ -392,21 +386,18 @@ void effect_on_conditions::write_global_eocs_to_file( )
         testfile << "id;timepoint;recurring" << std::endl;
 
         testfile << "queued eocs:" << std::endl;
-        std::vector<queued_eoc> temp_queue;
-        while( !g->queued_global_effect_on_conditions.empty() ) {
-            temp_queue.push_back( g->queued_global_effect_on_conditions.top() );
-            g->queued_global_effect_on_conditions.pop();
-        }
+        const std::list<queued_eoc> &queued = g->queued_global_effect_on_conditions.list;
+        std::vector<queued_eoc> temp_queue( queued.begin(), queued.end() );
+        std::sort( temp_queue.begin(), temp_queue.end(), []( const queued_eoc & lhs,
+        const queued_eoc & rhs ) {
+            return lhs.time < rhs.time;
+        } );
 
         for( const queued_eoc &queue_entry : temp_queue ) {
             time_duration temp = queue_entry.time - calendar::turn;
             testfile << queue_entry.eoc.c_str() << ";" << to_string( temp ) << std::endl;
         }
 
-        for( const queued_eoc &queued : temp_queue ) {
-            g->queued_global_effect_on_conditions.push( queued );
-        }
-
         testfile << "inactive eocs:" << std::endl;
         for( const effect_on_condition_id &eoc : g->inactive_global_effect_on_condition_vector ) {
             testfile << eoc.c_str() << std::endl;
@@ -492,6 +483,35 @@ void eoc_events::clear()
 {
     has_cached = false;
     event_EOCs.clear();
+    interests_changed();
+}
+
+void eoc_events::build_cache()
+{
+    if( has_cached ) {
+        return;
+    }
+    // initialize all events to an empty vector
+    for( event_type et = static_cast<event_type>( 0 ); et < event_type::num_event_types;
+         et = static_cast<event_type>( static_cast<size_t>( et ) + 1 ) ) {
+
+        event_EOCs[et] = std::vector<effect_on_condition>();
+    }
+
+    //create a cache for the specific types of EOC's so they aren't constantly all itterated through
+    for( const effect_on_condition &eoc : effect_on_conditions::get_all() ) {
+        if( eoc.type == eoc_type::EVENT ) {
+            event_EOCs[eoc.required_event].emplace_back( eoc );
+        }
+    }
+
+    has_cached = true;
+}
+
+bool eoc_events::is_interested_in( event_type type )
+{
+    build_cache();
+    return !event_EOCs[type].empty();
 }
 
 void eoc_events::notify( const cata::event &e )
@@ -502,24 +522,7 @@ void eoc_events::notify( const cata::event &e )
 void eoc_events::notify( const cata::event &e, std::unique_ptr<talker> alpha,
                          std::unique_ptr<talker> beta )
 {
-    if( !has_cached ) {
-
-        // initialize all events to an empty vector
-        for( event_type et = static_cast<event_type>( 0 ); et < event_type::num_event_types;
-             et = static_cast<event_type>( static_cast<size_t>( et ) + 1 ) ) {
-
-            event_EOCs[et] = std::vector<effect_on_condition>();
-        }
-
-        //create a cache for the specific types of EOC's so they aren't constantly all itterated through
-        for( const effect_on_condition &eoc : effect_on_conditions::get_all() ) {
-            if( eoc.type == eoc_type::EVENT ) {
-                event_EOCs[eoc.required_event].emplace_back( eoc );
-            }
-        }
-
-        has_cached = true;
-    }
+    build_cache();
 
     for( const effect_on_condition &eoc : event_EOCs[e.type()] ) {
         if( !alpha ) {
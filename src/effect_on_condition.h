@@ -32,9 +32,12 @@ class eoc_events : public event_subscriber
     public:
         void notify( const cata::event &e ) override;
         void notify( const cata::event &, std::unique_ptr<talker>, std::unique_ptr<talker> ) override;
+        bool is_interested_in( event_type ) override;
         void clear();
 
     private:
+        void build_cache();
+
         std::map<event_type, std::vector<effect_on_condition>> event_EOCs;
         bool has_cached = false;
 };
@@ -20,6 +20,13 @@ void event_subscriber::notify( const cata::event &e, std::unique_ptr<talker>,
     notify( e );
 }
 
+void event_subscriber::interests_changed()
+{
+    if( subscribed_to ) {
+        subscribed_to->interests_changed();
+    }
+}
+
 void event_subscriber::on_subscribe( event_bus *b )
 {
     if( subscribed_to ) {
@@ -48,6 +55,7 @@ void event_bus::subscribe( event_subscriber *s )
 {
     subscribers.push_back( s );
     s->on_subscribe( this );
+    by_type_dirty = true;
 }
 
 void event_bus::unsubscribe( event_subscriber *s )
@@ -58,9 +66,31 @@ void event_bus::unsubscribe( event_subscriber *s )
     } else {
         ( *it )->on_unsubscribe( this );
         subscribers.erase( it );
+        by_type_dirty = true;
     }
 }
 
+void event_bus::interests_changed()
+{
+    by_type_dirty = true;
+}
+
+const event_bus::subscriber_list &event_bus::interested_in( event_type type ) const
+{
+    if( by_type_dirty ) {
+        for( size_t i = 0; i < by_type.size(); ++i ) {
+            by_type[i].clear();
+            for( event_subscriber *s : subscribers ) {
+                if( s->is_interested_in( static_cast<event_type>( i ) ) ) {
+                    by_type[i].push_back( s );
+                }
+            }
+        }
+        by_type_dirty = false;
+    }
+    return by_type[static_cast<size_t>( type )];
+}
+
 void event_bus::send( const cata::event &e ) const
 {
     // don't accept malformed events (ex: wrong number of arguments)
@@ -69,15 +99,22 @@ void event_bus::send( const cata::event &e ) const
         debugmsg( "Null event sent to bus.  REJECTED!" );
         return;
     }
-    for( event_subscriber *s : subscribers ) {
+    for( event_subscriber *s : interested_in( e.type() ) ) {
         s->notify( e );
     }
 }
 
+void event_bus::send( const std::vector<cata::event> &events ) const
+{
+    for( const cata::event &e : events ) {
+        send( e );
+    }
+}
+
 void event_bus::send_with_talker( Creature *alpha, Creature *beta,
                                   const cata::event &e ) const
 {
-    for( event_subscriber *s : subscribers ) {
+    for( event_subscriber *s : interested_in( e.type() ) ) {
         s->notify( e, get_talker_for( alpha ), get_talker_for( beta ) );
     }
 }
@@ -85,7 +122,7 @@ void event_bus::send_with_talker( Creature *alpha, Creature *beta,
 void event_bus::send_with_talker( Creature *alpha, item_location *beta,
                                   const cata::event &e ) const
 {
-    for( event_subscriber *s : subscribers ) {
+    for( event_subscriber *s : interested_in( e.type() ) ) {
         s->notify( e, get_talker_for( alpha ), get_talker_for( beta ) );
     }
 }
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_EVENT_BUS_H
 #define CATA_SRC_EVENT_BUS_H
 
+#include <array>
 #include <type_traits>
 #include <vector>
 
@@ -22,7 +23,12 @@ class event_bus
         void subscribe( event_subscriber * );
         void unsubscribe( event_subscriber * );
 
+        /** Marks the per-type subscriber lists for rebuilding before the next send. */
+        void interests_changed();
+
         void send( const cata::event & ) const;
+        /** Sends a burst of events, e.g. everything killed by one explosion, in order. */
+        void send( const std::vector<cata::event> & ) const;
         void send_with_talker( Creature *, Creature *, const cata::event & ) const;
         void send_with_talker( Creature *, item_location *, const cata::event & ) const;
         template<event_type Type, typename... Args>
@@ -30,7 +36,15 @@ class event_bus
             send( cata::event::make<Type>( std::forward<Args>( args )... ) );
         }
     private:
-        std::vector<event_subscriber *> subscribers;
+        using subscriber_list = std::vector<event_subscriber *>;
+
+        const subscriber_list &interested_in( event_type ) const;
+
+        subscriber_list subscribers;
+        // subscribers grouped by the event types they want, built on demand
+        mutable std::array<subscriber_list, static_cast<size_t>( event_type::num_event_types )>
+        by_type;
+        mutable bool by_type_dirty = true;
 };
 
 event_bus &get_event_bus();
@@ -482,6 +482,10 @@ struct event_transformation_impl : public event_transformation::impl {
             stats.transformed_set_changed( transformation_->id_, data_ );
         }
 
+        const event_multiset &get_events() const override {
+            return data_;
+        }
+
         const event_transformation_impl *transformation_;
         event_multiset data_;
         std::list<updatable_value_constraint> cached_value_constraints_;
@@ -10,6 +10,7 @@ class event;
 }  // namespace cata
 class event_bus;
 class talker;
+enum class event_type : int;
 
 class event_subscriber
 {
@@ -20,6 +21,15 @@ class event_subscriber
         virtual ~event_subscriber();
         virtual void notify( const cata::event & ) = 0;
         virtual void notify( const cata::event &, std::unique_ptr<talker>, std::unique_ptr<talker> );
+        /**
+         * Whether events of this type should be delivered to @ref notify at all.
+         * Call @ref interests_changed when the answer may have changed.
+         */
+        virtual bool is_interested_in( event_type ) {
+            return true;
+        }
+    protected:
+        void interests_changed();
     private:
         friend class event_bus;
         void on_subscribe( event_bus * );
@@ -25,6 +25,7 @@
 #include "color.h"
 #include "creature.h"
 #include "creature_tracker.h"
+#include "cuboid_rectangle.h"
 #include "damage.h"
 #include "debug.h"
 #include "enums.h"
@@ -60,6 +61,7 @@
 #include "units.h"
 #include "vehicle.h"
 #include "vpart_position.h"
+#include "worker_pool.h"
 
 static const damage_type_id damage_bash( "bash" );
 static const damage_type_id damage_bullet( "bullet" );
@@ -92,10 +94,11 @@ static const trait_id trait_PER_SLIME( "PER_SLIME" );
 static const trait_id trait_PER_SLIME_OK( "PER_SLIME_OK" );
 
 // Global to smuggle data into shrapnel_calc() function without replicating it across entire map.
+// Per thread, as the fragments of several explosions are cast at once.
 // Mass in kg
-static float fragment_mass = 0.0001f;
+static thread_local float fragment_mass = 0.0001f;
 // Cross-sectional area in cm^2
-static float fragment_area = 0.00001f;
+static thread_local float fragment_area = 0.00001f;
 // Minimum velocity resulting in skin perforation according to https://www.ncbi.nlg->m.nih.gov/pubmed/7304523
 static constexpr float MIN_EFFECTIVE_VELOCITY = 70.0f;
 // Pretty arbitrary minimum density.  1/1,000 change of a fragment passing through the given square.
@@ -371,63 +374,80 @@ static void do_blast( const Creature *source, const tripoint &p, const float pow
     }
 }
 
-static std::vector<tripoint> shrapnel( const Creature *source, const tripoint &src, int power,
-                                       int casing_mass, float per_fragment_mass, int range = -1 )
+namespace
+{
+using fragment_cache = cata::mdarray<fragment_cloud, point_bub_ms>;
+
+// Where the fragments of one explosion reach, before any of them hit anything
+struct fragment_field {
+    tripoint src;
+    float per_fragment_mass = 0.0f;
+    float velocity = 0.0f;
+    fragment_cache visited;
+};
+
+struct pending_explosion {
+    const Creature *source;
+    tripoint p;
+    const explosion_data *data;
+    std::unique_ptr<fragment_field> fragments;
+};
+} // namespace
+
+// Only reads @p obstacle_cache, so fields of different explosions can be cast concurrently
+static void cast_fragments( fragment_field &field, int power, int casing_mass,
+                            const fragment_cache &obstacle_cache )
 {
     // The gurney equation wants the total mass of the casing.
-    const float fragment_velocity = gurney_spherical( power, casing_mass );
-    fragment_mass = per_fragment_mass;
+    field.velocity = gurney_spherical( power, casing_mass );
+    fragment_mass = field.per_fragment_mass;
     fragment_area = mass_to_area( fragment_mass );
     int fragment_count = casing_mass / fragment_mass;
 
+    const tripoint &src = field.src;
+    fragment_cache &visited_cache = field.visited;
+    // Shadowcasting normally ignores the origin square,
+    // so apply it manually to catch monsters standing on the explosive.
+    // This "blocks" some fragments, but does not apply deceleration.
+    fragment_cloud initial_cloud = accumulate_fragment_cloud( obstacle_cache[src.x][src.y],
+    { field.velocity, static_cast<float>( fragment_count ) }, 1 );
+    visited_cache[src.x][src.y] = initial_cloud;
+    visited_cache[src.x][src.y].density = static_cast<float>( fragment_count );
+
+    castLightAll<fragment_cloud, fragment_cloud, shrapnel_calc, shrapnel_check,
+                 update_fragment_cloud, accumulate_fragment_cloud>
+                 ( visited_cache, obstacle_cache, src.xy(), 0, initial_cloud );
+}
+
+static std::vector<tripoint> apply_fragments( const Creature *source, const fragment_field &field,
+        int range = -1 )
+{
+    const tripoint &src = field.src;
     // Contains all tiles reached by fragments.
     std::vector<tripoint> distrib;
 
     projectile proj;
-    proj.speed = fragment_velocity;
+    proj.speed = field.velocity;
     proj.range = range;
     proj.proj_effects.insert( "NULL_SOURCE" );
 
-    struct local_caches {
-        cata::mdarray<fragment_cloud, point_bub_ms> obstacle_cache;
-        cata::mdarray<fragment_cloud, point_bub_ms> visited_cache;
-    };
-
-    std::unique_ptr<local_caches> caches = std::make_unique<local_caches>();
-    cata::mdarray<fragment_cloud, point_bub_ms> &obstacle_cache = caches->obstacle_cache;
-    cata::mdarray<fragment_cloud, point_bub_ms> &visited_cache = caches->visited_cache;
-
     map &here = get_map();
     // TODO: Calculate range based on max effective range for projectiles.
     // Basically bisect between 0 and map diameter using shrapnel_calc().
     // Need to update shadowcasting to support limiting range without adjusting initial distance.
     const tripoint_range<tripoint> area = here.points_on_zlevel( src.z );
 
-    here.build_obstacle_cache( area.min(), area.max() + tripoint_south_east, obstacle_cache );
-
-    // Shadowcasting normally ignores the origin square,
-    // so apply it manually to catch monsters standing on the explosive.
-    // This "blocks" some fragments, but does not apply deceleration.
-    fragment_cloud initial_cloud = accumulate_fragment_cloud( obstacle_cache[src.x][src.y],
-    { fragment_velocity, static_cast<float>( fragment_count ) }, 1 );
-    visited_cache[src.x][src.y] = initial_cloud;
-    visited_cache[src.x][src.y].density = static_cast<float>( fragment_count );
-
-    castLightAll<fragment_cloud, fragment_cloud, shrapnel_calc, shrapnel_check,
-                 update_fragment_cloud, accumulate_fragment_cloud>
-                 ( visited_cache, obstacle_cache, src.xy(), 0, initial_cloud );
-
     creature_tracker &creatures = get_creature_tracker();
     Creature *mutable_source = source == nullptr ? nullptr : creatures.creature_at( source->pos() );
     // Now visited_caches are populated with density and velocity of fragments.
     for( const tripoint &target : area ) {
-        fragment_cloud &cloud = visited_cache[target.x][target.y];
+        const fragment_cloud &cloud = field.visited[target.x][target.y];
         if( cloud.density <= MIN_FRAGMENT_DENSITY ||
             cloud.velocity <= MIN_EFFECTIVE_VELOCITY ) {
             continue;
         }
         distrib.emplace_back( target );
-        int damage = ballistic_damage( cloud.velocity, fragment_mass );
+        int damage = ballistic_damage( cloud.velocity, field.per_fragment_mass );
         Creature *critter = creatures.creature_at( target );
         if( damage > 0 && critter && !critter->is_dead_state() ) {
             std::poisson_distribution<> d( cloud.density );
@@ -493,7 +513,7 @@ void explosion( const Creature *source, const tripoint &p, const explosion_data
     _explosions.emplace_back( source, get_map().getglobal( p ), ex );
 }
 
-void _make_explosion( const Creature *source, const tripoint &p, const explosion_data &ex )
+static void make_blast( const Creature *source, const tripoint &p, const explosion_data &ex )
 {
     int noise = ex.power * ( ex.fire ? 2 : 10 );
     noise = ( noise > ex.max_noise ) ? ex.max_noise : noise;
@@ -514,34 +534,83 @@ void _make_explosion( const Creature *source, const tripoint &p, const explosion
         // it was before until we re-do blasting power to be based on TNT-equivalent directly.
         do_blast( source, p, ex.power / 15.0, ex.distance_factor, ex.fire );
     }
+}
+
+static void drop_shrapnel( const shrapnel_data &shr, const std::vector<tripoint> &shrapnel_locations )
+{
+    // If explosion drops shrapnel...
+    if( shr.recovery <= 0 || shr.drop.is_null() ) {
+        return;
+    }
+    map &here = get_map();
+    // Extract only passable tiles affected by shrapnel
+    std::vector<tripoint> tiles;
+    for( const tripoint &e : shrapnel_locations ) {
+        if( here.passable( e ) ) {
+            tiles.push_back( e );
+        }
+    }
+    const itype *fragment_drop = item_controller->find_template( shr.drop );
+    int qty = shr.casing_mass * std::min( 1.0, shr.recovery / 100.0 ) /
+              to_gram( fragment_drop->weight );
+    // Truncate to a random selection
+    std::shuffle( tiles.begin(), tiles.end(), rng_get_engine() );
+    tiles.resize( std::min( static_cast<int>( tiles.size() ), qty ) );
+
+    for( const tripoint &e : tiles ) {
+        here.add_item_or_charges( e, item( shr.drop, calendar::turn, item::solitary_tag{} ) );
+    }
+}
+
+/**
+ * Blasts every explosion in order, then casts all their fragment fields at once, then lets
+ * the fragments hit in order. Casting is the slow part and only reads the terrain, so it runs
+ * on the worker pool while everything touching the game stays on this thread.
+ */
+static void make_explosions( std::vector<pending_explosion> &explosions )
+{
+    for( const pending_explosion &ex : explosions ) {
+        make_blast( ex.source, ex.p, *ex.data );
+    }
 
     map &here = get_map();
-    const shrapnel_data &shr = ex.shrapnel;
-    if( shr.casing_mass > 0 ) {
-        auto shrapnel_locations = shrapnel( source, p, ex.power, shr.casing_mass, shr.fragment_mass );
-
-        // If explosion drops shrapnel...
-        if( shr.recovery > 0 && !shr.drop.is_null() ) {
-
-            // Extract only passable tiles affected by shrapnel
-            std::vector<tripoint> tiles;
-            for( const tripoint &e : shrapnel_locations ) {
-                if( here.passable( e ) ) {
-                    tiles.push_back( e );
-                }
-            }
-            const itype *fragment_drop = item_controller->find_template( shr.drop );
-            int qty = shr.casing_mass * std::min( 1.0, shr.recovery / 100.0 ) /
-                      to_gram( fragment_drop->weight );
-            // Truncate to a random selection
-            std::shuffle( tiles.begin(), tiles.end(), rng_get_engine() );
-            tiles.resize( std::min( static_cast<int>( tiles.size() ), qty ) );
-
-            for( const tripoint &e : tiles ) {
-                here.add_item_or_charges( e, item( shr.drop, calendar::turn, item::solitary_tag{} ) );
-            }
+    // One obstacle cache per z-level, built after the blasts reshaped the terrain
+    std::map<int, std::unique_ptr<fragment_cache>> obstacle_caches;
+    for( pending_explosion &ex : explosions ) {
+        if( ex.data->shrapnel.casing_mass <= 0 ) {
+            continue;
+        }
+        ex.fragments = std::make_unique<fragment_field>();
+        ex.fragments->src = ex.p;
+        ex.fragments->per_fragment_mass = ex.data->shrapnel.fragment_mass;
+        std::unique_ptr<fragment_cache> &obstacles = obstacle_caches[ex.p.z];
+        if( !obstacles ) {
+            obstacles = std::make_unique<fragment_cache>();
+            const tripoint_range<tripoint> area = here.points_on_zlevel( ex.p.z );
+            here.build_obstacle_cache( area.min(), area.max() + tripoint_south_east, *obstacles );
         }
     }
+    get_worker_pool().parallel_for( explosions.size(), [&]( const size_t i ) {
+        pending_explosion &ex = explosions[i];
+        if( ex.fragments ) {
+            cast_fragments( *ex.fragments, ex.data->power, ex.data->shrapnel.casing_mass,
+                            *obstacle_caches.at( ex.p.z ) );
+        }
+    } );
+
+    for( pending_explosion &ex : explosions ) {
+        if( ex.fragments ) {
+            drop_shrapnel( ex.data->shrapnel, apply_fragments( ex.source, *ex.fragments ) );
+            ex.fragments.reset();
+        }
+    }
+}
+
+void _make_explosion( const Creature *source, const tripoint &p, const explosion_data &ex )
+{
+    std::vector<pending_explosion> explosions;
+    explosions.push_back( { source, p, &ex, nullptr } );
+    make_explosions( explosions );
 }
 
 void flashbang( const tripoint &p, bool player_immune )
@@ -604,15 +673,15 @@ void shockwave( const tripoint &p, int radius, int force, int stun, int dam_mult
     sounds::sound( p, force * force * dam_mult / 2, sounds::sound_t::combat, _( "Crack!" ), false,
                    "misc", "shockwave" );
 
-    for( monster &critter : g->all_monsters() ) {
-        if( critter.posz() != p.z ) {
-            continue;
-        }
+    const tripoint_abs_ms abs_p = get_map().getglobal( p );
+    const inclusive_cuboid<tripoint_abs_ms> area( abs_p - point( radius, radius ),
+            abs_p + point( radius, radius ) );
+    get_creature_tracker().for_each_in_rect( area, [&]( monster & critter ) {
         if( rl_dist( critter.pos(), p ) <= radius ) {
             add_msg( _( "%s is caught in the shockwave!" ), critter.name() );
             g->knockback( p, critter.pos(), force, stun, dam_mult );
         }
-    }
+    } );
     // TODO: combine the two loops and the case for avatar using all_creatures()
     for( npc &guy : g->all_npcs() ) {
         if( guy.posz() != p.z ) {
@@ -897,15 +966,23 @@ void resonance_cascade( const tripoint &p )
 
 void process_explosions()
 {
-    for( const queued_explosion &ex : _explosions ) {
-        const tripoint p = get_map().getlocal( ex.pos );
-        if( p.x < 0 || p.x >= MAPSIZE_X || p.y < 0 || p.y >= MAPSIZE_Y ) {
-            debugmsg( "Explosion origin (%d, %d, %d) is out-of-bounds", p.x, p.y, p.z );
-            continue;
+    // Explosions set off by these ones (fuel tanks, cooking off ammo) are queued again and go
+    // off together in the next wave
+    while( !_explosions.empty() ) {
+        std::vector<queued_explosion> queued;
+        queued.swap( _explosions );
+        std::vector<pending_explosion> explosions;
+        explosions.reserve( queued.size() );
+        for( const queued_explosion &ex : queued ) {
+            const tripoint p = get_map().getlocal( ex.pos );
+            if( p.x < 0 || p.x >= MAPSIZE_X || p.y < 0 || p.y >= MAPSIZE_Y ) {
+                debugmsg( "Explosion origin (%d, %d, %d) is out-of-bounds", p.x, p.y, p.z );
+                continue;
+            }
+            explosions.push_back( { ex.source, p, &ex.data, nullptr } );
         }
-        _make_explosion( ex.source, p, ex.data );
+        make_explosions( explosions );
     }
-    _explosions.clear();
 }
 
 } // namespace explosion_handler
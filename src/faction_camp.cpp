@@ -1,6 +1,7 @@
 #include "faction_camp.h" // IWYU pragma: associated
 
 #include <algorithm>
+#include <bitset>
 #include <cstddef>
 #include <list>
 #include <map>
@@ -3486,33 +3487,144 @@ static bool farm_valid_seed( const item &itm )
     return itm.is_seed() && itm.typeId() != itype_marloss_seed && itm.typeId() != itype_fungal_seeds;
 }
 
-static std::pair<size_t, std::string> farm_action( const tripoint_abs_omt &omt_tgt, farm_ops op,
-        const npc_ptr &comp = nullptr )
+static bool is_unplowed( const tripoint &pos, tinymap &farm_map )
+{
+    const ter_id &farm_ter = farm_map.ter( pos );
+    return farm_ter->has_flag( ter_furn_flag::TFLAG_PLOWABLE );
+}
+
+static std::string farm_crops_list( const std::set<std::string> &plant_names )
 {
-    size_t plots_cnt = 0;
     std::string crops;
+    int total_c = 0;
+    for( const std::string &i : plant_names ) {
+        if( total_c < 5 ) {
+            crops += "    " + i + "\n";
+            total_c++;
+        } else if( total_c == 5 ) {
+            crops += _( "+ more\n" );
+            break;
+        }
+    }
+    return crops;
+}
 
-    const auto is_dirtmound = []( const tripoint & pos, tinymap & bay1, tinymap & bay2 ) {
-        return ( bay1.ter( pos ) == t_dirtmound ) && ( !bay2.has_furn( pos ) );
-    };
-    const auto is_unplowed = []( const tripoint & pos, tinymap & farm_map ) {
-        const ter_id &farm_ter = farm_map.ter( pos );
-        return farm_ter->has_flag( ter_furn_flag::TFLAG_PLOWABLE );
-    };
+// Tiles of a farm that its mapgen makes dirt mounds, indexed by x * 2 * SEEY + y
+using farm_layout = std::bitset<4 * SEEX * SEEY>;
 
-    std::set<std::string> plant_names;
-    std::vector<item *> seed_inv;
-    if( comp ) {
-        seed_inv = comp->companion_mission_inv.items_with( farm_valid_seed );
+// What the area should look like according to jsons. Running mapgen for it is costly, so it's
+// done once per farm and terrain, expansion upgrades change the terrain.
+static const farm_layout &farm_json_layout( const tripoint_abs_omt &omt_tgt )
+{
+    static std::map<std::pair<tripoint_abs_omt, oter_id>, farm_layout> layouts;
+    const std::pair<tripoint_abs_omt, oter_id> key( omt_tgt, overmap_buffer.ter( omt_tgt ) );
+    const auto found = layouts.find( key );
+    if( found != layouts.end() ) {
+        return found->second;
+    }
+    farm_layout &layout = layouts[key];
+    fake_map farm_json;
+    mapgendata dat( omt_tgt, farm_json, 0, calendar::turn, nullptr );
+    if( !run_mapgen_func( dat.terrain_type()->get_mapgen_id(), dat ) ) {
+        debugmsg( "Failed to run mapgen for farm map" );
+        return layout;
+    }
+    const tripoint mapmin = tripoint( 0, 0, omt_tgt.z() );
+    const tripoint mapmax = tripoint( 2 * SEEX - 1, 2 * SEEY - 1, omt_tgt.z() );
+    for( const tripoint &pos : farm_json.points_in_rectangle( mapmin, mapmax ) ) {
+        layout[pos.x * 2 * SEEY + pos.y] = farm_json.ter( pos ) == t_dirtmound;
+    }
+    return layout;
+}
+
+namespace
+{
+// Plots of a farm ready for each operation
+struct farm_survey {
+    time_point when = calendar::before_time_starts;
+    size_t plow = 0;
+    size_t plant = 0;
+    size_t harvest = 0;
+    std::set<std::string> crops;
+};
+} // namespace
+
+// Camp menus ask for every operation on every farm, the survey loads each farm once a turn
+static std::map<tripoint_abs_omt, farm_survey> &farm_surveys()
+{
+    static std::map<tripoint_abs_omt, farm_survey> surveys;
+    return surveys;
+}
+
+static const farm_survey &survey_farm( const tripoint_abs_omt &omt_tgt )
+{
+    farm_survey &survey = farm_surveys()[omt_tgt];
+    if( survey.when == calendar::turn ) {
+        return survey;
     }
+    survey = farm_survey();
+    survey.when = calendar::turn;
+
+    tinymap farm_map;
+    farm_map.load( project_to<coords::sm>( omt_tgt ), false );
+    const farm_layout &layout = farm_json_layout( omt_tgt );
+    const tripoint mapmin = tripoint( 0, 0, omt_tgt.z() );
+    const tripoint mapmax = tripoint( 2 * SEEX - 1, 2 * SEEY - 1, omt_tgt.z() );
+    for( const tripoint &pos : farm_map.points_in_rectangle( mapmin, mapmax ) ) {
+        const bool has_furn = farm_map.has_furn( pos );
+        // Needs to be plowed to match json
+        if( layout[pos.x * 2 * SEEY + pos.y] && !has_furn && is_unplowed( pos, farm_map ) ) {
+            survey.plow++;
+        }
+        if( farm_map.ter( pos ) == t_dirtmound && !has_furn ) {
+            survey.plant++;
+        }
+        if( farm_map.furn( pos ) == f_plant_harvest ) {
+            // Can't use item_stack::only_item() since there might be fertilizer
+            map_stack items = farm_map.i_at( pos );
+            const map_stack::iterator seed = std::find_if( items.begin(), items.end(),
+            []( const item & it ) {
+                return it.is_seed();
+            } );
+            if( seed != items.end() && farm_valid_seed( *seed ) ) {
+                survey.harvest++;
+                survey.crops.insert( item::nname( itype_id( seed->type->seed->fruit_id ) ) );
+            }
+        }
+    }
+    return survey;
+}
+
+static std::pair<size_t, std::string> farm_action( const tripoint_abs_omt &omt_tgt, farm_ops op,
+        const npc_ptr &comp = nullptr )
+{
+    if( !comp ) {
+        const farm_survey &survey = survey_farm( omt_tgt );
+        switch( op ) {
+            case farm_ops::plow:
+                return std::make_pair( survey.plow, std::string() );
+            case farm_ops::plant:
+                return std::make_pair( survey.plant, std::string() );
+            case farm_ops::harvest:
+                return std::make_pair( survey.harvest, farm_crops_list( survey.crops ) );
+            default:
+                // let the callers handle no op argument
+                return std::make_pair( 0, std::string() );
+        }
+    }
+    // The companion changes the farm, the next survey has to look again
+    farm_surveys().erase( omt_tgt );
+
+    size_t plots_cnt = 0;
+
+    std::vector<item *> seed_inv = comp->companion_mission_inv.items_with( farm_valid_seed );
 
     // farm_map is what the area actually looks like
     tinymap farm_map;
     farm_map.load( project_to<coords::sm>( omt_tgt ), false );
-    // farm_json is what the area should look like according to jsons (loaded on demand)
-    std::unique_ptr<fake_map> farm_json;
     tripoint mapmin = tripoint( 0, 0, omt_tgt.z() );
     tripoint mapmax = tripoint( 2 * SEEX - 1, 2 * SEEY - 1, omt_tgt.z() );
+    const farm_layout &layout = op == farm_ops::plow ? farm_json_layout( omt_tgt ) : farm_layout();
     bool done_planting = false;
     Character &player_character = get_player_character();
     map &here = get_map();
@@ -3522,48 +3634,37 @@ static std::pair<size_t, std::string> farm_action( const tripoint_abs_omt &omt_t
         }
         switch( op ) {
             case farm_ops::plow: {
-                if( !farm_json ) {
-                    farm_json = std::make_unique<fake_map>();
-                    mapgendata dat( omt_tgt, *farm_json, 0, calendar::turn, nullptr );
-                    if( !run_mapgen_func( dat.terrain_type()->get_mapgen_id(), dat ) ) {
-                        debugmsg( "Failed to run mapgen for farm map" );
-                        break;
-                    }
-                }
                 // Needs to be plowed to match json
-                if( is_dirtmound( pos, *farm_json, farm_map ) && is_unplowed( pos, farm_map ) ) {
+                if( layout[pos.x * 2 * SEEY + pos.y] && !farm_map.has_furn( pos ) &&
+                    is_unplowed( pos, farm_map ) ) {
                     plots_cnt += 1;
-                    if( comp ) {
-                        farm_map.ter_set( pos, t_dirtmound );
-                    }
+                    farm_map.ter_set( pos, t_dirtmound );
                 }
                 break;
             }
             case farm_ops::plant:
-                if( is_dirtmound( pos, farm_map, farm_map ) ) {
+                if( farm_map.ter( pos ) == t_dirtmound && !farm_map.has_furn( pos ) ) {
                     plots_cnt += 1;
-                    if( comp ) {
-                        if( seed_inv.empty() ) {
-                            done_planting = true;
-                            break;
-                        }
-                        item *tmp_seed = seed_inv.back();
-                        seed_inv.pop_back();
-                        std::list<item> used_seed;
-                        used_seed.push_back( *tmp_seed );
-                        if( tmp_seed->count_by_charges() ) {
-                            tmp_seed->charges -= 1;
-                            if( tmp_seed->charges > 0 ) {
-                                seed_inv.push_back( tmp_seed );
-                            }
-                        }
-                        used_seed.front().set_age( 0_turns );
-                        farm_map.add_item_or_charges( pos, used_seed.front() );
-                        farm_map.set( pos, t_dirt, f_plant_seed );
-                        if( !tmp_seed->count_by_charges() ) {
-                            comp->companion_mission_inv.remove_item( tmp_seed );
+                    if( seed_inv.empty() ) {
+                        done_planting = true;
+                        break;
+                    }
+                    item *tmp_seed = seed_inv.back();
+                    seed_inv.pop_back();
+                    std::list<item> used_seed;
+                    used_seed.push_back( *tmp_seed );
+                    if( tmp_seed->count_by_charges() ) {
+                        tmp_seed->charges -= 1;
+                        if( tmp_seed->charges > 0 ) {
+                            seed_inv.push_back( tmp_seed );
                         }
                     }
+                    used_seed.front().set_age( 0_turns );
+                    farm_map.add_item_or_charges( pos, used_seed.front() );
+                    farm_map.set( pos, t_dirt, f_plant_seed );
+                    if( !tmp_seed->count_by_charges() ) {
+                        comp->companion_mission_inv.remove_item( tmp_seed );
+                    }
                 }
                 break;
             case farm_ops::harvest:
@@ -3575,23 +3676,19 @@ static std::pair<size_t, std::string> farm_action( const tripoint_abs_omt &omt_t
                     } );
                     if( seed != items.end() && farm_valid_seed( *seed ) ) {
                         plots_cnt += 1;
-                        if( comp ) {
-                            int skillLevel = round( comp->get_skill_level( skill_survival ) );
-                            ///\EFFECT_SURVIVAL increases number of plants harvested from a seed
-                            int plant_count = rng( skillLevel / 2, skillLevel );
-                            plant_count *= farm_map.furn( pos )->plant->harvest_multiplier;
-                            plant_count = std::min( std::max( plant_count, 1 ), 12 );
-                            int seed_cnt = std::max( 1, rng( plant_count / 4, plant_count / 2 ) );
-                            for( item &i : iexamine::get_harvest_items( *seed->type, plant_count,
-                                    seed_cnt, true ) ) {
-                                here.add_item_or_charges( player_character.pos(), i );
-                            }
-                            farm_map.i_clear( pos );
-                            farm_map.furn_set( pos, f_null );
-                            farm_map.ter_set( pos, t_dirt );
-                        } else {
-                            plant_names.insert( item::nname( itype_id( seed->type->seed->fruit_id ) ) );
+                        int skillLevel = round( comp->get_skill_level( skill_survival ) );
+                        ///\EFFECT_SURVIVAL increases number of plants harvested from a seed
+                        int plant_count = rng( skillLevel / 2, skillLevel );
+                        plant_count *= farm_map.furn( pos )->plant->harvest_multiplier;
+                        plant_count = std::min( std::max( plant_count, 1 ), 12 );
+                        int seed_cnt = std::max( 1, rng( plant_count / 4, plant_count / 2 ) );
+                        for( item &i : iexamine::get_harvest_items( *seed->type, plant_count,
+                                seed_cnt, true ) ) {
+                            here.add_item_or_charges( player_character.pos(), i );
                         }
+                        farm_map.i_clear( pos );
+                        farm_map.furn_set( pos, f_null );
+                        farm_map.ter_set( pos, t_dirt );
                     }
                 }
                 break;
@@ -3600,22 +3697,9 @@ static std::pair<size_t, std::string> farm_action( const tripoint_abs_omt &omt_t
                 break;
         }
     }
-    if( comp ) {
-        farm_map.save();
-    }
-
-    int total_c = 0;
-    for( const std::string &i : plant_names ) {
-        if( total_c < 5 ) {
-            crops += "    " + i + "\n";
-            total_c++;
-        } else if( total_c == 5 ) {
-            crops += _( "+ more\n" );
-            break;
-        }
-    }
+    farm_map.save();
 
-    return std::make_pair( plots_cnt, crops );
+    return std::make_pair( plots_cnt, std::string() );
 }
 
 void basecamp::start_farm_op( const tripoint_abs_omt &omt_tgt, const mission_id &miss_id,
@@ -1,7 +1,9 @@
 #include "flexbuffer_cache.h"
 
+#include <atomic>
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -19,6 +21,7 @@
 #include "json.h"
 #include "json_error.h"
 #include "make_static.h"
+#include "memory_accounting.h"
 #include "mmap_file.h"
 #include "path_info.h"
 
@@ -52,16 +55,20 @@ fs::file_time_type get_file_mtime_millis( const fs::path &path, std::error_code
     return ret;
 }
 
+// @param share_strings Stores each distinct string value once. Slower to build, but much
+// smaller for documents that repeat the same ids over and over, like saves.
 std::vector<uint8_t> parse_json_to_flexbuffer_(
     const char *buffer,
-    const char *source_filename_opt ) noexcept( false )
+    const char *source_filename_opt,
+    bool share_strings = false ) noexcept( false )
 {
     flatbuffers::IDLOptions opts;
     opts.strict_json = true;
     opts.use_flexbuffers = true;
     opts.no_warnings = true;
     flatbuffers::Parser parser{ opts };
-    flexbuffers::Builder fbb;
+    flexbuffers::Builder fbb( 256, share_strings ? flexbuffers::BUILDER_FLAG_SHARE_KEYS_AND_STRINGS :
+                              flexbuffers::BUILDER_FLAG_SHARE_KEYS );
 
     if( !parser.ParseFlexBuffer( buffer, source_filename_opt, &fbb ) ) {
         std::istringstream is{ buffer };
@@ -124,12 +131,34 @@ std::vector<uint8_t> parse_json_to_flexbuffer_(
     return std::move( fbb ).GetBuffer();
 }
 
+// Storage currently alive, for flexbuffer_cache::memory_usage. Buffers are parsed on
+// background threads too.
+std::atomic<size_t> live_storage_count{ 0 };
+std::atomic<size_t> live_storage_bytes{ 0 };
+
+void track_storage( size_t bytes )
+{
+    ++live_storage_count;
+    live_storage_bytes += bytes;
+}
+
+void untrack_storage( size_t bytes )
+{
+    --live_storage_count;
+    live_storage_bytes -= bytes;
+}
+
 } // namespace
 
 struct flexbuffer_vector_storage : flexbuffer_storage {
     std::vector<uint8_t> buffer_;
 
-    explicit flexbuffer_vector_storage( std::vector<uint8_t> &&buffer ) : buffer_{ std::move( buffer ) } {}
+    explicit flexbuffer_vector_storage( std::vector<uint8_t> &&buffer ) : buffer_{ std::move( buffer ) } {
+        track_storage( buffer_.size() );
+    }
+    ~flexbuffer_vector_storage() override {
+        untrack_storage( buffer_.size() );
+    }
 
     const uint8_t *data() const override {
         return buffer_.data();
@@ -143,7 +172,12 @@ struct flexbuffer_vector_storage : flexbuffer_storage {
 struct flexbuffer_mmap_storage : flexbuffer_storage {
     std::shared_ptr<mmap_file> mmap_handle_;
 
-    explicit flexbuffer_mmap_storage( std::shared_ptr<mmap_file> mmap_handle ) : mmap_handle_{ std::move( mmap_handle ) } {}
+    explicit flexbuffer_mmap_storage( std::shared_ptr<mmap_file> mmap_handle ) : mmap_handle_{ std::move( mmap_handle ) } {
+        track_storage( mmap_handle_->len );
+    }
+    ~flexbuffer_mmap_storage() override {
+        untrack_storage( mmap_handle_->len );
+    }
 
     const uint8_t *data() const override {
         return mmap_handle_->base;
@@ -153,6 +187,28 @@ struct flexbuffer_mmap_storage : flexbuffer_storage {
     }
 };
 
+// One flexbuffer inside a mapped pack file, see flexbuffer_disk_cache::write_pack.
+struct flexbuffer_pack_storage : flexbuffer_storage {
+    std::shared_ptr<mmap_file> pack_;
+    size_t offset_;
+    size_t size_;
+
+    flexbuffer_pack_storage( std::shared_ptr<mmap_file> pack, size_t offset, size_t size )
+        : pack_{ std::move( pack ) }, offset_{ offset }, size_{ size } {
+        track_storage( size_ );
+    }
+    ~flexbuffer_pack_storage() override {
+        untrack_storage( size_ );
+    }
+
+    const uint8_t *data() const override {
+        return pack_->base + offset_;
+    }
+    size_t size() const override {
+        return size_;
+    }
+};
+
 parsed_flexbuffer::parsed_flexbuffer( std::shared_ptr<flexbuffer_storage> storage )
     : storage_{ std::move( storage ) }
 {
@@ -226,6 +282,32 @@ struct string_flexbuffer : parsed_flexbuffer {
         std::string source_;
 };
 
+struct binary_flexbuffer : parsed_flexbuffer {
+        binary_flexbuffer( std::shared_ptr<flexbuffer_storage> &&storage, fs::path &&source_path )
+            : parsed_flexbuffer{ std::move( storage ) },
+              source_path_{ std::move( source_path ) } {}
+
+        ~binary_flexbuffer() override = default;
+
+        bool is_stale() const override {
+            return false;
+        }
+
+        std::unique_ptr<std::istream> get_source_stream() const override {
+            // Only needed for error reporting, so just turn the binary data back into json.
+            std::string source;
+            flexbuffers::GetRoot( storage_->data(), storage_->size() ).ToString( true, true, source );
+            return std::make_unique<std::istringstream>( std::move( source ) );
+        }
+
+        fs::path get_source_path() const noexcept override {
+            return source_path_;
+        }
+
+    private:
+        fs::path source_path_;
+};
+
 class flexbuffer_disk_cache
 {
     public:
@@ -233,6 +315,7 @@ class flexbuffer_disk_cache
                 const fs::path &root_path ) {
             // Private constructor, make_unique doesn't have access.
             std::unique_ptr<flexbuffer_disk_cache> cache{ new flexbuffer_disk_cache( cache_path, root_path ) };
+            cache->read_pack();
 
             std::string cache_path_string = cache_path.u8string();
             std::vector<std::string> all_cached_flexbuffers = get_files_from_path(
@@ -280,6 +363,8 @@ class flexbuffer_disk_cache
                     cache->cached_flexbuffers_.emplace( root_relative_json_path_string, disk_cache_entry{ cached_flexbuffer_path, cached_mtime } );
                 }
             }
+            // Loose files left from an earlier run still need to go into the pack
+            cache->pack_dirty_ = !cache->cached_flexbuffers_.empty();
             return cache;
         }
 
@@ -295,16 +380,20 @@ class flexbuffer_disk_cache
             return {};
         }
 
-        std::shared_ptr<flexbuffer_mmap_storage> load_flexbuffer_if_not_stale(
+        std::shared_ptr<flexbuffer_storage> load_flexbuffer_if_not_stale(
             const fs::path &lexically_normal_json_source_path ) {
-            std::shared_ptr<flexbuffer_mmap_storage> storage;
+            std::lock_guard<std::mutex> lock( mutex_ );
+            std::shared_ptr<flexbuffer_storage> storage;
 
             fs::path root_relative_source_path = lexically_normal_json_source_path.lexically_relative(
                     root_path_ ).lexically_normal();
 
             // Is there even a potential cached flexbuffer for this file.
-            auto disk_entry = cached_flexbuffers_.find( root_relative_source_path.u8string() );
-            if( disk_entry == cached_flexbuffers_.end() ) {
+            const std::string root_relative_source_string = root_relative_source_path.u8string();
+            auto disk_entry = cached_flexbuffers_.find( root_relative_source_string );
+            auto pack_entry = packed_flexbuffers_.find( root_relative_source_string );
+            if( disk_entry == cached_flexbuffers_.end() &&
+                pack_entry == packed_flexbuffers_.end() ) {
                 return storage;
             }
 
@@ -314,6 +403,18 @@ class flexbuffer_disk_cache
                 return storage;
             }
 
+            if( disk_entry == cached_flexbuffers_.end() ) {
+                // Only in the pack
+                if( source_mtime != pack_entry->second.mtime ) {
+                    // Drop it from the pack the next time it is written
+                    packed_flexbuffers_.erase( pack_entry );
+                    pack_dirty_ = true;
+                    return storage;
+                }
+                return std::make_shared<flexbuffer_pack_storage>( pack_, pack_entry->second.offset,
+                        pack_entry->second.size );
+            }
+
             // Does the source file's mtime match what we cached previously
             if( source_mtime != disk_entry->second.mtime ) {
                 // Cached flexbuffer on disk is out of date, remove it.
@@ -336,8 +437,13 @@ class flexbuffer_disk_cache
 
         bool save_to_disk( const fs::path &lexically_normal_json_source_path,
                            const std::vector<uint8_t> &flexbuffer_binary ) {
+            std::lock_guard<std::mutex> lock( mutex_ );
             std::error_code ec;
-            std::string json_source_path_string = lexically_normal_json_source_path.u8string();
+            // Keyed like the lookups in load_flexbuffer_if_not_stale and the files found on
+            // startup, so write_pack knows which source each buffer belongs to.
+            std::string json_source_path_string =
+                lexically_normal_json_source_path.lexically_relative( root_path_ )
+                .lexically_normal().u8string();
             fs::file_time_type mtime = get_file_mtime_millis( lexically_normal_json_source_path, ec );
             if( ec ) {
                 return false;
@@ -367,16 +473,186 @@ class flexbuffer_disk_cache
 
             fb.close();
             cached_flexbuffers_[json_source_path_string] = disk_cache_entry{ flexbuffer_path, mtime };
+            pack_dirty_ = true;
 
             return true;
         }
 
+        // Writes every cached flexbuffer into one pack file and removes the loose ones, so
+        // the next start maps a single file instead of opening one per source file.
+        //
+        // Layout, in native byte order: the magic, the entry count, then per entry the
+        // source mtime in milliseconds, the offset and size of its flexbuffer, the length of
+        // the root relative source path and the path itself. The flexbuffers follow, each
+        // starting at a multiple of 8 bytes.
+        void write_pack() {
+            std::lock_guard<std::mutex> lock( mutex_ );
+            if( !pack_dirty_ ) {
+                return;
+            }
+
+            struct pending_entry {
+                std::string path;
+                int64_t mtime_ms;
+                const uint8_t *data;
+                size_t size;
+            };
+            std::vector<pending_entry> entries;
+            // Loose files are newer than anything packed for the same source
+            std::vector<std::shared_ptr<mmap_file>> loose_files;
+            for( const std::pair<const std::string, disk_cache_entry> &loose :
+                 cached_flexbuffers_ ) {
+                std::shared_ptr<mmap_file> mapped =
+                    mmap_file::map_file( loose.second.flexbuffer_path );
+                if( !mapped ) {
+                    return;
+                }
+                entries.push_back( { loose.first, to_millis( loose.second.mtime ), mapped->base,
+                                     mapped->len } );
+                loose_files.emplace_back( std::move( mapped ) );
+            }
+            for( const std::pair<const std::string, pack_index_entry> &packed :
+                 packed_flexbuffers_ ) {
+                if( cached_flexbuffers_.count( packed.first ) == 0 ) {
+                    entries.push_back( { packed.first, to_millis( packed.second.mtime ),
+                                         pack_->base + packed.second.offset, packed.second.size } );
+                }
+            }
+
+            size_t offset = sizeof( pack_magic ) + sizeof( uint64_t );
+            for( const pending_entry &entry : entries ) {
+                offset += 3 * sizeof( uint64_t ) + sizeof( uint32_t ) + entry.path.size();
+            }
+            std::vector<size_t> offsets;
+            offsets.reserve( entries.size() );
+            for( const pending_entry &entry : entries ) {
+                offset = align_offset( offset );
+                offsets.push_back( offset );
+                offset += entry.size;
+            }
+
+            const fs::path pack_path = cache_path_ / fs::u8path( pack_file_name );
+            fs::path temp_path = pack_path;
+            temp_path += fs::u8path( ".tmp" );
+            assure_dir_exist( cache_path_ );
+            {
+                std::ofstream fout( temp_path, std::ofstream::binary );
+                fout.write( pack_magic, sizeof( pack_magic ) );
+                write_scalar<uint64_t>( fout, entries.size() );
+                for( size_t i = 0; i < entries.size(); ++i ) {
+                    write_scalar<int64_t>( fout, entries[i].mtime_ms );
+                    write_scalar<uint64_t>( fout, offsets[i] );
+                    write_scalar<uint64_t>( fout, entries[i].size );
+                    write_scalar<uint32_t>( fout, static_cast<uint32_t>( entries[i].path.size() ) );
+                    fout.write( entries[i].path.data(), entries[i].path.size() );
+                }
+                size_t written = static_cast<size_t>( fout.tellp() );
+                for( size_t i = 0; i < entries.size(); ++i ) {
+                    static constexpr char padding[8] = {};
+                    fout.write( padding, offsets[i] - written );
+                    fout.write( reinterpret_cast<const char *>( entries[i].data ),
+                                entries[i].size );
+                    written = offsets[i] + entries[i].size;
+                }
+                if( !fout.good() ) {
+                    fout.close();
+                    remove_file( temp_path );
+                    return;
+                }
+            }
+            if( !rename_file( temp_path, pack_path ) ) {
+                remove_file( temp_path );
+                return;
+            }
+
+            for( const std::pair<const std::string, disk_cache_entry> &loose :
+                 cached_flexbuffers_ ) {
+                remove_file( loose.second.flexbuffer_path );
+            }
+            cached_flexbuffers_.clear();
+            // Buffers handed out earlier keep their own mapping of the old pack alive
+            read_pack();
+        }
+
     private:
         explicit flexbuffer_disk_cache( fs::path cache_path, fs::path root_path ) : cache_path_{ std::move( cache_path ) },
             root_path_{ std::move( root_path ) } {}
 
+        static constexpr const char *pack_file_name = "flexbuffers.pack";
+        static constexpr char pack_magic[8] = { 'C', 'D', 'D', 'A', 'F', 'B', 'P', '1' };
+
+        static size_t align_offset( size_t offset ) {
+            return ( offset + 7 ) & ~static_cast<size_t>( 7 );
+        }
+
+        static int64_t to_millis( fs::file_time_type mtime ) {
+            return std::chrono::duration_cast<std::chrono::milliseconds>
+                   ( mtime.time_since_epoch() ).count();
+        }
+
+        template<typename T>
+        static void write_scalar( std::ostream &out, T value ) {
+            out.write( reinterpret_cast<const char *>( &value ), sizeof( T ) );
+        }
+
+        // Maps the pack and reads its index. A missing, truncated or foreign pack is ignored,
+        // the loose files and parsing the sources cover everything it would have.
+        void read_pack() {
+            packed_flexbuffers_.clear();
+            pack_.reset();
+            pack_dirty_ = false;
+            const fs::path pack_path = cache_path_ / fs::u8path( pack_file_name );
+            if( !file_exist( pack_path ) ) {
+                return;
+            }
+            std::shared_ptr<mmap_file> pack = mmap_file::map_file( pack_path );
+            if( !pack ) {
+                return;
+            }
+            const uint8_t *const begin = pack->base;
+            const uint8_t *const end = begin + pack->len;
+            const uint8_t *pos = begin;
+            const auto read = [&]( void *dest, size_t size ) {
+                if( static_cast<size_t>( end - pos ) < size ) {
+                    return false;
+                }
+                memcpy( dest, pos, size );
+                pos += size;
+                return true;
+            };
+            char magic[sizeof( pack_magic )];
+            uint64_t count = 0;
+            if( !read( magic, sizeof( magic ) ) ||
+                memcmp( magic, pack_magic, sizeof( magic ) ) != 0 ||
+                !read( &count, sizeof( count ) ) ) {
+                return;
+            }
+            std::unordered_map<std::string, pack_index_entry> index;
+            for( uint64_t i = 0; i < count; ++i ) {
+                int64_t mtime_ms = 0;
+                uint64_t offset = 0;
+                uint64_t size = 0;
+                uint32_t path_size = 0;
+                if( !read( &mtime_ms, sizeof( mtime_ms ) ) || !read( &offset, sizeof( offset ) ) ||
+                    !read( &size, sizeof( size ) ) || !read( &path_size, sizeof( path_size ) ) ||
+                    static_cast<size_t>( end - pos ) < path_size ||
+                    offset > pack->len || size > pack->len - offset ) {
+                    return;
+                }
+                std::string path( reinterpret_cast<const char *>( pos ), path_size );
+                pos += path_size;
+                index[std::move( path )] = pack_index_entry{
+                    fs::file_time_type( std::chrono::milliseconds( mtime_ms ) ),
+                    static_cast<size_t>( offset ), static_cast<size_t>( size ) };
+            }
+            packed_flexbuffers_ = std::move( index );
+            pack_ = std::move( pack );
+        }
+
         fs::path cache_path_;
         fs::path root_path_;
+        // Files may be parsed on several threads at once, see DynamicDataLoader::load_data_from_path.
+        std::mutex mutex_;
 
         struct disk_cache_entry {
             fs::path flexbuffer_path;
@@ -384,6 +660,17 @@ class flexbuffer_disk_cache
         };
         // Maps game root relative json source path to the most recent cached flexbuffer we have on disk for it.
         std::unordered_map<std::string, disk_cache_entry> cached_flexbuffers_;
+
+        struct pack_index_entry {
+            fs::file_time_type mtime;
+            size_t offset;
+            size_t size;
+        };
+        // The same for flexbuffers in the pack, loose files take precedence.
+        std::shared_ptr<mmap_file> pack_;
+        std::unordered_map<std::string, pack_index_entry> packed_flexbuffers_;
+        // Whether the pack is missing something or holds something stale.
+        bool pack_dirty_ = false;
 };
 
 flexbuffer_cache::flexbuffer_cache( const fs::path &cache_directory,
@@ -396,6 +683,13 @@ flexbuffer_cache::flexbuffer_cache( const fs::path &cache_directory,
 
 flexbuffer_cache::~flexbuffer_cache() = default;
 
+void flexbuffer_cache::write_pack()
+{
+    if( disk_cache_ ) {
+        disk_cache_->write_pack();
+    }
+}
+
 std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse( fs::path json_source_path,
         size_t offset )
 {
@@ -429,8 +723,8 @@ std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse_and_cache(
 
     // Is our cache potentially stale?
     if( disk_cache_ ) {
-        std::shared_ptr<flexbuffer_mmap_storage> cached_storage = disk_cache_->load_flexbuffer_if_not_stale(
-                    lexically_normal_json_source_path );
+        std::shared_ptr<flexbuffer_storage> cached_storage =
+            disk_cache_->load_flexbuffer_if_not_stale( lexically_normal_json_source_path );
         if( cached_storage ) {
             std::error_code ec;
             fs::file_time_type mtime = get_file_mtime_millis( lexically_normal_json_source_path, ec );
@@ -450,10 +744,17 @@ std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse_and_cache(
     std::string &json_source = *json_file_contents;
 
     const char *json_text = reinterpret_cast<const char *>( json_source.c_str() ) + offset;
-    std::vector<uint8_t> fb = parse_json_to_flexbuffer_( json_text, json_source_path_string.c_str() );
+    // Without a disk cache (saves) the file is read once and the buffer lives until the
+    // objects are loaded from it, so make it as small as possible.
+    std::vector<uint8_t> fb = parse_json_to_flexbuffer_( json_text, json_source_path_string.c_str(),
+                              !disk_cache_ );
 
     if( disk_cache_ ) {
         disk_cache_->save_to_disk( lexically_normal_json_source_path, fb );
+    } else {
+        // Drop the text first, so trimming the builder's slack doesn't raise the peak
+        json_file_contents.reset();
+        fb.shrink_to_fit();
     }
 
     auto storage = std::make_shared<flexbuffer_vector_storage>( std::move( fb ) );
@@ -475,3 +776,23 @@ std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse_buffer( std::string b
     auto storage = std::make_shared<flexbuffer_vector_storage>( std::move( fb ) );
     return std::make_shared<string_flexbuffer>( std::move( storage ), std::move( buffer ) );
 }
+
+std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::from_binary( std::vector<uint8_t> buffer,
+        fs::path source_path )
+{
+    // The root is described by the last two bytes: its type and its byte width.
+    const size_t root_width = buffer.size() < 3 ? 0 : buffer.back();
+    if( root_width != 1 && root_width != 2 && root_width != 4 && root_width != 8 ) {
+        throw std::runtime_error( "Invalid binary data in " + source_path.generic_u8string() );
+    }
+    auto storage = std::make_shared<flexbuffer_vector_storage>( std::move( buffer ) );
+    return std::make_shared<binary_flexbuffer>( std::move( storage ), std::move( source_path ) );
+}
+
+memory_accounting::usage flexbuffer_cache::memory_usage()
+{
+    memory_accounting::usage ret;
+    ret.count = live_storage_count;
+    ret.bytes = live_storage_bytes;
+    return ret;
+}
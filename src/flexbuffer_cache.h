@@ -5,11 +5,17 @@
 #include <iosfwd>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <flatbuffers/flexbuffers.h>
 
 #include <ghc/fs_std_fwd.hpp>
 
+namespace memory_accounting
+{
+struct usage;
+} // namespace memory_accounting
+
 struct flexbuffer_storage {
     virtual ~flexbuffer_storage() = default;
     virtual const uint8_t *data() const = 0;
@@ -62,6 +68,17 @@ class flexbuffer_cache
 
         static shared_flexbuffer parse_buffer( std::string buffer ) noexcept( false );
 
+        // Wraps an already built FlexBuffer, e.g. one read back from a binary save file.
+        static shared_flexbuffer from_binary( std::vector<uint8_t> buffer, fs::path source_path );
+
+        // Number and total size of all FlexBuffers currently alive, see memory_accounting.h.
+        static memory_accounting::usage memory_usage();
+
+        // Folds the FlexBuffers cached as loose files into a single pack file in the cache
+        // directory, which later runs map once instead of opening a file per json source.
+        // Does nothing if the pack is already up to date.
+        void write_pack();
+
     private:
         flexbuffer_cache( flexbuffer_cache && ) noexcept = default;
 
@@ -2,6 +2,9 @@
 #ifndef CATA_SRC_FLOOD_FILL_H
 #define CATA_SRC_FLOOD_FILL_H
 
+#include <array>
+#include <bitset>
+#include <memory>
 #include <queue>
 #include <vector>
 #include <unordered_set>
@@ -12,42 +15,54 @@
 namespace ff
 {
 /**
-* Given a starting point, flood fill out to the 4-connected points, applying the provided predicate
-* to determine if a given point should be added to the collection of flood-filled points, and then
-* return that collection.
-* @param starting_point starting point of the flood fill. No assumptions made about if it will satisfy
-* the predicate.
-* @param visited externally provided set of points that have already been designated as visited which
-* will be updated by this call.
-* @param predicate UnaryPredicate that will be provided with a point for evaluation as to whether or
-* not the point should be filled.
+* Like @ref point_flood_fill_4_connected below, but hands each filled point to @p visitor as it
+* is found instead of collecting them. The visitor may change what the predicate sees for points
+* that were already filled.
 */
-template<typename Point, typename UnaryPredicate>
-std::vector<Point> point_flood_fill_4_connected( const Point &starting_point,
-        std::unordered_set<Point> &visited, UnaryPredicate predicate )
+template<typename Point, typename UnaryPredicate, typename UnaryVisitor>
+void point_flood_fill_4_connected_visit( const Point &starting_point,
+        std::unordered_set<Point> &visited, UnaryPredicate predicate, UnaryVisitor visitor )
 {
-    std::vector<Point> filled_points;
     std::queue<Point> to_check;
     to_check.push( starting_point );
     while( !to_check.empty() ) {
         const Point current_point = to_check.front();
         to_check.pop();
 
-        if( visited.find( current_point ) != visited.end() ) {
+        if( !visited.emplace( current_point ).second ) {
             continue;
         }
 
-        visited.emplace( current_point );
-
         if( predicate( current_point ) ) {
-            filled_points.emplace_back( current_point );
+            visitor( current_point );
             to_check.push( current_point + point_south );
             to_check.push( current_point + point_north );
             to_check.push( current_point + point_east );
             to_check.push( current_point + point_west );
         }
     }
+}
 
+/**
+* Given a starting point, flood fill out to the 4-connected points, applying the provided predicate
+* to determine if a given point should be added to the collection of flood-filled points, and then
+* return that collection.
+* @param starting_point starting point of the flood fill. No assumptions made about if it will satisfy
+* the predicate.
+* @param visited externally provided set of points that have already been designated as visited which
+* will be updated by this call.
+* @param predicate UnaryPredicate that will be provided with a point for evaluation as to whether or
+* not the point should be filled.
+*/
+template<typename Point, typename UnaryPredicate>
+std::vector<Point> point_flood_fill_4_connected( const Point &starting_point,
+        std::unordered_set<Point> &visited, UnaryPredicate predicate )
+{
+    std::vector<Point> filled_points;
+    point_flood_fill_4_connected_visit( starting_point, visited, predicate,
+    [&filled_points]( const Point & p ) {
+        filled_points.emplace_back( p );
+    } );
     return filled_points;
 }
 
@@ -74,14 +89,54 @@ inline void add_span( std::vector<span> &spans, int startX, int endX,
                         clamp( y, 0, MAPSIZE_Y - 1 ), dy, clamped_z, dz );
 }
 
+/**
+ * Working memory of @ref flood_fill_visit_10_connected. Callers that fill often can keep one
+ * around, so the visited bitmaps and span stacks aren't allocated and zeroed on every call.
+ */
+struct flood_fill_scratch {
+    std::array<std::array<std::bitset<MAPSIZE_Y>, MAPSIZE_X>, OVERMAP_LAYERS> visited;
+    std::array<std::array<std::bitset<MAPSIZE_Y>, MAPSIZE_X>, OVERMAP_LAYERS> visited_vertically;
+    std::array<std::vector<span>, OVERMAP_LAYERS> spans_to_process;
+    // z-levels whose visited bitmaps may have bits set
+    std::bitset<OVERMAP_LAYERS> used_levels;
+
+    // Clears the levels used by the last fill, keeping the span capacity
+    void reset() {
+        for( int i = 0; i < OVERMAP_LAYERS; i++ ) {
+            if( used_levels.test( i ) ) {
+                for( std::bitset<MAPSIZE_Y> &row : visited[i] ) {
+                    row.reset();
+                }
+                for( std::bitset<MAPSIZE_Y> &row : visited_vertically[i] ) {
+                    row.reset();
+                }
+            }
+            spans_to_process[i].clear();
+        }
+        used_levels.reset();
+    }
+};
+
+template<typename UnaryPredicate, typename UnaryVisitor>
+void flood_fill_visit_10_connected( const tripoint_bub_ms &starting_point, UnaryPredicate predicate,
+                                    UnaryVisitor visitor, flood_fill_scratch &scratch );
 
 template<typename UnaryPredicate, typename UnaryVisitor>
 void flood_fill_visit_10_connected( const tripoint_bub_ms &starting_point, UnaryPredicate predicate,
                                     UnaryVisitor visitor )
 {
-    std::array<std::array<std::bitset<MAPSIZE_Y>, MAPSIZE_X>, OVERMAP_LAYERS> visited;
-    std::array<std::array<std::bitset<MAPSIZE_Y>, MAPSIZE_X>, OVERMAP_LAYERS> visited_vertically;
-    std::array<std::vector<span>, OVERMAP_LAYERS> spans_to_process;
+    std::unique_ptr<flood_fill_scratch> scratch = std::make_unique<flood_fill_scratch>();
+    flood_fill_visit_10_connected( starting_point, predicate, visitor, *scratch );
+}
+
+template<typename UnaryPredicate, typename UnaryVisitor>
+void flood_fill_visit_10_connected( const tripoint_bub_ms &starting_point, UnaryPredicate predicate,
+                                    UnaryVisitor visitor, flood_fill_scratch &scratch )
+{
+    scratch.reset();
+    auto &visited = scratch.visited;
+    auto &visited_vertically = scratch.visited_vertically;
+    auto &spans_to_process = scratch.spans_to_process;
     int current_z = starting_point.z();
     add_span( spans_to_process[current_z + OVERMAP_DEPTH], starting_point.x(), starting_point.x(),
               starting_point.y(), 1, starting_point.z(), 0 );
@@ -117,6 +172,7 @@ void flood_fill_visit_10_connected( const tripoint_bub_ms &starting_point, Unary
                 break;
             }
         }
+        scratch.used_levels.set( current_z + OVERMAP_DEPTH );
         tripoint_bub_ms current_point{ static_cast<int>( current_span.startX ), static_cast <int>( current_span.y ), static_cast<int>( current_span.z ) };
         // Special handling for spans with a vertical offset.
         if( current_span.dz != 0 ) {
@@ -344,6 +344,19 @@ static const zone_type_id zone_type_NO_AUTO_PICKUP( "NO_AUTO_PICKUP" );
 
 static constexpr int DANGEROUS_PROXIMITY = 5;
 
+static const option_handle<std::string> opt_sidebar_position( "SIDEBAR_POSITION" );
+static const option_handle<bool> opt_sidebar_spacers( "SIDEBAR_SPACERS" );
+static const option_handle<int> opt_safemodeproximity( "SAFEMODEPROXIMITY" );
+static const option_handle<int> opt_safemodeignoreturns( "SAFEMODEIGNORETURNS" );
+static const option_handle<bool> opt_autosafemode( "AUTOSAFEMODE" );
+static const option_handle<int> opt_autosafemodeturns( "AUTOSAFEMODETURNS" );
+static const option_handle<bool> opt_animations( "ANIMATIONS" );
+static const option_handle<int> opt_blink_speed( "BLINK_SPEED" );
+static const option_handle<bool> opt_vehicle_dir_indicator( "VEHICLE_DIR_INDICATOR" );
+static const option_handle<bool> opt_driving_view_offset( "DRIVING_VIEW_OFFSET" );
+static const option_handle<float> opt_npc_spawntime( "NPC_SPAWNTIME" );
+static const option_handle<int> opt_season_length( "SEASON_LENGTH" );
+
 #if defined(__ANDROID__)
 extern bool add_key_to_quick_shortcuts( int key, const std::string &category, bool back ); // NOLINT
 #endif
@@ -759,7 +772,7 @@ void game::setup()
     // invalidate calendar caches in case we were previously playing
     // a different world
     calendar::set_eternal_season( ::get_option<bool>( "ETERNAL_SEASON" ) );
-    calendar::set_season_length( ::get_option<int>( "SEASON_LENGTH" ) );
+    calendar::set_season_length( opt_season_length.get() );
 
     calendar::set_eternal_night( ::get_option<std::string>( "ETERNAL_TIME_OF_DAY" ) == "night" );
     calendar::set_eternal_day( ::get_option<std::string>( "ETERNAL_TIME_OF_DAY" ) == "day" );
@@ -830,6 +843,7 @@ bool game::start_game()
     weather.nextweather = calendar::turn;
     safe_mode = ( get_option<bool>( "SAFEMODE" ) ? SAFE_MODE_ON : SAFE_MODE_OFF );
     mostseen = 0; // ...and mostseen is 0, we haven't seen any monsters yet.
+    last_mon_info_inputs.reset();
     get_safemode().load_global();
 
     init_autosave();
@@ -1284,7 +1298,7 @@ static int veh_lumi( vehicle &veh )
 
 void game::calc_driving_offset( vehicle *veh )
 {
-    if( veh == nullptr || !get_option<bool>( "DRIVING_VIEW_OFFSET" ) ) {
+    if( veh == nullptr || !opt_driving_view_offset.get() ) {
         set_driving_view_offset( point_zero );
         return;
     }
@@ -1568,6 +1582,7 @@ void game::set_npcs_dirty()
 void game::set_critter_died()
 {
     critter_died = true;
+    critter_tracker->note_creatures_changed();
 }
 
 static int maptile_field_intensity( maptile &mt, field_type_id fld )
@@ -1577,9 +1592,9 @@ static int maptile_field_intensity( maptile &mt, field_type_id fld )
     return field_ptr == nullptr ? 0 : field_ptr->get_field_intensity();
 }
 
-units::temperature_delta get_heat_radiation( const tripoint &location )
+heat_sources scan_heat_sources( const tripoint &location )
 {
-    units::temperature_delta temp_mod = units::from_kelvin_delta( 0 );
+    heat_sources sources;
     Character &player_character = get_player_character();
     map &here = get_map();
     // Convert it to an int id once, instead of 139 times per turn
@@ -1608,46 +1623,24 @@ units::temperature_delta get_heat_radiation( const tripoint &location )
         }
         // Ensure fire_dist >= 1 to avoid divide-by-zero errors.
         const int fire_dist = std::max( 1, square_dist( dest, location ) );
-        temp_mod += units::from_fahrenheit_delta( 6.f * heat_intensity * heat_intensity / fire_dist );
+        sources.radiation += units::from_fahrenheit_delta( 6.f * heat_intensity * heat_intensity /
+                             fire_dist );
+        if( fire_dist <= 1 ) {
+            // Extend limbs/lean over a single adjacent fire to warm up
+            sources.best_fire = std::max( sources.best_fire, heat_intensity );
+        }
     }
-    return temp_mod;
+    return sources;
 }
 
-int get_best_fire( const tripoint &location )
+units::temperature_delta get_heat_radiation( const tripoint &location )
 {
-    int best_fire = 0;
-    Character &player_character = get_player_character();
-    map &here = get_map();
-    // Convert it to an int id once, instead of 139 times per turn
-    const field_type_id fd_fire_int = fd_fire.id();
-    for( const tripoint &dest : here.points_in_radius( location, 6 ) ) {
-        int heat_intensity = 0;
-
-        maptile mt = here.maptile_at( dest );
+    return get_weather().get_heat_sources( location ).radiation;
+}
 
-        int ffire = maptile_field_intensity( mt, fd_fire_int );
-        if( ffire > 0 ) {
-            heat_intensity = ffire;
-        } else  {
-            heat_intensity = mt.get_ter()->heat_radiation;
-        }
-        if( heat_intensity == 0 ) {
-            // No heat source here
-            continue;
-        }
-        if( player_character.pos() == location ) {
-            if( !here.clear_path( dest, location, -1, 1, 100 ) ) {
-                continue;
-            }
-        } else if( !here.sees( location, dest, -1 ) ) {
-            continue;
-        }
-        if( square_dist( dest, location ) <= 1 ) {
-            // Extend limbs/lean over a single adjacent fire to warm up
-            best_fire = std::max( best_fire, heat_intensity );
-        }
-    }
-    return best_fire;
+int get_best_fire( const tripoint &location )
+{
+    return get_weather().get_heat_sources( location ).best_fire;
 }
 
 units::temperature_delta get_convection_temperature( const tripoint &location )
@@ -2325,14 +2318,17 @@ bool game::handle_mouseview( input_context &ctxt, std::string &action )
         action = ctxt.handle_input();
         if( action == "MOUSE_MOVE" ) {
             const std::optional<tripoint> mouse_pos = ctxt.get_coordinates( w_terrain, ter_view_p.xy(), true );
+            // Moving within the same tile changes nothing, and redrawing would describe the
+            // whole tile again. In tiles mode that happens for nearly every mouse event.
             if( mouse_pos && ( !liveview_pos || *mouse_pos != *liveview_pos ) ) {
                 liveview_pos = mouse_pos;
                 liveview.show( *liveview_pos );
-            } else if( !mouse_pos ) {
+                ui_manager::redraw();
+            } else if( !mouse_pos && liveview.is_enabled() ) {
                 liveview_pos.reset();
                 liveview.hide();
+                ui_manager::redraw();
             }
-            ui_manager::redraw();
         }
     } while( action == "MOUSE_MOVE" ); // Freeze animation when moving the mouse
 
@@ -3112,6 +3108,7 @@ bool game::load( const save_t &name )
 
                     safe_mode = get_option<bool>( "SAFEMODE" ) ? SAFE_MODE_ON : SAFE_MODE_OFF;
                     mostseen = 0; // ...and mostseen is 0, we haven't seen any monsters yet.
+                    last_mon_info_inputs.reset();
 
                     init_autosave();
                     get_auto_pickup().load_character(); // Load character auto pickup rules
@@ -3149,7 +3146,7 @@ bool game::load( const save_t &name )
                     // anything else, to ensure they pick up the correct value from the save's
                     // worldoptions
                     calendar::set_eternal_season( ::get_option<bool>( "ETERNAL_SEASON" ) );
-                    calendar::set_season_length( ::get_option<int>( "SEASON_LENGTH" ) );
+                    calendar::set_season_length( opt_season_length.get() );
 
                     calendar::set_eternal_night(
                         ::get_option<std::string>( "ETERNAL_TIME_OF_DAY" ) == "night" );
@@ -3296,12 +3293,12 @@ bool game::save_factions_missions_npcs()
     }, _( "factions data" ) );
 }
 
-bool game::save_maps()
+bool game::save_maps( bool in_background )
 {
     try {
         m.save();
         overmap_buffer.save(); // can throw
-        MAPBUFFER.save(); // can throw
+        MAPBUFFER.save( false, in_background ); // can throw
         return true;
     } catch( const std::exception &err ) {
         popup( _( "Failed to save the maps: %s" ), err.what() );
@@ -3317,13 +3314,14 @@ bool game::save_player_data()
         serialize( fout );
     }, _( "player data" ) );
     const bool saved_map_memory = u.save_map_memory();
-    const bool saved_log = write_to_file( playerfile + SAVE_EXTENSION_LOG, [&](
+    // These rarely change between autosaves
+    const bool saved_log = write_to_file_if_changed( playerfile + SAVE_EXTENSION_LOG, [&](
     std::ostream & fout ) {
         memorial().save( fout );
     }, _( "player memorial" ) );
 #if defined(__ANDROID__)
-    const bool saved_shortcuts = write_to_file( playerfile + SAVE_EXTENSION_SHORTCUTS, [&](
-    std::ostream & fout ) {
+    const bool saved_shortcuts = write_to_file_if_changed( playerfile + SAVE_EXTENSION_SHORTCUTS,
+    [&]( std::ostream & fout ) {
         save_shortcuts( fout );
     }, _( "quick shortcuts" ) );
 #endif
@@ -3436,7 +3434,7 @@ spell_events &game::spell_events_subscriber()
     return *spell_events_ptr;
 }
 
-bool game::save()
+bool game::save( bool in_background )
 {
     std::chrono::seconds time_since_load =
         std::chrono::duration_cast<std::chrono::seconds>(
@@ -3447,7 +3445,7 @@ bool game::save()
         if( !save_player_data() ||
             !save_achievements() ||
             !save_factions_missions_npcs() ||
-            !save_maps() ||
+            !save_maps( in_background ) ||
             !get_auto_pickup().save_character() ||
             !get_auto_notes_settings().save( true ) ||
             !get_safemode().save_character() ||
@@ -3978,8 +3976,8 @@ void game::draw_panels( bool force_draw )
     const bool draw_this_turn = current_turn > previous_turn || force_draw;
     panel_manager &mgr = panel_manager::get_manager();
     int y = 0;
-    const bool sidebar_right = get_option<std::string>( "SIDEBAR_POSITION" ) == "right";
-    int spacer = get_option<bool>( "SIDEBAR_SPACERS" ) ? 1 : 0;
+    const bool sidebar_right = opt_sidebar_position.get() == "right";
+    int spacer = opt_sidebar_spacers.get() ? 1 : 0;
     // Total up height used by all panels, and see what is left over for log
     int log_height = 0;
     for( const window_panel &panel : mgr.get_current_layout().panels() ) {
@@ -4133,7 +4131,7 @@ void game::draw_ter( const tripoint &center, const bool looking, const bool draw
 
 std::optional<tripoint> game::get_veh_dir_indicator_location( bool next ) const
 {
-    if( !get_option<bool>( "VEHICLE_DIR_INDICATOR" ) ) {
+    if( !opt_vehicle_dir_indicator.get() ) {
         return std::nullopt;
     }
     const optional_vpart_position vp = m.veh_at( u.pos() );
@@ -4439,8 +4437,8 @@ character_id game::assign_npc_id()
 
 Creature *game::is_hostile_nearby()
 {
-    int distance = ( get_option<int>( "SAFEMODEPROXIMITY" ) <= 0 ) ? MAX_VIEW_DISTANCE :
-                   get_option<int>( "SAFEMODEPROXIMITY" );
+    int distance = ( opt_safemodeproximity.get() <= 0 ) ? MAX_VIEW_DISTANCE :
+                   opt_safemodeproximity.get();
     return is_hostile_within( distance );
 }
 
@@ -4562,8 +4560,27 @@ std::vector<monster *> game::get_fishable_monsters( std::unordered_set<tripoint>
 
 void game::mon_info_update( )
 {
+    // This runs after every action, most of which neither take time nor change what is around
+    mon_info_inputs inputs;
+    inputs.turn = calendar::turn;
+    inputs.pos = u.pos();
+    inputs.view_offset = u.view_offset;
+    inputs.moves = u.moves;
+    inputs.mode = safe_mode;
+    inputs.creatures_version = critter_tracker->creatures_version();
+    inputs.safemode_rules_version = get_safemode().rules_version();
+    inputs.safemode_proximity = opt_safemodeproximity.get();
+    inputs.safemode_ignore_turns = opt_safemodeignoreturns.get();
+    inputs.autosafemode = opt_autosafemode.get();
+    inputs.hostile_spotted = uistate.distraction_hostile_spotted;
+    inputs.driving = u.controlling_vehicle;
+    if( last_mon_info_inputs == inputs ) {
+        return;
+    }
+    last_mon_info_inputs = inputs;
+
     int newseen = 0;
-    const int safe_proxy_dist = get_option<int>( "SAFEMODEPROXIMITY" );
+    const int safe_proxy_dist = opt_safemodeproximity.get();
     const int iProxyDist = ( safe_proxy_dist <= 0 ) ? MAX_VIEW_DISTANCE :
                            safe_proxy_dist;
 
@@ -4590,7 +4607,7 @@ void game::mon_info_update( )
 
     static time_point previous_turn = calendar::turn_zero;
     const time_duration sm_ignored_turns =
-        time_duration::from_turns( get_option<int>( "SAFEMODEIGNORETURNS" ) );
+        time_duration::from_turns( opt_safemodeignoreturns.get() );
 
     for( Creature *c : u.get_visible_creatures( MAPSIZE_X ) ) {
         monster *m = dynamic_cast<monster *>( c );
@@ -4758,11 +4775,11 @@ void game::mon_info_update( )
         if( safe_mode == SAFE_MODE_ON ) {
             set_safe_mode( SAFE_MODE_STOP );
         }
-    } else if( calendar::turn > previous_turn && get_option<bool>( "AUTOSAFEMODE" ) &&
+    } else if( calendar::turn > previous_turn && opt_autosafemode.get() &&
                newseen == 0 ) { // Auto safe mode, but only if it's a new turn
         turnssincelastmon += calendar::turn - previous_turn;
         time_duration auto_safe_mode =
-            time_duration::from_turns( get_option<int>( "AUTOSAFEMODETURNS" ) );
+            time_duration::from_turns( opt_autosafemodeturns.get() );
         if( turnssincelastmon >= auto_safe_mode && safe_mode == SAFE_MODE_OFF ) {
             set_safe_mode( SAFE_MODE_ON );
             add_msg( m_info, _( "Safe mode ON!" ) );
@@ -6924,7 +6941,7 @@ void game::zones_manager()
             ui.position( point_zero, point_zero );
             return;
         }
-        offsetX = get_option<std::string>( "SIDEBAR_POSITION" ) != "left" ?
+        offsetX = opt_sidebar_position.get() != "left" ?
                   TERMX - width : 0;
         const int w_zone_height = TERMY - zone_ui_height;
         max_rows = w_zone_height - 2;
@@ -7181,7 +7198,7 @@ void game::zones_manager()
             const zone_data &zone = zones[active_index].get();
             zone_start = m.getlocal( zone.get_start_point() );
             zone_end = m.getlocal( zone.get_end_point() );
-            ctxt.set_timeout( get_option<int>( "BLINK_SPEED" ) );
+            ctxt.set_timeout( opt_blink_speed.get() );
         } else {
             blink = false;
             zone_start = zone_end = std::nullopt;
@@ -7638,7 +7655,7 @@ look_around_result game::look_around(
             int la_x = TERMX - panel_width;
             std::string position = get_option<std::string>( "LOOKAROUND_POSITION" );
             if( position == "left" ) {
-                if( get_option<std::string>( "SIDEBAR_POSITION" ) == "right" ) {
+                if( opt_sidebar_position.get() == "right" ) {
                     la_x = panel_manager::get_manager().get_width_left();
                 } else {
                     la_x = panel_manager::get_manager().get_width_left() - panel_width;
@@ -7802,7 +7819,7 @@ look_around_result game::look_around(
         ui_manager::redraw();
 
         if( ( select_zone && has_first_point ) || is_moving_zone ) {
-            ctxt.set_timeout( get_option<int>( "BLINK_SPEED" ) );
+            ctxt.set_timeout( opt_blink_speed.get() );
         }
 
         //Wait for input
@@ -7814,7 +7831,16 @@ look_around_result game::look_around(
         if( edge_scrolling ) {
             action = ctxt.handle_input( scroll_timeout );
         } else {
-            action = ctxt.handle_input();
+            // Moving the mouse within the looked at tile changes nothing, so don't describe
+            // the tile and redraw the map again for it
+            const auto mouse_on_same_tile = [&]() {
+                const std::optional<tripoint> mouse_pos = ctxt.get_coordinates( w_terrain,
+                        ter_view_p.xy(), true );
+                return mouse_pos && mouse_pos->xy() == lp.xy().raw();
+            };
+            do {
+                action = ctxt.handle_input();
+            } while( action == "MOUSE_MOVE" && mouse_on_same_tile() );
         }
         if( ( action == "LEVEL_UP" || action == "LEVEL_DOWN" || action == "MOUSE_MOVE" ||
               ctxt.get_direction( action ) ) && ( ( select_zone && has_first_point ) || is_moving_zone ) ) {
@@ -9131,8 +9157,8 @@ game::vmenu_ret game::list_monsters( const std::vector<Creature *> &monster_list
                 const monster *m = dynamic_cast<monster *>( cCurMon );
                 const std::string monName = ( m != nullptr ) ? m->name() : "human";
 
-                get_safemode().add_rule( monName, Creature::Attitude::ANY, get_option<int>( "SAFEMODEPROXIMITY" ),
-                                         rule_state::BLACKLISTED );
+                get_safemode().add_rule( monName, Creature::Attitude::ANY,
+                                         opt_safemodeproximity.get(), rule_state::BLACKLISTED );
             }
         } else if( action == "look" ) {
             hide_ui = true;
@@ -10677,7 +10703,7 @@ bool game::walk_move( const tripoint &dest_loc, const bool via_ramp, const bool
         cata_event_dispatch::avatar_moves( old_abs_pos, u, m );
 
         // Add trail animation when sprinting
-        if( get_option<bool>( "ANIMATIONS" ) && u.is_running() ) {
+        if( opt_animations.get() && u.is_running() ) {
             if( u.posy() < oldpos.y ) {
                 if( u.posx() < oldpos.x ) {
                     draw_async_anim( oldpos, "run_nw", "\\", c_light_gray );
@@ -11645,7 +11671,7 @@ bool game::fling_creature( Creature *c, const units::angle &dir, float flvel, bo
     bool thru = true;
     const bool is_u = c == &u;
     // Don't animate critters getting bashed if animations are off
-    const bool animate = is_u || get_option<bool>( "ANIMATIONS" );
+    const bool animate = is_u || opt_animations.get();
 
     Character *you = dynamic_cast<Character *>( c );
 
@@ -12570,9 +12596,10 @@ point game::update_map( int &x, int &y, bool z_level_changed )
     // Put those in the active list.
     load_npcs();
 
-    // Make sure map cache is consistent since it may have shifted.
+    // Make sure map cache is consistent since it may have shifted. The transparency cache
+    // was moved along with the submaps by map::shift.
     for( int zlev = -OVERMAP_DEPTH; zlev <= OVERMAP_HEIGHT; ++zlev ) {
-        m.invalidate_map_cache( zlev );
+        m.invalidate_map_cache( zlev, true );
     }
     m.build_map_cache( m.get_abs_sub().z() );
 
@@ -12677,7 +12704,7 @@ void game::perhaps_add_random_npc( bool ignore_spawn_timers_and_rates )
     }
     // Create a new NPC?
 
-    double spawn_time = get_option<float>( "NPC_SPAWNTIME" );
+    double spawn_time = opt_npc_spawntime.get();
     if( !ignore_spawn_timers_and_rates && spawn_time == 0.0 ) {
         return;
     }
@@ -12919,7 +12946,7 @@ void game::init_autosave()
     last_save_timestamp = std::time( nullptr );
 }
 
-void game::quicksave()
+void game::quicksave( bool in_background )
 {
     //Don't autosave if the player hasn't done anything since the last autosave/quicksave,
     if( !moves_since_last_save ) {
@@ -12935,7 +12962,7 @@ void game::quicksave()
     time_t now = std::time( nullptr ); //timestamp for start of saving procedure
 
     //perform save
-    save();
+    save( in_background );
     //Now reset counters for autosaving, so we don't immediately autosave after a quicksave or autosave.
     moves_since_last_save = 0;
     last_save_timestamp = now;
@@ -12974,7 +13001,8 @@ void game::autosave()
     if( std::time( nullptr ) < last_save_timestamp + 60 * get_option<int>( "AUTOSAVE_MINUTES" ) ) {
         return;
     }
-    quicksave();    //Driving checks are handled by quicksave()
+    // The map is the bulk of the save, so optionally let it be written while the game goes on.
+    quicksave( get_option<bool>( "ASYNC_AUTOSAVE" ) ); //Driving checks are handled by quicksave()
 }
 
 void game::start_calendar()
@@ -12983,7 +13011,8 @@ void game::start_calendar()
     calendar::start_of_game = scen->start_of_game();
     calendar::turn = calendar::start_of_game;
     calendar::initial_season = static_cast<season_type>( ( to_days<int>( calendar::start_of_game -
-                               calendar::turn_zero ) / get_option<int>( "SEASON_LENGTH" ) ) % season_type::NUM_SEASONS );
+                               calendar::turn_zero ) / opt_season_length.get() ) %
+                               season_type::NUM_SEASONS );
 }
 
 overmap &game::get_cur_om() const
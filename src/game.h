@@ -211,8 +211,11 @@ class game
         void unserialize_master( const cata_path &file_name, std::istream &fin ); // for load
         void unserialize_master( const JsonValue &jv ); // for load
 
-        /** Returns false if saving failed. */
-        bool save();
+        /**
+         * Returns false if saving failed.
+         * @param in_background Leave writing the map files to the background file writer.
+         */
+        bool save( bool in_background = false );
 
         /** Returns a list of currently active character saves. */
         std::vector<std::string> list_active_saves();
@@ -853,7 +856,7 @@ class game
         void reset_npc_dispositions();
         void serialize_master( std::ostream &fout );
         // returns false if saving failed for whatever reason
-        bool save_maps();
+        bool save_maps( bool in_background = false );
 #if defined(__ANDROID__)
         void save_shortcuts( std::ostream &fout );
 #endif
@@ -1008,7 +1011,7 @@ class game
         //  int autosave_timeout();  // If autosave enabled, how long we should wait for user inaction before saving.
         void autosave();         // automatic quicksaves - Performs some checks before calling quicksave()
     public:
-        void quicksave();        // Saves the game without quitting
+        void quicksave( bool in_background = false ); // Saves the game without quitting
         void quickload();        // Loads the previously saved game if it exists
         void disp_NPCs();        // Currently for debug use.  Lists global NPCs.
 
@@ -1160,6 +1163,34 @@ class game
         std::string list_item_downvote; // NOLINT(cata-serialize)
 
         bool safe_mode_warning_logged = false; // NOLINT(cata-serialize)
+        // What mon_info_update last went by. While none of it changes, neither do the
+        // creatures seen nor the safe mode decisions, so there is nothing to redo.
+        struct mon_info_inputs {
+            time_point turn;
+            tripoint pos;
+            tripoint view_offset;
+            int moves = 0;
+            safe_mode_type mode = SAFE_MODE_OFF;
+            unsigned int creatures_version = 0;
+            unsigned int safemode_rules_version = 0;
+            int safemode_proximity = 0;
+            int safemode_ignore_turns = 0;
+            bool autosafemode = false;
+            bool hostile_spotted = false;
+            bool driving = false;
+
+            bool operator==( const mon_info_inputs &rhs ) const {
+                return turn == rhs.turn && pos == rhs.pos && view_offset == rhs.view_offset &&
+                       moves == rhs.moves && mode == rhs.mode &&
+                       creatures_version == rhs.creatures_version &&
+                       safemode_rules_version == rhs.safemode_rules_version &&
+                       safemode_proximity == rhs.safemode_proximity &&
+                       safemode_ignore_turns == rhs.safemode_ignore_turns &&
+                       autosafemode == rhs.autosafemode && hostile_spotted == rhs.hostile_spotted &&
+                       driving == rhs.driving;
+            }
+        };
+        std::optional<mon_info_inputs> last_mon_info_inputs; // NOLINT(cata-serialize)
         bool bVMonsterLookFire = false;
         character_id next_npc_id; // NOLINT(cata-serialize)
         int next_mission_id = 0; // NOLINT(cata-serialize)
@@ -1275,6 +1306,8 @@ class game
             bool deploy_affordance = false );
 };
 
+// Looks for heat sources around location, uncached, see weather_manager::get_heat_sources
+heat_sources scan_heat_sources( const tripoint &location );
 // Returns temperature modifier from direct heat radiation of nearby sources
 // @param location Location affected by heat sources
 units::temperature_delta get_heat_radiation( const tripoint &location );
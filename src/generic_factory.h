@@ -4,8 +4,10 @@
 
 #include <algorithm>
 #include <bitset>
+#include <functional>
 #include <set>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "assign.h"
@@ -134,6 +136,38 @@ class generic_factory
             do {
                 version++;
             } while( version == INVALID_VERSION );
+            frozen_index.clear();
+        }
+
+        // Copy of `map` as a flat open-addressing table, built by `finalize` once loading is
+        // done. Any later change to the ids empties it and lookups go back to `map`.
+        std::vector<std::pair<string_id<T>, int_id<T>>> frozen_index;
+
+        void freeze_index() {
+            size_t capacity = 1;
+            while( capacity < map.size() * 2 ) {
+                capacity *= 2;
+            }
+            frozen_index.assign( capacity, { string_id<T>(), int_id<T>( INVALID_CID ) } );
+            for( const std::pair<const string_id<T>, int_id<T>> &entry : map ) {
+                size_t slot = std::hash<string_id<T>>()( entry.first ) & ( capacity - 1 );
+                while( frozen_index[slot].second.to_i() != INVALID_CID ) {
+                    slot = ( slot + 1 ) & ( capacity - 1 );
+                }
+                frozen_index[slot] = entry;
+            }
+        }
+
+        const int_id<T> *find_frozen( const string_id<T> &id ) const {
+            const size_t mask = frozen_index.size() - 1;
+            size_t slot = std::hash<string_id<T>>()( id ) & mask;
+            while( frozen_index[slot].second.to_i() != INVALID_CID ) {
+                if( frozen_index[slot].first == id ) {
+                    return &frozen_index[slot].second;
+                }
+                slot = ( slot + 1 ) & mask;
+            }
+            return nullptr;
         }
 
     protected:
@@ -152,8 +186,18 @@ class generic_factory
                 result = int_id<T>( id._cid );
                 return is_valid( result );
             }
-            const auto iter = map.find( id );
             // map lookup happens at most once per string_id instance per generic_factory::version
+            if( !frozen_index.empty() ) {
+                const int_id<T> *found = find_frozen( id );
+                if( found == nullptr ) {
+                    id.set_cid_version( INVALID_CID, version );
+                    return false;
+                }
+                result = *found;
+                id.set_cid_version( result.to_i(), version );
+                return true;
+            }
+            const auto iter = map.find( id );
             // id was not found, explicitly marking it as "invalid"
             if( iter == map.end() ) {
                 id.set_cid_version( INVALID_CID, version );
@@ -169,6 +213,7 @@ class generic_factory
             if( !find_id( id, i_id ) ) {
                 return;
             }
+            frozen_index.clear();
             auto iter = map.begin();
             const auto end = map.end();
             while( iter != end ) {
@@ -405,6 +450,7 @@ class generic_factory
             for( size_t i = 0; i < list.size(); i++ ) {
                 list[i].id.set_cid_version( static_cast<int>( i ), version );
             }
+            freeze_index();
         }
 
         /**
@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "json.h"
+#include "var_storage.h"
 
 enum class var_type : int {
     u,
@@ -21,16 +22,21 @@ class global_variables
     public:
         // Methods for setting/getting misc key/value pairs.
         void set_global_value( const std::string &key, const std::string &value ) {
-            global_values[ key ] = value;
+            global_values.set( key, value );
+        }
+        void set_global_value( const var_key &key, const std::string &value ) {
+            global_values.set( key, value );
         }
 
         void remove_global_value( const std::string &key ) {
-            global_values.erase( key );
+            global_values.remove( key );
         }
 
         std::optional<std::string> maybe_get_global_value( const std::string &key ) const {
-            auto it = global_values.find( key );
-            return it == global_values.end() ? std::nullopt : std::optional<std::string> { it->second };
+            return global_values.get( key );
+        }
+        std::optional<std::string> maybe_get_global_value( const var_key &key ) const {
+            return global_values.get( key );
         }
 
         std::string get_global_value( const std::string &key ) const {
@@ -38,15 +44,15 @@ class global_variables
         }
 
         std::unordered_map<std::string, std::string> get_global_values() const {
-            return global_values;
+            return global_values.to_map();
         }
 
         void clear_global_values() {
             global_values.clear();
         }
 
-        void set_global_values( std::unordered_map<std::string, std::string> input ) {
-            global_values = std::move( input );
+        void set_global_values( const std::unordered_map<std::string, std::string> &input ) {
+            global_values.assign( input );
         }
         void unserialize( JsonObject &jo );
         void serialize( JsonOut &jsout ) const;
@@ -55,7 +61,7 @@ class global_variables
         static void load_migrations( const JsonObject &jo, const std::string_view &src );
 
     private:
-        std::unordered_map<std::string, std::string> global_values;
+        var_storage global_values;
 };
 global_variables &get_globals();
 
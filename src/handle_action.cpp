@@ -165,6 +165,13 @@ static const zone_type_id zone_type_VEHICLE_REPAIR( "VEHICLE_REPAIR" );
 
 static const std::string flag_CANT_DRAG( "CANT_DRAG" );
 
+static const option_handle<float> opt_turn_duration( "TURN_DURATION" );
+static const option_handle<int> opt_animation_delay( "ANIMATION_DELAY" );
+static const option_handle<int> opt_blink_speed( "BLINK_SPEED" );
+static const option_handle<bool> opt_animations( "ANIMATIONS" );
+static const option_handle<bool> opt_animation_rain( "ANIMATION_RAIN" );
+static const option_handle<bool> opt_animation_sct( "ANIMATION_SCT" );
+
 #define dbg(x) DebugLog((x),D_GAME) << __FILE__ << ":" << __LINE__ << ": "
 
 #if defined(__ANDROID__)
@@ -189,7 +196,7 @@ class user_turn
         }
 
         int moves_elapsed() {
-            const float turn_duration = get_option<float>( "TURN_DURATION" );
+            const float turn_duration = opt_turn_duration.get();
             // Magic number 0.005 chosen due to option menu's 2 digit precision and
             // the option menu UI rounding <= 0.005 down to "0.00" in the display.
             // This conditional will catch values (e.g. 0.003) that the options menu
@@ -208,7 +215,7 @@ class user_turn
             std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
             std::chrono::milliseconds elapsed_ms =
                 std::chrono::duration_cast<std::chrono::milliseconds>( now - user_turn_start );
-            return elapsed_ms.count() > get_option<int>( "ANIMATION_DELAY" );
+            return elapsed_ms.count() > opt_animation_delay.get();
         }
 
         std::chrono::steady_clock::time_point last_blink_transition = std::chrono::steady_clock::now();
@@ -216,7 +223,7 @@ class user_turn
             std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
             std::chrono::milliseconds elapsed_ms =
                 std::chrono::duration_cast<std::chrono::milliseconds>( now - last_blink_transition );
-            if( elapsed_ms.count() > get_option<int>( "BLINK_SPEED" ) ) {
+            if( elapsed_ms.count() > opt_blink_speed.get() ) {
                 last_blink_transition = now;
                 return true;
             }
@@ -256,6 +263,8 @@ input_context game::get_player_input( std::string &action )
     }
 
     m.update_visibility_cache( u.posz() );
+    // Draw what a capped redraw during the turn left pending before waiting for input
+    ui_manager::redraw_invalidated();
     const visibility_variables &cache = m.get_visibility_variables_cache();
     const level_cache &map_cache = m.get_cache_ref( u.posz() );
     const auto &visibility_cache = map_cache.visibility_cache;
@@ -266,7 +275,7 @@ input_context game::get_player_input( std::string &action )
 
     user_turn current_turn;
 
-    if( get_option<bool>( "ANIMATIONS" ) ) {
+    if( opt_animations.get() ) {
         const int TOTAL_VIEW = MAX_VIEW_DISTANCE * 2 + 1;
         point iStart( ( TERRAIN_WINDOW_WIDTH > TOTAL_VIEW ) ? ( TERRAIN_WINDOW_WIDTH - TOTAL_VIEW ) / 2 : 0,
                       ( TERRAIN_WINDOW_HEIGHT > TOTAL_VIEW ) ? ( TERRAIN_WINDOW_HEIGHT - TOTAL_VIEW ) / 2 :
@@ -325,7 +334,7 @@ input_context game::get_player_input( std::string &action )
 
         creature_tracker &creatures = get_creature_tracker();
         do {
-            if( bWeatherEffect && get_option<bool>( "ANIMATION_RAIN" ) ) {
+            if( bWeatherEffect && opt_animation_rain.get() ) {
                 /*
                 Location to add rain drop animation bits! Since it refreshes w_terrain it can be added to the animation section easily
                 Get tile information from above's weather information:
@@ -352,7 +361,7 @@ input_context game::get_player_input( std::string &action )
                 }
             }
             // don't bother calculating SCT if we won't show it
-            if( uquit != QUIT_WATCH && get_option<bool>( "ANIMATION_SCT" ) && !SCT.vSCT.empty() ) {
+            if( uquit != QUIT_WATCH && opt_animation_sct.get() && !SCT.vSCT.empty() ) {
                 invalidate_main_ui_adaptor();
 
                 SCT.advanceAllSteps();
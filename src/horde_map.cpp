@@ -0,0 +1,58 @@
+#include "horde_map.h"
+
+namespace
+{
+struct compare_position {
+    bool operator()( const horde_map::value_type &lhs, const horde_map::value_type &rhs ) const {
+        return lhs.first < rhs.first;
+    }
+    bool operator()( const horde_map::value_type &lhs, const tripoint_om_sm &rhs ) const {
+        return lhs.first < rhs;
+    }
+    bool operator()( const tripoint_om_sm &lhs, const horde_map::value_type &rhs ) const {
+        return lhs < rhs.first;
+    }
+};
+} // namespace
+
+void horde_map::emplace( const tripoint_om_sm &p, const mongroup &group )
+{
+    if( sorted && !groups.empty() && p < groups.back().first ) {
+        sorted = false;
+    }
+    groups.emplace_back( p, group );
+}
+
+std::pair<horde_map::iterator, horde_map::iterator> horde_map::equal_range(
+    const tripoint_om_sm &p )
+{
+    sort();
+    return std::equal_range( groups.begin(), groups.end(), p, compare_position() );
+}
+
+std::pair<horde_map::const_iterator, horde_map::const_iterator> horde_map::equal_range(
+    const tripoint_om_sm &p ) const
+{
+    sort();
+    return std::equal_range( groups.cbegin(), groups.cend(), p, compare_position() );
+}
+
+void horde_map::update_positions()
+{
+    for( value_type &entry : groups ) {
+        const tripoint_om_sm p = entry.second.rel_pos();
+        if( p != entry.first ) {
+            entry.first = p;
+            sorted = false;
+        }
+    }
+}
+
+void horde_map::sort() const
+{
+    if( !sorted ) {
+        // Stable, so groups sharing a submap keep the order they were added in
+        std::stable_sort( groups.begin(), groups.end(), compare_position() );
+        sorted = true;
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+#ifndef CATA_SRC_HORDE_MAP_H
+#define CATA_SRC_HORDE_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "coordinates.h"
+#include "mongroup.h"
+
+/** A sound hordes may follow, see @ref overmapbuffer::signal_hordes. */
+struct horde_signal {
+    tripoint_abs_sm center;
+    int power = 0;
+};
+
+/**
+ * The monster groups of one overmap, keyed by their submap within it.
+ *
+ * Groups are kept in one flat vector. Lookups by position go through a sorted order that
+ * is only rebuilt when groups were added or moved since the last lookup, so hordes can be
+ * moved in place with @ref update_positions instead of being erased and reinserted.
+ *
+ * Pointers and iterators to groups are invalidated by anything that adds, removes or
+ * moves groups.
+ */
+class horde_map
+{
+    public:
+        using value_type = std::pair<tripoint_om_sm, mongroup>;
+        using iterator = std::vector<value_type>::iterator;
+        using const_iterator = std::vector<value_type>::const_iterator;
+
+        iterator begin() {
+            return groups.begin();
+        }
+        iterator end() {
+            return groups.end();
+        }
+        const_iterator begin() const {
+            return groups.begin();
+        }
+        const_iterator end() const {
+            return groups.end();
+        }
+        size_t size() const {
+            return groups.size();
+        }
+        bool empty() const {
+            return groups.empty();
+        }
+        void clear() {
+            groups.clear();
+            sorted = true;
+        }
+
+        void emplace( const tripoint_om_sm &p, const mongroup &group );
+        /** Groups at @p p, in the order they were added. */
+        std::pair<iterator, iterator> equal_range( const tripoint_om_sm &p );
+        std::pair<const_iterator, const_iterator> equal_range( const tripoint_om_sm &p ) const;
+
+        iterator erase( const_iterator it ) {
+            return groups.erase( it );
+        }
+        /** Removes every group for which @p pred returns true. */
+        template<typename Predicate>
+        void erase_if( Predicate pred ) {
+            groups.erase( std::remove_if( groups.begin(), groups.end(),
+            [&pred]( const value_type & entry ) {
+                return pred( entry.second );
+            } ), groups.end() );
+        }
+
+        /** Re-keys every group by its @ref mongroup::rel_pos, after moving them in place. */
+        void update_positions();
+
+    private:
+        void sort() const;
+
+        // Mutable so that const lookups can restore the order
+        mutable std::vector<value_type> groups;
+        mutable bool sorted = true;
+};
+
+#endif // CATA_SRC_HORDE_MAP_H
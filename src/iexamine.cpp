@@ -2208,11 +2208,11 @@ void iexamine::flower_poppy( Character &you, const tripoint &examp )
         add_msg( m_warning, _( "This flower has a heady aroma." ) );
     }
 
-    weather_sum recentWeather = sum_conditions( calendar::turn - 10_minutes, calendar::turn,
-                                you.get_location() );
+    const int recent_rain = rain_amount_between( calendar::turn - 10_minutes, calendar::turn,
+                            you.get_location() );
 
     // If it has been raining recently, then this event is twice less likely.
-    if( ( ( recentWeather.rain_amount > 1 ) ? one_in( 6 ) : one_in( 3 ) ) && resist < 5 ) {
+    if( ( ( recent_rain > 1 ) ? one_in( 6 ) : one_in( 3 ) ) && resist < 5 ) {
         // Should user player::infect, but can't!
         // player::infect needs to be restructured to return a bool indicating success.
         add_msg( m_bad, _( "The flower's fragrance makes you extremely drowsy…" ) );
@@ -1,10 +1,15 @@
 #include "init.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <exception>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 #include <vector>
 
 #include "achievement.h"
@@ -18,8 +23,10 @@
 #include "bodygraph.h"
 #include "bodypart.h"
 #include "butchery_requirements.h"
+#include "cached_options.h"
 #include "cata_assert.h"
 #include "cata_scope_helpers.h"
+#include "cata_utility.h"
 #include "character_modifier.h"
 #include "city.h"
 #include "climbing.h"
@@ -44,7 +51,9 @@
 #include "filesystem.h"
 #include "flag.h"
 #include "gates.h"
+#include "get_version.h"
 #include "harvest.h"
+#include "hash_utils.h"
 #include "input.h"
 #include "item_action.h"
 #include "item_category.h"
@@ -78,6 +87,7 @@
 #include "overmap.h"
 #include "overmap_connection.h"
 #include "overmap_location.h"
+#include "path_info.h"
 #include "profession.h"
 #include "profession_group.h"
 #include "proficiency.h"
@@ -96,6 +106,7 @@
 #include "speech.h"
 #include "speed_description.h"
 #include "start_location.h"
+#include "string_formatter.h"
 #include "test_data.h"
 #include "text_snippets.h"
 #include "translations.h"
@@ -107,6 +118,7 @@
 #include "weakpoint.h"
 #include "weather_type.h"
 #include "widget.h"
+#include "worker_pool.h"
 #include "worldfactory.h"
 
 DynamicDataLoader::DynamicDataLoader()
@@ -511,14 +523,42 @@ void DynamicDataLoader::load_data_from_path( const cata_path &path, const std::s
         files.emplace_back( path );
     }
 
-    // iterate over each file
     for( const cata_path &file : files ) {
-        try {
-            // parse it
-            JsonValue jsin = json_loader::from_path( file );
-            load_all_from_json( jsin, src, ui, path, file );
-        } catch( const JsonError &err ) {
-            throw std::runtime_error( err.what() );
+        std::error_code ec;
+        const fs::path real_path = file.get_unrelative_path();
+        cata::hash_combine( loaded_files_hash, real_path.generic_u8string() );
+        cata::hash_combine( loaded_files_hash, fs::file_size( real_path, ec ) );
+        cata::hash_combine( loaded_files_hash,
+                            fs::last_write_time( real_path, ec ).time_since_epoch().count() );
+    }
+
+    // Parsing the files doesn't depend on anything else, so it is spread over the worker pool.
+    // The parsed files are still handed to the loaders in their original order, as later files
+    // may override or rely on earlier ones. Batches keep only some of the files in memory at once.
+    static constexpr size_t batch_size = 256;
+    for( size_t batch_start = 0; batch_start < files.size(); batch_start += batch_size ) {
+        const size_t batch_end = std::min( files.size(), batch_start + batch_size );
+        std::vector<std::optional<JsonValue>> parsed( batch_end - batch_start );
+        std::vector<std::exception_ptr> errors( batch_end - batch_start );
+        get_worker_pool().parallel_for( parsed.size(), [&]( const size_t i ) {
+            try {
+                parsed[i] = json_loader::from_path( files[batch_start + i] );
+            } catch( ... ) {
+                errors[i] = std::current_exception();
+            }
+        } );
+
+        for( size_t i = 0; i < parsed.size(); ++i ) {
+            try {
+                if( errors[i] ) {
+                    std::rethrow_exception( errors[i] );
+                }
+                load_all_from_json( *parsed[i], src, ui, path, files[batch_start + i] );
+            } catch( const JsonError &err ) {
+                throw std::runtime_error( err.what() );
+            }
+            // Release the file once it is loaded, like the serial loop used to.
+            parsed[i].reset();
         }
     }
 }
@@ -547,6 +587,7 @@ void DynamicDataLoader::load_all_from_json( const JsonValue &jsin, const std::st
 void DynamicDataLoader::unload_data()
 {
     finalized = false;
+    loaded_files_hash = 0;
 
     achievement::reset();
     activity_type::reset();
@@ -770,10 +811,47 @@ void DynamicDataLoader::finalize_loaded_data( loading_ui &ui )
         ui.proceed();
     }
 
-    check_consistency( ui );
+    // The checks only depend on the loaded data, so they don't need to be repeated for data
+    // that has passed them before. That's most launches of the same game with the same mods.
+    const std::string checked_path = PATH_INFO::cache_dir() + "checked_data.txt";
+    const std::string stamp = loaded_data_stamp();
+    std::vector<std::string> checked_stamps;
+    if( !test_mode ) {
+        read_from_file_optional( checked_path, [&]( std::istream & fin ) {
+            std::string line;
+            while( std::getline( fin, line ) ) {
+                checked_stamps.push_back( line );
+            }
+        } );
+    }
+    if( std::find( checked_stamps.begin(), checked_stamps.end(), stamp ) == checked_stamps.end() ) {
+        check_consistency( ui );
+        if( !test_mode && !debug_has_error_been_observed() ) {
+            // Remember a few, e.g. for switching between worlds with different mods.
+            static constexpr size_t max_checked_stamps = 8;
+            checked_stamps.push_back( stamp );
+            if( checked_stamps.size() > max_checked_stamps ) {
+                checked_stamps.erase( checked_stamps.begin(),
+                                      checked_stamps.end() - max_checked_stamps );
+            }
+            assure_dir_exist( PATH_INFO::cache_dir() );
+            write_to_file( checked_path, [&]( std::ostream & fout ) {
+                for( const std::string &checked : checked_stamps ) {
+                    fout << checked << '\n';
+                }
+            }, nullptr );
+        }
+    }
+    // Everything is loaded, so whatever was parsed anew is now in the loose cache files
+    json_loader::pack_caches();
     finalized = true;
 }
 
+std::string DynamicDataLoader::loaded_data_stamp() const
+{
+    return string_format( "%s %zx", getVersionString(), loaded_files_hash );
+}
+
 void DynamicDataLoader::check_consistency( loading_ui &ui )
 {
     ui.new_context( _( "Verifying" ) );
@@ -872,8 +950,20 @@ void DynamicDataLoader::check_consistency( loading_ui &ui )
     }
 
     ui.show();
+    // The checks stay on the main thread: they resolve and intern string ids, fill lazy caches
+    // and report through debugmsg, none of which is safe to do from several threads at once.
+    // Their timings are logged so the slow ones can be found and sped up instead.
+    using clock = std::chrono::steady_clock;
+    const auto elapsed_ms = []( const clock::time_point & since ) {
+        return std::chrono::duration<double, std::milli>( clock::now() - since ).count();
+    };
+    const clock::time_point all_start = clock::now();
     for( const named_entry &e : entries ) {
+        const clock::time_point start = clock::now();
         e.second();
+        DebugLog( D_INFO, DC_ALL ) << "Verified " << e.first << " in " << elapsed_ms( start ) <<
+                                   " ms";
         ui.proceed();
     }
+    DebugLog( D_INFO, DC_ALL ) << "Verified all data in " << elapsed_ms( all_start ) << " ms";
 }
@@ -66,6 +66,12 @@ class DynamicDataLoader
 
     private:
         bool finalized = false;
+        // Hash of the names, sizes and modification times of all data files loaded so far,
+        // used to recognize data that has been checked for consistency before.
+        std::size_t loaded_files_hash = 0;
+
+        /** @returns stamp identifying the loaded data together with the game version. */
+        std::string loaded_data_stamp() const;
 
         struct cached_streams;
 
@@ -22,6 +22,7 @@
 #include "flexbuffer_json-inl.h"
 #include "flexbuffer_json.h"
 #include "input_context.h" // IWYU pragma: keep
+#include "input_replay.h"
 #include "json.h"
 #include "json_error.h"
 #include "json_loader.h"
@@ -882,6 +883,23 @@ void input_manager::add_input_for_action(
     events.push_back( event );
 }
 
+input_event input_manager::get_input_event( const keyboard_mode preferred_keyboard_mode )
+{
+    if( input_replay::replaying() ) {
+        input_event evt = input_replay::next_event();
+        previously_pressed_key = 0;
+        const bool key = evt.type == input_event_t::keyboard_char ||
+                         evt.type == input_event_t::keyboard_code;
+        if( key && !evt.sequence.empty() ) {
+            previously_pressed_key = evt.get_first_input();
+        }
+        return evt;
+    }
+    input_event evt = get_device_input_event( preferred_keyboard_mode );
+    input_replay::record( evt );
+    return evt;
+}
+
 int input_manager::get_previously_pressed_key() const
 {
     return previously_pressed_key;
@@ -254,7 +254,8 @@ class input_manager
         /**
          * curses getch() replacement.
          *
-         * Defined in the respective platform wrapper, e.g. sdlcurse.cpp
+         * Reads from @ref get_device_input_event, or from the recording when replaying
+         * one (see input_replay.h).
          */
         input_event get_input_event( keyboard_mode preferred_keyboard_mode = keyboard_mode::keycode );
         /**
@@ -286,6 +287,13 @@ class input_manager
     private:
         friend class input_context;
 
+        /**
+         * Reads the next event from the keyboard, mouse or window system.
+         *
+         * Defined in the respective platform wrapper, e.g. sdlcurse.cpp
+         */
+        input_event get_device_input_event( keyboard_mode preferred_keyboard_mode );
+
         using t_input_event_list = std::vector<input_event>;
         using t_actions = std::map<std::string, action_attributes>;
         using t_action_contexts = std::map<std::string, t_actions>;
@@ -0,0 +1,273 @@
+#include "input_replay.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_utility.h"
+#include "cursesdef.h"
+#include "debug.h"
+#include "flexbuffer_json.h"
+#include "game.h"
+#include "hash_utils.h"
+#include "input_enums.h"
+#include "json.h"
+#include "json_error.h"
+#include "json_loader.h"
+#include "monster.h"
+#include "mtype.h"
+#include "point.h"
+#include "string_formatter.h"
+
+namespace input_replay
+{
+
+namespace
+{
+
+using clock = std::chrono::steady_clock;
+
+// Bumped when the line format changes
+constexpr int recording_version = 1;
+
+struct replay_state {
+    std::string path;
+    std::unique_ptr<std::ofstream> out;
+    unsigned int seed = 0;
+    std::vector<input_event> events;
+    size_t next = 0;
+    bool replaying = false;
+    clock::time_point turn_start;
+    clock::time_point start;
+    // Wall time of every turn completed during the replay, in nanoseconds
+    std::vector<std::int64_t> turns;
+};
+
+replay_state &get_state()
+{
+    static replay_state state;
+    return state;
+}
+
+void write_event( JsonOut &jsout, const input_event &evt )
+{
+    jsout.start_object();
+    jsout.member( "type", static_cast<int>( evt.type ) );
+    if( !evt.modifiers.empty() ) {
+        jsout.member( "modifiers" );
+        jsout.start_array();
+        for( const keymod_t mod : evt.modifiers ) {
+            jsout.write( static_cast<int>( mod ) );
+        }
+        jsout.end_array();
+    }
+    jsout.member( "sequence", evt.sequence );
+    if( evt.type == input_event_t::mouse ) {
+        jsout.member( "mouse_pos", evt.mouse_pos );
+    }
+    if( !evt.text.empty() ) {
+        jsout.member( "text", evt.text );
+    }
+    if( !evt.edit.empty() ) {
+        jsout.member( "edit", evt.edit );
+        jsout.member( "edit_refresh", evt.edit_refresh );
+    }
+    jsout.end_object();
+}
+
+input_event read_event( const JsonObject &jo )
+{
+    input_event evt;
+    evt.type = static_cast<input_event_t>( jo.get_int( "type" ) );
+    for( const int mod : jo.get_int_array( "modifiers" ) ) {
+        evt.modifiers.emplace( static_cast<keymod_t>( mod ) );
+    }
+    for( const int key : jo.get_int_array( "sequence" ) ) {
+        evt.sequence.push_back( key );
+    }
+    jo.read( "mouse_pos", evt.mouse_pos );
+    jo.read( "text", evt.text );
+    jo.read( "edit", evt.edit );
+    jo.read( "edit_refresh", evt.edit_refresh );
+    return evt;
+}
+
+void report_and_exit()
+{
+    replay_state &state = get_state();
+    std::int64_t total = 0;
+    for( const std::int64_t t : state.turns ) {
+        total += t;
+    }
+    constexpr double ns_per_ms = 1e6;
+    const double total_ms = total / ns_per_ms;
+    const double per_turn_ms = state.turns.empty() ? 0.0 : total_ms / state.turns.size();
+    const double wall_ms = std::chrono::duration_cast<std::chrono::nanoseconds>
+                           ( clock::now() - state.start ).count() / ns_per_ms;
+    const std::size_t hash = game_state_hash();
+
+    const std::string report_path = state.path + ".report.json";
+    write_to_file( report_path, [&]( std::ostream & fout ) {
+        JsonOut jsout( fout, true );
+        jsout.start_object();
+        jsout.member( "recording", state.path );
+        jsout.member( "seed", state.seed );
+        jsout.member( "events", state.events.size() );
+        jsout.member( "turns", state.turns.size() );
+        jsout.member( "turns_ms", total_ms );
+        jsout.member( "ms_per_turn", per_turn_ms );
+        jsout.member( "wall_ms", wall_ms );
+        jsout.member( "state_hash", string_format( "%016llx",
+                      static_cast<unsigned long long>( hash ) ) );
+        jsout.end_object();
+    }, "input replay report" );
+
+    catacurses::endwin();
+    std::cout << string_format( "Replayed %d events over %d turns: %.3f ms/turn (%.1f ms total,"
+                                " %.1f ms wall)\nstate hash %016llx\n", state.events.size(),
+                                state.turns.size(), per_turn_ms, total_ms, wall_ms,
+                                static_cast<unsigned long long>( hash ) );
+    exit( EXIT_SUCCESS );
+}
+
+} // namespace
+
+bool recording()
+{
+    return get_state().out != nullptr;
+}
+
+bool replaying()
+{
+    return get_state().replaying;
+}
+
+bool start_recording( const std::string &path, unsigned int seed )
+{
+    replay_state &state = get_state();
+    state.out = std::make_unique<std::ofstream>( path, std::ios::binary | std::ios::trunc );
+    if( !state.out->is_open() ) {
+        state.out.reset();
+        return false;
+    }
+    state.path = path;
+    state.seed = seed;
+    JsonOut jsout( *state.out );
+    jsout.start_object();
+    jsout.member( "version", recording_version );
+    jsout.member( "seed", seed );
+    jsout.end_object();
+    *state.out << '\n' << std::flush;
+    return true;
+}
+
+bool start_replay( const std::string &path )
+{
+    std::ifstream fin( path, std::ios::binary );
+    if( !fin.is_open() ) {
+        return false;
+    }
+    replay_state &state = get_state();
+    state.events.clear();
+    std::string line;
+    bool header = true;
+    try {
+        while( std::getline( fin, line ) ) {
+            if( line.empty() ) {
+                continue;
+            }
+            const JsonObject jo = json_loader::from_string( line ).get_object();
+            jo.allow_omitted_members();
+            if( header ) {
+                if( jo.get_int( "version" ) != recording_version ) {
+                    return false;
+                }
+                state.seed = jo.get_int( "seed" );
+                header = false;
+            } else {
+                state.events.push_back( read_event( jo ) );
+            }
+        }
+    } catch( const JsonError &err ) {
+        std::cerr << "Bad input recording " << path << ": " << err.what() << '\n';
+        return false;
+    }
+    if( header ) {
+        return false;
+    }
+    state.path = path;
+    state.next = 0;
+    state.turns.clear();
+    state.replaying = true;
+    state.start = clock::now();
+    state.turn_start = state.start;
+    return true;
+}
+
+unsigned int seed()
+{
+    return get_state().seed;
+}
+
+void record( const input_event &evt )
+{
+    replay_state &state = get_state();
+    if( !state.out ) {
+        return;
+    }
+    JsonOut jsout( *state.out );
+    write_event( jsout, evt );
+    // Flushed per event so a crash still leaves a usable recording
+    *state.out << '\n' << std::flush;
+}
+
+input_event next_event()
+{
+    replay_state &state = get_state();
+    if( state.next >= state.events.size() ) {
+        report_and_exit();
+    }
+    return state.events[state.next++];
+}
+
+void end_turn()
+{
+    replay_state &state = get_state();
+    if( !state.replaying ) {
+        return;
+    }
+    const clock::time_point now = clock::now();
+    state.turns.push_back( std::chrono::duration_cast<std::chrono::nanoseconds>
+                           ( now - state.turn_start ).count() );
+    state.turn_start = now;
+}
+
+std::size_t game_state_hash()
+{
+    std::size_t ret = 0;
+    cata::hash_combine( ret, to_turns<int>( calendar::turn - calendar::turn_zero ) );
+    const avatar &u = get_avatar();
+    cata::hash_combine( ret, u.get_location().raw() );
+    cata::hash_combine( ret, u.get_hp() );
+    // Summed so the order monsters are stored in doesn't matter
+    std::size_t monsters = 0;
+    for( const monster &critter : g->all_monsters() ) {
+        std::size_t h = 0;
+        cata::hash_combine( h, critter.type->id );
+        cata::hash_combine( h, critter.get_location().raw() );
+        cata::hash_combine( h, critter.get_hp() );
+        monsters += h;
+    }
+    cata::hash_combine( ret, monsters );
+    return ret;
+}
+
+} // namespace input_replay
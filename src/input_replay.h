@@ -0,0 +1,50 @@
+#pragma once
+#ifndef CATA_SRC_INPUT_REPLAY_H
+#define CATA_SRC_INPUT_REPLAY_H
+
+#include <cstddef>
+#include <string>
+
+struct input_event;
+
+/**
+ * Recording and replaying of raw player input, for reproducible performance runs.
+ *
+ * `--record-input <file>` writes the rng seed and then every event returned by
+ * input_manager::get_input_event to <file>, one JSON object per line. Timeouts are
+ * recorded too, so anything driven by them replays the same way.
+ *
+ * `--replay-input <file>` seeds the rng from the recording and feeds the recorded
+ * events back instead of reading the keyboard. Once they run out, a report with the
+ * wall time per turn and a hash of the final game state is printed and written next to
+ * the recording as <file>.report.json, and the game exits. Replaying the same
+ * recording against a copy of the same save must give the same final hash; if it
+ * does not, the run diverged and its timings are not comparable.
+ */
+namespace input_replay
+{
+
+bool recording();
+bool replaying();
+
+/** Starts recording to @p path. Returns false if the file could not be opened. */
+bool start_recording( const std::string &path, unsigned int seed );
+/** Loads the recording at @p path for replay. Returns false if it could not be read. */
+bool start_replay( const std::string &path );
+/** Seed stored in the recording being replayed. */
+unsigned int seed();
+
+/** Appends @p evt to the recording, if recording. */
+void record( const input_event &evt );
+/** Next recorded event. Reports and exits the game when there are none left. */
+input_event next_event();
+
+/** Closes a game turn for the per-turn timing, if replaying. */
+void end_turn();
+
+/** Hash of the avatar, the creatures around it and the time, to compare runs. */
+std::size_t game_state_hash();
+
+} // namespace input_replay
+
+#endif // CATA_SRC_INPUT_REPLAY_H
@@ -51,6 +51,8 @@ static const itype_id itype_tramadol( "tramadol" );
 
 static const material_id material_iron( "iron" );
 
+static const ter_str_id ter_t_brick_oven( "t_brick_oven" );
+
 struct itype;
 
 const invlet_wrapper
@@ -253,7 +255,7 @@ void inventory::clear()
     items.clear();
     max_empty_liq_cont.clear();
     binned = false;
-    qualities_cache.clear();
+    quality_levels.clear();
 }
 
 void inventory::push_back( const std::list<item> &newits )
@@ -524,16 +526,18 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
     provisioned_pseudo_tools.clear();
 
     for( const tripoint &p : pts ) {
+        const ter_t &t = m.ter( p ).obj();
         // a temporary hack while trees are terrain
-        if( m.ter( p )->has_flag( ter_furn_flag::TFLAG_TREE ) ) {
+        if( t.has_flag( ter_furn_flag::TFLAG_TREE ) ) {
             provide_pseudo_item( itype_butchery_tree_pseudo );
         }
         // Another terrible hack, as terrain can't provide pseudo items, and construction can't do multi-step furniture
-        ter_id brick_oven( "t_brick_oven" );
-        if( m.ter( p ) == brick_oven ) {
+        if( t.id == ter_t_brick_oven ) {
             provide_pseudo_item( itype_brick_oven_pseudo );
         }
         const furn_t &f = m.furn( p ).obj();
+        // Most tiles in range are bare, skip walking their item stacks
+        const bool has_items = m.has_items( p );
         if( item *furn_item = provide_pseudo_item( f.crafting_pseudo_item ) ) {
             const itype *ammo = f.crafting_ammo_item_type();
             if( furn_item->has_pocket_type( pocket_type::MAGAZINE ) ) {
@@ -551,7 +555,7 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
                 furn_item->put_in( furn_ammo, pocket_type::MAGAZINE );
             }
         }
-        if( m.accessible_items( p ) ) {
+        if( has_items && m.accessible_items( p ) ) {
             for( item &i : m.i_at( p ) ) {
                 // if it's *the* player requesting this from from map inventory
                 // then don't allow items owned by another faction to be factored into recipe components etc.
@@ -580,7 +584,7 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
         }
 
         // keg-kludge
-        if( m.furn( p )->has_examine( iexamine::keg ) ) {
+        if( has_items && f.has_examine( iexamine::keg ) ) {
             map_stack liq_contained = m.i_at( p );
             for( item &i : liq_contained ) {
                 if( i.made_of( phase_id::LIQUID ) ) {
@@ -963,17 +967,20 @@ units::volume inventory::volume_without( const std::map<const item *, int> &with
     return ret;
 }
 
-enchant_cache inventory::get_active_enchantment_cache( const Character &owner ) const
+enchant_cache inventory::get_active_enchantment_cache( const Character &owner,
+        bool &depends_on_state ) const
 {
     enchant_cache temp_cache;
     for( const std::list<item> &elem : items ) {
         for( const item &check_item : elem ) {
             for( const enchant_cache &ench : check_item.get_proc_enchantments() ) {
+                depends_on_state = depends_on_state || ench.depends_on_state();
                 if( ench.is_active( owner, check_item ) ) {
                     temp_cache.force_add( ench );
                 }
             }
             for( const enchantment &ench : check_item.get_defined_enchantments() ) {
+                depends_on_state = depends_on_state || ench.depends_on_state();
                 if( ench.is_active( owner, check_item ) ) {
                     temp_cache.force_add( ench, owner );
                 }
@@ -90,20 +90,6 @@ class invlet_favorites
         std::array<itype_id, 256> ids_by_invlet;
 };
 
-struct quality_query {
-    quality_id qual;
-    int level;
-    int count;
-
-    bool operator==( const quality_query &other ) const {
-        return qual == other.qual && level == other.level && count == other.count;
-    }
-
-    bool operator<( const quality_query &other ) const {
-        return std::tie( qual, level, count ) < std::tie( other.qual, other.level, other.count );
-    }
-};
-
 class inventory : public visitable
 {
     public:
@@ -244,7 +230,9 @@ class inventory : public visitable
         void copy_invlet_of( const inventory &other );
 
         // gets a singular enchantment that is an amalgamation of all items that have active enchantments
-        enchant_cache get_active_enchantment_cache( const Character &owner ) const;
+        // @depends_on_state is set if any of them may change while the items stay the same
+        enchant_cache get_active_enchantment_cache( const Character &owner,
+                bool &depends_on_state ) const;
 
         int count_item( const itype_id &item_type ) const;
 
@@ -292,7 +280,12 @@ class inventory : public visitable
          */
         mutable itype_bin binned_items;
 
-        mutable std::map<quality_query, bool> qualities_cache;
+        /**
+         * Number of items by the level they have of a quality, gathered for each quality
+         * the first time it's asked for. Answers any level and count for that quality.
+         * Like the previous per-query cache it is only reset by @ref clear.
+         */
+        mutable std::unordered_map<quality_id, std::map<int, int>> quality_levels;
 };
 
 #endif // CATA_SRC_INVENTORY_H
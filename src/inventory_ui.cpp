@@ -121,16 +121,25 @@ using pred_t = std::function<bool( inventory_entry const & )>;
 void move_if( std::vector<inventory_entry> &src, std::vector<inventory_entry> &dst,
               pred_t const &pred )
 {
-    for( auto it = src.begin(); it != src.end(); ) {
-        if( pred( *it ) ) {
-            if( it->is_item() ) {
-                dst.emplace_back( std::move( *it ) );
-            }
-            it = src.erase( it );
-        } else {
-            ++it;
+    // keep the relative order of both halves so that a sorted column stays sorted
+    auto const moved = std::stable_partition( src.begin(), src.end(),
+    [&pred]( inventory_entry const & e ) {
+        return !pred( e );
+    } );
+    for( auto it = moved; it != src.end(); ++it ) {
+        if( it->is_item() ) {
+            dst.emplace_back( std::move( *it ) );
         }
     }
+    src.erase( moved, src.end() );
+}
+
+// true if every entry matching new_filter also matches old_filter, i.e. the
+// entries hidden by old_filter can stay hidden
+bool filter_narrows( std::string const &old_filter, std::string const &new_filter )
+{
+    return !old_filter.empty() && string_starts_with( new_filter, old_filter ) &&
+           new_filter.find_first_of( ",-:;{}" ) == std::string::npos;
 }
 
 bool always_yes( const inventory_entry & )
@@ -693,6 +702,15 @@ nc_color inventory_selector_preset::get_color( const inventory_entry &entry ) co
 std::function<bool( const inventory_entry & )> inventory_selector_preset::get_filter(
     const std::string &filter ) const
 {
+    if( filter.find( ':' ) == std::string::npos ) {
+        // plain name search - match against the cached name instead of calling tname()
+        return [filter]( const inventory_entry & e ) {
+            return e.cached_name_full != nullptr ?
+                   lcmatch( *e.cached_name_full, filter ) :
+                   lcmatch( remove_color_tags( e.any_item()->tname() ), filter );
+        };
+    }
+
     auto item_filter = basic_item_filter( filter );
 
     return [item_filter]( const inventory_entry & e ) {
@@ -971,9 +989,11 @@ size_t inventory_column::get_cells_width() const
     } );
 }
 
-void inventory_column::set_filter( const std::string &/* filter */ )
+void inventory_column::set_filter( const std::string &filter )
 {
-    paging_is_valid = false;
+    const bool narrowed = paging_is_valid && filter_narrows( paging_filter, filter );
+    invalidate_paging();
+    paging_filter_narrowed = narrowed;
 }
 
 void selection_column::set_filter( const std::string & )
@@ -1060,7 +1080,7 @@ void inventory_column::set_height( size_t new_height )
         }
         height = new_height;
         entries_per_page = new_height;
-        paging_is_valid = false;
+        invalidate_paging();
     }
 }
 
@@ -1223,7 +1243,7 @@ void inventory_column::set_collapsed( inventory_entry &entry, const bool collaps
 
     if( collapsed ) {
         entry.collapsed = collapse;
-        paging_is_valid = false;
+        invalidate_paging();
         entry.make_entry_cell_cache( preset );
     }
 }
@@ -1260,7 +1280,7 @@ void inventory_column::on_input( const inventory_input &input )
         // Favoriting items in one column may change item names in another column
         // if that column contains an item that contains the favorited item. So
         // we invalidate every column on TOGGLE_FAVORITE action.
-        paging_is_valid = false;
+        invalidate_paging();
     }
 }
 
@@ -1276,7 +1296,7 @@ inventory_entry *inventory_column::add_entry( const inventory_entry &entry )
         debugmsg( "Tried to add a duplicate entry." );
         return &*it;
     }
-    paging_is_valid = false;
+    invalidate_paging();
     if( entry.is_item() ) {
         item_location entry_item = entry.locations.front();
 
@@ -1315,7 +1335,7 @@ void inventory_column::move_entries_to( inventory_column &dest )
     std::move( entries.begin(), entries.end(), std::back_inserter( dest.entries ) );
     std::move( entries_hidden.begin(), entries_hidden.end(),
                std::back_inserter( dest.entries_hidden ) );
-    dest.paging_is_valid = false;
+    dest.invalidate_paging();
     clear();
 }
 
@@ -1482,30 +1502,38 @@ void inventory_column::prepare_paging( const std::string &filter )
         return !is_visible( it );
     };
 
-    // restore entries revealed by SHOW_HIDE_CONTENTS or filter
-    move_if( entries_hidden, entries, is_visible );
-    // remove entries hidden by SHOW_HIDE_CONTENTS
-    move_if( entries, entries_hidden, is_not_visible );
-
-    // Then sort them with respect to categories
-    std::stable_sort( entries.begin(), entries.end(),
-    [this]( const inventory_entry & lhs, const inventory_entry & rhs ) {
-        if( *lhs.get_category_ptr() == *rhs.get_category_ptr() ) {
-            if( _collated ) {
-                return collated_sort_compare( lhs, rhs );
-            }
-            if( indent_entries() ) {
-                return indented_sort_compare( lhs, rhs );
+    if( paging_filter_narrowed && filter_narrows( paging_filter, filter ) ) {
+        // Only the filter changed and it can only hide more entries, so drop them (along
+        // with the category and paging rows) and keep the existing order.
+        move_if( entries, entries_hidden, is_not_visible );
+    } else {
+        // restore entries revealed by SHOW_HIDE_CONTENTS or filter
+        move_if( entries_hidden, entries, is_visible );
+        // remove entries hidden by SHOW_HIDE_CONTENTS
+        move_if( entries, entries_hidden, is_not_visible );
+
+        // Then sort them with respect to categories
+        std::stable_sort( entries.begin(), entries.end(),
+        [this]( const inventory_entry & lhs, const inventory_entry & rhs ) {
+            if( *lhs.get_category_ptr() == *rhs.get_category_ptr() ) {
+                if( _collated ) {
+                    return collated_sort_compare( lhs, rhs );
+                }
+                if( indent_entries() ) {
+                    return indented_sort_compare( lhs, rhs );
+                }
+
+                return sort_compare( lhs, rhs );
             }
+            return preset.cat_sort_compare( lhs, rhs );
+        } );
 
-            return sort_compare( lhs, rhs );
+        if( !_collated && collate_entries() ) {
+            collate();
         }
-        return preset.cat_sort_compare( lhs, rhs );
-    } );
-
-    if( !_collated && collate_entries() ) {
-        collate();
     }
+    paging_filter = filter;
+    paging_filter_narrowed = false;
 
     // Recover categories
     const item_category *current_category = nullptr;
@@ -1544,7 +1572,7 @@ void inventory_column::clear()
 {
     entries.clear();
     entries_hidden.clear();
-    paging_is_valid = false;
+    invalidate_paging();
 }
 
 bool inventory_column::highlight( const item_location &loc, bool front_only )
@@ -1832,7 +1860,7 @@ void selection_column::on_change( const inventory_entry &entry )
             return; // Not interested.
         }
         add_entry( my_entry )->make_entry_cell_cache( preset );
-        paging_is_valid = false;
+        invalidate_paging();
         last_changed = my_entry;
     } else if( iter->chosen_count != my_entry.chosen_count ) {
         if( my_entry.chosen_count > 0 ) {
@@ -1841,7 +1869,7 @@ void selection_column::on_change( const inventory_entry &entry )
         } else {
             iter = entries.erase( iter );
         }
-        paging_is_valid = false;
+        invalidate_paging();
         if( iter != entries.end() ) {
             last_changed = *iter;
         }
@@ -2305,6 +2333,8 @@ void inventory_selector::rearrange_columns( size_t client_width )
 
 void inventory_selector::prepare_layout( size_t client_width, size_t client_height )
 {
+    tname::cache_scope const names;
+    item_pocket::totals_scope const totals;
     // This block adds categories and should go before any width evaluations
     const bool initial = get_active_column().get_highlighted_index() == static_cast<size_t>( -1 );
     for( inventory_column *&elem : columns ) {
@@ -2610,6 +2640,9 @@ void inventory_selector::resize_window( int width, int height )
 void inventory_selector::refresh_window()
 {
     cata_assert( w_inv );
+    // nothing changes while drawing, so each item only needs to be named and weighed once
+    tname::cache_scope const names;
+    item_pocket::totals_scope const totals;
 
     if( get_option<std::string>( "INVENTORY_HIGHLIGHT" ) != "disable" ) {
         highlight();
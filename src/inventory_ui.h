@@ -482,6 +482,7 @@ class inventory_column
 
         void invalidate_paging() {
             paging_is_valid = false;
+            paging_filter_narrowed = false;
         }
 
         /** Toggle being able to highlight unselectable entries*/
@@ -532,6 +533,10 @@ class inventory_column
         bool multiselect = false;
         bool paging_is_valid = false;
         bool visibility = true;
+        /** Filter applied by the last prepare_paging() */
+        std::string paging_filter;
+        /** Only the filter changed since the last prepare_paging(), and it hides a superset */
+        bool paging_filter_narrowed = false;
 
         size_t highlighted_index = std::numeric_limits<size_t>::max();
         size_t page_offset = 0;
@@ -16,8 +16,10 @@
 #include <sstream>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "ammo.h"
 #include "ascii_art.h"
@@ -25,6 +27,7 @@
 #include "bionics.h"
 #include "bodygraph.h"
 #include "bodypart.h"
+#include "cached_options.h"
 #include "calendar.h"
 #include "cata_assert.h"
 #include "cata_utility.h"
@@ -56,6 +59,7 @@
 #include "game.h"
 #include "game_constants.h"
 #include "gun_mode.h"
+#include "hash_utils.h"
 #include "iexamine.h"
 #include "inventory.h"
 #include "item_category.h"
@@ -101,6 +105,7 @@
 #include "string_id.h"
 #include "string_id_utils.h"
 #include "text_snippets.h"
+#include "translation_cache.h"
 #include "translations.h"
 #include "trap.h"
 #include "try_parse_integer.h"
@@ -296,6 +301,20 @@ item::item() : bday( calendar::start_of_cataclysm )
 
 item::item( const itype *type, time_point turn, int qty ) : type( type ), bday( turn )
 {
+    if( type->spawn_prototype ) {
+        // Only the birthday and charges can differ from the prototype, see
+        // spawns_identical_items in item_factory.cpp
+        *this = *type->spawn_prototype;
+        bday = turn;
+        if( qty >= 0 ) {
+            charges = qty;
+        }
+        if( active && has_temperature() ) {
+            last_temp_check = bday;
+        }
+        return;
+    }
+
     contents = item_contents( type->pockets );
     if( type->countdown_interval > 0_seconds ) {
         countdown_point = calendar::turn + type->countdown_interval;
@@ -378,7 +397,8 @@ item::item( const itype *type, time_point turn, int qty ) : type( type ), bday(
     }
 
     if( !type->snippet_category.empty() ) {
-        snip_id = SNIPPET.random_id_from_category( type->snippet_category );
+        set_cold( &cold_data::snip_id,
+                  SNIPPET.random_id_from_category( type->snippet_category ) );
     }
 
     if( type->expand_snippets ) {
@@ -617,7 +637,7 @@ item item::make_corpse( const mtype_id &mt, time_point turn, const std::string &
 
     // This is unconditional because the const itemructor above sets result.name to
     // "human corpse".
-    result.corpse_name = name;
+    result.set_cold( &cold_data::corpse_name, name );
 
     return result;
 }
@@ -1706,7 +1726,7 @@ stacking_info item::stacks_with( const item &rhs, bool check_components, bool co
     bits.set( tname::segments::CORPSE,
               ( corpse == nullptr && rhs.corpse == nullptr ) ||
               ( corpse != nullptr && rhs.corpse != nullptr && corpse->id == rhs.corpse->id &&
-                corpse_name == rhs.corpse_name ) );
+                get_cold().corpse_name == rhs.get_cold().corpse_name ) );
     bits.set( tname::segments::FOOD_PERISHABLE, _stacks_food_perishable( *this, rhs, check_cat ) );
     bits.set( tname::segments::CLOTHING_SIZE, _stacks_clothing_size( *this, rhs ) );
     bits.set( tname::segments::BROKEN, is_broken() == rhs.is_broken() );
@@ -2183,11 +2203,12 @@ faction_id item::get_owner() const
 faction_id item::get_old_owner() const
 {
     validate_ownership();
-    return old_owner;
+    return get_cold().old_owner;
 }
 
 void item::validate_ownership() const
 {
+    const faction_id &old_owner = get_cold().old_owner;
     if( !old_owner.is_null() && !g->faction_manager_ptr->get( old_owner, false ) ) {
         remove_old_owner();
     }
@@ -2414,6 +2435,7 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
         insert_separation_line( info );
         const std::map<std::string, std::string>::const_iterator idescription =
             item_vars.find( "description" );
+        const snippet_id snip_id = get_snippet_id();
         const std::optional<translation> snippet = SNIPPET.get_snippet_by_id( snip_id );
         if( snippet.has_value() ) {
             // Just use the dynamic description
@@ -2503,7 +2525,7 @@ void item::debug_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
         if( g != nullptr ) {
             info.emplace_back( "BASE", string_format( "itype_id: %s",
                                typeId().str() ) );
-            if( !old_owner.is_null() ) {
+            if( !get_cold().old_owner.is_null() ) {
                 info.emplace_back( "BASE", string_format( _( "Old owner: %s" ),
                                    _( get_old_owner_name() ) ) );
             }
@@ -5788,6 +5810,52 @@ void item::properties_info( std::vector<iteminfo> &info, const iteminfo_query *p
 
 }
 
+/**
+ * The recipes @p you could use @p tid in, enumerated for the item info, or an empty string.
+ * Forming the available recipes is costly and inventory UIs ask again on every hover, so the
+ * subset and the texts are kept while the crafting inventory stays the same. Learning a
+ * recipe or a skill takes moves, which forms the inventory again.
+ */
+static const std::string &applicable_recipes_text( const Character &you, const itype_id &tid )
+{
+    struct applicable_recipes_cache {
+        int generation = -1;
+        int language = INVALID_LANGUAGE_VERSION;
+        recipe_subset available;
+        std::unordered_map<itype_id, std::string> texts;
+    };
+    static applicable_recipes_cache cache;
+
+    const inventory &crafting_inv = you.crafting_inventory();
+    const int generation = you.crafting_inventory_generation();
+    const int language = detail::get_current_language_version();
+    if( generation != cache.generation || language != cache.language ) {
+        cache.available = you.get_available_recipes( crafting_inv );
+        cache.texts.clear();
+        cache.generation = generation;
+        cache.language = language;
+    }
+
+    const auto found = cache.texts.find( tid );
+    if( found != cache.texts.end() ) {
+        return found->second;
+    }
+    std::vector<std::string> crafts;
+    for( const recipe *r : cache.available.of_component( tid ) ) {
+        const bool can_make = r->deduped_requirements()
+                              .can_make_with_inventory( crafting_inv, r->get_component_filter() );
+
+        // Endarken recipes that can't be constructed with the survivor's inventory
+        const std::string name = r->result_name( /* decorated = */ true );
+        crafts.emplace_back( can_make ? name : string_format( "<dark>%s</dark>", name ) );
+    }
+    std::string &text = cache.texts[tid];
+    if( !crafts.empty() ) {
+        text = enumerate_lcsorted_with_limit( crafts, 15 );
+    }
+    return text;
+}
+
 void item::final_info( std::vector<iteminfo> &info, const iteminfo_query *parts, int batch,
                        bool /* debug */ ) const
 {
@@ -5969,26 +6037,12 @@ void item::final_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
     // Recipes using this item as an ingredient
     if( parts->test( iteminfo_parts::DESCRIPTION_APPLICABLE_RECIPES ) ) {
         // with the inventory display allowing you to select items, showing the things you could make with contained items could be confusing.
-        const itype_id &tid = typeId();
-        const inventory &crafting_inv = player_character.crafting_inventory();
-        const recipe_subset available_recipe_subset = player_character.get_available_recipes(
-                    crafting_inv );
-        const std::set<const recipe *> &item_recipes = available_recipe_subset.of_component( tid );
+        const std::string &recipes = applicable_recipes_text( player_character, typeId() );
 
         insert_separation_line( info );
-        if( item_recipes.empty() ) {
+        if( recipes.empty() ) {
             info.emplace_back( "DESCRIPTION", _( "You know of nothing you could craft with it." ) );
         } else {
-            std::vector<std::string> crafts;
-            for( const recipe *r : item_recipes ) {
-                const bool can_make = r->deduped_requirements()
-                                      .can_make_with_inventory( crafting_inv, r->get_component_filter() );
-
-                // Endarken recipes that can't be constructed with the survivor's inventory
-                const std::string name = r->result_name( /* decorated = */ true );
-                crafts.emplace_back( can_make ? name : string_format( "<dark>%s</dark>", name ) );
-            }
-            const std::string recipes = enumerate_lcsorted_with_limit( crafts, 15 );
             info.emplace_back( " DESCRIPTION", string_format( _( "You could use it to craft: %s" ), recipes ) );
         }
     }
@@ -6736,6 +6790,10 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
 
 std::string item::tname( unsigned int quantity, tname::segment_bitset const &segments ) const
 {
+    if( std::string const *cached = tname::find_cached( *this, quantity, segments ) ) {
+        return *cached;
+    }
+
     std::string ret;
 
     for( size_t i = 0; i < static_cast<size_t>( tname::segments::last_segment ); i++ ) {
@@ -6748,9 +6806,10 @@ std::string item::tname( unsigned int quantity, tname::segment_bitset const &seg
 
     if( item_vars.find( "item_note" ) != item_vars.end() ) {
         //~ %s is an item name. This style is used to denote items with notes.
-        return string_format( _( "*%s*" ), ret );
+        ret = string_format( _( "*%s*" ), ret );
     }
 
+    tname::store_cached( *this, quantity, segments, ret );
     return ret;
 }
 
@@ -7841,27 +7900,36 @@ float item::calc_hourly_rotpoints_at_temp( const units::temperature &temp ) cons
     }
 }
 
-void item::calc_rot( units::temperature temp, const float spoil_modifier,
-                     const time_duration &time_delta )
+// The temperature an item stored according to @p flag has, given the temperature around it.
+static units::temperature stored_temperature( const units::temperature &temp,
+        const temperature_flag flag )
 {
-    // Avoid needlessly calculating already rotten things.  Corpses should
-    // always rot away and food rots away at twice the shelf life.  If the food
-    // is in a sealed container they won't rot away, this avoids needlessly
-    // calculating their rot in that case.
-    if( !is_corpse() && get_relative_rot() > 2.0 ) {
-        return;
-    }
-
-    if( has_own_flag( flag_FROZEN ) ) {
-        return;
+    switch( flag ) {
+        case temperature_flag::NORMAL:
+            // Just use the temperature normally
+            return temp;
+        case temperature_flag::FRIDGE:
+            return std::min( temp, temperatures::fridge );
+        case temperature_flag::FREEZER:
+            return std::min( temp, temperatures::freezer );
+        case temperature_flag::HEATER:
+            return std::max( temp, temperatures::normal );
+        case temperature_flag::ROOT_CELLAR:
+            return AVERAGE_ANNUAL_TEMPERATURE;
+        default:
+            debugmsg( "Temperature flag enum not valid.  Using current temperature." );
     }
+    return temp;
+}
 
-    // rot modifier
+// How much faster than usual the item rots, on top of the storage it's in.
+static float rot_factor( const item &it, const float spoil_modifier )
+{
     float factor = spoil_modifier;
-    if( is_corpse() && has_flag( flag_FIELD_DRESS ) ) {
+    if( it.is_corpse() && it.has_flag( flag_FIELD_DRESS ) ) {
         factor *= 0.75;
     }
-    if( has_own_flag( flag_MUSHY ) ) {
+    if( it.has_own_flag( flag_MUSHY ) ) {
         factor *= 3.0;
     }
     // Food irradiation can quadruple the shelf life.
@@ -7870,15 +7938,99 @@ void item::calc_rot( units::temperature temp, const float spoil_modifier,
     // > patties treated at 5.0 kGy did not spoil until 42 days.
     // > The nonirradiated control samples for both batches of ground beef spoiled within 7 days
     // We get 0.5, 0.33, and 0.167. 0.25 seems reasonable for irradiation
-    if( has_own_flag( flag_IRRADIATED ) ) {
+    if( it.has_own_flag( flag_IRRADIATED ) ) {
         factor *= 0.25;
     }
+    return factor;
+}
+
+void item::calc_rot( units::temperature temp, const float spoil_modifier,
+                     const time_duration &time_delta )
+{
+    // Avoid needlessly calculating already rotten things.  Corpses should
+    // always rot away and food rots away at twice the shelf life.  If the food
+    // is in a sealed container they won't rot away, this avoids needlessly
+    // calculating their rot in that case.
+    if( !is_corpse() && get_relative_rot() > 2.0 ) {
+        return;
+    }
+
+    if( has_own_flag( flag_FROZEN ) ) {
+        return;
+    }
 
     if( has_own_flag( flag_COLD ) ) {
         temp = std::min( temperatures::fridge, temp );
     }
 
-    rot += factor * time_delta / 1_hours * calc_hourly_rotpoints_at_temp( temp ) * 1_turns;
+    rot += rot_factor( *this, spoil_modifier ) * time_delta / 1_hours *
+           calc_hourly_rotpoints_at_temp( temp ) * 1_turns;
+}
+
+namespace
+{
+// Everything apart from the time that decides how fast an item out of the reality bubble rots.
+using rot_table_key = std::tuple<tripoint, float, temperature_flag, bool, unsigned int>;
+
+// Running totals of the rot points collected at the weather temperature of each whole hour.
+struct rot_table {
+    int first_hour = 0;
+    // sums[i] holds the rot points of the hours [first_hour, first_hour + i).
+    std::vector<double> sums = { 0.0 };
+};
+} // namespace
+
+// Tables are small, but every spot items were left at gets its own, so start over now and then.
+static constexpr size_t max_rot_tables = 256;
+
+void item::calc_rot_over_hours( const tripoint &pos, const units::temperature_delta &temp_mod,
+                                const temperature_flag flag, const float spoil_modifier,
+                                const int first_hour, const int hours )
+{
+    // See calc_rot().  Without temperature updates neither of these can change along the way.
+    if( !is_corpse() && get_relative_rot() > 2.0 ) {
+        return;
+    }
+    if( has_own_flag( flag_FROZEN ) ) {
+        return;
+    }
+
+    static std::unordered_map<rot_table_key, rot_table, cata::tuple_hash> tables;
+    const weather_generator &wgen = get_weather().get_cur_weather_gen();
+    const unsigned int seed = g->get_seed();
+    const bool cold = has_own_flag( flag_COLD );
+    const rot_table_key key( pos, units::to_kelvin_delta( temp_mod ), flag, cold, seed );
+    if( tables.size() >= max_rot_tables && tables.count( key ) == 0 ) {
+        tables.clear();
+    }
+    rot_table &table = tables[key];
+    if( first_hour < table.first_hour || table.sums.size() == 1 ) {
+        table.first_hour = first_hour;
+        table.sums.assign( 1, 0.0 );
+    }
+    const int last_hour = first_hour + hours;
+    const int first_missing_hour = table.first_hour + static_cast<int>( table.sums.size() ) - 1;
+    if( first_missing_hour < last_hour ) {
+        const int missing_hours = last_hour - first_missing_hour;
+        // Use weather if above ground, use map temp if below, as process_temperature_rot does.
+        std::vector<units::temperature> weather;
+        if( pos.z >= 0 && flag != temperature_flag::ROOT_CELLAR ) {
+            weather = wgen.get_weather_temperatures( pos, calendar::turn_zero + first_missing_hour * 1_hours,
+                      1_hours, missing_hours, seed );
+        }
+        table.sums.reserve( table.sums.size() + missing_hours );
+        for( int i = 0; i < missing_hours; ++i ) {
+            units::temperature temp = weather.empty() ? AVERAGE_ANNUAL_TEMPERATURE : weather[i];
+            temp = stored_temperature( temp + temp_mod, flag );
+            if( cold ) {
+                temp = std::min( temperatures::fridge, temp );
+            }
+            table.sums.push_back( table.sums.back() + calc_hourly_rotpoints_at_temp( temp ) );
+        }
+    }
+    const double rot_points = table.sums[last_hour - table.first_hour] -
+                              table.sums[first_hour - table.first_hour];
+    rot += rot_factor( *this, spoil_modifier ) * static_cast<float>( rot_points ) * 1_turns;
 }
 
 void item::calc_rot_while_processing( time_duration processing_duration )
@@ -11812,29 +11964,32 @@ units::mass item::get_used_holster_weight() const
 int item::get_remaining_capacity_for_liquid( const item &liquid, bool allow_bucket,
         std::string *err ) const
 {
-    const auto error = [ &err ]( const std::string & message ) {
+    // Callers checking many candidates don't want a message, so skip straight to the cheapest
+    // reason to refuse. Messages are only built when asked for, tname() isn't cheap.
+    if( err == nullptr && !contents.can_contain_liquid( allow_bucket ) ) {
+        return 0;
+    }
+    if( !can_contain_partial( liquid ).success() ) {
         if( err != nullptr ) {
-            *err = message;
+            *err = string_format( _( "That %1$s won't hold %2$s." ), tname(), liquid.tname() );
         }
         return 0;
-    };
-
-    int remaining_capacity = 0;
-
-    if( can_contain_partial( liquid ).success() ) {
-        if( !contents.can_contain_liquid( allow_bucket ) ) {
-            return error( string_format( _( "That %s must be on the ground or held to hold contents!" ),
-                                         tname() ) );
+    }
+    if( !contents.can_contain_liquid( allow_bucket ) ) {
+        if( err != nullptr ) {
+            *err = string_format( _( "That %s must be on the ground or held to hold contents!" ),
+                                  tname() );
         }
-        remaining_capacity = contents.remaining_capacity_for_liquid( liquid );
-    } else {
-        return error( string_format( _( "That %1$s won't hold %2$s." ), tname(),
-                                     liquid.tname() ) );
+        return 0;
     }
 
+    const int remaining_capacity = contents.remaining_capacity_for_liquid( liquid );
     if( remaining_capacity <= 0 ) {
-        return error( string_format( _( "Your %1$s can't hold any more %2$s." ), tname(),
-                                     liquid.tname() ) );
+        if( err != nullptr ) {
+            *err = string_format( _( "Your %1$s can't hold any more %2$s." ), tname(),
+                                  liquid.tname() );
+        }
+        return 0;
     }
 
     return remaining_capacity;
@@ -11843,19 +11998,13 @@ int item::get_remaining_capacity_for_liquid( const item &liquid, bool allow_buck
 int item::get_remaining_capacity_for_liquid( const item &liquid, const Character &p,
         std::string *err ) const
 {
+    // Most items can't hold liquids at all, no need to look through the inventory for those
+    if( err == nullptr && !contents.can_contain_liquid( true ) ) {
+        return 0;
+    }
     const bool allow_bucket = ( p.get_wielded_item() && this == &*p.get_wielded_item() ) ||
                               !p.has_item( *this );
-    int res = get_remaining_capacity_for_liquid( liquid, allow_bucket, err );
-
-    if( res > 0 ) {
-        res = std::min( contents.remaining_capacity_for_liquid( liquid ), res );
-
-        if( res == 0 && err != nullptr ) {
-            *err = string_format( _( "That %s doesn't have room to expand." ), tname() );
-        }
-    }
-
-    return res;
+    return get_remaining_capacity_for_liquid( liquid, allow_bucket, err );
 }
 
 units::volume item::total_contained_volume() const
@@ -12193,11 +12342,11 @@ void item::set_snippet( const snippet_id &id )
     if( is_null() ) {
         return;
     }
-    if( !id.is_valid() ) {
+    if( !id.is_null() && !id.is_valid() ) {
         debugmsg( "there's no snippet with id %s", id.str() );
         return;
     }
-    snip_id = id;
+    set_cold( &cold_data::snip_id, id );
 }
 
 const item_category &item::get_category_shallow() const
@@ -12490,27 +12639,7 @@ bool item::process_temperature_rot( float insulation, const tripoint &pos, map &
         return false;
     }
 
-    units::temperature temp = get_weather().get_temperature( pos );
-
-    switch( flag ) {
-        case temperature_flag::NORMAL:
-            // Just use the temperature normally
-            break;
-        case temperature_flag::FRIDGE:
-            temp = std::min( temp, temperatures::fridge );
-            break;
-        case temperature_flag::FREEZER:
-            temp = std::min( temp, temperatures::freezer );
-            break;
-        case temperature_flag::HEATER:
-            temp = std::max( temp, temperatures::normal );
-            break;
-        case temperature_flag::ROOT_CELLAR:
-            temp = AVERAGE_ANNUAL_TEMPERATURE;
-            break;
-        default:
-            debugmsg( "Temperature flag enum not valid.  Using current temperature." );
-    }
+    units::temperature temp = stored_temperature( get_weather().get_temperature( pos ), flag );
 
     bool carried = carrier != nullptr;
     // body heat increases inventory temperature by 5 F (2.77 K) and insulation by 50%
@@ -12543,6 +12672,20 @@ bool item::process_temperature_rot( float insulation, const tripoint &pos, map &
             temp_mod += units::from_fahrenheit_delta( 5 ); // body heat increases inventory temperature
         }
 
+        // Hours that end more than 2 d ago only matter for rot, so they can be added up in one go.
+        const int old_hours = to_hours<int>( now - 2_days - time );
+        if( fast_rot_catch_up && old_hours > 0 ) {
+            if( process_rot ) {
+                calc_rot_over_hours( pos, temp_mod, flag, spoil_modifier,
+                                     to_hours<int>( time - calendar::turn_zero ) + 1, old_hours );
+            }
+            time += old_hours * 1_hours;
+            last_temp_check = time;
+            if( process_rot && has_rotten_away() && carrier == nullptr ) {
+                return true;
+            }
+        }
+
         // Process the past of this item in 1h chunks until there is less than 1h left.
         time_duration time_delta = 1_hours;
 
@@ -12557,27 +12700,7 @@ bool item::process_temperature_rot( float insulation, const tripoint &pos, map &
             } else {
                 env_temperature = AVERAGE_ANNUAL_TEMPERATURE;
             }
-            env_temperature += temp_mod;
-
-            switch( flag ) {
-                case temperature_flag::NORMAL:
-                    // Just use the temperature normally
-                    break;
-                case temperature_flag::FRIDGE:
-                    env_temperature = std::min( env_temperature, temperatures::fridge );
-                    break;
-                case temperature_flag::FREEZER:
-                    env_temperature = std::min( env_temperature, temperatures::freezer );
-                    break;
-                case temperature_flag::HEATER:
-                    env_temperature = std::max( env_temperature, temperatures::normal );
-                    break;
-                case temperature_flag::ROOT_CELLAR:
-                    env_temperature = AVERAGE_ANNUAL_TEMPERATURE;
-                    break;
-                default:
-                    debugmsg( "Temperature flag enum not valid.  Using normal temperature." );
-            }
+            env_temperature = stored_temperature( env_temperature + temp_mod, flag );
 
             // Calculate item temperature from environment temperature
             // If the time was more than 2 d ago we do not care about item temperature.
@@ -14398,6 +14521,7 @@ std::string item::type_name( unsigned int quantity, bool use_variant, bool use_c
 
     // Identify who this corpse belonged to, if applicable.
     if( corpse != nullptr && use_corpse && has_flag( flag_CORPSE ) ) {
+        const std::string &corpse_name = get_cold().corpse_name;
         if( corpse_name.empty() ) {
             //~ %1$s: name of corpse with modifiers;  %2$s: species name
             ret_name = string_format( pgettext( "corpse ownership qualifier", "%1$s of a %2$s" ),
@@ -14414,7 +14538,7 @@ std::string item::type_name( unsigned int quantity, bool use_variant, bool use_c
 
 std::string item::get_corpse_name() const
 {
-    return corpse_name;
+    return get_cold().corpse_name;
 }
 
 std::string item::nname( const itype_id &id, unsigned int quantity )
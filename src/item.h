@@ -1035,6 +1035,14 @@ class item : public visitable
          */
         void calc_rot( units::temperature temp, float spoil_modifier, const time_duration &time_delta );
 
+        /**
+         * Accumulate rot over @p hours whole hours starting @p first_hour hours after turn zero,
+         * at the weather temperature of each. Used to catch up on long absences, see
+         * process_temperature_rot. Like calc_rot, this skips the checks and temperature updates.
+         */
+        void calc_rot_over_hours( const tripoint &pos, const units::temperature_delta &temp_mod,
+                                  temperature_flag flag, float spoil_modifier, int first_hour, int hours );
+
         /**
          * This is part of a workaround so that items don't rot away to nothing if the smoking rack
          * is outside the reality bubble.
@@ -1772,6 +1780,17 @@ class item : public visitable
          * @see snippet_library.
          */
         void set_snippet( const snippet_id &id );
+        /** The snippet set for this specific item, null if there is none. */
+        snippet_id get_snippet_id() const {
+            return get_cold().snip_id;
+        }
+        /** The harvest drop type this item spawned from, null if it didn't come from one. */
+        harvest_drop_type_id get_dropped_from() const {
+            return get_cold().dropped_from;
+        }
+        void set_dropped_from( const harvest_drop_type_id &drop ) {
+            set_cold( &cold_data::dropped_from, drop );
+        }
 
         bool operator<( const item &other ) const;
         /** List of all @ref components in printable form, empty if this item has
@@ -2801,10 +2820,10 @@ class item : public visitable
 
         void validate_ownership() const;
         inline void set_old_owner( const faction_id &temp_owner ) {
-            old_owner = temp_owner;
+            set_cold( &cold_data::old_owner, temp_owner );
         }
         inline void remove_old_owner() const {
-            old_owner = faction_id::NULL_ID();
+            set_cold( &cold_data::old_owner, faction_id::NULL_ID() );
         }
         void set_owner( const faction_id &new_owner );
         void set_owner( const Character &c );
@@ -3082,7 +3101,6 @@ class item : public visitable
         lazy<safe_reference_anchor> anchor;
         cata::heap<std::map<std::string, std::string>> item_vars;
         const mtype *corpse = nullptr;
-        std::string corpse_name;       // Name of the late lamented
         cata::heap<std::set<matec_id>> techniques; // item specific techniques
 
         // Select a random variant from the possibilities
@@ -3130,7 +3148,6 @@ class item : public visitable
         int burnt = 0;             // How badly we're burnt
         int poison = 0;            // How badly poisoned is it?
         int frequency = 0;         // Radio frequency
-        snippet_id snip_id = snippet_id::NULL_ID(); // Associated dynamic text snippet id.
         int irradiation = 0;       // Tracks radiation dosage.
         int item_counter = 0;      // generic counter to be used with item flags
 
@@ -3147,9 +3164,6 @@ class item : public visitable
 
         int seed = rng( 0, INT_MAX );  // A random seed for layering and other options
 
-        harvest_drop_type_id dropped_from =
-            harvest_drop_type_id::NULL_ID(); // The drop type this item spawned from
-
         // Set when the item / its content changes. Used for worn item with
         // encumbrance depending on their content.
         // This not part serialized or compared on purpose!
@@ -3183,8 +3197,6 @@ class item : public visitable
         phase_id current_phase = static_cast<phase_id>( 0 );
         // The faction that owns this item.
         mutable faction_id owner = faction_id::NULL_ID();
-        // The faction that previously owned this item
-        mutable faction_id old_owner = faction_id::NULL_ID();
         int damage_ = 0;
         int degradation_ = 0;
         light_emission light = nolight;
@@ -3200,6 +3212,36 @@ class item : public visitable
         // additional encumbrance this specific item has
         units::volume additional_encumbrance = 0_ml;
 
+        /**
+         * Data only few items ever set. It is kept out of line so that the rest don't carry it
+         * around, and only allocated once one of the fields differs from its default.
+         */
+        struct cold_data {
+            snippet_id snip_id = snippet_id::NULL_ID(); // Associated dynamic text snippet id.
+            // The drop type this item spawned from
+            harvest_drop_type_id dropped_from = harvest_drop_type_id::NULL_ID();
+            // The faction that previously owned this item
+            faction_id old_owner = faction_id::NULL_ID();
+            std::string corpse_name; // Name of the late lamented
+        };
+        // Mutable as ownership is validated lazily from const members
+        mutable cata::value_ptr<cold_data> cold_;
+
+        const cold_data &get_cold() const {
+            static const cold_data defaults;
+            return cold_ ? *cold_ : defaults;
+        }
+        template<typename T>
+        void set_cold( T cold_data::*field, const T &value ) const {
+            if( !cold_ ) {
+                if( value == cold_data().*field ) {
+                    return;
+                }
+                cold_ = cata::make_value<cold_data>();
+            }
+            ( *cold_ ).*field = value;
+        }
+
     public:
         char invlet = 0;      // Inventory letter
         bool active = false; // If true, it has active effects to be processed
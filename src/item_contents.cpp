@@ -2444,8 +2444,6 @@ void item_contents::leak( map &here, Character *carrier, const tripoint &pos, it
 int item_contents::remaining_capacity_for_liquid( const item &liquid ) const
 {
     int charges_of_liquid = 0;
-    item liquid_copy = liquid;
-    liquid_copy.charges = 1;
     for( const item_pocket &pocket : contents ) {
         if( !pocket.is_type( pocket_type::CONTAINER ) ) {
             continue;
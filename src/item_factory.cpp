@@ -218,6 +218,20 @@ static bool is_physical( const itype &type )
            !type.has_flag( flag_ZERO_WEIGHT );
 }
 
+// Whether nothing random or time dependent goes into new items of the type, so they can be
+// copied from a prototype. Keep in sync with item::item.
+static bool spawns_identical_items( const itype &type )
+{
+    return !type.tool && !type.gun && !type.magazine &&
+           type.variants.empty() &&
+           type.countdown_interval <= 0_seconds &&
+           type.snippet_category.empty() &&
+           !type.expand_snippets &&
+           !type.has_flag( flag_SPAWN_ACTIVE ) &&
+           !type.has_flag( flag_NANOFAB_TEMPLATE ) &&
+           ( !type.has_flag( flag_CORPSE ) || type.source_monster.is_null() );
+}
+
 void Item_factory::finalize_pre( itype &obj )
 {
     // Add relic data by ID we defered
@@ -1354,6 +1368,15 @@ void Item_factory::finalize()
             it->second.recipes.push_back( p.first );
         }
     }
+    for( auto &e : m_templates ) {
+        // Built from the type itself, not from an older prototype
+        e.second.spawn_prototype.reset();
+        if( spawns_identical_items( e.second ) ) {
+            e.second.spawn_prototype = std::make_shared<const item>( &e.second,
+                                       calendar::turn_zero );
+        }
+    }
+
     for( auto &e : m_template_groups ) {
         auto &isd = e.second;
         isd->finalize( itype_id::NULL_ID() );
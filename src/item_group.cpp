@@ -172,6 +172,8 @@ Single_item_creator::Single_item_creator( const std::string &_id, Type _type, in
     : Item_spawn_data( _probability, context, event )
     , id( _id )
     , type( _type )
+    , group_id( _type == S_ITEM_GROUP ? item_group_id( _id ) : item_group_id() )
+    , modifier_context( "modifier for " + context )
 {
 }
 item Single_item_creator::create_single( const time_point &birthday, RecursionList &rec ) const
@@ -193,7 +195,6 @@ item Single_item_creator::create_single_without_container( const time_point &bir
     }
     Item_spawn_data *isd = nullptr;
     if( type == S_ITEM_GROUP ) {
-        item_group_id group_id( id );
         if( std::find( rec.begin(), rec.end(), group_id ) != rec.end() ) {
             debugmsg( "recursion in item spawn list %s", id.c_str() );
             return item( null_item_id, birthday );
@@ -217,10 +218,13 @@ item Single_item_creator::create_single_without_container( const time_point &bir
         } else
         {
             cata_assert( type == S_ITEM );
-            if( id == "corpse" ) {
+            if( item_type ) {
+                return item( item_type, birthday );
+            } else if( id == "corpse" ) {
                 return item::make_corpse( mtype_id::NULL_ID(), birthday );
             } else {
-                return item( id, birthday );
+                item_type = item::find_type( itype_id( id ) );
+                return item( item_type, birthday );
             }
         }
     } )();
@@ -229,7 +233,7 @@ item Single_item_creator::create_single_without_container( const time_point &bir
         tmp.set_flag( flag_FIT );
     }
     if( modifier ) {
-        modifier->modify( tmp, "modifier for " + context() );
+        modifier->modify( tmp, modifier_context );
     } else {
         int qty = tmp.count();
         if( modifier ) {
@@ -260,7 +264,8 @@ std::size_t Single_item_creator::create( ItemList &list,
                       modifier_count.first, modifier_count.second );
         }
     }
-    float spawn_rate = get_option<float>( "ITEM_SPAWNRATE" );
+    static const option_handle<float> opt_spawn_rate( "ITEM_SPAWNRATE" );
+    const float spawn_rate = opt_spawn_rate.get();
     for( ; cnt > 0; cnt-- ) {
         if( type == S_ITEM ) {
             item itm = create_single_without_container( birthday, rec );
@@ -272,7 +277,6 @@ std::size_t Single_item_creator::create( ItemList &list,
                 list.emplace_back( std::move( itm ) );
             }
         } else {
-            item_group_id group_id( id );
             if( std::find( rec.begin(), rec.end(), group_id ) != rec.end() ) {
                 debugmsg( "recursion in item spawn list %s", id.c_str() );
                 return list.size() - prev_list_size;
@@ -288,7 +292,7 @@ std::size_t Single_item_creator::create( ItemList &list,
             rec.pop_back();
             if( modifier ) {
                 for( auto it = list.end() - tmp_list_size; it != list.end(); ++it ) {
-                    modifier->modify( *it, "modifier for " + context() );
+                    modifier->modify( *it, modifier_context );
                 }
             }
         }
@@ -408,6 +412,7 @@ bool Single_item_creator::remove_item( const itype_id &itemid )
     if( type == S_ITEM ) {
         if( itemid.str() == id ) {
             type = S_NONE;
+            item_type = nullptr;
             return true;
         }
     }
@@ -427,6 +432,7 @@ void Single_item_creator::replace_items( const std::unordered_map<itype_id, ityp
         auto it = replacements.find( itype_id( id ) );
         if( it != replacements.end() ) {
             id = it->second.str();
+            item_type = nullptr;
         }
     }
     // This part of code is currently only used in Item_factory::finalize_item_blacklist(), not during the game.
@@ -706,7 +712,7 @@ void Item_modifier::modify( item &new_item, const std::string &context ) const
     }
 
     if( !snippets.empty() ) {
-        new_item.snip_id = random_entry( snippets );
+        new_item.set_snippet( random_entry( snippets ) );
     }
 }
 
@@ -806,6 +812,7 @@ void Item_group::add_entry( std::unique_ptr<Item_spawn_data> ptr )
         ptr->set_probablility( std::min( 100, ptr->get_probability( true ) ) );
     }
     sum_prob += ptr->get_probability( true );
+    cumulative_prob.push_back( sum_prob );
 
     // Make the ammo and magazine probabilities from the outer entity apply to the nested entity:
     // If ptr is an Item_group, it already inherited its parent's ammo/magazine chances in its constructor.
@@ -841,17 +848,8 @@ std::size_t Item_group::create( Item_spawn_data::ItemList &list,
             elem->create( list, birthday, rec, flags );
         }
     } else if( type == G_DISTRIBUTION ) {
-        int p = rng( 0, sum_prob - 1 );
-        for( const auto &elem : items ) {
-            bool ev_based = elem->is_event_based();
-            int prob = elem->get_probability( false );
-            int real_prob = elem->get_probability( true );
-            p -= real_prob;
-            if( ( ev_based && prob == 0 ) || p >= 0 ) {
-                continue;
-            }
+        if( const Item_spawn_data *elem = pick_from_distribution() ) {
             elem->create( list, birthday, rec, flags );
-            break;
         }
     }
     const std::size_t items_created = list.size() - prev_list_size;
@@ -871,21 +869,29 @@ item Item_group::create_single( const time_point &birthday, RecursionList &rec )
             return elem->create_single( birthday, rec );
         }
     } else if( type == G_DISTRIBUTION ) {
-        int p = rng( 0, sum_prob - 1 );
-        for( const auto &elem : items ) {
-            bool ev_based = elem->is_event_based();
-            int prob = elem->get_probability( false );
-            int real_prob = elem->get_probability( true );
-            p -= real_prob;
-            if( ( ev_based && prob == 0 ) || p >= 0 ) {
-                continue;
-            }
+        if( const Item_spawn_data *elem = pick_from_distribution() ) {
             return elem->create_single( birthday, rec );
         }
     }
     return item( null_item_id, birthday );
 }
 
+const Item_spawn_data *Item_group::pick_from_distribution() const
+{
+    const int p = rng( 0, sum_prob - 1 );
+    // The first entry whose running sum exceeds the roll. Entries for holidays
+    // other than the current one pass the roll on to the entries after them.
+    const auto first = std::upper_bound( cumulative_prob.begin(), cumulative_prob.end(), p );
+    for( size_t i = first - cumulative_prob.begin(); i < items.size(); ++i ) {
+        const Item_spawn_data &elem = *items[i];
+        if( elem.is_event_based() && elem.get_probability( false ) == 0 ) {
+            continue;
+        }
+        return &elem;
+    }
+    return nullptr;
+}
+
 void Item_group::check_consistency() const
 {
     for( const auto &elem : items ) {
@@ -902,7 +908,8 @@ int Item_spawn_data::get_probability( bool skip_event_check ) const
     }
 
     // Item spawn is event-based, but option is disabled
-    std::string opt = get_option<std::string>( "EVENT_SPAWNS" );
+    static const option_handle<std::string> opt_event_spawns( "EVENT_SPAWNS" );
+    const std::string &opt = opt_event_spawns.get();
     if( opt != "items" && opt != "both" ) {
         return 0;
     }
@@ -926,6 +933,12 @@ bool Item_group::remove_item( const itype_id &itemid )
             ++a;
         }
     }
+    cumulative_prob.clear();
+    int running_sum = 0;
+    for( const std::unique_ptr<Item_spawn_data> &elem : items ) {
+        running_sum += elem->get_probability( true );
+        cumulative_prob.push_back( running_sum );
+    }
     return items.empty();
 }
 
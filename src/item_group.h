@@ -340,6 +340,12 @@ class Single_item_creator : public Item_spawn_data
 
         bool has_item( const itype_id &itemid ) const override;
         std::set<const itype *> every_item() const override;
+
+    private:
+        // Resolved from id once, so spawning needs no lookups by name
+        mutable const itype *item_type = nullptr;
+        item_group_id group_id;
+        std::string modifier_context;
 };
 
 /**
@@ -409,6 +415,14 @@ class Item_group : public Item_spawn_data
          * Links to the entries in this group.
          */
         prop_list items;
+        /**
+         * Running sums of the probabilities of @ref items, so distributions
+         * can pick their entry with a binary search.
+         */
+        std::vector<int> cumulative_prob;
+
+    private:
+        const Item_spawn_data *pick_from_distribution() const;
 };
 
 #endif // CATA_SRC_ITEM_GROUP_H
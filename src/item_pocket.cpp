@@ -4,6 +4,7 @@
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "ammo.h"
@@ -58,6 +59,57 @@ std::string enum_to_string<pocket_type>( pocket_type data )
 // *INDENT-ON*
 } // namespace io
 
+namespace
+{
+struct pocket_totals {
+    std::optional<units::mass> contained_weight;
+    std::optional<units::volume> contained_volume;
+    std::optional<units::mass> weight_modifier;
+    std::optional<units::volume> size_modifier;
+};
+
+int pocket_totals_scopes = 0;
+std::unordered_map<const item_pocket *, pocket_totals> remembered_pocket_totals;
+
+template<typename T, typename F>
+T remember_total( const item_pocket *pocket, std::optional<T> pocket_totals::*total, F compute )
+{
+    if( pocket_totals_scopes <= 0 ) {
+        return compute();
+    }
+    std::optional<T> &ret = remembered_pocket_totals[pocket].*total;
+    if( !ret ) {
+        // no reference kept across compute(), which may add entries for nested pockets
+        const T value = compute();
+        remembered_pocket_totals[pocket].*total = value;
+        return value;
+    }
+    return *ret;
+}
+
+// A change anywhere also changes the totals of every pocket around it, and pockets
+// don't know their parents, so simply forget everything.
+void forget_pocket_totals()
+{
+    if( pocket_totals_scopes > 0 ) {
+        remembered_pocket_totals.clear();
+    }
+}
+} // namespace
+
+item_pocket::totals_scope::totals_scope()
+{
+    pocket_totals_scopes++;
+}
+
+item_pocket::totals_scope::~totals_scope()
+{
+    pocket_totals_scopes--;
+    if( pocket_totals_scopes <= 0 ) {
+        remembered_pocket_totals.clear();
+    }
+}
+
 std::vector<item_pocket::favorite_settings> item_pocket::pocket_presets;
 
 std::string pocket_data::check_definition() const
@@ -246,6 +298,7 @@ bool item_pocket::same_contents( const item_pocket &rhs ) const
 
 void item_pocket::restack()
 {
+    forget_pocket_totals();
     if( contents.size() <= 1 ) {
         return;
     }
@@ -290,6 +343,7 @@ void item_pocket::restack()
 
 item *item_pocket::restack( /*const*/ item *it )
 {
+    forget_pocket_totals();
     item *ret = it;
     if( contents.size() <= 1 ) {
         return ret;
@@ -527,6 +581,7 @@ bool item_pocket::has_any_with( const std::function<bool( const item &it )> &fil
 
 item &item_pocket::back()
 {
+    forget_pocket_totals();
     return contents.back();
 }
 
@@ -537,6 +592,7 @@ const item &item_pocket::back() const
 
 item &item_pocket::front()
 {
+    forget_pocket_totals();
     return contents.front();
 }
 
@@ -547,6 +603,7 @@ const item &item_pocket::front() const
 
 void item_pocket::pop_back()
 {
+    forget_pocket_totals();
     contents.pop_back();
 }
 
@@ -609,26 +666,30 @@ units::volume item_pocket::item_size_modifier() const
     if( data->rigid ) {
         return 0_ml;
     }
-    units::volume total_vol = 0_ml;
-    for( const item &it : contents ) {
-        total_vol += it.volume( is_type( pocket_type::MOD ) );
-    }
-    total_vol -= data->magazine_well;
-    total_vol *= data->volume_multiplier;
-    return std::max( 0_ml, total_vol );
+    return remember_total( this, &pocket_totals::size_modifier, [this]() {
+        units::volume total_vol = 0_ml;
+        for( const item &it : contents ) {
+            total_vol += it.volume( is_type( pocket_type::MOD ) );
+        }
+        total_vol -= data->magazine_well;
+        total_vol *= data->volume_multiplier;
+        return std::max( 0_ml, total_vol );
+    } );
 }
 
 units::mass item_pocket::item_weight_modifier() const
 {
-    units::mass total_mass = 0_gram;
-    for( const item &it : contents ) {
-        if( is_type( pocket_type::MOD ) ) {
-            total_mass += it.weight( true, true ) * data->weight_multiplier;
-        } else {
-            total_mass += it.weight() * data->weight_multiplier;
+    return remember_total( this, &pocket_totals::weight_modifier, [this]() {
+        units::mass total_mass = 0_gram;
+        for( const item &it : contents ) {
+            if( is_type( pocket_type::MOD ) ) {
+                total_mass += it.weight( true, true ) * data->weight_multiplier;
+            } else {
+                total_mass += it.weight() * data->weight_multiplier;
+            }
         }
-    }
-    return total_mass;
+        return total_mass;
+    } );
 }
 
 units::length item_pocket::item_length_modifier() const
@@ -708,9 +769,10 @@ itype_id item_pocket::magazine_default() const
 
 int item_pocket::ammo_consume( int qty )
 {
+    forget_pocket_totals();
     int need = qty;
     int used = 0;
-    std::list<item>::iterator it;
+    contents_t::iterator it;
     for( it = contents.begin(); it != contents.end(); ) {
         if( it->has_flag( flag_CASING ) ) {
             it++;
@@ -768,6 +830,7 @@ std::set<ammotype> item_pocket::ammo_types() const
 
 void item_pocket::casings_handle( const std::function<bool( item & )> &func )
 {
+    forget_pocket_totals();
     for( auto it = contents.begin(); it != contents.end(); ) {
         if( it->has_flag( flag_CASING ) ) {
             it->unset_flag( flag_CASING );
@@ -784,6 +847,7 @@ void item_pocket::casings_handle( const std::function<bool( item & )> &func )
 
 void item_pocket::handle_liquid_or_spill( Character &guy, const item *avoid )
 {
+    forget_pocket_totals();
     if( guy.is_npc() ) {
         spill_contents( guy.pos() );
         return;
@@ -809,6 +873,7 @@ void item_pocket::handle_liquid_or_spill( Character &guy, const item *avoid )
 
 bool item_pocket::use_amount( const itype_id &it, int &quantity, std::list<item> &used )
 {
+    forget_pocket_totals();
     bool used_item = false;
     for( auto a = contents.begin(); a != contents.end() && quantity > 0; ) {
         if( a->use_amount( it, quantity, used ) ) {
@@ -887,6 +952,7 @@ std::string item_pocket::translated_sealed_prefix() const
 
 bool item_pocket::detonate( const tripoint &pos, std::vector<item> &drops )
 {
+    forget_pocket_totals();
     const auto new_end = std::remove_if( contents.begin(), contents.end(), [&pos, &drops]( item & it ) {
         return it.detonate( pos, drops );
     } );
@@ -901,6 +967,7 @@ bool item_pocket::detonate( const tripoint &pos, std::vector<item> &drops )
 bool item_pocket::process( const itype &type, map &here, Character *carrier, const tripoint &pos,
                            float insulation, const temperature_flag flag )
 {
+    forget_pocket_totals();
     bool processed = false;
     float spoil_multiplier = 1.0f;
     for( auto it = contents.begin(); it != contents.end(); ) {
@@ -921,6 +988,7 @@ bool item_pocket::process( const itype &type, map &here, Character *carrier, con
 
 void item_pocket::remove_all_ammo( Character &guy )
 {
+    forget_pocket_totals();
     for( auto iter = contents.begin(); iter != contents.end(); ) {
         if( iter->is_irremovable() ) {
             iter++;
@@ -933,6 +1001,7 @@ void item_pocket::remove_all_ammo( Character &guy )
 
 void item_pocket::remove_all_mods( Character &guy )
 {
+    forget_pocket_totals();
     for( auto iter = contents.begin(); iter != contents.end(); ) {
         if( iter->is_toolmod() ) {
             guy.i_add_or_drop( *iter );
@@ -1736,6 +1805,7 @@ bool item_pocket::can_reload_with( const item &ammo, const bool now ) const
 
 std::optional<item> item_pocket::remove_item( const item &it )
 {
+    forget_pocket_totals();
     item ret( it );
     const size_t sz = contents.size();
     contents.remove_if( [&it]( const item & rhs ) {
@@ -1751,9 +1821,11 @@ std::optional<item> item_pocket::remove_item( const item &it )
 bool item_pocket::remove_internal( const std::function<bool( item & )> &filter,
                                    int &count, std::list<item> &res )
 {
+    forget_pocket_totals();
     for( auto it = contents.begin(); it != contents.end(); ) {
         if( filter( *it ) ) {
-            res.splice( res.end(), contents, it++ );
+            res.emplace_back( std::move( *it ) );
+            it = contents.erase( it );
             if( --count == 0 ) {
                 return true;
             }
@@ -1805,6 +1877,7 @@ static void move_to_parent_pocket_recursive( const tripoint &pos, item &it,
 
 void item_pocket::overflow( const tripoint &pos, const item_location &loc )
 {
+    forget_pocket_totals();
     if( is_type( pocket_type::MOD ) || is_type( pocket_type::CORPSE ) ||
         is_type( pocket_type::EBOOK ) || is_type( pocket_type::CABLE ) ) {
         return;
@@ -1923,12 +1996,14 @@ void item_pocket::on_pickup( Character &guy, item *avoid )
 
 void item_pocket::on_contents_changed()
 {
+    forget_pocket_totals();
     unseal();
     restack();
 }
 
 bool item_pocket::spill_contents( const tripoint &pos )
 {
+    forget_pocket_totals();
     if( is_type( pocket_type::EBOOK ) || is_type( pocket_type::CORPSE ) ||
         is_type( pocket_type::CABLE ) ) {
         return false;
@@ -1945,6 +2020,7 @@ bool item_pocket::spill_contents( const tripoint &pos )
 
 void item_pocket::clear_items()
 {
+    forget_pocket_totals();
     contents.clear();
 }
 
@@ -1985,6 +2061,7 @@ void item_pocket::remove_items_if( const std::function<bool( item & )> &filter )
 void item_pocket::process( map &here, Character *carrier, const tripoint &pos, float insulation,
                            temperature_flag flag, float spoil_multiplier_parent )
 {
+    forget_pocket_totals();
     for( auto iter = contents.begin(); iter != contents.end(); ) {
         if( iter->process( here, carrier, pos, insulation, flag,
                            // spoil multipliers on pockets are not additive or multiplicative, they choose the best
@@ -2000,6 +2077,7 @@ void item_pocket::process( map &here, Character *carrier, const tripoint &pos, f
 void item_pocket::leak( map &here, Character *carrier, const tripoint &pos,
                         item_pocket *pocke )
 {
+    forget_pocket_totals();
     std::vector<item *> erases;
     for( auto iter = contents.begin(); iter != contents.end(); ) {
         if( iter->leak( here, carrier, pos, this ) ) {
@@ -2116,6 +2194,7 @@ const pocket_data *item_pocket::get_pocket_data() const
 
 void item_pocket::add( const item &it, item **ret )
 {
+    forget_pocket_totals();
     contents.push_back( it );
     if( ret == nullptr ) {
         restack();
@@ -2126,6 +2205,7 @@ void item_pocket::add( const item &it, item **ret )
 
 void item_pocket::add( const item &it, const int copies, std::vector<item *> &added )
 {
+    forget_pocket_totals();
     for( auto iter = contents.insert( contents.end(), copies, it ); iter != contents.end(); iter++ ) {
         added.push_back( &*iter );
     }
@@ -2189,14 +2269,16 @@ int item_pocket::fill_with( const item &contained, Character &guy, int amount,
     return num_contained;
 }
 
-std::list<item> &item_pocket::edit_contents()
+item_pocket::contents_t &item_pocket::edit_contents()
 {
+    forget_pocket_totals();
     return contents;
 }
 
 ret_val<item *> item_pocket::insert_item( const item &it,
         const bool into_bottom, bool restack_charges, bool ignore_contents )
 {
+    forget_pocket_totals();
     ret_val<item_pocket::contain_code> containable = can_contain( it, ignore_contents );
 
     if( !containable.success() ) {
@@ -2230,7 +2312,8 @@ std::pair<item_location, item_pocket *> item_pocket::best_pocket_in_contents(
         settings.priority() > 0;
 
     for( item &contained_item : contents ) {
-        if( &contained_item == &it || &contained_item == avoid ) {
+        // Only containers can take the item, don't make locations for everything else
+        if( &contained_item == &it || &contained_item == avoid || !contained_item.is_container() ) {
             continue;
         }
         item_location new_loc( this_loc, &contained_item );
@@ -2307,20 +2390,24 @@ units::length item_pocket::min_containable_length() const
 
 units::volume item_pocket::contains_volume() const
 {
-    units::volume vol = 0_ml;
-    for( const item &it : contents ) {
-        vol += it.volume();
-    }
-    return vol;
+    return remember_total( this, &pocket_totals::contained_volume, [this]() {
+        units::volume vol = 0_ml;
+        for( const item &it : contents ) {
+            vol += it.volume();
+        }
+        return vol;
+    } );
 }
 
 units::mass item_pocket::contains_weight() const
 {
-    units::mass weight = 0_gram;
-    for( const item &it : contents ) {
-        weight += it.weight();
-    }
-    return weight;
+    return remember_total( this, &pocket_totals::contained_weight, [this]() {
+        units::mass weight = 0_gram;
+        for( const item &it : contents ) {
+            weight += it.weight();
+        }
+        return weight;
+    } );
 }
 
 units::mass item_pocket::remaining_weight() const
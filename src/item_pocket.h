@@ -16,6 +16,7 @@
 #include "enums.h"
 #include "flat_set.h"
 #include "pocket_type.h"
+#include "pool_allocator.h"
 #include "ret_val.h"
 #include "type_id.h"
 #include "units.h"
@@ -60,6 +61,23 @@ class item_pocket
             ERR_AMMO
         };
 
+        /**
+         * While at least one totals_scope is alive, the weight and volume totals of each
+         * pocket (contains_weight(), contains_volume(), item_weight_modifier() and
+         * item_size_modifier()) are computed once and then reused, so that weighing nested
+         * containers repeatedly doesn't walk their whole contents every time.
+         * Changing the contents of any pocket through item_pocket drops everything remembered.
+         * Use it around code that weighs items which can't change meanwhile.
+         */
+        class totals_scope
+        {
+            public:
+                totals_scope();
+                ~totals_scope();
+                totals_scope( const totals_scope & ) = delete;
+                totals_scope &operator=( const totals_scope & ) = delete;
+        };
+
         class favorite_settings
         {
             public:
@@ -344,8 +362,11 @@ class item_pocket
             item_location &this_loc, const item &it, const item *avoid,
             bool allow_sealed, bool ignore_settings );
 
+        // nodes come from a pool so that items stored together are also close in memory
+        using contents_t = std::list<item, cata::pool_allocator<item>>;
+
         // only available to help with migration from previous usage of std::list<item>
-        std::list<item> &edit_contents();
+        contents_t &edit_contents();
 
         // cost of getting an item from this pocket
         // @TODO: make move cost vary based on other contained items
@@ -408,7 +429,7 @@ class item_pocket
         bool _saved_sealed = false; // NOLINT(cata-serialize)
         const pocket_data *data = nullptr; // NOLINT(cata-serialize)
         // the items inside the pocket
-        std::list<item> contents;
+        contents_t contents;
         bool _sealed = false;
         // list of sub body parts that can't currently support rigid ablative armor
         std::set<sub_bodypart_id> no_rigid;
@@ -1,6 +1,9 @@
 #include "item_search.h"
 
 #include <map>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 
 #include "avatar.h"
@@ -14,6 +17,42 @@
 
 static std::pair<std::string, std::string> get_both( std::string_view a );
 
+namespace
+{
+/**
+ * Remembers whether the (translated) name behind an id matches the query, so that
+ * each category, material or item type is only lowercased and searched once per
+ * compiled filter. Copies of the filter share the results.
+ */
+template<typename Id>
+class cached_name_match
+{
+    public:
+        explicit cached_name_match( const std::string &filter ) : query( lcmatch_prepare( filter ) ),
+            results( std::make_shared<std::unordered_map<Id, bool>>() ) {}
+
+        /** @param name_or_match returns either the name to match, or the match result itself */
+        template<typename F>
+        bool operator()( const Id &id, F name_or_match ) const {
+            auto iter = results->find( id );
+            if( iter == results->end() ) {
+                bool matched;
+                if constexpr( std::is_same_v<decltype( name_or_match() ), bool> ) {
+                    matched = name_or_match();
+                } else {
+                    matched = lcmatch( name_or_match(), query );
+                }
+                iter = results->emplace( id, matched ).first;
+            }
+            return iter->second;
+        }
+
+    private:
+        std::u32string query;
+        std::shared_ptr<std::unordered_map<Id, bool>> results;
+};
+} // namespace
+
 std::function<bool( const item & )> basic_item_filter( std::string filter )
 {
     size_t colon;
@@ -26,30 +65,45 @@ std::function<bool( const item & )> basic_item_filter( std::string filter )
     }
     switch( flag ) {
         // category
-        case 'c':
-            return [filter]( const item & i ) {
-                return lcmatch( i.get_category_of_contents().name(), filter );
+        case 'c': {
+            cached_name_match<item_category_id> matches( filter );
+            return [matches]( const item & i ) {
+                const item_category &cat = i.get_category_of_contents();
+                return matches( cat.get_id(), [&cat]() {
+                    return cat.name();
+                } );
             };
+        }
         // material
-        case 'm':
-            return [filter]( const item & i ) {
+        case 'm': {
+            cached_name_match<material_id> matches( filter );
+            return [matches]( const item & i ) {
                 return std::any_of( i.made_of().begin(), i.made_of().end(),
-                [&filter]( const std::pair<material_id, int> &mat ) {
-                    return lcmatch( mat.first->name(), filter );
+                [&matches]( const std::pair<material_id, int> &mat ) {
+                    return matches( mat.first, [&mat]() {
+                        return mat.first->name();
+                    } );
                 } );
             };
+        }
         // qualities
-        case 'q':
-            return [filter]( const item & i ) {
-                return i.type->has_any_quality( filter );
+        case 'q': {
+            // qualities only depend on the item type
+            cached_name_match<itype_id> matches( filter );
+            return [matches, filter]( const item & i ) {
+                return matches( i.typeId(), [&i, &filter]() {
+                    return i.type->has_any_quality( filter );
+                } );
             };
+        }
         // both
-        case 'b':
-            return [filter]( const item & i ) {
-                auto pair = get_both( filter );
-                return item_filter_from_string( pair.first )( i )
-                       && item_filter_from_string( pair.second )( i );
+        case 'b': {
+            auto pair = get_both( filter );
+            return [first = item_filter_from_string( pair.first ),
+                           second = item_filter_from_string( pair.second )]( const item & i ) {
+                return first( i ) && second( i );
             };
+        }
         // disassembled components
         case 'd':
             return [filter]( const item & i ) {
@@ -68,17 +122,19 @@ std::function<bool( const item & )> basic_item_filter( std::string filter )
                 return !note.empty() && lcmatch( note, filter );
             };
         // item flags, must type in whole flag string name(case insensitive) so as to avoid revealing hidden flags.
-        case 'f':
-            return [filter]( const item & i ) {
-                std::string flag_filter = filter;
-                transform( flag_filter.begin(), flag_filter.end(), flag_filter.begin(), ::toupper );
-                const flag_id fsearch( flag_filter );
-                if( fsearch.is_valid() ) {
-                    return i.has_flag( fsearch );
-                } else {
+        case 'f': {
+            std::string flag_filter = filter;
+            transform( flag_filter.begin(), flag_filter.end(), flag_filter.begin(), ::toupper );
+            const flag_id fsearch( flag_filter );
+            if( !fsearch.is_valid() ) {
+                return []( const item & ) {
                     return false;
-                }
+                };
+            }
+            return [fsearch]( const item & i ) {
+                return i.has_flag( fsearch );
             };
+        }
         // by book skill
         case 's':
             return [filter]( const item & i ) {
@@ -117,8 +173,8 @@ std::function<bool( const item & )> basic_item_filter( std::string filter )
         }
         // by name
         default:
-            return [filter]( const item & a ) {
-                return lcmatch( remove_color_tags( a.tname() ), filter );
+            return [query = lcmatch_prepare( filter )]( const item & a ) {
+                return lcmatch( remove_color_tags( a.tname() ), query );
             };
     }
 }
@@ -2,6 +2,7 @@
 
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "avatar.h"
@@ -578,8 +579,60 @@ static_assert( all_segments_have_printers(),
                "every element of tname::segments (up to tname::segments::last_segment) "
                "must map to a printer in segs_array" );
 
+namespace
+{
+struct cached_tname {
+    unsigned int quantity;
+    segment_bitset segments;
+    std::string name;
+};
+
+int tname_cache_scopes = 0;
+// an item is usually named with only a couple of different arguments
+std::unordered_map<item const *, std::vector<cached_tname>> tname_cache;
+} // namespace
+
 namespace tname
 {
+cache_scope::cache_scope()
+{
+    tname_cache_scopes++;
+}
+
+cache_scope::~cache_scope()
+{
+    tname_cache_scopes--;
+    if( tname_cache_scopes <= 0 ) {
+        tname_cache.clear();
+    }
+}
+
+std::string const *find_cached( item const &it, unsigned int quantity,
+                                segment_bitset const &segments )
+{
+    if( tname_cache_scopes <= 0 ) {
+        return nullptr;
+    }
+    auto const iter = tname_cache.find( &it );
+    if( iter == tname_cache.end() ) {
+        return nullptr;
+    }
+    for( cached_tname const &entry : iter->second ) {
+        if( entry.quantity == quantity && entry.segments == segments ) {
+            return &entry.name;
+        }
+    }
+    return nullptr;
+}
+
+void store_cached( item const &it, unsigned int quantity, segment_bitset const &segments,
+                   std::string const &name )
+{
+    if( tname_cache_scopes > 0 ) {
+        tname_cache[&it].push_back( { quantity, segments, name } );
+    }
+}
+
 std::string print_segment( tname::segments segment, item const &it, unsigned int quantity,
                            segment_bitset const &segments )
 {
@@ -77,6 +77,28 @@ using segment_bitset = enum_bitset<tname::segments>;
 std::string print_segment( tname::segments segment, item const &it, unsigned int quantity,
                            segment_bitset const &segments );
 
+/**
+ * While at least one cache_scope is alive, item::tname() remembers its results per item,
+ * quantity and segments, and the cache is dropped when the last scope ends.
+ * Use it around code that names many items which can't change meanwhile, such as
+ * building, sorting or drawing an item list.
+ */
+class cache_scope
+{
+    public:
+        cache_scope();
+        ~cache_scope();
+        cache_scope( const cache_scope & ) = delete;
+        cache_scope &operator=( const cache_scope & ) = delete;
+};
+
+/** The remembered name, or nullptr if there is none or no cache_scope is alive */
+std::string const *find_cached( item const &it, unsigned int quantity,
+                                segment_bitset const &segments );
+/** Remembers the name if a cache_scope is alive */
+void store_cached( item const &it, unsigned int quantity, segment_bitset const &segments,
+                   std::string const &name );
+
 #endif // CATA_IN_TOOL
 } // namespace tname
 
@@ -1166,6 +1166,7 @@ struct memory_card_info {
 
 struct itype {
         friend class Item_factory;
+        friend class item;
         friend struct mod_tracker;
 
         using FlagsSetType = std::set<flag_id>;
@@ -1441,6 +1442,13 @@ struct itype {
         /** Can item be combined with other identical items? */
         bool stackable_ = false;
 
+        /**
+         * A fresh item of this type, set by Item_factory::finalize for types whose new items
+         * never differ from each other. item::item copies it instead of building the item up
+         * from the type again.
+         */
+        std::shared_ptr<const item> spawn_prototype;
+
     public:
         static constexpr int damage_scale = 1000; /** Damage scale compared to the old float damage value */
 
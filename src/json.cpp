@@ -3,6 +3,7 @@
 #include <clocale>
 #include <algorithm>
 #include <bitset>
+#include <charconv>
 #include <cmath> // IWYU pragma: keep
 #include <cstdint>
 #include <cstdio>
@@ -2236,13 +2237,70 @@ JsonOut::JsonOut( std::ostream &s, bool pretty, int depth ) :
     stream->setf( std::ios_base::boolalpha );
 }
 
+BufferedJsonOut::BufferedJsonOut( std::ostream &s, bool pretty, int depth ) :
+    JsonOut( s, pretty, depth )
+{
+    buffered = true;
+    buffer.reserve( flush_size + 1024 );
+}
+
+BufferedJsonOut::~BufferedJsonOut()
+{
+    flush();
+}
+
+void JsonOut::flush()
+{
+    if( !buffer.empty() ) {
+        stream->write( buffer.data(), buffer.size() );
+        buffer.clear();
+    }
+}
+
+template<typename T>
+static void format_floating( T val, std::string &out )
+{
+    // Same as the stream formatting set up in the constructor, which
+    // is printf's %f with the default precision.
+    std::array<char, 128> buf;
+    const std::to_chars_result res = std::to_chars( buf.data(), buf.data() + buf.size(), val,
+                                     std::chars_format::fixed, 6 );
+    if( res.ec == std::errc() ) {
+        out.assign( buf.data(), res.ptr );
+        return;
+    }
+    // Huge values don't fit into the buffer
+    std::ostringstream ss;
+    ss.imbue( std::locale::classic() );
+    ss.setf( std::ios_base::showpoint );
+    ss.setf( std::ios_base::fixed, std::ostream::floatfield );
+    ss << val;
+    out = ss.str();
+}
+
+void JsonOut::write_floating( double val )
+{
+    std::string formatted;
+    format_floating( val, formatted );
+    put( formatted );
+}
+
+void JsonOut::write_floating( long double val )
+{
+    std::string formatted;
+    format_floating( val, formatted );
+    put( formatted );
+}
+
 int JsonOut::tell()
 {
+    flush();
     return stream->tellp();
 }
 
 void JsonOut::seek( int pos )
 {
+    flush();
     stream->clear();
     stream->seekp( pos );
     need_separator = false;
@@ -2250,7 +2308,9 @@ void JsonOut::seek( int pos )
 
 void JsonOut::write_indent()
 {
-    std::fill_n( std::ostream_iterator<char>( *stream ), indent_level * 2, ' ' );
+    for( int i = 0; i < indent_level * 2; ++i ) {
+        put( ' ' );
+    }
 }
 
 void JsonOut::write_separator()
@@ -2258,15 +2318,15 @@ void JsonOut::write_separator()
     if( !need_separator ) {
         return;
     }
-    stream->put( ',' );
+    put( ',' );
     if( pretty_print ) {
         // Wrap after separator between objects and between members of top-level objects.
         if( indent_level < 2 || need_wrap.back() ) {
-            stream->put( '\n' );
+            put( '\n' );
             write_indent();
         } else {
             // Otherwise pad after commas.
-            stream->put( ' ' );
+            put( ' ' );
         }
     }
     need_separator = false;
@@ -2275,9 +2335,9 @@ void JsonOut::write_separator()
 void JsonOut::write_member_separator()
 {
     if( pretty_print ) {
-        stream->write( ": ", 2 );
+        put( ": " );
     } else {
-        stream->put( ':' );
+        put( ':' );
     }
     need_separator = false;
 }
@@ -2288,11 +2348,11 @@ void JsonOut::start_pretty()
         indent_level += 1;
         // Wrap after top level object and array opening.
         if( indent_level < 2 || need_wrap.back() ) {
-            stream->put( '\n' );
+            put( '\n' );
             write_indent();
         } else {
             // Otherwise pad after opening.
-            stream->put( ' ' );
+            put( ' ' );
         }
     }
 }
@@ -2304,11 +2364,11 @@ void JsonOut::end_pretty()
         // Wrap after ending top level array and object.
         // Also wrap in the special case of exiting an array containing an object.
         if( indent_level < 1 || need_wrap.back() ) {
-            stream->put( '\n' );
+            put( '\n' );
             write_indent();
         } else {
             // Otherwise pad after ending.
-            stream->put( ' ' );
+            put( ' ' );
         }
     }
 }
@@ -2318,7 +2378,7 @@ void JsonOut::start_object( bool wrap )
     if( need_separator ) {
         write_separator();
     }
-    stream->put( '{' );
+    put( '{' );
     need_wrap.push_back( wrap );
     start_pretty();
     need_separator = false;
@@ -2328,7 +2388,7 @@ void JsonOut::end_object()
 {
     end_pretty();
     need_wrap.pop_back();
-    stream->put( '}' );
+    put( '}' );
     need_separator = true;
 }
 
@@ -2337,7 +2397,7 @@ void JsonOut::start_array( bool wrap )
     if( need_separator ) {
         write_separator();
     }
-    stream->put( '[' );
+    put( '[' );
     need_wrap.push_back( wrap );
     start_pretty();
     need_separator = false;
@@ -2347,7 +2407,7 @@ void JsonOut::end_array()
 {
     end_pretty();
     need_wrap.pop_back();
-    stream->put( ']' );
+    put( ']' );
     need_separator = true;
 }
 
@@ -2356,50 +2416,64 @@ void JsonOut::write_null()
     if( need_separator ) {
         write_separator();
     }
-    stream->write( "null", 4 );
+    put( "null" );
     need_separator = true;
 }
 
+// Characters that have to be escaped inside json strings.
+static constexpr std::array<bool, 256> needs_escape = []() {
+    std::array<bool, 256> table{};
+    for( int ch = 0; ch < 0x20; ++ch ) {
+        table[ch] = true;
+    }
+    table['"'] = true;
+    table['\\'] = true;
+    return table;
+}();
+
 void JsonOut::write( const std::string_view val )
 {
     if( need_separator ) {
         write_separator();
     }
-    stream->put( '"' );
-    for( const char &i : val ) {
-        unsigned char ch = i;
+    put( '"' );
+    size_t run_start = 0;
+    for( size_t i = 0; i < val.size(); ++i ) {
+        const unsigned char ch = val[i];
+        if( !needs_escape[ch] ) {
+            continue;
+        }
+        // Copy everything up to here in one go
+        put( val.substr( run_start, i - run_start ) );
+        run_start = i + 1;
         if( ch == '"' ) {
-            stream->write( "\\\"", 2 );
+            put( "\\\"" );
         } else if( ch == '\\' ) {
-            stream->write( "\\\\", 2 );
-        } else if( ch == '/' ) {
-            // don't technically need to escape this
-            stream->put( '/' );
+            put( "\\\\" );
         } else if( ch == '\b' ) {
-            stream->write( "\\b", 2 );
+            put( "\\b" );
         } else if( ch == '\f' ) {
-            stream->write( "\\f", 2 );
+            put( "\\f" );
         } else if( ch == '\n' ) {
-            stream->write( "\\n", 2 );
+            put( "\\n" );
         } else if( ch == '\r' ) {
-            stream->write( "\\r", 2 );
+            put( "\\r" );
         } else if( ch == '\t' ) {
-            stream->write( "\\t", 2 );
-        } else if( ch < 0x20 ) {
+            put( "\\t" );
+        } else {
             // convert to "\uxxxx" unicode escape
-            stream->write( "\\u00", 4 );
-            stream->put( ( ch < 0x10 ) ? '0' : '1' );
+            put( "\\u00" );
+            put( ( ch < 0x10 ) ? '0' : '1' );
             char remainder = ch & 0x0F;
             if( remainder < 0x0A ) {
-                stream->put( '0' + remainder );
+                put( static_cast<char>( '0' + remainder ) );
             } else {
-                stream->put( 'A' + ( remainder - 0x0A ) );
+                put( static_cast<char>( 'A' + ( remainder - 0x0A ) ) );
             }
-        } else {
-            stream->put( ch );
         }
     }
-    stream->put( '"' );
+    put( val.substr( run_start ) );
+    put( '"' );
     need_separator = true;
 }
 
@@ -2410,12 +2484,12 @@ void JsonOut::write( const std::bitset<N> &b )
         write_separator();
     }
     std::string converted = b.to_string();
-    stream->put( '"' );
+    put( '"' );
     for( char &i : converted ) {
         unsigned char ch = i;
-        stream->put( ch );
+        put( ch );
     }
-    stream->put( '"' );
+    put( '"' );
     need_separator = true;
 }
 
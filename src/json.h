@@ -4,6 +4,7 @@
 
 #include <array>
 #include <bitset>
+#include <charconv>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
@@ -12,6 +13,7 @@
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -731,6 +733,8 @@ class TextJsonIn
  *
  * Basic containers such as maps, sets and vectors,
  * can be serialized automatically by write() and member().
+ *
+ * Large files should be written with @ref BufferedJsonOut instead.
  */
 class JsonOut
 {
@@ -741,6 +745,34 @@ class JsonOut
         int indent_level = 0;
         bool need_separator = false;
 
+        void write_floating( double val );
+        void write_floating( long double val );
+
+    protected:
+        // Output not yet handed to the stream, only used if buffered
+        std::string buffer;
+        bool buffered = false;
+        // Buffered output is handed to the stream once it grows larger than this
+        static constexpr size_t flush_size = 64 * 1024;
+
+        void put( char ch ) {
+            if( buffered ) {
+                buffer.push_back( ch );
+            } else {
+                stream->put( ch );
+            }
+        }
+        void put( const std::string_view str ) {
+            if( buffered ) {
+                buffer.append( str );
+                if( buffer.size() >= flush_size ) {
+                    flush();
+                }
+            } else {
+                stream->write( str.data(), str.size() );
+            }
+        }
+
     public:
         explicit JsonOut( std::ostream &stream, bool pretty_print = false, int depth = 0 );
         JsonOut( const JsonOut & ) = delete;
@@ -757,8 +789,15 @@ class JsonOut
             need_separator = true;
         }
         std::ostream *get_stream() {
+            flush();
             return stream;
         }
+        /** Hands any buffered output to the stream. */
+        void flush();
+        /** Writes a line break, for files meant to be diffed or read by people. */
+        void write_line_break() {
+            put( '\n' );
+        }
         int tell();
         void seek( int pos );
         void start_pretty();
@@ -777,7 +816,20 @@ class JsonOut
             if( need_separator ) {
                 write_separator();
             }
-            *stream << val;
+            if constexpr( std::is_same_v<T, bool> ) {
+                put( val ? std::string_view( "true" ) : std::string_view( "false" ) );
+            } else if constexpr( std::is_integral_v<T> ) {
+                // to_chars is locale independent and skips the stream's formatting machinery
+                using wide = std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>;
+                std::array<char, 24> buf;
+                const std::to_chars_result res = std::to_chars( buf.data(), buf.data() + buf.size(),
+                                                 static_cast<wide>( val ) );
+                put( std::string_view( buf.data(), res.ptr - buf.data() ) );
+            } else if constexpr( std::is_same_v<T, long double> ) {
+                write_floating( val );
+            } else {
+                write_floating( static_cast<double>( val ) );
+            }
             need_separator = true;
         }
 
@@ -961,6 +1013,21 @@ class JsonOut
         }
 };
 
+/**
+ * JsonOut that collects its output in a buffer and hands it to the stream in large blocks,
+ * instead of going through the stream for every token. The rest of the output reaches the
+ * stream when @ref flush is called or this is destroyed, don't write to the stream directly
+ * until then.
+ */
+class BufferedJsonOut : public JsonOut
+{
+    public:
+        explicit BufferedJsonOut( std::ostream &stream, bool pretty_print = false, int depth = 0 );
+        BufferedJsonOut( const BufferedJsonOut & ) = delete;
+        BufferedJsonOut &operator=( const BufferedJsonOut & ) = delete;
+        ~BufferedJsonOut();
+};
+
 /* TextJsonObject
  * ==========
  *
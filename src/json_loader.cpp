@@ -1,6 +1,7 @@
 #include "json_loader.h"
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include <ghc/fs_std_fwd.hpp>
@@ -58,6 +59,8 @@ flexbuffer_cache &cache_for_save( const cata_path &path )
     std::string folder_or_file = path_it->u8string();
     ++path_it;
 
+    static std::mutex save_caches_mutex;
+    std::lock_guard<std::mutex> lock( save_caches_mutex );
     auto it = save_caches.find( worldname_str );
     if( it == save_caches.end() ) {
         it = save_caches.emplace( worldname_str,
@@ -172,3 +175,21 @@ std::optional<JsonValue> json_loader::from_string_opt( std::string const &data )
     }
     return ret;
 }
+
+JsonValue json_loader::from_binary( std::vector<uint8_t> data,
+                                    const cata_path &source_file ) noexcept( false )
+{
+    std::shared_ptr<parsed_flexbuffer> buffer = flexbuffer_cache::from_binary( std::move( data ),
+            source_file.get_unrelative_path() );
+    flexbuffers::Reference buffer_root = flexbuffer_root_from_storage( buffer->get_storage() );
+    return JsonValue( std::move( buffer ), buffer_root, nullptr, 0 );
+}
+
+void json_loader::pack_caches()
+{
+    base_cache().write_pack();
+    config_cache().write_pack();
+    data_cache().write_pack();
+    memorial_cache().write_pack();
+    user_cache().write_pack();
+}
@@ -2,6 +2,9 @@
 #ifndef CATA_SRC_JSON_LOADER_H
 #define CATA_SRC_JSON_LOADER_H
 
+#include <cstdint>
+#include <vector>
+
 #include <ghc/fs_std_fwd.hpp>
 
 #include "path_info.h"
@@ -26,6 +29,15 @@ class json_loader
         static JsonValue from_string( std::string const &data ) noexcept( false );
         static std::optional<JsonValue> from_string_opt( std::string const &data ) noexcept( false );
 
+        // Create a JsonValue from FlexBuffer binary data, e.g. as stored in binary map saves,
+        // skipping the json text entirely. @param source_file is only used in error messages.
+        static JsonValue from_binary( std::vector<uint8_t> data,
+                                      const cata_path &source_file ) noexcept( false );
+
+        // Packs the FlexBuffers cached for game data, mods and config since the last call, so
+        // the next start reads one file per cache instead of one per json file.
+        static void pack_caches();
+
 };
 
 #endif // CATA_SRC_JSON_LOADER_H
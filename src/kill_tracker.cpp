@@ -158,6 +158,12 @@ static Character *get_avatar_or_follower( const character_id &id )
 
 static constexpr int npc_kill_xp = 10;
 
+bool kill_tracker::is_interested_in( event_type type )
+{
+    return type == event_type::character_kills_monster ||
+           type == event_type::character_kills_character;
+}
+
 void kill_tracker::notify( const cata::event &e )
 {
     switch( e.type() ) {
@@ -41,6 +41,7 @@ class kill_tracker : public event_subscriber
         void clear();
         using event_subscriber::notify;
         void notify( const cata::event & ) override;
+        bool is_interested_in( event_type ) override;
 
         void serialize( JsonOut & ) const;
         void deserialize( const JsonObject &data );
@@ -1,24 +1,35 @@
 #include "level_cache.h"
 
 #include <algorithm>
+#include <tuple>
+
+bool light_arc::operator==( const light_arc &rhs ) const
+{
+    return pos == rhs.pos && angle == rhs.angle && luminance == rhs.luminance && width == rhs.width;
+}
+
+bool light_arc::operator<( const light_arc &rhs ) const
+{
+    return std::tie( pos, angle, luminance, width ) <
+           std::tie( rhs.pos, rhs.angle, rhs.luminance, rhs.width );
+}
 
 level_cache::level_cache()
 {
-    const int map_dimensions = MAPSIZE_X * MAPSIZE_Y;
     transparency_cache_dirty.set();
     outside_cache_dirty = true;
     floor_cache_dirty = false;
     constexpr four_quadrants four_zeros( 0.0f );
-    std::fill_n( &lm[0][0], map_dimensions, four_zeros );
-    std::fill_n( &sm[0][0], map_dimensions, 0.0f );
-    std::fill_n( &light_source_buffer[0][0], map_dimensions, 0.0f );
-    std::fill_n( &outside_cache[0][0], map_dimensions, false );
-    std::fill_n( &floor_cache[0][0], map_dimensions, false );
-    std::fill_n( &transparency_cache[0][0], map_dimensions, 0.0f );
-    std::fill_n( &vision_transparency_cache[0][0], map_dimensions, 0.0f );
-    std::fill_n( &seen_cache[0][0], map_dimensions, 0.0f );
-    std::fill_n( &camera_cache[0][0], map_dimensions, 0.0f );
-    std::fill_n( &visibility_cache[0][0], map_dimensions, lit_level::DARK );
+    lm.fill( four_zeros );
+    sm.fill( 0.0f );
+    light_source_buffer.fill( 0.0f );
+    outside_cache.fill( false );
+    floor_cache.fill( false );
+    transparency_cache.fill( 0.0f );
+    vision_transparency_cache.fill( 0.0f );
+    seen_cache.fill( 0.0f );
+    camera_cache.fill( 0.0f );
+    visibility_cache.fill( lit_level::DARK );
     clear_vehicle_cache();
 }
 
@@ -34,9 +45,8 @@ bool level_cache::get_veh_exists_at( const tripoint &pt ) const
 
 std::pair<vehicle *, int> level_cache::get_veh_cached_parts( const tripoint &pt ) const
 {
-    auto it = veh_cached_parts.find( pt );
-    if( it != veh_cached_parts.end() ) {
-        return it->second;
+    if( const std::pair<vehicle *, int> *found = veh_cached_parts.find( pt ) ) {
+        return *found;
     }
     vehicle *veh = nullptr;
     return std::make_pair( veh, -1 );
@@ -66,8 +76,8 @@ void level_cache::clear_vehicle_cache()
 
 void level_cache::clear_veh_from_veh_cached_parts( const tripoint &pt, vehicle *veh )
 {
-    auto it = veh_cached_parts.find( pt );
-    if( it != veh_cached_parts.end() && it->second.first == veh ) {
-        veh_cached_parts.erase( it );
+    const std::pair<vehicle *, int> *found = veh_cached_parts.find( pt );
+    if( found != nullptr && found->first == veh ) {
+        veh_cached_parts.erase( pt );
     }
 }
@@ -7,15 +7,57 @@
 #include <set>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "game_constants.h"
 #include "lightmap.h"
 #include "point.h"
 #include "shadowcasting.h"
+#include "tripoint_map.h"
+#include "units.h"
 #include "value_ptr.h"
 
 class vehicle;
 
+// A directional light queued by map::add_light_arc, see map::apply_light_arc
+struct light_arc {
+    point pos;
+    units::angle angle;
+    float luminance;
+    units::angle width;
+
+    bool operator==( const light_arc &rhs ) const;
+    bool operator<( const light_arc &rhs ) const;
+};
+
+// Light contributed by the buffered light sources and arcs of one level, together with the
+// inputs it was built from.  Kept across turns so that map::generate_lightmap only needs to
+// recast the submaps around sources that actually changed.
+struct source_lightmap {
+    cata::mdarray<four_quadrants, point_bub_ms> lm;
+    cata::mdarray<float, point_bub_ms> sm;
+    cata::mdarray<float, point_bub_ms> light_source_buffer;
+    cata::mdarray<float, point_bub_ms> transparency_cache;
+    // Sorted
+    std::vector<light_arc> light_arcs;
+};
+
+// Sunlight reaching one level from above, together with the inputs it was built from.  Kept
+// across turns so that map::build_sunlight_cache can skip the levels where nothing changed.
+struct sunlight_lightmap {
+    cata::mdarray<four_quadrants, point_bub_ms> lm;
+    cata::mdarray<float, point_bub_ms> transparency_cache;
+    cata::mdarray<bool, point_bub_ms> outside_cache;
+    cata::mdarray<bool, point_bub_ms> floor_cache;
+    float outside_light_level = 0.0f;
+    float sight_penalty = 0.0f;
+    // Whether light reached this level unblocked
+    bool fully_outside = false;
+    // The state handed on to the level below
+    bool fully_outside_below = false;
+    bool fully_inside_below = false;
+};
+
 struct level_cache {
     public:
         // Zeros all relevant values
@@ -23,6 +65,8 @@ struct level_cache {
         level_cache( const level_cache &other ) = default;
 
         std::bitset<MAPSIZE *MAPSIZE> transparency_cache_dirty;
+        // Tiles whose ability to support things was removed in the last turn
+        std::bitset<MAPSIZE_X *MAPSIZE_Y> support_cache_dirty;
         bool outside_cache_dirty = false;
         bool floor_cache_dirty = false;
         bool seen_cache_dirty = false;
@@ -34,6 +78,13 @@ struct level_cache {
         // To prevent redundant ray casting into neighbors: precalculate bulk light source positions.
         // This is only valid for the duration of generate_lightmap
         cata::mdarray<float, point_bub_ms> light_source_buffer;
+        // Same for directional lights.
+        std::vector<light_arc> light_arcs;
+        // Lazily allocated by the first generate_lightmap on this level, reset by
+        // map::invalidate_map_cache.
+        cata::value_ptr<source_lightmap> source_lights;
+        // Lazily allocated by map::build_sunlight_cache, reset by map::invalidate_map_cache.
+        cata::value_ptr<sunlight_lightmap> sunlight;
 
         // Cache of natural light level is useful if it needs to be in sync with the light cache.
         float natural_light_level_cache;
@@ -58,6 +109,11 @@ struct level_cache {
         // true, if tile is not opaque
         std::array<std::bitset<MAPSIZE_Y>, MAPSIZE_X> transparent_cache_wo_fields;
 
+        // materialized  (transparency_cache[i][j] > LIGHT_TRANSPARENCY_SOLID), fields included
+        // line of sight checks only need this, and it is 32 times smaller than the floats
+        // true, if tile is not opaque
+        std::array<std::bitset<MAPSIZE_Y>, MAPSIZE_X> transparent_cache;
+
         // stores "adjusted transparency" of the tiles
         // initial values derived from transparency_cache, uses same units
         // examples of adjustment: changed transparency on player's tile and special case for crouching
@@ -95,6 +151,6 @@ struct level_cache {
         // since the most recent call to clear_vehicle_cache()
         bool veh_cache_cleared = true;
         std::bitset<MAPSIZE_X *MAPSIZE_Y> veh_exists_at;
-        std::unordered_map<tripoint, std::pair<vehicle *, int>> veh_cached_parts;
+        cata::tripoint_map<std::pair<vehicle *, int>> veh_cached_parts;
 };
 #endif // CATA_SRC_LEVEL_CACHE_H
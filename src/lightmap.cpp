@@ -35,6 +35,7 @@
 #include "mtype.h"
 #include "npc.h"
 #include "point.h"
+#include "profile_zones.h"
 #include "string_formatter.h"
 #include "submap.h"
 #include "tileray.h"
@@ -75,7 +76,8 @@ void map::add_light_from_items( const tripoint &p, const item_stack &items )
         units::angle idir = 0_degrees;   // otherwise, it's a light_arc pointed in this direction
         if( it.getlight( ilum, iwidth, idir ) ) {
             if( iwidth > 0_degrees ) {
-                apply_light_arc( p, idir, ilum, iwidth );
+                // Queued like vehicle lights, so an unchanged arc isn't recast every turn
+                add_light_arc( p, idir, ilum, iwidth );
             } else {
                 add_light_source( p, ilum );
             }
@@ -88,6 +90,7 @@ bool map::build_transparency_cache( const int zlev )
 {
     level_cache &map_cache = get_cache( zlev );
     auto &transparent_cache_wo_fields = map_cache.transparent_cache_wo_fields;
+    auto &transparent_cache = map_cache.transparent_cache;
     auto &transparency_cache = map_cache.transparency_cache;
     auto &outside_cache = map_cache.outside_cache;
 
@@ -100,11 +103,13 @@ bool map::build_transparency_cache( const int zlev )
 
     if( rebuild_all ) {
         // Default to just barely not transparent.
-        std::uninitialized_fill_n( &transparency_cache[0][0], MAPSIZE_X * MAPSIZE_Y,
-                                   static_cast<float>( LIGHT_TRANSPARENCY_OPEN_AIR ) );
+        transparency_cache.fill( static_cast<float>( LIGHT_TRANSPARENCY_OPEN_AIR ) );
         for( auto &row : transparent_cache_wo_fields ) {
             row.set(); // true means transparent
         }
+        for( auto &row : transparent_cache ) {
+            row.set();
+        }
     }
 
     const float sight_penalty = get_weather().weather_id->sight_penalty;
@@ -164,11 +169,13 @@ bool map::build_transparency_cache( const int zlev )
                     for( int sx = 0; sx < SEEX; ++sx ) {
                         // init all sy indices in one go
                         std::uninitialized_fill_n( &transparency_cache[sm_offset.x + sx][sm_offset.y], SEEY, value );
-                        if( opaque ) {
-                            auto &bs = transparent_cache_wo_fields[sm_offset.x + sx];
-                            for( int i = 0; i < SEEY; i++ ) {
-                                bs[sm_offset.y + i] = false;
-                            }
+                        auto &transparent = transparent_cache[sm_offset.x + sx];
+                        for( int i = 0; i < SEEY; i++ ) {
+                            transparent[sm_offset.y + i] = !opaque;
+                        }
+                        auto &bs = transparent_cache_wo_fields[sm_offset.x + sx];
+                        for( int i = 0; i < SEEY; i++ ) {
+                            bs[sm_offset.y + i] = !opaque;
                         }
                     }
                 }
@@ -179,6 +186,7 @@ bool map::build_transparency_cache( const int zlev )
                         const int y = sy + sm_offset.y;
                         float transp_wo_fields;
                         std::tie( transparency_cache[x][y], transp_wo_fields ) = calc_transp( {x, y } );
+                        transparent_cache[x][y] = transparency_cache[x][y] > LIGHT_TRANSPARENCY_SOLID;
                         transparent_cache_wo_fields[x][y] = transp_wo_fields > LIGHT_TRANSPARENCY_SOLID;
                     }
                 }
@@ -195,7 +203,7 @@ bool map::build_vision_transparency_cache( const int zlev )
     auto &transparency_cache = map_cache.transparency_cache;
     auto &vision_transparency_cache = map_cache.vision_transparency_cache;
 
-    memcpy( &vision_transparency_cache, &transparency_cache, sizeof( transparency_cache ) );
+    vision_transparency_cache.copy_from( transparency_cache );
 
     Character &player_character = get_player_character();
     const tripoint p = player_character.pos();
@@ -265,6 +273,10 @@ void map::build_sunlight_cache( int pzlev )
     //    ↓
     // when fully below ground: fully_outside=false, fully_inside=true  (fast fill)
 
+    // Levels below one that had to be rebuilt read its new light, so they are rebuilt too.
+    bool above_reused = true;
+    const float sight_penalty = get_weather().weather_id->sight_penalty;
+
     // Iterate top to bottom because sunlight cache needs to construct in that order.
     for( int zlev = zlev_max; zlev >= zlev_min; zlev-- ) {
 
@@ -279,15 +291,48 @@ void map::build_sunlight_cache( int pzlev )
 
         // all light was blocked before
         if( fully_inside ) {
-            std::fill_n( &lm[0][0], MAPSIZE_X * MAPSIZE_Y, four_quadrants( inside_light_level ) );
+            lm.fill( four_quadrants( inside_light_level ) );
             continue;
         }
 
+        // Sunlight only changes with the time of day, the weather and the level's caches, so
+        // most turns it can be copied from the last build.
+        cata::value_ptr<sunlight_lightmap> &sunlight = map_cache.sunlight;
+        const auto same_cache = []( const auto & lhs, const auto & rhs ) {
+            return std::memcmp( &lhs, &rhs, sizeof( lhs ) ) == 0;
+        };
+        if( above_reused && sunlight && sunlight->fully_outside == fully_outside &&
+            sunlight->outside_light_level == outside_light_level &&
+            sunlight->sight_penalty == sight_penalty &&
+            same_cache( sunlight->transparency_cache, map_cache.transparency_cache ) &&
+            same_cache( sunlight->floor_cache, map_cache.floor_cache ) &&
+            same_cache( sunlight->outside_cache, map_cache.outside_cache ) ) {
+            lm = sunlight->lm;
+            fully_outside = sunlight->fully_outside_below;
+            fully_inside = sunlight->fully_inside_below;
+            continue;
+        }
+        above_reused = false;
+        if( !sunlight ) {
+            sunlight = cata::make_value<sunlight_lightmap>();
+        }
+        sunlight->transparency_cache = map_cache.transparency_cache;
+        sunlight->floor_cache = map_cache.floor_cache;
+        sunlight->outside_cache = map_cache.outside_cache;
+        sunlight->outside_light_level = outside_light_level;
+        sunlight->sight_penalty = sight_penalty;
+        sunlight->fully_outside = fully_outside;
+        const auto remember_result = [&]() {
+            sunlight->lm = lm;
+            sunlight->fully_outside_below = fully_outside;
+            sunlight->fully_inside_below = fully_inside;
+        };
+
         // If there were no obstacles before this level, just apply weather illumination since there's no opportunity
         // for light to be blocked.
         if( fully_outside ) {
             //fill with full light
-            std::fill_n( &lm[0][0], MAPSIZE_X * MAPSIZE_Y, four_quadrants( outside_light_level ) );
+            lm.fill( four_quadrants( outside_light_level ) );
 
             const auto &this_floor_cache = map_cache.floor_cache;
             const auto &this_transparency_cache = map_cache.transparency_cache;
@@ -305,6 +350,7 @@ void map::build_sunlight_cache( int pzlev )
                                                      this_floor_cache[x][y] );
                 }
             }
+            remember_result();
             continue;
         }
 
@@ -317,7 +363,6 @@ void map::build_sunlight_cache( int pzlev )
         const auto &prev_transparency_cache = prev_map_cache.transparency_cache;
         const auto &prev_floor_cache = prev_map_cache.floor_cache;
         const auto &outside_cache = map_cache.outside_cache;
-        const float sight_penalty = get_weather().weather_id->sight_penalty;
         // TODO: Replace these with a lookup inside the four_quadrants class.
         constexpr std::array<point, 5> cardinals = {
             {point_zero, point_north, point_west, point_east, point_south}
@@ -334,7 +379,7 @@ void map::build_sunlight_cache( int pzlev )
         fully_inside = true; // recalculate
 
         // Fall back to minimal light level if we don't find anything.
-        std::fill_n( &lm[0][0], MAPSIZE_X * MAPSIZE_Y, four_quadrants( inside_light_level ) );
+        lm.fill( four_quadrants( inside_light_level ) );
 
         for( int x = 0; x < MAPSIZE_X; ++x ) {
             for( int y = 0; y < MAPSIZE_Y; ++y ) {
@@ -375,11 +420,13 @@ void map::build_sunlight_cache( int pzlev )
                 }
             }
         }
+        remember_result();
     }
 }
 
 void map::generate_lightmap( const int zlev )
 {
+    CATA_PROFILE_ZONE( profile_zones::zone::generate_lightmap );
     level_cache &map_cache = get_cache( zlev );
     auto &lm = map_cache.lm;
     auto &sm = map_cache.sm;
@@ -534,15 +581,15 @@ void map::generate_lightmap( const int zlev )
             if( vp.has_flag( VPFLAG_CONE_LIGHT ) ) {
                 if( veh_luminance > lit_level::LIT ) {
                     add_light_source( src, M_SQRT2 ); // Add a little surrounding light
-                    apply_light_arc( src, v->face.dir() + pt->direction, veh_luminance,
-                                     45_degrees );
+                    add_light_arc( src, v->face.dir() + pt->direction, veh_luminance,
+                                   45_degrees );
                 }
 
             } else if( vp.has_flag( VPFLAG_WIDE_CONE_LIGHT ) ) {
                 if( veh_luminance > lit_level::LIT ) {
                     add_light_source( src, M_SQRT2 ); // Add a little surrounding light
-                    apply_light_arc( src, v->face.dir() + pt->direction, veh_luminance,
-                                     90_degrees );
+                    add_light_arc( src, v->face.dir() + pt->direction, veh_luminance,
+                                   90_degrees );
                 }
 
             } else if( vp.has_flag( VPFLAG_HALF_CIRCLE_LIGHT ) ) {
@@ -553,10 +600,10 @@ void map::generate_lightmap( const int zlev )
                     offset.x = src.x + tdir.dx();
                     offset.y = src.y + tdir.dy();
                     add_light_source( offset, M_SQRT2 ); // Add a little surrounding light
-                    apply_light_arc( offset, v->face.dir() + pt->direction, vp.bonus, 180_degrees );
+                    add_light_arc( offset, v->face.dir() + pt->direction, vp.bonus, 180_degrees );
                 } else {
                     add_light_source( src, M_SQRT2 ); // Add a little surrounding light
-                    apply_light_arc( src, v->face.dir() + pt->direction, vp.bonus, 180_degrees );
+                    add_light_arc( src, v->face.dir() + pt->direction, vp.bonus, 180_degrees );
                 }
 
             } else if( vp.has_flag( VPFLAG_CIRCLE_LIGHT ) ) {
@@ -586,14 +633,29 @@ void map::generate_lightmap( const int zlev )
       This may seem like extra work, but take a 12x12 raging inferno:
         unbuffered: (12^2)*(160*4) = apply_light_ray x 92160
         buffered:   (12*4)*(160)   = apply_light_ray x 7680
+      They are cast into a separate layer that persists between turns, and only the parts of it
+      near sources that changed since the last call are recast.  All light is combined with max,
+      so merging the layer afterwards gives the same result as casting everything in place.
     */
-    const tripoint cache_start( 0, 0, zlev );
-    const tripoint cache_end( LIGHTMAP_CACHE_X, LIGHTMAP_CACHE_Y, zlev );
-    for( const tripoint &p : points_in_rectangle( cache_start, cache_end ) ) {
-        if( light_source_buffer[p.x][p.y] > 0.0 ) {
-            apply_light_source( p, light_source_buffer[p.x][p.y] );
+    update_source_lightmap( zlev );
+    const source_lightmap &sources = *map_cache.source_lights;
+    for( int x = 0; x < LIGHTMAP_CACHE_X; ++x ) {
+        for( int y = 0; y < LIGHTMAP_CACHE_Y; ++y ) {
+            lm[x][y] = elementwise_max( lm[x][y], sources.lm[x][y] );
+            sm[x][y] = std::max( sm[x][y], sources.sm[x][y] );
         }
     }
+    // Arcs queued on other levels (e.g. by vehicles) don't get a persistent layer.
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; ++z ) {
+        level_cache *other_cache = get_cache_lazy( z );
+        if( z == zlev || other_cache == nullptr ) {
+            continue;
+        }
+        for( const light_arc &arc : other_cache->light_arcs ) {
+            apply_light_arc( tripoint( arc.pos, z ), arc.angle, arc.luminance, arc.width );
+        }
+        other_cache->light_arcs.clear();
+    }
     for( const std::pair<tripoint, float> &elem : lm_override ) {
         lm[elem.first.x][elem.first.y].fill( elem.second );
     }
@@ -643,7 +705,7 @@ float map::ambient_light_at( const tripoint &p ) const
 
 bool map::is_transparent( const tripoint &p ) const
 {
-    return light_transparency( p ) > LIGHT_TRANSPARENCY_SOLID;
+    return get_cache_ref( p.z ).transparent_cache[p.x][p.y];
 }
 
 bool map::is_transparent_wo_fields( const tripoint &p ) const
@@ -867,6 +929,7 @@ void castLight( cata::mdarray<Out, point_bub_ms> &output_cache,
         delta.y = -distance;
         bool started_row = false;
         T current_transparency( 0.0 );
+        row_intensity_cache<T, calc> row_intensity( numerator, cumulative_transparency );
         float away = start - ( -distance + 0.5f ) / ( -distance -
                      0.5f ); //The distance between our first leadingEdge and start
 
@@ -890,7 +953,7 @@ void castLight( cata::mdarray<Out, point_bub_ms> &output_cache,
             }
 
             const int dist = rl_dist( tripoint_zero, delta ) + offsetDistance;
-            last_intensity = calc( numerator, cumulative_transparency, dist );
+            last_intensity = row_intensity( dist );
 
             T new_transparency = input_array[ current.x ][ current.y ];
 
@@ -1002,10 +1065,8 @@ void map::build_seen_cache( const tripoint &origin, const int target_z, int exte
     mdarray &out_cache = camera ? camera_cache : seen_cache;
 
     constexpr float light_transparency_solid = LIGHT_TRANSPARENCY_SOLID;
-    constexpr int map_dimensions = MAPSIZE_X * MAPSIZE_Y;
     if( !cumulative ) {
-        std::uninitialized_fill_n(
-            &camera_cache[0][0], map_dimensions, light_transparency_solid );
+        camera_cache.fill( light_transparency_solid );
     }
 
     // Cache the caches (pointers to them)
@@ -1019,8 +1080,7 @@ void map::build_seen_cache( const tripoint &origin, const int target_z, int exte
         seen_caches[z + OVERMAP_DEPTH] = camera ? &cur_cache.camera_cache : &cur_cache.seen_cache;
         floor_caches[z + OVERMAP_DEPTH] = &cur_cache.floor_cache;
         if( !cumulative ) {
-            std::uninitialized_fill_n(
-                &( *seen_caches[z + OVERMAP_DEPTH] )[0][0], map_dimensions, light_transparency_solid );
+            seen_caches[z + OVERMAP_DEPTH]->fill( light_transparency_solid );
         }
         cur_cache.seen_cache_dirty = false;
         if( origin.z == z && cur_cache.no_floor_gaps ) {
@@ -1167,19 +1227,20 @@ static bool light_check( const float &transparency, const float &intensity )
     return transparency > LIGHT_TRANSPARENCY_SOLID && intensity > LIGHT_AMBIENT_LOW;
 }
 
-void map::apply_light_source( const tripoint &p, float luminance )
+// Upper bound on how many rows from its origin a cast of this luminance can light before
+// light_check stops it.
+static int light_reach( const float luminance )
 {
-    level_cache &cache = get_cache( p.z );
-    cata::mdarray<four_quadrants, point_bub_ms> &lm = cache.lm;
-    cata::mdarray<float, point_bub_ms> &sm = cache.sm;
-    cata::mdarray<float, point_bub_ms> &transparency_cache =
-        cache.transparency_cache;
-    cata::mdarray<float, point_bub_ms> &light_source_buffer =
-        cache.light_source_buffer;
-
-    const point p2( p.xy() );
+    return std::min( 60, static_cast<int>( std::ceil( luminance / LIGHT_AMBIENT_LOW ) ) + 1 );
+}
 
-    if( inbounds( p ) ) {
+static void cast_light_source( cata::mdarray<four_quadrants, point_bub_ms> &lm,
+                               cata::mdarray<float, point_bub_ms> &sm,
+                               const cata::mdarray<float, point_bub_ms> &transparency_cache,
+                               const cata::mdarray<float, point_bub_ms> &light_source_buffer,
+                               const point &p2, const bool p_inbounds, float luminance )
+{
+    if( p_inbounds ) {
         const float min_light = std::max( static_cast<float>( lit_level::LOW ), luminance );
         lm[p2.x][p2.y] = elementwise_max( lm[p2.x][p2.y], min_light );
         sm[p2.x][p2.y] = std::max( sm[p2.x][p2.y], luminance );
@@ -1249,6 +1310,13 @@ void map::apply_light_source( const tripoint &p, float luminance )
     }
 }
 
+void map::apply_light_source( const tripoint &p, float luminance )
+{
+    level_cache &cache = get_cache( p.z );
+    cast_light_source( cache.lm, cache.sm, cache.transparency_cache, cache.light_source_buffer,
+                       p.xy(), inbounds( p ), luminance );
+}
+
 void map::apply_directional_light( const tripoint &p, int direction, float luminance )
 {
     const point p2( p.xy() );
@@ -1289,21 +1357,19 @@ void map::apply_directional_light( const tripoint &p, int direction, float lumin
     }
 }
 
-void map::apply_light_arc( const tripoint &p, const units::angle &angle, float luminance,
-                           const units::angle &wideangle )
+static void cast_light_arc( cata::mdarray<four_quadrants, point_bub_ms> &lm,
+                            cata::mdarray<float, point_bub_ms> &sm,
+                            const cata::mdarray<float, point_bub_ms> &transparency_cache,
+                            const cata::mdarray<float, point_bub_ms> &light_source_buffer,
+                            const point &p2, const bool p_inbounds, const units::angle &angle, float luminance,
+                            const units::angle &wideangle )
 {
     if( luminance <= LIGHT_SOURCE_LOCAL ) {
         return;
     }
 
-    apply_light_source( p, LIGHT_SOURCE_LOCAL );
-
-    const point p2( p.xy() );
-
-    level_cache &cache = get_cache( p.z );
-    cata::mdarray<four_quadrants, point_bub_ms> &lm = cache.lm;
-    cata::mdarray<float, point_bub_ms> &transparency_cache =
-        cache.transparency_cache;
+    cast_light_source( lm, sm, transparency_cache, light_source_buffer, p2, p_inbounds,
+                       LIGHT_SOURCE_LOCAL );
 
     // Normalize (should work with negative values too)
     units::angle wangle = wideangle / 2.0;
@@ -1455,6 +1521,138 @@ void map::apply_light_arc( const tripoint &p, const units::angle &angle, float l
     }
 }
 
+void map::apply_light_arc( const tripoint &p, const units::angle &angle, float luminance,
+                           const units::angle &wideangle )
+{
+    level_cache &cache = get_cache( p.z );
+    cast_light_arc( cache.lm, cache.sm, cache.transparency_cache, cache.light_source_buffer,
+                    p.xy(), inbounds( p ), angle, luminance, wideangle );
+}
+
+void map::add_light_arc( const tripoint &p, const units::angle &angle, float luminance,
+                         const units::angle &wideangle )
+{
+    if( luminance > LIGHT_SOURCE_LOCAL ) {
+        get_cache( p.z ).light_arcs.push_back( { p.xy(), angle, luminance, wideangle } );
+    }
+}
+
+static constexpr std::array<point, 5> source_and_neighbours = {{
+        point_zero, point_north, point_east, point_south, point_west
+    }
+};
+
+void map::update_source_lightmap( const int zlev )
+{
+    level_cache &map_cache = get_cache( zlev );
+    const auto &light_source_buffer = map_cache.light_source_buffer;
+    const auto &transparency_cache = map_cache.transparency_cache;
+    std::vector<light_arc> &light_arcs = map_cache.light_arcs;
+    std::sort( light_arcs.begin(), light_arcs.end() );
+
+    cata::value_ptr<source_lightmap> &sources_ptr = map_cache.source_lights;
+    const bool rebuild_all = !sources_ptr ||
+                             std::memcmp( &sources_ptr->transparency_cache, &transparency_cache,
+                                          sizeof( transparency_cache ) ) != 0;
+    if( !sources_ptr ) {
+        sources_ptr = cata::make_value<source_lightmap>();
+    }
+    source_lightmap &sources = *sources_ptr;
+    const auto &prev_buffer = sources.light_source_buffer;
+
+    // Submaps whose light has to be recast
+    std::bitset<MAPSIZE *MAPSIZE> dirty;
+    if( rebuild_all ) {
+        dirty.set();
+    } else {
+        const auto mark_dirty = [&dirty]( const point & p, const int reach ) {
+            const point min_sm = ms_to_sm_copy( point( std::max( p.x - reach, 0 ), std::max( p.y - reach, 0 ) ) );
+            const point max_sm = ms_to_sm_copy( point( std::min( p.x + reach, LIGHTMAP_CACHE_X - 1 ),
+                                                std::min( p.y + reach, LIGHTMAP_CACHE_Y - 1 ) ) );
+            for( int smx = min_sm.x; smx <= max_sm.x; ++smx ) {
+                for( int smy = min_sm.y; smy <= max_sm.y; ++smy ) {
+                    dirty.set( smx * MAPSIZE + smy );
+                }
+            }
+        };
+        for( int x = 0; x < LIGHTMAP_CACHE_X; ++x ) {
+            for( int y = 0; y < LIGHTMAP_CACHE_Y; ++y ) {
+                if( light_source_buffer[x][y] == prev_buffer[x][y] ) {
+                    continue;
+                }
+                // Which directions a source casts into depends on its neighbours in the buffer,
+                // so they have to be recast as well.
+                for( const point &d : source_and_neighbours ) {
+                    const point q = point( x, y ) + d;
+                    if( lightmap_boundaries.contains( q ) ) {
+                        const float old_lum = prev_buffer[q.x][q.y];
+                        const float new_lum = light_source_buffer[q.x][q.y];
+                        if( old_lum > 0.0f || new_lum > 0.0f ) {
+                            mark_dirty( q, light_reach( std::max( old_lum, new_lum ) ) );
+                        }
+                    }
+                }
+            }
+        }
+        std::vector<light_arc> changed_arcs;
+        std::set_symmetric_difference( light_arcs.begin(), light_arcs.end(),
+                                       sources.light_arcs.begin(), sources.light_arcs.end(),
+                                       std::back_inserter( changed_arcs ) );
+        for( const light_arc &arc : changed_arcs ) {
+            mark_dirty( arc.pos, light_reach( arc.luminance ) );
+        }
+    }
+
+    if( dirty.any() ) {
+        const auto touches_dirty = [&dirty]( const point & p, const int reach ) {
+            const point min_sm = ms_to_sm_copy( point( std::max( p.x - reach, 0 ), std::max( p.y - reach, 0 ) ) );
+            const point max_sm = ms_to_sm_copy( point( std::min( p.x + reach, LIGHTMAP_CACHE_X - 1 ),
+                                                std::min( p.y + reach, LIGHTMAP_CACHE_Y - 1 ) ) );
+            for( int smx = min_sm.x; smx <= max_sm.x; ++smx ) {
+                for( int smy = min_sm.y; smy <= max_sm.y; ++smy ) {
+                    if( dirty[smx * MAPSIZE + smy] ) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        };
+        for( int smx = 0; smx < MAPSIZE; ++smx ) {
+            for( int smy = 0; smy < MAPSIZE; ++smy ) {
+                if( !dirty[smx * MAPSIZE + smy] ) {
+                    continue;
+                }
+                for( int sx = smx * SEEX; sx < ( smx + 1 ) * SEEX; ++sx ) {
+                    std::fill_n( &sources.lm[sx][smy * SEEY], SEEY, four_quadrants( 0.0f ) );
+                    std::fill_n( &sources.sm[sx][smy * SEEY], SEEY, 0.0f );
+                }
+            }
+        }
+        // Every cast only ever raises values, so recasting an unchanged source that reaches
+        // outside the dirty submaps writes the same values it wrote the last time.
+        for( int x = 0; x < LIGHTMAP_CACHE_X; ++x ) {
+            for( int y = 0; y < LIGHTMAP_CACHE_Y; ++y ) {
+                const float luminance = light_source_buffer[x][y];
+                if( luminance > 0.0f && touches_dirty( point( x, y ), light_reach( luminance ) ) ) {
+                    cast_light_source( sources.lm, sources.sm, transparency_cache, light_source_buffer,
+                                       point( x, y ), true, luminance );
+                }
+            }
+        }
+        for( const light_arc &arc : light_arcs ) {
+            if( touches_dirty( arc.pos, light_reach( arc.luminance ) ) ) {
+                cast_light_arc( sources.lm, sources.sm, transparency_cache, light_source_buffer,
+                                arc.pos, lightmap_boundaries.contains( arc.pos ), arc.angle, arc.luminance,
+                                arc.width );
+            }
+        }
+        sources.light_source_buffer = light_source_buffer;
+        sources.transparency_cache = transparency_cache;
+        sources.light_arcs = light_arcs;
+    }
+    light_arcs.clear();
+}
+
 void map::apply_light_ray(
     cata::mdarray<bool, point_bub_ms, LIGHTMAP_CACHE_X, LIGHTMAP_CACHE_Y> &lit,
     const tripoint &s, const tripoint &e, float luminance )
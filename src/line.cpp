@@ -4,6 +4,7 @@
 #include <array>
 #include <cstdlib>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 
 #include "cata_assert.h"
@@ -256,6 +257,23 @@ std::vector <tripoint> line_to( const tripoint &loc1, const tripoint &loc2, int
     return line;
 }
 
+const std::vector<point> &line_offsets( const point &d, const int t )
+{
+    // Rays within sight range are a few thousand at most, this only guards against
+    // unbounded growth from odd callers
+    static constexpr size_t max_lines = 1 << 15;
+    thread_local std::unordered_map<tripoint, std::vector<point>> lines;
+    const tripoint key( d, t );
+    const auto found = lines.find( key );
+    if( found != lines.end() ) {
+        return found->second;
+    }
+    if( lines.size() >= max_lines ) {
+        lines.clear();
+    }
+    return lines.emplace( key, line_to( point_zero, d, t ) ).first->second;
+}
+
 float rl_dist_exact( const tripoint &loc1, const tripoint &loc2 )
 {
     if( trigdist ) {
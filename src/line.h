@@ -152,6 +152,12 @@ tripoint move_along_line( const tripoint &loc, const std::vector<tripoint> &line
 std::vector<point> line_to( const point &p1, const point &p2, int t = 0 );
 // t and t2 decide which Bresenham line is used.
 std::vector<tripoint> line_to( const tripoint &loc1, const tripoint &loc2, int t = 0, int t2 = 0 );
+/**
+ * Same as line_to( point_zero, d, t ), from a table kept by each thread. A line only depends
+ * on the offset between its ends, so callers add their start point to each entry instead of
+ * building a new vector. The reference is valid until the next call on the same thread.
+ */
+const std::vector<point> &line_offsets( const point &d, int t = 0 );
 // sqrt(dX^2 + dY^2)
 
 inline float trig_dist( const tripoint &loc1, const tripoint &loc2 )
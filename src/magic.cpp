@@ -3027,6 +3027,11 @@ spell fake_spell::get_spell() const
     return sp;
 }
 
+bool spell_events::is_interested_in( event_type type )
+{
+    return type == event_type::player_levels_spell;
+}
+
 void spell_events::notify( const cata::event &e )
 {
     switch( e.type() ) {
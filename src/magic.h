@@ -192,6 +192,7 @@ class spell_events : public event_subscriber
     public:
         using event_subscriber::notify;
         void notify( const cata::event & ) override;
+        bool is_interested_in( event_type ) override;
 };
 
 class spell_type
@@ -251,6 +251,20 @@ bool enchantment::is_active( const Character &guy, const bool active ) const
     return false;
 }
 
+bool enchantment::depends_on_state() const
+{
+    if( active_conditions.second != condition::ALWAYS ) {
+        return true;
+    }
+    const auto not_constant = []( const auto &entry ) {
+        return !entry.second.is_constant();
+    };
+    return std::any_of( values_add.begin(), values_add.end(), not_constant ) ||
+           std::any_of( values_multiply.begin(), values_multiply.end(), not_constant ) ||
+           std::any_of( skill_values_add.begin(), skill_values_add.end(), not_constant ) ||
+           std::any_of( skill_values_multiply.begin(), skill_values_multiply.end(), not_constant );
+}
+
 bool enchantment::active_wield() const
 {
     return active_conditions.first == has::HELD || active_conditions.first == has::WIELD;
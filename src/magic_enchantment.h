@@ -172,6 +172,9 @@ class enchantment
         // this enchantment is active when wielded.
         // shows total conditional values, so only use this when Character is not available
         bool active_wield() const;
+        // whether being active or its values can change without its source being gained or
+        // lost: activation, dialog conditions or values read from variables
+        bool depends_on_state() const;
         enchantment_id id;
         // NOLINTNEXTLINE(cata-serialize)
         std::vector<std::pair<enchantment_id, mod_id>> src;
@@ -3,6 +3,7 @@
 #include <climits>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <iosfwd>
 #include <iterator>
@@ -203,8 +204,40 @@ void spell_effect::pain_split( const spell &sp, Creature &caster, const tripoint
     you->set_all_parts_hp_cur( hp_each );
 }
 
+namespace
+{
+// Passability of the square of tiles around a spell's origin. Area spells trace a line to every
+// tile they might reach, so most tiles are crossed by many lines; each is only looked up once.
+class spell_passable_cache
+{
+    public:
+        spell_passable_cache( const tripoint &center, int radius ) : center( center ),
+            radius( std::max( radius, 0 ) ), side( 2 * this->radius + 1 ),
+            known( static_cast<size_t>( side ) * side, unknown ) {}
+
+        bool passable( const tripoint &p ) {
+            const point d = ( p - center ).xy();
+            if( p.z != center.z || std::abs( d.x ) > radius || std::abs( d.y ) > radius ) {
+                return get_map().passable( p );
+            }
+            int8_t &state = known[( d.y + radius ) * side + d.x + radius];
+            if( state == unknown ) {
+                state = get_map().passable( p ) ? 1 : 0;
+            }
+            return state == 1;
+        }
+
+    private:
+        static constexpr int8_t unknown = -1;
+        tripoint center;
+        int radius;
+        int side;
+        std::vector<int8_t> known;
+};
+} // namespace
+
 static bool in_spell_aoe( const tripoint &start, const tripoint &end, const int &radius,
-                          const bool ignore_walls )
+                          const bool ignore_walls, spell_passable_cache &passable )
 {
     if( rl_dist( start, end ) > radius ) {
         return false;
@@ -212,10 +245,9 @@ static bool in_spell_aoe( const tripoint &start, const tripoint &end, const int
     if( ignore_walls ) {
         return true;
     }
-    map &here = get_map();
     const std::vector<tripoint> trajectory = line_to( start, end );
     for( const tripoint &pt : trajectory ) {
-        if( here.impassable( pt ) ) {
+        if( !passable.passable( pt ) ) {
             return false;
         }
     }
@@ -227,9 +259,11 @@ std::set<tripoint> spell_effect::spell_effect_blast( const override_parameters &
         const tripoint &target )
 {
     std::set<tripoint> targets;
+    spell_passable_cache passable( target, params.aoe_radius );
     // TODO: Make this breadth-first
     for( const tripoint &potential_target : get_map().points_in_radius( target, params.aoe_radius ) ) {
-        if( in_spell_aoe( target, potential_target, params.aoe_radius, params.ignore_walls ) ) {
+        if( in_spell_aoe( target, potential_target, params.aoe_radius, params.ignore_walls,
+                          passable ) ) {
             targets.emplace( potential_target );
         }
     }
@@ -258,11 +292,11 @@ static std::set<tripoint> spell_effect_cone_range_override( const spell_effect::
         }
     }
     if( !params.ignore_walls ) {
-        map &here = get_map();
+        spell_passable_cache passable( source, params.range );
         for( const tripoint &ep : end_points ) {
             std::vector<tripoint> trajectory = line_to( source, ep );
             for( const tripoint &tp : trajectory ) {
-                if( here.passable( tp ) ) {
+                if( passable.passable( tp ) ) {
                     targets.emplace( tp );
                 } else {
                     break;
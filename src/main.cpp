@@ -3,6 +3,7 @@
 
 // IWYU pragma: no_include <sys/signal.h>
 #include <algorithm>
+#include <chrono>
 #include <array>
 #include <clocale>
 #include <cstdio>
@@ -25,6 +26,7 @@
 
 #include <flatbuffers/util.h>
 
+#include "avatar.h"
 #include "cached_options.h"
 #include "cata_path.h"
 #include "color.h"
@@ -42,19 +44,24 @@
 #include "get_version.h"
 #include "help.h"
 #include "input.h"
+#include "input_replay.h"
 #include "loading_ui.h"
 #include "main_menu.h"
 #include "mapsharing.h"
+#include "memory_accounting.h"
 #include "memory_fast.h"
 #include "options.h"
 #include "ordered_static_globals.h"
 #include "output.h"
 #include "path_info.h"
+#include "profile_zones.h"
 #include "rng.h"
+#include "string_formatter.h"
 #include "system_locale.h"
 #include "translations.h"
 #include "type_id.h"
 #include "ui_manager.h"
+#include "worldfactory.h"
 #if defined(MACOSX) || defined(__CYGWIN__)
 #   include <unistd.h> // getpid()
 #endif
@@ -175,6 +182,55 @@ void exit_handler( int s )
     catacurses::doupdate();
 }
 
+/**
+ * Runs @p turns turns of the first save in @p world as fast as they go, for soak tests.
+ * Nothing is drawn and nobody plays: the avatar stands still while the world runs, and
+ * the save is left untouched. Prints the time per turn and the profile zone report, and
+ * the memory accounting report if @p memory_report is set.
+ */
+void run_headless( const std::string &world, int turns, bool memory_report )
+{
+    world_generator->set_active_world( nullptr );
+    world_generator->init();
+    const WORLD *const wld = world.empty() ? nullptr : world_generator->get_world( world );
+    if( wld == nullptr || wld->world_saves.empty() ) {
+        std::cerr << "Headless runs need --world naming a world with a save" << std::endl;
+        exit_handler( -999 );
+        return;
+    }
+    get_options().get_option( "AUTOSAVE" ).setValue( "false" );
+    main_menu menu;
+    if( !menu.load_game( world, wld->world_saves.front() ) ) {
+        std::cerr << "Could not load the save of world " << world << std::endl;
+        exit_handler( -999 );
+        return;
+    }
+
+    profile_zones::set_enabled( true );
+    profile_zones::reset();
+    avatar &u = get_avatar();
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int done = 0;
+    // Stop at the avatar's death rather than going through the game over screens
+    for( ; done < turns && !u.is_dead_state(); ++done ) {
+        // Without moves left do_turn skips asking for the avatar's action
+        u.set_moves( 0 );
+        if( do_turn() ) {
+            break;
+        }
+    }
+    const double ms = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() -
+                      start ).count();
+    if( turns > 0 ) {
+        std::cout << string_format( "Simulated %d turns in %.1f ms, %.3f ms/turn\n", done, ms,
+                                    done > 0 ? ms / done : 0.0 );
+        std::cout << profile_zones::report();
+    }
+    if( memory_report ) {
+        std::cout << memory_accounting::report();
+    }
+}
+
 struct arg_handler {
     //! Handler function to be invoked when this argument is encountered. The handler will be
     //! called with the number of parameters after the flag was encountered, along with the array
@@ -285,6 +341,10 @@ struct cli_opts {
     std::vector<std::string> opts;
     std::string world; /** if set try to load first save in this world on startup */
     bool disable_ascii_art = false;
+    std::string record_input; /** if set record player input to this file */
+    std::string replay_input; /** if set replay player input from this file */
+    int simulate_turns = 0; /** if set run this many turns of the --world save headless */
+    bool memory_report = false; /** if set print memory usage of the --world save and exit */
 };
 
 cli_opts parse_commandline( int argc, const char **argv )
@@ -307,6 +367,51 @@ cli_opts parse_commandline( int argc, const char **argv )
                     return 1;
                 }
             },
+            {
+                "--record-input", "<file>",
+                "Records the rng seed and all player input to <file>",
+                section_default,
+                1,
+                [&result]( int, const char **params ) -> int {
+                    result.record_input = params[0];
+                    return 1;
+                }
+            },
+            {
+                "--replay-input", "<file>",
+                "Replays input recorded with --record-input, then reports timings and exits",
+                section_default,
+                1,
+                [&result]( int, const char **params ) -> int {
+                    result.replay_input = params[0];
+                    return 1;
+                }
+            },
+            {
+                "--simulate-turns", "<turns>",
+                "Runs <turns> turns of the --world save without a window or input, then"
+                " prints timings and exits",
+                section_default,
+                1,
+                [&result]( int, const char **params ) -> int {
+                    result.simulate_turns = std::max( 1, atoi( params[0] ) );
+                    // No interface, same as the tests
+                    test_mode = true;
+                    return 1;
+                }
+            },
+            {
+                "--memory-report", {},
+                "Loads the --world save without a window, prints estimated memory usage and"
+                " exits; after --simulate-turns if given",
+                section_default,
+                0,
+                [&result]( int, const char ** ) -> int {
+                    result.memory_report = true;
+                    test_mode = true;
+                    return 0;
+                }
+            },
             {
                 "--jsonverify", {},
                 "Checks the CDDA json files",
@@ -767,13 +872,24 @@ int main( int argc, const char *argv[] )
             DebugLog( D_ERROR, DC_ALL ) << "Error while initializing the interface: " << err.what() << "\n";
             return 1;
         }
-    } else if( cli.check_mods ) {
+    } else if( cli.check_mods || cli.simulate_turns > 0 || cli.memory_report ) {
         get_options().init();
         get_options().load();
     }
 
     set_language_from_options();
 
+    if( !cli.replay_input.empty() ) {
+        if( !input_replay::start_replay( cli.replay_input ) ) {
+            std::cerr << "Could not read input recording " << cli.replay_input << std::endl;
+            return 1;
+        }
+        cli.seed = input_replay::seed();
+    } else if( !cli.record_input.empty() &&
+               !input_replay::start_recording( cli.record_input, cli.seed ) ) {
+        std::cerr << "Could not open " << cli.record_input << " for recording input" << std::endl;
+        return 1;
+    }
     rng_set_engine_seed( cli.seed );
 
     game_ui::init_ui();
@@ -804,6 +920,15 @@ int main( int argc, const char *argv[] )
         get_options().get_option( "ENABLE_ASCII_TITLE" ).setValue( "false" );
     }
 
+    if( cli.simulate_turns > 0 || cli.memory_report ) {
+        if( !assure_essential_dirs_exist() ) {
+            exit_handler( -999 );
+        }
+        init_colors();
+        run_headless( cli.world, cli.simulate_turns, cli.memory_report );
+        exit_handler( 0 );
+    }
+
     // Now we do the actual game.
 
 #if defined(DEBUG_CURSES_CURSOR)
@@ -40,6 +40,7 @@
 #include "options.h"
 #include "output.h"
 #include "overmapbuffer.h"
+#include "past_games_info.h"
 #include "path_info.h"
 #include "popup.h"
 #include "safemode_ui.h"
@@ -578,6 +579,8 @@ bool main_menu::opening_screen()
 
     world_generator->set_active_world( nullptr );
     world_generator->init();
+    // Achievement info is only needed once a game runs, don't make the menu wait for it
+    prefetch_past_games();
 
     init_strings();
 
@@ -18,6 +18,8 @@ class main_menu
         main_menu() : ctxt( "MAIN_MENU", keyboard_mode::keychar ) { }
         // Shows the main menu and returns whether a game was started or not
         bool opening_screen();
+        /** Loads @p savegame of world @p worldname, returns whether that worked. */
+        bool load_game( std::string const &worldname, save_t const &savegame );
 
         static std::string queued_world_to_load;
         static std::string queued_save_id_to_load;
@@ -56,7 +58,6 @@ class main_menu
 
         // Tab functions. They return whether a game was started or not. The ones that can never
         // start a game have a void return type.
-        bool load_game( std::string const &worldname, save_t const &savegame );
         bool new_character_tab();
         bool load_character_tab( const std::string &worldname );
         void world_tab( const std::string &worldname );
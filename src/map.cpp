@@ -11,6 +11,7 @@
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "active_item_cache.h"
@@ -22,6 +23,7 @@
 #include "cached_options.h"
 #include "calendar.h"
 #include "cata_assert.h"
+#include "cata_scope_helpers.h"
 #include "cata_type_traits.h"
 #include "character.h"
 #include "character_id.h"
@@ -66,6 +68,7 @@
 #include "mapbuffer.h"
 #include "mapdata.h"
 #include "mapgen.h"
+#include "mapgen_queue.h"
 #include "material.h"
 #include "math_defines.h"
 #include "mission.h"
@@ -78,6 +81,7 @@
 #include "overmapbuffer.h"
 #include "pathfinding.h"
 #include "pocket_type.h"
+#include "profile_zones.h"
 #include "projectile.h"
 #include "ranged.h"
 #include "relic.h"
@@ -103,6 +107,7 @@
 #include "vpart_range.h"
 #include "weather.h"
 #include "weighted_list.h"
+#include "worker_pool.h"
 
 #if defined(TILES)
 #include "cata_tiles.h" // all animation functions will be pushed out to a cata_tiles function in some manner
@@ -202,7 +207,8 @@ map::map( int mapsize, bool zlev ) : my_MAPSIZE( mapsize ), my_HALF_MAPSIZE( map
     }
 
     dbg( D_INFO ) << "map::map(): my_MAPSIZE: " << my_MAPSIZE << " z-levels enabled:" << zlevels;
-    traplocs.resize( trap::count() );
+    trap_index.resize( grid.size() );
+    trap_counts.resize( trap::count() );
 }
 
 map::~map()
@@ -222,6 +228,7 @@ static submap null_submap;
 void map::set_transparency_cache_dirty( const int zlev )
 {
     if( inbounds_z( zlev ) ) {
+        sight_memo::clear();
         get_cache( zlev ).transparency_cache_dirty.set();
     }
 }
@@ -229,6 +236,7 @@ void map::set_transparency_cache_dirty( const int zlev )
 void map::set_transparency_cache_dirty( const tripoint &p, bool field )
 {
     if( inbounds( p ) ) {
+        sight_memo::clear();
         const tripoint smp = ms_to_sm_copy( p );
         get_cache( smp.z ).transparency_cache_dirty.set( smp.x * MAPSIZE + smp.y );
         if( !field ) {
@@ -246,6 +254,7 @@ void map::set_seen_cache_dirty( const tripoint &change_location )
         }
         if( cache.seen_cache[change_location.x][change_location.y] != 0.0 ||
             cache.camera_cache[change_location.x][change_location.y] != 0.0 ) {
+            sight_memo::clear();
             cache.seen_cache_dirty = true;
         }
     }
@@ -255,6 +264,7 @@ void map::set_seen_cache_dirty( const int zlevel )
 {
     if( inbounds_z( zlevel ) ) {
         level_cache &cache = get_cache( zlevel );
+        sight_memo::clear();
         cache.seen_cache_dirty = true;
     }
 }
@@ -321,14 +331,20 @@ void map::memory_clear_vehicle_points( const vehicle &veh ) const
     }
 }
 
-void map::invalidate_map_cache( const int zlev )
+void map::invalidate_map_cache( const int zlev, const bool keep_transparency )
 {
     if( inbounds_z( zlev ) ) {
         level_cache &ch = get_cache( zlev );
         ch.floor_cache_dirty = true;
         ch.seen_cache_dirty = true;
         ch.outside_cache_dirty = true;
-        set_transparency_cache_dirty( zlev );
+        ch.source_lights.reset();
+        ch.sunlight.reset();
+        if( keep_transparency ) {
+            sight_memo::clear();
+        } else {
+            set_transparency_cache_dirty( zlev );
+        }
     }
 }
 
@@ -588,6 +604,7 @@ void map::on_vehicle_moved( const int smz )
 
 void map::vehmove()
 {
+    CATA_PROFILE_ZONE( profile_zones::zone::vehmove );
     // give vehicles movement points
     VehicleList vehicle_list;
     int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z();
@@ -1942,7 +1959,7 @@ uint8_t map::get_known_connections( const tripoint &p,
 #endif
 
     const bool overridden = override.find( p ) != override.end();
-    const bool is_transparent = ch.transparency_cache[p.x][p.y] > LIGHT_TRANSPARENCY_SOLID;
+    const bool is_transparent = ch.transparent_cache[p.x][p.y];
 
     // populate connection information
     for( int i = 0; i < 4; ++i ) {
@@ -2026,7 +2043,7 @@ uint8_t map::get_known_connections_f( const tripoint &p,
 #endif
 
     const bool overridden = override.find( p ) != override.end();
-    const bool is_transparent = ch.transparency_cache[p.x][p.y] > LIGHT_TRANSPARENCY_SOLID;
+    const bool is_transparent = ch.transparent_cache[p.x][p.y];
 
     // populate connection information
     for( int i = 0; i < 4; ++i ) {
@@ -2207,16 +2224,12 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain, bool avoid_crea
         }
     }
 
-    // HACK: Hack around ledges in traplocs or else it gets NASTY in z-level mode
+    // HACK: Hack around ledges in trap_index or else it gets NASTY in z-level mode
     if( old_t.trap != tr_null && old_t.trap != tr_ledge ) {
-        auto &traps = traplocs[old_t.trap.to_i()];
-        const auto iter = std::find( traps.begin(), traps.end(), p );
-        if( iter != traps.end() ) {
-            traps.erase( iter );
-        }
+        unindex_trap( p, old_t.trap );
     }
     if( new_t.trap != tr_null && new_t.trap != tr_ledge ) {
-        traplocs[new_t.trap.to_i()].push_back( p );
+        index_trap( p, new_t.trap );
     }
     if( !new_t.emissions.empty() ) {
         field_ter_locs.push_back( p );
@@ -2235,7 +2248,7 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain, bool avoid_crea
             ter_furn_flag::TFLAG_NO_FLOOR ) ) {
         set_floor_cache_dirty( p.z );
         // It's a set, not a flag
-        support_cache_dirty.insert( p );
+        support_dirty( p );
         set_seen_cache_dirty( p );
     }
 
@@ -2960,26 +2973,36 @@ void map::drop_fields( const tripoint &p )
 
 void map::support_dirty( const tripoint &p )
 {
-    if( zlevels ) {
-        support_cache_dirty.insert( p );
+    // Nothing can fall from outside the map, see has_floor_or_water
+    if( zlevels && inbounds( p ) ) {
+        get_cache( p.z ).support_cache_dirty.set( p.x + p.y * MAPSIZE_Y );
+        support_dirty_levels.set( p.z + OVERMAP_DEPTH );
     }
 }
 
 void map::process_falling()
 {
-    if( !zlevels ) {
-        support_cache_dirty.clear();
+    if( support_dirty_levels.none() ) {
         return;
     }
-
-    if( !support_cache_dirty.empty() ) {
-        add_msg_debug( debugmode::DF_MAP, "Checking %d tiles for falling objects",
-                       support_cache_dirty.size() );
-        // We want the cache to stay constant, but falling can change it
-        std::set<tripoint> last_cache = std::move( support_cache_dirty );
-        support_cache_dirty.clear();
-        for( const tripoint &p : last_cache ) {
-            drop_everything( p );
+    // We want the cache to stay constant, but falling can change it
+    const std::bitset<OVERMAP_LAYERS> dirty_levels = support_dirty_levels;
+    support_dirty_levels.reset();
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        if( !dirty_levels.test( z + OVERMAP_DEPTH ) ) {
+            continue;
+        }
+        std::bitset<MAPSIZE_X *MAPSIZE_Y> &level_dirty = get_cache( z ).support_cache_dirty;
+        const std::bitset<MAPSIZE_X *MAPSIZE_Y> dirty = level_dirty;
+        level_dirty.reset();
+        add_msg_debug( debugmode::DF_MAP, "Checking %d tiles for falling objects on z %d",
+                       dirty.count(), z );
+        for( int y = 0; y < MAPSIZE_Y; y++ ) {
+            for( int x = 0; x < MAPSIZE_X; x++ ) {
+                if( dirty.test( x + y * MAPSIZE_Y ) ) {
+                    drop_everything( tripoint( x, y, z ) );
+                }
+            }
         }
     }
 }
@@ -3409,7 +3432,8 @@ void map::decay_fields_and_scent( const time_duration &amount )
     // Coordinate code copied from lightmap calculations
     // TODO: Z
     const int smz = abs_sub.z();
-    const auto &outside_cache = get_cache_ref( smz ).outside_cache;
+    level_cache &ch = get_cache( smz );
+    const auto &outside_cache = ch.outside_cache;
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
             submap *cur_submap = get_submap_at_grid( { smx, smy, smz } );
@@ -3425,7 +3449,7 @@ void map::decay_fields_and_scent( const time_duration &amount )
                                    << ( abs_sub + point( smx, smy ) ).to_string()
                                    << "has " << to_proc << " field_count";
                 }
-                get_cache( smz ).field_cache.reset( smx + ( smy * MAPSIZE ) );
+                ch.field_cache.reset( smx + ( smy * MAPSIZE ) );
                 // This submap has no fields
                 continue;
             }
@@ -3437,10 +3461,14 @@ void map::decay_fields_and_scent( const time_duration &amount )
                 }
 
                 for( int sy = 0; sy < SEEY; ++sy ) {
+                    if( !cur_submap->may_have_field( { sx, sy } ) ) {
+                        continue;
+                    }
                     const point p( sx + smx * SEEX, sy + smy * SEEY );
 
                     const field &fields = cur_submap->get_field( { sx, sy} );
                     if( !outside_cache[p.x][p.y] ) {
+                        // Weather only reaches outdoor tiles
                         to_proc -= fields.field_count();
                         continue;
                     }
@@ -5526,10 +5554,34 @@ static void process_vehicle_items( vehicle &cur_veh, int part )
     }
 }
 
+// Never spread low priority items out so far that one goes more than an hour without processing.
+static constexpr int max_low_priority_item_stretch = 6;
+
 void map::process_items()
 {
+    CATA_PROFILE_ZONE( profile_zones::zone::process_items );
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z();
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z();
+    low_priority_item_stretch = 1;
+    if( item_processing_budget > 0 ) {
+        update_submaps_with_active_items();
+        size_t low_priority_items = 0;
+        for( const tripoint_abs_sm &abs_pos : submaps_with_active_items ) {
+            const tripoint_rel_sm local_pos = abs_pos - abs_sub.xy();
+            // TODO: fix point types
+            if( submap *const sm = get_submap_at_grid( local_pos.raw() ) ) {
+                low_priority_items += sm->active_items.low_priority_per_turn();
+            }
+        }
+        for( int gz = minz; gz <= maxz; ++gz ) {
+            for( vehicle *veh : access_cache( gz ).vehicle_list ) {
+                low_priority_items += veh->active_items.low_priority_per_turn();
+            }
+        }
+        const size_t budget = item_processing_budget;
+        low_priority_item_stretch = std::clamp<int>( divide_round_up( low_priority_items, budget ),
+                                    1, max_low_priority_item_stretch );
+    }
     for( int gz = minz; gz <= maxz; ++gz ) {
         level_cache &cache = access_cache( gz );
         std::set<tripoint> submaps_with_vehicles;
@@ -5571,6 +5623,7 @@ void map::process_items()
             ++iter;
         }
     }
+    low_priority_item_stretch = 1;
 }
 
 void map::process_items_in_submap( submap &current_submap, const tripoint &gridp )
@@ -5578,7 +5631,9 @@ void map::process_items_in_submap( submap &current_submap, const tripoint &gridp
     // Get a COPY of the active item list for this submap.
     // If more are added as a side effect of processing, they are ignored this turn.
     // If they are destroyed before processing, they don't get processed.
-    std::vector<item_reference> active_items = current_submap.active_items.get_for_processing();
+    // The buffer is moved out for the duration, in case processing an item gets us back here.
+    std::vector<item_reference> active_items = std::move( active_item_buffer );
+    current_submap.active_items.get_for_processing( active_items, low_priority_item_stretch );
     const point grid_offset( gridp.x * SEEX, gridp.y * SEEY );
     for( item_reference &active_item_ref : active_items ) {
         if( !active_item_ref.item_ref ) {
@@ -5612,6 +5667,7 @@ void map::process_items_in_submap( submap &current_submap, const tripoint &gridp
                            map_location, 1, flag,
                            spoil_multiplier * active_item_ref.spoil_multiplier() );
     }
+    active_item_buffer = std::move( active_items );
 }
 
 void map::process_items_in_vehicles( submap &current_submap )
@@ -5648,7 +5704,9 @@ void map::process_items_in_vehicle( vehicle &cur_veh, submap &current_submap )
         process_vehicle_items( cur_veh, vp.part_index() );
     }
 
-    for( item_reference &active_item_ref : cur_veh.active_items.get_for_processing() ) {
+    std::vector<item_reference> active_items;
+    cur_veh.active_items.get_for_processing( active_items, low_priority_item_stretch );
+    for( item_reference &active_item_ref : active_items ) {
         if( empty( cargo_parts ) ) {
             return;
         } else if( !active_item_ref.item_ref ) {
@@ -6188,7 +6246,7 @@ void map::trap_set( const tripoint &p, const trap_id &type )
 
     current_submap->set_trap( l, type );
     if( type != tr_null ) {
-        traplocs[type.to_i()].push_back( p );
+        index_trap( p, type );
     }
 }
 
@@ -6222,11 +6280,7 @@ void map::remove_trap( const tripoint &p )
         }
 
         current_submap->set_trap( l, tr_null );
-        auto &traps = traplocs[tid.to_i()];
-        const auto iter = std::find( traps.begin(), traps.end(), p );
-        if( iter != traps.end() ) {
-            traps.erase( iter );
-        }
+        unindex_trap( p, tid );
     }
 }
 
@@ -6457,6 +6511,7 @@ bool map::add_field( const tripoint &p, const field_type_id &type_id, int intens
     current_submap->ensure_nonuniform();
     invalidate_max_populated_zlev( p.z );
 
+    current_submap->mark_field_tile( l );
     if( current_submap->get_field( l ).add_field( converted_type_id, intensity, age ) ) {
         //Only adding it to the count if it doesn't exist.
         if( !current_submap->field_count++ ) {
@@ -7265,18 +7320,7 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
 
     // Ugly `if` for now
     if( F.z == T.z ) {
-        bresenham( F.xy(), T.xy(), bresenham_slope,
-        [this, &visible, &T]( const point & new_point ) {
-            // Exit before checking the last square, it's still visible even if opaque.
-            if( new_point.x == T.x && new_point.y == T.y ) {
-                return false;
-            }
-            if( !this->is_transparent( tripoint( new_point, T.z ) ) ) {
-                visible = false;
-                return false;
-            }
-            return true;
-        } );
+        visible = sees_on_level( F, T, bresenham_slope );
         skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
         return visible;
     }
@@ -7314,6 +7358,51 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
     return visible;
 }
 
+bool map::sees_on_level( const tripoint &F, const tripoint &T, int &bresenham_slope ) const
+{
+    const point d = T.xy() - F.xy();
+    const std::vector<point> &line = line_offsets( d, bresenham_slope );
+    const level_cache &ch = get_cache_ref( T.z );
+    // The last square is still visible even if opaque, so it isn't checked.
+    const size_t checked = line.back() == d ? line.size() - 1 : line.size();
+    for( size_t i = 0; i < checked; ++i ) {
+        const point p = F.xy() + line[i];
+        if( !ch.transparent_cache[p.x][p.y] ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void map::prime_sees_cache( const std::vector<std::pair<tripoint, tripoint>> &lines ) const
+{
+    // The cache itself is not thread safe, so pick out the missing lines first, trace
+    // them on the pool and only then store the results.
+    std::vector<std::pair<tripoint, tripoint>> missing;
+    std::unordered_set<point> keys;
+    for( const std::pair<tripoint, tripoint> &line : lines ) {
+        const tripoint &from = line.first;
+        const tripoint &to = line.second;
+        if( from.z != to.z || from == to || !inbounds( from ) || !inbounds( to ) ) {
+            continue;
+        }
+        const point key = sees_cache_key( from, to );
+        if( skew_vision_cache.get( key, -1 ) < 0 && keys.insert( key ).second ) {
+            missing.push_back( line );
+        }
+    }
+
+    std::vector<char> visible( missing.size() );
+    get_worker_pool().parallel_for( missing.size(), [&]( const size_t i ) {
+        int bresenham_slope = 0;
+        visible[i] = sees_on_level( missing[i].first, missing[i].second, bresenham_slope ) ? 1 : 0;
+    } );
+    for( size_t i = 0; i < missing.size(); ++i ) {
+        skew_vision_cache.insert( 100000, sees_cache_key( missing[i].first, missing[i].second ),
+                                  visible[i] );
+    }
+}
+
 int map::obstacle_coverage( const tripoint &loc1, const tripoint &loc2 ) const
 {
     // Can't hide if you are standing on furniture, or non-flat slowing-down terrain tile.
@@ -7602,22 +7691,17 @@ bool map::clear_path( const tripoint &f, const tripoint &t, const int range,
             !inbounds( t ) ) {
             return false; // Out of range!
         }
-        bool is_clear = true;
-        bresenham( f.xy(), t.xy(), 0,
-        [this, &is_clear, cost_min, cost_max, &t]( const point & new_point ) {
-            // Exit before checking the last square, it's still reachable even if it is an obstacle.
-            if( new_point.x == t.x && new_point.y == t.y ) {
-                return false;
-            }
-
-            const int cost = this->move_cost( new_point );
+        const point d = t.xy() - f.xy();
+        const std::vector<point> &line = line_offsets( d );
+        // Stop before the last square, it's still reachable even if it is an obstacle.
+        const size_t checked = line.back() == d ? line.size() - 1 : line.size();
+        for( size_t i = 0; i < checked; ++i ) {
+            const int cost = move_cost( f.xy() + line[i] );
             if( cost < cost_min || cost > cost_max ) {
-                is_clear = false;
                 return false;
             }
-            return true;
-        } );
-        return is_clear;
+        }
+        return true;
     }
 
     if( ( range >= 0 && range < rl_dist( f, t ) ) ||
@@ -7746,8 +7830,8 @@ void map::load( const tripoint_abs_sm &w, const bool update_vehicle,
                 << "loading non-main map at " << w.to_string()
                 << " which overlaps with main map (abs_sub = " << main_map.abs_sub.to_string() << ")";
     }
-    for( auto &traps : traplocs ) {
-        traps.clear();
+    for( size_t nonant = 0; nonant < trap_index.size(); nonant++ ) {
+        clear_trap_index( nonant );
     }
     field_furn_locs.clear();
     field_ter_locs.clear();
@@ -7803,20 +7887,6 @@ void map::shift_traps( const tripoint &shift )
             iter = field_ter_locs.erase( iter );
         }
     }
-    for( auto &traps : traplocs ) {
-        for( auto iter = traps.begin(); iter != traps.end(); ) {
-            tripoint &pos = *iter;
-            pos += offset;
-            if( inbounds( pos ) ) {
-                ++iter;
-            } else {
-                // Theoretical enhancement: if this is not the last entry of the vector,
-                // move the last entry into pos and remove the last entry instead of iter.
-                // This would avoid moving all the remaining entries.
-                iter = traps.erase( iter );
-            }
-        }
-    }
 }
 
 template<int SIZE, int MULTIPLIER>
@@ -7849,6 +7919,84 @@ shift_bitset_cache<MAPSIZE_X, SEEX>( std::bitset<MAPSIZE_X *MAPSIZE_X> &cache,
 template void
 shift_bitset_cache<MAPSIZE, 1>( std::bitset<MAPSIZE *MAPSIZE> &cache, const point &s );
 
+void map::prefetch_submaps( const point &dir, const int rows ) const
+{
+    if( dir == point_zero ) {
+        return;
+    }
+    const point step( sgn( dir.x ), sgn( dir.y ) );
+    const tripoint_abs_sm origin = get_abs_sub();
+    // Submaps that become part of the map after shifting `shift` times along `step`.
+    for( int shift = 1; shift <= rows; ++shift ) {
+        const point_abs_sm shifted = origin.xy() + step * shift;
+        const point_abs_sm far_edge = shifted + point( my_MAPSIZE - 1, my_MAPSIZE - 1 );
+        for( int i = 0; i < my_MAPSIZE; ++i ) {
+            if( step.x != 0 ) {
+                const int x = step.x > 0 ? far_edge.x() : shifted.x();
+                const tripoint_abs_sm p( x, shifted.y() + i, origin.z() );
+                MAPBUFFER.prefetch( p );
+                mapgen_queue::request( project_to<coords::omt>( p ) );
+            }
+            if( step.y != 0 ) {
+                const int y = step.y > 0 ? far_edge.y() : shifted.y();
+                const tripoint_abs_sm p( shifted.x() + i, y, origin.z() );
+                MAPBUFFER.prefetch( p );
+                mapgen_queue::request( project_to<coords::omt>( p ) );
+            }
+        }
+    }
+}
+
+// Moves the transparency cache of a level along with its submaps when the map shifts by
+// `sp`, so only the submaps near the edge that came in have to be rebuilt.
+static void shift_transparency_cache( level_cache &cache, const point &sp )
+{
+    const point d( sp.x * SEEX, sp.y * SEEY );
+    // Tile x takes the value of tile x + d.x, so walk away from where the values come from
+    for( int i = 0; i < MAPSIZE_X; ++i ) {
+        const int x = d.x >= 0 ? i : MAPSIZE_X - 1 - i;
+        const int from = x + d.x;
+        auto &column = cache.transparency_cache[x];
+        auto &transparent = cache.transparent_cache[x];
+        auto &transparent_wo_fields = cache.transparent_cache_wo_fields[x];
+        if( from < 0 || from >= MAPSIZE_X ) {
+            // Rebuilt below
+            column.fill( LIGHT_TRANSPARENCY_SOLID );
+            transparent.reset();
+            transparent_wo_fields.reset();
+            continue;
+        }
+        if( from != x ) {
+            column = cache.transparency_cache[from];
+            transparent = cache.transparent_cache[from];
+            transparent_wo_fields = cache.transparent_cache_wo_fields[from];
+        }
+        if( d.y > 0 ) {
+            std::copy( column.begin() + d.y, column.end(), column.begin() );
+            transparent >>= d.y;
+            transparent_wo_fields >>= d.y;
+        } else if( d.y < 0 ) {
+            std::copy_backward( column.begin(), column.end() + d.y, column.end() );
+            transparent <<= -d.y;
+            transparent_wo_fields <<= -d.y;
+        }
+    }
+
+    // Submaps that came in need building, and so do their neighbours: whether a tile is
+    // outside, which changes its transparency, depends on the tiles around it.
+    const std::bitset<MAPSIZE *MAPSIZE> old_dirty = cache.transparency_cache_dirty;
+    const auto near_edge = []( const int sm, const int s ) {
+        return sm + 2 * s < 0 || sm + 2 * s >= MAPSIZE;
+    };
+    for( int smx = 0; smx < MAPSIZE; ++smx ) {
+        for( int smy = 0; smy < MAPSIZE; ++smy ) {
+            const bool dirty = near_edge( smx, sp.x ) || near_edge( smy, sp.y ) ||
+                               old_dirty[( smx + sp.x ) * MAPSIZE + smy + sp.y];
+            cache.transparency_cache_dirty[smx * MAPSIZE + smy] = dirty;
+        }
+    }
+}
+
 void map::shift( const point &sp )
 {
     // Special case of 0-shift; refresh the map
@@ -7895,8 +8043,10 @@ void map::shift( const point &sp )
         clear_vehicle_list( gridz );
         level_cache *cache = get_cache_lazy( gridz );
         if( cache ) {
+            shift_transparency_cache( *cache, sp );
             shift_bitset_cache<MAPSIZE_X, SEEX>( cache->map_memory_cache_dec, sp );
             shift_bitset_cache<MAPSIZE_X, SEEX>( cache->map_memory_cache_ter, sp );
+            shift_bitset_cache<MAPSIZE_X, SEEX>( cache->support_cache_dirty, sp );
             shift_bitset_cache<MAPSIZE, 1>( cache->field_cache, sp );
         }
         if( sp.x >= 0 ) {
@@ -7978,13 +8128,6 @@ void map::shift( const point &sp )
 
     g->setremoteveh( remoteveh );
 
-    if( !support_cache_dirty.empty() ) {
-        std::set<tripoint> old_cache = std::move( support_cache_dirty );
-        support_cache_dirty.clear();
-        for( const tripoint &pt : old_cache ) {
-            support_cache_dirty.insert( pt + point( -sp.x * SEEX, -sp.y * SEEY ) );
-        }
-    }
     // actualize after loading all submaps to prevent errors
     // with entities at the edges
     for( tripoint loaded_grid : loaded_grids ) {
@@ -8081,6 +8224,31 @@ bool generate_uniform_omt( const tripoint_abs_sm &p, const oter_id &terrain_type
     return ret;
 }
 
+void generate_omt( const tripoint_abs_omt &omt, const time_point &when, const unsigned int seed )
+{
+    const tripoint_abs_sm sm_pos = project_to<coords::sm>( omt );
+    const rng_stream_scope rng_scope( seed );
+    if( generate_uniform_omt( sm_pos, overmap_buffer.ter( omt ) ) ) {
+        return;
+    }
+    // Some mapgen looks at the current turn rather than the one it is given
+    restore_on_out_of_scope<time_point> restore_turn( calendar::turn );
+    calendar::turn = when;
+    tinymap tmp_map;
+    tmp_map.main_cleanup_override( false );
+    tmp_map.generate( sm_pos, when );
+    if( tmp_map.has_placed_npcs() ) {
+        return;
+    }
+    for( const point &offset : { point_zero, point_south, point_east, point_south_east } ) {
+        if( submap *sm = MAPBUFFER.lookup_submap( sm_pos + offset ) ) {
+            sm->pristine = true;
+            sm->mapgen_seed = seed;
+            sm->generated_at = when;
+        }
+    }
+}
+
 void map::loadn( const tripoint &grid, const bool update_vehicles )
 {
     dbg( D_INFO ) << "map::loadn(game[" << g.get() << "], worldx[" << abs_sub.x()
@@ -8127,6 +8295,8 @@ void map::loadn( const tripoint &grid, const bool update_vehicles )
         }
     }
 
+    tmpsub->pristine = false;
+
     // New submap changes the content of the map and all caches must be recalculated
     set_transparency_cache_dirty( grid.z );
     set_seen_cache_dirty( grid.z );
@@ -8531,6 +8701,7 @@ void map::actualize( const tripoint &grid )
 
     const time_duration time_since_last_actualize = calendar::turn - tmpsub->last_touched;
     const bool do_funnels = grid.z >= 0;
+    clear_trap_index( get_nonant( grid ) );
 
     // check spoiled stuff, and fill up funnels while we're at it
     process_items_in_vehicles( *tmpsub );
@@ -8551,11 +8722,11 @@ void map::actualize( const tripoint &grid )
 
             const trap_id trap_here = tmpsub->get_trap( p );
             if( trap_here != tr_null ) {
-                traplocs[trap_here.to_i()].push_back( pnt );
+                index_trap( pnt, trap_here );
             }
             const ter_t &ter = tmpsub->get_ter( p ).obj();
             if( ter.trap != tr_null && ter.trap != tr_ledge ) {
-                traplocs[ter.trap.to_i()].push_back( pnt );
+                index_trap( pnt, ter.trap );
             }
 
             if( do_funnels ) {
@@ -8633,10 +8804,48 @@ void map::copy_grid( const tripoint &to, const tripoint &from )
                   from.z );
         return;
     }
-    setsubmap( get_nonant( to ), smap );
+    const size_t to_nonant = get_nonant( to );
+    const size_t from_nonant = get_nonant( from );
+    setsubmap( to_nonant, smap );
     for( auto &it : smap->vehicles ) {
         it->sm_pos = to;
     }
+    if( to_nonant != from_nonant ) {
+        clear_trap_index( to_nonant );
+        trap_index[to_nonant] = std::move( trap_index[from_nonant] );
+        trap_index[from_nonant].clear();
+    }
+}
+
+void map::index_trap( const tripoint &p, const trap_id &type )
+{
+    const size_t nonant = get_nonant( tripoint( p.x / SEEX, p.y / SEEY, p.z ) );
+    trap_index[nonant].push_back( { point( p.x % SEEX, p.y % SEEY ), type } );
+    trap_counts[type.to_i()]++;
+}
+
+void map::unindex_trap( const tripoint &p, const trap_id &type )
+{
+    const size_t nonant = get_nonant( tripoint( p.x / SEEX, p.y / SEEY, p.z ) );
+    std::vector<indexed_trap> &traps = trap_index[nonant];
+    const point pos( p.x % SEEX, p.y % SEEY );
+    const auto iter = std::find_if( traps.begin(), traps.end(), [&]( const indexed_trap & t ) {
+        return t.pos == pos && t.type == type;
+    } );
+    if( iter != traps.end() ) {
+        // Order doesn't matter, so fill the hole with the last entry
+        *iter = traps.back();
+        traps.pop_back();
+        trap_counts[type.to_i()]--;
+    }
+}
+
+void map::clear_trap_index( size_t nonant )
+{
+    for( const indexed_trap &t : trap_index[nonant] ) {
+        trap_counts[t.type.to_i()]--;
+    }
+    trap_index[nonant].clear();
 }
 
 void map::spawn_monsters_submap_group( const tripoint &gp, mongroup &group, bool ignore_sight )
@@ -8659,7 +8868,7 @@ void map::spawn_monsters_submap_group( const tripoint &gp, mongroup &group, bool
         ignore_sight = true;
     }
 
-    static const auto allow_on_terrain = [&]( const tripoint & p ) {
+    const auto allow_on_terrain = [this]( const tripoint & p ) {
         // TODO: flying creatures should be allowed to spawn without a floor,
         // but the new creature is created *after* determining the terrain, so
         // we can't check for it here.
@@ -8753,11 +8962,22 @@ void map::spawn_monsters_submap_group( const tripoint &gp, mongroup &group, bool
         }
     }
 
+    // Every location is free and is handed out only once, so the monsters can go straight
+    // into the tracker without checking for other creatures again.
+    creatures.reserve( std::min( group.monsters.size(), locations.size() ) );
+    const auto take_random_location = [&locations]() {
+        const size_t i = rng( 0, locations.size() - 1 );
+        const tripoint p = locations[i];
+        locations[i] = locations.back();
+        locations.pop_back();
+        return p;
+    };
+
     // Find horde's target submap
     for( monster &tmp : group.monsters ) {
         for( int tries = 0; tries < 10 && !locations.empty(); tries++ ) {
-            const tripoint local_pos = random_entry_removed( locations );
-            const tripoint_abs_ms abs_pos = get_map().getglobal( local_pos );
+            const tripoint local_pos = take_random_location();
+            const tripoint_abs_ms abs_pos = getglobal( local_pos );
             if( !tmp.can_move_to( local_pos ) ) {
                 continue; // target can not contain the monster
             }
@@ -8771,8 +8991,9 @@ void map::spawn_monsters_submap_group( const tripoint &gp, mongroup &group, bool
                                tmp.wander_pos.to_string_writable() );
             }
 
-            monster *const placed = g->place_critter_at( make_shared_fast<monster>( tmp ), local_pos );
-            if( placed ) {
+            const shared_ptr_fast<monster> placed = make_shared_fast<monster>( std::move( tmp ) );
+            placed->spawn( local_pos );
+            if( creatures.add( placed ) ) {
                 placed->on_load();
             }
             break;
@@ -8914,8 +9135,8 @@ void map::clear_traps()
     }
 
     // Forget about all trap locations.
-    for( auto &i : traplocs ) {
-        i.clear();
+    for( size_t nonant = 0; nonant < trap_index.size(); nonant++ ) {
+        clear_trap_index( nonant );
     }
 }
 
@@ -8929,9 +9150,36 @@ const std::vector<tripoint> &map::get_ter_field_locations() const
     return field_ter_locs;
 }
 
-const std::vector<tripoint> &map::trap_locations( const trap_id &type ) const
+std::vector<tripoint> map::trap_locations( const trap_id &type ) const
+{
+    std::vector<tripoint> locations;
+    if( trap_counts[type.to_i()] == 0 ) {
+        return locations;
+    }
+    locations.reserve( trap_counts[type.to_i()] );
+    const int zmin = zlevels ? -OVERMAP_DEPTH : abs_sub.z();
+    const int zmax = zlevels ? OVERMAP_HEIGHT : abs_sub.z();
+    for( int gridz = zmin; gridz <= zmax; gridz++ ) {
+        for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+            for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+                const tripoint grid( gridx, gridy, gridz );
+                for( const indexed_trap &t : trap_index[get_nonant( grid )] ) {
+                    if( t.type == type ) {
+                        locations.push_back( sm_to_ms_copy( grid ) + t.pos );
+                    }
+                }
+            }
+        }
+    }
+    return locations;
+}
+
+bool map::may_have_trap( const tripoint &p ) const
 {
-    return traplocs[type.to_i()];
+    if( !inbounds( p ) ) {
+        return false;
+    }
+    return !trap_index[get_nonant( tripoint( p.x / SEEX, p.y / SEEY, p.z ) )].empty();
 }
 
 bool map::inbounds( const tripoint_abs_ms &p ) const
@@ -9124,8 +9372,7 @@ void map::build_outside_cache( const int zlev )
 
     auto &outside_cache = ch.outside_cache;
     if( zlev < 0 ) {
-        std::uninitialized_fill_n(
-            &outside_cache[0][0], MAPSIZE_X * MAPSIZE_Y, false );
+        outside_cache.fill( false );
         return;
     }
 
@@ -9274,8 +9521,7 @@ bool map::build_floor_cache( const int zlev )
     level_cache &ch = *ch_lazy;
 
     auto &floor_cache = ch.floor_cache;
-    std::uninitialized_fill_n(
-        &floor_cache[0][0], MAPSIZE_X * MAPSIZE_Y, true );
+    floor_cache.fill( true );
     bool &no_floor_gaps = ch.no_floor_gaps;
     no_floor_gaps = true;
 
@@ -9345,6 +9591,7 @@ static void vehicle_caching_internal( level_cache &zch, const vpart_reference &v
         int dpart = v->part_with_feature( part, VPFLAG_OPENABLE, true );
         if( dpart < 0 || !v->part( dpart ).open ) {
             transparency_cache[part_pos.x][part_pos.y] = LIGHT_TRANSPARENCY_SOLID;
+            zch.transparent_cache[part_pos.x][part_pos.y] = false;
         } else {
             vehicle_is_opaque = false;
         }
@@ -9390,16 +9637,35 @@ void map::do_vehicle_caching( int z )
 
 void map::build_map_cache( const int zlev, bool skip_lightmap )
 {
+    CATA_PROFILE_ZONE( profile_zones::zone::build_map_cache );
     const int minz = zlevels ? -OVERMAP_DEPTH : zlev;
     const int maxz = zlevels ? OVERMAP_HEIGHT : zlev;
     bool seen_cache_dirty = false;
     bool camera_cache_dirty = false;
-    for( int z = minz; z <= maxz; z++ ) {
-        build_outside_cache( z );
-        build_transparency_cache( z );
-        bool floor_cache_was_dirty = build_floor_cache( z );
-        seen_cache_dirty |= floor_cache_was_dirty;
-        seen_cache_dirty |= get_cache( z ).seen_cache_dirty;
+    // Lighting and transparency may change below, so anything seen so far has to be checked again.
+    sight_memo::clear();
+    if( parallel_map_cache && minz != maxz ) {
+        // Each level only writes its own level_cache and reads submaps, so the levels
+        // can be built independently of each other.
+        std::array<bool, OVERMAP_LAYERS> floor_cache_was_dirty{};
+        get_worker_pool().parallel_for( maxz - minz + 1, [&]( const size_t i ) {
+            const int z = minz + static_cast<int>( i );
+            build_outside_cache( z );
+            build_transparency_cache( z );
+            floor_cache_was_dirty[i] = build_floor_cache( z );
+        } );
+        for( int z = minz; z <= maxz; z++ ) {
+            seen_cache_dirty |= floor_cache_was_dirty[z - minz];
+            seen_cache_dirty |= get_cache( z ).seen_cache_dirty;
+        }
+    } else {
+        for( int z = minz; z <= maxz; z++ ) {
+            build_outside_cache( z );
+            build_transparency_cache( z );
+            bool floor_cache_was_dirty = build_floor_cache( z );
+            seen_cache_dirty |= floor_cache_was_dirty;
+            seen_cache_dirty |= get_cache( z ).seen_cache_dirty;
+        }
     }
     // needs a separate pass as it changes the caches on neighbour z-levels (e.g. floor_cache);
     // otherwise such changes might be overwritten by main cache-building logic
@@ -10109,11 +10375,6 @@ const level_cache &map::access_cache( int zlev ) const
     return nullcache;
 }
 
-pathfinding_cache::pathfinding_cache()
-{
-    dirty = true;
-}
-
 pathfinding_cache &map::get_pathfinding_cache( int zlev ) const
 {
     return *pathfinding_caches[zlev + OVERMAP_DEPTH];
@@ -10122,14 +10383,18 @@ pathfinding_cache &map::get_pathfinding_cache( int zlev ) const
 void map::set_pathfinding_cache_dirty( const int zlev )
 {
     if( inbounds_z( zlev ) ) {
-        get_pathfinding_cache( zlev ).dirty = true;
+        pathfinding_cache &cache = get_pathfinding_cache( zlev );
+        cache.dirty = true;
+        cache.clear_route_caches();
     }
 }
 
 void map::set_pathfinding_cache_dirty( const tripoint &p )
 {
     if( inbounds( p ) ) {
-        get_pathfinding_cache( p.z ).dirty_points.insert( p.xy() );
+        pathfinding_cache &cache = get_pathfinding_cache( p.z );
+        cache.dirty_points.insert( p.xy() );
+        cache.clear_route_caches();
     }
 }
 
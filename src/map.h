@@ -20,6 +20,7 @@
 #include <variant>
 #include <vector>
 
+#include "active_item_cache.h"
 #include "calendar.h"
 #include "cata_assert.h"
 #include "cata_type_traits.h"
@@ -95,7 +96,9 @@ using VehicleList = std::vector<wrapped_vehicle>;
 class map;
 
 enum class ter_furn_flag : int;
+struct flow_field;
 struct pathfinding_cache;
+struct portal_graph;
 struct pathfinding_settings;
 template<typename T>
 struct weighted_int_list;
@@ -392,7 +395,12 @@ class map
         void set_pathfinding_cache_dirty( const tripoint &p );
         /*@}*/
 
-        void invalidate_map_cache( int zlev );
+        /**
+         * Marks every cache of the level as needing a rebuild.
+         * @param keep_transparency Leave the transparency cache alone, for when @ref shift
+         * already moved it along with the submaps and marked what came in as dirty.
+         */
+        void invalidate_map_cache( int zlev, bool keep_transparency = false );
 
         // @returns true if map memory decoration should be re/memorized
         bool memory_cache_dec_is_dirty( const tripoint &p ) const;
@@ -497,6 +505,13 @@ class map
          * Note: the map must have been loaded before this can be called.
          */
         void shift( const point &s );
+        /**
+         * Asks the mapbuffer to read the submaps that the next @p rows shifts in
+         * direction @p dir would load from disk in the background, e.g. ahead of
+         * a fast vehicle, and queues them in @ref mapgen_queue in case they have
+         * never been generated. Only looks at the current z-level.
+         */
+        void prefetch_submaps( const point &dir, int rows = 2 ) const;
         /**
          * Moves the map vertically to (not by!) newz.
          * Does not actually shift anything, only forces cache updates.
@@ -523,7 +538,22 @@ class map
                          const oter_id &om_ter );
         void create_hot_air( const tripoint &p, int intensity );
         bool gas_can_spread_to( field_entry &cur, const maptile &dst );
-        void gas_spread_to( field_entry &cur, maptile &dst, const tripoint &p );
+        // Spreads cur, which is at from, into dst at p. May be deferred, see deferred_gas_spread.
+        void gas_spread_to( field_entry &cur, const tripoint &from, maptile &dst, const tripoint &p );
+        // Moves one unit of intensity and age_fraction of age from cur into the same field
+        // type at p.
+        void transfer_gas( field_entry &cur, maptile &dst, const tripoint &p,
+                           const time_duration &age_fraction );
+        // Applies the gas spreading queued up by gas_spread_to when deferred_gas_spread is set.
+        void apply_deferred_gas_spread();
+
+        struct deferred_gas_transfer {
+            tripoint from;
+            tripoint to;
+            field_type_id type;
+            time_duration age_fraction;
+        };
+        std::vector<deferred_gas_transfer> deferred_gas_transfers;
         int burn_body_part( Character &you, field_entry &cur, const bodypart_id &bp, int scale );
     public:
 
@@ -603,6 +633,13 @@ class map
         * Returns whether `F` sees `T` with a view range of `range`.
         */
         bool sees( const tripoint &F, const tripoint &T, int range ) const;
+        /**
+         * Works out the line of sight between each pair of points ahead of time and stores it
+         * in the cache used by @ref sees, so later calls for those pairs are cheap. The lines
+         * are traced on the worker pool. Only pairs on the same z-level are traced, others
+         * (and pairs already in the cache) are left alone. The range is not checked.
+         */
+        void prime_sees_cache( const std::vector<std::pair<tripoint, tripoint>> &lines ) const;
     private:
         /**
          * Don't expose the slope adjust outside map functions.
@@ -616,6 +653,9 @@ class map
         **/
         bool sees( const tripoint &F, const tripoint &T, int range, int &bresenham_slope ) const;
         point sees_cache_key( const tripoint &from, const tripoint &to ) const;
+        // The uncached line of sight between two points on the same z-level. Only reads
+        // the transparency cache, so it may be called from several threads at once.
+        bool sees_on_level( const tripoint &F, const tripoint &T, int &bresenham_slope ) const;
     public:
         /**
         * Returns coverage of target in relation to the observer. Target is loc2, observer is loc1.
@@ -694,10 +734,41 @@ class map
         std::vector<tripoint_bub_ms> route( const tripoint_bub_ms &f, const tripoint_bub_ms &t,
                                             const pathfinding_settings &settings,
         const std::unordered_set<tripoint> &pre_closed = {{ }} ) const;
+        /**
+         * Same as above, but the result replaces the contents of @p path. Callers that repath
+         * often (monsters, NPCs) should keep the vector around, so its storage gets reused.
+         */
+        void route( std::vector<tripoint> &path, const tripoint &f, const tripoint &t,
+                    const pathfinding_settings &settings,
+        const std::unordered_set<tripoint> &pre_closed = {{ }} ) const;
+
+        /**
+         * Like route(), but walks down a flow field towards @p t, which is computed once and
+         * shared by every caller with the same destination and compatible settings. This makes
+         * many creatures chasing one target much cheaper than running A* for each of them.
+         * The field only covers the z-level of @p t and doesn't path through anything that would
+         * need bashing, opening or climbing. Returns false if it couldn't find a path, in which
+         * case the caller should fall back to route().
+         */
+        bool flow_field_route( std::vector<tripoint> &path, const tripoint &f, const tripoint &t,
+                               const pathfinding_settings &settings,
+        const std::unordered_set<tripoint> &pre_closed = {{ }} ) const;
+
+        /**
+         * Like route(), but for destinations anywhere in the reality bubble. Plans across a graph
+         * of the gaps between submaps first, and then only runs A* for the first couple of
+         * submaps of that plan, so @p path may end short of @p t. Callers are expected to repath
+         * as they go. Close destinations are handed straight to route().
+         */
+        void hierarchical_route( std::vector<tripoint> &path, const tripoint &f, const tripoint &t,
+                                 const pathfinding_settings &settings,
+        const std::unordered_set<tripoint> &pre_closed = {{ }} ) const;
 
         // Get a straight route from f to t, only along non-rough terrain. Returns an empty vector
         // if that is not possible.
         std::vector<tripoint> straight_route( const tripoint &f, const tripoint &t ) const;
+        // Same as above, writing the result into @p path.
+        void straight_route( std::vector<tripoint> &path, const tripoint &f, const tripoint &t ) const;
 
         // Vehicles: Common to 2D and 3D
         VehicleList get_vehicles();
@@ -1504,7 +1575,13 @@ class map
         void remove_trap( const tripoint_bub_ms &p );
         const std::vector<tripoint> &get_furn_field_locations() const;
         const std::vector<tripoint> &get_ter_field_locations() const;
-        const std::vector<tripoint> &trap_locations( const trap_id &type ) const;
+        /** Every tile with a trap of @p type, ledges built into terrain aren't tracked. */
+        std::vector<tripoint> trap_locations( const trap_id &type ) const;
+        /**
+         * False if the submap holding @p p has no traps at all, other than ledges built into
+         * terrain. Lets callers skip looking up the trap of every tile in trap-free areas.
+         */
+        bool may_have_trap( const tripoint &p ) const;
 
         /**
          * Handles activating a trap. It includes checks for avoiding the trap
@@ -1715,9 +1792,9 @@ class map
 
         // Support (of weight, structures etc.)
     private:
-        // Tiles whose ability to support things was removed in the last turn
-        std::set<tripoint> support_cache_dirty;
-        // Checks if the tile is supported and adds it to support_cache_dirty if it isn't
+        // z-levels with tiles set in their level_cache::support_cache_dirty
+        std::bitset<OVERMAP_LAYERS> support_dirty_levels;
+        // Marks the tile for process_falling to check whether it still supports things
         void support_dirty( const tripoint &p );
     public:
 
@@ -1767,6 +1844,10 @@ class map
                             bool lootable = false );
         // places an NPC, if static NPCs are enabled or if force is true
         character_id place_npc( const point &p, const string_id<npc_template> &type );
+        // NPCs are kept by the overmap, so mapgen that placed one can't be repeated
+        bool has_placed_npcs() const {
+            return placed_npcs;
+        }
         void apply_faction_ownership( const point &p1, const point &p2, const faction_id &id );
         void add_spawn( const mtype_id &type, int count, const tripoint &p,
                         bool friendly = false, int faction_id = -1, int mission_id = -1,
@@ -1973,12 +2054,18 @@ class map
         void player_in_field( Character &you );
         void monster_in_field( monster &z );
         /**
-         * As part of the map shifting, this shifts the trap locations stored in @ref traplocs.
+         * As part of the map shifting, this shifts the locations of field emitting terrain and
+         * furniture. Traps need no shifting, @ref trap_index moves along with the submaps.
          * @param shift The amount shifting in submap, the same as go into @ref shift.
          */
         void shift_traps( const tripoint &shift );
 
         void copy_grid( const tripoint &to, const tripoint &from );
+        /** Adds or removes the trap at @p p from @ref trap_index. */
+        void index_trap( const tripoint &p, const trap_id &type );
+        void unindex_trap( const tripoint &p, const trap_id &type );
+        /** Forgets the traps of the submap at @p nonant in @ref grid. */
+        void clear_trap_index( size_t nonant );
         void draw_map( mapgendata &dat );
 
         void draw_lab( mapgendata &dat );
@@ -2180,6 +2267,11 @@ class map
         void apply_directional_light( const tripoint &p, int direction, float luminance );
         void apply_light_arc( const tripoint &p, const units::angle &angle, float luminance,
                               const units::angle &wideangle = 30_degrees );
+        // Like add_light_source, queues the arc to be cast at the end of generate_lightmap.
+        void add_light_arc( const tripoint &p, const units::angle &angle, float luminance,
+                            const units::angle &wideangle = 30_degrees );
+        // Brings level_cache::source_lights up to date with the queued light sources and arcs.
+        void update_source_lightmap( int zlev );
         void apply_light_ray( cata::mdarray<bool, point_bub_ms, MAPSIZE_X, MAPSIZE_Y> &lit,
                               const tripoint &s, const tripoint &e, float luminance );
         void add_light_from_items( const tripoint &p, const item_stack &items );
@@ -2232,13 +2324,19 @@ class map
          * Use @ref getsubmap or @ref setsubmap to access it.
          */
         std::vector<submap *> grid;
+        /** A trap listed in @ref trap_index, with its position inside its submap. */
+        struct indexed_trap {
+            point pos;
+            trap_id type;
+        };
         /**
-         * This vector contains an entry for each trap type, it has therefore the same size
-         * as the traplist vector. Each entry contains a list of all point on the map that
-         * contain a trap of that type. The first entry however is always empty as it denotes the
-         * tr_null trap.
+         * The traps on each loaded submap, indexed like @ref grid. Positions are relative to
+         * the submap, so shifting the map moves whole lists along with their submaps instead
+         * of rewriting every position. Ledges built into terrain aren't listed.
          */
-        std::vector< std::vector<tripoint> > traplocs;
+        std::vector<std::vector<indexed_trap>> trap_index;
+        /** How many traps of each type @ref trap_index holds. */
+        std::vector<int> trap_counts;
         /**
          * Vector of tripoints containing active field-emitting furniture
          */
@@ -2258,6 +2356,13 @@ class map
          */
         std::set<tripoint_abs_sm> submaps_with_active_items;
         std::set<tripoint_abs_sm> submaps_with_active_items_dirty;
+        /**
+         * How many times slower than usual food and other low priority items are processed
+         * during the current process_items() call, see ITEM_PROCESSING_BUDGET.
+         */
+        int low_priority_item_stretch = 1;
+        // Storage for the items processed in one submap or vehicle, kept to avoid reallocating it.
+        std::vector<item_reference> active_item_buffer;
 
         /**
          * Cache of coordinate pairs recently checked for visibility.
@@ -2288,6 +2393,7 @@ class map
         // this is set for maps loaded in bounds of the main map (g->m)
         bool _main_requires_cleanup = false;
         std::optional<bool> _main_cleanup_override = std::nullopt;
+        bool placed_npcs = false;
 
     public:
         void queue_main_cleanup();
@@ -2301,6 +2407,9 @@ class map
 
         void update_pathfinding_cache( const tripoint &p ) const;
         void update_pathfinding_cache( int zlev ) const;
+        const flow_field &get_flow_field( const tripoint &dest,
+                                          const pathfinding_settings &settings ) const;
+        const portal_graph &get_portal_graph( int zlev, const pathfinding_settings &settings ) const;
 
         void update_visibility_cache( int zlev );
         void invalidate_visibility_cache();
@@ -2372,6 +2481,12 @@ void shift_bitset_cache( std::bitset<SIZE *SIZE> &cache, const point &s );
 bool ter_furn_has_flag( const ter_t &ter, const furn_t &furn, ter_furn_flag flag );
 bool generate_uniform( const tripoint_abs_sm &p, const oter_id &oter );
 bool generate_uniform_omt( const tripoint_abs_sm &p, const oter_id &terrain_type );
+/**
+ * Generates the overmap tile @p omt as of @p when, rolling from the stream @p seed (see
+ * @ref rng_stream_seed). The same arguments give the same submaps, so unless mapgen placed
+ * something outside of them they are marked pristine and saved as just these arguments.
+ */
+void generate_omt( const tripoint_abs_omt &omt, const time_point &when, unsigned int seed );
 class tinymap : public map
 {
         friend class editmap;
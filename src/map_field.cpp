@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "bodypart.h"
+#include "cached_options.h"
 #include "calendar.h"
 #include "cata_utility.h"
 #include "character.h"
@@ -54,6 +55,7 @@
 #include "npc.h"
 #include "overmapbuffer.h"
 #include "point.h"
+#include "profile_zones.h"
 #include "rng.h"
 #include "scent_block.h"
 #include "scent_map.h"
@@ -151,6 +153,7 @@ int map::burn_body_part( Character &you, field_entry &cur, const bodypart_id &bp
 
 void map::process_fields()
 {
+    CATA_PROFILE_ZONE( profile_zones::zone::process_fields );
     for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
         auto &field_cache = get_cache( z ).field_cache;
         for( int x = 0; x < my_MAPSIZE; x++ ) {
@@ -169,6 +172,7 @@ void map::process_fields()
             }
         }
     }
+    apply_deferred_gas_spread();
 }
 
 bool ter_furn_has_flag( const ter_t &ter, const furn_t &furn, const ter_furn_flag flag )
@@ -234,14 +238,24 @@ bool map::gas_can_spread_to( field_entry &cur, const maptile &dst )
     return false;
 }
 
-void map::gas_spread_to( field_entry &cur, maptile &dst, const tripoint &p )
+void map::gas_spread_to( field_entry &cur, const tripoint &from, maptile &dst, const tripoint &p )
+{
+    // Nearby gas grows thicker, and ages are shared.
+    const time_duration age_fraction = cur.get_field_age() / cur.get_field_intensity();
+    if( deferred_gas_spread ) {
+        deferred_gas_transfers.push_back( { from, p, cur.get_field_type(), age_fraction } );
+        return;
+    }
+    transfer_gas( cur, dst, p, age_fraction );
+}
+
+void map::transfer_gas( field_entry &cur, maptile &dst, const tripoint &p,
+                        const time_duration &age_fraction )
 {
     const field_type_id current_type = cur.get_field_type();
     const time_duration current_age = cur.get_field_age();
     const int current_intensity = cur.get_field_intensity();
     field_entry *f = dst.find_field( current_type );
-    // Nearby gas grows thicker, and ages are shared.
-    const time_duration age_fraction = current_age / current_intensity;
     if( f != nullptr ) {
         f->set_field_intensity( f->get_field_intensity() + 1 );
         cur.set_field_intensity( current_intensity - 1 );
@@ -260,6 +274,22 @@ void map::gas_spread_to( field_entry &cur, maptile &dst, const tripoint &p )
     }
 }
 
+void map::apply_deferred_gas_spread()
+{
+    // Everything a transfer depends on was decided while processing, and applying it only adds
+    // to or subtracts from intensities and ages, so the order here doesn't change the outcome.
+    for( const deferred_gas_transfer &transfer : deferred_gas_transfers ) {
+        field_entry *cur = get_field( transfer.from, transfer.type );
+        // The source may have decayed away in the meantime.
+        if( cur == nullptr || !inbounds( transfer.to ) ) {
+            continue;
+        }
+        maptile dst = maptile_at_internal( transfer.to );
+        transfer_gas( *cur, dst, transfer.to, transfer.age_fraction );
+    }
+    deferred_gas_transfers.clear();
+}
+
 void map::spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
                       const time_duration &outdoor_age_speedup, scent_block &sblk, const oter_id &om_ter )
 {
@@ -301,7 +331,7 @@ void map::spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
         const tripoint down{ p.xy(), p.z - 1 };
         maptile down_tile = maptile_at_internal( down );
         if( gas_can_spread_to( cur, down_tile ) && valid_move( p, down, true, true ) ) {
-            gas_spread_to( cur, down_tile, down );
+            gas_spread_to( cur, p, down_tile, down );
             return;
         }
     }
@@ -326,7 +356,7 @@ void map::spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
         // Construct the destination from offset and p
         if( sheltered || windpower < 5 ) {
             std::pair<tripoint, maptile> &n = neighs[ random_entry( spread ) ];
-            gas_spread_to( cur, n.second, n.first );
+            gas_spread_to( cur, p, n.second, n.first );
         } else {
             std::vector<size_t> neighbour_vec;
             auto maptiles = get_wind_blockers( winddirection, p );
@@ -345,14 +375,14 @@ void map::spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
             }
             if( !neighbour_vec.empty() ) {
                 std::pair<tripoint, maptile> &n = neighs[ random_entry( neighbour_vec ) ];
-                gas_spread_to( cur, n.second, n.first );
+                gas_spread_to( cur, p, n.second, n.first );
             }
         }
     } else if( p.z < OVERMAP_HEIGHT ) {
         const tripoint up{ p.xy(), p.z + 1 };
         maptile up_tile = maptile_at_internal( up );
         if( gas_can_spread_to( cur, up_tile ) && valid_move( p, up, true, true ) ) {
-            gas_spread_to( cur, up_tile, up );
+            gas_spread_to( cur, p, up_tile, up );
         }
     }
 }
@@ -433,13 +463,21 @@ void map::process_fields_in_submap( submap *const current_submap,
     // Loop through all tiles in this submap indicated by current_submap
     for( locx = 0; locx < SEEX; locx++ ) {
         for( locy = 0; locy < SEEY; locy++ ) {
+            // Only look at tiles that may hold fields. This is re-checked for every tile rather
+            // than taken as a snapshot, so fields spreading to tiles further along in this
+            // submap are still visited this turn, just like before the index existed.
+            const point local( locx, locy );
+            if( !current_submap->may_have_field( local ) ) {
+                continue;
+            }
             // Get a reference to the field variable from the submap;
             // contains all the pointers to the real field effects.
-            field &curfield = current_submap->get_field( {static_cast<int>( locx ), static_cast<int>( locy )} );
+            field &curfield = current_submap->get_field( local );
 
             // when displayed_field_type == fd_null it means that `curfield` has no fields inside
             // avoids instantiating (relatively) expensive map iterator
             if( !curfield.displayed_field_type() ) {
+                current_submap->clear_field_tile( local );
                 continue;
             }
 
@@ -482,6 +520,9 @@ void map::process_fields_in_submap( submap *const current_submap,
                 }
                 it++;
             }
+            if( curfield.field_count() == 0 ) {
+                current_submap->clear_field_tile( local );
+            }
         }
     }
     sblk.commit_modifications();
@@ -973,14 +1014,24 @@ void field_processor_fd_fire( const tripoint &p, field_entry &cur, field_proc_da
             // `item::burn` modifies the charges in order to simulate some of them getting
             // destroyed by the fire, this changes the item weight, but may not actually
             // destroy it. We need to spawn products anyway.
-            const units::mass old_weight = fuel->weight( false );
+            // Other items only change weight when destroyed, so skip weighing them twice
+            // every turn they smolder.
+            const bool burn_changes_weight = fuel->count_by_charges() || fuel->is_corpse();
+            const units::mass old_weight = burn_changes_weight ? fuel->weight( false ) : 0_gram;
             bool destroyed = fuel->burn( frd );
-            // If the item is considered destroyed, it may have negative charge count,
-            // see `item::burn?. This in turn means `item::weight` returns a negative value,
-            // which we can not use, so only call `weight` when it's still an existing item.
-            const units::mass new_weight = destroyed ? 0_gram : fuel->weight( false );
-            if( old_weight != new_weight ) {
-                here.create_burnproducts( p, *fuel, old_weight - new_weight );
+            if( burn_changes_weight ) {
+                // If the item is considered destroyed, it may have negative charge count,
+                // see `item::burn?. This in turn means `item::weight` returns a negative value,
+                // which we can not use, so only call `weight` when it's still an existing item.
+                const units::mass new_weight = destroyed ? 0_gram : fuel->weight( false );
+                if( old_weight != new_weight ) {
+                    here.create_burnproducts( p, *fuel, old_weight - new_weight );
+                }
+            } else if( destroyed ) {
+                const units::mass burnt_weight = fuel->weight( false );
+                if( burnt_weight != 0_gram ) {
+                    here.create_burnproducts( p, *fuel, burnt_weight );
+                }
             }
 
             if( destroyed ) {
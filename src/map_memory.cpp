@@ -1,3 +1,23 @@
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#else
+#   include <thread>
+#endif
+
+#include "background_file_writer.h"
 #include "cata_assert.h"
 #include "cached_options.h"
 #include "cata_utility.h"
@@ -5,11 +25,12 @@
 #include "cuboid_rectangle.h"
 #include "debug.h"
 #include "filesystem.h"
+#include "json_loader.h"
 #include "line.h"
+#include "memory_accounting.h"
 #include "map_memory.h"
 #include "path_info.h"
 #include "string_formatter.h"
-#include "translations.h"
 
 const memorized_tile mm_submap::default_tile = {};
 
@@ -40,6 +61,34 @@ struct reg_coord_pair {
     }
 };
 
+namespace
+{
+// Map memory holds hundreds of thousands of tiles but only a few hundred distinct decoration
+// ids, so each id is stored once here and tiles only keep its index.  Index 0 is the empty id.
+struct dec_id_table {
+    // a deque, so references handed out by memorized_tile::get_dec_id stay valid
+    std::deque<std::string> ids{ std::string() };
+    std::map<std::string, uint32_t, std::less<>> index{ { std::string(), 0 } };
+
+    uint32_t intern( const std::string_view id ) {
+        const auto it = index.find( id );
+        if( it != index.end() ) {
+            return it->second;
+        }
+        const uint32_t idx = ids.size();
+        ids.emplace_back( id );
+        index.emplace( ids.back(), idx );
+        return idx;
+    }
+};
+} // namespace
+
+static dec_id_table &get_dec_id_table()
+{
+    static dec_id_table table;
+    return table;
+}
+
 mm_submap::mm_submap( bool make_valid ) : valid( make_valid ) {}
 
 bool mm_submap::is_empty() const
@@ -52,6 +101,21 @@ bool mm_submap::is_valid() const
     return valid;
 }
 
+std::size_t mm_submap::memory_usage() const
+{
+    return sizeof( mm_submap ) + tiles.capacity() * sizeof( memorized_tile );
+}
+
+bool mm_submap::is_dirty() const
+{
+    return dirty;
+}
+
+void mm_submap::mark_saved()
+{
+    dirty = false;
+}
+
 const memorized_tile &mm_submap::get_tile( const point_sm_ms &p ) const
 {
     if( tiles.empty() ) {
@@ -67,7 +131,11 @@ void mm_submap::set_tile( const point_sm_ms &p, const memorized_tile &value )
         tiles.reserve( SEEX * SEEY );
         tiles.resize( SEEX * SEEY, default_tile );
     }
-    tiles[p.y() * SEEX + p.x()] = value;
+    memorized_tile &tile = tiles[p.y() * SEEX + p.x()];
+    if( !( tile == value ) ) {
+        tile = value;
+        dirty = true;
+    }
 }
 
 mm_region::mm_region() : submaps( nullptr ) {}
@@ -85,6 +153,21 @@ bool mm_region::is_empty() const
     return true;
 }
 
+bool mm_region::is_dirty() const
+{
+    return std::any_of( submaps.begin(), submaps.end(),
+    []( const shared_ptr_fast<mm_submap> &sm ) {
+        return sm->is_dirty();
+    } );
+}
+
+void mm_region::mark_saved()
+{
+    for( const shared_ptr_fast<mm_submap> &sm : submaps ) {
+        sm->mark_saved();
+    }
+}
+
 const std::string &memorized_tile::get_ter_id() const
 {
     return ter_id.str();
@@ -92,7 +175,7 @@ const std::string &memorized_tile::get_ter_id() const
 
 const std::string &memorized_tile::get_dec_id() const
 {
-    return dec_id;
+    return get_dec_id_table().ids[dec_id];
 }
 
 void memorized_tile::set_ter_id( const std::string_view id )
@@ -102,7 +185,7 @@ void memorized_tile::set_ter_id( const std::string_view id )
 
 void memorized_tile::set_dec_id( const std::string_view id )
 {
-    dec_id = id;
+    dec_id = get_dec_id_table().intern( id );
 }
 
 int memorized_tile::get_ter_rotation() const
@@ -183,11 +266,135 @@ map_memory::coord_pair::coord_pair( const tripoint_abs_ms &p )
     sm = tripoint_abs_sm( pp.x, pp.y, p.z() );
 }
 
-map_memory::map_memory()
+// Reads a whole file without reporting errors through the UI, so it is safe on the prefetch thread.
+// @returns nullopt if the file does not exist.
+static std::optional<std::string> read_region_file( const fs::path &path )
+{
+    if( !file_exist( path ) ) {
+        return std::nullopt;
+    }
+    std::ifstream fin( path, std::ios::binary );
+    if( !fin ) {
+        throw std::runtime_error( "opening file failed" );
+    }
+    std::string contents( ( std::istreambuf_iterator<char>( fin ) ),
+                          std::istreambuf_iterator<char>() );
+    if( fin.bad() ) {
+        throw std::runtime_error( "reading file failed" );
+    }
+    return contents;
+}
+
+/**
+ * Reads memory regions from disk on a background thread before the view gets to them.
+ * Only the raw file contents are read there, deserializing interns ids and is left to the
+ * main thread in map_memory::load_submap.
+ */
+struct map_memory::prefetcher {
+    // Don't keep too many regions around if they end up unused
+    static constexpr size_t max_ready = 64;
+
+    std::thread reader;
+    std::mutex mut;
+    std::condition_variable requested;
+    std::deque<std::pair<tripoint, cata_path>> queue;
+    std::set<tripoint> pending;
+    // nullopt for regions that were never saved
+    std::map<tripoint, std::optional<std::string>> ready;
+    // Bumped whenever the files on disk change, so reads started before that are dropped
+    unsigned int generation = 0;
+    bool stopping = false;
+
+    ~prefetcher() {
+        {
+            std::lock_guard<std::mutex> lock( mut );
+            stopping = true;
+        }
+        requested.notify_all();
+        if( reader.joinable() ) {
+            reader.join();
+        }
+    }
+
+    void request( const tripoint &reg, const cata_path &path ) {
+        {
+            std::lock_guard<std::mutex> lock( mut );
+            if( ready.count( reg ) != 0 || !pending.insert( reg ).second ) {
+                return;
+            }
+            queue.emplace_back( reg, path );
+            if( !reader.joinable() ) {
+                reader = std::thread( &prefetcher::reader_loop, this );
+            }
+        }
+        requested.notify_one();
+    }
+
+    // @returns true and sets @p contents if the region has been read ahead.
+    bool take( const tripoint &reg, std::optional<std::string> &contents ) {
+        std::lock_guard<std::mutex> lock( mut );
+        const auto it = ready.find( reg );
+        if( it == ready.end() ) {
+            return false;
+        }
+        contents = std::move( it->second );
+        ready.erase( it );
+        return true;
+    }
+
+    void invalidate() {
+        std::lock_guard<std::mutex> lock( mut );
+        ++generation;
+        queue.clear();
+        pending.clear();
+        ready.clear();
+    }
+
+    void reader_loop() {
+        std::unique_lock<std::mutex> lock( mut );
+        while( true ) {
+            requested.wait( lock, [this] {
+                return stopping || !queue.empty();
+            } );
+            if( stopping ) {
+                return;
+            }
+            const std::pair<tripoint, cata_path> job = queue.front();
+            queue.pop_front();
+            const unsigned int started = generation;
+            lock.unlock();
+
+            std::optional<std::string> contents;
+            bool ok = true;
+            try {
+                contents = read_region_file( job.second.get_unrelative_path() );
+            } catch( const std::exception & ) {
+                // Let the main thread run into the error again and report it
+                ok = false;
+            }
+
+            lock.lock();
+            if( started != generation ) {
+                continue;
+            }
+            pending.erase( job.first );
+            if( ok ) {
+                if( ready.size() >= max_ready ) {
+                    ready.clear();
+                }
+                ready.emplace( job.first, std::move( contents ) );
+            }
+        }
+    }
+};
+
+map_memory::map_memory() : prefetch_state( std::make_unique<prefetcher>() )
 {
     clear_cache();
 }
 
+map_memory::~map_memory() = default;
+
 const memorized_tile &map_memory::get_tile( const tripoint_abs_ms &pos ) const
 {
     const coord_pair p( pos );
@@ -291,9 +498,34 @@ bool map_memory::prepare_region( const tripoint_abs_ms &p1, const tripoint_abs_m
             }
         }
     }
+    prefetch_around_cache();
     return true;
 }
 
+void map_memory::prefetch_around_cache()
+{
+    if( test_mode || !get_background_file_writer().idle() ) {
+        // Nothing to read, or the files may be about to change
+        return;
+    }
+    const cata_path dirname = find_mm_dir();
+    // One region beyond the cached area on every side, so that moving the view or walking
+    // across a region border finds the next regions already read
+    const tripoint_abs_sm from = cache_pos - tripoint_rel_sm( MM_REG_SIZE, MM_REG_SIZE, 0 );
+    const tripoint_abs_sm to = cache_pos + tripoint_rel_sm( cache_size.x + MM_REG_SIZE,
+                               cache_size.y + MM_REG_SIZE, 0 );
+    const tripoint reg_from = reg_coord_pair( from ).reg;
+    const tripoint reg_to = reg_coord_pair( to ).reg;
+    for( int y = reg_from.y; y <= reg_to.y; y++ ) {
+        for( int x = reg_from.x; x <= reg_to.x; x++ ) {
+            const tripoint reg( x, y, cache_pos.z() );
+            if( submaps.count( tripoint_abs_sm( mmr_to_sm_copy( reg ) ) ) == 0 ) {
+                prefetch_state->request( reg, find_region_path( dirname, reg ) );
+            }
+        }
+    }
+}
+
 shared_ptr_fast<mm_submap> map_memory::fetch_submap( const tripoint_abs_sm &sm_pos )
 {
     shared_ptr_fast<mm_submap> sm = find_submap( sm_pos );
@@ -350,15 +582,18 @@ shared_ptr_fast<mm_submap> map_memory::load_submap( const tripoint_abs_sm &sm_po
     const cata_path path = find_region_path( find_mm_dir(), p.reg );
 
     mm_region mmr;
-    const auto loader = [&mmr]( const JsonValue & jsin ) {
-        mmr.deserialize( jsin );
-    };
-
     try {
-        if( !read_from_file_optional_json( path, loader ) ) {
+        std::optional<std::string> contents;
+        if( !prefetch_state->take( p.reg, contents ) ) {
+            // The region may still be waiting to be written out by a save
+            get_background_file_writer().flush( path );
+            contents = read_region_file( path.get_unrelative_path() );
+        }
+        if( !contents ) {
             // Region not found
             return nullptr;
         }
+        mmr.deserialize( json_loader::from_string( *contents ) );
     } catch( const std::exception &err ) {
         debugmsg( "Failed to load memory map region (%d,%d,%d): %s",
                   p.reg.x, p.reg.y, p.reg.z, err.what() );
@@ -411,6 +646,17 @@ bool map_memory::is_valid() const
     return cache_pos != invalid_cache_pos;
 }
 
+memory_accounting::usage map_memory::memory_usage() const
+{
+    memory_accounting::usage ret;
+    // The region cache only points into the same submaps
+    for( const auto &entry : submaps ) {
+        ++ret.count;
+        ret.bytes += entry.second->memory_usage();
+    }
+    return ret;
+}
+
 void map_memory::load( const tripoint_abs_ms &pos )
 {
     const coord_pair p( pos );
@@ -433,6 +679,8 @@ bool map_memory::save( const tripoint_abs_ms &pos )
     assure_dir_exist( dirname );
 
     clear_cache();
+    // The region files are about to change
+    prefetch_state->invalidate();
 
     dbg( D_INFO ) << "N submaps before save: " << submaps.size();
 
@@ -451,27 +699,19 @@ bool map_memory::save( const tripoint_abs_ms &pos )
     dbg( D_INFO ) << "[SAVE] Saving memory map around " << sm_center << ". Keeping submaps within " <<
                   rect_keep.p_min << "->" << rect_keep.p_max;
 
-    bool result = true;
-
     for( auto &it : regions ) {
         const tripoint &regp = it.first;
         mm_region &reg = it.second;
-        if( !reg.is_empty() ) {
+        // Regions that didn't change are already on disk as they are
+        if( reg.is_dirty() && !reg.is_empty() ) {
             const cata_path path = find_region_path( dirname, regp );
-            const std::string descr = string_format(
-                                          _( "memory map region for (%d,%d,%d)" ),
-                                          regp.x, regp.y, regp.z
-                                      );
-
-            const auto writer = [&]( std::ostream & fout ) -> void {
-                fout << serialize_wrapper( [&]( JsonOut & jsout )
-                {
-                    reg.serialize( jsout );
-                } );
-            };
-
-            const bool res = write_to_file( path, writer, descr.c_str() );
-            result = result & res;
+
+            // Serialized here, only the finished file is written in the background.
+            // Failures are reported by the writer.
+            get_background_file_writer().write( path, serialize_wrapper( [&]( JsonOut & jsout ) {
+                reg.serialize( jsout );
+            } ) );
+            reg.mark_saved();
         }
         const tripoint_abs_sm regp_sm( mmr_to_sm_copy( regp ) );
         const half_open_rectangle<point_abs_sm> rect_reg(
@@ -496,7 +736,7 @@ bool map_memory::save( const tripoint_abs_ms &pos )
     dbg( D_INFO ) << "[SAVE] Done.";
     dbg( D_INFO ) << "N submaps after save: " << submaps.size();
 
-    return result;
+    return true;
 }
 
 void map_memory::clear_cache()
@@ -2,17 +2,28 @@
 #ifndef CATA_SRC_MAP_MEMORY_H
 #define CATA_SRC_MAP_MEMORY_H
 
+#include <cstdint>
 #include <iosfwd>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "game_constants.h"
 #include "mdarray.h"
 #include "memory_fast.h"
 #include "point.h" // IWYU pragma: keep
 
+class JsonArray;
 class JsonObject;
 class JsonOut;
 class JsonValue;
 
+namespace memory_accounting
+{
+struct usage;
+} // namespace memory_accounting
+
 struct ter_t;
 using ter_str_id = string_id<ter_t>;
 
@@ -43,13 +54,27 @@ class memorized_tile
     private:
         friend struct mm_submap; // serialization needs access to private members
         ter_str_id ter_id;       // terrain tile id
-        std::string dec_id;      // decoration tile id (furniture, vparts ...)
+        uint32_t dec_id = 0;     // interned decoration tile id (furniture, vparts ...)
         int8_t ter_rotation = 0;
         int8_t dec_rotation = 0;
         int8_t ter_subtile = 0;
         int8_t dec_subtile = 0;
 };
 
+/**
+ * Id dictionary of a saved mm_region: every terrain and decoration id is
+ * written once per region and the tiles refer to it by index.
+ */
+struct mm_id_dictionary {
+    std::vector<std::string> ids;
+    std::unordered_map<std::string, int> index;
+
+    /** @returns index of @p id, adding it to the dictionary if needed. */
+    int encode( const std::string &id );
+    /** @returns id stored at index @p idx, throws on indices not in the dictionary. */
+    const std::string &decode( const JsonArray &ja, int idx ) const;
+};
+
 /** Represent a submap-sized chunk of tile memory. */
 struct mm_submap {
     public:
@@ -62,18 +87,25 @@ struct mm_submap {
         bool is_empty() const;
         // @returns true if mm_submap is valid, i.e. not returned from an uninitialized region.
         bool is_valid() const;
+        // @returns estimated bytes held by this submap, see memory_accounting.h
+        std::size_t memory_usage() const;
+        // @returns true if tiles changed since the submap was loaded or last saved.
+        bool is_dirty() const;
+        void mark_saved();
 
         const memorized_tile &get_tile( const point_sm_ms &p ) const;
         void set_tile( const point_sm_ms &p, const memorized_tile &value );
 
-        void serialize( JsonOut &jsout ) const;
-        void deserialize( int version, const JsonArray &ja );
+        void serialize( JsonOut &jsout, mm_id_dictionary &dict ) const;
+        void deserialize( int version, const JsonArray &ja, const mm_id_dictionary &dict );
 
     private:
         // NOLINTNEXTLINE(cata-serialize)
         std::vector<memorized_tile> tiles; // holds either 0 or SEEX*SEEY elements
         // NOLINTNEXTLINE(cata-serialize)
         bool valid = true;
+        // NOLINTNEXTLINE(cata-serialize)
+        bool dirty = false;
 };
 
 /**
@@ -87,6 +119,9 @@ struct mm_region {
     mm_region();
 
     bool is_empty() const;
+    // @returns true if any of the submaps changed since it was loaded or last saved.
+    bool is_dirty() const;
+    void mark_saved();
 
     void serialize( JsonOut &jsout ) const;
     void deserialize( const JsonValue &ja );
@@ -111,14 +146,21 @@ class map_memory
 
     public:
         map_memory();
+        ~map_memory();
 
         // @returns true if map memory has been loaded
         bool is_valid() const;
 
+        /** Loaded submaps and an estimate of their size, see memory_accounting.h. */
+        memory_accounting::usage memory_usage() const;
+
         /** Load memorized submaps around given global map square pos. */
         void load( const tripoint_abs_ms &pos );
 
-        /** Save memorized submaps to disk, drop ones far from given global map square pos. */
+        /**
+         * Save memorized submaps to disk, drop ones far from given global map square pos.
+         * The files are written by the background file writer.
+         */
         bool save( const tripoint_abs_ms &pos );
 
         /**
@@ -170,6 +212,11 @@ class map_memory
         tripoint_abs_sm cache_pos;
         point cache_size;
 
+        struct prefetcher;
+        std::unique_ptr<prefetcher> prefetch_state;
+        /** Starts reading the regions around the cached area from disk in the background. */
+        void prefetch_around_cache();
+
         /** Find, load or allocate a submap. @returns the submap. */
         shared_ptr_fast<mm_submap> fetch_submap( const tripoint_abs_sm &sm_pos );
         /** Find submap amongst the loaded submaps. @returns nullptr if failed. */
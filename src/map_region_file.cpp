@@ -0,0 +1,136 @@
+#include "map_region_file.h"
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+
+#include "cata_assert.h"
+#include "filesystem.h"
+#include "mmap_file.h"
+
+static constexpr std::string_view region_header = "CDDA MR1";
+// offset and size of each quad
+static constexpr size_t index_entry_size = 2 * sizeof( uint64_t );
+static constexpr size_t data_start = region_header.size() + SEG_SIZE * SEG_SIZE * index_entry_size;
+
+static void write_u64( std::string &out, uint64_t value )
+{
+    for( int i = 0; i < 8; ++i ) {
+        out.push_back( static_cast<char>( ( value >> ( 8 * i ) ) & 0xff ) );
+    }
+}
+
+static uint64_t read_u64( const uint8_t *p )
+{
+    uint64_t value = 0;
+    for( int i = 0; i < 8; ++i ) {
+        value |= static_cast<uint64_t>( p[i] ) << ( 8 * i );
+    }
+    return value;
+}
+
+static std::shared_ptr<mmap_file> map_region( const fs::path &path )
+{
+    if( !file_exist( path ) ) {
+        return nullptr;
+    }
+    std::shared_ptr<mmap_file> file = mmap_file::map_file( path );
+    if( !file ) {
+        throw std::runtime_error( "Failed to mmap " + path.generic_u8string() );
+    }
+    if( file->len < data_start ||
+        std::string_view( reinterpret_cast<const char *>( file->base ),
+                          region_header.size() ) != region_header ) {
+        throw std::runtime_error( path.generic_u8string() + " is not a map region file" );
+    }
+    return file;
+}
+
+// @returns the data of the quad with the given index, nullopt if it is not stored.
+static std::optional<std::string> quad_from_region( const mmap_file &file, const fs::path &path,
+        size_t idx )
+{
+    const uint8_t *entry = file.base + region_header.size() + idx * index_entry_size;
+    const uint64_t offset = read_u64( entry );
+    const uint64_t size = read_u64( entry + sizeof( uint64_t ) );
+    if( size == 0 ) {
+        return std::nullopt;
+    }
+    if( offset < data_start || offset > file.len || size > file.len - offset ) {
+        throw std::runtime_error( "corrupt index in map region file " + path.generic_u8string() );
+    }
+    return std::string( reinterpret_cast<const char *>( file.base + offset ), size );
+}
+
+size_t map_region_file::index_of( const point &local )
+{
+    cata_assert( local.x >= 0 && local.x < SEG_SIZE && local.y >= 0 && local.y < SEG_SIZE );
+    return static_cast<size_t>( local.y ) * SEG_SIZE + local.x;
+}
+
+map_region_file map_region_file::load( const fs::path &path )
+{
+    map_region_file region;
+    const std::shared_ptr<mmap_file> file = map_region( path );
+    if( file ) {
+        for( size_t i = 0; i < region.quads.size(); ++i ) {
+            region.quads[i] = quad_from_region( *file, path, i );
+        }
+    }
+    return region;
+}
+
+std::optional<std::string> map_region_file::read_quad( const fs::path &path, const point &local )
+{
+    const std::shared_ptr<mmap_file> file = map_region( path );
+    if( !file ) {
+        return std::nullopt;
+    }
+    return quad_from_region( *file, path, index_of( local ) );
+}
+
+void map_region_file::set_quad( const point &local, std::string data )
+{
+    quads[index_of( local )] = std::move( data );
+}
+
+void map_region_file::remove_quad( const point &local )
+{
+    quads[index_of( local )].reset();
+}
+
+bool map_region_file::empty() const
+{
+    for( const std::optional<std::string> &quad : quads ) {
+        if( quad ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string map_region_file::serialize() const
+{
+    size_t total = data_start;
+    for( const std::optional<std::string> &quad : quads ) {
+        total += quad ? quad->size() : 0;
+    }
+
+    std::string out;
+    out.reserve( total );
+    out.append( region_header );
+    uint64_t offset = data_start;
+    for( const std::optional<std::string> &quad : quads ) {
+        const uint64_t size = quad ? quad->size() : 0;
+        write_u64( out, size ? offset : 0 );
+        write_u64( out, size );
+        offset += size;
+    }
+    for( const std::optional<std::string> &quad : quads ) {
+        if( quad ) {
+            out.append( *quad );
+        }
+    }
+    return out;
+}
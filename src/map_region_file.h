@@ -0,0 +1,55 @@
+#pragma once
+#ifndef CATA_SRC_MAP_REGION_FILE_H
+#define CATA_SRC_MAP_REGION_FILE_H
+
+#include <array>
+#include <optional>
+#include <string>
+
+#include "game_constants.h"
+#include "point.h"
+
+#include <ghc/fs_std_fwd.hpp>
+
+/**
+ * Packs the saved map quads of one map segment (SEG_SIZE x SEG_SIZE overmap
+ * terrains on one z-level) into a single file instead of one file per quad.
+ *
+ * The file starts with a short header, followed by an index holding the
+ * offset and size of every quad (little endian uint64 each, size zero for
+ * missing quads) and then the quad data itself. The data of a quad is exactly
+ * what would otherwise have been written to its own file, so it may be json
+ * or binary.
+ */
+class map_region_file
+{
+    public:
+        map_region_file() = default;
+
+        /**
+         * Loads all quads of the file at @p path. A missing file gives an empty region.
+         * Throws on files that are not region files.
+         */
+        static map_region_file load( const fs::path &path );
+
+        /**
+         * Reads a single quad from the file at @p path without loading the rest.
+         * @param local position of the quad within the segment, in overmap terrains.
+         * @returns nullopt if the file or the quad does not exist. Throws on corrupt files.
+         */
+        static std::optional<std::string> read_quad( const fs::path &path, const point &local );
+
+        void set_quad( const point &local, std::string data );
+        void remove_quad( const point &local );
+        bool empty() const;
+
+        /** @returns the contents of the file to write. */
+        std::string serialize() const;
+
+    private:
+        static size_t index_of( const point &local );
+
+        std::array<std::optional<std::string>, SEG_SIZE * SEG_SIZE> quads;
+};
+
+#endif // CATA_SRC_MAP_REGION_FILE_H
@@ -1,20 +1,42 @@
 #include "mapbuffer.h"
 
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
 #include <exception>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#else
+#   include <thread>
+#endif
+
+#include "background_file_writer.h"
 #include "cata_utility.h"
 #include "debug.h"
 #include "filesystem.h"
+#include "flexbuffer_cache.h"
 #include "input.h"
 #include "json.h"
+#include "json_loader.h"
 #include "map.h"
+#include "map_region_file.h"
+#include "mapgen_queue.h"
+#include "options.h"
 #include "output.h"
 #include "overmapbuffer.h"
 #include "path_info.h"
@@ -32,6 +54,9 @@ extern std::unique_ptr<game> g;
 // NOLINTNEXTLINE(cata-static-declarations)
 extern const int savegame_version;
 
+// Binary quads start with this, so they can be told apart from json ones when loading.
+static constexpr std::string_view binary_quad_header = "CDDA FB1";
+
 static cata_path find_quad_path( const cata_path &dirname, const tripoint_abs_omt &om_addr )
 {
     return dirname / string_format( "%d.%d.%d.map", om_addr.x(), om_addr.y(), om_addr.z() );
@@ -45,14 +70,228 @@ static cata_path find_dirname( const tripoint_abs_omt &om_addr )
             segment_addr.y(), segment_addr.z() );
 }
 
+static cata_path find_segment_dirname( const tripoint_abs_seg &segment_addr )
+{
+    return PATH_INFO::world_base_save_path_path() / "maps" / string_format( "%d.%d.%d",
+            segment_addr.x(), segment_addr.y(), segment_addr.z() );
+}
+
+static cata_path find_region_path( const tripoint_abs_seg &segment_addr )
+{
+    return PATH_INFO::world_base_save_path_path() / "maps" / string_format( "%d.%d.%d.mapr",
+            segment_addr.x(), segment_addr.y(), segment_addr.z() );
+}
+
+// Position of the quad within its segment, as used by map_region_file.
+static point quad_in_segment( const tripoint_abs_omt &om_addr )
+{
+    const tripoint_abs_seg segment_addr = project_to<coords::seg>( om_addr );
+    return om_addr.xy().raw() - project_to<coords::omt>( segment_addr.xy() ).raw();
+}
+
+// Stores the quad as its FlexBuffer with a small header, so loading it skips json parsing.
+static std::string quad_to_binary( std::string json )
+{
+    const std::shared_ptr<parsed_flexbuffer> fb = flexbuffer_cache::parse_buffer( std::move( json ) );
+    const std::shared_ptr<flexbuffer_storage> &storage = fb->get_storage();
+    std::string ret( binary_quad_header );
+    ret.append( reinterpret_cast<const char *>( storage->data() ), storage->size() );
+    return ret;
+}
+
+// Parses quad data in either format, as read from a region file or a quad file at @p path.
+// The data may be compressed.
+static JsonValue parse_quad( const std::string &contents, const cata_path &path )
+{
+    if( is_gzip( contents ) ) {
+        return parse_quad( gzip_decompress( contents ), path );
+    }
+    if( !string_starts_with( contents, binary_quad_header ) ) {
+        return json_loader::from_string( contents );
+    }
+    std::vector<uint8_t> fb( contents.begin() + binary_quad_header.size(), contents.end() );
+    return json_loader::from_binary( std::move( fb ), path );
+}
+
+// Reads a whole file without reporting errors through the UI, so it is safe on the prefetch thread.
+// @returns nullopt if the file does not exist.
+static std::optional<std::string> read_file_contents( const fs::path &path )
+{
+    if( !file_exist( path ) ) {
+        return std::nullopt;
+    }
+    std::ifstream fin( path, std::ios::binary );
+    if( !fin ) {
+        throw std::runtime_error( "opening file failed" );
+    }
+    std::string contents( ( std::istreambuf_iterator<char>( fin ) ), std::istreambuf_iterator<char>() );
+    if( fin.bad() ) {
+        throw std::runtime_error( "reading file failed" );
+    }
+    return contents;
+}
+
+// Data of a saved quad, and the file it came from.
+struct quad_data {
+    std::string contents;
+    cata_path path;
+};
+
+// Reads the saved data of a quad from its region file or its own file, whichever has it.
+// @returns nullopt if the quad was never saved. Throws on errors, but never calls into the UI.
+static std::optional<quad_data> read_quad_data( const tripoint_abs_omt &om_addr )
+{
+    const cata_path region_path = find_region_path( project_to<coords::seg>( om_addr ) );
+    if( std::optional<std::string> packed = map_region_file::read_quad(
+            region_path.get_unrelative_path(), quad_in_segment( om_addr ) ) ) {
+        return quad_data{ std::move( *packed ), region_path };
+    }
+
+    const cata_path dirname = find_dirname( om_addr );
+    cata_path quad_path = find_quad_path( dirname, om_addr );
+    if( !file_exist( quad_path ) ) {
+        // Fix for old saves where the path was generated using std::stringstream, which
+        // did format the number using the current locale. That formatting may insert
+        // thousands separators, so the resulting path is "map/1,234.7.8.map" instead
+        // of "map/1234.7.8.map".
+        std::ostringstream buffer;
+        buffer << om_addr.x() << "." << om_addr.y() << "." << om_addr.z()
+               << ".map";
+        cata_path legacy_quad_path = dirname / buffer.str();
+        if( file_exist( legacy_quad_path ) ) {
+            quad_path = std::move( legacy_quad_path );
+        }
+    }
+    if( std::optional<std::string> contents = read_file_contents( quad_path.get_unrelative_path() ) ) {
+        return quad_data{ std::move( *contents ), quad_path };
+    }
+    return std::nullopt;
+}
+
+/**
+ * Reads quads from disk on a background thread ahead of their use. Only the raw file
+ * contents are read there, deserializing them touches game state and is left
+ * to the main thread in mapbuffer::unserialize_submaps.
+ */
+struct mapbuffer::prefetcher {
+    // Don't keep too many quads around if they end up unused (e.g. the vehicle turned).
+    static constexpr size_t max_ready = 256;
+
+    std::thread reader;
+    std::mutex mut;
+    std::condition_variable requested;
+    std::deque<tripoint_abs_omt> queue;
+    std::set<tripoint_abs_omt> pending;
+    // nullopt for quads that were never saved
+    std::map<tripoint_abs_omt, std::optional<quad_data>> ready;
+    // Bumped whenever the files on disk change, so reads started before that are dropped.
+    unsigned int generation = 0;
+    bool stopping = false;
+
+    ~prefetcher() {
+        {
+            std::lock_guard<std::mutex> lock( mut );
+            stopping = true;
+        }
+        requested.notify_all();
+        if( reader.joinable() ) {
+            reader.join();
+        }
+    }
+
+    void request( const tripoint_abs_omt &om_addr ) {
+        {
+            std::lock_guard<std::mutex> lock( mut );
+            if( ready.count( om_addr ) != 0 || !pending.insert( om_addr ).second ) {
+                return;
+            }
+            queue.push_back( om_addr );
+            if( !reader.joinable() ) {
+                reader = std::thread( &prefetcher::reader_loop, this );
+            }
+        }
+        requested.notify_one();
+    }
+
+    // @returns true and sets @p data if the quad has been read ahead.
+    bool take( const tripoint_abs_omt &om_addr, std::optional<quad_data> &data ) {
+        std::lock_guard<std::mutex> lock( mut );
+        const auto it = ready.find( om_addr );
+        if( it == ready.end() ) {
+            return false;
+        }
+        data = std::move( it->second );
+        ready.erase( it );
+        return true;
+    }
+
+    void invalidate() {
+        std::lock_guard<std::mutex> lock( mut );
+        ++generation;
+        queue.clear();
+        pending.clear();
+        ready.clear();
+    }
+
+    void reader_loop() {
+        std::unique_lock<std::mutex> lock( mut );
+        while( true ) {
+            requested.wait( lock, [this] {
+                return stopping || !queue.empty();
+            } );
+            if( stopping ) {
+                return;
+            }
+            const tripoint_abs_omt om_addr = queue.front();
+            queue.pop_front();
+            const unsigned int started = generation;
+            lock.unlock();
+
+            std::optional<quad_data> data;
+            bool ok = true;
+            try {
+                data = read_quad_data( om_addr );
+            } catch( const std::exception & ) {
+                // Let the main thread run into the error again and report it.
+                ok = false;
+            }
+
+            lock.lock();
+            if( started != generation ) {
+                continue;
+            }
+            pending.erase( om_addr );
+            if( ok ) {
+                if( ready.size() >= max_ready ) {
+                    ready.clear();
+                }
+                ready.emplace( om_addr, std::move( data ) );
+            }
+        }
+    }
+};
+
 mapbuffer MAPBUFFER;
 
-mapbuffer::mapbuffer() = default;
+mapbuffer::mapbuffer() : prefetch_state( std::make_unique<prefetcher>() ) {}
 mapbuffer::~mapbuffer() = default;
 
+void mapbuffer::prefetch( const tripoint_abs_sm &p )
+{
+    if( submaps.count( p ) != 0 || !get_background_file_writer().idle() ) {
+        // Nothing to do, or the files may be about to change.
+        return;
+    }
+    prefetch_state->request( project_to<coords::omt>( p ) );
+}
+
 void mapbuffer::clear()
 {
     submaps.clear();
+    last_used.clear();
+    stats = cache_stats();
+    prefetch_state->invalidate();
+    mapgen_queue::clear();
 }
 
 void mapbuffer::clear_outside_reality_bubble()
@@ -63,6 +302,7 @@ void mapbuffer::clear_outside_reality_bubble()
         if( here.inbounds( it->first ) ) {
             ++it;
         } else {
+            last_used.erase( project_to<coords::omt>( it->first ) );
             it = submaps.erase( it );
         }
     }
@@ -75,6 +315,7 @@ bool mapbuffer::add_submap( const tripoint_abs_sm &p, std::unique_ptr<submap> &s
     }
 
     submaps[p] = std::move( sm );
+    touch( p );
 
     return true;
 }
@@ -108,6 +349,7 @@ submap *mapbuffer::lookup_submap( const tripoint_abs_sm &p )
 
     const auto iter = submaps.find( p );
     if( iter == submaps.end() ) {
+        ++stats.misses;
         try {
             return unserialize_submaps( p );
         } catch( const std::exception &err ) {
@@ -116,15 +358,112 @@ submap *mapbuffer::lookup_submap( const tripoint_abs_sm &p )
         return nullptr;
     }
 
+    ++stats.hits;
+    touch( p );
     return iter->second.get();
 }
 
-void mapbuffer::save( bool delete_after_save )
+void mapbuffer::touch( const tripoint_abs_sm &p )
+{
+    last_used[project_to<coords::omt>( p )] = ++use_counter;
+}
+
+int mapbuffer::evict( const size_t budget_bytes, const bool in_background )
+{
+    size_t total_bytes = 0;
+    std::map<tripoint_abs_omt, size_t> quad_bytes;
+    for( const auto &elem : submaps ) {
+        const size_t bytes = sizeof( submap ) + elem.second->tile_memory_usage();
+        total_bytes += bytes;
+        quad_bytes[project_to<coords::omt>( elem.first )] += bytes;
+    }
+    if( total_bytes <= budget_bytes ) {
+        return 0;
+    }
+
+    // Least recently used first
+    map &here = get_map();
+    std::vector<std::pair<unsigned long long, tripoint_abs_omt>> candidates;
+    for( const auto &elem : quad_bytes ) {
+        if( !here.inbounds( elem.first ) ) {
+            candidates.emplace_back( last_used[elem.first], elem.first );
+        }
+    }
+    if( candidates.empty() ) {
+        return 0;
+    }
+    std::sort( candidates.begin(), candidates.end() );
+
+    save_settings settings;
+    settings.in_background = in_background;
+    settings.binary = get_option<std::string>( "SUBMAP_SAVE_FORMAT" ) == "binary";
+    settings.regions = get_option<bool>( "MAP_REGION_FILES" );
+    settings.compress = get_option<bool>( "COMPRESS_SAVES" );
+    region_changes regions;
+    std::list<tripoint_abs_sm> submaps_to_delete;
+    // Same as save(), so region files are merged with what is on disk
+    get_background_file_writer().flush();
+    prefetch_state->invalidate();
+    assure_dir_exist( PATH_INFO::world_base_save_path() + "/maps" );
+    int evicted = 0;
+    for( const auto &candidate : candidates ) {
+        if( total_bytes <= budget_bytes ) {
+            break;
+        }
+        const tripoint_abs_omt &om_addr = candidate.second;
+        const cata_path dirname = find_dirname( om_addr );
+        save_quad( dirname, find_quad_path( dirname, om_addr ), om_addr, submaps_to_delete,
+                   true, settings, regions );
+        for( const point &offset : {
+                 point_zero, point_south, point_east, point_south_east
+             } ) {
+            const tripoint_abs_sm sm_addr = project_to<coords::sm>( om_addr ) + offset;
+            if( submaps.count( sm_addr ) != 0 ) {
+                submaps_to_delete.push_back( sm_addr );
+            }
+        }
+        last_used.erase( om_addr );
+        total_bytes -= quad_bytes[om_addr];
+        ++evicted;
+    }
+    for( const auto &region : regions ) {
+        save_region( region.first, region.second, in_background );
+    }
+    // save_quad may have listed some of them already
+    submaps_to_delete.sort();
+    submaps_to_delete.unique();
+    for( const tripoint_abs_sm &sm_addr : submaps_to_delete ) {
+        remove_submap( sm_addr );
+    }
+    stats.evicted_quads += evicted;
+    return evicted;
+}
+
+void mapbuffer::evict_over_budget()
 {
+    const int budget_mib = get_option<int>( "MAP_MEMORY_BUDGET" );
+    if( budget_mib > 0 ) {
+        evict( static_cast<size_t>( budget_mib ) * 1024 * 1024,
+               get_option<bool>( "MAP_EVICT_IN_BACKGROUND" ) );
+    }
+}
+
+void mapbuffer::save( bool delete_after_save, bool in_background )
+{
+    // Finish any earlier background save first, so it can't overwrite the files written now
+    // and region files can be merged with what is on disk.
+    get_background_file_writer().flush();
+    prefetch_state->invalidate();
     assure_dir_exist( PATH_INFO::world_base_save_path() + "/maps" );
 
     int num_saved_submaps = 0;
     int num_total_submaps = submaps.size();
+    save_settings settings;
+    settings.in_background = in_background;
+    settings.binary = get_option<std::string>( "SUBMAP_SAVE_FORMAT" ) == "binary";
+    settings.regions = get_option<bool>( "MAP_REGION_FILES" );
+    settings.compress = get_option<bool>( "COMPRESS_SAVES" );
+    region_changes regions;
 
     map &here = get_map();
 
@@ -167,17 +506,22 @@ void mapbuffer::save( bool delete_after_save )
         // delete_on_save deletes everything, otherwise delete submaps
         // outside the current map.
         save_quad( dirname, quad_path, om_addr, submaps_to_delete,
-                   delete_after_save || !inside_reality_bubble );
+                   delete_after_save || !inside_reality_bubble, settings, regions );
         num_saved_submaps += 4;
     }
+    for( const auto &region : regions ) {
+        save_region( region.first, region.second, in_background );
+    }
     for( auto &elem : submaps_to_delete ) {
         remove_submap( elem );
+        last_used.erase( project_to<coords::omt>( elem ) );
     }
 }
 
 void mapbuffer::save_quad(
     const cata_path &dirname, const cata_path &filename, const tripoint_abs_omt &om_addr,
-    std::list<tripoint_abs_sm> &submaps_to_delete, bool delete_after_save )
+    std::list<tripoint_abs_sm> &submaps_to_delete, bool delete_after_save,
+    const save_settings &settings, region_changes &regions )
 {
     std::vector<point> offsets;
     std::vector<tripoint_abs_sm> submap_addrs;
@@ -186,16 +530,23 @@ void mapbuffer::save_quad(
     offsets.push_back( point_east );
     offsets.push_back( point_south_east );
 
+    // Once a segment has a region file all its quads go there, whatever the option says.
+    const tripoint_abs_seg segment_addr = project_to<coords::seg>( om_addr );
+    const bool use_region = settings.regions || regions.count( segment_addr ) != 0 ||
+                            file_exist( find_region_path( segment_addr ) );
+
     bool all_uniform = true;
     bool reverted_to_uniform = false;
-    bool const file_exists = fs::exists( filename.get_unrelative_path() );
+    bool all_pristine = true;
+    bool const file_exists = use_region || fs::exists( filename.get_unrelative_path() );
     for( point &offsets_offset : offsets ) {
         tripoint_abs_sm submap_addr = project_to<coords::sm>( om_addr );
         submap_addr += offsets_offset;
         submap_addrs.push_back( submap_addr );
         submap *sm = submaps[submap_addr].get();
+        all_pristine &= sm != nullptr && sm->pristine;
         if( sm != nullptr ) {
-            if( !sm->is_uniform() ) {
+            if( !sm->is_uniform() || sm->compacted ) {
                 all_uniform = false;
             } else if( sm->reverted ) {
                 reverted_to_uniform = file_exists;
@@ -213,6 +564,13 @@ void mapbuffer::save_quad(
             }
         }
 
+        if( use_region ) {
+            if( reverted_to_uniform ) {
+                regions[segment_addr][quad_in_segment( om_addr )] = std::nullopt;
+            }
+            return;
+        }
+
         // deleting the file might fail on some platforms in some edge cases so force serialize this
         // uniform quad
         if( !reverted_to_uniform ) {
@@ -220,11 +578,30 @@ void mapbuffer::save_quad(
         }
     }
 
-    // Don't create the directory if it would be empty
-    assure_dir_exist( dirname );
-    write_to_file( filename, [&]( std::ostream & fout ) {
-        JsonOut jsout( fout );
+    const auto write_quad = [&]( std::ostream & fout ) {
+        BufferedJsonOut jsout( fout );
         jsout.start_array();
+        if( all_pristine ) {
+            // Untouched since mapgen, so generating it again gives the same submaps
+            const submap *sm = submaps[submap_addrs.front()].get();
+            jsout.start_object();
+            jsout.member( "version", savegame_version );
+            jsout.member( "omt" );
+            jsout.start_array();
+            jsout.write( om_addr.x() );
+            jsout.write( om_addr.y() );
+            jsout.write( om_addr.z() );
+            jsout.end_array();
+            jsout.member( "mapgen_seed", sm->mapgen_seed );
+            jsout.member( "generated_at", sm->generated_at );
+            jsout.end_object();
+            jsout.end_array();
+            if( delete_after_save ) {
+                submaps_to_delete.insert( submaps_to_delete.end(), submap_addrs.begin(),
+                                          submap_addrs.end() );
+            }
+            return;
+        }
         for( auto &submap_addr : submap_addrs ) {
             if( submaps.count( submap_addr ) == 0 ) {
                 continue;
@@ -257,40 +634,147 @@ void mapbuffer::save_quad(
         }
 
         jsout.end_array();
-    } );
+    };
+
+    std::string contents;
+    if( settings.in_background || settings.binary || use_region ) {
+        std::ostringstream fout;
+        write_quad( fout );
+        contents = settings.binary ? quad_to_binary( fout.str() ) : fout.str();
+        if( settings.compress ) {
+            contents = gzip_compress( contents );
+        }
+    }
+
+    if( use_region ) {
+        regions[segment_addr][quad_in_segment( om_addr )] = std::move( contents );
+        return;
+    }
+
+    // Don't create the directory if it would be empty
+    assure_dir_exist( dirname );
+    if( settings.in_background ) {
+        get_background_file_writer().write( filename, std::move( contents ) );
+        if( all_uniform && reverted_to_uniform ) {
+            get_background_file_writer().remove( filename );
+        }
+        return;
+    }
+
+    if( settings.binary ) {
+        write_to_file( filename, [&]( std::ostream & fout ) {
+            fout << contents;
+        } );
+    } else if( settings.compress ) {
+        write_to_file_compressed( filename, write_quad );
+    } else {
+        write_to_file( filename, write_quad );
+    }
 
     if( all_uniform && reverted_to_uniform ) {
         fs::remove( filename.get_unrelative_path() );
     }
 }
 
+void mapbuffer::save_region( const tripoint_abs_seg &segment,
+                             const std::map<point, std::optional<std::string>> &changes, bool in_background )
+{
+    const cata_path region_path = find_region_path( segment );
+    const cata_path dirname = find_segment_dirname( segment );
+    map_region_file region = map_region_file::load( region_path.get_unrelative_path() );
+
+    // Migrate quads of older saves, which are stored one per file in the segment directory.
+    std::vector<cata_path> migrated;
+    if( dir_exist( dirname.get_unrelative_path() ) ) {
+        const point_abs_omt segment_origin = project_to<coords::omt>( segment.xy() );
+        for( const cata_path &quad_path : get_files_from_path( ".map", dirname, false, true ) ) {
+            tripoint om_addr;
+            // NOLINTNEXTLINE(cert-err34-c)
+            if( std::sscanf( quad_path.get_relative_path().filename().generic_u8string().c_str(),
+                             "%d.%d.%d.map", &om_addr.x, &om_addr.y, &om_addr.z ) != 3 ||
+                find_quad_path( dirname, tripoint_abs_omt( om_addr ) ).get_unrelative_path() !=
+                quad_path.get_unrelative_path() ) {
+                // Not a quad file, or one with a locale formatted name; that one is still found there.
+                continue;
+            }
+            const point local = om_addr.xy() - segment_origin.raw();
+            if( changes.count( local ) == 0 ) {
+                std::optional<std::string> contents = read_whole_file( quad_path );
+                if( !contents ) {
+                    continue;
+                }
+                region.set_quad( local, std::move( *contents ) );
+            }
+            migrated.push_back( quad_path );
+        }
+    }
+
+    for( const auto &change : changes ) {
+        if( change.second ) {
+            region.set_quad( change.first, *change.second );
+        } else {
+            region.remove_quad( change.first );
+        }
+    }
+
+    background_file_writer &writer = get_background_file_writer();
+    if( in_background ) {
+        if( region.empty() ) {
+            writer.remove( region_path );
+        } else {
+            writer.write( region_path, region.serialize() );
+        }
+        // Only removed after the region is written, so the quads are always somewhere on disk.
+        for( const cata_path &quad_path : migrated ) {
+            writer.remove( quad_path );
+        }
+        if( !migrated.empty() ) {
+            writer.remove( dirname );
+        }
+        return;
+    }
+
+    if( region.empty() ) {
+        fs::remove( region_path.get_unrelative_path() );
+    } else {
+        const std::string contents = region.serialize();
+        write_to_file( region_path, [&]( std::ostream & fout ) {
+            fout << contents;
+        } );
+    }
+    std::error_code ec;
+    for( const cata_path &quad_path : migrated ) {
+        fs::remove( quad_path.get_unrelative_path(), ec );
+    }
+    if( !migrated.empty() ) {
+        // Only succeeds once the directory is empty.
+        fs::remove( dirname.get_unrelative_path(), ec );
+    }
+}
+
 // We're reading in way too many entities here to mess around with creating sub-objects and
 // seeking around in them, so we're using the json streaming API.
 submap *mapbuffer::unserialize_submaps( const tripoint_abs_sm &p )
 {
     // Map the tripoint to the submap quad that stores it.
     const tripoint_abs_omt om_addr = project_to<coords::omt>( p );
-    const cata_path dirname = find_dirname( om_addr );
-    cata_path quad_path = find_quad_path( dirname, om_addr );
 
-    if( !file_exist( quad_path ) ) {
-        // Fix for old saves where the path was generated using std::stringstream, which
-        // did format the number using the current locale. That formatting may insert
-        // thousands separators, so the resulting path is "map/1,234.7.8.map" instead
-        // of "map/1234.7.8.map".
-        std::ostringstream buffer;
-        buffer << om_addr.x() << "." << om_addr.y() << "." << om_addr.z()
-               << ".map";
-        cata_path legacy_quad_path = dirname / buffer.str();
-        if( file_exist( legacy_quad_path ) ) {
-            quad_path = std::move( legacy_quad_path );
+    std::optional<quad_data> data;
+    try {
+        if( !prefetch_state->take( om_addr, data ) ) {
+            const tripoint_abs_seg segment_addr = project_to<coords::seg>( om_addr );
+            // The quad may still be waiting to be written out by a background save.
+            get_background_file_writer().flush( find_quad_path( find_dirname( om_addr ), om_addr ) );
+            get_background_file_writer().flush( find_region_path( segment_addr ) );
+            data = read_quad_data( om_addr );
         }
-    }
-
-    if( !read_from_file_optional_json( quad_path, [this]( const JsonValue & jsin ) {
-    deserialize( jsin );
-    } ) ) {
-        // If it doesn't exist, trigger generating it.
+        if( !data ) {
+            // If it doesn't exist, trigger generating it.
+            return nullptr;
+        }
+        deserialize( parse_quad( data->contents, data->path ) );
+    } catch( const std::exception &err ) {
+        debugmsg( _( "Failed to read map data for %1$s: %2$s" ), om_addr.to_string(), err.what() );
         return nullptr;
     }
     // fill in uniform submaps that were not serialized
@@ -298,7 +782,7 @@ submap *mapbuffer::unserialize_submaps( const tripoint_abs_sm &p )
     generate_uniform_omt( project_to<coords::sm>( om_addr ), oid );
     if( submaps.count( p ) == 0 ) {
         debugmsg( "file %s did not contain the expected submap %s for non-uniform terrain %s",
-                  quad_path.generic_u8string(), p.to_string(), oid.id().str() );
+                  data->path.generic_u8string(), p.to_string(), oid.id().str() );
         return nullptr;
     }
     return submaps[ p ].get();
@@ -314,6 +798,15 @@ void mapbuffer::deserialize( const JsonArray &ja )
         if( submap_json.has_int( "version" ) ) {
             version = submap_json.get_int( "version" );
         }
+        if( submap_json.has_member( "mapgen_seed" ) ) {
+            // A pristine quad, see save_quad
+            JsonArray omt_array = submap_json.get_array( "omt" );
+            const tripoint_abs_omt omt{ omt_array.next_int(), omt_array.next_int(),
+                                        omt_array.next_int() };
+            generate_omt( omt, time_point( submap_json.get_int( "generated_at" ) ),
+                          submap_json.get_member( "mapgen_seed" ).get_uint() );
+            continue;
+        }
         for( JsonMember submap_member : submap_json ) {
             std::string submap_member_name = submap_member.name();
             if( submap_member_name == "coordinates" ) {
@@ -324,6 +817,7 @@ void mapbuffer::deserialize( const JsonArray &ja )
                 sm->load( submap_member, submap_member_name, version );
             }
         }
+        sm->compact();
 
         if( !add_submap( submap_coordinates, sm ) ) {
             debugmsg( "submap %s was already loaded", submap_coordinates.to_string() );
@@ -2,10 +2,13 @@
 #ifndef CATA_SRC_MAPBUFFER_H
 #define CATA_SRC_MAPBUFFER_H
 
+#include <cstddef>
 #include <iosfwd>
 #include <list>
 #include <map>
 #include <memory>
+#include <optional>
+#include <string>
 
 #include "coordinates.h"
 #include "point.h"
@@ -25,8 +28,10 @@ class mapbuffer
         /** Store all submaps in this instance into savefiles.
          * @param delete_after_save If true, the saved submaps are removed
          * from the mapbuffer (and deleted).
+         * @param in_background If true, the submaps are only serialized here and
+         * the files are written by the background file writer.
          **/
-        void save( bool delete_after_save = false );
+        void save( bool delete_after_save = false, bool in_background = false );
 
         /** Delete all buffered submaps. **/
         void clear();
@@ -62,6 +67,39 @@ class mapbuffer
          */
         submap *lookup_submap( const tripoint_abs_sm &p );
 
+        /**
+         * Starts reading the saved data of the submap at @p p from disk on a background
+         * thread, so a later @ref lookup_submap for it doesn't have to wait for the disk.
+         * Does nothing if the submap is already loaded.
+         */
+        void prefetch( const tripoint_abs_sm &p );
+
+        /** How well the buffer served @ref lookup_submap, since the last @ref clear. */
+        struct cache_stats {
+            // Lookups of submaps already in the buffer
+            int hits = 0;
+            // Lookups that had to load the submap from disk, or found none to load
+            int misses = 0;
+            int evicted_quads = 0;
+        };
+        const cache_stats &get_stats() const {
+            return stats;
+        }
+
+        /**
+         * Drops the least recently used quads outside of the reality bubble until the
+         * buffered submaps take less than @p budget_bytes, not counting their items.
+         * They are written out first the same way @ref save does, which skips uniform quads.
+         * Submaps are changed in place without telling the buffer, so there is no telling
+         * which quads are unchanged since they were loaded.
+         * Only safe between turns, when no map but the main one holds submap pointers.
+         * @param in_background If true, the files are written by the background file writer.
+         * @return number of quads dropped
+         */
+        int evict( size_t budget_bytes, bool in_background );
+        /** @ref evict with the budget and mode from the options, if there is a budget. */
+        void evict_over_budget();
+
     private:
         using submap_map_t = std::map<tripoint_abs_sm, std::unique_ptr<submap>>;
 
@@ -79,11 +117,36 @@ class mapbuffer
         void remove_submap( const tripoint_abs_sm &addr );
         submap *unserialize_submaps( const tripoint_abs_sm &p );
         void deserialize( const JsonArray &ja );
+        // How save() writes out the quads.
+        struct save_settings {
+            bool in_background = false;
+            bool binary = false;
+            // pack quads into map_region_file, per segment
+            bool regions = false;
+            // gzip the data of each quad
+            bool compress = false;
+        };
+        // Quads to store in (data) or remove from (nullopt) each region file, by position within the segment.
+        using region_changes = std::map<tripoint_abs_seg, std::map<point, std::optional<std::string>>>;
+
         void save_quad(
             const cata_path &dirname, const cata_path &filename,
             const tripoint_abs_omt &om_addr, std::list<tripoint_abs_sm> &submaps_to_delete,
-            bool delete_after_save );
+            bool delete_after_save, const save_settings &settings, region_changes &regions );
+        // Writes the changed quads to the region file of @p segment, moving any quads still
+        // stored in their own files into it.
+        void save_region( const tripoint_abs_seg &segment,
+                          const std::map<point, std::optional<std::string>> &changes, bool in_background );
         submap_map_t submaps; // NOLINT(cata-serialize)
+
+        // Marks the quad holding @p p as just used
+        void touch( const tripoint_abs_sm &p );
+        std::map<tripoint_abs_omt, unsigned long long> last_used; // NOLINT(cata-serialize)
+        unsigned long long use_counter = 0; // NOLINT(cata-serialize)
+        cache_stats stats; // NOLINT(cata-serialize)
+
+        struct prefetcher;
+        std::unique_ptr<prefetcher> prefetch_state; // NOLINT(cata-serialize)
 };
 
 extern mapbuffer MAPBUFFER;
@@ -270,6 +270,9 @@ void map::generate( const tripoint &p, const time_point &when )
 
             const tripoint pos( i, j, p.z );
             if( i <= 1 && j <= 1 ) {
+                if( submap *sm = getsubmap( get_nonant( pos ) ) ) {
+                    sm->compact();
+                }
                 saven( pos );
             } else {
                 const size_t grid_pos = get_nonant( pos );
@@ -1480,6 +1483,12 @@ class mapgen_value
             return source_->get_name_if_parameter();
         }
 
+        /** The id, if it is the same on every generation; otherwise nullptr. */
+        const Id *get_if_fixed() const {
+            const id_source *fixed = dynamic_cast<const id_source *>( source_.get() );
+            return fixed != nullptr ? &fixed->id : nullptr;
+        }
+
         void deserialize( const JsonValue &jsin ) {
             if( jsin.test_object() ) {
                 *this = mapgen_value( jsin.get_object() );
@@ -2816,6 +2825,13 @@ class jmapgen_terrain : public jmapgen_piece
             act_unknown, act_ignore, act_dismantle, act_erase
         };
     public:
+        /** What to do with furniture, traps and items under the placed terrain. */
+        struct apply_actions {
+            apply_action furn = apply_action::act_unknown;
+            apply_action trap = apply_action::act_unknown;
+            apply_action item = apply_action::act_unknown;
+        };
+
         mapgen_value<ter_id> id;
         jmapgen_terrain( const JsonObject &jsi, const std::string_view/*context*/ ) :
             jmapgen_terrain( jsi.get_member( "ter" ) ) {}
@@ -2834,15 +2850,11 @@ class jmapgen_terrain : public jmapgen_piece
             if( chosen_id.id().is_null() ) {
                 return;
             }
-            point p( x.get(), y.get() );
-            tripoint tp( p, dat.m.get_abs_sub().z() );
-
-            ter_id terrain_here = dat.m.ter( p );
-            const ter_t &chosen_ter = *chosen_id;
-            const bool is_wall = chosen_ter.has_flag( ter_furn_flag::TFLAG_WALL );
-            const bool place_item = chosen_ter.has_flag( ter_furn_flag::TFLAG_PLACE_ITEM );
-            const bool is_boring_wall = is_wall && !place_item;
+            place( dat, point( x.get(), y.get() ), chosen_id, get_actions( dat, context ), context );
+        }
 
+        /** Reads the actions from the mapgen flags of @p dat, the same for every tile. */
+        static apply_actions get_actions( const mapgendata &dat, const std::string &context ) {
             apply_action act_furn = apply_action::act_unknown;
             apply_action act_trap = apply_action::act_unknown;
             apply_action act_item = apply_action::act_unknown;
@@ -2890,6 +2902,21 @@ class jmapgen_terrain : public jmapgen_piece
                           "mistake, as any dismantle outputs will not be preserved.",
                           context, dat.terrain_type().id().str() );
             }
+            return { act_furn, act_trap, act_item };
+        }
+
+        static void place( const mapgendata &dat, const point &p, const ter_id &chosen_id,
+                           const apply_actions &acts, const std::string &context ) {
+            const apply_action act_furn = acts.furn;
+            const apply_action act_trap = acts.trap;
+            const apply_action act_item = acts.item;
+            tripoint tp( p, dat.m.get_abs_sub().z() );
+
+            ter_id terrain_here = dat.m.ter( p );
+            const ter_t &chosen_ter = *chosen_id;
+            const bool is_wall = chosen_ter.has_flag( ter_furn_flag::TFLAG_WALL );
+            const bool place_item = chosen_ter.has_flag( ter_furn_flag::TFLAG_PLACE_ITEM );
+            const bool is_boring_wall = is_wall && !place_item;
 
             if( is_boring_wall || act_furn == apply_action::act_erase ) {
                 dat.m.furn_clear( p );
@@ -4681,9 +4708,49 @@ std::unordered_set<point> nested_mapgen::all_placement_coords() const
     return result;
 }
 
+// The int id placed by @p what at a single tile, if it is a fixed terrain or furniture
+static std::optional<int> compiled_id( const jmapgen_place &where, const jmapgen_piece &what )
+{
+    if( where.x.val != where.x.valmax || where.y.val != where.y.valmax ||
+        std::max( where.repeat.valmax, what.repeat.valmax ) != 1 ||
+        std::min( where.repeat.val, what.repeat.val ) != 1 ) {
+        return std::nullopt;
+    }
+    if( const jmapgen_terrain *ter = dynamic_cast<const jmapgen_terrain *>( &what ) ) {
+        const ter_id *fixed = ter->id.get_if_fixed();
+        if( fixed != nullptr && !fixed->id().is_null() ) {
+            return fixed->to_i();
+        }
+    } else if( const jmapgen_furniture *furn = dynamic_cast<const jmapgen_furniture *>( &what ) ) {
+        const furn_id *fixed = furn->id.get_if_fixed();
+        if( fixed != nullptr && !fixed->id().is_null() ) {
+            return fixed->to_i();
+        }
+    }
+    return std::nullopt;
+}
+
 void jmapgen_objects::finalize()
 {
     std::stable_sort( objects.begin(), objects.end(), compare_phases );
+
+    steps.clear();
+    for( size_t i = 0; i < objects.size(); ++i ) {
+        const jmapgen_place &where = objects[i].first;
+        const jmapgen_piece &what = *objects[i].second;
+        const mapgen_phase phase = what.phase();
+        const std::optional<int> id = compiled_id( where, what );
+        if( !id ) {
+            steps.push_back( { phase, i, {}, {} } );
+            continue;
+        }
+        if( steps.empty() || steps.back().object != std::string::npos ||
+            steps.back().phase != phase ) {
+            steps.push_back( { phase, std::string::npos, {}, {} } );
+        }
+        steps.back().points.emplace_back( where.x.val, where.y.val );
+        steps.back().ids.push_back( *id );
+    }
 }
 
 void jmapgen_objects::check( const std::string &context, const mapgen_parameters &parameters ) const
@@ -5199,10 +5266,24 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase, const po
 {
     bool terrain_resolved = false;
 
-    auto range_at_phase = std::equal_range( objects.begin(), objects.end(), phase, compare_phases );
+    struct step_phase_comparator {
+        bool operator()( const compiled_step &l, mapgen_phase r ) const {
+            return l.phase < r;
+        }
+        bool operator()( mapgen_phase l, const compiled_step &r ) const {
+            return l < r.phase;
+        }
+    };
+    auto range_at_phase = std::equal_range( steps.begin(), steps.end(), phase,
+                                            step_phase_comparator() );
 
     for( auto it = range_at_phase.first; it != range_at_phase.second; ++it ) {
-        const jmapgen_obj &obj = *it;
+        const compiled_step &step = *it;
+        if( step.object == std::string::npos ) {
+            apply_compiled( dat, step, offset, context );
+            continue;
+        }
+        const jmapgen_obj &obj = objects[step.object];
         jmapgen_place where = obj.first;
         where.offset( -offset );
         const jmapgen_piece &what = *obj.second;
@@ -5227,6 +5308,24 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase, const po
     }
 }
 
+void jmapgen_objects::apply_compiled( const mapgendata &dat, const compiled_step &step,
+                                      const point &offset, const std::string &context )
+{
+    if( step.phase == mapgen_phase::terrain ) {
+        const jmapgen_terrain::apply_actions acts = jmapgen_terrain::get_actions( dat, context );
+        for( size_t i = 0; i < step.points.size(); ++i ) {
+            jmapgen_terrain::place( dat, step.points[i] + offset, ter_id( step.ids[i] ), acts,
+                                    context );
+        }
+    } else {
+        for( size_t i = 0; i < step.points.size(); ++i ) {
+            if( !dat.m.furn_set( step.points[i] + offset, furn_id( step.ids[i] ) ) ) {
+                debugmsg( "Problem setting furniture in %s", context );
+            }
+        }
+    }
+}
+
 bool jmapgen_objects::has_vehicle_collision( const mapgendata &dat, const point &offset ) const
 {
     for( const jmapgen_obj &obj : objects ) {
@@ -6397,6 +6496,7 @@ character_id map::place_npc( const point &p, const string_id<npc_template> &type
     temp->spawn_at_precise( tripoint_abs_ms( getabs( tripoint( p, abs_sub.z() ) ) ) );
     temp->toggle_trait( trait_NPC_STATIC_NPC );
     overmap_buffer.insert_npc( temp );
+    placed_npcs = true;
     return temp->getID();
 }
 
@@ -424,6 +424,22 @@ struct jmapgen_objects {
          */
         using jmapgen_obj = std::pair<jmapgen_place, shared_ptr_fast<const jmapgen_piece> >;
         std::vector<jmapgen_obj> objects;
+        /**
+         * What @ref apply runs, built by @ref finalize. Consecutive entries of @ref objects
+         * placing a fixed terrain or furniture on a single tile (most of what the rows and
+         * palette add) are compiled into one step of flat arrays, so they are placed in one
+         * loop. Anything else, including ids taken from a parameter, is a step of its own.
+         */
+        struct compiled_step {
+            mapgen_phase phase;
+            /** Index into @ref objects, or npos for a compiled run. */
+            size_t object;
+            std::vector<point> points;
+            std::vector<int> ids;
+        };
+        std::vector<compiled_step> steps;
+        static void apply_compiled( const mapgendata &dat, const compiled_step &,
+                                    const point &offset, const std::string &context );
         point m_offset;
         point mapgensize;
         point total_size;
@@ -1730,12 +1730,11 @@ void mapgen_lake_shore( mapgendata &dat )
     };
 
     const auto fill_deep_water = [&]( const point & starting_point ) {
-        std::vector<point> water_points = ff::point_flood_fill_4_connected( starting_point, visited,
-                                          should_fill );
-        for( point &wp : water_points ) {
+        ff::point_flood_fill_4_connected_visit( starting_point, visited, should_fill,
+        [&]( const point & wp ) {
             m->ter_set( wp, t_water_dp );
             m->furn_set( wp, f_null );
-        }
+        } );
     };
 
     // We'll flood fill from the four corners, using the corner if any of the locations
@@ -2195,12 +2194,11 @@ void mapgen_ocean_shore( mapgendata &dat )
     };
 
     const auto fill_deep_water = [&]( const point & starting_point ) {
-        std::vector<point> water_points = ff::point_flood_fill_4_connected( starting_point, visited,
-                                          should_fill );
-        for( point &wp : water_points ) {
+        ff::point_flood_fill_4_connected_visit( starting_point, visited, should_fill,
+        [&]( const point & wp ) {
             m->ter_set( wp, t_swater_dp );
             m->furn_set( wp, f_null );
-        }
+        } );
     };
 
     // We'll flood fill from the four corners, using the corner if any of the locations
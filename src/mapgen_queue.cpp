@@ -0,0 +1,90 @@
+#include "mapgen_queue.h"
+
+#include <algorithm>
+#include <deque>
+
+#include "avatar.h"
+#include "calendar.h"
+#include "game.h"
+#include "map.h"
+#include "mapbuffer.h"
+#include "rng.h"
+
+namespace mapgen_queue
+{
+
+namespace
+{
+
+// Older requests are dropped beyond this, the vehicle has turned or passed them
+constexpr size_t max_pending = 64;
+// Requests further than this from the avatar are stale
+constexpr int max_distance_omt = 8;
+
+std::deque<tripoint_abs_omt> &get_queue()
+{
+    static std::deque<tripoint_abs_omt> queue;
+    return queue;
+}
+
+// Same as map::loadn does for a missing submap
+bool generate( const tripoint_abs_omt &omt )
+{
+    if( MAPBUFFER.lookup_submap( project_to<coords::sm>( omt ) ) != nullptr ) {
+        // Generated before, or read from the save
+        return false;
+    }
+    // Rolls from a stream of its own, so generating ahead doesn't change the ones the rest
+    // of the turn gets, and the tile can be regenerated instead of saved
+    generate_omt( omt, calendar::turn, rng_stream_seed( g->get_seed(), "mapgen", omt.raw(),
+                  calendar::turn ) );
+    return true;
+}
+
+} // namespace
+
+void request( const tripoint_abs_omt &omt )
+{
+    std::deque<tripoint_abs_omt> &queue = get_queue();
+    if( std::find( queue.begin(), queue.end(), omt ) != queue.end() ) {
+        return;
+    }
+    if( queue.size() >= max_pending ) {
+        queue.pop_front();
+    }
+    queue.push_back( omt );
+}
+
+int process( const std::chrono::milliseconds budget )
+{
+    std::deque<tripoint_abs_omt> &queue = get_queue();
+    if( queue.empty() ) {
+        return 0;
+    }
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const tripoint_abs_omt avatar_omt = get_avatar().global_omt_location();
+    int generated = 0;
+    while( !queue.empty() && std::chrono::steady_clock::now() - start < budget ) {
+        const tripoint_abs_omt omt = queue.front();
+        queue.pop_front();
+        if( omt.z() != avatar_omt.z() || square_dist( omt, avatar_omt ) > max_distance_omt ) {
+            continue;
+        }
+        if( generate( omt ) ) {
+            ++generated;
+        }
+    }
+    return generated;
+}
+
+size_t pending()
+{
+    return get_queue().size();
+}
+
+void clear()
+{
+    get_queue().clear();
+}
+
+} // namespace mapgen_queue
@@ -0,0 +1,36 @@
+#pragma once
+#ifndef CATA_SRC_MAPGEN_QUEUE_H
+#define CATA_SRC_MAPGEN_QUEUE_H
+
+#include <chrono>
+#include <cstddef>
+
+#include "coordinates.h"
+
+/**
+ * Generation of overmap terrain tiles the avatar is about to reach, ahead of time.
+ *
+ * Generating an unvisited OMT is the slowest part of shifting the map, and a fast
+ * vehicle reaches several new ones per turn. Tiles predicted from the vehicle's heading
+ * are queued here and generated into the mapbuffer at the end of a turn, a few at a
+ * time, so @ref map::loadn finds them ready instead of generating the whole new row at
+ * once. Mapgen uses game-wide state, so this all happens on the main thread.
+ */
+namespace mapgen_queue
+{
+
+/** Queues @p omt, unless it is queued already. */
+void request( const tripoint_abs_omt &omt );
+/**
+ * Loads or generates queued tiles while less than @p budget has passed. Tiles the
+ * avatar has moved away from are dropped.
+ * @return number of tiles generated
+ */
+int process( std::chrono::milliseconds budget );
+/** Number of queued tiles. */
+size_t pending();
+void clear();
+
+} // namespace mapgen_queue
+
+#endif // CATA_SRC_MAPGEN_QUEUE_H
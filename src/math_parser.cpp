@@ -1,7 +1,9 @@
 #include "math_parser.h"
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <locale>
 #include <map>
 #include <memory>
@@ -266,11 +268,185 @@ double ternary::eval( dialogue &d ) const
     return cond->eval( d ) > 0 ? mhs->eval( d ) : rhs->eval( d );
 }
 
+bool math_bytecode::compile( thingie const &tree )
+{
+    *this = math_bytecode();
+    emit( tree );
+    if( failed ) {
+        *this = math_bytecode();
+        return false;
+    }
+    return true;
+}
+
+void math_bytecode::push( instr &&i, int stack_change )
+{
+    code.emplace_back( i );
+    depth += stack_change;
+    max_depth = std::max( max_depth, depth );
+}
+
+void math_bytecode::emit_params( std::vector<thingie> const &params )
+{
+    for( thingie const &p : params ) {
+        emit( p );
+    }
+}
+
+std::optional<double> math_bytecode::emit( thingie const &t )
+{
+    return std::visit( overloaded{
+        [this]( double v ) -> std::optional<double>
+        {
+            instr i;
+            i.value = v;
+            push( std::move( i ), 1 );
+            return v;
+        },
+        [this]( oper const & v ) -> std::optional<double>
+        {
+            std::optional<double> const l = emit( *v.l );
+            std::optional<double> const r = emit( *v.r );
+            if( l && r ) {
+                code.pop_back();
+                code.pop_back();
+                depth -= 2;
+                return emit( thingie { ( *v.op )( *l, *r ) } );
+            }
+            instr i;
+            i.op = opcode::oper;
+            i.oper = v.op;
+            push( std::move( i ), -1 );
+            return std::nullopt;
+        },
+        [this]( ternary const & v ) -> std::optional<double>
+        {
+            if( std::optional<double> const cond = emit( *v.cond ); cond ) {
+                code.pop_back();
+                depth--;
+                return emit( *cond > 0 ? *v.mhs : *v.rhs );
+            }
+            size_t const jump_to_rhs = code.size();
+            push( { opcode::jump_if_not }, -1 );
+            emit( *v.mhs );
+            size_t const jump_to_end = code.size();
+            push( { opcode::jump }, 0 );
+            // only one of the branches leaves its value on the stack
+            depth--;
+            code[jump_to_rhs].arg = static_cast<uint32_t>( code.size() );
+            emit( *v.rhs );
+            code[jump_to_end].arg = static_cast<uint32_t>( code.size() );
+            return std::nullopt;
+        },
+        [this]( func const & v ) -> std::optional<double>
+        {
+            emit_params( v.params );
+            instr i;
+            i.op = opcode::func;
+            i.nparams = static_cast<uint32_t>( v.params.size() );
+            i.func = v.f;
+            push( std::move( i ), 1 - static_cast<int>( v.params.size() ) );
+            return std::nullopt;
+        },
+        [this]( func_jmath const & v ) -> std::optional<double>
+        {
+            emit_params( v.params );
+            instr i;
+            i.op = opcode::func_jmath;
+            i.arg = static_cast<uint32_t>( jmath.size() );
+            i.nparams = static_cast<uint32_t>( v.params.size() );
+            jmath.emplace_back( v.id );
+            push( std::move( i ), 1 - static_cast<int>( v.params.size() ) );
+            return std::nullopt;
+        },
+        [this]( func_diag_eval const & v ) -> std::optional<double>
+        {
+            instr i;
+            i.op = opcode::func_diag;
+            i.arg = static_cast<uint32_t>( diag.size() );
+            diag.emplace_back( v );
+            push( std::move( i ), 1 );
+            return std::nullopt;
+        },
+        [this]( var const & v ) -> std::optional<double>
+        {
+            instr i;
+            i.op = opcode::variable;
+            i.arg = static_cast<uint32_t>( vars.size() );
+            vars.emplace_back( v );
+            push( std::move( i ), 1 );
+            return std::nullopt;
+        },
+        [this]( auto const &/* v */ ) -> std::optional<double>
+        {
+            // strings, kwargs, arrays and assignment functions are left to the tree
+            failed = true;
+            return std::nullopt;
+        },
+    },
+    t.data );
+}
+
+double math_bytecode::eval( dialogue &d ) const
+{
+    std::array<double, 16> small_stack;
+    std::vector<double> big_stack;
+    double *stack = small_stack.data();
+    if( max_depth > small_stack.size() ) {
+        big_stack.resize( max_depth );
+        stack = big_stack.data();
+    }
+    size_t sp = 0;
+    size_t pc = 0;
+    while( pc < code.size() ) {
+        instr const &i = code[pc++];
+        switch( i.op ) {
+            case opcode::constant:
+                stack[sp++] = i.value;
+                break;
+            case opcode::variable:
+                stack[sp++] = vars[i.arg].eval( d );
+                break;
+            case opcode::oper:
+                sp--;
+                stack[sp - 1] = ( *i.oper )( stack[sp - 1], stack[sp] );
+                break;
+            case opcode::func: {
+                std::vector<double> const params( stack + sp - i.nparams, stack + sp );
+                sp -= i.nparams;
+                stack[sp++] = ( *i.func )( params );
+                break;
+            }
+            case opcode::func_jmath: {
+                std::vector<double> const params( stack + sp - i.nparams, stack + sp );
+                sp -= i.nparams;
+                stack[sp++] = jmath[i.arg]->eval( d, params );
+                break;
+            }
+            case opcode::func_diag:
+                stack[sp++] = diag[i.arg].eval( d );
+                break;
+            case opcode::jump_if_not:
+                sp--;
+                if( !( stack[sp] > 0 ) ) {
+                    pc = i.arg;
+                }
+                break;
+            case opcode::jump:
+                pc = i.arg;
+                break;
+        }
+    }
+    return sp == 0 ? 0.0 : stack[0];
+}
+
 class math_exp::math_exp_impl
 {
     public:
         math_exp_impl() = default;
-        explicit math_exp_impl( thingie &&t ): tree( t ) {}
+        explicit math_exp_impl( thingie &&t ): tree( t ) {
+            compiled = bytecode.compile( tree );
+        }
 
         bool parse( std::string_view str, bool assignment ) {
             if( str.empty() ) {
@@ -288,11 +464,16 @@ class math_exp::math_exp_impl
                 output = {};
                 arity = {};
                 tree = thingie { 0.0 };
+                compiled = bytecode.compile( tree );
                 return false;
             }
+            compiled = bytecode.compile( tree );
             return true;
         }
         double eval( dialogue &d ) const {
+            return compiled ? bytecode.eval( d ) : tree.eval( d );
+        }
+        double eval_tree( dialogue &d ) const {
             return tree.eval( d );
         }
 
@@ -302,7 +483,7 @@ class math_exp::math_exp_impl
                     v.assign( d, val );
                 },
                 [&d, val]( var const & v ) {
-                    write_var_value( v.varinfo.type, v.varinfo.name,
+                    write_var_value( v.varinfo,
                                      d.actor( v.varinfo.type == var_type::npc ),
                                      &d, val );
                 },
@@ -338,6 +519,8 @@ class math_exp::math_exp_impl
         };
         std::stack<arity_t> arity;
         thingie tree{ 0.0 };
+        math_bytecode bytecode;
+        bool compiled = false;
         std::string_view last_token;
         parse_state state;
 
@@ -861,6 +1044,11 @@ double math_exp::eval( dialogue &d ) const
     return impl->eval( d );
 }
 
+double math_exp::eval_tree( dialogue &d ) const
+{
+    return impl->eval_tree( d );
+}
+
 void math_exp::assign( dialogue &d, double val ) const
 {
     return impl->assign( d, val );
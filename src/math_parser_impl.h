@@ -4,6 +4,8 @@
 
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -179,6 +181,55 @@ constexpr double thingie::eval( dialogue &d ) const
     data );
 }
 
+/**
+ * Flat stack-machine form of an expression tree.
+ *
+ * Evaluating it is a single loop over a vector of instructions instead of a recursive
+ * walk through std::variant nodes and shared_ptrs. Operators whose operands are all
+ * constants (including ternaries with a constant condition) are folded while compiling.
+ */
+class math_bytecode
+{
+    public:
+        /** Returns false if @p tree can't be evaluated, e.g. it is an assignment target. */
+        bool compile( thingie const &tree );
+        double eval( dialogue &d ) const;
+
+    private:
+        enum class opcode : int {
+            constant = 0,
+            variable,
+            oper,
+            func,
+            func_jmath,
+            func_diag,
+            jump_if_not,
+            jump,
+        };
+        struct instr {
+            opcode op = opcode::constant;
+            // index into vars, jmath or diag; jump target
+            uint32_t arg = 0;
+            uint32_t nparams = 0;
+            double value = 0.0;
+            binary_op::f_t oper = nullptr;
+            math_func::f_t func = nullptr;
+        };
+
+        std::optional<double> emit( thingie const &t );
+        void emit_params( std::vector<thingie> const &params );
+        void push( instr &&i, int stack_change );
+
+        std::vector<instr> code;
+        std::vector<var> vars;
+        std::vector<jmath_func_id> jmath;
+        std::vector<func_diag_eval> diag;
+        size_t max_depth = 0;
+        // only used while compiling
+        size_t depth = 0;
+        bool failed = false;
+};
+
 using op_t =
     std::variant<pbin_op, punary_op, pmath_func, jmath_func_id, scoped_diag_eval, scoped_diag_ass, paren>;
 
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_MDARRAY_H
 #define CATA_SRC_MDARRAY_H
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <initializer_list>
@@ -46,6 +47,10 @@ class mdarray_impl_2d
 
         static constexpr size_t size_x = DimX;
         static constexpr size_t size_y = DimY;
+        static constexpr size_t num_elements = DimX * DimY;
+
+        // The bulk operations below treat the columns as one flat range
+        static_assert( sizeof( column_type ) == sizeof( T ) * DimY, "columns must not be padded" );
 
         constexpr mdarray_impl_2d() = default;
 
@@ -77,12 +82,43 @@ class mdarray_impl_2d
             return data_[Traits::x( p )][Traits::y( p )];
         }
 
+        /** All elements in one contiguous range, column by column. */
+        T *data() {
+            return data_[0].data();
+        }
+        const T *data() const {
+            return data_[0].data();
+        }
+        T *begin() {
+            return data();
+        }
+        T *end() {
+            return data() + num_elements;
+        }
+        const T *begin() const {
+            return data();
+        }
+        const T *end() const {
+            return data() + num_elements;
+        }
+
         void fill( const T &t_all ) {
-            for( column_type &col : data_ ) {
-                for( T &t : col ) {
-                    t = t_all;
-                }
-            }
+            std::fill_n( data(), num_elements, t_all );
+        }
+
+        void copy_from( const mdarray_impl_2d &other ) {
+            std::copy_n( other.data(), num_elements, data() );
+        }
+
+        /** Sets each element to @p f of the element at the same place in @p src. */
+        template<typename U, typename OtherPoint, typename F>
+        void transform_from( const mdarray_impl_2d<U, OtherPoint, DimX, DimY> &src, const F &f ) {
+            std::transform( src.begin(), src.end(), begin(), f );
+        }
+
+        template<typename Predicate>
+        size_t count_if( const Predicate &pred ) const {
+            return std::count_if( begin(), end(), pred );
         }
 
         template<typename F>
@@ -72,6 +72,7 @@ class memorial_logger : public event_subscriber
 
         using event_subscriber::notify;
         void notify( const cata::event & ) override;
+        bool is_interested_in( event_type ) override;
     private:
         std::vector<memorial_log_entry> log;
 };
@@ -0,0 +1,148 @@
+#include "memory_accounting.h"
+
+#include <memory>
+#include <unordered_set>
+
+#include "avatar.h"
+#include "creature_tracker.h"
+#include "flexbuffer_cache.h"
+#include "game.h"
+#include "game_constants.h"
+#include "item.h"
+#include "item_factory.h"
+#include "mapbuffer.h"
+#include "mapdata.h"
+#include "monster.h"
+#include "monstergenerator.h"
+#include "mtype.h"
+#include "npc.h"
+#include "overmapbuffer.h"
+#include "point.h"
+#include "string_formatter.h"
+#include "submap.h"
+#include "vehicle.h"
+#include "visitable.h"
+
+#if defined(TILES)
+#include "cata_tiles.h"
+#include "sdltiles.h"
+#endif
+
+namespace memory_accounting
+{
+
+namespace
+{
+
+// @p v and everything inside it
+usage item_usage( const read_only_visitable &v )
+{
+    usage ret;
+    v.visit_items( [&ret]( const item *, const item * ) {
+        ++ret.count;
+        return VisitResponse::NEXT;
+    } );
+    ret.bytes = ret.count * sizeof( item );
+    return ret;
+}
+
+template<typename T>
+usage type_usage( size_t count )
+{
+    return { count, count * sizeof( T ) };
+}
+
+} // namespace
+
+std::vector<subsystem_usage> estimate()
+{
+    usage submaps;
+    usage vehicles;
+    usage items;
+    for( auto &entry : MAPBUFFER ) {
+        const submap &sm = *entry.second;
+        ++submaps.count;
+        submaps.bytes += sizeof( submap ) + sm.cosmetics.capacity() * sizeof( submap::cosmetic_t );
+        if( !sm.is_uniform() ) {
+            submaps.bytes += sm.tile_memory_usage();
+            for( int x = 0; x < SEEX; ++x ) {
+                for( int y = 0; y < SEEY; ++y ) {
+                    for( const item &it : sm.get_items( point( x, y ) ) ) {
+                        items += item_usage( it );
+                    }
+                }
+            }
+        }
+        for( const std::unique_ptr<vehicle> &veh : sm.vehicles ) {
+            ++vehicles.count;
+            vehicles.bytes += sizeof( vehicle ) + veh->part_count() * sizeof( vehicle_part );
+            for( int p = 0; p < veh->part_count(); ++p ) {
+                for( const item &it : veh->get_items( veh->part( p ) ) ) {
+                    items += item_usage( it );
+                }
+            }
+        }
+    }
+
+    usage monsters;
+    usage npcs;
+    if( g ) {
+        monsters = type_usage<monster>( get_creature_tracker().get_monsters_list().size() );
+        for( const npc &guy : g->all_npcs() ) {
+            npcs += type_usage<npc>( 1 );
+            items += item_usage( guy );
+        }
+        items += item_usage( get_avatar() );
+    }
+
+    const size_t mtypes = MonsterGenerator::generator().get_all_mtypes().size();
+    std::vector<subsystem_usage> ret = {
+        { "mapbuffer submaps", submaps },
+        { "vehicles", vehicles },
+        { "items", items },
+        { "map memory", get_avatar().map_memory_usage() },
+        { "overmaps", overmap_buffer.memory_usage() },
+        { "monsters", monsters },
+        { "npcs", npcs },
+        { "item types", type_usage<itype>( item_controller->all().size() ) },
+        { "monster types", type_usage<mtype>( mtypes ) },
+        { "terrain types", type_usage<ter_t>( ter_t::count() ) },
+        { "furniture types", type_usage<furn_t>( furn_t::count() ) },
+        { "flexbuffers", flexbuffer_cache::memory_usage() },
+    };
+
+#if defined(TILES)
+    // The close and far zoom levels may share a tileset
+    usage textures;
+    std::unordered_set<const tileset *> seen;
+    for( const cata_tiles *ctx : {
+             closetilecontext.get(), fartilecontext.get(), overmap_tilecontext.get()
+         } ) {
+        const tileset *ts = ctx != nullptr ? ctx->get_tileset() : nullptr;
+        if( ts != nullptr && seen.insert( ts ).second ) {
+            textures += ts->memory_usage();
+        }
+    }
+    ret.push_back( { "tileset textures", textures } );
+#endif
+
+    return ret;
+}
+
+std::string report()
+{
+    std::string ret = string_format( "%-20s %10s %12s\n", "subsystem", "count", "KiB" );
+    usage total;
+    for( const subsystem_usage &entry : estimate() ) {
+        ret += string_format( "%-20s %10d %12d\n", entry.name, entry.use.count,
+                              entry.use.bytes / 1024 );
+        total.bytes += entry.use.bytes;
+    }
+    ret += string_format( "%-20s %10s %12d\n", "total", "", total.bytes / 1024 );
+    const mapbuffer::cache_stats &stats = MAPBUFFER.get_stats();
+    ret += string_format( "mapbuffer lookups: %d hits, %d misses, %d quads evicted\n",
+                          stats.hits, stats.misses, stats.evicted_quads );
+    return ret;
+}
+
+} // namespace memory_accounting
@@ -0,0 +1,45 @@
+#pragma once
+#ifndef CATA_SRC_MEMORY_ACCOUNTING_H
+#define CATA_SRC_MEMORY_ACCOUNTING_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Rough accounting of the memory held by the big live-game data structures.
+ *
+ * Every subsystem reports how many objects it holds and an estimate of their size:
+ * the size of the objects themselves and of their main buffers, not of every string
+ * or small container hanging off them. The numbers are meant to show which caches grow
+ * on a long game, not to add up to the process RSS.
+ *
+ * Available from the debug menu and with the `--memory-report` command line option.
+ */
+namespace memory_accounting
+{
+
+struct usage {
+    std::size_t count = 0;
+    std::size_t bytes = 0;
+
+    usage &operator+=( const usage &rhs ) {
+        count += rhs.count;
+        bytes += rhs.bytes;
+        return *this;
+    }
+};
+
+struct subsystem_usage {
+    std::string name;
+    usage use;
+};
+
+/** Estimates for every subsystem, for the currently loaded game if there is one. */
+std::vector<subsystem_usage> estimate();
+/** Multi-line table of @ref estimate. */
+std::string report();
+
+} // namespace memory_accounting
+
+#endif // CATA_SRC_MEMORY_ACCOUNTING_H
@@ -15,6 +15,7 @@
 #include "point.h"
 #include "string_formatter.h"
 #include "string_input_popup.h"
+#include "translation_cache.h"
 #include "translations.h"
 #include "ui_manager.h"
 #include "viewer.h"
@@ -27,6 +28,7 @@
 #include <iterator>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "options.h"
 
@@ -46,6 +48,13 @@ struct game_message {
     bool cooldown_hidden = false; // NOLINT(cata-serialize)
     game_message_type type = m_neutral;
 
+    // get_with_count() wrapped by the last call to folded()
+    mutable std::vector<std::string> folded_lines; // NOLINT(cata-serialize)
+    mutable int folded_width = 0; // NOLINT(cata-serialize)
+    mutable int folded_count = 0; // NOLINT(cata-serialize)
+    mutable bool folded_plain = false; // NOLINT(cata-serialize)
+    mutable int folded_language = INVALID_LANGUAGE_VERSION; // NOLINT(cata-serialize)
+
     game_message() = default;
     game_message( std::string &&msg, game_message_type const t ) :
         message( std::move( msg ) ),
@@ -66,6 +75,25 @@ struct game_message {
         return string_format( _( "%s x %d" ), message, count );
     }
 
+    /**
+     * get_with_count() folded to @p width, without color tags if @p plain.
+     * The sidebar draws the same few messages every frame, so the lines are kept until the
+     * width, the count or the language changes.
+     */
+    const std::vector<std::string> &folded( const int width, const bool plain ) const {
+        const int language = detail::get_current_language_version();
+        if( width != folded_width || plain != folded_plain || count != folded_count ||
+            language != folded_language ) {
+            const std::string text = get_with_count();
+            folded_lines = foldstring( plain ? remove_color_tags( text ) : text, width );
+            folded_width = width;
+            folded_plain = plain;
+            folded_count = count;
+            folded_language = language;
+        }
+        return folded_lines;
+    }
+
     /** Get whether or not a message should not be displayed (hidden) in the side bar because it's in a cooldown period.
      * @returns `true` if the message should **not** be displayed, `false` otherwise.
      */
@@ -648,8 +676,7 @@ void Messages::dialog::init( ui_adaptor &ui )
     for( size_t ind = 0; ind < msg_count; ++ind ) {
         const size_t msg_ind = log_from_top ? ind : msg_count - 1 - ind;
         const game_message &msg = player_messages.history( msg_ind );
-        const auto &folded = foldstring( msg.get_with_count(), msg_width );
-        for( const auto &it : folded ) {
+        for( const std::string &it : msg.folded( msg_width, false ) ) {
             folded_filtered.emplace_back( folded_all.size() );
             folded_all.emplace_back( msg_ind, it );
         }
@@ -940,12 +967,8 @@ void Messages::display_messages( const catacurses::window &ipk_target, const int
             }
 
             const nc_color col = m.get_color( player_messages.curmes );
-            std::string message_text = m.get_with_count();
-            if( !m.is_recent( player_messages.curmes ) ) {
-                message_text = remove_color_tags( message_text );
-            }
-
-            for( const std::string &folded : foldstring( message_text, maxlength ) ) {
+            const bool plain = !m.is_recent( player_messages.curmes );
+            for( const std::string &folded : m.folded( maxlength, plain ) ) {
                 if( line > bottom ) {
                     break;
                 }
@@ -973,12 +996,8 @@ void Messages::display_messages( const catacurses::window &ipk_target, const int
             }
 
             const nc_color col = m.get_color( player_messages.curmes );
-            std::string message_text = m.get_with_count();
-            if( !m.is_recent( player_messages.curmes ) ) {
-                message_text = remove_color_tags( message_text );
-            }
-
-            const auto folded_strings = foldstring( message_text, maxlength );
+            const bool plain = !m.is_recent( player_messages.curmes );
+            const std::vector<std::string> &folded_strings = m.folded( maxlength, plain );
             const auto folded_rend = folded_strings.rend();
             for( auto string_iter = folded_strings.rbegin();
                  string_iter != folded_rend && line >= top; ++string_iter, line-- ) {
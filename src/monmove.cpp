@@ -292,10 +292,9 @@ bool monster::know_danger_at( const tripoint &p ) const
                 }
             }
 
-            // Don't step on any traps (if we can see)
-            const trap &target_trap = here.tr_at( p );
-            if( avoid_traps && has_flag( mon_flag_SEES ) &&
-                !target_trap.is_benign() && here.has_floor_or_water( p ) ) {
+            // Don't step on any traps (if we can see), most submaps have none to look up
+            if( avoid_traps && has_flag( mon_flag_SEES ) && here.may_have_trap( p ) &&
+                !here.tr_at( p ).is_benign() && here.has_floor_or_water( p ) ) {
                 return false;
             }
         }
@@ -509,6 +508,54 @@ bool monster::mating_angry() const
     return mating_angry;
 }
 
+// Throttle monster thinking, if there are no apparent threats, stop paying attention.
+static constexpr int max_turns_for_rate_limiting = 1800;
+
+bool monster::scans_for_targets() const
+{
+    constexpr double max_turns_to_skip = 600.0;
+    // Outputs a range from 0.0 - 1.0.
+    float rate_limiting_factor = 1.0 - logarithmic_range( 0, max_turns_for_rate_limiting,
+                                 turns_since_target );
+    int turns_to_skip = max_turns_to_skip * rate_limiting_factor;
+    return friendly == 0 && ( turns_to_skip == 0 || turns_since_target % turns_to_skip == 0 );
+}
+
+// Monsters this far from every character, and without a target for this many turns,
+// may go dormant. They get a full update every dormant_update_interval turns.
+static constexpr int dormant_distance = MAX_VIEW_DISTANCE;
+static constexpr int dormant_after_turns = 20;
+static constexpr int dormant_update_interval = 5;
+
+bool monster::is_dormant() const
+{
+    if( friendly != 0 || wandf > 0 || has_dest() || !patrol_route.empty() ||
+        turns_since_target < dormant_after_turns || attitude() == MATT_FLEE ) {
+        return false;
+    }
+    if( get_scent().get( pos() ) > 0 ) {
+        return false;
+    }
+    if( rl_dist( get_location(), get_player_character().get_location() ) <= dormant_distance ) {
+        return false;
+    }
+    for( const npc &guy : g->all_npcs() ) {
+        if( rl_dist( get_location(), guy.get_location() ) <= dormant_distance ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool monster::skip_dormant_turn()
+{
+    if( !is_dormant() || ++dormant_turns >= dormant_update_interval ) {
+        dormant_turns = 0;
+        return false;
+    }
+    return true;
+}
+
 void monster::plan()
 {
     monster_plan mon_plan( *this );
@@ -613,15 +660,8 @@ void monster::plan()
     }
 
     mon_plan.fleeing = mon_plan.fleeing || ( mood == MATT_FLEE );
-    // Throttle monster thinking, if there are no apparent threats, stop paying attention.
-    constexpr int max_turns_for_rate_limiting = 1800;
-    constexpr double max_turns_to_skip = 600.0;
-    // Outputs a range from 0.0 - 1.0.
-    float rate_limiting_factor = 1.0 - logarithmic_range( 0, max_turns_for_rate_limiting,
-                                 turns_since_target );
-    int turns_to_skip = max_turns_to_skip * rate_limiting_factor;
     creature_tracker &tracker = get_creature_tracker();
-    if( friendly == 0 && ( turns_to_skip == 0 || turns_since_target % turns_to_skip == 0 ) ) {
+    if( scans_for_targets() ) {
         tracker.for_each_reachable( *this, [this]( const mfaction_id & other ) {
             const mf_attitude faction_att = faction->attitude( other );
             return !( faction_att == MFA_NEUTRAL || faction_att == MFA_FRIENDLY );
@@ -880,8 +920,8 @@ void monster::move()
     //If there are. Consume them.
     // TODO: Stick this in a map and dispatch to it via the action string.
     // TODO: Create a special attacks whitelist unordered map instead of an if chain.
-    std::map<std::string, mtype_special_attack>::const_iterator attack =
-        type->special_attacks.find( action );
+    std::map<std::string, mtype_special_attack, std::less<>>::const_iterator attack =
+                type->special_attacks.find( action );
     if( attack != type->special_attacks.end() && attack->second->call( *this ) ) {
         if( special_attacks.count( action ) != 0 ) {
             reset_special( action );
@@ -1070,12 +1110,20 @@ void monster::move()
                 ( path.empty() || rl_dist( pos(), path.front() ) >= 2 || path.back() != local_dest ) ) {
                 // We need a new path
                 if( can_pathfind() ) {
-                    path = here.route( pos(), local_dest, pf_settings, get_path_avoid() );
+                    const std::unordered_set<tripoint> avoid = get_path_avoid();
+                    // Hordes tend to chase the same creature, so share a flow field towards it
+                    // instead of running A* for every monster. Other destinations are rarely
+                    // shared, so they aren't worth a whole field.
+                    const bool chasing_creature = creatures.creature_at( local_dest ) != nullptr;
+                    if( !chasing_creature ||
+                        !here.flow_field_route( path, pos(), local_dest, pf_settings, avoid ) ) {
+                        here.route( path, pos(), local_dest, pf_settings, avoid );
+                    }
                     if( path.empty() ) {
                         increment_pathfinding_cd();
                     }
                 } else {
-                    path = here.straight_route( pos(), local_dest );
+                    here.straight_route( path, pos(), local_dest );
                     if( !path.empty() ) {
                         std::unordered_set<tripoint> closed = get_path_avoid();
                         if( std::any_of( path.begin(), path.end(), [&closed]( const tripoint & p ) {
@@ -198,6 +198,11 @@ struct pathfinding_settings;
 // The rough formula is 2^(-x), e.g. for x = 5 it's 0.03125 (~ 3%).
 static constexpr int UPGRADE_MAX_ITERS = 5;
 
+static const option_handle<float> opt_monster_upgrade_factor( "MONSTER_UPGRADE_FACTOR" );
+static const option_handle<bool> opt_log_monster_move_effects( "LOG_MONSTER_MOVE_EFFECTS" );
+static const option_handle<bool> opt_log_monster_attack_monster( "LOG_MONSTER_ATTACK_MONSTER" );
+static const option_handle<bool> opt_portal_storm_ignore_npc( "PORTAL_STORM_IGNORE_NPC" );
+
 static const std::map<creature_size, translation> size_names {
     { creature_size::tiny, to_translation( "size adj", "tiny" ) },
     { creature_size::small, to_translation( "size adj", "small" ) },
@@ -362,7 +367,7 @@ void monster::poly( const mtype_id &id )
 
 bool monster::can_upgrade() const
 {
-    return upgrades && get_option<float>( "MONSTER_UPGRADE_FACTOR" ) > 0.0;
+    return upgrades && opt_monster_upgrade_factor.get() > 0.0;
 }
 
 // For master special attack.
@@ -372,7 +377,7 @@ void monster::hasten_upgrade()
         return;
     }
 
-    const int scaled_half_life = type->half_life * get_option<float>( "MONSTER_UPGRADE_FACTOR" );
+    const int scaled_half_life = type->half_life * opt_monster_upgrade_factor.get();
     upgrade_time -= rng( 1, scaled_half_life );
     if( upgrade_time < 0 ) {
         upgrade_time = 0;
@@ -397,7 +402,7 @@ int monster::next_upgrade_time()
     if( type->age_grow > 0 ) {
         return type->age_grow;
     }
-    const int scaled_half_life = type->half_life * get_option<float>( "MONSTER_UPGRADE_FACTOR" );
+    const int scaled_half_life = type->half_life * opt_monster_upgrade_factor.get();
     int day = 1; // 1 day of guaranteed evolve time
     for( int i = 0; i < UPGRADE_MAX_ITERS; i++ ) {
         if( one_in( 2 ) ) {
@@ -1454,7 +1459,7 @@ monster_attitude monster::attitude( const Character *u ) const
     // override for the Personal Portal Storms Mod
     // if the monster is a nether portal monster and the character is an NPC then ignore
     if( u != nullptr && faction == monfaction_nether_player_hate && u->is_npc() &&
-        get_option<bool>( "PORTAL_STORM_IGNORE_NPC" ) ) {
+        opt_portal_storm_ignore_npc.get() ) {
         // portal storm creatures ignore NPCs no matter what with this mod on
         return MATT_FPASSIVE;
     }
@@ -1556,19 +1561,22 @@ monster_attitude monster::attitude( const Character *u ) const
             }
         }
 
-        for( const trait_id &mut : u->get_mutations() ) {
-            const mutation_branch &branch = *mut;
-            if( branch.ignored_by.empty() && branch.anger_relations.empty() ) {
-                continue;
-            }
-            for( const species_id &spe : branch.ignored_by ) {
-                if( type->in_species( spe ) ) {
-                    return MATT_IGNORE;
+        // Most monsters don't care about traits, don't collect them for nothing
+        if( mutation_branch::any_reacting_species( type->species ) ) {
+            for( const trait_id &mut : u->get_mutations() ) {
+                const mutation_branch &branch = *mut;
+                if( branch.ignored_by.empty() && branch.anger_relations.empty() ) {
+                    continue;
                 }
-            }
-            for( const std::pair<const species_id, int> &elem : branch.anger_relations ) {
-                if( type->in_species( elem.first ) ) {
-                    effective_anger += elem.second;
+                for( const species_id &spe : branch.ignored_by ) {
+                    if( type->in_species( spe ) ) {
+                        return MATT_IGNORE;
+                    }
+                }
+                for( const std::pair<const species_id, int> &elem : branch.anger_relations ) {
+                    if( type->in_species( elem.first ) ) {
+                        effective_anger += elem.second;
+                    }
                 }
             }
         }
@@ -1951,7 +1959,7 @@ bool monster::melee_attack( Creature &target, float accuracy )
                     add_msg( m_good, _( "Your %1$s hits %2$s for %3$d damage!" ), get_name(), target.disp_name(),
                              total_dealt );
                 }
-                if( get_option<bool>( "LOG_MONSTER_ATTACK_MONSTER" ) ) {
+                if( opt_log_monster_attack_monster.get() ) {
                     if( !u_see_me && u_see_target ) {
                         add_msg( _( "Something hits the %1$s!" ), target.disp_name() );
                     } else if( !u_see_target ) {
@@ -1985,7 +1993,7 @@ bool monster::melee_attack( Creature &target, float accuracy )
                          body_part_name_accusative( dealt_dam.bp_hit ),
                          target.disp_name( true ),
                          target.skin_name() );
-            } else if( get_option<bool>( "LOG_MONSTER_ATTACK_MONSTER" ) ) {
+            } else if( opt_log_monster_attack_monster.get() ) {
                 //~ $1s is monster name, %2$s is that monster target name,
                 //~ $3s is target armor name.
                 add_msg( _( "%1$s hits %2$s but is stopped by its %3$s." ),
@@ -2173,13 +2181,13 @@ bool monster::move_effects( bool )
         bool immediate_break = type->in_species( species_FISH ) || type->in_species( species_MOLLUSK ) ||
                                type->in_species( species_ROBOT ) || type->bodytype == "snake" || type->bodytype == "blob";
         if( !immediate_break && rng( 0, 900 ) > type->melee_dice * type->melee_sides * 1.5 ) {
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && opt_log_monster_move_effects.get() ) {
                 add_msg( _( "The %s struggles to break free of its bonds." ), name() );
             }
         } else if( immediate_break ) {
             remove_effect( effect_tied );
             if( tied_item ) {
-                if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+                if( u_see_me && opt_log_monster_move_effects.get() ) {
                     add_msg( _( "The %s easily slips out of its bonds." ), name() );
                 }
                 here.add_item_or_charges( pos(), *tied_item );
@@ -2193,7 +2201,7 @@ bool monster::move_effects( bool )
                     here.add_item_or_charges( pos(), *tied_item );
                 }
                 tied_item.reset();
-                if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+                if( u_see_me && opt_log_monster_move_effects.get() ) {
                     if( broken ) {
                         add_msg( _( "The %s snaps the bindings holding it down." ), name() );
                     } else {
@@ -2207,11 +2215,11 @@ bool monster::move_effects( bool )
     }
     if( has_effect( effect_downed ) ) {
         if( rng( 0, 40 ) > type->melee_dice * type->melee_sides * 1.5 ) {
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && opt_log_monster_move_effects.get() ) {
                 add_msg( _( "The %s struggles to stand." ), name() );
             }
         } else {
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && opt_log_monster_move_effects.get() ) {
                 add_msg( _( "The %s climbs to its feet!" ), name() );
             }
             remove_effect( effect_downed );
@@ -2220,7 +2228,7 @@ bool monster::move_effects( bool )
     }
     if( has_effect( effect_webbed ) ) {
         if( x_in_y( type->melee_dice * type->melee_sides, 6 * get_effect_int( effect_webbed ) ) ) {
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && opt_log_monster_move_effects.get() ) {
                 add_msg( _( "The %s breaks free of the webs!" ), name() );
             }
             remove_effect( effect_webbed );
@@ -2230,7 +2238,7 @@ bool monster::move_effects( bool )
     if( has_effect( effect_lightsnare ) ) {
         if( x_in_y( type->melee_dice * type->melee_sides, 12 ) ) {
             remove_effect( effect_lightsnare );
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && opt_log_monster_move_effects.get() ) {
                 add_msg( _( "The %s escapes the light snare!" ), name() );
             }
         }
@@ -2242,7 +2250,7 @@ bool monster::move_effects( bool )
                 remove_effect( effect_heavysnare );
                 here.spawn_item( pos(), "rope_6" );
                 here.spawn_item( pos(), "snare_trigger" );
-                if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+                if( u_see_me && opt_log_monster_move_effects.get() ) {
                     add_msg( _( "The %s escapes the heavy snare!" ), name() );
                 }
             }
@@ -2253,7 +2261,7 @@ bool monster::move_effects( bool )
         if( type->melee_dice * type->melee_sides >= 18 ) {
             if( x_in_y( type->melee_dice * type->melee_sides, 200 ) ) {
                 remove_effect( effect_beartrap );
-                if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+                if( u_see_me && opt_log_monster_move_effects.get() ) {
                     add_msg( _( "The %s escapes the bear trap!" ), name() );
                 }
             }
@@ -2263,7 +2271,7 @@ bool monster::move_effects( bool )
     if( has_effect( effect_crushed ) ) {
         if( x_in_y( type->melee_dice * type->melee_sides, 100 ) ) {
             remove_effect( effect_crushed );
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && opt_log_monster_move_effects.get() ) {
                 add_msg( _( "The %s frees itself from the rubble!" ), name() );
             }
         }
@@ -2279,7 +2287,7 @@ bool monster::move_effects( bool )
         if( rng( 0, 40 ) > type->melee_dice * type->melee_sides ) {
             return false;
         } else {
-            if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+            if( u_see_me && opt_log_monster_move_effects.get() ) {
                 add_msg( _( "The %s escapes the pit!" ), name() );
             }
             remove_effect( effect_in_pit );
@@ -2305,7 +2313,7 @@ bool monster::move_effects( bool )
             if( grabber == nullptr ) {
                 remove_effect( grab.get_id() );
                 add_msg_debug( debugmode::DF_MATTACK, "Orphan grab found and removed" );
-                if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+                if( u_see_me && opt_log_monster_move_effects.get() ) {
                     add_msg( _( "The %s is no longer grabbed!" ), name() );
                 }
                 continue;
@@ -2317,7 +2325,7 @@ bool monster::move_effects( bool )
             if( !x_in_y( monster, grab_str ) ) {
                 return false;
             } else {
-                if( u_see_me && get_option<bool>( "LOG_MONSTER_MOVE_EFFECTS" ) ) {
+                if( u_see_me && opt_log_monster_move_effects.get() ) {
                     add_msg( _( "The %s breaks free from the %s's grab!" ), name(), grabber->name() );
                 }
                 remove_effect( grab.get_id() );
@@ -3029,7 +3037,7 @@ void monster::spawn_dissectables_on_death( item *corpse )
                                          calendar::turn,
                                          spawn_flags::use_spawn_rate );
         for( item &dissectable : dissectables ) {
-            dissectable.dropped_from = entry.type;
+            dissectable.set_dropped_from( entry.type );
             for( const flag_id &flg : entry.flags ) {
                 dissectable.set_flag( flg );
             }
@@ -3200,7 +3208,10 @@ void monster::process_effects()
 
     //Monster will regen morale and aggression if it is at/above max HP
     //It regens more morale and aggression if is currently fleeing.
-    if( type->regen_morale && hp >= type->hp ) {
+    //Nothing changes for one already at its type's values, which is most of a horde, so the
+    //attitude check behind is_fleeing is skipped for those.
+    if( type->regen_morale && hp >= type->hp &&
+        ( morale != type->morale || anger != type->agro ) ) {
         if( is_fleeing( player_character ) ) {
             morale = type->morale;
             anger = type->agro;
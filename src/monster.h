@@ -247,6 +247,18 @@ class monster : public Creature
         float rate_target( Creature &c, float best, bool smart = false ) const;
         // is it mating season?
         bool mating_angry() const;
+        // Whether the next plan() looks around for hostile monsters, which is throttled
+        // for monsters that haven't had a target for a while.
+        bool scans_for_targets() const;
+        // Whether nothing is going on around this monster: no target, nothing heard or
+        // smelled and nobody nearby.
+        bool is_dormant() const;
+        /**
+         * Returns true if this monster is dormant and should sit out the current turn.
+         * Dormant monsters still plan and move every few turns, and stop being dormant as
+         * soon as they find a target, hear a sound or smell something.
+         */
+        bool skip_dormant_turn();
         void plan();
         void anger_hostile_seen( const monster_plan &mon_plan );
         void anger_mating_season( const monster_plan &mon_plan );
@@ -649,6 +661,8 @@ class monster : public Creature
 
         std::bitset<NUM_MEFF> effect_cache;
         int turns_since_target = 0;
+        // Turns spent dormant since the last full update, not saved.
+        int dormant_turns = 0;
 
         Character *find_dragged_foe();
         void nursebot_operate( Character *dragged_foe );
@@ -127,7 +127,7 @@ std::string player_morale::morale_point::get_name() const
 
 int player_morale::morale_point::get_net_bonus() const
 {
-    return bonus * ( ( !is_permanent() && age > decay_start ) ?
+    return bonus * ( is_fading() ?
                      logarithmic_range( to_turns<int>( decay_start ), to_turns<int>( duration ),
                                         to_turns<int>( age ) ) : 1 );
 }
@@ -148,6 +148,11 @@ bool player_morale::morale_point::is_permanent() const
     return ( duration == 0_turns );
 }
 
+bool player_morale::morale_point::is_fading() const
+{
+    return !is_permanent() && age > decay_start;
+}
+
 bool player_morale::morale_point::matches( const morale_type &_type, const itype *_item_type ) const
 {
     return ( _type == type ) && ( _item_type == nullptr || _item_type == item_type );
@@ -479,9 +484,9 @@ int player_morale::get_level() const
         for( const morale_point &m : points ) {
             const int bonus = m.get_net_bonus( mult );
             if( bonus > 0 ) {
-                sum_of_positive_squares += std::pow( bonus, 2 );
+                sum_of_positive_squares += bonus * bonus;
             } else {
-                sum_of_negative_squares += std::pow( bonus, 2 );
+                sum_of_negative_squares += bonus * bonus;
             }
         }
 
@@ -502,14 +507,18 @@ int player_morale::get_level() const
 
 void player_morale::decay( const time_duration &ticks )
 {
-    const auto do_decay = [ &ticks ]( morale_point & m ) {
+    // The level only moves while some point is fading, points that are removed or changed
+    // invalidate it themselves
+    bool fading = false;
+    for( morale_point &m : points ) {
         m.decay( ticks );
-    };
-
-    std::for_each( points.begin(), points.end(), do_decay );
+        fading = fading || m.is_fading();
+    }
     remove_expired();
     update_bodytemp_penalty( ticks );
-    invalidate();
+    if( fading ) {
+        invalidate();
+    }
 }
 
 void player_morale::display( int focus_eq, int pain_penalty, int fatigue_penalty )
@@ -101,6 +101,8 @@ class player_morale
                 int get_net_bonus( const morale_mult &mult ) const;
                 bool is_expired() const;
                 bool is_permanent() const;
+                /** Whether the bonus is past its decay start and shrinking with age. */
+                bool is_fading() const;
                 bool matches( const morale_type &_type, const itype *_item_type = nullptr ) const;
                 bool matches( const morale_point &mp ) const;
 
@@ -328,7 +328,7 @@ std::string mtype::nname( unsigned int quantity ) const
     return name.translated( quantity );
 }
 
-bool mtype::has_special_attack( const std::string &attack_name ) const
+bool mtype::has_special_attack( const std::string_view attack_name ) const
 {
     return special_attacks.find( attack_name ) != special_attacks.end();
 }
@@ -368,8 +368,9 @@ struct mtype {
     private:
         std::set<std::string> weakpoints_deferred_deleted;
     public:
-        // special attack frequencies and function pointers
-        std::map<std::string, mtype_special_attack> special_attacks;
+        // special attack frequencies and function pointers, transparent so names can be
+        // looked up without building a string
+        std::map<std::string, mtype_special_attack, std::less<>> special_attacks;
         /** Emission sources that cycle each turn the monster remains alive */
         std::map<emit_id, time_duration> emit_fields;
         std::optional<resistances> armor_proportional; /**load-time only*/
@@ -510,7 +511,7 @@ struct mtype {
 
         // Used to fetch the properly pluralized monster type name
         std::string nname( unsigned int quantity = 1 ) const;
-        bool has_special_attack( const std::string &attack_name ) const;
+        bool has_special_attack( std::string_view attack_name ) const;
         bool has_flag( const mon_flag_id &flag ) const {
             return flags.contains( flag );
         }
@@ -131,42 +131,81 @@ bool Character::has_trait_variant( const trait_and_var &test ) const
     return false;
 }
 
+// Whether an activated mutation has a flag through being active or inactive
+static bool has_active_or_inactive_flag( const mutation_branch &mut_data,
+        const json_character_flag &b )
+{
+    if( mut_data.active_flags.count( b ) > 0 ) {
+        return get_player_character().has_active_mutation( mut_data.id );
+    }
+    if( mut_data.inactive_flags.count( b ) > 0 ) {
+        return !get_player_character().has_active_mutation( mut_data.id );
+    }
+    return false;
+}
+
+void Character::build_trait_flag_cache() const
+{
+    trait_flag_counts.emplace();
+    activated_mutations.clear();
+    for( const std::pair<const trait_id, trait_data> &mut : my_mutations ) {
+        const mutation_branch &mut_data = mut.first.obj();
+        for( const json_character_flag &flag : mut_data.flags ) {
+            ++( *trait_flag_counts )[flag];
+        }
+        if( mut_data.activated ) {
+            activated_mutations.push_back( &mut_data );
+        }
+    }
+}
+
 bool Character::has_trait_flag( const json_character_flag &b ) const
 {
-    // UGLY, SLOW, should be cached as my_mutation_flags or something
-    for( const trait_id &mut : get_mutations() ) {
+    if( !trait_flag_counts ) {
+        build_trait_flag_cache();
+    }
+    if( trait_flag_counts->count( b ) > 0 ) {
+        return true;
+    }
+    for( const mutation_branch *mut_data : activated_mutations ) {
+        if( has_active_or_inactive_flag( *mut_data, b ) ) {
+            return true;
+        }
+    }
+    // Traits granted by enchantments come and go with items, don't cache them
+    for( const trait_id &mut : enchantment_cache->get_mutations() ) {
         const mutation_branch &mut_data = mut.obj();
-        if( mut_data.flags.count( b ) > 0 ) {
+        if( mut_data.flags.count( b ) > 0 ||
+            ( mut_data.activated && has_active_or_inactive_flag( mut_data, b ) ) ) {
             return true;
-        } else if( mut_data.activated ) {
-            Character &player = get_player_character();
-            if( ( mut_data.active_flags.count( b ) > 0 && player.has_active_mutation( mut ) ) ||
-                ( mut_data.inactive_flags.count( b ) > 0 && !player.has_active_mutation( mut ) ) ) {
-                return true;
-            }
         }
     }
-
     return false;
 }
 
 int Character::count_trait_flag( const json_character_flag &b ) const
 {
-    int ret = 0;
-    // UGLY, SLOW, should be cached as my_mutation_flags or something
-    for( const trait_id &mut : get_mutations() ) {
+    if( !trait_flag_counts ) {
+        build_trait_flag_cache();
+    }
+    const auto iter = trait_flag_counts->find( b );
+    int ret = iter != trait_flag_counts->end() ? iter->second : 0;
+    for( const mutation_branch *mut_data : activated_mutations ) {
+        if( mut_data->flags.count( b ) == 0 && has_active_or_inactive_flag( *mut_data, b ) ) {
+            ret++;
+        }
+    }
+    for( const trait_id &mut : enchantment_cache->get_mutations() ) {
+        if( my_mutations.count( mut ) > 0 ) {
+            // Already counted above
+            continue;
+        }
         const mutation_branch &mut_data = mut.obj();
-        if( mut_data.flags.count( b ) > 0 ) {
+        if( mut_data.flags.count( b ) > 0 ||
+            ( mut_data.activated && has_active_or_inactive_flag( mut_data, b ) ) ) {
             ret++;
-        } else if( mut_data.activated ) {
-            Character &player = get_player_character();
-            if( ( mut_data.active_flags.count( b ) > 0 && player.has_active_mutation( mut ) ) ||
-                ( mut_data.inactive_flags.count( b ) > 0 && !player.has_active_mutation( mut ) ) ) {
-                ret++;
-            }
         }
     }
-
     return ret;
 }
 
@@ -215,6 +254,7 @@ void Character::set_mutation_unsafe( const trait_id &trait, const mutation_varia
     }
     my_mutations.emplace( trait, trait_data{variant} );
     cached_mutations.push_back( &trait.obj() );
+    trait_flag_counts.reset();
     if( !trait.obj().vanity ) {
         mutation_effect( trait, false );
     }
@@ -270,6 +310,7 @@ void Character::unset_mutation( const trait_id &trait_ )
     cached_mutations.erase( std::remove( cached_mutations.begin(), cached_mutations.end(), &mut ),
                             cached_mutations.end() );
     my_mutations.erase( iter );
+    trait_flag_counts.reset();
     if( !mut.vanity ) {
         mutation_loss_effect( trait );
     }
@@ -504,6 +504,12 @@ struct mutation_branch {
         /** called after all JSON has been read and performs any necessary cleanup tasks */
         static void finalize_all();
         static void finalize_trait_blacklist();
+        /**
+         * Whether any trait changes how monsters of one of @p species react to its owner,
+         * see @ref ignored_by and @ref anger_relations. Lets monsters skip going through
+         * the traits of every character they look at.
+         */
+        static bool any_reacting_species( const std::set<species_id> &species );
         void finalize();
 
         /**
@@ -1,5 +1,6 @@
 #include "mutation.h" // IWYU pragma: associated
 
+#include <algorithm>
 #include <cstdlib>
 #include <map>
 #include <memory>
@@ -48,6 +49,8 @@ generic_factory<mutation_branch> trait_factory( "trait" );
 std::vector<dream> dreams;
 std::map<mutation_category_id, std::vector<trait_id> > mutations_category;
 static std::map<mutation_category_id, mutation_category_trait> mutation_category_traits;
+// Species named in ignored_by or anger_relations of any trait, set by finalize_all
+static std::set<species_id> trait_reacting_species;
 
 template<>
 const mutation_branch &string_id<mutation_branch>::obj() const
@@ -931,6 +934,7 @@ const std::vector<mutation_branch> &mutation_branch::get_all()
 void mutation_branch::reset_all()
 {
     mutations_category.clear();
+    trait_reacting_species.clear();
     trait_factory.reset();
     trait_blacklist.clear();
     trait_groups.clear();
@@ -1029,7 +1033,12 @@ void mutation_branch::finalize()
 void mutation_branch::finalize_all()
 {
     trait_factory.finalize();
+    trait_reacting_species.clear();
     for( const mutation_branch &branch : get_all() ) {
+        trait_reacting_species.insert( branch.ignored_by.begin(), branch.ignored_by.end() );
+        for( const std::pair<const species_id, int> &relation : branch.anger_relations ) {
+            trait_reacting_species.insert( relation.first );
+        }
         for( const mutation_category_id &cat : branch.category ) {
             mutations_category[cat].emplace_back( branch.id );
         }
@@ -1042,6 +1051,13 @@ void mutation_branch::finalize_all()
     finalize_trait_blacklist();
 }
 
+bool mutation_branch::any_reacting_species( const std::set<species_id> &species )
+{
+    return std::any_of( species.begin(), species.end(), []( const species_id & s ) {
+        return trait_reacting_species.count( s ) > 0;
+    } );
+}
+
 void mutation_branch::finalize_trait_blacklist()
 {
     for( const auto &trait : trait_blacklist ) {
@@ -4524,6 +4524,7 @@ void Character::clear_mutations()
     while( !my_mutations.empty() ) {
         const trait_id trait = my_mutations.begin()->first;
         my_mutations.erase( my_mutations.begin() );
+        trait_flag_counts.reset();
         mutation_loss_effect( trait );
     }
     cached_mutations.clear();
@@ -962,6 +962,8 @@ void npc::set_fac( const faction_id &id )
     } else {
         return;
     }
+    // Who counts as friend or foe just changed for everyone around us.
+    get_creature_tracker().note_creatures_changed();
     apply_ownership_to_inv();
 }
 
@@ -2269,13 +2271,33 @@ double npc::value( const item &it, double market_price ) const
 
 faction_price_rule const *npc::get_price_rules( item const &it ) const
 {
+    // Rules match by type, category and item group, which all follow from the item type
+    if( price_rules_cache ) {
+        const auto cached = price_rules_cache->find( it.typeId() );
+        if( cached != price_rules_cache->end() ) {
+            return cached->second;
+        }
+    }
+
     faction_price_rule const *ret = myclass->get_price_rules( it, *this );
     if( ret == nullptr && get_faction() != nullptr ) {
         ret = get_faction()->get_price_rules( it, *this );
     }
+    if( price_rules_cache ) {
+        price_rules_cache->emplace( it.typeId(), ret );
+    }
     return ret;
 }
 
+void npc::set_price_rules_cached( bool cached )
+{
+    if( cached ) {
+        price_rules_cache.emplace();
+    } else {
+        price_rules_cache.reset();
+    }
+}
+
 void healing_options::clear_all()
 {
     bandage = false;
@@ -3195,6 +3217,38 @@ void npc::npc_update_body()
     }
 }
 
+time_duration npc::catch_up_span( const time_duration &remaining ) const
+{
+    // Longest span caught up at once, daily and hourly events still get a chance to fire
+    constexpr time_duration max_span = 6_hours;
+    time_duration span = std::min( remaining, max_span );
+    // An effect running out (waking up, a drug wearing off) changes the rates
+    for( const auto &elem : *effects ) {
+        for( const auto &_effect_it : elem.second ) {
+            const time_duration &time_left = _effect_it.second.get_duration();
+            if( time_left > 1_turns && !_effect_it.second.is_permanent() ) {
+                span = std::min( span, time_left );
+            }
+        }
+    }
+    // update_needs only checks the fatigue thresholds once per update, so stop at the first
+    // 5 minute tick that reaches one
+    const needs_rates rates = calc_needs_rates();
+    int ticks_left = INT_MAX;
+    if( in_sleep_state() ) {
+        if( rates.recovery > 0.0f ) {
+            ticks_left = static_cast<int>( ( get_fatigue() + 20 ) / rates.recovery );
+        }
+    } else if( rates.fatigue > 0.0f && get_fatigue() < 1050 ) {
+        ticks_left = static_cast<int>( ( 1050 - get_fatigue() ) / rates.fatigue );
+    }
+    if( ticks_left < span / 5_minutes ) {
+        span = std::max( ticks_left, 1 ) * 5_minutes;
+    }
+    // Whole 5 minute ticks keep the needs clock in step
+    return std::max( span - span % 5_minutes, 5_minutes );
+}
+
 void npc::on_load()
 {
     const auto advance_effects = [&]( const time_duration & elapsed_dur ) {
@@ -3224,19 +3278,18 @@ void npc::on_load()
     // Cap at some reasonable number, say 2 days
     const time_duration dt = std::min( calendar::turn - last_updated, 2_days );
     // TODO: Sleeping, healing etc.
-    last_updated = calendar::turn;
     time_point cur = calendar::turn - dt;
+    // Spans are contiguous, update_body must not take the first one for an update it already did
+    last_updated = cur;
     add_msg_debug( debugmode::DF_NPC, "on_load() by %s, %d turns", get_name(), to_turns<int>( dt ) );
-    // First update with 30 minute granularity, then 5 minutes, then turns
-    for( ; cur < calendar::turn - 30_minutes; cur += 30_minutes + 1_turns ) {
-        update_body( cur, cur + 30_minutes );
-        advance_effects( 30_minutes );
-        advance_focus( 30 );
-    }
-    for( ; cur < calendar::turn - 5_minutes; cur += 5_minutes + 1_turns ) {
-        update_body( cur, cur + 5_minutes );
-        advance_effects( 5_minutes );
-        advance_focus( 5 );
+    // Nothing around the npc changes while it's away, so update_body integrates its needs over
+    // whole spans at once. Spans end where an effect or the fatigue clock would change course.
+    while( cur < calendar::turn - 5_minutes ) {
+        const time_duration span = catch_up_span( calendar::turn - 5_minutes - cur );
+        update_body( cur, cur + span );
+        advance_effects( span );
+        advance_focus( to_minutes<int>( span ) );
+        cur += span;
     }
     for( ; cur < calendar::turn; cur += 1_turns ) {
         update_body( cur, cur + 1_turns );
@@ -3682,6 +3735,7 @@ void npc::set_attitude( npc_attitude new_attitude )
         return;
     }
     previous_attitude = attitude;
+    get_creature_tracker().note_creatures_changed();
     if( new_attitude == NPCATT_FLEE ) {
         new_attitude = NPCATT_FLEE_TEMP;
     }
@@ -575,6 +575,24 @@ struct npc_short_term_cache {
 
     npc_attack_rating current_attack_evaluation;
     std::shared_ptr<npc_attack> current_attack;
+    // What current_attack was chosen for. While none of it changes, npc::evaluate_best_weapon
+    // keeps the previous choice.
+    struct attack_inputs {
+        const Creature *target = nullptr;
+        int target_hp = 0;
+        unsigned int creatures_version = 0;
+        unsigned int inventory_version = 0;
+
+        bool operator==( const attack_inputs &rhs ) const {
+            return target == rhs.target && target_hp == rhs.target_hp &&
+                   creatures_version == rhs.creatures_version && inventory_version == rhs.inventory_version;
+        }
+    };
+    std::optional<attack_inputs> current_attack_inputs;
+    // When the threats around were last assessed, see npc::regen_ai_cache.
+    time_point danger_assessed_turn = calendar::before_time_starts;
+    unsigned int danger_assessed_creatures_version = 0;
+    unsigned int danger_assessed_inventory_version = 0;
 
 
     // Use weak_ptr to avoid circular references between Creatures
@@ -960,6 +978,12 @@ class npc : public Character
         double value( const item &it ) const;
         double value( const item &it, double market_price ) const;
         faction_price_rule const *get_price_rules( item const &it ) const;
+        /**
+         * Whether to remember the price rules found for each item type. The rule conditions
+         * don't look at the item, but may at anything else, so this is only for a trade, during
+         * which nothing they depend on changes.
+         */
+        void set_price_rules_cached( bool cached );
         bool wear_if_wanted( const item &it, std::string &reason );
         bool can_read( const item &book, std::vector<std::string> &fail_reasons );
         time_duration time_to_read( const item &book, const Character &reader ) const;
@@ -1116,6 +1140,8 @@ class npc : public Character
         float evaluate_self( bool my_gun );
 
         void assess_danger();
+        // Rebuilds the threat part of the ai_cache, see regen_ai_cache().
+        void regen_danger_assessment();
         void act_on_danger_assessment();
         bool is_safe() const;
         // Functions which choose an action for a particular goal
@@ -1397,6 +1423,11 @@ class npc : public Character
          * Retroactively update npc.
          */
         void on_load();
+        /**
+         * Length of the next span @ref on_load can catch up in one @ref update_body, at most
+         * @p remaining.
+         */
+        time_duration catch_up_span( const time_duration &remaining ) const;
         /**
          * Update body, but throttled.
          */
@@ -1448,6 +1479,11 @@ class npc : public Character
         npc_companion_mission comp_mission;
 
         std::string unique_id;
+
+        // Price rules found by get_price_rules for each item type, see set_price_rules_cached
+        // NOLINTNEXTLINE(cata-serialize)
+        mutable std::optional<std::unordered_map<itype_id, faction_price_rule const *>>
+        price_rules_cache;
 };
 
 /** An NPC with standard stats */
@@ -1,10 +1,15 @@
 #include "npc_attack.h"
 
+#include <cmath>
+#include <optional>
+
+#include "avatar.h"
 #include "cata_utility.h"
 #include "character.h"
 #include "creature_tracker.h"
 #include "dialogue.h"
 #include "flag.h"
+#include "game.h"
 #include "item.h"
 #include "line.h"
 #include "magic.h"
@@ -116,6 +121,7 @@ npc_attack_rating npc_attack_spell::evaluate( const npc &source,
         return effectiveness;
     }
     const int time_penalty = base_time_penalty( source );
+    const std::optional<int> cap = potential_cap( source );
     const std::vector<tripoint> targetable_points = attack_spell.targetable_locations( source );
     for( const tripoint &targetable_point : targetable_points ) {
         npc_attack_rating effectiveness_at_point = evaluate_tripoint(
@@ -123,11 +129,59 @@ npc_attack_rating npc_attack_spell::evaluate( const npc &source,
         effectiveness_at_point -= time_penalty;
         if( effectiveness_at_point > effectiveness ) {
             effectiveness = effectiveness_at_point;
+            if( cap && !( effectiveness < *cap - time_penalty ) ) {
+                // no other tile can do better
+                break;
+            }
         }
     }
     return effectiveness;
 }
 
+std::optional<int> npc_attack_spell::upper_bound( const npc &source,
+        const Creature * ) const
+{
+    const std::optional<int> cap = potential_cap( source );
+    if( !cap ) {
+        return std::nullopt;
+    }
+    return *cap - base_time_penalty( source );
+}
+
+std::optional<int> npc_attack_spell::potential_cap( const npc &source ) const
+{
+    if( attack_spell_id->field ) {
+        // empty tiles are worth something too
+        return std::nullopt;
+    }
+    const spell &attack_spell = source.magic->get_spell( attack_spell_id );
+    // every shape stays within this of the caster
+    const int reach = attack_spell.range( source ) + attack_spell.aoe( source ) + 1;
+    const float max_modifier = npc_attack_constants::target_modifier *
+                               npc_attack_constants::kill_modifier;
+    double total_cap = 0;
+    const auto add_cap = [&]( const Creature &critter ) {
+        const int distance_to_me = rl_dist( source.pos(), critter.pos() );
+        if( distance_to_me > reach ) {
+            return;
+        }
+        if( source.attitude_to( critter ) == Creature::Attitude::FRIENDLY ) {
+            // friendly creatures never add more than the distance term
+            total_cap += max_modifier;
+            return;
+        }
+        const int damage = source.sees( critter ) ? attack_spell.dps( source, critter ) : 0;
+        // also covers neutral creatures, whose score is flipped when killed
+        total_cap += ( damage * 3.0 + distance_to_me + 1 ) * max_modifier;
+    };
+    get_creature_tracker().for_each_in_radius( source.get_location(), reach, add_cap );
+    for( const npc &guy : g->all_npcs() ) {
+        add_cap( guy );
+    }
+    add_cap( get_avatar() );
+    return static_cast<int>( std::ceil( total_cap ) ) + 1;
+}
+
 std::vector<npc_attack_rating> npc_attack_spell::all_evaluations( const npc &source,
         const Creature *target ) const
 {
@@ -175,6 +229,8 @@ npc_attack_rating npc_attack_spell::evaluate_tripoint(
     const spell &attack_spell = source.magic->get_spell( attack_spell_id );
 
     double total_potential = 0;
+    // Worked out once, it is the same for every empty tile
+    std::optional<double> field_potential;
 
     creature_tracker &creatures = get_creature_tracker();
     for( const tripoint &potential_target : calculate_spell_effect_area( attack_spell, location,
@@ -184,9 +240,13 @@ npc_attack_rating npc_attack_spell::evaluate_tripoint(
         if( !critter ) {
             // no critter? no damage! however, we assume fields are worth something
             if( attack_spell_id->field ) {
-                dialogue d( get_talker_for( source ), nullptr );
-                total_potential += static_cast<double>( attack_spell.field_intensity( source ) ) /
-                                   static_cast<double>( attack_spell_id->field_chance.evaluate( d ) ) / 2.0;
+                if( !field_potential ) {
+                    dialogue d( get_talker_for( source ), nullptr );
+                    const double intensity = attack_spell.field_intensity( source );
+                    const double chance = attack_spell_id->field_chance.evaluate( d );
+                    field_potential = intensity / chance / 2.0;
+                }
+                total_potential += *field_potential;
             }
             continue;
         }
@@ -52,6 +52,13 @@ class npc_attack
          */
         virtual std::vector<npc_attack_rating> all_evaluations( const npc &source,
                 const Creature *target ) const = 0;
+        /**
+         *  A cheap cap on what evaluate() can return. Candidates whose cap can't beat the best
+         *  attack found so far are not evaluated. No value means there is no cheap cap.
+         */
+        virtual std::optional<int> upper_bound( const npc &, const Creature * ) const {
+            return std::nullopt;
+        }
 
         virtual ~npc_attack() = default;
 };
@@ -68,10 +75,13 @@ class npc_attack_spell : public npc_attack
         npc_attack_rating evaluate( const npc &source, const Creature *target ) const override;
         std::vector<npc_attack_rating> all_evaluations( const npc &source,
                 const Creature *target ) const override;
+        std::optional<int> upper_bound( const npc &source, const Creature *target ) const override;
         void use( npc &source, const tripoint &location ) const override;
     private:
         bool can_use( const npc &source ) const;
         int base_time_penalty( const npc &source ) const;
+        // The most any target tile can score before the time penalty, from the creatures in reach
+        std::optional<int> potential_cap( const npc &source ) const;
         npc_attack_rating evaluate_tripoint(
             const npc &source, const Creature *target, const tripoint &location ) const;
 };
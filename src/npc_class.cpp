@@ -234,11 +234,15 @@ static distribution load_distribution( const JsonObject &jo, const std::string_v
 
 bool shopkeeper_item_group::can_sell( npc const &guy ) const
 {
-    dialogue temp( get_talker_for( get_avatar() ), get_talker_for( guy ) );
     faction *const fac = guy.get_faction();
-
-    return ( fac == nullptr || trust <= guy.get_faction()->trusts_u ) &&
-           ( !condition || condition( temp ) );
+    if( fac != nullptr && trust > fac->trusts_u ) {
+        return false;
+    }
+    if( !condition ) {
+        return true;
+    }
+    dialogue temp( get_talker_for( get_avatar() ), get_talker_for( guy ) );
+    return condition( temp );
 }
 
 bool shopkeeper_item_group::can_restock( npc const &guy ) const
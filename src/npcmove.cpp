@@ -1222,6 +1222,32 @@ bool npc::is_safe() const
     return ai_cache.total_danger <= 0;
 }
 
+void npc::regen_danger_assessment()
+{
+    float old_assessment = ai_cache.danger_assessment;
+    ai_cache.friends.clear();
+    ai_cache.hostile_guys.clear();
+    ai_cache.neutral_guys.clear();
+    ai_cache.target = shared_ptr_fast<Creature>();
+    ai_cache.danger = 0.0f;
+    ai_cache.total_danger = 0.0f;
+    item &weapon = get_wielded_item() ? *get_wielded_item() : null_item_reference();
+    ai_cache.my_weapon_value = weapon_value( weapon );
+    ai_cache.dangerous_explosives = find_dangerous_explosives();
+    mem_combat.formation_distance = -1;
+
+    mem_combat.assess_enemy = 0.0f;
+    mem_combat.assess_ally = 0.0f;
+    mem_combat.swarm_count = 0;
+
+    assess_danger();
+    if( old_assessment > NPC_DANGER_VERY_LOW && ai_cache.danger_assessment <= 0 ) {
+        warn_about( "relax", 30_minutes );
+    } else if( old_assessment <= 0.0f && ai_cache.danger_assessment > NPC_DANGER_VERY_LOW ) {
+        warn_about( "general_danger" );
+    }
+}
+
 void npc::regen_ai_cache()
 {
     map &here = get_map();
@@ -1250,23 +1276,6 @@ void npc::regen_ai_cache()
             ++i;
         }
     }
-    float old_assessment = ai_cache.danger_assessment;
-    ai_cache.friends.clear();
-    ai_cache.hostile_guys.clear();
-    ai_cache.neutral_guys.clear();
-    ai_cache.target = shared_ptr_fast<Creature>();
-    ai_cache.ally = shared_ptr_fast<Creature>();
-    ai_cache.can_heal.clear_all();
-    ai_cache.danger = 0.0f;
-    ai_cache.total_danger = 0.0f;
-    item &weapon = get_wielded_item() ? *get_wielded_item() : null_item_reference();
-    ai_cache.my_weapon_value = weapon_value( weapon );
-    ai_cache.dangerous_explosives = find_dangerous_explosives();
-    mem_combat.formation_distance = -1;
-
-    mem_combat.assess_enemy = 0.0f;
-    mem_combat.assess_ally = 0.0f;
-    mem_combat.swarm_count = 0;
     if( mem_combat.reposition_countdown > 0 ) {
         mem_combat.reposition_countdown --;
     }
@@ -1280,11 +1289,19 @@ void npc::regen_ai_cache()
         path.clear();
     }
 
-    assess_danger();
-    if( old_assessment > NPC_DANGER_VERY_LOW && ai_cache.danger_assessment <= 0 ) {
-        warn_about( "relax", 30_minutes );
-    } else if( old_assessment <= 0.0f && ai_cache.danger_assessment > NPC_DANGER_VERY_LOW ) {
-        warn_about( "general_danger" );
+    ai_cache.ally = shared_ptr_fast<Creature>();
+    ai_cache.can_heal.clear_all();
+
+    // NPCs get here before every action they take. Within a turn, the threats only have to be
+    // looked at again once a creature moved or died or our inventory changed.
+    const unsigned int creatures_version = creatures.creatures_version();
+    if( ai_cache.danger_assessed_turn != calendar::turn ||
+        ai_cache.danger_assessed_creatures_version != creatures_version ||
+        ai_cache.danger_assessed_inventory_version != get_inventory_version() ) {
+        ai_cache.danger_assessed_turn = calendar::turn;
+        ai_cache.danger_assessed_creatures_version = creatures_version;
+        ai_cache.danger_assessed_inventory_version = get_inventory_version();
+        regen_danger_assessment();
     }
     // Non-allied NPCs with a completed mission should move to the player
     if( !is_player_ally() && !is_stationary( true ) ) {
@@ -1989,10 +2006,25 @@ npc_action npc::method_of_attack()
 
 void npc::evaluate_best_weapon( const Creature *target )
 {
+    npc_short_term_cache::attack_inputs inputs;
+    inputs.target = target;
+    inputs.target_hp = target != nullptr ? target->get_hp() : 0;
+    inputs.creatures_version = get_creature_tracker().creatures_version();
+    inputs.inventory_version = get_inventory_version();
+    if( ai_cache.current_attack && ai_cache.current_attack_inputs == inputs ) {
+        return;
+    }
+    ai_cache.current_attack_inputs = inputs;
+
     std::shared_ptr<npc_attack> best_attack;
     npc_attack_rating best_evaluated_attack;
     const auto compare = [&best_attack, &best_evaluated_attack, this, &target]
     ( const std::shared_ptr<npc_attack> &potential_attack ) {
+        const std::optional<int> bound = potential_attack->upper_bound( *this, target );
+        if( bound && !( best_evaluated_attack < *bound ) ) {
+            // can't beat what we already have, so don't bother scoring it
+            return;
+        }
         const npc_attack_rating evaluated = potential_attack->evaluate( *this, target );
         if( evaluated > best_evaluated_attack ) {
             best_attack = potential_attack;
@@ -2810,8 +2842,10 @@ bool npc::update_path( const tripoint &p, const bool no_bashing, bool force )
         }
     }
 
-    std::vector<tripoint> new_path = get_map().route( pos(), p, get_pathfinding_settings( no_bashing ),
-                                     get_path_avoid() );
+    // Scratch buffer shared by all NPCs; swapping it with path below keeps both allocations alive.
+    static std::vector<tripoint> new_path;
+    get_map().hierarchical_route( new_path, pos(), p, get_pathfinding_settings( no_bashing ),
+                                  get_path_avoid() );
     if( new_path.empty() ) {
         if( !ai_cache.sound_alerts.empty() ) {
             ai_cache.sound_alerts.erase( ai_cache.sound_alerts.begin() );
@@ -2827,7 +2861,7 @@ bool npc::update_path( const tripoint &p, const bool no_bashing, bool force )
     }
 
     if( !new_path.empty() || force ) {
-        path = std::move( new_path );
+        path.swap( new_path );
         return true;
     }
 
@@ -3500,18 +3534,19 @@ void npc::find_item()
         return;
     }
 
+    // Looked up once, not again for every item in range
+    std::vector<npc *> followers;
+    for( const character_id &elem : g->get_follower_list() ) {
+        shared_ptr_fast<npc> npc_to_get = overmap_buffer.find_npc( elem );
+        if( !npc_to_get ) {
+            continue;
+        }
+        npc *npc_to_add = npc_to_get.get();
+        followers.push_back( npc_to_add );
+    }
     const auto consider_item =
-        [&wanted, &best_value, this]
+        [&wanted, &best_value, &followers, this]
     ( const item & it, const tripoint & p ) {
-        std::vector<npc *> followers;
-        for( const character_id &elem : g->get_follower_list() ) {
-            shared_ptr_fast<npc> npc_to_get = overmap_buffer.find_npc( elem );
-            if( !npc_to_get ) {
-                continue;
-            }
-            npc *npc_to_add = npc_to_get.get();
-            followers.push_back( npc_to_add );
-        }
         viewer &player_view = get_player_view();
         for( npc *&elem : followers ) {
             if( !it.is_owned_by( *this, true ) && ( player_view.sees( this->pos() ) ||
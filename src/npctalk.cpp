@@ -3752,10 +3752,10 @@ talk_effect_fun_t::func f_location_variable_adjust( const JsonObject &jo,
             target_pos = target_pos + tripoint( 0, 0, dov_z_adjust.evaluate( d ) );
         }
         if( output_var.has_value() ) {
-            write_var_value( output_var.value().type, output_var.value().name,
+            write_var_value( output_var.value(),
                              d.actor( output_var.value().type == var_type::npc ), &d, target_pos.to_string() );
         } else {
-            write_var_value( input_var.value().type, input_var.value().name,
+            write_var_value( input_var.value(),
                              d.actor( input_var.value().type == var_type::npc ), &d, target_pos.to_string() );
         }
     };
@@ -3983,7 +3983,9 @@ talk_effect_fun_t::func f_guard_pos( const JsonObject &jo, std::string_view memb
             var_info cur_var = target_var.value();
             if( unique_id ) {
                 //12 since it should start with npctalk_var
-                cur_var.name.insert( 12, guy->get_unique_id() );
+                std::string name = cur_var.name;
+                name.insert( 12, guy->get_unique_id() );
+                cur_var = var_info( cur_var.type, name, cur_var.default_val );
             }
             tripoint_abs_ms target_location = get_tripoint_from_var( cur_var, d );
             guy->set_guard_pos( target_location );
@@ -4573,7 +4575,7 @@ talk_effect_fun_t::func f_set_string_var( const JsonObject &jo, std::string_view
             talker &beta = d.has_beta ? *d.actor( true ) : *default_talker;
             parse_tags( str, alpha, beta, d );
         }
-        write_var_value( var.type, var.name, d.actor( var.type == var_type::npc ), &d, str );
+        write_var_value( var, d.actor( var.type == var_type::npc ), &d, str );
     };
 }
 
@@ -5535,7 +5537,7 @@ talk_effect_fun_t::func f_foreach( const JsonObject &jo, std::string_view member
         }
 
         for( std::string_view str : list ) {
-            write_var_value( itr.type, itr.name, d.actor( itr.type == var_type::npc ), &d, str.data() );
+            write_var_value( itr, d.actor( itr.type == var_type::npc ), &d, str.data() );
             effect.apply( d );
         }
     };
@@ -6676,16 +6678,18 @@ bool json_talk_response::gen_responses( dialogue &d, bool switch_done ) const
     return false;
 }
 
-// repeat responses always go in front
 bool json_talk_response::gen_repeat_response( dialogue &d, const itype_id &item_id,
-        bool switch_done ) const
+        bool switch_done, std::optional<bool> &condition_met,
+        std::vector<talk_response> &repeated ) const
 {
     if( !is_switch || !switch_done ) {
-        if( test_condition( d ) ) {
-            talk_response result = actual_response;
+        if( !condition_met ) {
+            condition_met = test_condition( d );
+        }
+        if( *condition_met ) {
+            talk_response &result = repeated.emplace_back( actual_response );
             result.success.next_topic.item_type = item_id;
             result.failure.next_topic.item_type = item_id;
-            d.responses.insert( d.responses.begin(), result );
             return is_switch && !is_default;
         }
     }
@@ -6982,12 +6986,14 @@ bool json_talk_topic::gen_responses( dialogue &d ) const
     for( const json_talk_response &r : responses ) {
         switch_done |= r.gen_responses( d, switch_done );
     }
+    std::vector<talk_response> repeated;
     for( const json_talk_repeat_response &repeat : repeat_responses ) {
         talker *actor =  d.actor( repeat.is_npc );
-        std::function<bool( const item & )> filter = return_true<item>;
+        std::optional<bool> condition_met;
         for( const itype_id &item_id : repeat.for_item ) {
             if( actor->charges_of( item_id ) > 0 || actor->has_amount( item_id, 1 ) ) {
-                switch_done |= repeat.response.gen_repeat_response( d, item_id, switch_done );
+                switch_done |= repeat.response.gen_repeat_response( d, item_id, switch_done,
+                               condition_met, repeated );
             }
         }
         for( const item_category_id &category_id : repeat.for_category ) {
@@ -7000,10 +7006,15 @@ bool json_talk_topic::gen_responses( dialogue &d ) const
                 return it.type && it.type->category_force == category_id;
             } );
             for( item * const &it : items_with ) {
-                switch_done |= repeat.response.gen_repeat_response( d, it->typeId(), switch_done );
+                switch_done |= repeat.response.gen_repeat_response( d, it->typeId(), switch_done,
+                               condition_met, repeated );
             }
         }
     }
+    // Repeat responses always go in front, the last one generated first. Inserting them all at
+    // once doesn't shift the other responses for every item.
+    d.responses.insert( d.responses.begin(), std::make_move_iterator( repeated.rbegin() ),
+                        std::make_move_iterator( repeated.rend() ) );
 
     return replace_built_in_responses;
 }
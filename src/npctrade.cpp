@@ -281,6 +281,7 @@ bool npc_trading::trade( npc &np, int cost, const std::string &deal )
     //np.drop_items( np.weight_carried() - np.weight_capacity(),
     //               np.volume_carried() - np.volume_capacity() );
     np.drop_invalid_inventory();
+    np.set_price_rules_cached( true );
 
     std::unique_ptr<trade_ui> tradeui = std::make_unique<trade_ui>( get_avatar(), np, cost, deal );
     trade_ui::trade_result_t trade_result = tradeui->perform_trade();
@@ -332,6 +333,7 @@ bool npc_trading::trade( npc &np, int cost, const std::string &deal )
             player_character.practice( skill_speech, trade_result.value_you / 10000 );
         }
     }
+    np.set_price_rules_cached( false );
     return trade_result.traded ;
 }
 
@@ -578,7 +578,16 @@ class overmap_special
         }
         int longest_side() const;
         std::vector<overmap_special_terrain> preview_terrains() const;
-        std::vector<overmap_special_locations> required_locations() const;
+        const std::vector<overmap_special_locations> &required_locations() const {
+            return required_locations_;
+        }
+        /** @returns the required location at the origin of the special, or nullptr. */
+        const overmap_special_locations *origin_location() const;
+        /**
+         * @returns whether all required locations stay clear of the overmap edges when the special
+         * is placed at @p p with rotation @p r. Cheaper than checking the locations one by one.
+         */
+        bool fits_at( const tripoint_om_omt &p, om_direction::type r ) const;
         int score_rotation_at( const overmap &om, const tripoint_om_omt &p,
                                om_direction::type r ) const;
         special_placement_result place(
@@ -622,6 +631,14 @@ class overmap_special
         // These locations are the default values if ones are not specified for the individual OMTs.
         cata::flat_set<string_id<overmap_location>> default_locations_;
         mapgen_parameters mapgen_params_;
+
+        // Taken from data_ by cache_locations(), they are needed by every placement attempt
+        std::vector<overmap_special_locations> required_locations_;
+        // Bounding box of the required locations in each rotation
+        std::array<std::pair<tripoint, tripoint>, static_cast<size_t>( om_direction::type::last )>
+        rotated_bounds_;
+        int origin_location_ = -1;
+        void cache_locations();
 };
 
 struct overmap_special_migration {
@@ -55,6 +55,8 @@
 std::map<std::string, cata_path> TILESETS; // All found tilesets: <name, tileset_dir>
 std::map<std::string, cata_path> SOUNDPACKS; // All found soundpacks: <name, soundpack_dir>
 
+int options_manager::generation = 0;
+
 namespace
 {
 
@@ -956,6 +958,7 @@ int options_manager::cOpt::getMaxLength() const
 //set to next item
 void options_manager::cOpt::setNext()
 {
+    ++generation;
     if( sType == "string_select" ) {
         int iNext = getItemPos( sSet ) + 1;
         if( iNext >= static_cast<int>( vItems.size() ) ) {
@@ -999,6 +1002,7 @@ void options_manager::cOpt::setNext()
 //set to previous item
 void options_manager::cOpt::setPrev()
 {
+    ++generation;
     if( sType == "string_select" ) {
         int iPrev = static_cast<int>( getItemPos( sSet ) ) - 1;
         if( iPrev < 0 ) {
@@ -1037,6 +1041,7 @@ void options_manager::cOpt::setPrev()
 //set value
 void options_manager::cOpt::setValue( float fSetIn )
 {
+    ++generation;
     if( sType != "float" ) {
         debugmsg( "tried to set a float value to a %s option", sType );
         return;
@@ -1050,6 +1055,7 @@ void options_manager::cOpt::setValue( float fSetIn )
 //set value
 void options_manager::cOpt::setValue( int iSetIn )
 {
+    ++generation;
     if( sType != "int" ) {
         debugmsg( "tried to set an int value to a %s option", sType );
         return;
@@ -1063,6 +1069,7 @@ void options_manager::cOpt::setValue( int iSetIn )
 //set value
 void options_manager::cOpt::setValue( const std::string &sSetIn )
 {
+    ++generation;
     if( sType == "string_select" ) {
         if( getItemPos( sSetIn ) != -1 ) {
             sSet = sSetIn;
@@ -1645,6 +1652,29 @@ void options_manager::add_options_general()
            );
 
         get_option( "AUTOSAVE_MINUTES" ).setPrerequisite( "AUTOSAVE" );
+
+        add( "ASYNC_AUTOSAVE", page_id, to_translation( "Write autosaves in the background" ),
+             to_translation( "If true, autosaves only gather the map data and the game continues while it is written to disk in the background.  Helps with slow or network storage." ),
+             false
+           );
+
+        get_option( "ASYNC_AUTOSAVE" ).setPrerequisite( "AUTOSAVE" );
+
+        add( "MAP_MEMORY_BUDGET", page_id, to_translation( "Map memory budget (MiB)" ),
+             to_translation( "Once the map data kept around outside of the reality bubble takes more memory than this, the least recently visited parts are dropped, and written to disk first if they changed.  0 keeps everything until the next save." ),
+             0, 65536, 0
+           );
+
+        add( "MAP_EVICT_IN_BACKGROUND", page_id,
+             to_translation( "Write dropped map data in the background" ),
+             to_translation( "If true, map data dropped to stay within the map memory budget is written to disk in the background, so the game doesn't wait for it." ),
+             true
+           );
+
+        add( "OVERMAP_MEMORY_BUDGET", page_id, to_translation( "Overmap memory budget (MiB)" ),
+             to_translation( "Once the loaded overmaps take more memory than this, the least recently used ones away from the player are written to disk and dropped.  Overmaps holding NPCs or camps are kept.  0 keeps every overmap until the game is closed." ),
+             0, 65536, 0
+           );
     } );
 
     add_empty_line();
@@ -2254,6 +2284,16 @@ void options_manager::add_options_graphics()
              to_translation( "If true, forces the game to redraw at least once per turn." ),
              true
            );
+
+        add( "REDRAW_RATE_CAP", page_id, to_translation( "Redraw rate cap" ),
+             to_translation( "Most times per second the game redraws on its own while turns pass, e.g. during auto-travel.  Redraws asked for in between are merged into the next one.  0 for no cap." ),
+             0, 240, 60
+           );
+
+        add( "SIMULATION_PRIORITY", page_id, to_translation( "Skip redraws while auto-traveling" ),
+             to_translation( "If true, the game doesn't redraw on its own while auto-traveling, so turns pass as fast as they can.  The screen is updated when travel stops or asks for input." ),
+             false
+           );
     } );
 
     add_empty_line();
@@ -2684,6 +2724,22 @@ void options_manager::add_options_world_default()
     }, "reset"
        );
 
+    add( "SUBMAP_SAVE_FORMAT", "world_default", to_translation( "Map save format" ),
+    to_translation( "Format of the saved map files.  Binary files load noticeably faster, but can't be read by versions of the game that predate them.  Either format can be loaded regardless of this setting." ), {
+        { "json", to_translation( "JSON" ) }, { "binary", to_translation( "Binary" ) }
+    }, "json"
+       );
+
+    add( "MAP_REGION_FILES", "world_default", to_translation( "Pack map files into regions" ),
+         to_translation( "If true, the saved map is packed into one file per map segment instead of one file per overmap tile, which keeps the number of files in a world small.  Existing map files are moved into the region files as they are saved.  Worlds saved like this can't be read by versions of the game that predate it." ),
+         false
+       );
+
+    add( "COMPRESS_SAVES", "world_default", to_translation( "Compress saved maps" ),
+         to_translation( "If true, the saved map and overmaps are compressed, which makes them several times smaller and saves faster on slow disks, at the cost of some processor time.  Either kind of file can be loaded regardless of this setting, but compressed worlds can't be read by versions of the game that predate it." ),
+         false
+       );
+
     add_empty_line();
 
     add_option_group( "world_default", Group( "game_world_opts", to_translation( "Game World Options" ),
@@ -2882,6 +2938,41 @@ void options_manager::add_options_debug()
          0, OVERMAP_LAYERS, 4
        );
 
+    add( "PARALLEL_MAP_CACHE", "debug", to_translation( "Parallel map cache rebuild" ),
+         to_translation( "If true, the per-level transparency, outside and floor caches are rebuilt on several threads at once.  Only matters when z-levels are enabled.  Results are identical to the single-threaded rebuild." ),
+         false
+       );
+
+    add( "PARALLEL_MONSTER_PLANNING", "debug", to_translation( "Parallel monster sight checks" ),
+         to_translation( "If true, the lines of sight monsters and NPCs check while planning their moves are traced on several threads before they move.  Their behavior is the same either way." ),
+         false
+       );
+
+    add( "SIGHT_MEMO", "debug", to_translation( "Remember sight checks" ),
+         to_translation( "If true, whether one creature sees another is only worked out once per turn, unless one of them moves or the map changes.  Other changes, such as a creature becoming blind, may then take until the next turn to be noticed." ),
+         false
+       );
+
+    add( "DORMANT_MONSTERS", "debug", to_translation( "Dormant distant monsters" ),
+         to_translation( "If true, monsters far away from every character that have had nothing to do for a while only plan and move every few turns, until they notice something, hear a sound or smell a scent." ),
+         false
+       );
+
+    add( "ITEM_PROCESSING_BUDGET", "debug", to_translation( "Item processing budget" ),
+         to_translation( "How many food items, corpses and other slowly changing items may be processed per turn before they are spread out over more turns.  Their temperature and rot catch up on the time they were skipped.  Setting this to 0 disables the budget." ),
+         0, 100000, 0
+       );
+
+    add( "FAST_ROT_CATCH_UP", "debug", to_translation( "Fast rot catch-up" ),
+         to_translation( "If true, food that was out of the reality bubble for more than two days adds up the rot of that time from a table of hourly temperatures shared with other items in the same spot, instead of working through it hour by hour.  The weather is then looked at on the hour, so the amount of rot can differ very slightly." ),
+         false
+       );
+
+    add( "DEFERRED_GAS_SPREAD", "debug", to_translation( "Deferred gas spreading" ),
+         to_translation( "If true, gases decide where to spread based on the fields as they were at the start of the turn, and the spreading is applied once all fields have been processed.  This makes the result independent of the order in which tiles are processed." ),
+         false
+       );
+
     add_empty_line();
 
     add_option_group( "debug", Group( "occlusion_opts", to_translation( "Occlusion Options" ),
@@ -3944,6 +4035,7 @@ std::string options_manager::show( bool ingame, const bool world_options_only, b
             }
         }
     }
+    ++generation;
 
     if( lang_changed ) {
         update_global_locale();
@@ -4040,6 +4132,7 @@ std::string options_manager::migrateOptionValue( const std::string &name,
 
 void options_manager::update_options_cache()
 {
+    ++generation;
     // cache to global due to heavy usage.
     trigdist = ::get_option<bool>( "CIRCLEDIST" );
     use_tiles = ::get_option<bool>( "USE_TILES" );
@@ -4058,6 +4151,15 @@ void options_manager::update_options_cache()
     message_ttl = ::get_option<int>( "MESSAGE_TTL" );
     message_cooldown = ::get_option<int>( "MESSAGE_COOLDOWN" );
     fov_3d_z_range = ::get_option<int>( "FOV_3D_Z_RANGE" );
+    parallel_map_cache = ::get_option<bool>( "PARALLEL_MAP_CACHE" );
+    parallel_monster_planning = ::get_option<bool>( "PARALLEL_MONSTER_PLANNING" );
+    memoize_sight = ::get_option<bool>( "SIGHT_MEMO" );
+    dormant_monsters = ::get_option<bool>( "DORMANT_MONSTERS" );
+    item_processing_budget = ::get_option<int>( "ITEM_PROCESSING_BUDGET" );
+    fast_rot_catch_up = ::get_option<bool>( "FAST_ROT_CATCH_UP" );
+    deferred_gas_spread = ::get_option<bool>( "DEFERRED_GAS_SPREAD" );
+    redraw_rate_cap = ::get_option<int>( "REDRAW_RATE_CAP" );
+    simulation_priority = ::get_option<bool>( "SIMULATION_PRIORITY" );
     keycode_mode = ::get_option<std::string>( "SDL_KEYBOARD_MODE" ) == "keycode";
     use_pinyin_search = ::get_option<bool>( "USE_PINYIN_SEARCH" );
 
@@ -4144,6 +4246,7 @@ options_manager::options_container options_manager::get_world_defaults() const
 
 void options_manager::set_world_options( options_container *options )
 {
+    ++generation;
     if( options == nullptr ) {
         world_options.reset();
     } else {
@@ -220,6 +220,8 @@ class options_manager
 
         // updates the caches in options_cache.h
         static void update_options_cache();
+        // Bumped whenever an option value may have changed, see option_handle
+        static int generation;
 
         /**
          * Returns a copy of the options in the "world default" page. The options have their
@@ -500,4 +502,32 @@ inline T get_option( const std::string &name, bool convert = false )
     return get_options().get_option( name ).value_as<T>( convert );
 }
 
+/**
+ * Typed handle to an option read on hot paths. Unlike @ref get_option, which looks the
+ * option up by name on every read, it keeps the value and only looks it up again after
+ * an option changed. Declare it static where it is read:
+ *
+ *     static const option_handle<bool> opt_animations( "ANIMATIONS" );
+ *     if( opt_animations.get() ) { ... }
+ */
+template<typename T>
+class option_handle
+{
+    public:
+        explicit option_handle( const char *name ) : name( name ) { }
+
+        const T &get() const {
+            if( seen_generation != options_manager::generation ) {
+                value = get_option<T>( name );
+                seen_generation = options_manager::generation;
+            }
+            return value;
+        }
+
+    private:
+        const char *name;
+        mutable T value = T();
+        mutable int seen_generation = -1;
+};
+
 #endif // CATA_SRC_OPTIONS_H
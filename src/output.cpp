@@ -265,6 +265,60 @@ void print_colored_text( const catacurses::window &w, const point &p, nc_color &
     }
 }
 
+formatted_text::formatted_text( const std::string_view text, const nc_color &base_color,
+                                const report_color_error color_error )
+{
+    std::stack<nc_color> color_stack;
+    color_stack.push( base_color );
+
+    for( std::string seg : split_by_color( text ) ) {
+        if( seg.empty() ) {
+            continue;
+        }
+
+        if( seg[0] == '<' ) {
+            const color_tag_parse_result::tag_type type = update_color_stack(
+                        color_stack, seg, color_error );
+            if( type != color_tag_parse_result::non_color_tag ) {
+                seg = rm_prefix( seg );
+            }
+        }
+        if( seg.empty() ) {
+            continue;
+        }
+
+        const nc_color color = color_stack.empty() ? base_color : color_stack.top();
+        const int seg_width = utf8_width( seg );
+        width_ += seg_width;
+        if( !spans_.empty() && spans_.back().color == color ) {
+            spans_.back().text += seg;
+            spans_.back().width += seg_width;
+        } else {
+            spans_.push_back( span{ color, std::move( seg ), seg_width } );
+        }
+    }
+}
+
+std::vector<formatted_text> formatted_text::fold( const std::string &text, const int width,
+        const nc_color &base_color )
+{
+    std::vector<formatted_text> lines;
+    for( const std::string &line : foldstring( text, width ) ) {
+        lines.emplace_back( line, base_color );
+    }
+    return lines;
+}
+
+void formatted_text::print( const catacurses::window &w, const point &p ) const
+{
+    if( p.y > -1 && p.x > -1 ) {
+        wmove( w, p );
+    }
+    for( const span &s : spans_ ) {
+        wprintz( w, s.color, s.text );
+    }
+}
+
 void trim_and_print( const catacurses::window &w, const point &begin,
                      const int width, const nc_color &base_color,
                      const std::string &text,
@@ -2148,6 +2202,7 @@ void multiline_list::set_up_navigation( input_context &ctxt )
 void scrolling_text_view::set_text( const std::string &text, const bool scroll_to_top )
 {
     text_ = foldstring( text, text_width() );
+    formatted_.clear();
     if( scroll_to_top ) {
         offset_ = 0;
     } else {
@@ -2199,11 +2254,16 @@ void scrolling_text_view::draw( const nc_color &base_color )
         }
     }
 
-    nc_color color = base_color;
+    if( formatted_.size() != text_.size() || formatted_color_ != base_color ) {
+        formatted_.clear();
+        for( const std::string &line : text_ ) {
+            formatted_.emplace_back( line, base_color );
+        }
+        formatted_color_ = base_color;
+    }
     int end = std::min( num_lines() - offset_, height );
     for( int line_num = 0; line_num < end; ++line_num ) {
-        print_colored_text( w_, point( 1, line_num ), color, base_color,
-                            text_[line_num + offset_] );
+        formatted_[line_num + offset_].print( w_, point( 1, line_num ) );
     }
 
     wnoutrefresh( w_ );
@@ -210,6 +210,48 @@ std::vector<std::string> foldstring( const std::string &str, int width, char spl
 void print_colored_text( const catacurses::window &w, const point &p, nc_color &cur_color,
                          const nc_color &base_color, std::string_view text,
                          report_color_error color_error = report_color_error::yes );
+
+/**
+ * Text with its @ref color_tags parsed once into spans of one color each.
+ * Meant for strings drawn every frame without changing (item info, help text, recipe
+ * descriptions), so that drawing them no longer splits, parses and measures the text.
+ */
+class formatted_text
+{
+    public:
+        struct span {
+            nc_color color;
+            std::string text;
+            // Display width of text, see @ref utf8_width
+            int width;
+        };
+
+        formatted_text() = default;
+        /**
+         * Parses @p text the way @ref print_colored_text would with both colors set to
+         * @p base_color.
+         */
+        formatted_text( std::string_view text, const nc_color &base_color,
+                        report_color_error color_error = report_color_error::yes );
+
+        /** @p text folded to @p width (see @ref foldstring), one entry per line. */
+        static std::vector<formatted_text> fold( const std::string &text, int width,
+                const nc_color &base_color );
+
+        const std::vector<span> &spans() const {
+            return spans_;
+        }
+        int width() const {
+            return width_;
+        }
+
+        /** Same output as @ref print_colored_text on the original text. */
+        void print( const catacurses::window &w, const point &p ) const;
+
+    private:
+        std::vector<span> spans_;
+        int width_ = 0;
+};
 /**
  * Print word wrapped text (with @ref color_tags) into the window.
  *
@@ -1044,6 +1086,9 @@ class scrolling_text_view
 
         catacurses::window &w_;
         std::vector<std::string> text_;
+        // text_ parsed for drawing in formatted_color_, rebuilt when either changes
+        std::vector<formatted_text> formatted_;
+        nc_color formatted_color_;
         int offset_ = 0;
         std::string scroll_up_action;
         std::string scroll_down_action;
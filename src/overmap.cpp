@@ -2645,7 +2645,9 @@ overmap_special::overmap_special( const overmap_special_id &i, const overmap_spe
     : id( i )
     , subtype_( overmap_special_subtype::fixed )
     , data_{ make_shared_fast<fixed_overmap_special_data>( ter ) }
-{}
+{
+    cache_locations();
+}
 
 bool overmap_special::can_spawn() const
 {
@@ -2683,7 +2685,7 @@ int overmap_special::longest_side() const
 {
     // Figure out the longest side of the special for purposes of determining our sector size
     // when attempting placements.
-    std::vector<overmap_special_locations> req_locations = required_locations();
+    const std::vector<overmap_special_locations> &req_locations = required_locations();
     auto min_max_x = std::minmax_element( req_locations.begin(), req_locations.end(),
     []( const overmap_special_locations & lhs, const overmap_special_locations & rhs ) {
         return lhs.p.x < rhs.p.x;
@@ -2704,9 +2706,43 @@ std::vector<overmap_special_terrain> overmap_special::preview_terrains() const
     return data_->preview_terrains();
 }
 
-std::vector<overmap_special_locations> overmap_special::required_locations() const
+const overmap_special_locations *overmap_special::origin_location() const
+{
+    return origin_location_ < 0 ? nullptr : &required_locations_[origin_location_];
+}
+
+bool overmap_special::fits_at( const tripoint_om_omt &p, om_direction::type r ) const
 {
-    return data_->required_locations();
+    if( required_locations_.empty() ) {
+        return true;
+    }
+    const std::pair<tripoint, tripoint> &bounds = rotated_bounds_[static_cast<size_t>( r )];
+    return overmap::inbounds( p + bounds.first, 1 ) && overmap::inbounds( p + bounds.second, 1 );
+}
+
+void overmap_special::cache_locations()
+{
+    required_locations_ = data_->required_locations();
+    origin_location_ = -1;
+    for( size_t i = 0; i < required_locations_.size(); ++i ) {
+        if( required_locations_[i].p == tripoint_zero ) {
+            origin_location_ = static_cast<int>( i );
+            break;
+        }
+    }
+    for( om_direction::type r : om_direction::all ) {
+        std::pair<tripoint, tripoint> &bounds = rotated_bounds_[static_cast<size_t>( r )];
+        bounds = { tripoint_max, tripoint_min };
+        for( const overmap_special_locations &loc : required_locations_ ) {
+            const tripoint rp = om_direction::rotate( loc.p, r );
+            bounds.first.x = std::min( bounds.first.x, rp.x );
+            bounds.first.y = std::min( bounds.first.y, rp.y );
+            bounds.first.z = std::min( bounds.first.z, rp.z );
+            bounds.second.x = std::max( bounds.second.x, rp.x );
+            bounds.second.y = std::max( bounds.second.y, rp.y );
+            bounds.second.z = std::max( bounds.second.z, rp.z );
+        }
+    }
 }
 
 int overmap_special::score_rotation_at( const overmap &om, const tripoint_om_omt &p,
@@ -2830,6 +2866,7 @@ void overmap_special::finalize()
 {
     const_cast<overmap_special_data &>( *data_ ).finalize(
         "overmap special " + id.str(), default_locations_ );
+    cache_locations();
 }
 
 void overmap_special::finalize_mapgen_parameters()
@@ -2932,7 +2969,12 @@ void overmap::ter_set( const tripoint_om_omt &p, const oter_id &id )
         return;
     }
 
+    load_terrain( p.z() );
     oter_id &current_oter = layer[p.z() + OVERMAP_DEPTH].terrain[p.xy()];
+    if( current_oter != id ) {
+        terrain_indices[p.z() + OVERMAP_DEPTH].valid = false;
+        overmap_buffer.invalidate_travel_paths();
+    }
     const oter_type_str_id &current_type_id = current_oter->get_type_id();
     const oter_type_str_id &incoming_type_id = id->get_type_id();
     const bool current_type_same = current_type_id == incoming_type_id;
@@ -2978,9 +3020,83 @@ const oter_id &overmap::ter( const tripoint_om_omt &p ) const
 
 const oter_id &overmap::ter_unsafe( const tripoint_om_omt &p ) const
 {
+    load_terrain( p.z() );
     return layer[p.z() + OVERMAP_DEPTH].terrain[p.xy()];
 }
 
+const overmap::terrain_index &overmap::get_terrain_index( const int z ) const
+{
+    terrain_index &index = terrain_indices[z + OVERMAP_DEPTH];
+    if( index.valid ) {
+        return index;
+    }
+    // Terrain with more locations than this is cheaper to find by looking at the whole area.
+    static constexpr size_t max_sparse_locations = 512;
+
+    load_terrain( z );
+    const cata::mdarray<oter_id, point_om_omt> &terrain = layer[z + OVERMAP_DEPTH].terrain;
+    index.sparse.clear();
+    index.dense.clear();
+    for( int j = 0; j < OMAPY; j++ ) {
+        for( int i = 0; i < OMAPX; i++ ) {
+            const oter_id &id = terrain[i][j];
+            if( std::find( index.dense.begin(), index.dense.end(), id ) != index.dense.end() ) {
+                continue;
+            }
+            std::vector<point_om_omt> &locations = index.sparse[id];
+            if( locations.size() < max_sparse_locations ) {
+                locations.emplace_back( i, j );
+            } else {
+                index.sparse.erase( id );
+                index.dense.push_back( id );
+            }
+        }
+    }
+    index.valid = true;
+    return index;
+}
+
+void overmap::find_matching_terrain( const int z, const point_om_omt &min,
+                                     const point_om_omt &max,
+                                     const std::function<bool( const oter_id & )> &matches,
+                                     std::vector<tripoint_om_omt> &result ) const
+{
+    const terrain_index &index = get_terrain_index( z );
+    for( const auto &[id, locations] : index.sparse ) {
+        if( !matches( id ) ) {
+            continue;
+        }
+        auto it = std::lower_bound( locations.begin(), locations.end(), min.y(),
+        []( const point_om_omt & p, int y ) {
+            return p.y() < y;
+        } );
+        for( ; it != locations.end() && it->y() <= max.y(); ++it ) {
+            if( it->x() >= min.x() && it->x() <= max.x() ) {
+                result.emplace_back( *it, z );
+            }
+        }
+    }
+
+    std::vector<oter_id> dense_matches;
+    for( const oter_id &id : index.dense ) {
+        if( matches( id ) ) {
+            dense_matches.push_back( id );
+        }
+    }
+    if( dense_matches.empty() ) {
+        return;
+    }
+    const cata::mdarray<oter_id, point_om_omt> &terrain = layer[z + OVERMAP_DEPTH].terrain;
+    for( int j = min.y(); j <= max.y(); j++ ) {
+        for( int i = min.x(); i <= max.x(); i++ ) {
+            if( std::find( dense_matches.begin(), dense_matches.end(),
+                           terrain[i][j] ) != dense_matches.end() ) {
+                result.emplace_back( i, j, z );
+            }
+        }
+    }
+}
+
 std::optional<mapgen_arguments> *overmap::mapgen_args( const tripoint_om_omt &p )
 {
     auto it = mapgen_args_index.find( p );
@@ -3019,6 +3135,7 @@ void overmap::set_seen( const tripoint_om_omt &p, bool val )
     }
 
     layer[p.z() + OVERMAP_DEPTH].visible[p.xy()] = val;
+    overmap_buffer.invalidate_seen_travel_paths();
 
     if( val ) {
         add_extra_note( p );
@@ -3055,7 +3172,7 @@ bool overmap::mongroup_check( const mongroup &candidate ) const
     tripoint_om_sm relp = candidate.rel_pos();
     const auto matching_range = zg.equal_range( relp );
     return std::find_if( matching_range.first, matching_range.second,
-    [candidate]( const std::pair<tripoint_om_sm, mongroup> &match ) {
+    [candidate]( const horde_map::value_type &match ) {
         // This is extra strict since we're using it to test serialization.
         return candidate.type == match.second.type && candidate.abs_pos == match.second.abs_pos &&
                candidate.population == match.second.population &&
@@ -3181,6 +3298,9 @@ void overmap::add_note( const tripoint_om_omt &p, std::string message )
     } else if( !message.empty() ) {
         it->text = std::move( message );
     } else {
+        if( it->dangerous ) {
+            overmap_buffer.invalidate_travel_paths();
+        }
         notes.erase( it );
     }
 }
@@ -3191,6 +3311,7 @@ void overmap::mark_note_dangerous( const tripoint_om_omt &p, int radius, bool is
         if( p.xy() == i.p ) {
             i.dangerous = is_dangerous;
             i.danger_radius = radius;
+            overmap_buffer.invalidate_travel_paths();
             return;
         }
     }
@@ -3897,17 +4018,15 @@ tripoint_om_omt overmap::find_random_omt( const std::pair<std::string, ot_match_
 
 void overmap::process_mongroups()
 {
-    for( auto it = zg.begin(); it != zg.end(); ) {
-        mongroup &mg = it->second;
+    for( horde_map::value_type &entry : zg ) {
+        mongroup &mg = entry.second;
         if( mg.dying ) {
             mg.population = ( mg.population * 4 ) / 5;
         }
-        if( mg.empty() ) {
-            zg.erase( it++ );
-        } else {
-            ++it;
-        }
     }
+    zg.erase_if( []( const mongroup & mg ) {
+        return mg.empty();
+    } );
 }
 
 void overmap::clear_mon_groups()
@@ -4009,14 +4128,11 @@ void mongroup::wander( const overmap &om )
 
 void overmap::move_hordes()
 {
-    // Prevent hordes to be moved twice by putting them in here after moving.
-    decltype( zg ) tmpzg;
     //MOVE ZOMBIE GROUPS
-    for( auto it = zg.begin(); it != zg.end(); ) {
-        mongroup &mg = it->second;
+    for( horde_map::value_type &entry : zg ) {
+        mongroup &mg = entry.second;
         if( !mg.horde || mg.behaviour == mongroup::horde_behaviour::nemesis ) {
             //nemesis hordes have their own move function
-            ++it;
             continue;
         }
 
@@ -4065,16 +4181,10 @@ void overmap::move_hordes()
             if( mg.abs_pos.y() < mg.target.y() ) {
                 mg.abs_pos.y()++;
             }
-
-            // Erase the group at it's old location, add the group with the new location
-            tmpzg.emplace( mg.rel_pos(), mg );
-            zg.erase( it++ );
-        } else {
-            ++it;
         }
     }
-    // and now back into the monster group map.
-    zg.insert( tmpzg.begin(), tmpzg.end() );
+    // Moved in place, re-key them by their new location
+    zg.update_positions();
 
     if( get_option<bool>( "WANDER_SPAWNS" ) ) {
 
@@ -4122,7 +4232,7 @@ void overmap::move_hordes()
             auto group_bucket = zg.equal_range( p );
             std::vector<monster>::size_type add_to_horde_size = 0;
             std::for_each( group_bucket.first, group_bucket.second,
-            [&]( std::pair<const tripoint_om_sm, mongroup> &horde_entry ) {
+            [&]( horde_map::value_type & horde_entry ) {
                 mongroup &horde = horde_entry.second;
 
                 // We only absorb zombies into GROUP_ZOMBIE hordes
@@ -4160,13 +4270,10 @@ void overmap::move_hordes()
 
 void overmap::move_nemesis()
 {
-    // Prevent hordes to be moved twice by putting them in here after moving.
-    decltype( zg ) tmpzg;
     //cycle through zombie groups, skip non-nemesis hordes
-    for( std::multimap<tripoint_om_sm, mongroup>::iterator it = zg.begin(); it != zg.end(); ) {
-        mongroup &mg = it->second;
+    for( horde_map::value_type &entry : zg ) {
+        mongroup &mg = entry.second;
         if( !mg.horde || mg.behaviour != mongroup::horde_behaviour::nemesis ) {
-            ++it;
             continue;
         }
 
@@ -4209,9 +4316,8 @@ void overmap::move_nemesis()
             //update the horde's om_sm coords from the abs_sm so it can spawn in correctly
             if( project_to<coords::om>( mg.nemesis_target ) == omp ) {
 
-                // Erase the group at its old location, add the group with the new location
-                tmpzg.emplace( mg.rel_pos(), mg );
-                zg.erase( it++ );
+                // Re-key the group by its new location
+                zg.update_positions();
 
                 //there is only one nemesis horde, so we can stop looping after we move it
                 break;
@@ -4226,21 +4332,16 @@ void overmap::move_nemesis()
             break;
         }
     }
-    // and now back into the monster group map.
-    zg.insert( tmpzg.begin(), tmpzg.end() );
-
 }
 
 bool overmap::remove_nemesis()
 {
     //cycle through zombie groups, find nemesis horde
-    for( std::multimap<tripoint_om_sm, mongroup>::iterator it = zg.begin(); it != zg.end(); ) {
-        mongroup &mg = it->second;
-        if( mg.behaviour == mongroup::horde_behaviour::nemesis ) {
-            zg.erase( it++ );
+    for( auto it = zg.begin(); it != zg.end(); ++it ) {
+        if( it->second.behaviour == mongroup::horde_behaviour::nemesis ) {
+            zg.erase( it );
             return true;
         }
-        it++;
     }
     return false;
 }
@@ -4249,23 +4350,33 @@ bool overmap::remove_nemesis()
 * @param p location of signal relative to this overmap origin
 * @param sig_power - power of signal or max distance for reaction of zombies
 */
-void overmap::signal_hordes( const tripoint_rel_sm &p_rel, const int sig_power )
+void overmap::signal_hordes( const std::vector<horde_signal> &signals )
 {
-    tripoint_om_sm p( p_rel.raw() );
-    tripoint_abs_sm absp = project_combine( pos(), p );
     for( auto &elem : zg ) {
         mongroup &mg = elem.second;
         if( !mg.horde ) {
             continue;
         }
-        const int dist = rl_dist( absp, mg.abs_pos );
-        if( sig_power < dist ) {
-            continue;
-        }
         if( mg.behaviour == mongroup::horde_behaviour::nemesis ) {
             // nemesis hordes are signaled to the player by their own function and dont react to noise
             continue;
         }
+        // The signal with the most power left when it reaches the horde
+        const horde_signal *loudest = nullptr;
+        int dist = 0;
+        for( const horde_signal &signal : signals ) {
+            const int signal_dist = rl_dist( signal.center, mg.abs_pos );
+            if( signal_dist <= signal.power &&
+                ( !loudest || signal.power - signal_dist > loudest->power - dist ) ) {
+                loudest = &signal;
+                dist = signal_dist;
+            }
+        }
+        if( !loudest ) {
+            continue;
+        }
+        const tripoint_abs_sm &absp = loudest->center;
+        const int sig_power = loudest->power;
         // TODO: base this in monster attributes, foremost GOODHEARING.
         const int inter_per_sig_power = 15; //Interest per signal value
         const int min_initial_inter = 30; //Min initial interest for horde
@@ -4294,7 +4405,7 @@ void overmap::signal_hordes( const tripoint_rel_sm &p_rel, const int sig_power )
 
 void overmap::signal_nemesis( const tripoint_abs_sm &p_abs_sm )
 {
-    for( std::pair<const tripoint_om_sm, mongroup> &elem : zg ) {
+    for( horde_map::value_type &elem : zg ) {
         mongroup &mg = elem.second;
 
         if( mg.behaviour == mongroup::horde_behaviour::nemesis ) {
@@ -4528,7 +4639,8 @@ void overmap::place_forest_trailheads()
 void overmap::place_forests()
 {
     const oter_id default_oter_id( settings->default_oter[OVERMAP_DEPTH] );
-    const om_noise::om_noise_layer_forest f( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_layer_forest noise( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_layer_precomputed f( noise );
 
     for( int x = 0; x < OMAPX; x++ ) {
         for( int y = 0; y < OMAPY; y++ ) {
@@ -4556,7 +4668,8 @@ void overmap::place_forests()
 
 void overmap::place_lakes()
 {
-    const om_noise::om_noise_layer_lake f( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_layer_lake noise( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_layer_precomputed f( noise );
 
     const auto is_lake = [&]( const point_om_omt & p ) {
         // credit to ehughsbaird for thinking up this inbounds solution to infinite flood fill lag.
@@ -6540,7 +6653,7 @@ bool overmap::can_place_special( const overmap_special &special, const tripoint_
 {
     cata_assert( dir != om_direction::type::invalid );
 
-    if( !special.id ) {
+    if( !special.id || !special.fits_at( p, dir ) ) {
         return false;
     }
     if( special.has_flag( "GLOBALLY_UNIQUE" ) &&
@@ -6548,23 +6661,12 @@ bool overmap::can_place_special( const overmap_special &special, const tripoint_
         return false;
     }
 
-    if( special.has_eoc() ) {
-        dialogue d( get_talker_for( get_avatar() ), nullptr );
-        if( !special.get_eoc()->test_condition( d ) ) {
-            return false;
-        }
-    }
-
-    const std::vector<overmap_special_locations> fixed_terrains = special.required_locations();
+    const std::vector<overmap_special_locations> &fixed_terrains = special.required_locations();
 
-    return std::all_of( fixed_terrains.begin(), fixed_terrains.end(),
+    const bool terrain_fits = std::all_of( fixed_terrains.begin(), fixed_terrains.end(),
     [&]( const overmap_special_locations & elem ) {
         const tripoint_om_omt rp = p + om_direction::rotate( elem.p, dir );
 
-        if( !inbounds( rp, 1 ) ) {
-            return false;
-        }
-
         if( must_be_unexplored ) {
             // If this must be unexplored, check if we've already got a submap generated.
             const bool existing_submap = is_omt_generated( rp );
@@ -6580,6 +6682,18 @@ bool overmap::can_place_special( const overmap_special &special, const tripoint_
 
         return elem.can_be_placed_on( tid ) || ( rp.z() != 0 && tid == get_default_terrain( rp.z() ) );
     } );
+    if( !terrain_fits ) {
+        return false;
+    }
+
+    // Setting up the dialogue is the most expensive part, so it goes last
+    if( special.has_eoc() ) {
+        dialogue d( get_talker_for( get_avatar() ), nullptr );
+        if( !special.get_eoc()->test_condition( d ) ) {
+            return false;
+        }
+    }
+    return true;
 }
 
 // checks around the selected point to see if the special can be placed there
@@ -6620,14 +6734,10 @@ std::vector<tripoint_om_omt> overmap::place_special(
     }
     // If it's a safe zone, remove existing spawns
     if( is_safe_zone ) {
-        for( auto it = zg.begin(); it != zg.end(); ) {
-            tripoint_om_omt pos = project_to<coords::omt>( it->second.rel_pos() );
-            if( safe_at_worldgen.find( pos ) != safe_at_worldgen.end() ) {
-                zg.erase( it++ );
-            } else {
-                ++it;
-            }
-        }
+        zg.erase_if( [&]( const mongroup & mg ) {
+            const tripoint_om_omt pos = project_to<coords::omt>( mg.rel_pos() );
+            return safe_at_worldgen.find( pos ) != safe_at_worldgen.end();
+        } );
     }
 
     return result.omts_used;
@@ -6658,41 +6768,51 @@ bool overmap::place_special_attempt(
                              rng( p2.y(), p2.y() + sector_width - 1 ), 0 );
     const city &nearest_city = get_nearest_city( p );
 
+    // Specials with higher priority are tried first, in random order within each priority.
     std::shuffle( enabled_specials.begin(), enabled_specials.end(), rng_get_engine() );
-    std::set<int> priorities;
-    for( const overmap_special_placement &os : enabled_specials ) {
-        priorities.emplace( os.special_details->get_priority() );
-    }
-    for( auto pri_iter = priorities.rbegin(); pri_iter != priorities.rend(); ++pri_iter ) {
-        for( auto iter = enabled_specials.begin(); iter != enabled_specials.end(); ++iter ) {
-            const overmap_special &special = *iter->special_details;
-            if( *pri_iter != special.get_priority() ) {
-                continue;
-            }
-            const overmap_special_placement_constraints &constraints = special.get_constraints();
-            // If we haven't finished placing minimum instances of all specials,
-            // skip specials that are at their minimum count already.
-            if( !place_optional && iter->instances_placed >= constraints.occurrences.min ) {
-                continue;
-            }
-            // City check is the fastest => it goes first.
-            if( !special.can_belong_to_city( p, nearest_city ) ) {
-                continue;
-            }
-            // See if we can actually place the special there.
-            const om_direction::type rotation = random_special_rotation( special, p, must_be_unexplored );
-            if( rotation == om_direction::type::invalid ) {
-                continue;
-            }
-
-            place_special( special, p, rotation, nearest_city, false, must_be_unexplored );
+    std::stable_sort( enabled_specials.begin(), enabled_specials.end(),
+    []( const overmap_special_placement & lhs, const overmap_special_placement & rhs ) {
+        return lhs.special_details->get_priority() > rhs.special_details->get_priority();
+    } );
+    const oter_id &origin_ter = ter( p );
+    for( auto iter = enabled_specials.begin(); iter != enabled_specials.end(); ++iter ) {
+        const overmap_special &special = *iter->special_details;
+        const overmap_special_placement_constraints &constraints = special.get_constraints();
+        // If we haven't finished placing minimum instances of all specials,
+        // skip specials that are at their minimum count already.
+        if( !place_optional && iter->instances_placed >= constraints.occurrences.min ) {
+            continue;
+        }
+        // The origin stays in place whatever the rotation, so its terrain rules the special
+        // out before anything else is looked at.
+        const overmap_special_locations *origin = special.origin_location();
+        if( origin && !origin->can_be_placed_on( origin_ter ) ) {
+            continue;
+        }
+        const bool fits = std::any_of( om_direction::all.begin(), om_direction::all.end(),
+        [&]( om_direction::type r ) {
+            return special.fits_at( p, r );
+        } );
+        if( !fits ) {
+            continue;
+        }
+        if( !special.can_belong_to_city( p, nearest_city ) ) {
+            continue;
+        }
+        // See if we can actually place the special there.
+        const om_direction::type rotation = random_special_rotation( special, p,
+                                            must_be_unexplored );
+        if( rotation == om_direction::type::invalid ) {
+            continue;
+        }
 
-            if( ++iter->instances_placed >= constraints.occurrences.max ) {
-                enabled_specials.erase( iter );
-            }
+        place_special( special, p, rotation, nearest_city, false, must_be_unexplored );
 
-            return true;
+        if( ++iter->instances_placed >= constraints.occurrences.max ) {
+            enabled_specials.erase( iter );
         }
+
+        return true;
     }
 
     return false;
@@ -6735,19 +6855,15 @@ void overmap::place_specials( overmap_special_batch &enabled_specials )
     // completely skip placing any lake specials here since they'll never place and if
     // they're mandatory they just end up causing us to spiral out into adjacent overmaps
     // which probably don't have lakes either.
+    // Both are found in a single pass over the terrain, which stops once both turned up.
     bool overmap_has_lake = false;
     bool overmap_has_ocean = false;
-    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT && !overmap_has_lake; z++ ) {
-        for( int x = 0; x < OMAPX && !overmap_has_lake; x++ ) {
-            for( int y = 0; y < OMAPY && !overmap_has_lake; y++ ) {
-                overmap_has_lake = ter_unsafe( { x, y, z } )->is_lake();
-            }
-        }
-    }
-    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT && !overmap_has_ocean; z++ ) {
-        for( int x = 0; x < OMAPX && !overmap_has_ocean; x++ ) {
-            for( int y = 0; y < OMAPY && !overmap_has_ocean; y++ ) {
-                overmap_has_ocean = ter_unsafe( { x, y, z } )->is_ocean();
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        for( int x = 0; x < OMAPX && !( overmap_has_lake && overmap_has_ocean ); x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                const oter_id &t = ter_unsafe( { x, y, z } );
+                overmap_has_lake = overmap_has_lake || t->is_lake();
+                overmap_has_ocean = overmap_has_ocean || t->is_ocean();
             }
         }
     }
@@ -7181,11 +7297,21 @@ void overmap::open( overmap_special_batch &enabled_specials )
 // Note: this may throw io errors from std::ofstream
 void overmap::save() const
 {
-    write_to_file( overmapbuffer::player_filename( loc ), [&]( std::ostream & stream ) {
+    // Both are read back by read_from_file, which inflates compressed files
+    const bool compress = get_option<bool>( "COMPRESS_SAVES" );
+    const auto write = [compress]( const cata_path & path,
+    const std::function<void( std::ostream & )> &writer ) {
+        if( compress ) {
+            write_to_file_compressed( path, writer );
+        } else {
+            write_to_file( path, writer );
+        }
+    };
+    write( overmapbuffer::player_filename( loc ), [&]( std::ostream & stream ) {
         serialize_view( stream );
     } );
 
-    write_to_file( overmapbuffer::terrain_filename( loc ), [&]( std::ostream & stream ) {
+    write( overmapbuffer::terrain_filename( loc ), [&]( std::ostream & stream ) {
         serialize( stream );
     } );
 }
@@ -10,6 +10,7 @@
 #include <iosfwd>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -23,6 +24,7 @@
 #include "cube_direction.h"
 #include "enums.h"
 #include "game_constants.h"
+#include "horde_map.h"
 #include "mapgendata.h"
 #include "mdarray.h"
 #include "memory_fast.h"
@@ -311,7 +313,7 @@ class overmap
         void place_special_forced( const overmap_special_id &special_id, const tripoint_om_omt &p,
                                    om_direction::type dir );
     private:
-        std::multimap<tripoint_om_sm, mongroup> zg; // NOLINT(cata-serialize)
+        horde_map zg; // NOLINT(cata-serialize)
     public:
         /** Unit test enablers to check if a given mongroup is present. */
         bool mongroup_check( const mongroup &candidate ) const;
@@ -348,6 +350,21 @@ class overmap
         point_abs_om loc; // NOLINT(cata-serialize)
 
         std::array<map_layer, OVERMAP_LAYERS> layer;
+        // Saved terrain of the layers that hasn't been decoded yet, see @ref load_terrain.
+        // Most z-levels of a loaded overmap are never looked at, so they are only decoded on
+        // first access.
+        std::array<std::shared_ptr<JsonArray>, OVERMAP_LAYERS> pending_terrain; // NOLINT(cata-serialize)
+
+        // Where each terrain is on a layer, so searches for rare terrain don't have to look at
+        // every location. Built when first needed and dropped whenever the layer changes.
+        struct terrain_index {
+            bool valid = false;
+            // Locations of terrain that only occurs a few times, sorted by y, then x.
+            std::unordered_map<oter_id, std::vector<point_om_omt>> sparse;
+            // Terrain with too many locations to be worth listing.
+            std::vector<oter_id> dense;
+        };
+        mutable std::array<terrain_index, OVERMAP_LAYERS> terrain_indices; // NOLINT(cata-serialize)
         std::unordered_map<tripoint_abs_omt, scent_trace> scents;
 
         // Records the locations where a given overmap special was placed, which
@@ -403,6 +420,23 @@ class overmap
         // Save per-player overmap view data.
         void serialize_view( std::ostream &fout ) const;
     private:
+        // Decodes the saved terrain of the layer at z level @p z if that hasn't happened yet.
+        void load_terrain( int z ) const {
+            if( pending_terrain[z + OVERMAP_DEPTH] ) {
+                const_cast<overmap &>( *this ).unserialize_terrain( z );
+            }
+        }
+        void unserialize_terrain( int z );
+
+        /**
+         * Adds the locations on z level @p z within the rectangle from @p min to @p max
+         * (both inclusive) whose terrain satisfies @p matches to @p result.
+         * @p matches is called only once for each distinct terrain on the layer.
+         */
+        void find_matching_terrain( int z, const point_om_omt &min, const point_om_omt &max,
+                                    const std::function<bool( const oter_id & )> &matches,
+                                    std::vector<tripoint_om_omt> &result ) const;
+        const terrain_index &get_terrain_index( int z ) const;
         void generate( const overmap *north, const overmap *east,
                        const overmap *south, const overmap *west,
                        overmap_special_batch &enabled_specials );
@@ -416,7 +450,8 @@ class overmap
 
         const city &get_nearest_city( const tripoint_om_omt &p ) const;
 
-        void signal_hordes( const tripoint_rel_sm &p, int sig_power );
+        /** Each horde follows at most one of @p signals, the one it hears loudest. */
+        void signal_hordes( const std::vector<horde_signal> &signals );
         void process_mongroups();
         void move_hordes();
 
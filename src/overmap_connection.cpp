@@ -64,38 +64,48 @@ void overmap_connection::subtype::deserialize( const JsonObject &jo )
     load( jo );
 }
 
-const overmap_connection::subtype *overmap_connection::pick_subtype_for(
+const overmap_connection::cache &overmap_connection::cache_for(
     const int_id<oter_t> &ground ) const
 {
-    if( !ground ) {
-        return nullptr;
-    }
-
     const size_t cache_index = ground.to_i();
     cata_assert( cache_index < cached_subtypes.size() );
 
-    if( cached_subtypes[cache_index] ) {
-        return cached_subtypes[cache_index].value;
+    cache &result = cached_subtypes[cache_index];
+    if( result ) {
+        return result;
     }
 
     const auto iter = std::find_if( subtypes.cbegin(),
     subtypes.cend(), [&ground]( const subtype & elem ) {
         return elem.allows_terrain( ground );
     } );
-
-    const overmap_connection::subtype *result = iter != subtypes.cend() ? &*iter : nullptr;
-
-    cached_subtypes[cache_index].value = result;
-    cached_subtypes[cache_index].assigned = true;
+    result.value = iter != subtypes.cend() ? &*iter : nullptr;
+    result.has = std::find_if( subtypes.cbegin(),
+    subtypes.cend(), [&ground]( const subtype & elem ) {
+        return ground->type_is( elem.terrain );
+    } ) != subtypes.cend();
+    result.assigned = true;
 
     return result;
 }
 
+const overmap_connection::subtype *overmap_connection::pick_subtype_for(
+    const int_id<oter_t> &ground ) const
+{
+    if( !ground ) {
+        return nullptr;
+    }
+    return cache_for( ground ).value;
+}
+
 bool overmap_connection::has( const int_id<oter_t> &oter ) const
 {
-    return std::find_if( subtypes.cbegin(), subtypes.cend(), [&oter]( const subtype & elem ) {
-        return oter->type_is( elem.terrain );
-    } ) != subtypes.cend();
+    if( !oter ) {
+        return std::find_if( subtypes.cbegin(), subtypes.cend(), [&oter]( const subtype & elem ) {
+            return oter->type_is( elem.terrain );
+        } ) != subtypes.cend();
+    }
+    return cache_for( oter ).has;
 }
 
 void overmap_connection::load( const JsonObject &jo, const std::string_view )
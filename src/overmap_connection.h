@@ -59,11 +59,14 @@ class overmap_connection
     private:
         struct cache {
             const subtype *value = nullptr;
+            // Result of @ref has, routing asks it for every terrain it considers
+            bool has = false;
             bool assigned = false;
             explicit operator bool() const {
                 return assigned;
             }
         };
+        const cache &cache_for( const int_id<oter_t> &ground ) const;
 
         std::list<subtype> subtypes;
         mutable std::vector<cache> cached_subtypes;
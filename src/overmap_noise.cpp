@@ -1,12 +1,22 @@
 #include <cmath>
 #include <algorithm>
+#include <vector>
 
 #include "overmap_noise.h"
 #include "simplexnoise.h"
+#include "worker_pool.h"
 
 namespace om_noise
 {
 
+void om_noise_layer::noise_row( const point_om_omt &omt_local, const int count,
+                                float *const out ) const
+{
+    for( int n = 0; n < count; n++ ) {
+        out[n] = noise_at( omt_local + point( n, 0 ) );
+    }
+}
+
 float om_noise_layer_forest::noise_at( const point_om_omt &local_omt_pos ) const
 {
     const point_abs_omt p = global_omt_pos( local_omt_pos );
@@ -19,6 +29,19 @@ float om_noise_layer_forest::noise_at( const point_om_omt &local_omt_pos ) const
     return std::max( 0.0f, r - d * 0.5f );
 }
 
+void om_noise_layer_forest::noise_row( const point_om_omt &local_omt_pos, const int count,
+                                       float *const out ) const
+{
+    const point_abs_omt p = global_omt_pos( local_omt_pos );
+    std::vector<float> d( count );
+    scaled_octave_noise_3d_row( 4, 0.5, 0.03, 0, 1, p.x(), p.y(), get_seed(), count, out );
+    scaled_octave_noise_3d_row( 6, 0.5, 0.07, 0, 1, p.x(), p.y(), get_seed(), count, d.data() );
+    for( int n = 0; n < count; n++ ) {
+        const float r = std::pow( out[n], 2.0f );
+        out[n] = std::max( 0.0f, r - std::pow( d[n], 3.0f ) * 0.5f );
+    }
+}
+
 float om_noise_layer_floodplain::noise_at( const point_om_omt &local_omt_pos ) const
 {
     const point_abs_omt p = global_omt_pos( local_omt_pos );
@@ -27,6 +50,16 @@ float om_noise_layer_floodplain::noise_at( const point_om_omt &local_omt_pos ) c
     return r;
 }
 
+void om_noise_layer_floodplain::noise_row( const point_om_omt &local_omt_pos, const int count,
+        float *const out ) const
+{
+    const point_abs_omt p = global_omt_pos( local_omt_pos );
+    scaled_octave_noise_3d_row( 4, 0.5, 0.05, 0, 1, p.x(), p.y(), get_seed(), count, out );
+    for( int n = 0; n < count; n++ ) {
+        out[n] = std::pow( out[n], 2.0f );
+    }
+}
+
 float om_noise_layer_lake::noise_at( const point_om_omt &local_omt_pos ) const
 {
     const point_abs_omt p = global_omt_pos( local_omt_pos );
@@ -35,6 +68,16 @@ float om_noise_layer_lake::noise_at( const point_om_omt &local_omt_pos ) const
     return r;
 }
 
+void om_noise_layer_lake::noise_row( const point_om_omt &local_omt_pos, const int count,
+                                     float *const out ) const
+{
+    const point_abs_omt p = global_omt_pos( local_omt_pos );
+    scaled_octave_noise_3d_row( 8, 0.5, 0.002, 0, 1, p.x(), p.y(), get_seed(), count, out );
+    for( int n = 0; n < count; n++ ) {
+        out[n] = std::pow( out[n], 4.0f );
+    }
+}
+
 float om_noise_layer_ocean::noise_at( const point_om_omt &local_omt_pos ) const
 {
     // this is a duplicate of lake noise.  Changing it might cause artifacts if oceans
@@ -45,4 +88,23 @@ float om_noise_layer_ocean::noise_at( const point_om_omt &local_omt_pos ) const
     return r;
 }
 
+void om_noise_layer_ocean::noise_row( const point_om_omt &local_omt_pos, const int count,
+                                      float *const out ) const
+{
+    const point_abs_omt p = global_omt_pos( local_omt_pos );
+    scaled_octave_noise_3d_row( 8, 0.5, 0.002, 0, 1, p.x(), p.y(), get_seed(), count, out );
+    for( int n = 0; n < count; n++ ) {
+        out[n] = std::pow( out[n], 4.0f );
+    }
+}
+
+om_noise_layer_precomputed::om_noise_layer_precomputed( const om_noise_layer &source ) :
+    source( source ), values( static_cast<size_t>( width ) * height )
+{
+    get_worker_pool().parallel_for( height, [&]( const size_t row ) {
+        const int y = static_cast<int>( row );
+        source.noise_row( point_om_omt( -border, y - border ), width, &values[y * width] );
+    } );
+}
+
 } // namespace om_noise
@@ -2,6 +2,8 @@
 #ifndef CATA_SRC_OVERMAP_NOISE_H
 #define CATA_SRC_OVERMAP_NOISE_H
 
+#include <vector>
+
 #include "coordinates.h"
 #include "game_constants.h"
 
@@ -20,6 +22,11 @@ class om_noise_layer
          * @param omt_local point location in overmap terrain local coordinates.
          */
         virtual float noise_at( const point_om_omt &omt_local ) const = 0;
+        /**
+         * Noise values of the @p count locations starting at @p omt_local and going east,
+         * written to @p out. Gives the same values as noise_at, but is cheaper per location.
+         */
+        virtual void noise_row( const point_om_omt &omt_local, int count, float *out ) const;
         virtual ~om_noise_layer() = default;
     protected:
         /**
@@ -55,6 +62,7 @@ class om_noise_layer_forest : public om_noise_layer
         }
 
         float noise_at( const point_om_omt &local_omt_pos ) const override;
+        void noise_row( const point_om_omt &local_omt_pos, int count, float *out ) const override;
 };
 
 class om_noise_layer_floodplain : public om_noise_layer
@@ -65,6 +73,7 @@ class om_noise_layer_floodplain : public om_noise_layer
         }
 
         float noise_at( const point_om_omt &local_omt_pos ) const override;
+        void noise_row( const point_om_omt &local_omt_pos, int count, float *out ) const override;
 };
 
 class om_noise_layer_lake : public om_noise_layer
@@ -75,6 +84,7 @@ class om_noise_layer_lake : public om_noise_layer
         }
 
         float noise_at( const point_om_omt &local_omt_pos ) const override;
+        void noise_row( const point_om_omt &local_omt_pos, int count, float *out ) const override;
 };
 
 
@@ -86,6 +96,38 @@ class om_noise_layer_ocean : public om_noise_layer
         }
 
         float noise_at( const point_om_omt &local_omt_pos ) const override;
+        void noise_row( const point_om_omt &local_omt_pos, int count, float *out ) const override;
+};
+
+/**
+ * The noise of another layer, computed up front for every location of the overmap and a small
+ * border around it. Overmap generation looks at the noise of most locations, often several
+ * times, so this is cheaper than computing it on demand, and the work is spread over the
+ * worker pool. Locations outside of the border fall back to the source layer, which must
+ * outlive this object.
+ */
+class om_noise_layer_precomputed
+{
+    public:
+        explicit om_noise_layer_precomputed( const om_noise_layer &source );
+
+        float noise_at( const point_om_omt &local_omt_pos ) const {
+            const int x = local_omt_pos.x() + border;
+            const int y = local_omt_pos.y() + border;
+            if( x < 0 || y < 0 || x >= width || y >= height ) {
+                return source.noise_at( local_omt_pos );
+            }
+            return values[y * width + x];
+        }
+
+    private:
+        // Flood fills in overmap generation look up to this far outside the overmap.
+        static constexpr int border = 5;
+        static constexpr int width = OMAPX + 2 * border;
+        static constexpr int height = OMAPY + 2 * border;
+
+        const om_noise_layer &source;
+        std::vector<float> values;
 };
 
 } // namespace om_noise
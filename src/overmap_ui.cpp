@@ -142,6 +142,73 @@ std::tuple<char, nc_color, size_t> get_note_display_info( const std::string_view
     return result;
 }
 
+void omt_view_cache::set_area( const tripoint_abs_omt &new_corner, const point &new_size )
+{
+    if( new_corner == corner && new_size == size ) {
+        return;
+    }
+    std::vector<std::optional<omt_info>> new_entries( static_cast<size_t>( new_size.x ) * new_size.y );
+    if( new_corner.z() == corner.z() ) {
+        // Keep the part that is still shown, scrolling only exposes a strip at the edge
+        const point shift = ( new_corner - corner ).xy().raw();
+        for( int y = std::max( 0, shift.y ); y < std::min( size.y, shift.y + new_size.y ); ++y ) {
+            for( int x = std::max( 0, shift.x ); x < std::min( size.x, shift.x + new_size.x ); ++x ) {
+                new_entries[( y - shift.y ) * new_size.x + x - shift.x] =
+                    std::move( entries[y * size.x + x] );
+            }
+        }
+    }
+    corner = new_corner;
+    size = new_size;
+    entries = std::move( new_entries );
+}
+
+omt_view_cache::omt_info &omt_view_cache::get( const tripoint_abs_omt &p )
+{
+    const point rel = ( p - corner ).xy().raw();
+    if( p.z() != corner.z() || rel.x < 0 || rel.y < 0 || rel.x >= size.x || rel.y >= size.y ) {
+        outside = fetch( p );
+        return outside;
+    }
+    std::optional<omt_info> &entry = entries[rel.y * size.x + rel.x];
+    if( !entry ) {
+        entry = fetch( p );
+    }
+    return *entry;
+}
+
+void omt_view_cache::invalidate()
+{
+    for( std::optional<omt_info> &entry : entries ) {
+        entry.reset();
+    }
+}
+
+omt_view_cache::omt_info omt_view_cache::fetch( const tripoint_abs_omt &p )
+{
+    omt_info info;
+    info.seen = overmap_buffer.seen( p );
+    info.explored = overmap_buffer.is_explored( p );
+    if( info.seen ) {
+        info.ter = overmap_buffer.ter( p );
+        info.extra = overmap_buffer.extra( p );
+    }
+    info.horde_size = overmap_buffer.get_horde_size( p );
+    info.has_vehicle = overmap_buffer.has_vehicle( p );
+    info.has_note = overmap_buffer.has_note( p );
+    if( info.has_note ) {
+        std::tie( info.note_sym, info.note_color, std::ignore ) =
+            get_note_display_info( overmap_buffer.note( p ) );
+    }
+    return info;
+}
+
+omt_view_cache &get_omt_view_cache()
+{
+    static omt_view_cache cache;
+    return cache;
+}
+
 static std::array<std::pair<nc_color, std::string>, npm_width *npm_height> get_overmap_neighbors(
     const tripoint_abs_omt &current )
 {
@@ -391,6 +458,7 @@ class map_notes_callback : public uilist_callback
                     if( overmap_buffer.has_note( note_location() ) &&
                         query_yn( _( "Really delete note?" ) ) ) {
                         overmap_buffer.delete_note( note_location() );
+                        get_omt_view_cache().invalidate();
                     }
                     menu->ret = UILIST_MAP_NOTE_DELETED;
                     return true;
@@ -404,6 +472,7 @@ class map_notes_callback : public uilist_callback
                     if( overmap_buffer.is_marked_dangerous( note_location() ) &&
                         query_yn( _( "Remove dangerous mark?" ) ) ) {
                         overmap_buffer.mark_note_dangerous( note_location(), 0, false );
+                        get_omt_view_cache().invalidate();
                     }
                     // NOLINTNEXTLINE(cata-text-style): No need for two whitespaces
                     else if( ( overmap_buffer.is_marked_dangerous( note_location() ) &&
@@ -422,6 +491,7 @@ class map_notes_callback : public uilist_callback
                                      .query_int();
                         if( amount > -1 && amount <= max_amount ) {
                             overmap_buffer.mark_note_dangerous( note_location(), amount, true );
+                            get_omt_view_cache().invalidate();
                             menu->ret = UILIST_MAP_NOTE_EDITED;
                             return true;
                         }
@@ -572,6 +642,10 @@ static void draw_ascii(
         }
     }
 
+    const tripoint_abs_omt corner = center - point( om_half_width, om_half_height );
+    omt_view_cache &view_cache = get_omt_view_cache();
+    view_cache.set_area( corner, point( om_map_width, om_map_height ) );
+
     // A small LRU cache: most oter_id's occur in clumps like forests of swamps.
     // This cache helps avoid much more costly lookups in the full hashmap.
     constexpr size_t cache_size = 8; // used below to calculate the next index
@@ -596,14 +670,12 @@ static void draw_ascii(
         }
         // Ok, we found something
         if( info ) {
-            const bool explored = show_explored && overmap_buffer.is_explored( omp );
+            const bool explored = show_explored && view_cache.get( omp ).explored;
             ter_color = explored ? c_dark_gray : info->get_color( uistate.overmap_show_land_use_codes );
             ter_sym = info->get_symbol( uistate.overmap_show_land_use_codes );
         }
     };
 
-    const tripoint_abs_omt corner = center - point( om_half_width, om_half_height );
-
     // For use with place_special: cache the color and symbol of each submap
     // and record the bounds to optimize lookups below
     std::unordered_map<point_rel_omt, std::pair<std::string, nc_color>> special_cache;
@@ -714,10 +786,11 @@ static void draw_ascii(
             nc_color ter_color = c_black;
             std::string ter_sym = " ";
 
-            const bool see = has_debug_vision || overmap_buffer.seen( omp );
+            const omt_view_cache::omt_info &omt = view_cache.get( omp );
+            const bool see = has_debug_vision || omt.seen;
             if( see ) {
                 // Only load terrain if we can actually see it
-                cur_ter = overmap_buffer.ter( omp );
+                cur_ter = omt.seen ? omt.ter : overmap_buffer.ter( omp );
             }
 
             // Check if location is within player line-of-sight
@@ -745,10 +818,10 @@ static void draw_ascii(
                 } else if( target.z() < center.z() ) {
                     ter_sym = "v";
                 }
-            } else if( blink && uistate.overmap_show_map_notes && overmap_buffer.has_note( omp ) ) {
+            } else if( blink && uistate.overmap_show_map_notes && omt.has_note ) {
                 // Display notes in all situations, even when not seen
-                std::tie( ter_sym, ter_color, std::ignore ) =
-                    get_note_display_info( overmap_buffer.note( omp ) );
+                ter_sym = omt.note_sym;
+                ter_color = omt.note_color;
             } else if( !see ) {
                 // All cases above ignore the seen-status,
                 ter_color = oter_unexplored.obj().get_color();
@@ -779,13 +852,13 @@ static void draw_ascii(
                 ter_color = c_magenta;
                 ter_sym = "&";
             } else if( blink && showhordes &&
-                       overmap_buffer.get_horde_size( omp ) >= HORDE_VISIBILITY_SIZE &&
+                       omt.horde_size >= HORDE_VISIBILITY_SIZE &&
                        ( get_and_assign_los( los, player_character, omp, sight_points ) ||
                          uistate.overmap_debug_mongroup || player_character.has_trait( trait_DEBUG_CLAIRVOYANCE ) ) ) {
                 // Display Hordes only when within player line-of-sight
                 ter_color = c_green;
-                ter_sym = overmap_buffer.get_horde_size( omp ) > HORDE_VISIBILITY_SIZE * 2 ? "Z" : "z";
-            } else if( blink && overmap_buffer.has_vehicle( omp ) ) {
+                ter_sym = omt.horde_size > HORDE_VISIBILITY_SIZE * 2 ? "Z" : "z";
+            } else if( blink && omt.has_vehicle ) {
                 ter_color = c_cyan;
                 ter_sym = overmap_buffer.get_vehicle_ter_sym( omp );
             } else if( !sZoneName.empty() && tripointZone.xy() == omp.xy() ) {
@@ -1332,6 +1405,7 @@ static void create_note( const tripoint_abs_omt &curs )
     } else if( !esc_pressed && old_note != new_note ) {
         overmap_buffer.add_note( curs, new_note );
     }
+    get_omt_view_cache().invalidate();
 }
 
 // if false, search yielded no results
@@ -1600,6 +1674,7 @@ static void place_ter_or_special( const ui_adaptor &om_ui, tripoint_abs_omt &cur
                         }
                     }
                 }
+                get_omt_view_cache().invalidate();
                 break;
             } else if( action == "ROTATE" && can_rotate ) {
                 uistate.omedit_rotation = om_direction::turn_right( uistate.omedit_rotation );
@@ -1781,6 +1856,9 @@ static tripoint_abs_omt display( const tripoint_abs_omt &orig,
     } );
     ui.mark_resize();
 
+    // The game may have changed the overmap since it was shown last time
+    get_omt_view_cache().invalidate();
+
     tripoint_abs_omt ret = overmap::invalid_tripoint;
     tripoint_abs_omt curs( orig );
 
@@ -1890,6 +1968,7 @@ static tripoint_abs_omt display( const tripoint_abs_omt &orig,
         } else if( action == "DELETE_NOTE" ) {
             if( overmap_buffer.has_note( curs ) && query_yn( _( "Really delete note?" ) ) ) {
                 overmap_buffer.delete_note( curs );
+                get_omt_view_cache().invalidate();
             }
         } else if( action == "MARK_DANGER" ) {
             if( overmap_buffer.is_marked_dangerous( curs ) &&
@@ -1916,6 +1995,7 @@ static tripoint_abs_omt display( const tripoint_abs_omt &orig,
                     overmap_buffer.mark_note_dangerous( curs, amount, true );
                 }
             }
+            get_omt_view_cache().invalidate();
         } else if( action == "LIST_NOTES" ) {
             const point_abs_omt p = draw_notes( curs );
             if( p != point_abs_omt( point_min ) ) {
@@ -1982,6 +2062,7 @@ static tripoint_abs_omt display( const tripoint_abs_omt &orig,
             uistate.overmap_show_revealed_omts = !uistate.overmap_show_revealed_omts;
         } else if( action == "TOGGLE_EXPLORED" ) {
             overmap_buffer.toggle_explored( curs );
+            get_omt_view_cache().invalidate();
         } else if( action == "TOGGLE_OVERMAP_WEATHER" ) {
             if( get_map().is_outside( get_player_character().pos() ) ) {
                 uistate.overmap_visible_weather = !uistate.overmap_visible_weather;
@@ -1990,6 +2071,8 @@ static tripoint_abs_omt display( const tripoint_abs_omt &orig,
             fast_scroll = !fast_scroll;
         } else if( action == "TOGGLE_FOREST_TRAILS" ) {
             uistate.overmap_show_forest_trails = !uistate.overmap_show_forest_trails;
+            // The tiles overmap picks terrain tiles depending on this
+            get_omt_view_cache().invalidate();
         } else if( action == "SEARCH" ) {
             if( !search( ui, curs, orig ) ) {
                 continue;
@@ -2,9 +2,15 @@
 #ifndef CATA_SRC_OVERMAP_UI_H
 #define CATA_SRC_OVERMAP_UI_H
 
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "color.h"
 #include "coordinates.h"
 #include "regional_settings.h"
 #include "string_id.h"
+#include "type_id.h"
 
 constexpr int RANDOM_CITY_ENTRY = INT_MIN;
 
@@ -16,7 +22,6 @@ class window;
 } // namespace catacurses
 
 class input_context;
-class nc_color;
 
 struct weather_type;
 using weather_type_id = string_id<weather_type>;
@@ -110,6 +115,52 @@ struct tiles_redraw_info {
 extern tiles_redraw_info redraw_info;
 #endif
 
+/**
+ * Overmap data that the overmap views look up for every shown tile on every redraw.
+ * None of it changes while the overmap UI is open, unless the UI itself edits it, so
+ * it's kept for the shown area: scrolling only fetches the tiles that came into view.
+ * Code that changes notes, explored state or terrain while the overmap is shown has to
+ * call @ref invalidate.
+ */
+class omt_view_cache
+{
+    public:
+        struct omt_info {
+            bool seen = false;
+            bool explored = false;
+            // Only fetched for seen tiles
+            oter_id ter;
+            map_extra_id extra;
+            int horde_size = 0;
+            bool has_vehicle = false;
+            bool has_note = false;
+            char note_sym = ' ';
+            nc_color note_color = c_black;
+            // Tile id, rotation and subtile the tiles overmap picked for this tile, if it did
+            std::optional<std::string> tile_id;
+            int tile_rotation = 0;
+            int tile_subtile = -1;
+        };
+
+        /** Sets the area that is shown, keeping what is known about tiles that remain in it. */
+        void set_area( const tripoint_abs_omt &corner, const point &size );
+        /** Data of a tile, fetched from the overmap buffer on first use. */
+        omt_info &get( const tripoint_abs_omt &p );
+        /** Forgets everything, it will be fetched again. */
+        void invalidate();
+
+    private:
+        static omt_info fetch( const tripoint_abs_omt &p );
+
+        tripoint_abs_omt corner;
+        point size;
+        std::vector<std::optional<omt_info>> entries;
+        // Returned for tiles outside of the area
+        omt_info outside;
+};
+
+omt_view_cache &get_omt_view_cache();
+
 weather_type_id get_weather_at_point( const tripoint_abs_omt &pos );
 std::tuple<char, nc_color, size_t> get_note_display_info( std::string_view note );
 } // namespace overmap_ui
@@ -27,11 +27,13 @@
 #include "game_constants.h"
 #include "line.h"
 #include "map.h"
+#include "memory_accounting.h"
 #include "memory_fast.h"
 #include "mod_manager.h"
 #include "mongroup.h"
 #include "monster.h"
 #include "npc.h"
+#include "options.h"
 #include "overmap.h"
 #include "overmap_connection.h"
 #include "overmap_types.h"
@@ -87,11 +89,14 @@ overmap &overmapbuffer::get( const point_abs_om &p )
 
     const auto it = overmaps.find( p );
     if( it != overmaps.end() ) {
+        touch( *it->second );
         return *( last_requested_overmap = it->second.get() );
     }
 
     // That constructor loads an existing overmap or creates a new one.
     overmap &new_om = *( overmaps[ p ] = std::make_unique<overmap>( p ) );
+    invalidate_travel_paths();
+    touch( new_om );
     new_om.populate();
     // Note: fix_mongroups might load other overmaps, so overmaps.back() is not
     // necessarily the overmap at (x,y)
@@ -111,48 +116,43 @@ void overmapbuffer::create_custom_overmap( const point_abs_om &p, overmap_specia
         }
     }
     overmap &new_om = *( overmaps[ p ] = std::make_unique<overmap>( p ) );
+    invalidate_travel_paths();
     new_om.populate( specials );
 }
 
 void overmapbuffer::fix_mongroups( overmap &new_overmap )
 {
-    for( auto it = new_overmap.zg.begin(); it != new_overmap.zg.end(); ) {
-        mongroup &mg = it->second;
+    new_overmap.zg.erase_if( [&]( const mongroup & mg ) {
         // spawn related code simply sets population to 0 when they have been
         // transformed into spawn points on a submap, the group can then be removed
         if( mg.empty() ) {
-            new_overmap.zg.erase( it++ );
-            continue;
+            return true;
         }
         // Inside the bounds of the overmap?
         point_abs_om omp;
         point_om_sm sm_rem;
         std::tie( omp, sm_rem ) = project_remain<coords::om>( mg.abs_pos.xy() );
         if( omp == new_overmap.pos() ) {
-            ++it;
-            continue;
+            return false;
         }
         if( !has( omp ) ) {
             // Don't generate new overmaps, as this can be called from the
             // overmap-generating code.
-            ++it;
-            continue;
+            return false;
         }
         overmap &om = get( omp );
         om.spawn_mon_group( mg, 1 );
-        new_overmap.zg.erase( it++ );
-    }
+        return true;
+    } );
 }
 
 void overmapbuffer::fix_nemesis( overmap &new_overmap )
 {
-    for( std::multimap<tripoint_om_sm, mongroup>::iterator it = new_overmap.zg.begin();
-         it != new_overmap.zg.end(); ) {
+    for( auto it = new_overmap.zg.begin(); it != new_overmap.zg.end(); ++it ) {
         mongroup &mg = it->second;
 
         //if it's not the nemesis, continue
         if( mg.behaviour != mongroup::horde_behaviour::nemesis ) {
-            ++it;
             continue;
         }
 
@@ -161,14 +161,13 @@ void overmapbuffer::fix_nemesis( overmap &new_overmap )
         std::tie( omp, sm_rem ) = project_remain<coords::om>( mg.abs_pos.xy() );
         //if the nemesis's abs coordinates put it in this overmap, it belongs here
         if( omp == new_overmap.pos() ) {
-            ++it;
             continue;
         }
 
         //otherwise, place it in the overmap that corresponds to its abs_sm coords
         overmap &om = get( omp );
         om.spawn_mon_group( mg, 1 );
-        new_overmap.zg.erase( it++ );
+        new_overmap.zg.erase( it );
         //there should only be one nemesis, so we can break after finding it
         break;
     }
@@ -234,9 +233,80 @@ void overmapbuffer::save()
 void overmapbuffer::clear()
 {
     overmaps.clear();
+    last_used.clear();
+    pending_horde_signals.clear();
     known_non_existing.clear();
     placed_unique_specials.clear();
     last_requested_overmap = nullptr;
+    travel_path_cache.clear();
+    invalidate_travel_paths();
+}
+
+memory_accounting::usage overmapbuffer::memory_usage() const
+{
+    // The terrain layers are arrays inside the overmap itself
+    memory_accounting::usage ret;
+    ret.count = overmaps.size();
+    ret.bytes = ret.count * sizeof( overmap );
+    return ret;
+}
+
+void overmapbuffer::touch( const overmap &om )
+{
+    last_used[om.pos()] = ++use_counter;
+}
+
+int overmapbuffer::evict( const size_t budget_bytes )
+{
+    size_t total_bytes = overmaps.size() * sizeof( overmap );
+    if( total_bytes <= budget_bytes ) {
+        return 0;
+    }
+    const point_abs_om player_om =
+        project_to<coords::om>( get_player_character().global_omt_location().xy() );
+    std::vector<std::pair<unsigned long long, point_abs_om>> candidates;
+    for( const auto &elem : overmaps ) {
+        const overmap &om = *elem.second;
+        if( square_dist( elem.first, player_om ) <= 1 || !om.npcs.empty() || !om.camps.empty() ) {
+            continue;
+        }
+        const bool has_nemesis = std::any_of( om.zg.begin(), om.zg.end(),
+        []( const horde_map::value_type & group ) {
+            return group.second.behaviour == mongroup::horde_behaviour::nemesis;
+        } );
+        if( !has_nemesis ) {
+            candidates.emplace_back( last_used[elem.first], elem.first );
+        }
+    }
+    // Least recently used first
+    std::sort( candidates.begin(), candidates.end() );
+
+    int evicted = 0;
+    for( const auto &candidate : candidates ) {
+        if( total_bytes <= budget_bytes ) {
+            break;
+        }
+        const auto it = overmaps.find( candidate.second );
+        // Note: this may throw io errors from std::ofstream
+        it->second->save();
+        if( last_requested_overmap == it->second.get() ) {
+            last_requested_overmap = nullptr;
+        }
+        overmaps.erase( it );
+        invalidate_travel_paths();
+        last_used.erase( candidate.second );
+        total_bytes -= sizeof( overmap );
+        ++evicted;
+    }
+    return evicted;
+}
+
+void overmapbuffer::evict_over_budget()
+{
+    const int budget_mib = get_option<int>( "OVERMAP_MEMORY_BUDGET" );
+    if( budget_mib > 0 ) {
+        evict( static_cast<size_t>( budget_mib ) * 1024 * 1024 );
+    }
 }
 
 const regional_settings &overmapbuffer::get_settings( const tripoint_abs_omt &p )
@@ -288,6 +358,7 @@ overmap *overmapbuffer::get_existing( const point_abs_om &p )
     }
     const auto it = overmaps.find( p );
     if( it != overmaps.end() ) {
+        touch( *it->second );
         return last_requested_overmap = it->second.get();
     }
     if( known_non_existing.count( p ) > 0 ) {
@@ -546,14 +617,33 @@ std::string overmapbuffer::get_vehicle_tile_id( const tripoint_abs_omt &omt )
 
 void overmapbuffer::signal_hordes( const tripoint_abs_sm &center, const int sig_power )
 {
-    const int radius = sig_power;
-    for( overmap *&om : get_overmaps_near( center, radius ) ) {
-        const point_abs_sm abs_pos_om = project_to<coords::sm>( om->pos() );
-        const tripoint_rel_sm rel_pos = center - abs_pos_om;
-        // overmap::signal_hordes expects a coordinate relative to the overmap, this is easier
-        // for processing as the monster group stores is location as relative coordinates, too.
-        om->signal_hordes( rel_pos, sig_power );
+    for( horde_signal &signal : pending_horde_signals ) {
+        if( signal.center == center ) {
+            signal.power = std::max( signal.power, sig_power );
+            return;
+        }
     }
+    pending_horde_signals.push_back( { center, sig_power } );
+}
+
+void overmapbuffer::process_horde_signals()
+{
+    if( pending_horde_signals.empty() ) {
+        return;
+    }
+    // Every overmap in reach of any signal goes through its hordes once
+    std::vector<overmap *> reached;
+    for( const horde_signal &signal : pending_horde_signals ) {
+        for( overmap *om : get_overmaps_near( signal.center, signal.power ) ) {
+            if( std::find( reached.begin(), reached.end(), om ) == reached.end() ) {
+                reached.push_back( om );
+            }
+        }
+    }
+    for( overmap *om : reached ) {
+        om->signal_hordes( pending_horde_signals );
+    }
+    pending_horde_signals.clear();
 }
 
 void overmapbuffer::signal_nemesis( const tripoint_abs_sm &p )
@@ -917,6 +1007,19 @@ std::vector<tripoint_abs_omt> overmapbuffer::get_travel_path(
         return {};
     }
 
+    // Every part of a cheapest route is itself a cheapest route, so one found from further
+    // back still holds from any point along it
+    for( const cached_travel_path &cached : travel_path_cache ) {
+        if( !cached.is_valid( travel_path_generation, travel_path_seen_generation ) ||
+            cached.dest != dest || !( cached.params == params ) ) {
+            continue;
+        }
+        const auto here = std::find( cached.points.begin(), cached.points.end(), src );
+        if( here != cached.points.end() ) {
+            return std::vector<tripoint_abs_omt>( cached.points.begin(), here + 1 );
+        }
+    }
+
     const pf::omt_scoring_fn estimate = [&]( tripoint_abs_omt pos ) {
         const int cur_cost = pos == src ? 0 : get_terrain_cost( pos, params );
         if( cur_cost < 0 ) {
@@ -928,6 +1031,20 @@ std::vector<tripoint_abs_omt> overmapbuffer::get_travel_path(
     constexpr int radius = 4 * OMAPX; // radius of search in OMTs = 4 overmaps
     const pf::simple_path<tripoint_abs_omt> path = pf::find_overmap_path( src, dest, radius, estimate,
             g->display_om_pathfinding_progress );
+
+    static constexpr size_t max_cached_travel_paths = 16;
+    travel_path_cache.erase( std::remove_if( travel_path_cache.begin(), travel_path_cache.end(),
+    [&]( const cached_travel_path & cached ) {
+        return !cached.is_valid( travel_path_generation, travel_path_seen_generation ) ||
+               ( cached.dest == dest && cached.params == params );
+    } ), travel_path_cache.end() );
+    if( travel_path_cache.size() >= max_cached_travel_paths ) {
+        travel_path_cache.erase( travel_path_cache.begin() );
+    }
+    if( !path.points.empty() ) {
+        travel_path_cache.push_back( { dest, params, travel_path_generation,
+                                       travel_path_seen_generation, path.points } );
+    }
     return path.points;
 }
 
@@ -1116,6 +1233,63 @@ tripoint_abs_omt overmapbuffer::find_closest(
     return find_closest( origin, params );
 }
 
+// The overmaps covering any of the locations within max_dist of origin, along with the distance
+// from origin to their closest location, sorted by that distance.
+static std::vector<std::pair<int, point_abs_om>> overmaps_in_range( const point_abs_omt &origin,
+        const int max_dist )
+{
+    const point_abs_om min_om = project_to<coords::om>( origin - point( max_dist, max_dist ) );
+    const point_abs_om max_om = project_to<coords::om>( origin + point( max_dist, max_dist ) );
+    std::vector<std::pair<int, point_abs_om>> result;
+    for( int y = min_om.y(); y <= max_om.y(); y++ ) {
+        for( int x = min_om.x(); x <= max_om.x(); x++ ) {
+            const point_abs_om om_pos( x, y );
+            const point_abs_omt min_omt = project_to<coords::omt>( om_pos );
+            const point_abs_omt max_omt = min_omt + point( OMAPX - 1, OMAPY - 1 );
+            const int dx = std::max( { 0, min_omt.x() - origin.x(), origin.x() - max_omt.x() } );
+            const int dy = std::max( { 0, min_omt.y() - origin.y(), origin.y() - max_omt.y() } );
+            result.emplace_back( std::max( dx, dy ), om_pos );
+        }
+    }
+    std::stable_sort( result.begin(), result.end(),
+    []( const std::pair<int, point_abs_om> &l, const std::pair<int, point_abs_om> &r ) {
+        return l.first < r.first;
+    } );
+    return result;
+}
+
+void overmapbuffer::find_matching_terrain( const point_abs_om &om_pos,
+        const tripoint_abs_omt &origin, int min_z, int max_z, const omt_find_params &params,
+        int max_dist, std::vector<tripoint_abs_omt> &result )
+{
+    overmap *om = params.existing_only ? get_existing( om_pos ) : &get( om_pos );
+    if( om == nullptr ) {
+        return;
+    }
+    const point_abs_omt om_origin = project_to<coords::omt>( om_pos );
+    const point_om_omt min( std::max( origin.x() - max_dist - om_origin.x(), 0 ),
+                            std::max( origin.y() - max_dist - om_origin.y(), 0 ) );
+    const point_om_omt max( std::min( origin.x() + max_dist - om_origin.x(), OMAPX - 1 ),
+                            std::min( origin.y() + max_dist - om_origin.y(), OMAPY - 1 ) );
+    const auto matches = [&params]( const oter_id & oter ) {
+        return std::any_of( params.types.begin(), params.types.end(),
+        [&oter]( const std::pair<std::string, ot_match_type> &type ) {
+            return is_ot_match( type.first, oter, type.second );
+        } );
+    };
+
+    std::vector<tripoint_om_omt> found;
+    for( int z = std::max( min_z, -OVERMAP_DEPTH ); z <= std::min( max_z, OVERMAP_HEIGHT ); z++ ) {
+        om->find_matching_terrain( z, min, max, matches, found );
+    }
+    for( const tripoint_om_omt &p : found ) {
+        const tripoint_abs_omt loc = project_combine( om_pos, p );
+        if( square_dist( origin.xy(), loc.xy() ) >= params.min_distance ) {
+            result.push_back( loc );
+        }
+    }
+}
+
 tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
         const omt_find_params &params )
 {
@@ -1139,31 +1313,32 @@ tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
     // See overmap::place_specials for how we attempt to insure specials are placed within this
     // range.  The actual number is 5 because 1 covers the current overmap,
     // and each additional one expends the search to the next concentric circle of overmaps.
-    const int min_dist = params.min_distance;
     const int max_dist = params.search_range ? params.search_range : OMAPX * 5;
 
     std::vector<tripoint_abs_omt> result;
     int found_dist = std::numeric_limits<int>::max();
 
-    for( const point_abs_omt &loc_xy : closest_points_first( origin.xy(), min_dist, max_dist ) ) {
-        const int dist_xy = square_dist( origin.xy(), loc_xy );
-
-        if( found_dist < dist_xy ) {
+    // Overmaps are searched closest first, so those that are only needed for locations farther
+    // away than what has already been found aren't generated.
+    std::vector<tripoint_abs_omt> candidates;
+    for( const auto &[om_dist, om_pos] : overmaps_in_range( origin.xy(), max_dist ) ) {
+        if( found_dist < om_dist ) {
             break;
         }
 
-        for( int z = params.min_z; z <= params.max_z; z++ ) {
-            const tripoint_abs_omt loc( loc_xy, z );
+        candidates.clear();
+        find_matching_terrain( om_pos, origin, params.min_z, params.max_z, params, max_dist,
+                               candidates );
+        for( const tripoint_abs_omt &loc : candidates ) {
             const int dist = square_dist( origin, loc );
-
-            if( found_dist < dist ) {
+            if( found_dist < dist || !is_findable_location( loc, params ) ) {
                 continue;
             }
-
-            if( is_findable_location( loc, params ) ) {
+            if( dist < found_dist ) {
                 found_dist = dist;
-                result.push_back( loc );
+                result.clear();
             }
+            result.push_back( loc );
         }
     }
 
@@ -1173,12 +1348,21 @@ tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
 std::vector<tripoint_abs_omt> overmapbuffer::find_all( const tripoint_abs_omt &origin,
         const omt_find_params &params )
 {
-    std::vector<tripoint_abs_omt> result;
     // dist == 0 means search a whole overmap diameter.
-    const int min_dist = params.min_distance;
     const int max_dist = params.search_range ? params.search_range : OMAPX;
 
-    for( const tripoint_abs_omt &loc : closest_points_first( origin, min_dist, max_dist ) ) {
+    std::vector<tripoint_abs_omt> candidates;
+    for( const auto &[om_dist, om_pos] : overmaps_in_range( origin.xy(), max_dist ) ) {
+        find_matching_terrain( om_pos, origin, origin.z(), origin.z(), params, max_dist, candidates );
+    }
+    // Callers rely on getting the closest locations first.
+    std::stable_sort( candidates.begin(), candidates.end(),
+    [&origin]( const tripoint_abs_omt & l, const tripoint_abs_omt & r ) {
+        return square_dist( origin, l ) < square_dist( origin, r );
+    } );
+
+    std::vector<tripoint_abs_omt> result;
+    for( const tripoint_abs_omt &loc : candidates ) {
         if( is_findable_location( loc, params ) ) {
             result.push_back( loc );
         }
@@ -3,6 +3,7 @@
 #define CATA_SRC_OVERMAPBUFFER_H
 
 #include <array>
+#include <cstddef>
 #include <functional>
 #include <iosfwd>
 #include <memory>
@@ -16,6 +17,7 @@
 
 #include "coordinates.h"
 #include "enums.h"
+#include "horde_map.h"
 #include "json.h"
 #include "memory_fast.h"
 #include "omdata.h"
@@ -37,6 +39,11 @@ struct om_vehicle;
 struct radio_tower;
 struct regional_settings;
 
+namespace memory_accounting
+{
+struct usage;
+} // namespace memory_accounting
+
 struct overmap_path_params {
     std::map<oter_travel_cost_type, int> travel_cost_per_type;
     bool avoid_danger = true;
@@ -50,6 +57,12 @@ struct overmap_path_params {
         return it != travel_cost_per_type.end() ? it->second : -1;
     }
     static constexpr int standard_cost = 10;
+
+    bool operator==( const overmap_path_params &rhs ) const {
+        return travel_cost_per_type == rhs.travel_cost_per_type &&
+               avoid_danger == rhs.avoid_danger && only_known_by_player == rhs.only_known_by_player;
+    }
+
     static overmap_path_params for_player();
     static overmap_path_params for_npc();
     static overmap_path_params for_land_vehicle( float offroad_coeff, bool tiny, bool amphibious );
@@ -154,6 +167,19 @@ class overmapbuffer
         overmap &get( const point_abs_om & );
         void save();
         void clear();
+        /** Loaded overmaps and an estimate of their size, see memory_accounting.h. */
+        memory_accounting::usage memory_usage() const;
+        /**
+         * Saves and drops the least recently used overmaps until the loaded ones take less
+         * than @p budget_bytes; they are loaded again when next used. Overmaps next to the
+         * player's, and those holding NPCs, camps or the nemesis horde, are kept, as other
+         * code finds those by searching the loaded overmaps.
+         * Only safe between turns, when nothing holds on to overmap pointers.
+         * @return number of overmaps dropped
+         */
+        int evict( size_t budget_bytes );
+        /** @ref evict with the budget from the options, if there is a budget. */
+        void evict_over_budget();
         void create_custom_overmap( const point_abs_om &, overmap_special_batch &specials );
 
         /**
@@ -345,6 +371,11 @@ class overmapbuffer
         bool reveal( const tripoint_abs_omt &center, int radius );
         bool reveal( const tripoint_abs_omt &center, int radius,
                      const std::function<bool( const oter_id & )> &filter );
+        /**
+         * Cheapest route from @p src to @p dest, from @p dest back to @p src.
+         * Routes are remembered per destination until @ref invalidate_travel_paths, and any
+         * point along a remembered route reuses the rest of it.
+         */
         std::vector<tripoint_abs_omt> get_travel_path(
             const tripoint_abs_omt &src, const tripoint_abs_omt &dest, const overmap_path_params &params );
         bool reveal_route( const tripoint_abs_omt &source, const tripoint_abs_omt &dest,
@@ -411,12 +442,18 @@ class overmapbuffer
             return get_extras( z, pattern ); // filter with pattern
         }
         /**
-         * Signal nearby hordes to move to given location.
+         * Signal nearby hordes to move to given location. The signal is queued until
+         * @ref process_horde_signals.
          * @param center The origin of the signal, hordes (that recognize the signal) want to go
          * to there. In global submap coordinates.
          * @param sig_power The signal strength, higher values means it visible farther away.
          */
         void signal_hordes( const tripoint_abs_sm &center, int sig_power );
+        /**
+         * Lets hordes react to the signals queued this turn. Each horde reacts at most once,
+         * so a burst of gunfire wakes it once rather than once per shot.
+         */
+        void process_horde_signals();
         /**
          * Process nearby monstergroups (dying mostly).
          */
@@ -528,6 +565,14 @@ class overmapbuffer
          * see omt_find_params for definitions of the terms
          */
         bool is_findable_location( const tripoint_abs_omt &location, const omt_find_params &params );
+        /**
+         * Adds the locations of the overmap at @p om_pos within @p max_dist of @p origin (and at
+         * least params.min_distance away) on z levels @p min_z to @p max_z whose terrain matches
+         * one of params.types to @p result. Doesn't do the other checks of is_findable_location.
+         */
+        void find_matching_terrain( const point_abs_om &om_pos, const tripoint_abs_omt &origin,
+                                    int min_z, int max_z, const omt_find_params &params,
+                                    int max_dist, std::vector<tripoint_abs_omt> &result );
 
         std::unordered_map< point_abs_om, std::unique_ptr< overmap > > overmaps;
         /**
@@ -537,6 +582,12 @@ class overmapbuffer
         mutable std::set<point_abs_om> known_non_existing;
         // Cached result of previous call to overmapbuffer::get_existing
         overmap mutable *last_requested_overmap;
+        // Marks @p om as just used, for evict
+        void touch( const overmap &om );
+        std::unordered_map<point_abs_om, unsigned long long> last_used;
+        unsigned long long use_counter = 0;
+        // Queued by signal_hordes, one per center
+        std::vector<horde_signal> pending_horde_signals;
         // Set of globally unique overmap specials that have already been placed
         std::unordered_set<overmap_special_id> placed_unique_specials;
 
@@ -612,6 +663,33 @@ class overmapbuffer
          */
         std::vector<overmap *> get_overmaps_near( const point_abs_sm &p, int radius );
         std::vector<overmap *> get_overmaps_near( const tripoint_abs_sm &location, int radius );
+
+        struct cached_travel_path {
+            tripoint_abs_omt dest;
+            overmap_path_params params;
+            unsigned int generation = 0;
+            unsigned int seen_generation = 0;
+            // From dest back to wherever it was planned from
+            std::vector<tripoint_abs_omt> points;
+
+            bool is_valid( unsigned int current, unsigned int current_seen ) const {
+                return generation == current &&
+                       ( !params.only_known_by_player || seen_generation == current_seen );
+            }
+        };
+        // Most recently planned routes last
+        std::vector<cached_travel_path> travel_path_cache;
+        unsigned int travel_path_generation = 0;
+        unsigned int travel_path_seen_generation = 0;
+    public:
+        /** Drops remembered travel routes, called when travel costs may have changed. */
+        void invalidate_travel_paths() {
+            ++travel_path_generation;
+        }
+        /** Drops remembered routes restricted to terrain the player has seen. */
+        void invalidate_seen_travel_paths() {
+            ++travel_path_seen_generation;
+        }
 };
 
 extern overmapbuffer overmap_buffer;
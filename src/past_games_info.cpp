@@ -1,13 +1,21 @@
 #include "past_games_info.h"
 
 #include <algorithm>
+#include <exception>
 #include <map>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <vector>
 #include <unordered_set>
 #include <utility>
 
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#else
+#   include <thread>
+#endif
+
 #include "achievement.h"
 #include "cata_utility.h"
 #include "debug.h"
@@ -76,14 +84,117 @@ past_game_info::past_game_info( const JsonObject &jo )
     }
 }
 
+past_game_summary::past_game_summary( past_game_info &info ) : avatar_name_( info.avatar_name() )
+{
+    event_multiset &events = info.stats().get_events( event_type::player_gets_achievement );
+    const event_multiset::summaries_type &counts = events.counts();
+    for( const std::pair<const cata::event::data_type, event_summary> &p : counts ) {
+        const cata::event::data_type &event_data = p.first;
+        auto ach_it = event_data.find( "achievement" );
+        auto enabled_it = event_data.find( "achievements_enabled" );
+        if( ach_it == event_data.end() || enabled_it == event_data.end() ) {
+            debugmsg( "Missing field in memorial achievement data" );
+            continue;
+        }
+        if( !enabled_it->second.get<bool>() ) {
+            continue;
+        }
+        achievements_.push_back( ach_it->second.get<achievement_id>() );
+    }
+}
+
+void past_game_summary::serialize( JsonOut &jsout ) const
+{
+    jsout.start_object();
+    jsout.member( "avatar_name", avatar_name_ );
+    jsout.member( "achievements", achievements_ );
+    jsout.end_object();
+}
+
+void past_game_summary::deserialize( const JsonObject &jo )
+{
+    jo.read( "avatar_name", avatar_name_ );
+    jo.read( "achievements", achievements_ );
+}
+
+static cata_path summary_cache_path()
+{
+    // Not a .json file, so it is not mistaken for a memorial file
+    return PATH_INFO::memorialdir_path() / "past_games_summary.cache";
+}
+
+namespace
+{
+struct prefetched_past_games {
+    std::vector<cata_path> filenames;
+    std::optional<std::string> summary_cache;
+};
+
+prefetched_past_games read_past_games( bool read_cache )
+{
+    prefetched_past_games result;
+    const cata_path &memorial_dir = PATH_INFO::memorialdir_path();
+    assure_dir_exist( memorial_dir );
+    result.filenames = get_files_from_path( ".json", memorial_dir, true, true );
+    if( read_cache ) {
+        result.summary_cache = read_whole_file( summary_cache_path() );
+    }
+    return result;
+}
+
+/**
+ * Lists the memorial directory and reads the summary cache on a background
+ * thread. Only plain file access happens there, parsing the data interns ids
+ * and is left to the main thread in past_games_info::ensure_loaded.
+ */
+struct past_games_prefetcher {
+    std::thread reader;
+    std::optional<prefetched_past_games> result;
+
+    ~past_games_prefetcher() {
+        if( reader.joinable() ) {
+            reader.join();
+        }
+    }
+
+    void start( bool read_cache ) {
+        if( reader.joinable() ) {
+            return;
+        }
+        result.reset();
+        reader = std::thread( [this, read_cache]() {
+            try {
+                result = read_past_games( read_cache );
+            } catch( const std::exception & ) {
+                // Let the main thread run into the error again and report it.
+            }
+        } );
+    }
+
+    // @returns the prefetched data, or nullopt if there is none.
+    std::optional<prefetched_past_games> take() {
+        if( !reader.joinable() ) {
+            return std::nullopt;
+        }
+        reader.join();
+        std::optional<prefetched_past_games> taken = std::move( result );
+        result.reset();
+        return taken;
+    }
+};
+} // namespace
+
 static past_games_info past_games;
+static past_games_prefetcher prefetcher;
 
 // Using lazy initialization, so no need to do anything in the constructor
 past_games_info::past_games_info() = default;
 
 void past_games_info::clear()
 {
-    *this = past_games_info();
+    loaded_ = false;
+    completed_achievements_.clear();
+    ach_ids_.clear();
 }
 
 const achievement_completion_info *past_games_info::achievement( const achievement_id &ach ) const
@@ -111,6 +222,51 @@ void past_games_info::write_json_achievements( std::ostream &achievement_file )
     jsout.end_object();
 }
 
+void past_games_info::load_summary_cache( const std::string &contents )
+{
+    try {
+        JsonObject jo = json_loader::from_string( contents ).get_object();
+        int version = 0;
+        jo.read( "summary_version", version );
+        if( version != 0 ) {
+            return;
+        }
+        for( const JsonMember member : jo.get_object( "games" ) ) {
+            std::optional<past_game_summary> &summary = summaries_[member.name()];
+            if( member.test_null() ) {
+                summary.reset();
+            } else {
+                summary.emplace();
+                summary->deserialize( member.get_object() );
+            }
+        }
+    } catch( const JsonError & ) {
+        // A broken cache is simply rebuilt from the memorial files
+        summaries_.clear();
+    }
+}
+
+void past_games_info::save_summary_cache() const
+{
+    write_to_file( summary_cache_path(), [&]( std::ostream & fout ) {
+        JsonOut jsout( fout );
+        jsout.start_object();
+        jsout.member( "summary_version", 0 );
+        jsout.member( "games" );
+        jsout.start_object();
+        for( const auto &[filename, summary] : summaries_ ) {
+            jsout.member( filename );
+            if( summary ) {
+                summary->serialize( jsout );
+            } else {
+                jsout.write_null();
+            }
+        }
+        jsout.end_object();
+        jsout.end_object();
+    }, _( "past games summary" ) );
+}
+
 void past_games_info::ensure_loaded()
 {
     if( loaded_ ) {
@@ -119,18 +275,20 @@ void past_games_info::ensure_loaded()
 
     loaded_ = true;
 
-    static_popup popup;
-    popup.message( "%s", _( "Please wait while past game data loads…" ) );
-    ui_manager::redraw();
-    refresh_display();
-
-    const cata_path &memorial_dir = PATH_INFO::memorialdir_path();
-    assure_dir_exist( memorial_dir );
-    std::vector<cata_path> filenames = get_files_from_path( ".json", memorial_dir, true, true );
+    std::optional<prefetched_past_games> prefetched = prefetcher.take();
+    if( !prefetched ) {
+        prefetched = read_past_games( !cache_read_ );
+    }
+    if( !cache_read_ ) {
+        cache_read_ = true;
+        if( prefetched->summary_cache ) {
+            load_summary_cache( *prefetched->summary_cache );
+        }
+    }
 
     // Sort the files by the date & time encoded in the filename
     std::vector<std::pair<std::string, cata_path>> sortable_filenames;
-    for( const cata_path &filename : filenames ) {
+    for( const cata_path &filename : prefetched->filenames ) {
         std::vector<std::string> components = string_split(
                 filename.get_unrelative_path().generic_u8string(), '-' );
         if( components.size() < 7 ) {
@@ -158,38 +316,67 @@ void past_games_info::ensure_loaded()
         return l.second.get_unrelative_path() < r.second.get_unrelative_path();
     } );
 
+    // Only the files not seen before need to be parsed
+    std::vector<const cata_path *> new_files;
+    std::unordered_set<std::string> present;
     for( const std::pair<std::string, cata_path> &filename_pair : sortable_filenames ) {
-        const cata_path &filename = filename_pair.second;
-        try {
-            JsonValue jsin = json_loader::from_path( filename );
-            info_.emplace_back( jsin.get_object() );
-        } catch( const JsonError &err ) {
-            debugmsg( "Error reading memorial file %s: %s", filename.generic_u8string(), err.what() );
-        } catch( const too_old_memorial_file_error & ) {
-            // do nothing
-        }
-    }
-
-    for( past_game_info &game : info_ ) {
-        stats_tracker &stats = game.stats();
-        event_multiset &events = stats.get_events( event_type::player_gets_achievement );
-        const event_multiset::summaries_type &counts = events.counts();
-        for( const std::pair<const cata::event::data_type, event_summary> &p : counts ) {
-            const cata::event::data_type &event_data = p.first;
-            auto ach_it = event_data.find( "achievement" );
-            auto enabled_it = event_data.find( "achievements_enabled" );
-            if( ach_it == event_data.end() || enabled_it == event_data.end() ) {
-                debugmsg( "Missing field in memorial achievement data" );
-                continue;
-            }
-            if( !enabled_it->second.get<bool>() ) {
-                continue;
+        const std::string key = filename_pair.second.get_relative_path().generic_u8string();
+        present.insert( key );
+        if( summaries_.count( key ) == 0 ) {
+            new_files.push_back( &filename_pair.second );
+        }
+    }
+    bool changed = false;
+    for( auto it = summaries_.begin(); it != summaries_.end(); ) {
+        if( present.count( it->first ) == 0 ) {
+            it = summaries_.erase( it );
+            changed = true;
+        } else {
+            ++it;
+        }
+    }
+
+    if( !new_files.empty() ) {
+        std::optional<static_popup> popup;
+        // A game that just ended only adds a single file, not worth a popup
+        if( new_files.size() > 1 ) {
+            popup.emplace();
+            popup->message( "%s", _( "Please wait while past game data loads…" ) );
+            ui_manager::redraw();
+            refresh_display();
+        }
+        for( const cata_path *filename : new_files ) {
+            const std::string key = filename->get_relative_path().generic_u8string();
+            try {
+                JsonValue jsin = json_loader::from_path( *filename );
+                past_game_info info( jsin.get_object() );
+                summaries_[key].emplace( info );
+                changed = true;
+            } catch( const JsonError &err ) {
+                debugmsg( "Error reading memorial file %s: %s", filename->generic_u8string(),
+                          err.what() );
+            } catch( const too_old_memorial_file_error & ) {
+                summaries_[key].reset();
+                changed = true;
             }
-            achievement_id ach = ach_it->second.get<achievement_id>();
+            inp_mngr.pump_events();
+        }
+    }
+    if( changed ) {
+        save_summary_cache();
+    }
+
+    for( const std::pair<std::string, cata_path> &filename_pair : sortable_filenames ) {
+        const std::string key = filename_pair.second.get_relative_path().generic_u8string();
+        const auto it = summaries_.find( key );
+        if( it == summaries_.end() || !it->second ) {
+            continue;
+        }
+        const past_game_summary &game = *it->second;
+        for( const achievement_id &ach : game.achievements() ) {
             ach_ids_.push_back( ach );
             completed_achievements_[ach].games_completed.push_back( &game );
         }
-        inp_mngr.pump_events();
     }
 }
 
@@ -201,5 +388,14 @@ const past_games_info &get_past_games()
 
 void clear_past_games()
 {
+    // A listing read ahead may predate the file that was just written
+    prefetcher.take();
     past_games.clear();
 }
+
+void prefetch_past_games()
+{
+    if( !past_games.loaded() ) {
+        prefetcher.start( !past_games.summary_cache_read() );
+    }
+}
@@ -3,7 +3,10 @@
 #define CATA_SRC_PAST_GAMES_INFO_H
 
 #include <iosfwd>
+#include <map>
 #include <memory>
+#include <optional>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -14,6 +17,7 @@
 #include "type_id.h"
 
 class JsonObject;
+class JsonOut;
 class score;
 
 class past_game_info
@@ -36,13 +40,39 @@ class past_game_info
         std::string avatar_name_;
 };
 
+// What past_games_info keeps of each memorial file: just enough to tell which
+// achievements were completed and by whom.
+class past_game_summary
+{
+    public:
+        past_game_summary() = default;
+        explicit past_game_summary( past_game_info &info );
+
+        const std::string &avatar_name() const {
+            return avatar_name_;
+        }
+        const std::vector<achievement_id> &achievements() const {
+            return achievements_;
+        }
+
+        void serialize( JsonOut &jsout ) const;
+        void deserialize( const JsonObject &jo );
+    private:
+        std::string avatar_name_;
+        std::vector<achievement_id> achievements_;
+};
+
 struct achievement_completion_info {
-    std::vector<const past_game_info *> games_completed;
+    std::vector<const past_game_summary *> games_completed;
 };
 
 // This class is intended to provide information about past games loaded from
 // memorial files.  It can be used for example to know what achievements have
 // been completed in past games.
+//
+// Memorial files are only parsed once.  Their summaries are kept in a cache
+// file in the memorial directory, so later loads only parse the files added
+// since then.
 class past_games_info
 {
     public:
@@ -50,17 +80,34 @@ class past_games_info
 
         void write_json_achievements( std::ostream &achievement_file ) const;
         void ensure_loaded();
+        // Rescans the memorial directory on the next load, keeping the
+        // summaries of the files already seen.
         void clear();
         const achievement_completion_info *achievement( const achievement_id & ) const;
+
+        bool loaded() const {
+            return loaded_;
+        }
+        bool summary_cache_read() const {
+            return cache_read_;
+        }
     private:
+        void load_summary_cache( const std::string &contents );
+        void save_summary_cache() const;
 
         bool loaded_ = false;
+        bool cache_read_ = false;
         std::unordered_map<achievement_id, achievement_completion_info> completed_achievements_;
-        std::vector<past_game_info> info_;
+        // Keyed by memorial file path; nullopt for files too old to hold any
+        // achievement data.
+        std::map<std::string, std::optional<past_game_summary>> summaries_;
         std::vector<achievement_id> ach_ids_;
 };
 
 const past_games_info &get_past_games();
 void clear_past_games();
+// Starts reading the memorial directory and the summary cache on a background
+// thread, so a later get_past_games() need not wait for the disk.
+void prefetch_past_games();
 
 #endif // CATA_SRC_PAST_GAMES_INFO_H
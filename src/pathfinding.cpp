@@ -6,7 +6,6 @@
 #include <iterator>
 #include <memory>
 #include <optional>
-#include <queue>
 #include <set>
 #include <utility>
 #include <vector>
@@ -48,10 +47,12 @@ struct path_data_layer {
     }
 };
 
+// Scratch state for map::route. It is kept in a single static instance and reused, so that
+// repeated searches don't allocate: the layers are only created once, and the open list is
+// a binary heap over a vector that keeps its capacity between calls.
 struct pathfinder {
-    using queue_type =
-        std::priority_queue< std::pair<int, tripoint>, std::vector< std::pair<int, tripoint> >, pair_greater_cmp_first >;
-    queue_type open;
+    using open_entry = std::pair<int, tripoint>;
+    std::vector<open_entry> open;
     std::array< std::unique_ptr< path_data_layer >, OVERMAP_LAYERS > path_data;
 
     path_data_layer &get_layer( const int z ) {
@@ -70,7 +71,7 @@ struct pathfinder {
                 path_data[i + OVERMAP_DEPTH]->reset();
             }
         }
-        open = queue_type();
+        open.clear();
     }
 
     bool empty() const {
@@ -78,9 +79,10 @@ struct pathfinder {
     }
 
     tripoint get_next() {
-        const auto pt = open.top();
-        open.pop();
-        return pt.second;
+        std::pop_heap( open.begin(), open.end(), pair_greater_cmp_first() );
+        const tripoint pt = open.back().second;
+        open.pop_back();
+        return pt;
     }
 
     void add_point( const int gscore, const int score, const tripoint &from, const tripoint &to ) {
@@ -97,7 +99,8 @@ struct pathfinder {
         layer.gscore[index] = gscore;
         layer.parent[index] = from;
         layer.score [index] = score;
-        open.emplace( score, to );
+        open.emplace_back( score, to );
+        std::push_heap( open.begin(), open.end(), pair_greater_cmp_first() );
     }
 
     void close_point( const tripoint &p ) {
@@ -167,62 +170,86 @@ static bool is_disjoint( const Set1 &set1, const Set2 &set2 )
 std::vector<tripoint> map::straight_route( const tripoint &f, const tripoint &t ) const
 {
     std::vector<tripoint> ret;
+    straight_route( ret, f, t );
+    return ret;
+}
+
+void map::straight_route( std::vector<tripoint> &path, const tripoint &f,
+                          const tripoint &t ) const
+{
+    path.clear();
     if( f == t || !inbounds( f ) ) {
-        return ret;
+        return;
     }
     if( !inbounds( t ) ) {
         tripoint clipped = t;
         clip_to_bounds( clipped );
-        return straight_route( f, clipped );
+        straight_route( path, f, clipped );
+        return;
     }
     if( f.z == t.z ) {
-        ret = line_to( f, t );
+        // Same as line_to, but reusing the storage of path.
+        path.reserve( square_dist( f, t ) );
+        bresenham( f, t, 0, 0, [&path]( const tripoint & new_point ) {
+            path.push_back( new_point );
+            return true;
+        } );
         const pathfinding_cache &pf_cache = get_pathfinding_cache_ref( f.z );
         // Check all points for any special case (including just hard terrain)
-        if( std::any_of( ret.begin(), ret.end(), [&pf_cache]( const tripoint & p ) {
+        if( std::any_of( path.begin(), path.end(), [&pf_cache]( const tripoint & p ) {
         constexpr pf_special non_normal = PF_SLOW | PF_WALL | PF_VEHICLE | PF_TRAP | PF_SHARP;
         return pf_cache.special[p.x][p.y] & non_normal;
         } ) ) {
-            ret.clear();
+            path.clear();
         }
     }
-    return ret;
 }
 
 std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                                   const pathfinding_settings &settings,
                                   const std::unordered_set<tripoint> &pre_closed ) const
+{
+    std::vector<tripoint> ret;
+    route( ret, f, t, settings, pre_closed );
+    return ret;
+}
+
+void map::route( std::vector<tripoint> &path, const tripoint &f, const tripoint &t,
+                 const pathfinding_settings &settings,
+                 const std::unordered_set<tripoint> &pre_closed ) const
 {
     /* TODO: If the origin or destination is out of bound, figure out the closest
      * in-bounds point and go to that, then to the real origin/destination.
      */
-    std::vector<tripoint> ret;
+    path.clear();
 
     if( f == t || !inbounds( f ) ) {
-        return ret;
+        return;
     }
 
     if( !inbounds( t ) ) {
         tripoint clipped = t;
         clip_to_bounds( clipped );
-        return route( f, clipped, settings, pre_closed );
+        route( path, f, clipped, settings, pre_closed );
+        return;
     }
     // First, check for a simple straight line on flat ground
     // Except when the line contains a pre-closed tile - we need to do regular pathing then
     if( f.z == t.z ) {
-        auto line_path = straight_route( f, t );
-        if( !line_path.empty() ) {
-            if( std::none_of( line_path.begin(), line_path.end(), [&pre_closed]( const tripoint & p ) {
+        straight_route( path, f, t );
+        if( !path.empty() ) {
+            if( std::none_of( path.begin(), path.end(), [&pre_closed]( const tripoint & p ) {
             return pre_closed.count( p );
             } ) ) {
-                return line_path;
+                return;
             }
+            path.clear();
         }
     }
 
     // If expected path length is greater than max distance, allow only line path, like above
     if( rl_dist( f, t ) > settings.max_dist ) {
-        return ret;
+        return;
     }
 
     const int max_length = settings.max_length;
@@ -267,8 +294,8 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
         }
 
         if( layer.gscore[parent_index] > max_length ) {
-            // Shortest path would be too long, return empty vector
-            return std::vector<tripoint>();
+            // Shortest path would be too long, return empty path
+            return;
         }
 
         if( cur == t ) {
@@ -521,7 +548,7 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
     } while( !done && !pf.empty() );
 
     if( done ) {
-        ret.reserve( rl_dist( f, t ) * 2 );
+        path.reserve( rl_dist( f, t ) * 2 );
         tripoint cur = t;
         // Just to limit max distance, in case something weird happens
         for( int fdist = max_length; fdist != 0; fdist-- ) {
@@ -532,22 +559,20 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                 break;
             }
 
-            ret.push_back( cur );
+            path.push_back( cur );
             // Jumps are acceptable on 1 z-level changes
             // This is because stairs teleport the player too
             if( rl_dist( cur, par ) > 1 && std::abs( cur.z - par.z ) != 1 ) {
                 debugmsg( "Jump in our route!  %d:%d:%d->%d:%d:%d",
                           cur.x, cur.y, cur.z, par.x, par.y, par.z );
-                return ret;
+                return;
             }
 
             cur = par;
         }
 
-        std::reverse( ret.begin(), ret.end() );
+        std::reverse( path.begin(), path.end() );
     }
-
-    return ret;
 }
 
 std::vector<tripoint_bub_ms> map::route( const tripoint_bub_ms &f, const tripoint_bub_ms &t,
@@ -562,3 +587,396 @@ std::vector<tripoint_bub_ms> map::route( const tripoint_bub_ms &f, const tripoin
     } );
     return result;
 }
+
+// Settings that change the cost model used by flow fields and portal graphs. The others only
+// matter for the obstacles those never path through anyway.
+static bool same_cost_model( const pathfinding_settings &a,
+                                       const pathfinding_settings &b )
+{
+    return a.max_length == b.max_length && a.avoid_traps == b.avoid_traps &&
+           a.avoid_rough_terrain == b.avoid_rough_terrain && a.avoid_sharp == b.avoid_sharp;
+}
+
+// Cost of stepping onto p, or 0 if flow fields and portal graphs don't path through p at all.
+static int flow_field_enter_cost( const map &m, const pathfinding_cache &pf_cache,
+                                  const pathfinding_settings &settings, const tripoint &p )
+{
+    constexpr pf_special non_normal = PF_SLOW | PF_WALL | PF_VEHICLE | PF_TRAP | PF_SHARP;
+    const pf_special p_special = pf_cache.special[p.x][p.y];
+    if( !( p_special & non_normal ) ) {
+        return 2;
+    }
+    if( settings.avoid_rough_terrain || ( p_special & ( PF_WALL | PF_VEHICLE ) ) ||
+        ( settings.avoid_traps && ( p_special & PF_TRAP ) ) ||
+        ( settings.avoid_sharp && ( p_special & PF_SHARP ) ) ) {
+        return 0;
+    }
+    return std::max( m.move_cost( p ), 2 );
+}
+
+const flow_field &map::get_flow_field( const tripoint &dest,
+                                       const pathfinding_settings &settings ) const
+{
+    // A handful of fields per z-level covers the usual case of hordes chasing the avatar
+    // and a few NPCs.
+    constexpr size_t max_flow_fields = 4;
+
+    const pathfinding_cache &pf_cache = get_pathfinding_cache_ref( dest.z );
+    std::vector<std::unique_ptr<flow_field>> &fields = get_pathfinding_cache( dest.z ).flow_fields;
+    for( auto it = fields.begin(); it != fields.end(); ++it ) {
+        if( ( *it )->dest == dest && same_cost_model( ( *it )->settings, settings ) ) {
+            std::rotate( fields.begin(), it, std::next( it ) );
+            return *fields.front();
+        }
+    }
+
+    std::unique_ptr<flow_field> field;
+    if( fields.size() >= max_flow_fields ) {
+        field = std::move( fields.back() );
+        fields.pop_back();
+    } else {
+        field = std::make_unique<flow_field>();
+    }
+    field->dest = dest;
+    field->settings = settings;
+    field->cost.fill( flow_field::unreachable );
+
+    // Dijkstra outwards from the destination, so cost[p] is the cost of walking from p to dest.
+    std::vector<std::pair<int, point>> open;
+    field->cost[dest.x][dest.y] = 0;
+    open.emplace_back( 0, dest.xy() );
+    const int size = getmapsize() * SEEX;
+    while( !open.empty() ) {
+        std::pop_heap( open.begin(), open.end(), pair_greater_cmp_first() );
+        const auto [cur_cost, cur] = open.back();
+        open.pop_back();
+        if( cur_cost > field->cost[cur.x][cur.y] ) {
+            continue;
+        }
+        // Walking into cur costs the same from any neighbour, apart from the diagonal penalty.
+        const tripoint cur3( cur, dest.z );
+        const int enter_cost = cur3 == dest ? 2 :
+                               flow_field_enter_cost( *this, pf_cache, settings, cur3 );
+        for( const tripoint &offset : eight_horizontal_neighbors ) {
+            const point p = cur + offset.xy();
+            if( p.x < 0 || p.y < 0 || p.x >= size || p.y >= size ) {
+                continue;
+            }
+            const int new_cost = cur_cost + enter_cost + ( offset.x != 0 && offset.y != 0 ? 1 : 0 );
+            if( new_cost > settings.max_length || new_cost >= field->cost[p.x][p.y] ||
+                flow_field_enter_cost( *this, pf_cache, settings, tripoint( p, dest.z ) ) == 0 ) {
+                continue;
+            }
+            field->cost[p.x][p.y] = new_cost;
+            open.emplace_back( new_cost, p );
+            std::push_heap( open.begin(), open.end(), pair_greater_cmp_first() );
+        }
+    }
+
+    fields.insert( fields.begin(), std::move( field ) );
+    return *fields.front();
+}
+
+bool map::flow_field_route( std::vector<tripoint> &path, const tripoint &f, const tripoint &t,
+                            const pathfinding_settings &settings,
+                            const std::unordered_set<tripoint> &pre_closed ) const
+{
+    path.clear();
+    if( f == t || f.z != t.z || !inbounds( f ) || !inbounds( t ) ||
+        rl_dist( f, t ) > settings.max_dist ) {
+        return false;
+    }
+
+    const flow_field &field = get_flow_field( t, settings );
+
+    // Walk downhill. Every step must strictly lower the cost, so this always terminates.
+    // The start itself may be off the field (e.g. standing in a trap that the field avoids),
+    // in which case any reachable neighbour will do for the first step.
+    tripoint cur = f;
+    int cur_cost = field.cost[f.x][f.y];
+    while( cur != t ) {
+        tripoint best = cur;
+        int best_cost = cur_cost;
+        for( const tripoint &offset : eight_horizontal_neighbors ) {
+            const tripoint p = cur + offset;
+            if( !inbounds( p ) || ( p != t && pre_closed.count( p ) ) ) {
+                continue;
+            }
+            if( field.cost[p.x][p.y] < best_cost ) {
+                best = p;
+                best_cost = field.cost[p.x][p.y];
+            }
+        }
+        if( best == cur ) {
+            // Boxed in by pre_closed points, let A* deal with it.
+            path.clear();
+            return false;
+        }
+        path.push_back( best );
+        cur = best;
+        cur_cost = best_cost;
+    }
+    return true;
+}
+
+// Abstract graph for hierarchical pathfinding on one z-level. Nodes are the cells on either
+// side of each gap between two neighbouring submaps, edges are either a step through such a
+// gap or the cheapest walk between two nodes inside one submap.
+struct portal_graph {
+    struct edge {
+        int to;
+        int cost;
+    };
+    struct node {
+        point pos;
+        std::vector<edge> edges;
+    };
+
+    pathfinding_settings settings;
+    std::vector<node> nodes;
+    // Indices into nodes, per submap, indexed by submap_index().
+    std::vector<std::vector<int>> submap_nodes;
+    int size = 0;
+
+    int submap_index( const point &p ) const {
+        return ( p.x / SEEX ) * size + p.y / SEEY;
+    }
+};
+
+pathfinding_cache::pathfinding_cache()
+{
+    dirty = true;
+}
+
+pathfinding_cache::~pathfinding_cache() = default;
+
+void pathfinding_cache::clear_route_caches()
+{
+    flow_fields.clear();
+    portals.reset();
+}
+
+// Cheapest costs between `from` and every cell of the submap containing it, moving only
+// inside that submap. With `towards` set, cost[c] is the cost of walking from c to `from`,
+// otherwise of walking from `from` to c. Cells are indexed by local x * SEEY + local y.
+static void submap_dijkstra( const map &m, const pathfinding_cache &pf_cache,
+                             const pathfinding_settings &settings, const tripoint &from,
+                             const bool towards, std::array<int, SEEX *SEEY> &cost )
+{
+    const point origin( from.x - from.x % SEEX, from.y - from.y % SEEY );
+    const auto local_index = [&origin]( const point & p ) {
+        return ( p.x - origin.x ) * SEEY + p.y - origin.y;
+    };
+    const auto enter_cost = [&]( const point & p ) {
+        return flow_field_enter_cost( m, pf_cache, settings, tripoint( p, from.z ) );
+    };
+
+    cost.fill( INT_MAX );
+    std::vector<std::pair<int, point>> open;
+    cost[local_index( from.xy() )] = 0;
+    open.emplace_back( 0, from.xy() );
+    while( !open.empty() ) {
+        std::pop_heap( open.begin(), open.end(), pair_greater_cmp_first() );
+        const auto [cur_cost, cur] = open.back();
+        open.pop_back();
+        if( cur_cost > cost[local_index( cur )] ) {
+            continue;
+        }
+        // When walking towards `from` the cost is paid for entering cur, not the neighbour.
+        const int cur_enter = towards ? std::max( enter_cost( cur ), 2 ) : 0;
+        for( const tripoint &offset : eight_horizontal_neighbors ) {
+            const point p = cur + offset.xy();
+            if( p.x < origin.x || p.y < origin.y || p.x >= origin.x + SEEX || p.y >= origin.y + SEEY ) {
+                continue;
+            }
+            const int p_enter = enter_cost( p );
+            if( p_enter == 0 ) {
+                continue;
+            }
+            const int new_cost = cur_cost + ( towards ? cur_enter : p_enter ) +
+                                 ( offset.x != 0 && offset.y != 0 ? 1 : 0 );
+            if( new_cost >= cost[local_index( p )] ) {
+                continue;
+            }
+            cost[local_index( p )] = new_cost;
+            open.emplace_back( new_cost, p );
+            std::push_heap( open.begin(), open.end(), pair_greater_cmp_first() );
+        }
+    }
+}
+
+const portal_graph &map::get_portal_graph( const int zlev,
+        const pathfinding_settings &settings ) const
+{
+    const pathfinding_cache &pf_cache = get_pathfinding_cache_ref( zlev );
+    std::unique_ptr<portal_graph> &graph = get_pathfinding_cache( zlev ).portals;
+    if( graph && same_cost_model( graph->settings, settings ) ) {
+        return *graph;
+    }
+
+    graph = std::make_unique<portal_graph>();
+    graph->settings = settings;
+    graph->size = getmapsize();
+    graph->submap_nodes.resize( graph->size * graph->size );
+
+    const auto enter_cost = [&]( const point & p ) {
+        return flow_field_enter_cost( *this, pf_cache, settings, tripoint( p, zlev ) );
+    };
+    const auto add_node = [&graph]( const point & p ) {
+        graph->nodes.push_back( { p, {} } );
+        const int index = static_cast<int>( graph->nodes.size() ) - 1;
+        graph->submap_nodes[graph->submap_index( p )].push_back( index );
+        return index;
+    };
+    // Every maximal run of open cell pairs along a submap border becomes one portal, placed
+    // in the middle of the run.
+    const auto add_portals = [&]( const point & start, const point & along, const point & across ) {
+        int run = 0;
+        for( int i = 0; i <= SEEX; ++i ) {
+            const point a = start + along * i;
+            const bool open = i < SEEX && enter_cost( a ) != 0 && enter_cost( a + across ) != 0;
+            if( open ) {
+                ++run;
+                continue;
+            }
+            if( run > 0 ) {
+                const point pa = start + along * ( i - 1 - run / 2 );
+                const point pb = pa + across;
+                const int na = add_node( pa );
+                const int nb = add_node( pb );
+                graph->nodes[na].edges.push_back( { nb, enter_cost( pb ) } );
+                graph->nodes[nb].edges.push_back( { na, enter_cost( pa ) } );
+            }
+            run = 0;
+        }
+    };
+    for( int sx = 0; sx < graph->size; ++sx ) {
+        for( int sy = 0; sy < graph->size; ++sy ) {
+            const point origin( sx * SEEX, sy * SEEY );
+            if( sx + 1 < graph->size ) {
+                add_portals( origin + point( SEEX - 1, 0 ), point_south, point_east );
+            }
+            if( sy + 1 < graph->size ) {
+                add_portals( origin + point( 0, SEEY - 1 ), point_east, point_south );
+            }
+        }
+    }
+
+    std::array<int, SEEX *SEEY> cost;
+    for( const std::vector<int> &in_submap : graph->submap_nodes ) {
+        for( const int from : in_submap ) {
+            const point from_pos = graph->nodes[from].pos;
+            submap_dijkstra( *this, pf_cache, settings, tripoint( from_pos, zlev ), false, cost );
+            const point origin( from_pos.x - from_pos.x % SEEX, from_pos.y - from_pos.y % SEEY );
+            for( const int to : in_submap ) {
+                const point local = graph->nodes[to].pos - origin;
+                const int c = cost[local.x * SEEY + local.y];
+                if( to != from && c != INT_MAX ) {
+                    graph->nodes[from].edges.push_back( { to, c } );
+                }
+            }
+        }
+    }
+    return *graph;
+}
+
+void map::hierarchical_route( std::vector<tripoint> &path, const tripoint &f, const tripoint &t,
+                              const pathfinding_settings &settings,
+                              const std::unordered_set<tripoint> &pre_closed ) const
+{
+    // Only this many submaps of the route are planned to tile precision, the rest is left
+    // for later calls once the caller gets closer.
+    constexpr int refined_submaps = 2;
+
+    path.clear();
+    if( f == t || !inbounds( f ) || !inbounds( t ) || f.z != t.z ||
+        square_dist( f.xy() / SEEX, t.xy() / SEEX ) <= refined_submaps ) {
+        route( path, f, t, settings, pre_closed );
+        return;
+    }
+
+    const portal_graph &graph = get_portal_graph( f.z, settings );
+    const pathfinding_cache &pf_cache = get_pathfinding_cache_ref( f.z );
+    const int num_nodes = static_cast<int>( graph.nodes.size() );
+    // One extra virtual node for the destination
+    const int goal = num_nodes;
+    std::vector<int> gscore( num_nodes + 1, INT_MAX );
+    std::vector<int> parent( num_nodes + 1, -1 );
+    std::vector<std::pair<int, int>> open;
+    // Every step costs at least 2, so this never overestimates.
+    const auto heuristic = [&]( const int node ) {
+        return node == goal ? 0 : 2 * square_dist( graph.nodes[node].pos, t.xy() );
+    };
+    const auto push = [&]( const int node, const int g, const int from ) {
+        if( g >= gscore[node] || g > settings.max_length ) {
+            return;
+        }
+        gscore[node] = g;
+        parent[node] = from;
+        open.emplace_back( g + heuristic( node ), node );
+        std::push_heap( open.begin(), open.end(), pair_greater_cmp_first() );
+    };
+
+    std::array<int, SEEX *SEEY> start_cost;
+    submap_dijkstra( *this, pf_cache, settings, f, false, start_cost );
+    std::array<int, SEEX *SEEY> goal_cost;
+    submap_dijkstra( *this, pf_cache, settings, t, true, goal_cost );
+    const point start_origin( f.x - f.x % SEEX, f.y - f.y % SEEY );
+    const point goal_origin( t.x - t.x % SEEX, t.y - t.y % SEEY );
+    const int goal_submap = graph.submap_index( t.xy() );
+
+    for( const int n : graph.submap_nodes[graph.submap_index( f.xy() )] ) {
+        const point local = graph.nodes[n].pos - start_origin;
+        const int c = start_cost[local.x * SEEY + local.y];
+        if( c != INT_MAX ) {
+            push( n, c, -1 );
+        }
+    }
+    while( !open.empty() ) {
+        std::pop_heap( open.begin(), open.end(), pair_greater_cmp_first() );
+        const auto [score, cur] = open.back();
+        open.pop_back();
+        if( cur == goal ) {
+            break;
+        }
+        if( score > gscore[cur] + heuristic( cur ) ) {
+            // Already expanded with a lower cost
+            continue;
+        }
+        for( const portal_graph::edge &e : graph.nodes[cur].edges ) {
+            push( e.to, gscore[cur] + e.cost, cur );
+        }
+        if( graph.submap_index( graph.nodes[cur].pos ) == goal_submap ) {
+            const point local = graph.nodes[cur].pos - goal_origin;
+            const int c = goal_cost[local.x * SEEY + local.y];
+            if( c != INT_MAX ) {
+                push( goal, gscore[cur] + c, cur );
+            }
+        }
+    }
+    if( parent[goal] == -1 ) {
+        // No way through by walking, maybe plain A* can bash or open its way there
+        route( path, f, t, settings, pre_closed );
+        return;
+    }
+
+    std::vector<int> nodes;
+    for( int n = parent[goal]; n != -1; n = parent[n] ) {
+        nodes.push_back( n );
+    }
+    tripoint waypoint = t;
+    for( auto it = nodes.rbegin(); it != nodes.rend(); ++it ) {
+        const point pos = graph.nodes[*it].pos;
+        if( square_dist( pos / SEEX, f.xy() / SEEX ) >= refined_submaps ) {
+            waypoint = tripoint( pos, f.z );
+            break;
+        }
+    }
+
+    pathfinding_settings refine_settings = settings;
+    refine_settings.max_dist = std::max( settings.max_dist, rl_dist( f, waypoint ) );
+    route( path, f, waypoint, refine_settings, pre_closed );
+    if( path.empty() ) {
+        route( path, f, t, settings, pre_closed );
+    }
+}
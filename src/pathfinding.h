@@ -2,6 +2,10 @@
 #ifndef CATA_SRC_PATHFINDING_H
 #define CATA_SRC_PATHFINDING_H
 
+#include <climits>
+#include <memory>
+#include <vector>
+
 #include "coordinates.h"
 #include "game_constants.h"
 #include "mdarray.h"
@@ -40,13 +44,26 @@ inline pf_special &operator &= ( pf_special &lhs, pf_special rhs )
     return lhs;
 }
 
+struct flow_field;
+struct portal_graph;
+
 struct pathfinding_cache {
     pathfinding_cache();
+    ~pathfinding_cache();
+
+    // Drops the flow fields and portal graph, which are built from the data below.
+    void clear_route_caches();
 
     bool dirty = false;
     std::unordered_set<point> dirty_points;
 
     cata::mdarray<pf_special, point_bub_ms> special;
+
+    // Flow fields computed on this z-level, most recently used first.
+    // Dropped whenever the cache is marked dirty.
+    std::vector<std::unique_ptr<flow_field>> flow_fields;
+    // Submap level graph for long routes, built on demand and dropped along with the flow fields.
+    std::unique_ptr<portal_graph> portals;
 };
 
 struct pathfinding_settings {
@@ -78,4 +95,18 @@ struct pathfinding_settings {
     pathfinding_settings &operator=( const pathfinding_settings & ) = default;
 };
 
+/**
+ * Cost of the cheapest path from every point of a z-level to a single destination,
+ * computed with Dijkstra's algorithm over the pathfinding cache. Creatures heading to the
+ * same destination with compatible settings share one field and just walk downhill,
+ * instead of each running their own A* search.
+ */
+struct flow_field {
+    static constexpr int unreachable = INT_MAX;
+
+    tripoint dest;
+    pathfinding_settings settings;
+    cata::mdarray<int, point_bub_ms> cost;
+};
+
 #endif // CATA_SRC_PATHFINDING_H
@@ -8,7 +8,6 @@
 #include <cmath>
 #include <cstdlib>
 #include <functional>
-#include <iterator>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -33,6 +32,7 @@
 #include "monster.h"
 #include "pixel_minimap_projectors.h"
 #include "sdl_utils.h"
+#include "submap.h"
 #include "vehicle.h"
 #include "vpart_position.h"
 
@@ -167,8 +167,14 @@ class pixel_minimap::shared_texture_pool
 struct pixel_minimap::submap_cache {
     //the color stored for each submap tile
     std::array<SDL_Color, SEEX *SEEY> minimap_colors = {};
-    //checks if the submap has been looked at by the minimap routine
-    bool touched = false;
+    //what the colors were computed from, so unchanged tiles can be skipped
+    std::array<lit_level, SEEX *SEEY> lighting = {};
+    std::bitset<SEEX *SEEY> had_vehicle;
+    const submap *source = nullptr;
+    int source_version = 0;
+    bool nv_goggle = false;
+    //whether the colors were computed at all
+    bool computed = false;
     //the texture updates are drawn to
     SDL_Texture_Ptr chunk_tex;
     //the submap being handled
@@ -227,48 +233,55 @@ void pixel_minimap::set_settings( const pixel_minimap_settings &settings )
     reset();
 }
 
+//moves the submap caches along when the map shifted, so they stay at their submap
 void pixel_minimap::prepare_cache_for_updates( const tripoint &center )
 {
     // TODO: fix point types
-    const tripoint new_center_sm = get_map().get_abs_sub().raw() + ms_to_sm_copy( center );
-    const tripoint center_sm_diff = cached_center_sm - new_center_sm;
-
-    //invalidate the cache if the game shifted more than one submap in the last update, or if z-level changed.
-    if( std::abs( center_sm_diff.x ) > 1 ||
-        std::abs( center_sm_diff.y ) > 1 ||
-        std::abs( center_sm_diff.z ) > 0 ) {
-        cache.clear();
-    } else {
-        for( auto &mcp : cache ) {
-            mcp.second.touched = false;
-        }
+    const tripoint new_origin_sm = tripoint( get_map().get_abs_sub().raw().xy(), center.z );
+    const tripoint shift = new_origin_sm - cached_origin_sm;
+    cached_origin_sm = new_origin_sm;
+
+    if( cache.size() != static_cast<size_t>( MAPSIZE * MAPSIZE ) || shift.z != 0 ) {
+        clear_cache();
+        return;
+    }
+    if( shift == tripoint_zero ) {
+        return;
     }
 
-    cached_center_sm = new_center_sm;
+    //caches that left the reality bubble are dropped first, returning their textures to the pool
+    std::vector<std::unique_ptr<submap_cache>> shifted( cache.size() );
+    for( int y = 0; y < MAPSIZE; ++y ) {
+        for( int x = 0; x < MAPSIZE; ++x ) {
+            const point old_pos = point( x, y ) + shift.xy();
+            if( old_pos.x >= 0 && old_pos.x < MAPSIZE && old_pos.y >= 0 && old_pos.y < MAPSIZE ) {
+                shifted[y * MAPSIZE + x] = std::move( cache[old_pos.y * MAPSIZE + old_pos.x] );
+            }
+        }
+    }
+    cache.clear();
+    cache = std::move( shifted );
 }
 
-//deletes the mapping of unused submap caches from the main map
-//the touched flag prevents deletion
-void pixel_minimap::clear_unused_cache()
+void pixel_minimap::clear_cache()
 {
-    for( auto it = cache.begin(); it != cache.end(); ) {
-        it = it->second.touched ? std::next( it ) : cache.erase( it );
-    }
+    cache.clear();
+    cache.resize( MAPSIZE * MAPSIZE );
 }
 
 //draws individual updates to the submap cache texture
 //the render target will be set back to display_buffer after all submaps are updated
 void pixel_minimap::flush_cache_updates()
 {
-    for( auto &mcp : cache ) {
-        if( mcp.second.update_list.empty() ) {
+    for( const std::unique_ptr<submap_cache> &entry : cache ) {
+        if( !entry || entry->update_list.empty() ) {
             continue;
         }
 
-        SetRenderTarget( renderer, mcp.second.chunk_tex );
+        SetRenderTarget( renderer, entry->chunk_tex );
 
-        if( !mcp.second.ready ) {
-            mcp.second.ready = true;
+        if( !entry->ready ) {
+            entry->ready = true;
 
             SetRenderDrawColor( renderer, 0x00, 0x00, 0x00, 0x00 );
             RenderClear( renderer );
@@ -285,9 +298,9 @@ void pixel_minimap::flush_cache_updates()
             }
         }
 
-        for( const point &p : mcp.second.update_list ) {
+        for( const point &p : entry->update_list ) {
             const point tile_pos = projector->get_tile_pos( p, { SEEX, SEEY } );
-            const SDL_Color tile_color = mcp.second.color_at( p );
+            const SDL_Color tile_color = entry->color_at( p );
 
             if( pixel_size.x == 1 && pixel_size.y == 1 ) {
                 SetRenderDrawColor( renderer, tile_color.r, tile_color.g, tile_color.b, tile_color.a );
@@ -297,7 +310,7 @@ void pixel_minimap::flush_cache_updates()
             }
         }
 
-        mcp.second.update_list.clear();
+        entry->update_list.clear();
     }
 }
 
@@ -307,16 +320,33 @@ void pixel_minimap::update_cache_at( const tripoint &sm_pos )
     const level_cache &access_cache = here.access_cache( sm_pos.z );
     const bool nv_goggle = get_player_character().get_vision_modes()[NV_GOGGLES];
 
-    // TODO: fix point types
-    submap_cache &cache_item = get_cache_at( here.get_abs_sub().raw() + sm_pos );
+    submap_cache &cache_item = get_cache_at( sm_pos.xy() );
     const tripoint ms_pos = sm_to_ms_copy( sm_pos );
 
-    cache_item.touched = true;
+    //terrain and furniture only need to be looked at again if they changed, vehicles might
+    //have changed without notice
+    const submap *source = here.maptile_at( ms_pos ).wrapped_submap();
+    const bool recompute_all = !cache_item.computed || cache_item.source != source ||
+                               ( source && cache_item.source_version != source->display_version ) ||
+                               cache_item.nv_goggle != nv_goggle;
+    cache_item.computed = true;
+    cache_item.source = source;
+    cache_item.source_version = source ? source->display_version : 0;
+    cache_item.nv_goggle = nv_goggle;
 
     for( int y = 0; y < SEEY; ++y ) {
         for( int x = 0; x < SEEX; ++x ) {
             const tripoint p = ms_pos + tripoint{ x, y, 0 };
             const lit_level lighting = access_cache.visibility_cache[p.x][p.y];
+            const bool has_vehicle = access_cache.get_veh_exists_at( p );
+            const size_t index = y * SEEX + x;
+
+            if( !recompute_all && !has_vehicle && !cache_item.had_vehicle[index] &&
+                cache_item.lighting[index] == lighting ) {
+                continue;
+            }
+            cache_item.lighting[index] = lighting;
+            cache_item.had_vehicle[index] = has_vehicle;
 
             SDL_Color color;
 
@@ -350,15 +380,15 @@ void pixel_minimap::update_cache_at( const tripoint &sm_pos )
     }
 }
 
-pixel_minimap::submap_cache &pixel_minimap::get_cache_at( const tripoint &abs_sm_pos )
+pixel_minimap::submap_cache &pixel_minimap::get_cache_at( const point &sm_pos )
 {
-    auto it = cache.find( abs_sm_pos );
+    std::unique_ptr<submap_cache> &entry = cache[sm_pos.y * MAPSIZE + sm_pos.x];
 
-    if( it == cache.end() ) {
-        it = cache.emplace( abs_sm_pos, submap_cache( *tex_pool ) ).first;
+    if( !entry ) {
+        entry = std::make_unique<submap_cache>( *tex_pool );
     }
 
-    return it->second;
+    return *entry;
 }
 
 void pixel_minimap::process_cache( const tripoint &center )
@@ -372,7 +402,6 @@ void pixel_minimap::process_cache( const tripoint &center )
     }
 
     flush_cache_updates();
-    clear_unused_cache();
 }
 
 void pixel_minimap::set_screen_rect( const SDL_Rect &screen_rect )
@@ -416,7 +445,7 @@ void pixel_minimap::set_screen_rect( const SDL_Rect &screen_rect )
         main_tex = create_cache_texture( renderer, size_on_screen.x, size_on_screen.y );
     }
 
-    cache.clear();
+    clear_cache();
 
     const point chunk_size = projector->get_tiles_size( { SEEX, SEEY } );
 
@@ -432,7 +461,7 @@ void pixel_minimap::set_screen_rect( const SDL_Rect &screen_rect )
 void pixel_minimap::reset()
 {
     projector.reset();
-    cache.clear();
+    clear_cache();
     main_tex.reset();
     tex_pool.reset();
 }
@@ -454,8 +483,7 @@ void pixel_minimap::render( const tripoint &center )
 
 void pixel_minimap::render_cache( const tripoint &center )
 {
-    // TODO: fix point types
-    const tripoint sm_center = get_map().get_abs_sub().raw() + ms_to_sm_copy( center );
+    const point sm_center = ms_to_sm_copy( center.xy() );
     const tripoint sm_offset = tripoint{
         total_tiles_count.x / SEEX / 2,
         total_tiles_count.y / SEEY / 2, 0
@@ -467,25 +495,27 @@ void pixel_minimap::render_cache( const tripoint &center )
                                   ( total_tiles_count.y / 2 ) % SEEY );
     ms_offset = ms_base_offset - ms_offset;
 
-    for( const auto &elem : cache ) {
-        if( !elem.second.touched ) {
-            continue;   // What you gonna do with all that junk?
-        }
+    for( int y = 0; y < MAPSIZE; ++y ) {
+        for( int x = 0; x < MAPSIZE; ++x ) {
+            const std::unique_ptr<submap_cache> &entry = cache[y * MAPSIZE + x];
+            if( !entry ) {
+                continue;
+            }
 
-        const tripoint rel_pos = elem.first - sm_center;
+            const point rel_pos = point( x, y ) - sm_center;
 
-        if( std::abs( rel_pos.x ) > sm_offset.x + 1 ||
-            std::abs( rel_pos.y ) > sm_offset.y + 1 ||
-            rel_pos.z != 0 ) {
-            continue;
-        }
+            if( std::abs( rel_pos.x ) > sm_offset.x + 1 ||
+                std::abs( rel_pos.y ) > sm_offset.y + 1 ) {
+                continue;
+            }
 
-        const tripoint sm_pos = rel_pos + sm_offset;
-        const tripoint ms_pos = sm_to_ms_copy( sm_pos ) + ms_offset;
+            const point sm_pos = rel_pos + sm_offset.xy();
+            const point ms_pos = sm_to_ms_copy( sm_pos ) + ms_offset;
 
-        const SDL_Rect chunk_rect = projector->get_chunk_rect( ms_pos.xy(), { SEEX, SEEY } );
+            const SDL_Rect chunk_rect = projector->get_chunk_rect( ms_pos, { SEEX, SEEY } );
 
-        RenderCopy( renderer, elem.second.chunk_tex, nullptr, &chunk_rect );
+            RenderCopy( renderer, entry->chunk_tex, nullptr, &chunk_rect );
+        }
     }
 }
 
@@ -2,8 +2,8 @@
 #ifndef CATA_SRC_PIXEL_MINIMAP_H
 #define CATA_SRC_PIXEL_MINIMAP_H
 
-#include <map>
 #include <memory>
+#include <vector>
 
 #include "point.h"
 #include "sdl_wrappers.h"
@@ -45,7 +45,7 @@ class pixel_minimap
     private:
         struct submap_cache;
 
-        submap_cache &get_cache_at( const tripoint &abs_sm_pos );
+        submap_cache &get_cache_at( const point &sm_pos );
 
         void set_screen_rect( const SDL_Rect &screen_rect );
         void reset();
@@ -57,7 +57,7 @@ class pixel_minimap
         void flush_cache_updates();
         void update_cache_at( const tripoint &pos );
         void prepare_cache_for_updates( const tripoint &center );
-        void clear_unused_cache();
+        void clear_cache();
 
         void render( const tripoint &center );
         void render_cache( const tripoint &center );
@@ -73,8 +73,8 @@ class pixel_minimap
 
         point pixel_size;
 
-        //track the previous viewing area to determine if the minimap cache needs to be cleared
-        tripoint cached_center_sm;
+        //absolute position of the first submap of the reality bubble the cache was filled for
+        tripoint cached_origin_sm;
 
         SDL_Rect screen_rect;
         SDL_Rect main_tex_clip_rect;
@@ -88,7 +88,8 @@ class pixel_minimap
         class shared_texture_pool;
         std::unique_ptr<shared_texture_pool> tex_pool;
 
-        std::map<tripoint, submap_cache> cache;
+        //indexed by the position of the submap in the reality bubble, see cached_origin_sm
+        std::vector<std::unique_ptr<submap_cache>> cache;
 };
 
 #endif // CATA_SRC_PIXEL_MINIMAP_H
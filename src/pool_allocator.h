@@ -0,0 +1,101 @@
+#pragma once
+#ifndef CATA_SRC_POOL_ALLOCATOR_H
+#define CATA_SRC_POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace cata
+{
+
+/**
+ * Stateless allocator for node based containers such as std::list.
+ *
+ * Single-object allocations (one node) are carved out of chunks of several nodes, so
+ * nodes allocated together end up next to each other in memory instead of scattered
+ * across the heap. Freed nodes go on a per-thread free list and are reused by the next
+ * allocation on that thread; chunks are never returned to the system.
+ * Allocations of more than one object go straight to operator new.
+ */
+template<typename T>
+class pool_allocator
+{
+    public:
+        using value_type = T;
+
+        pool_allocator() noexcept = default;
+        template<typename U>
+        explicit pool_allocator( const pool_allocator<U> & ) noexcept {}
+
+        T *allocate( std::size_t n ) {
+            if( n != 1 ) {
+                return static_cast<T *>( ::operator new( n * sizeof( T ) ) );
+            }
+            slot *&free_list = get_free_list();
+            if( free_list == nullptr ) {
+                free_list = allocate_chunk();
+            }
+            slot *const s = free_list;
+            free_list = s->next;
+            return reinterpret_cast<T *>( s->storage );
+        }
+
+        void deallocate( T *p, std::size_t n ) noexcept {
+            if( n != 1 ) {
+                ::operator delete( p );
+                return;
+            }
+            slot *&free_list = get_free_list();
+            slot *const s = reinterpret_cast<slot *>( p );
+            s->next = free_list;
+            free_list = s;
+        }
+
+    private:
+        static constexpr std::size_t chunk_size = 32;
+
+        union slot {
+            slot *next;
+            alignas( T ) unsigned char storage[sizeof( T )];
+        };
+
+        // trivially destructible, so nodes may still be freed during static destruction
+        static slot *&get_free_list() {
+            static thread_local slot *free_list = nullptr;
+            return free_list;
+        }
+
+        static slot *allocate_chunk() {
+            // chunks stay reachable (and alive) until the program ends
+            static std::mutex chunks_mutex;
+            static auto *chunks = new std::vector<std::unique_ptr<slot[]>>();
+            std::unique_ptr<slot[]> chunk( new slot[chunk_size] );
+            for( std::size_t i = 0; i + 1 < chunk_size; ++i ) {
+                chunk[i].next = &chunk[i + 1];
+            }
+            chunk[chunk_size - 1].next = nullptr;
+            slot *const first = chunk.get();
+            std::lock_guard<std::mutex> lock( chunks_mutex );
+            chunks->emplace_back( std::move( chunk ) );
+            return first;
+        }
+};
+
+template<typename T, typename U>
+bool operator==( const pool_allocator<T> &, const pool_allocator<U> & ) noexcept
+{
+    return true;
+}
+
+template<typename T, typename U>
+bool operator!=( const pool_allocator<T> &, const pool_allocator<U> & ) noexcept
+{
+    return false;
+}
+
+} // namespace cata
+
+#endif // CATA_SRC_POOL_ALLOCATOR_H
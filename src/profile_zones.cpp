@@ -0,0 +1,225 @@
+#include "profile_zones.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "cata_utility.h"
+#include "debug.h"
+#include "json.h"
+#include "string_formatter.h"
+
+namespace profile_zones
+{
+
+namespace
+{
+
+using clock = std::chrono::steady_clock;
+
+constexpr size_t num_zones = static_cast<size_t>( zone::num_zones );
+// Turns of history kept for the report.
+constexpr size_t history_size = 600;
+// Stop recording trace events after this many, a trace is meant to cover a short stretch.
+constexpr size_t max_trace_events = 1000000;
+
+struct trace_event {
+    zone which;
+    std::int64_t start_us;
+    std::int64_t duration_us;
+};
+
+struct zone_history {
+    // Nanoseconds spent in the zone during the current turn.
+    std::int64_t this_turn = 0;
+    bool ran_this_turn = false;
+    // Ring buffer of per-turn totals, in nanoseconds.
+    std::vector<std::int64_t> turns;
+    size_t next = 0;
+};
+
+struct profiler_state {
+    bool enabled = false;
+    bool tracing = false;
+    std::array<zone_history, num_zones> zones;
+    clock::time_point trace_epoch;
+    std::vector<trace_event> trace;
+};
+
+profiler_state &get_state()
+{
+    static profiler_state state;
+    return state;
+}
+
+} // namespace
+
+std::string zone_name( zone z )
+{
+    switch( z ) {
+        // *INDENT-OFF*
+        case zone::monmove: return "monmove";
+        case zone::process_fields: return "map::process_fields";
+        case zone::process_items: return "map::process_items";
+        case zone::build_map_cache: return "map::build_map_cache";
+        case zone::generate_lightmap: return "map::generate_lightmap";
+        case zone::scent_update: return "scent_map::update";
+        case zone::vehmove: return "map::vehmove";
+        case zone::draw_tiles: return "cata_tiles::draw";
+        // *INDENT-ON*
+        case zone::num_zones:
+            break;
+    }
+    cata_fatal( "Invalid profile_zones::zone" );
+}
+
+bool enabled()
+{
+    return get_state().enabled;
+}
+
+void set_enabled( bool enable )
+{
+    profiler_state &state = get_state();
+    if( state.enabled == enable ) {
+        return;
+    }
+    state.enabled = enable;
+    if( !enable ) {
+        state.tracing = false;
+    }
+    for( zone_history &h : state.zones ) {
+        h.this_turn = 0;
+        h.ran_this_turn = false;
+    }
+}
+
+bool tracing()
+{
+    return get_state().tracing;
+}
+
+void set_tracing( bool enable )
+{
+    profiler_state &state = get_state();
+    if( enable && !state.tracing ) {
+        state.trace.clear();
+        state.trace_epoch = clock::now();
+        set_enabled( true );
+    }
+    state.tracing = enable;
+}
+
+void end_turn()
+{
+    profiler_state &state = get_state();
+    if( !state.enabled ) {
+        return;
+    }
+    for( zone_history &h : state.zones ) {
+        if( !h.ran_this_turn ) {
+            continue;
+        }
+        if( h.turns.size() < history_size ) {
+            h.turns.push_back( h.this_turn );
+        } else {
+            h.turns[h.next] = h.this_turn;
+        }
+        h.next = ( h.next + 1 ) % history_size;
+        h.this_turn = 0;
+        h.ran_this_turn = false;
+    }
+}
+
+void reset()
+{
+    profiler_state &state = get_state();
+    for( zone_history &h : state.zones ) {
+        h = zone_history();
+    }
+    state.trace.clear();
+    state.trace_epoch = clock::now();
+}
+
+zone_stats get_stats( zone z )
+{
+    const zone_history &h = get_state().zones[static_cast<size_t>( z )];
+    zone_stats ret;
+    if( h.turns.empty() ) {
+        return ret;
+    }
+    std::vector<std::int64_t> sorted = h.turns;
+    std::sort( sorted.begin(), sorted.end() );
+    std::int64_t total = 0;
+    for( const std::int64_t t : sorted ) {
+        total += t;
+    }
+    constexpr double ns_per_ms = 1e6;
+    ret.turns = sorted.size();
+    ret.min_ms = sorted.front() / ns_per_ms;
+    ret.avg_ms = total / ns_per_ms / sorted.size();
+    ret.p99_ms = sorted[( sorted.size() - 1 ) * 99 / 100] / ns_per_ms;
+    return ret;
+}
+
+std::string report()
+{
+    std::string ret = string_format( "%-24s %6s %9s %9s %9s\n", "zone", "turns", "min ms", "avg ms",
+                                     "p99 ms" );
+    for( size_t i = 0; i < num_zones; ++i ) {
+        const zone z = static_cast<zone>( i );
+        const zone_stats stats = get_stats( z );
+        ret += string_format( "%-24s %6d %9.3f %9.3f %9.3f\n", zone_name( z ), stats.turns,
+                              stats.min_ms, stats.avg_ms, stats.p99_ms );
+    }
+    return ret;
+}
+
+bool write_trace( const cata_path &path )
+{
+    const std::vector<trace_event> &events = get_state().trace;
+    return write_to_file( path, [&events]( std::ostream & fout ) {
+        JsonOut jsout( fout );
+        jsout.start_object();
+        jsout.member( "displayTimeUnit", "ms" );
+        jsout.member( "traceEvents" );
+        jsout.start_array();
+        for( const trace_event &e : events ) {
+            jsout.start_object();
+            jsout.member( "name", zone_name( e.which ) );
+            jsout.member( "ph", "X" );
+            jsout.member( "ts", e.start_us );
+            jsout.member( "dur", e.duration_us );
+            jsout.member( "pid", 1 );
+            jsout.member( "tid", 1 );
+            jsout.end_object();
+        }
+        jsout.end_array();
+        jsout.end_object();
+    }, "profiling trace" );
+}
+
+void scoped_zone::finish()
+{
+    const clock::time_point end = clock::now();
+    profiler_state &state = get_state();
+    // Profiling may have been switched off while inside the zone.
+    if( !state.enabled ) {
+        return;
+    }
+    zone_history &h = state.zones[static_cast<size_t>( which )];
+    h.this_turn += std::chrono::duration_cast<std::chrono::nanoseconds>( end - start ).count();
+    h.ran_this_turn = true;
+    if( state.tracing && state.trace.size() < max_trace_events ) {
+        using std::chrono::microseconds;
+        state.trace.push_back( {
+            which,
+            std::chrono::duration_cast<microseconds>( start - state.trace_epoch ).count(),
+            std::chrono::duration_cast<microseconds>( end - start ).count()
+        } );
+    }
+}
+
+} // namespace profile_zones
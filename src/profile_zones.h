@@ -0,0 +1,99 @@
+#pragma once
+#ifndef CATA_SRC_PROFILE_ZONES_H
+#define CATA_SRC_PROFILE_ZONES_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+class cata_path;
+
+/**
+ * Lightweight timing of the hot parts of a game turn.
+ *
+ * A zone is a code region wrapped in `CATA_PROFILE_ZONE( profile_zones::zone::... )`.
+ * While profiling is enabled (see the debug menu) the time spent in each zone is summed
+ * per turn and the last few hundred turns are kept for a min/avg/p99 report. Individual
+ * zone entries can additionally be recorded and dumped as a Chrome trace-event file
+ * (load it in chrome://tracing or https://ui.perfetto.dev).
+ *
+ * Zones are only meant for the main thread. In release builds the macro expands to
+ * nothing unless the build defines CATA_PROFILE_ZONES (PROFILE_ZONES=1).
+ */
+namespace profile_zones
+{
+
+enum class zone : int {
+    monmove,
+    process_fields,
+    process_items,
+    build_map_cache,
+    generate_lightmap,
+    scent_update,
+    vehmove,
+    draw_tiles,
+    num_zones
+};
+
+struct zone_stats {
+    /** Number of turns the zone ran in, out of the kept history. */
+    size_t turns = 0;
+    double min_ms = 0.0;
+    double avg_ms = 0.0;
+    double p99_ms = 0.0;
+};
+
+std::string zone_name( zone z );
+
+bool enabled();
+void set_enabled( bool enable );
+bool tracing();
+/** Starts or stops recording individual zone entries for @ref write_trace. */
+void set_tracing( bool enable );
+
+/** Closes the current turn: the per-zone totals are moved to the history. */
+void end_turn();
+/** Drops the history and any recorded trace events. */
+void reset();
+
+zone_stats get_stats( zone z );
+/** Multi-line table of @ref get_stats for every zone. */
+std::string report();
+/** Writes recorded trace events in Chrome trace-event JSON format. */
+bool write_trace( const cata_path &path );
+
+class scoped_zone
+{
+    public:
+        explicit scoped_zone( zone z ) : which( z ), active( enabled() ) {
+            if( active ) {
+                start = std::chrono::steady_clock::now();
+            }
+        }
+        ~scoped_zone() {
+            if( active ) {
+                finish();
+            }
+        }
+        scoped_zone( const scoped_zone & ) = delete;
+        scoped_zone &operator=( const scoped_zone & ) = delete;
+    private:
+        void finish();
+
+        zone which;
+        bool active;
+        std::chrono::steady_clock::time_point start;
+};
+
+} // namespace profile_zones
+
+#if !defined(RELEASE) || defined(CATA_PROFILE_ZONES)
+#define CATA_PROFILE_ZONE_CAT2( a, b ) a##b
+#define CATA_PROFILE_ZONE_CAT( a, b ) CATA_PROFILE_ZONE_CAT2( a, b )
+#define CATA_PROFILE_ZONE( z ) \
+    profile_zones::scoped_zone CATA_PROFILE_ZONE_CAT( profile_zone_, __LINE__ )( z )
+#else
+#define CATA_PROFILE_ZONE( z )
+#endif
+
+#endif // CATA_SRC_PROFILE_ZONES_H
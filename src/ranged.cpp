@@ -164,6 +164,60 @@ static int time_to_attack( const Character &p, const itype &firing );
 static void cycle_action( item &weap, const itype_id &ammo, const tripoint &pos );
 static void make_gun_sound_effect( const Character &p, bool burst, item *weapon );
 
+struct confidence_rating {
+    double aim_level;
+    char symbol;
+    std::string color;
+    std::string label;
+};
+
+struct aim_type_prediction {
+    struct aim_confidence {
+        std::string label;
+        std::string color;
+        int chance;
+    };
+
+    std::string name;
+    std::string hotkey;
+    std::vector<confidence_rating> ratings; // this is read back in UI
+    std::vector<aim_confidence> chances;
+    bool is_default;
+    int moves;
+    int chance_to_hit; // all hit probabilities summed up for sorting
+    double confidence;
+    double steadiness;
+};
+
+// The hit chances last shown while aiming, see calculate_ranged_chances.
+// They are redrawn after every key press, but only change with what is listed here.
+struct hit_preview_cache {
+    struct inputs {
+        int mode = 0;
+        const item *weapon = nullptr;
+        tripoint pos;
+        time_point turn;
+        int moves = 0;
+        double recoil = 0.0;
+        int sight_dispersion = 0;
+        std::string aim_action;
+        int range = 0;
+        double size = 0.0;
+        float light = 0.0f;
+        bool visible = false;
+
+        bool operator==( const inputs &rhs ) const {
+            return mode == rhs.mode && weapon == rhs.weapon && pos == rhs.pos && turn == rhs.turn &&
+                   moves == rhs.moves && recoil == rhs.recoil &&
+                   sight_dispersion == rhs.sight_dispersion && aim_action == rhs.aim_action &&
+                   range == rhs.range && size == rhs.size && light == rhs.light &&
+                   visible == rhs.visible;
+        }
+    };
+    std::optional<inputs> last;
+    std::vector<aim_type_prediction> chances;
+};
+
 class target_ui
 {
     public:
@@ -276,6 +330,19 @@ class target_ui
         // List of vehicle turrets in range (out of those listed in 'vturrets')
         std::vector<turret_with_lof> turrets_in_range;
 
+        // Where each turret in 'vturrets' is and how far it reaches. The vehicle can't move
+        // while aiming, so this is only worked out once.
+        struct turret_reach {
+            vehicle_part *turret;
+            tripoint pos;
+            int range;
+        };
+        std::vector<turret_reach> turret_reaches;
+        bool turret_reaches_known = false;
+
+        // Hit chances shown for TargetMode::Fire and TargetMode::Throw
+        hit_preview_cache hit_preview;
+
         // If true, draws turret lines
         // relevant for TargetMode::Turrets
         bool draw_turret_lines = false;
@@ -1531,13 +1598,6 @@ static void do_aim( Character &you, const item &relevant, const double min_recoi
     }
 }
 
-struct confidence_rating {
-    double aim_level;
-    char symbol;
-    std::string color;
-    std::string label;
-};
-
 static int print_steadiness( const catacurses::window &w, int line_number, double steadiness )
 {
     const int window_width = getmaxx( w ) - 2; // Window width minus borders.
@@ -1621,24 +1681,6 @@ Target_attributes::Target_attributes( int rng, double target_size, float light_t
 * struct used to hold the information on entire aim_type prediction;
 * all the properties and odds for every 'confidence' outcome
 */
-struct aim_type_prediction {
-    struct aim_confidence {
-        std::string label;
-        std::string color;
-        int chance;
-    };
-
-    std::string name;
-    std::string hotkey;
-    std::vector<confidence_rating> ratings; // this is read back in UI
-    std::vector<aim_confidence> chances;
-    bool is_default;
-    int moves;
-    int chance_to_hit; // all hit probabilities summed up for sorting
-    double confidence;
-    double steadiness;
-};
-
 // struct used for returning values from predict_recoil()
 // recoil is the either the sight dispersion or the aim mode's threshold
 // moves it the amount of moves it'll take to reach that aim state
@@ -1684,14 +1726,33 @@ static recoil_prediction predict_recoil( const Character &you, const item &weapo
 * Inside each prediction there is a vector of "confidences";
 * they represent the great/hit/graze/miss chances.
 */
-static std::vector<aim_type_prediction> calculate_ranged_chances(
+static const std::vector<aim_type_prediction> &calculate_ranged_chances(
     const target_ui &ui, const Character &you,
     target_ui::TargetMode mode, const input_context &ctxt, const item &weapon,
     const dispersion_sources &dispersion, const std::vector<confidence_rating> &confidence_ratings,
-    const Target_attributes &target, const tripoint &pos )
+    const Target_attributes &target, const tripoint &pos, hit_preview_cache &cache )
 {
+    hit_preview_cache::inputs inputs;
+    inputs.mode = static_cast<int>( mode );
+    inputs.weapon = &weapon;
+    inputs.pos = pos;
+    inputs.turn = calendar::turn;
+    inputs.moves = you.get_moves();
+    inputs.recoil = you.recoil;
+    inputs.sight_dispersion = ui.get_sight_dispersion();
+    inputs.aim_action = ui.get_selected_aim_type().action;
+    inputs.range = target.range;
+    inputs.size = target.size;
+    inputs.light = target.light;
+    inputs.visible = target.visible;
+    if( cache.last == inputs ) {
+        return cache.chances;
+    }
+    cache.last = inputs;
+
     std::vector<aim_type> aim_types { get_default_aim_type() };
-    std::vector<aim_type_prediction> aim_outputs;
+    std::vector<aim_type_prediction> &aim_outputs = cache.chances;
+    aim_outputs.clear();
 
     if( mode != target_ui::TargetMode::Throw && mode != target_ui::TargetMode::ThrowBlind ) {
         aim_types = you.get_aim_types( weapon );
@@ -1934,7 +1995,8 @@ static bool pl_sees( const Creature &cr )
 }
 
 static int print_aim( const target_ui &ui, Character &you, const catacurses::window &w,
-                      int line_number, input_context &ctxt, const item &weapon, const tripoint &pos )
+                      int line_number, input_context &ctxt, const item &weapon, const tripoint &pos,
+                      hit_preview_cache &cache )
 {
     // This is absolute accuracy for the player.
     // TODO: push the calculations duplicated from Creature::deal_projectile_attack() and
@@ -1952,16 +2014,16 @@ static int print_aim( const target_ui &ui, Character &you, const catacurses::win
         }
     };
 
-    const std::vector<aim_type_prediction> aim_chances = calculate_ranged_chances( ui, you,
+    const std::vector<aim_type_prediction> &aim_chances = calculate_ranged_chances( ui, you,
             target_ui::TargetMode::Fire, ctxt, weapon, dispersion, confidence_config,
-            Target_attributes( you.pos(), pos ), pos );
+            Target_attributes( you.pos(), pos ), pos, cache );
 
     return print_ranged_chance( w, line_number, aim_chances );
 }
 
 static void draw_throw_aim( const target_ui &ui, const Character &you, const catacurses::window &w,
                             int &text_y, input_context &ctxt, const item &weapon, const tripoint &target_pos,
-                            bool is_blind_throw )
+                            bool is_blind_throw, hit_preview_cache &cache )
 {
     Creature *target = get_creature_tracker().creature_at( target_pos, true );
     if( target != nullptr && !you.sees( *target ) ) {
@@ -1992,8 +2054,9 @@ static void draw_throw_aim( const target_ui &ui, const Character &you, const cat
     Target_attributes attributes( range, target_size, get_map().ambient_light_at( target_pos ),
                                   you.sees( target_pos ) );
 
-    const std::vector<aim_type_prediction> aim_chances = calculate_ranged_chances( ui, you,
-            throwing_target_mode, ctxt, weapon, dispersion, confidence_config, attributes, target_pos );
+    const std::vector<aim_type_prediction> &aim_chances = calculate_ranged_chances( ui, you,
+            throwing_target_mode, ctxt, weapon, dispersion, confidence_config, attributes,
+            target_pos, cache );
 
     text_y = print_ranged_chance( w, text_y, aim_chances );
 }
@@ -3233,12 +3296,18 @@ void target_ui::set_view_offset( const tripoint &new_offset ) const
 
 void target_ui::update_turrets_in_range()
 {
+    if( !turret_reaches_known ) {
+        turret_reaches.clear();
+        for( vehicle_part *t : *vturrets ) {
+            turret_reaches.push_back( { t, veh->global_part_pos3( *t ),
+                                        veh->turret_query( *t ).range() } );
+        }
+        turret_reaches_known = true;
+    }
     turrets_in_range.clear();
-    for( vehicle_part *t : *vturrets ) {
-        turret_data td = veh->turret_query( *t );
-        if( td.in_range( dst ) ) {
-            tripoint src = veh->global_part_pos3( *t );
-            turrets_in_range.push_back( {t, line_to( src, dst )} );
+    for( const turret_reach &t : turret_reaches ) {
+        if( rl_dist( t.pos, dst ) <= t.range ) {
+            turrets_in_range.push_back( {t.turret, line_to( t.pos, dst )} );
         }
     }
 }
@@ -3577,10 +3646,12 @@ void target_ui::draw_ui_window()
     } else if( status == Status::Good ) {
         // TODO: these are old, consider refactoring
         if( mode == TargetMode::Fire ) {
-            text_y = print_aim( *this, *you, w_target, text_y, ctxt, *relevant->gun_current_mode(), dst );
+            text_y = print_aim( *this, *you, w_target, text_y, ctxt,
+                                *relevant->gun_current_mode(), dst, hit_preview );
         } else if( mode == TargetMode::Throw || mode == TargetMode::ThrowBlind ) {
             bool blind = mode == TargetMode::ThrowBlind;
-            draw_throw_aim( *this, *you, w_target, text_y, ctxt, *relevant, dst, blind );
+            draw_throw_aim( *this, *you, w_target, text_y, ctxt, *relevant, dst, blind,
+                            hit_preview );
         }
     }
 
@@ -1,6 +1,7 @@
 #include "recipe_dictionary.h"
 
 #include <algorithm>
+#include <climits>
 #include <iterator>
 #include <memory>
 #include <unordered_map>
@@ -85,29 +86,6 @@ const recipe &recipe_dictionary::get_craft( const itype_id &id )
     return iter != recipe_dict.recipes.end() ? iter->second : null_recipe;
 }
 
-// searches for left-anchored partial match in the relevant recipe requirements set
-template <class group>
-bool search_reqs( const group &gp, const std::string_view txt )
-{
-    return std::any_of( gp.begin(), gp.end(), [&]( const typename group::value_type & opts ) {
-        return std::any_of( opts.begin(),
-        opts.end(), [&]( const typename group::value_type::value_type & e ) {
-            return lcmatch( e.to_string(), txt );
-        } );
-    } );
-}
-// template specialization to make component searches easier
-template<>
-bool search_reqs( const std::vector<std::vector<item_comp> > &gp,
-                  const std::string_view txt )
-{
-    return std::any_of( gp.begin(), gp.end(), [&]( const std::vector<item_comp> &opts ) {
-        return std::any_of( opts.begin(), opts.end(), [&]( const item_comp & ic ) {
-            return lcmatch( item::nname( ic.type ), txt );
-        } );
-    } );
-}
-
 std::vector<const recipe *> recipe_subset::favorite() const
 {
     std::vector<const recipe *> res;
@@ -169,6 +147,16 @@ std::vector<const recipe *> recipe_subset::search(
     const std::string_view txt, const search_type key,
     const std::function<void( size_t, size_t )> &progress_callback ) const
 {
+    // Requirement searches go through the reverse indices of the dictionary
+    std::unordered_set<const recipe *> requirement_matches;
+    if( key == search_type::component ) {
+        requirement_matches = recipe_dict.with_component_matching( txt );
+    } else if( key == search_type::tool ) {
+        requirement_matches = recipe_dict.with_tool_matching( txt );
+    } else if( key == search_type::quality ) {
+        requirement_matches = recipe_dict.with_quality_matching( txt );
+    }
+
     auto predicate = [&]( const recipe * r ) {
         if( !*r || r->obsolete ) {
             return false;
@@ -194,13 +182,9 @@ std::vector<const recipe *> recipe_subset::search(
                 return lcmatch( r->skill_used->name(), txt );
 
             case search_type::component:
-                return search_reqs( r->simple_requirements().get_components(), txt );
-
             case search_type::tool:
-                return search_reqs( r->simple_requirements().get_tools(), txt );
-
             case search_type::quality:
-                return search_reqs( r->simple_requirements().get_qualities(), txt );
+                return requirement_matches.count( r ) > 0;
 
             case search_type::quality_result: {
                 return item::find_type( r->result() )->has_any_quality( txt );
@@ -640,6 +624,98 @@ void recipe_dictionary::finalize()
     }
 
     recipe_dict.find_items_on_loops();
+    recipe_dict.build_requirement_indices();
+}
+
+void recipe_dictionary::build_requirement_indices()
+{
+    component_users.clear();
+    tool_users.clear();
+    quality_users.clear();
+    for( const auto &e : recipes ) {
+        const recipe *r = &e.second;
+        const requirement_data &reqs = r->simple_requirements();
+        for( const std::vector<item_comp> &opts : reqs.get_components() ) {
+            for( const item_comp &comp : opts ) {
+                component_users[comp.type].insert( r );
+            }
+        }
+        for( const std::vector<tool_comp> &opts : reqs.get_tools() ) {
+            for( const tool_comp &tool : opts ) {
+                tool_users[std::make_pair( tool.type, tool.count )].insert( r );
+            }
+        }
+        for( const std::vector<quality_requirement> &opts : reqs.get_qualities() ) {
+            for( const quality_requirement &qual : opts ) {
+                quality_users[std::make_tuple( qual.type, qual.count, qual.level )].insert( r );
+            }
+        }
+    }
+}
+
+const std::set<const recipe *> &recipe_dictionary::of_component( const itype_id &id ) const
+{
+    static const std::set<const recipe *> none;
+    const auto iter = component_users.find( id );
+    return iter != component_users.end() ? iter->second : none;
+}
+
+std::set<const recipe *> recipe_dictionary::of_tool( const itype_id &id ) const
+{
+    std::set<const recipe *> res;
+    for( auto iter = tool_users.lower_bound( std::make_pair( id, INT_MIN ) );
+         iter != tool_users.end() && iter->first.first == id; ++iter ) {
+        res.insert( iter->second.begin(), iter->second.end() );
+    }
+    return res;
+}
+
+std::set<const recipe *> recipe_dictionary::of_quality( const quality_id &id ) const
+{
+    std::set<const recipe *> res;
+    for( auto iter = quality_users.lower_bound( std::make_tuple( id, INT_MIN, INT_MIN ) );
+         iter != quality_users.end() && std::get<0>( iter->first ) == id; ++iter ) {
+        res.insert( iter->second.begin(), iter->second.end() );
+    }
+    return res;
+}
+
+std::unordered_set<const recipe *> recipe_dictionary::with_component_matching(
+    const std::string_view txt ) const
+{
+    std::unordered_set<const recipe *> res;
+    for( const auto &e : component_users ) {
+        if( lcmatch( item::nname( e.first ), txt ) ) {
+            res.insert( e.second.begin(), e.second.end() );
+        }
+    }
+    return res;
+}
+
+std::unordered_set<const recipe *> recipe_dictionary::with_tool_matching(
+    const std::string_view txt ) const
+{
+    std::unordered_set<const recipe *> res;
+    for( const auto &e : tool_users ) {
+        if( lcmatch( tool_comp( e.first.first, e.first.second ).to_string(), txt ) ) {
+            res.insert( e.second.begin(), e.second.end() );
+        }
+    }
+    return res;
+}
+
+std::unordered_set<const recipe *> recipe_dictionary::with_quality_matching(
+    const std::string_view txt ) const
+{
+    std::unordered_set<const recipe *> res;
+    for( const auto &e : quality_users ) {
+        quality_requirement qual;
+        std::tie( qual.type, qual.count, qual.level ) = e.first;
+        if( lcmatch( qual.to_string(), txt ) ) {
+            res.insert( e.second.begin(), e.second.end() );
+        }
+    }
+    return res;
 }
 
 void recipe_dictionary::check_consistency()
@@ -690,6 +766,9 @@ void recipe_dictionary::reset()
     recipe_dict.recipes.clear();
     recipe_dict.uncraft.clear();
     recipe_dict.items_on_loops.clear();
+    recipe_dict.component_users.clear();
+    recipe_dict.tool_users.clear();
+    recipe_dict.quality_users.clear();
 }
 
 void recipe_dictionary::delete_if( const std::function<bool( const recipe & )> &pred )
@@ -9,7 +9,10 @@
 #include <map>
 #include <set>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "recipe.h"
@@ -46,6 +49,20 @@ class recipe_dictionary
         std::map<recipe_id, recipe>::const_iterator begin() const;
         std::map<recipe_id, recipe>::const_iterator end() const;
 
+        /** Recipes using @p id as a component, as a tool or needing quality @p id. */
+        const std::set<const recipe *> &of_component( const itype_id &id ) const;
+        std::set<const recipe *> of_tool( const itype_id &id ) const;
+        std::set<const recipe *> of_quality( const quality_id &id ) const;
+
+        /**
+         * Recipes with a component, tool or quality requirement whose description matches
+         * @p txt (see @ref lcmatch). Each distinct requirement is described and matched once
+         * instead of once per recipe listing it.
+         */
+        std::unordered_set<const recipe *> with_component_matching( std::string_view txt ) const;
+        std::unordered_set<const recipe *> with_tool_matching( std::string_view txt ) const;
+        std::unordered_set<const recipe *> with_quality_matching( std::string_view txt ) const;
+
         bool is_item_on_loop( const itype_id & ) const;
 
         /** Returns disassembly recipe (or null recipe if no match) */
@@ -81,8 +98,16 @@ class recipe_dictionary
         std::map<const itype_id, const recipe *> obsoletes;
         std::unordered_set<itype_id> items_on_loops;
 
+        // Reverse indices of the requirements of crafting recipes, built by finalize().
+        // Tools are keyed with their charges and qualities with count and level, as both
+        // are part of the description searches match against.
+        std::map<itype_id, std::set<const recipe *>> component_users;
+        std::map<std::pair<itype_id, int>, std::set<const recipe *>> tool_users;
+        std::map<std::tuple<quality_id, int, int>, std::set<const recipe *>> quality_users;
+
         static void finalize_internal( std::map<recipe_id, recipe> &obj );
         void find_items_on_loops();
+        void build_requirement_indices();
 };
 
 extern recipe_dictionary recipe_dict;
@@ -3,11 +3,36 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstdint>
 
 #include "calendar.h"
 #include "cata_utility.h"
+#include "point.h"
 #include "units.h"
 
+// An engine and the distributions that keep state between calls, so numbers cached while
+// drawing from one stream don't turn up in another.
+struct rng_context {
+    cata_default_random_engine engine;
+    std::normal_distribution<double> normal;
+    std::chi_squared_distribution<double> chi_squared;
+};
+
+// Innermost rng_stream_scope of this thread
+static thread_local rng_context *current_context = nullptr;
+
+static rng_context &global_context()
+{
+    // NOLINTNEXTLINE(cata-determinism)
+    static rng_context context{ cata_default_random_engine( rng_get_first_seed() ), {}, {} };
+    return context;
+}
+
+static rng_context &get_context()
+{
+    return current_context != nullptr ? *current_context : global_context();
+}
+
 unsigned int rng_bits()
 {
     // Whole uint range.
@@ -77,8 +102,8 @@ float normal_roll_chance( float center, float stddev, float difficulty )
 
 double normal_roll( double mean, double stddev )
 {
-    static std::normal_distribution<double> rng_normal_dist;
-    return rng_normal_dist( rng_get_engine(), std::normal_distribution<>::param_type( mean, stddev ) );
+    rng_context &context = get_context();
+    return context.normal( context.engine, std::normal_distribution<>::param_type( mean, stddev ) );
 }
 
 double exponential_roll( double lambda )
@@ -90,9 +115,9 @@ double exponential_roll( double lambda )
 
 double chi_squared_roll( double trial_num )
 {
-    static std::chi_squared_distribution<double> rng_chi_squared_dist;
-    return rng_chi_squared_dist( rng_get_engine(),
-                                 std::chi_squared_distribution<>::param_type( trial_num ) );
+    rng_context &context = get_context();
+    return context.chi_squared( context.engine,
+                                std::chi_squared_distribution<>::param_type( trial_num ) );
 }
 
 double rng_exponential( double min, double mean )
@@ -198,9 +223,44 @@ cata_default_random_engine::result_type rng_get_first_seed()
 
 cata_default_random_engine &rng_get_engine()
 {
-    // NOLINTNEXTLINE(cata-determinism)
-    static cata_default_random_engine eng( rng_get_first_seed() );
-    return eng;
+    return get_context().engine;
+}
+
+// splitmix64 finalizer, so keys differing in one bit give unrelated seeds
+static std::uint64_t mix_seed( std::uint64_t h, std::uint64_t v )
+{
+    h += v + 0x9e3779b97f4a7c15ULL;
+    h = ( h ^ ( h >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+    h = ( h ^ ( h >> 27 ) ) * 0x94d049bb133111ebULL;
+    return h ^ ( h >> 31 );
+}
+
+unsigned int rng_stream_seed( unsigned int world_seed, std::string_view subsystem,
+                              const tripoint &p, const time_point &turn )
+{
+    // FNV-1a of the name
+    std::uint64_t name = 0xcbf29ce484222325ULL;
+    for( const char c : subsystem ) {
+        name = ( name ^ static_cast<unsigned char>( c ) ) * 0x100000001b3ULL;
+    }
+    std::uint64_t h = mix_seed( world_seed, name );
+    h = mix_seed( h, static_cast<std::uint32_t>( p.x ) );
+    h = mix_seed( h, static_cast<std::uint32_t>( p.y ) );
+    h = mix_seed( h, static_cast<std::uint32_t>( p.z ) );
+    h = mix_seed( h, static_cast<std::uint64_t>( to_turns<int>( turn - calendar::turn_zero ) ) );
+    return static_cast<unsigned int>( h ^ ( h >> 32 ) );
+}
+
+rng_stream_scope::rng_stream_scope( unsigned int seed )
+    : context( std::make_unique<rng_context>() ), previous( current_context )
+{
+    context->engine.seed( seed );
+    current_context = context.get();
+}
+
+rng_stream_scope::~rng_stream_scope()
+{
+    current_context = previous;
 }
 
 void rng_set_engine_seed( unsigned int seed )
@@ -6,14 +6,17 @@
 #include <cstddef>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <optional>
 #include <random>
+#include <string_view>
 #include <type_traits>
 
 #include "units_fwd.h"
 
 class map;
 class time_duration;
+class time_point;
 struct tripoint;
 template<typename Tripoint>
 class tripoint_range;
@@ -26,7 +29,37 @@ void rng_set_engine_seed( unsigned int seed );
 
 using cata_default_random_engine = std::minstd_rand0;
 cata_default_random_engine::result_type rng_get_first_seed();
+/** The engine of the innermost @ref rng_stream_scope on this thread, or the global one. */
 cata_default_random_engine &rng_get_engine();
+
+/**
+ * Seed of the random stream for one piece of work, e.g. generating one overmap tile.
+ * The same key always gives the same seed, and different keys give unrelated ones, so
+ * the work gets the same rolls no matter when, in which order or on which thread it runs.
+ * @param world_seed usually game::get_seed()
+ * @param subsystem name of the calling subsystem, e.g. "mapgen"
+ */
+unsigned int rng_stream_seed( unsigned int world_seed, std::string_view subsystem,
+                              const tripoint &p, const time_point &turn );
+
+struct rng_context;
+
+/**
+ * While alive, every rng function called on this thread draws from a private engine
+ * seeded with @p seed instead of the global engine, and the global sequence is left
+ * alone. Scopes nest. Code that doesn't create one is unaffected.
+ */
+class rng_stream_scope
+{
+    public:
+        explicit rng_stream_scope( unsigned int seed );
+        ~rng_stream_scope();
+        rng_stream_scope( const rng_stream_scope & ) = delete;
+        rng_stream_scope &operator=( const rng_stream_scope & ) = delete;
+    private:
+        std::unique_ptr<rng_context> context;
+        rng_context *previous;
+};
 unsigned int rng_bits();
 
 int rng( int lo, int hi );
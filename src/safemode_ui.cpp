@@ -647,6 +647,7 @@ bool safemode::empty() const
 
 void safemode::create_rules()
 {
+    ++rules_version_;
     safemode_rules_hostile.clear();
     for( auto &rules_sound : safemode_rules_sound ) {
         rules_sound.clear();
@@ -767,6 +768,7 @@ bool safemode::is_sound_safe( const std::string &sound_name_in,
 void safemode::clear_character_rules()
 {
     character_rules.clear();
+    ++rules_version_;
 }
 
 bool safemode::save_character()
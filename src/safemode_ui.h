@@ -91,6 +91,7 @@ class safemode
         bool save( bool is_character_in );
 
         bool is_character = false;
+        unsigned int rules_version_ = 0; // NOLINT(cata-serialize)
 
         void create_rules();
         void add_rules( const std::vector<rules_class> &rules_in );
@@ -121,6 +122,10 @@ class safemode
         void load_global();
 
         bool empty() const;
+        /** Changes whenever the rules that @ref check_monster and @ref empty go by change. */
+        unsigned int rules_version() const {
+            return rules_version_;
+        }
 
         void serialize( JsonOut &json ) const;
         void deserialize( const JsonArray &ja );
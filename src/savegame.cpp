@@ -89,7 +89,7 @@ void game::serialize( std::ostream &fout )
     // Header
     fout << "# version " << savegame_version << std::endl;
 
-    JsonOut json( fout, true ); // pretty-print
+    BufferedJsonOut json( fout, true ); // pretty-print
 
     json.start_object();
     // basic game state information.
@@ -135,16 +135,14 @@ void game::serialize( std::ostream &fout )
                  inactive_global_effect_on_condition_vector );
 
     //save queued effect_on_conditions
-    queued_eocs temp_queued( queued_global_effect_on_conditions );
     json.member( "queued_global_effect_on_conditions" );
     json.start_array();
-    while( !temp_queued.empty() ) {
+    for( const queued_eoc &queued : queued_global_effect_on_conditions.list ) {
         json.start_object();
-        json.member( "time", temp_queued.top().time );
-        json.member( "eoc", temp_queued.top().eoc );
-        json.member( "context", temp_queued.top().context );
+        json.member( "time", queued.time );
+        json.member( "eoc", queued.eoc );
+        json.member( "context", queued.context );
         json.end_object();
-        temp_queued.pop();
     }
     json.end_array();
     global_variables_instance.serialize( json );
@@ -414,44 +412,12 @@ void overmap::unserialize( const JsonObject &jsobj )
             mapgen_args_index.emplace( p.first, &*it );
         }
     }
-    // Extract layers first so predecessor deduplication can happen.
+    // The terrain layers are only decoded when they are first used, see overmap::load_terrain.
     if( jsobj.has_member( "layers" ) ) {
-        std::unordered_map<tripoint_om_omt, std::string> oter_id_migrations;
         JsonArray layers_json = jsobj.get_array( "layers" );
-
         for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
-            JsonArray layer_json = layers_json.next_array();
-            int count = 0;
-            std::string tmp_ter;
-            oter_id tmp_otid( 0 );
-            for( int j = 0; j < OMAPY; j++ ) {
-                for( int i = 0; i < OMAPX; i++ ) {
-                    if( count == 0 ) {
-                        {
-                            JsonArray rle_terrain = layer_json.next_array();
-                            tmp_ter = rle_terrain.next_string();
-                            count = rle_terrain.next_int();
-                            if( rle_terrain.has_more() ) {
-                                rle_terrain.throw_error( 2, "Unexpected value in RLE encoding" );
-                            }
-                        }
-                        if( is_oter_id_obsolete( tmp_ter ) ) {
-                            for( int p = i; p < i + count; p++ ) {
-                                oter_id_migrations.emplace( tripoint_om_omt( p, j, z - OVERMAP_DEPTH ), tmp_ter );
-                            }
-                        } else if( oter_str_id( tmp_ter ).is_valid() ) {
-                            tmp_otid = oter_id( tmp_ter );
-                        } else {
-                            debugmsg( "Loaded invalid oter_id '%s'", tmp_ter.c_str() );
-                            tmp_otid = oter_omt_obsolete;
-                        }
-                    }
-                    count--;
-                    layer[z].terrain[i][j] = tmp_otid;
-                }
-            }
+            pending_terrain[z] = std::make_shared<JsonArray>( layers_json.next_array() );
         }
-        migrate_oter_ids( oter_id_migrations );
     }
     for( JsonMember om_member : jsobj ) {
         const std::string name = om_member.name();
@@ -706,6 +672,7 @@ void overmap::unserialize( const JsonObject &jsobj )
                     for( size_t i = 1; i < serialized_predecessors.size(); ++i ) {
                         local_set_ter( serialized_predecessors[i] );
                     }
+                    load_terrain( p.z() );
                     local_set_ter( layer[p.z() + OVERMAP_DEPTH].terrain[p.xy()] );
                 }
                 predecessors_.insert_or_assign( p, std::move( om_predecessors ) );
@@ -718,6 +685,44 @@ void overmap::unserialize( const JsonObject &jsobj )
     }
 }
 
+void overmap::unserialize_terrain( const int z )
+{
+    const std::shared_ptr<JsonArray> layer_json = std::move( pending_terrain[z + OVERMAP_DEPTH] );
+    pending_terrain[z + OVERMAP_DEPTH] = nullptr;
+    std::unordered_map<tripoint_om_omt, std::string> oter_id_migrations;
+    cata::mdarray<oter_id, point_om_omt> &terrain = layer[z + OVERMAP_DEPTH].terrain;
+    int count = 0;
+    std::string tmp_ter;
+    oter_id tmp_otid( 0 );
+    for( int j = 0; j < OMAPY; j++ ) {
+        for( int i = 0; i < OMAPX; i++ ) {
+            if( count == 0 ) {
+                {
+                    JsonArray rle_terrain = layer_json->next_array();
+                    tmp_ter = rle_terrain.next_string();
+                    count = rle_terrain.next_int();
+                    if( rle_terrain.has_more() ) {
+                        rle_terrain.throw_error( 2, "Unexpected value in RLE encoding" );
+                    }
+                }
+                if( is_oter_id_obsolete( tmp_ter ) ) {
+                    for( int p = i; p < i + count; p++ ) {
+                        oter_id_migrations.emplace( tripoint_om_omt( p, j, z ), tmp_ter );
+                    }
+                } else if( oter_str_id( tmp_ter ).is_valid() ) {
+                    tmp_otid = oter_id( tmp_ter );
+                } else {
+                    debugmsg( "Loaded invalid oter_id '%s'", tmp_ter.c_str() );
+                    tmp_otid = oter_omt_obsolete;
+                }
+            }
+            count--;
+            terrain[i][j] = tmp_otid;
+        }
+    }
+    migrate_oter_ids( oter_id_migrations );
+}
+
 // throws std::exception
 void overmap::unserialize_omap( const JsonValue &jsin, const cata_path &json_path )
 {
@@ -998,7 +1003,7 @@ void overmap::serialize_view( std::ostream &fout ) const
 {
     fout << "# version " << savegame_version << std::endl;
 
-    JsonOut json( fout, false );
+    BufferedJsonOut json( fout, false );
     json.start_object();
 
     json.member( "visible" );
@@ -1007,7 +1012,7 @@ void overmap::serialize_view( std::ostream &fout ) const
         json.start_array();
         serialize_array_to_compacted_sequence( json, layer[z].visible );
         json.end_array();
-        fout << std::endl;
+        json.write_line_break();
     }
     json.end_array();
 
@@ -1017,7 +1022,7 @@ void overmap::serialize_view( std::ostream &fout ) const
         json.start_array();
         serialize_array_to_compacted_sequence( json, layer[z].explored );
         json.end_array();
-        fout << std::endl;
+        json.write_line_break();
     }
     json.end_array();
 
@@ -1033,7 +1038,7 @@ void overmap::serialize_view( std::ostream &fout ) const
             json.write( i.dangerous );
             json.write( i.danger_radius );
             json.end_array();
-            fout << std::endl;
+            json.write_line_break();
         }
         json.end_array();
     }
@@ -1049,7 +1054,7 @@ void overmap::serialize_view( std::ostream &fout ) const
             json.write( i.p.y() );
             json.write( i.id );
             json.end_array();
-            fout << std::endl;
+            json.write_line_break();
         }
         json.end_array();
     }
@@ -1121,12 +1126,13 @@ void overmap::serialize( std::ostream &fout ) const
 {
     fout << "# version " << savegame_version << std::endl;
 
-    JsonOut json( fout, false );
+    BufferedJsonOut json( fout, false );
     json.start_object();
 
     json.member( "layers" );
     json.start_array();
     for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
+        load_terrain( z - OVERMAP_DEPTH );
         const auto &layer_terrain = layer[z].terrain;
         int count = 0;
         oter_id last_tertype( -1 );
@@ -1155,16 +1161,16 @@ void overmap::serialize( std::ostream &fout ) const
         // End the z-level
         json.end_array();
         // Insert a newline occasionally so the file isn't totally unreadable.
-        fout << std::endl;
+        json.write_line_break();
     }
     json.end_array();
 
     // temporary, to allow user to manually switch regions during play until regionmap is done.
     json.member( "region_id", settings->id );
-    fout << std::endl;
+    json.write_line_break();
 
     save_monster_groups( json );
-    fout << std::endl;
+    json.write_line_break();
 
     json.member( "cities" );
     json.start_array();
@@ -1180,10 +1186,10 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << std::endl;
+    json.write_line_break();
 
     json.member( "connections_out", connections_out );
-    fout << std::endl;
+    json.write_line_break();
 
     json.member( "radios" );
     json.start_array();
@@ -1198,7 +1204,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << std::endl;
+    json.write_line_break();
 
     json.member( "monster_map" );
     json.start_array();
@@ -1207,7 +1213,7 @@ void overmap::serialize( std::ostream &fout ) const
         i.second.serialize( json );
     }
     json.end_array();
-    fout << std::endl;
+    json.write_line_break();
 
     json.member( "tracked_vehicles" );
     json.start_array();
@@ -1220,7 +1226,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << std::endl;
+    json.write_line_break();
 
     json.member( "scent_traces" );
     json.start_array();
@@ -1232,7 +1238,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << std::endl;
+    json.write_line_break();
 
     json.member( "npcs" );
     json.start_array();
@@ -1240,7 +1246,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.write( *i );
     }
     json.end_array();
-    fout << std::endl;
+    json.write_line_break();
 
     json.member( "camps" );
     json.start_array();
@@ -1248,7 +1254,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.write( i );
     }
     json.end_array();
-    fout << std::endl;
+    json.write_line_break();
 
     // Condense the overmap special placements so that all placements of a given special
     // are grouped under a single key for that special.
@@ -1281,10 +1287,10 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << std::endl;
+    json.write_line_break();
 
     json.member( "mapgen_arg_storage", mapgen_arg_storage );
-    fout << std::endl;
+    json.write_line_break();
     json.member( "mapgen_arg_index" );
     json.start_array();
     for( const std::pair<const tripoint_om_omt, std::optional<mapgen_arguments> *> &p :
@@ -1297,20 +1303,20 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_array();
     }
     json.end_array();
-    fout << std::endl;
+    json.write_line_break();
 
     std::vector<std::pair<om_pos_dir, std::string>> flattened_joins_used(
                 joins_used.begin(), joins_used.end() );
     json.member( "joins_used", flattened_joins_used );
-    fout << std::endl;
+    json.write_line_break();
 
     std::vector<std::pair<tripoint_om_omt, std::vector<oter_id>>> flattened_predecessors(
         predecessors_.begin(), predecessors_.end() );
     json.member( "predecessors", flattened_predecessors );
-    fout << std::endl;
+    json.write_line_break();
 
     json.end_object();
-    fout << std::endl;
+    json.write_line_break();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////
@@ -1476,13 +1482,7 @@ void global_variables::unserialize( JsonObject &jo )
 {
     jo.read( "global_vals", global_values );
     // potentially migrate some variable names
-    for( std::pair<std::string, std::string> migration : migrations ) {
-        if( global_values.count( migration.first ) != 0 ) {
-            auto extracted = global_values.extract( migration.first );
-            extracted.key() = migration.second;
-            global_values.insert( std::move( extracted ) );
-        }
-    }
+    global_values.migrate( migrations );
 }
 
 void timed_event_manager::unserialize_all( const JsonArray &ja )
@@ -1667,6 +1667,7 @@ void creature_tracker::deserialize( const JsonArray &ja )
 {
     monsters_list.clear();
     monsters_by_location.clear();
+    monsters_by_submap.clear();
     for( JsonValue jv : ja ) {
         // TODO: would be nice if monster had a constructor using JsonIn or similar, so this could be one statement.
         shared_ptr_fast<monster> mptr = make_shared_fast<monster>();
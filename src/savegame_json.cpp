@@ -822,6 +822,7 @@ void Character::load( const JsonObject &data )
     for( const std::pair<const trait_id, trait_data> &add : muts_to_add ) {
         my_mutations.emplace( add.first, add.second );
     }
+    trait_flag_counts.reset();
     // We need to ensure that my_mutations contains no invalid mutations before we do this
     // As every time we add a mutation, we rebuild the enchantment cache, causing errors if
     // we have invalid mutations.
@@ -1503,16 +1504,14 @@ void Character::store( JsonOut &json ) const
     json.member( "suppress_autohaul", suppress_autohaul );
 
     //save queued effect_on_conditions
-    queued_eocs temp_queued( queued_effect_on_conditions );
     json.member( "queued_effect_on_conditions" );
     json.start_array();
-    while( !temp_queued.empty() ) {
+    for( const queued_eoc &queued : queued_effect_on_conditions.list ) {
         json.start_object();
-        json.member( "time", temp_queued.top().time );
-        json.member( "eoc", temp_queued.top().eoc );
-        json.member( "context", temp_queued.top().context );
+        json.member( "time", queued.time );
+        json.member( "eoc", queued.eoc );
+        json.member( "context", queued.context );
         json.end_object();
-        temp_queued.pop();
     }
 
     json.end_array();
@@ -2978,7 +2977,9 @@ void item::io( Archive &archive )
     archive.io( "burnt", burnt, 0 );
     archive.io( "poison", poison, 0 );
     archive.io( "frequency", frequency, 0 );
+    snippet_id snip_id = get_snippet_id();
     archive.io( "snip_id", snip_id, snippet_id::NULL_ID() );
+    set_cold( &cold_data::snip_id, snip_id );
     // NB! field is named `irridation` in legacy files
     archive.io( "irridation", irradiation, 0 );
     archive.io( "bday", bday, calendar::start_of_cataclysm );
@@ -2986,9 +2987,13 @@ void item::io( Archive &archive )
     archive.io( "player_id", player_id, -1 );
     archive.io( "item_vars", item_vars, io::empty_default_tag() );
     // TODO: change default to empty string
+    std::string corpse_name = get_cold().corpse_name;
     archive.io( "name", corpse_name, std::string() );
+    set_cold( &cold_data::corpse_name, corpse_name );
     archive.io( "owner", owner, faction_id::NULL_ID() );
+    faction_id old_owner = get_cold().old_owner;
     archive.io( "old_owner", old_owner, faction_id::NULL_ID() );
+    set_cold( &cold_data::old_owner, old_owner );
     archive.io( "invlet", invlet, '\0' );
     archive.io( "damaged", damage_, 0 );
     archive.io( "degradation", degradation_, 0 );
@@ -2997,7 +3002,9 @@ void item::io( Archive &archive )
     archive.io( "item_counter", item_counter, static_cast<decltype( item_counter )>( 0 ) );
     archive.io( "countdown_point", countdown_point, calendar::turn_max );
     archive.io( "wetness", wetness, 0 );
+    harvest_drop_type_id dropped_from = get_dropped_from();
     archive.io( "dropped_from", dropped_from, harvest_drop_type_id::NULL_ID() );
+    set_dropped_from( dropped_from );
     archive.io( "rot", rot, 0_turns );
     archive.io( "last_temp_check", last_temp_check, calendar::start_of_cataclysm );
     archive.io( "current_phase", cur_phase, static_cast<int>( type->phase ) );
@@ -3077,11 +3084,11 @@ void item::io( Archive &archive )
     } );
 
     if( note_read ) {
-        snip_id = SNIPPET.migrate_hash_to_id( note );
+        set_cold( &cold_data::snip_id, SNIPPET.migrate_hash_to_id( note ) );
     } else {
         std::optional<std::string> snip;
         if( archive.read( "snippet_id", snip ) && snip ) {
-            snip_id = snippet_id( snip.value() );
+            set_cold( &cold_data::snip_id, snippet_id( snip.value() ) );
         }
     }
 
@@ -3939,13 +3946,7 @@ void Creature::load( const JsonObject &jsin )
 
     jsin.read( "values", values );
     // potentially migrate some values
-    for( std::pair<std::string, std::string> migration : get_globals().migrations ) {
-        if( values.count( migration.first ) != 0 ) {
-            auto extracted = values.extract( migration.first );
-            extracted.key() = migration.second;
-            values.insert( std::move( extracted ) );
-        }
-    }
+    values.migrate( get_globals().migrations );
 
     jsin.read( "damage_over_time_map", damage_over_time_map );
 
@@ -4042,11 +4043,31 @@ void player_morale::load( const JsonObject &jsin )
     jsin.read( "morale", points );
 }
 
-void mm_submap::serialize( JsonOut &jsout ) const
+int mm_id_dictionary::encode( const std::string &id )
+{
+    const auto it = index.find( id );
+    if( it != index.end() ) {
+        return it->second;
+    }
+    const int idx = ids.size();
+    ids.push_back( id );
+    index.emplace( id, idx );
+    return idx;
+}
+
+const std::string &mm_id_dictionary::decode( const JsonArray &ja, const int idx ) const
+{
+    if( idx < 0 || static_cast<size_t>( idx ) >= ids.size() ) {
+        ja.throw_error( string_format( "map memory id index %d out of range", idx ) );
+    }
+    return ids[idx];
+}
+
+void mm_submap::serialize( JsonOut &jsout, mm_id_dictionary &dict ) const
 {
     jsout.start_array();
 
-    // Uses RLE for compression.
+    // Uses RLE for compression, ids are written as indices into the region dictionary.
 
     memorized_tile last;
     int num_same = 1;
@@ -4055,11 +4076,11 @@ void mm_submap::serialize( JsonOut &jsout ) const
         jsout.start_array();
         jsout.write( num_same );
         jsout.write( last.symbol );
-        jsout.write( last.ter_id );
+        jsout.write( dict.encode( last.get_ter_id() ) );
         jsout.write( static_cast<int>( last.ter_subtile ) );
         jsout.write( static_cast<int>( last.ter_rotation ) );
-        if( !last.get_dec_id().empty() ) {
-            jsout.write( last.dec_id );
+        if( last.dec_id != 0 ) {
+            jsout.write( dict.encode( last.get_dec_id() ) );
             jsout.write( static_cast<int>( last.dec_subtile ) );
             jsout.write( static_cast<int>( last.dec_rotation ) );
         }
@@ -4087,7 +4108,7 @@ void mm_submap::serialize( JsonOut &jsout ) const
     jsout.end_array();
 }
 
-void mm_submap::deserialize( int version, const JsonArray &ja )
+void mm_submap::deserialize( int version, const JsonArray &ja, const mm_id_dictionary &dict )
 {
     size_t submap_array_idx = 0;
 
@@ -4117,7 +4138,7 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
                         tile.set_dec_id( std::move( id ) );
                         tile.set_dec_subtile( ja_tile.get_int( 1 ) );
                         const int legacy_rotation = ja_tile.get_int( 2 );
-                        if( string_starts_with( tile.dec_id, "vp_" ) ) {
+                        if( string_starts_with( tile.get_dec_id(), "vp_" ) ) {
                             // legacy vehicle rotation needs to be converted from 0-360 degrees
                             // to 0-3 tileset rotation
                             const units::angle legacy_angle = units::from_degrees( legacy_rotation );
@@ -4131,13 +4152,20 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
                         remaining = ja_tile.get_int( 4 ) - 1;
                     }
                 } else {
+                    // version 1 stores the ids themselves, later versions index into the dictionary
+                    const auto get_id = [&]( const int idx ) -> std::string {
+                        if( version < 2 ) {
+                            return ja_tile.get_string( idx );
+                        }
+                        return dict.decode( ja_tile, ja_tile.get_int( idx ) );
+                    };
                     remaining = ja_tile.get_int( 0 ) - 1;
                     tile.symbol = ja_tile.get_int( 1 );
-                    tile.set_ter_id( ja_tile.get_string( 2 ) );
+                    tile.set_ter_id( get_id( 2 ) );
                     tile.ter_subtile = ja_tile.get_int( 3 );
                     tile.ter_rotation = ja_tile.get_int( 4 );
                     if( ja_tile.size() > 5 ) {
-                        tile.set_dec_id( ja_tile.get_string( 5 ) );
+                        tile.set_dec_id( get_id( 5 ) );
                         tile.dec_subtile = ja_tile.get_int( 6 );
                         tile.dec_rotation = ja_tile.get_int( 7 );
                     } else {
@@ -4157,8 +4185,9 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
 
 void mm_region::serialize( JsonOut &jsout ) const
 {
+    mm_id_dictionary dict;
     jsout.start_object();
-    jsout.member( "version", 1 );
+    jsout.member( "version", 2 );
     jsout.write( "data" );
     jsout.write_member_separator();
     jsout.start_array();
@@ -4169,11 +4198,13 @@ void mm_region::serialize( JsonOut &jsout ) const
             if( sm->is_empty() ) {
                 jsout.write_null();
             } else {
-                sm->serialize( jsout );
+                sm->serialize( jsout, dict );
             }
         }
     }
     jsout.end_array();
+    // written after the data, as the dictionary is only complete once all submaps are written
+    jsout.member( "ids", dict.ids );
     jsout.end_object();
 }
 
@@ -4181,6 +4212,7 @@ void mm_region::deserialize( const JsonValue &ja )
 {
     int version;
     JsonArray region_json;
+    mm_id_dictionary dict;
 
     if( ja.test_array() ) { // legacy, remove after 0.H comes out
         version = 0;
@@ -4189,6 +4221,9 @@ void mm_region::deserialize( const JsonValue &ja )
         JsonObject region_obj = ja;
         version = region_obj.get_int( "version" );
         region_json = region_obj.get_array( "data" );
+        if( version >= 2 ) {
+            region_obj.read( "ids", dict.ids );
+        }
     }
 
     for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
@@ -4198,7 +4233,7 @@ void mm_region::deserialize( const JsonValue &ja )
             sm = make_shared_fast<mm_submap>();
             const JsonValue jsin = region_json.next_value();
             if( !jsin.test_null() ) {
-                sm->deserialize( version, jsin );
+                sm->deserialize( version, jsin, dict );
             }
         }
     }
@@ -4669,6 +4704,10 @@ void event_multiset::deserialize( const JsonObject &jo )
         jo.read( "event_counts", copy );
         summaries_ = { copy.begin(), copy.end() };
     }
+    count_ = 0;
+    for( const summaries_type::value_type &p : summaries_ ) {
+        count_ += p.second.count;
+    }
 }
 
 void stats_tracker::serialize( JsonOut &jsout ) const
@@ -4755,6 +4794,7 @@ void submap::store( JsonOut &jsout ) const
     if( is_uniform() ) {
         _write_rle_terrain( jsout, uniform_ter.id().str(), SEEX * SEEY );
         jsout.end_array();
+        store_objects( jsout );
         return;
     }
     std::string last_id;
@@ -4888,6 +4928,11 @@ void submap::store( JsonOut &jsout ) const
     }
     jsout.end_array();
 
+    store_objects( jsout );
+}
+
+void submap::store_objects( JsonOut &jsout ) const
+{
     // Write out as array of arrays of single entries
     jsout.member( "cosmetics" );
     jsout.start_array();
@@ -5099,7 +5144,7 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
             const point p( i, j );
             // TODO: jsin should support returning an id like jsin.get_id<trap>()
             const trap_str_id trid( trap_entry.next_string() );
-            m->trp[p.x][p.y] = trid.id();
+            m->trp.set( p, trid.id() );
             if( trap_entry.size() > 3 ) {
                 trap_entry.throw_error( "Too many values for trap entry" );
             }
@@ -5131,6 +5176,7 @@ void submap::load( const JsonValue &jv, const std::string &member_name, int vers
                 }
                 if( m->fld[i][j].add_field( ft, intensity, time_duration::from_turns( age ) ) ) {
                     field_count++;
+                    mark_field_tile( point( i, j ) );
                 }
             }
         }
@@ -16,6 +16,7 @@
 #include "map.h"
 #include "output.h"
 #include "point.h"
+#include "profile_zones.h"
 
 static constexpr int SCENT_RADIUS = 40;
 
@@ -161,6 +162,7 @@ bool scent_map::inbounds( const point &p ) const
 
 void scent_map::update( const tripoint &center, map &m )
 {
+    CATA_PROFILE_ZONE( profile_zones::zone::scent_update );
     // Stop updating scent after X turns of the player not moving.
     // Once wind is added, need to reset this on wind shifts as well.
     if( !player_last_position || center != *player_last_position ) {
@@ -170,17 +172,21 @@ void scent_map::update( const tripoint &center, map &m )
         return;
     }
 
-    // note: the next four intermediate matrices need to be at least
+    // note: the intermediate matrices need to be at least
     // [2*SCENT_RADIUS+3][2*SCENT_RADIUS+1] in size to hold enough data
     // The code I'm modifying used [MAPSIZE_X]. I'm staying with that to avoid new bugs.
 
-    // These two matrices are transposed so that x addresses are contiguous in memory
+    // Both passes below walk y in the inner loop, so every array is indexed [x][y] to keep
+    // the inner loops contiguous and branch free, which lets the compiler vectorize them.
     scent_array<int> sum_3_scent_y;
     scent_array<int> squares_used_y;
 
     // these are for caching flag lookups
     scent_array<bool> blocks_scent; // currently only ter_furn_flag::TFLAG_NO_SCENT blocks scent
     scent_array<bool> reduces_scent;
+    // How much each square takes part in diffusion: 10 normally, 2 for REDUCE_SCENT squares
+    // (only 20% of scent can diffuse on those) and 0 for squares that block scent.
+    scent_array<int> weight;
 
     // for loop constants
     const int scentmap_minx = center.x - SCENT_RADIUS;
@@ -195,6 +201,11 @@ void scent_map::update( const tripoint &center, map &m )
     // The new scent flag searching function. Should be wayyy faster than the old one.
     m.scent_blockers( blocks_scent, reduces_scent, point( scentmap_minx - 1, scentmap_miny - 1 ),
                       point( scentmap_maxx + 1, scentmap_maxy + 1 ) );
+    for( int x = scentmap_minx - 1; x <= scentmap_maxx + 1; ++x ) {
+        for( int y = scentmap_miny - 1; y <= scentmap_maxy + 1; ++y ) {
+            weight[x][y] = blocks_scent[x][y] ? 0 : reduces_scent[x][y] ? 2 : 10;
+        }
+    }
     // Sum neighbors in the y direction.  This way, each square gets called 3 times instead of 9
     // times. This cost us an extra loop here, but it also eliminated a loop at the end, so there
     // is a net performance improvement over the old code. Could probably still be better.
@@ -202,22 +213,12 @@ void scent_map::update( const tripoint &center, map &m )
     // than the final scent matrix. I think this is fine since SCENT_RADIUS is less than
     // MAPSIZE_X, but if that changes, this may need tweaking.
     for( int x = scentmap_minx - 1; x <= scentmap_maxx + 1; ++x ) {
+        const std::array<int, MAPSIZE_Y> &w = weight[x];
+        const std::array<int, MAPSIZE_Y> &scent = grscent[x];
         for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
             // remember the sum of the scent val for the 3 neighboring squares that can defuse into
-            sum_3_scent_y[y][x] = 0;
-            squares_used_y[y][x] = 0;
-            for( int i = y - 1; i <= y + 1; ++i ) {
-                if( !blocks_scent[x][i] ) {
-                    if( reduces_scent[x][i] ) {
-                        // only 20% of scent can diffuse on REDUCE_SCENT squares
-                        sum_3_scent_y[y][x] += 2 * grscent[x][i];
-                        squares_used_y[y][x] += 2;
-                    } else {
-                        sum_3_scent_y[y][x] += 10 * grscent[x][i];
-                        squares_used_y[y][x] += 10;
-                    }
-                }
-            }
+            sum_3_scent_y[x][y] = w[y - 1] * scent[y - 1] + w[y] * scent[y] + w[y + 1] * scent[y + 1];
+            squares_used_y[x][y] = w[y - 1] + w[y] + w[y + 1];
         }
     }
 
@@ -225,36 +226,29 @@ void scent_map::update( const tripoint &center, map &m )
     for( int x = scentmap_minx; x <= scentmap_maxx; ++x ) {
         for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
             int &scent_here = grscent[x][y];
-            if( !blocks_scent[x][y] ) {
-                // to how many neighboring squares do we diffuse out? (include our own square
-                // since we also include our own square when diffusing in)
-                const int squares_used = squares_used_y[y][x - 1]
-                                         + squares_used_y[y][x]
-                                         + squares_used_y[y][x + 1];
-
-                int this_diffusivity;
-                if( !reduces_scent[x][y] ) {
-                    this_diffusivity = diffusivity;
-                } else {
-                    this_diffusivity = diffusivity / 5; //less air movement for REDUCE_SCENT square
-                }
-                // take the old scent and subtract what diffuses out
-                int temp_scent = scent_here * ( 10 * 1000 - squares_used * this_diffusivity );
-                // neighboring REDUCE_SCENT squares absorb some scent
-                temp_scent -= scent_here * this_diffusivity * ( 90 - squares_used ) / 5;
-                // we've already summed neighboring scent values in the y direction in the previous
-                // loop. Now we do it for the x direction, multiply by diffusion, and this is what
-                // diffuses into our current square.
-                scent_here =
-                    ( temp_scent
-                      + this_diffusivity * ( sum_3_scent_y[y][x - 1]
-                                             + sum_3_scent_y[y][x]
-                                             + sum_3_scent_y[y][x + 1] )
-                    ) / ( 1000 * 10 );
-            } else {
-                // this cell blocks scent via NO_SCENT (in json)
-                scent_here = 0;
-            }
+            // to how many neighboring squares do we diffuse out? (include our own square
+            // since we also include our own square when diffusing in)
+            const int squares_used = squares_used_y[x - 1][y]
+                                     + squares_used_y[x][y]
+                                     + squares_used_y[x + 1][y];
+
+            // less air movement for REDUCE_SCENT square, none at all for blocking ones
+            const int this_diffusivity = weight[x][y] * diffusivity / 10;
+            // take the old scent and subtract what diffuses out
+            int temp_scent = scent_here * ( 10 * 1000 - squares_used * this_diffusivity );
+            // neighboring REDUCE_SCENT squares absorb some scent
+            temp_scent -= scent_here * this_diffusivity * ( 90 - squares_used ) / 5;
+            // we've already summed neighboring scent values in the y direction in the previous
+            // loop. Now we do it for the x direction, multiply by diffusion, and this is what
+            // diffuses into our current square.
+            const int diffused =
+                ( temp_scent
+                  + this_diffusivity * ( sum_3_scent_y[x - 1][y]
+                                         + sum_3_scent_y[x][y]
+                                         + sum_3_scent_y[x + 1][y] )
+                ) / ( 1000 * 10 );
+            // a square that blocks scent via NO_SCENT (in json) never holds any
+            scent_here = weight[x][y] != 0 ? diffused : 0;
         }
     }
 }
@@ -301,12 +301,12 @@ CachedTTFFont::CachedTTFFont(
     TTF_SetFontStyle( font.get(), TTF_STYLE_NORMAL );
 }
 
-SDL_Texture_Ptr CachedTTFFont::create_glyph( const SDL_Renderer_Ptr &renderer,
-        const std::string &ch,
-        const int color )
+SDL_Surface_Ptr CachedTTFFont::create_glyph( const std::string &ch )
 {
+    // Rendered in white, the color is applied when drawing
+    constexpr SDL_Color white{255, 255, 255, 255};
     const auto function = fontblending ? TTF_RenderUTF8_Blended : TTF_RenderUTF8_Solid;
-    SDL_Surface_Ptr sglyph( function( font.get(), ch.c_str(), windowsPalette[color] ) );
+    SDL_Surface_Ptr sglyph( function( font.get(), ch.c_str(), white ) );
     if( !sglyph ) {
         dbg( D_ERROR ) << "Failed to create glyph for " << ch << ": " << TTF_GetError();
         return nullptr;
@@ -336,11 +336,64 @@ SDL_Texture_Ptr CachedTTFFont::create_glyph( const SDL_Renderer_Ptr &renderer,
     SDL_SetSurfaceBlendMode( sglyph.get(), SDL_BLENDMODE_NONE );
     if( !printErrorIf( SDL_BlitSurface( sglyph.get(), &src_rect, surface.get(), &dst_rect ) != 0,
                        "SDL_BlitSurface failed" ) ) {
-        sglyph = std::move( surface );
+        return surface;
     }
-    SDL_SetSurfaceBlendMode( sglyph.get(), SDL_BLENDMODE_BLEND );
+    // The atlas takes 32 bit pixels only
+    return SDL_Surface_Ptr( SDL_ConvertSurfaceFormat( sglyph.get(), SDL_PIXELFORMAT_RGBA32, 0 ) );
+}
 
-    return CreateTextureFromSurface( renderer, sglyph );
+int CachedTTFFont::create_atlas_page( const SDL_Renderer_Ptr &renderer, const int w,
+                                      const int h )
+{
+    SDL_Texture_Ptr texture = CreateTexture( renderer, SDL_PIXELFORMAT_RGBA32,
+                              SDL_TEXTUREACCESS_STATIC, w, h );
+    if( !texture ) {
+        return -1;
+    }
+    SetTextureBlendMode( texture, SDL_BLENDMODE_BLEND );
+    // New textures hold garbage, clear what no glyph covers
+    const std::vector<Uint32> transparent( static_cast<size_t>( w ) * h, 0 );
+    const int pitch = w * static_cast<int>( sizeof( Uint32 ) );
+    printErrorIf( SDL_UpdateTexture( texture.get(), nullptr, transparent.data(), pitch ) != 0,
+                  "SDL_UpdateTexture failed" );
+    atlas.push_back( { std::move( texture ), w, h, {} } );
+    return static_cast<int>( atlas.size() ) - 1;
+}
+
+CachedTTFFont::cached_t CachedTTFFont::add_to_atlas( const SDL_Renderer_Ptr &renderer,
+        const SDL_Surface_Ptr &glyph )
+{
+    cached_t ret{ -1, { 0, 0, 0, 0 } };
+    if( !glyph ) {
+        return ret;
+    }
+    const int w = glyph->w;
+    const int h = glyph->h;
+    if( w > atlas_page_size || h > atlas_page_size ) {
+        // Whole strings drawn at once may not fit, they get a page of their own
+        ret.page = create_atlas_page( renderer, w, h );
+    } else {
+        if( open_page >= 0 && atlas_cursor.x + w > atlas_page_size ) {
+            atlas_cursor = point( 0, atlas_cursor.y + height );
+        }
+        if( open_page < 0 || atlas_cursor.y + h > atlas_page_size ) {
+            open_page = create_atlas_page( renderer, atlas_page_size, atlas_page_size );
+            atlas_cursor = point_zero;
+        }
+        ret.page = open_page;
+        ret.src = { atlas_cursor.x, atlas_cursor.y, w, h };
+        atlas_cursor.x += w;
+    }
+    if( ret.page < 0 ) {
+        return ret;
+    }
+    ret.src.w = w;
+    ret.src.h = h;
+    if( printErrorIf( SDL_UpdateTexture( atlas[ret.page].texture.get(), &ret.src, glyph->pixels,
+                                         glyph->pitch ) != 0, "SDL_UpdateTexture failed" ) ) {
+        ret.page = -1;
+    }
+    return ret;
 }
 
 bool CachedTTFFont::isGlyphProvided( const std::string &ch ) const
@@ -360,32 +413,92 @@ void CachedTTFFont::OutputChar( const SDL_Renderer_Ptr &renderer, const Geometry
                                 const std::string &ch, const point &p,
                                 unsigned char color, const float opacity )
 {
-    key_t    key {ch, static_cast<unsigned char>( color & 0xf )};
-
-    auto it = glyph_cache_map.find( key );
+    auto it = glyph_cache_map.find( ch );
     if( it == std::end( glyph_cache_map ) ) {
-        cached_t new_entry {
-            create_glyph( renderer, key.codepoints, key.color ),
-            static_cast<int>( width * utf8_width( key.codepoints ) )
-        };
-        it = glyph_cache_map.insert( std::make_pair( std::move( key ), std::move( new_entry ) ) ).first;
+        it = glyph_cache_map.emplace( ch, add_to_atlas( renderer, create_glyph( ch ) ) ).first;
     }
     const cached_t &value = it->second;
 
-    if( !value.texture ) {
+    if( value.page < 0 ) {
         // Nothing we can do here )-:
         return;
     }
-    SDL_Rect rect {p.x, p.y, value.width, height};
-    if( opacity != 1.0f ) {
-        SDL_SetTextureAlphaMod( value.texture.get(), opacity * 255.0f );
+    const SDL_Color &fg = windowsPalette[color & 0xf];
+    queued_glyph glyph{ value.src, { p.x, p.y, value.src.w, height },
+                        { fg.r, fg.g, fg.b, static_cast<Uint8>( opacity * 255.0f ) } };
+    atlas_page &page = atlas[value.page];
+    page.queued.push_back( glyph );
+    if( !batching ) {
+        draw_queued( renderer, page );
     }
-    RenderCopy( renderer, value.texture, nullptr, &rect );
-    if( opacity != 1.0f ) {
-        SDL_SetTextureAlphaMod( value.texture.get(), 255 );
+}
+
+void CachedTTFFont::begin_batch()
+{
+    batching = true;
+}
+
+void CachedTTFFont::flush_batch( const SDL_Renderer_Ptr &renderer )
+{
+    batching = false;
+    // Glyphs of one batch don't overlap, so the pages can be drawn in any order
+    for( atlas_page &page : atlas ) {
+        draw_queued( renderer, page );
     }
 }
 
+void CachedTTFFont::draw_queued( const SDL_Renderer_Ptr &renderer, atlas_page &page )
+{
+    if( page.queued.empty() ) {
+        return;
+    }
+#if SDL_VERSION_ATLEAST(2,0,18)
+    if( geometry_supported && page.queued.size() > 1 ) {
+        const float inv_w = 1.0f / page.width;
+        const float inv_h = 1.0f / page.height;
+        vertices.clear();
+        indices.clear();
+        vertices.reserve( page.queued.size() * 4 );
+        indices.reserve( page.queued.size() * 6 );
+        for( const queued_glyph &q : page.queued ) {
+            const float u0 = q.src.x * inv_w;
+            const float u1 = ( q.src.x + q.src.w ) * inv_w;
+            const float v0 = q.src.y * inv_h;
+            const float v1 = ( q.src.y + q.src.h ) * inv_h;
+            const float x0 = q.dst.x;
+            const float x1 = q.dst.x + q.dst.w;
+            const float y0 = q.dst.y;
+            const float y1 = q.dst.y + q.dst.h;
+            const int base = static_cast<int>( vertices.size() );
+            vertices.push_back( { { x0, y0 }, q.color, { u0, v0 } } );
+            vertices.push_back( { { x1, y0 }, q.color, { u1, v0 } } );
+            vertices.push_back( { { x1, y1 }, q.color, { u1, v1 } } );
+            vertices.push_back( { { x0, y1 }, q.color, { u0, v1 } } );
+            for( const int i : {
+                     0, 1, 2, 0, 2, 3
+                 } ) {
+                indices.push_back( base + i );
+            }
+        }
+        if( SDL_RenderGeometry( renderer.get(), page.texture.get(), vertices.data(),
+                                static_cast<int>( vertices.size() ), indices.data(),
+                                static_cast<int>( indices.size() ) ) == 0 ) {
+            page.queued.clear();
+            return;
+        }
+        // Some render drivers don't implement geometry, stick to plain copies from now on
+        dbg( D_INFO ) << "SDL_RenderGeometry failed, not batching text: " << SDL_GetError();
+        geometry_supported = false;
+    }
+#endif
+    for( const queued_glyph &q : page.queued ) {
+        SetTextureColorMod( page.texture, q.color.r, q.color.g, q.color.b );
+        SDL_SetTextureAlphaMod( page.texture.get(), q.color.a );
+        RenderCopy( renderer, page.texture, &q.src, &q.dst );
+    }
+    page.queued.clear();
+}
+
 BitmapFont::BitmapFont(
     SDL_Renderer_Ptr &renderer, SDL_PixelFormat_Ptr &format,
     const int w, const int h,
@@ -623,4 +736,18 @@ void FontFallbackList::OutputChar( const SDL_Renderer_Ptr &renderer,
     ( *cached->second )->OutputChar( renderer, geometry, ch, p, color, opacity );
 }
 
+void FontFallbackList::begin_batch()
+{
+    for( std::unique_ptr<Font> &font : fonts ) {
+        font->begin_batch();
+    }
+}
+
+void FontFallbackList::flush_batch( const SDL_Renderer_Ptr &renderer )
+{
+    for( std::unique_ptr<Font> &font : fonts ) {
+        font->flush_batch( renderer );
+    }
+}
+
 #endif // TILES
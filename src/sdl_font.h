@@ -10,6 +10,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <string>
 
@@ -18,7 +19,6 @@
 #include "color_loader.h"
 #include "debug.h"
 #include "point.h"
-#include "hash_utils.h"
 #include "sdl_wrappers.h"
 
 using palette_array = std::array<SDL_Color, color_loader<SDL_Color>::COLOR_NAMES_COUNT>;
@@ -43,6 +43,12 @@ class Font
                                  const std::string &ch, const point &p,
                                  unsigned char color, float opacity = 1.0f ) = 0;
 
+        /// Queue the characters output from now on instead of drawing each one right away.
+        /// Nothing drawn before @ref flush_batch may overlap a queued character.
+        virtual void begin_batch() { }
+        /// Draw the characters queued since @ref begin_batch and go back to drawing right away.
+        virtual void flush_batch( const SDL_Renderer_Ptr & ) { }
+
         /// Draw an ascii line using font's palette.
         /// @param line_id Character to draw
         /// @param point Point on the screen where to draw character
@@ -68,7 +74,10 @@ class Font
 };
 using Font_Ptr = std::unique_ptr<Font>;
 
-/// Font implementation on a TrueType font. Its glyphs are cached.
+/// Font implementation on a TrueType font. Its glyphs are rendered once in white into
+/// shared atlas textures and tinted with color modulation when drawn. Between
+/// @ref begin_batch and @ref flush_batch the glyphs of each atlas page are submitted with a
+/// single @ref SDL_RenderGeometry call (SDL 2.0.18 and later).
 class CachedTTFFont : public Font
 {
     public:
@@ -83,37 +92,51 @@ class CachedTTFFont : public Font
                          const std::string &ch,
                          const point &p,
                          unsigned char color, float opacity = 1.0f ) override;
+        void begin_batch() override;
+        void flush_batch( const SDL_Renderer_Ptr &renderer ) override;
     protected:
-        SDL_Texture_Ptr create_glyph( const SDL_Renderer_Ptr &renderer, const std::string &ch, int color );
-
-        TTF_Font_Ptr font;
-        // Maps (character code, color) to SDL_Texture*
-
-        struct key_t {
-            std::string   codepoints;
-            unsigned char color;
-
-            std::pair<std::string, unsigned char> as_pair() const {
-                return std::make_pair( codepoints, color );
-            }
+        // Side of a regular atlas page in pixels, wider glyphs get a page of their own
+        static constexpr int atlas_page_size = 1024;
 
-            friend bool operator==( const key_t &lhs, const key_t &rhs ) noexcept {
-                return lhs.as_pair() == rhs.as_pair();
-            }
+        struct queued_glyph {
+            SDL_Rect src;
+            SDL_Rect dst;
+            SDL_Color color;
         };
 
-        struct key_t_hash {
-            size_t operator()( const key_t &k ) const {
-                return cata::auto_hash<std::pair<std::string, unsigned char>>()( k.as_pair() );
-            }
+        struct atlas_page {
+            SDL_Texture_Ptr texture;
+            int width;
+            int height;
+            std::vector<queued_glyph> queued;
         };
 
         struct cached_t {
-            SDL_Texture_Ptr texture;
-            int          width;
+            // Index into atlas, negative if the glyph could not be rendered
+            int page;
+            SDL_Rect src;
         };
 
-        std::unordered_map<key_t, cached_t, key_t_hash> glyph_cache_map;
+        /// Render @p ch in white, one cell high and as many cells wide as it takes.
+        SDL_Surface_Ptr create_glyph( const std::string &ch );
+        /// Copy @p glyph into the atlas, opening a new page when the current one is full.
+        cached_t add_to_atlas( const SDL_Renderer_Ptr &renderer, const SDL_Surface_Ptr &glyph );
+        int create_atlas_page( const SDL_Renderer_Ptr &renderer, int w, int h );
+        void draw_queued( const SDL_Renderer_Ptr &renderer, atlas_page &page );
+
+        TTF_Font_Ptr font;
+        // Maps character codes to their place in the atlas
+        std::unordered_map<std::string, cached_t> glyph_cache_map;
+        std::vector<atlas_page> atlas;
+        // Page glyphs are currently packed into, in rows one cell high
+        int open_page = -1;
+        point atlas_cursor;
+        bool batching = false;
+#if SDL_VERSION_ATLEAST(2,0,18)
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+        bool geometry_supported = true;
+#endif
 
         const bool fontblending;
 };
@@ -163,6 +186,8 @@ class FontFallbackList : public Font
                          const std::string &ch,
                          const point &p,
                          unsigned char color, float opacity = 1.0f ) override;
+        void begin_batch() override;
+        void flush_batch( const SDL_Renderer_Ptr &renderer ) override;
     protected:
         std::vector<std::unique_ptr<Font>> fonts;
         std::map<std::string, std::vector<std::unique_ptr<Font>>::iterator> glyph_font;
@@ -11,6 +11,7 @@
 #include <vector>
 #include <exception>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <utility>
 
@@ -341,6 +342,7 @@ bool init_sound()
 }
 void shutdown_sound()
 {
+    sfx::stop_sound_worker();
     // De-allocate all loaded sound.
     sfx_resources.resource.clear();
     sfx_resources.sound_effects.clear();
@@ -516,11 +518,15 @@ static Mix_Chunk *load_chunk( const std::string &path )
     return result;
 }
 
+static std::mutex sfx_resource_mutex;
+
 // Check to see if the resource has already been loaded
 // - Loaded: Return stored pointer
 // - Not Loaded: Load chunk from stored resource path
 static Mix_Chunk *get_sfx_resource( int resource_id )
 {
+    // Also called from the sfx worker thread
+    std::lock_guard<std::mutex> lock( sfx_resource_mutex );
     sound_effect_resource &resource = sfx_resources.resource[ resource_id ];
     if( !resource.chunk ) {
         cata_path path = current_soundpack_path / resource.path;
@@ -106,6 +106,8 @@ static const oter_type_str_id oter_type_forest_trail( "forest_trail" );
 static const trait_id trait_DEBUG_CLAIRVOYANCE( "DEBUG_CLAIRVOYANCE" );
 static const trait_id trait_DEBUG_NIGHTVISION( "DEBUG_NIGHTVISION" );
 
+static const option_handle<bool> opt_use_draw_ascii_lines_routine( "USE_DRAW_ASCII_LINES_ROUTINE" );
+
 //***********************************
 //Globals                           *
 //***********************************
@@ -587,6 +589,23 @@ static void invalidate_framebuffer( std::vector<curseline> &framebuffer, const p
     }
 }
 
+// Forget the terminal cells covered by @p width x @p height pixels at @p pos (in pixels),
+// after drawing something there that doesn't go through the terminal frame buffer
+static void invalidate_terminal_pixels( const point &pos, const int width, const int height )
+{
+    if( fontwidth <= 0 || fontheight <= 0 || terminal_framebuffer.empty() ) {
+        return;
+    }
+    const int max_x = static_cast<int>( terminal_framebuffer.front().chars.size() );
+    const int max_y = static_cast<int>( terminal_framebuffer.size() );
+    const point p1( clamp( pos.x / fontwidth, 0, max_x ), clamp( pos.y / fontheight, 0, max_y ) );
+    const point p2( clamp( divide_round_up( pos.x + width, fontwidth ), 0, max_x ),
+                    clamp( divide_round_up( pos.y + height, fontheight ), 0, max_y ) );
+    if( p2.x > p1.x && p2.y > p1.y ) {
+        invalidate_framebuffer( terminal_framebuffer, p1, p2.x - p1.x, p2.y - p1.y );
+    }
+}
+
 static void invalidate_framebuffer( std::vector<curseline> &framebuffer )
 {
     for( curseline &i : framebuffer ) {
@@ -679,8 +698,10 @@ void cata_cursesport::handle_additional_window_clear( WINDOW *win )
 void clear_window_area( const catacurses::window &win_ )
 {
     cata_cursesport::WINDOW *const win = win_.get<cata_cursesport::WINDOW>();
-    geometry->rect( renderer, point( win->pos.x * fontwidth, win->pos.y * fontheight ),
-                    win->width * fontwidth, win->height * fontheight, color_as_sdl( catacurses::black ) );
+    const point pos( win->pos.x * fontwidth, win->pos.y * fontheight );
+    geometry->rect( renderer, pos, win->width * fontwidth, win->height * fontheight,
+                    color_as_sdl( catacurses::black ) );
+    invalidate_terminal_pixels( pos, win->width * fontwidth, win->height * fontheight );
 }
 
 static std::optional<std::pair<tripoint_abs_omt, std::string>> get_mission_arrow(
@@ -896,11 +917,15 @@ void cata_tiles::draw_om( const point &dest, const tripoint_abs_omt &center_abs_
         return tripoint( omp.raw().xy(), 0 );
     };
 
+    overmap_ui::omt_view_cache &view_cache = overmap_ui::get_omt_view_cache();
+    view_cache.set_area( corner_NW, point( max_col - min_col, max_row - min_row ) );
+
     for( int row = min_row; row < max_row; row++ ) {
         for( int col = min_col; col < max_col; col++ ) {
             const tripoint_abs_omt omp = origin + point( col, row );
+            overmap_ui::omt_view_cache::omt_info &omt = view_cache.get( omp );
 
-            const bool see = overmap_buffer.seen( omp );
+            const bool see = omt.seen;
             const bool los = see && ( you.overmap_los( omp, sight_points ) || uistate.overmap_debug_mongroup ||
                                       you.has_trait( trait_DEBUG_CLAIRVOYANCE ) );
             // the full string from the ter_id including _north etc.
@@ -920,11 +945,16 @@ void cata_tiles::draw_om( const point &dest, const tripoint_abs_omt &center_abs_
             } else if( !see ) {
                 id = "unknown_terrain";
             } else {
-                id = get_omt_id_rotation_and_subtile( omp, rotation, subtile );
-                mx = overmap_buffer.extra( omp );
+                if( !omt.tile_id ) {
+                    omt.tile_id = get_omt_id_rotation_and_subtile( omp, omt.tile_rotation, omt.tile_subtile );
+                }
+                id = *omt.tile_id;
+                rotation = omt.tile_rotation;
+                subtile = omt.tile_subtile;
+                mx = omt.extra;
             }
 
-            const lit_level ll = overmap_buffer.is_explored( omp ) ? lit_level::LOW : lit_level::LIT;
+            const lit_level ll = omt.explored ? lit_level::LOW : lit_level::LIT;
             // light level is now used for choosing between grayscale filter and normal lit tiles.
             draw_from_id_string( id, TILE_CATEGORY::OVERMAP_TERRAIN, "overmap_terrain", omp.raw(),
                                  subtile, rotation, ll, false, height_3d );
@@ -950,7 +980,7 @@ void cata_tiles::draw_om( const point &dest, const tripoint_abs_omt &center_abs_
                                              omp.raw(), 0, 0, lit_level::LIT, false );
                     }
                 }
-                const int horde_size = overmap_buffer.get_horde_size( omp );
+                const int horde_size = omt.horde_size;
                 if( showhordes && los && horde_size >= HORDE_VISIBILITY_SIZE ) {
                     // a little bit of hardcoded fallbacks for hordes
                     if( find_tile_with_season( id ) ) {
@@ -995,7 +1025,7 @@ void cata_tiles::draw_om( const point &dest, const tripoint_abs_omt &center_abs_
                 }
             }
 
-            if( blink && overmap_buffer.has_vehicle( omp ) ) {
+            if( blink && omt.has_vehicle ) {
                 const std::string tile_id = overmap_buffer.get_vehicle_tile_id( omp );
                 if( find_tile_looks_like( tile_id, TILE_CATEGORY::OVERMAP_NOTE, "" ) ) {
                     draw_from_id_string( tile_id, TILE_CATEGORY::OVERMAP_NOTE,
@@ -1008,15 +1038,10 @@ void cata_tiles::draw_om( const point &dest, const tripoint_abs_omt &center_abs_
                 }
             }
 
-            if( blink && uistate.overmap_show_map_notes && overmap_buffer.has_note( omp ) ) {
-
-                nc_color ter_color = c_black;
-                std::string ter_sym = " ";
+            if( blink && uistate.overmap_show_map_notes && omt.has_note ) {
                 // Display notes in all situations, even when not seen
-                std::tie( ter_sym, ter_color, std::ignore ) =
-                    overmap_ui::get_note_display_info( overmap_buffer.note( omp ) );
-
-                std::string note_name = "note_" + ter_sym + "_" + string_from_color( ter_color );
+                std::string note_name = "note_" + std::string( 1, omt.note_sym ) + "_" +
+                                        string_from_color( omt.note_color );
                 draw_from_id_string( note_name, TILE_CATEGORY::OVERMAP_NOTE, "overmap_note",
                                      omp.raw(), 0, 0, lit_level::LIT, false );
             }
@@ -1271,35 +1296,30 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
                                           terminal_framebuffer;
 
     /*
-    Let's try to keep track of different windows.
-    A number of windows are coexisting on the screen, so don't have to interfere.
-
-    g->w_terrain, g->w_minimap, g->w_HP, g->w_status, g->w_status2, g->w_messages,
-     g->w_location, and g->w_minimap, can be buffered if either of them was
-     the previous window.
-
-    g->w_overmap and g->w_omlegend are likewise.
+    The terminal frame buffer holds what every terminal cell shows, whichever window drew it:
+    everything drawing there by other means (tiles, map fonts, cleared areas) forgets the
+    cells it covers. So only cells differing from it are drawn again.
 
-    Everything else works on strict equality because there aren't yet IDs for some of them.
+    The oversized frame buffer is only kept for the terrain and overmap windows. It can be
+    reused if the last window drawn was the terrain or the minimap (resp. the overmap or its
+    legend).
     */
-    if( g && ( w == g->w_terrain || w == g->w_minimap ) ) {
+    if( !use_oversized_framebuffer ) {
+        oldWinCompatible = true;
+    } else if( w == g->w_terrain ) {
         if( winBuffer == g->w_terrain || winBuffer == g->w_minimap ) {
             oldWinCompatible = true;
         }
-    } else if( g && ( w == g->w_overmap || w == g->w_omlegend ) ) {
-        if( winBuffer == g->w_overmap || winBuffer == g->w_omlegend ) {
-            oldWinCompatible = true;
-        }
-    } else {
-        if( win == winBuffer ) {
-            oldWinCompatible = true;
-        }
+    } else if( winBuffer == g->w_overmap || winBuffer == g->w_omlegend ) {
+        oldWinCompatible = true;
     }
 
     // TODO: Get this from UTF system to make sure it is exactly the kind of space we need
     static const std::string space_string = " ";
 
     bool update = false;
+    // Each glyph stays inside its own cells, so they can all be drawn after the backgrounds
+    font->begin_batch();
     for( int j = 0; j < win->height; j++ ) {
         if( !win->line[j].touched ) {
             continue;
@@ -1355,7 +1375,7 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
                 // utf8_width() may return a negative width
                 continue;
             }
-            bool use_draw_ascii_lines_routine = get_option<bool>( "USE_DRAW_ASCII_LINES_ROUTINE" );
+            bool use_draw_ascii_lines_routine = opt_use_draw_ascii_lines_routine.get();
             unsigned char uc = static_cast<unsigned char>( cell.ch[0] );
             switch( codepoint ) {
                 case LINE_XOXO_UNICODE:
@@ -1407,6 +1427,7 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
             }
         }
     }
+    font->flush_batch( renderer );
     win->draw = false; //We drew the window, mark it as so
     //Keeping track of last drawn window and tilemode zoom level
     ::winBuffer = w.weak_ptr();
@@ -1539,13 +1560,24 @@ void cata_cursesport::curses_drawwindow( const catacurses::window &w )
         }
         // Special font for the terrain window
         update = draw_window( map_font, w );
+        if( update ) {
+            invalidate_framebuffer( terminal_framebuffer, win->pos,
+                                    TERRAIN_WINDOW_TERM_WIDTH, TERRAIN_WINDOW_TERM_HEIGHT );
+        }
     } else if( g && w == g->w_overmap && use_tiles && use_tiles_overmap ) {
         overmap_tilecontext->draw_om( win->pos, overmap_ui::redraw_info.center,
                                       overmap_ui::redraw_info.blink );
+        invalidate_terminal_pixels( point( win->pos.x * fontwidth, win->pos.y * fontheight ),
+                                    win->width * fontwidth, win->height * fontheight );
         update = true;
     } else if( g && w == g->w_overmap && overmap_font ) {
         // Special font for the terrain window
         update = draw_window( overmap_font, w );
+        if( update ) {
+            invalidate_terminal_pixels( point( win->pos.x * fontwidth, win->pos.y * fontheight ),
+                                        win->width * overmap_font->width,
+                                        win->height * overmap_font->height );
+        }
     } else if( g && w == g->w_pixel_minimap && pixel_minimap_option ) {
         // ensure the space the minimap covers is "dirtied".
         // this is necessary when it's the only part of the sidebar being drawn
@@ -3816,11 +3848,11 @@ void input_manager::pump_events()
 
 // This is how we're actually going to handle input events, SDL getch
 // is simply a wrapper around this.
-input_event input_manager::get_input_event( const keyboard_mode preferred_keyboard_mode )
+input_event input_manager::get_device_input_event( const keyboard_mode preferred_keyboard_mode )
 {
     if( test_mode ) {
         // input should be skipped in caller's code
-        throw std::runtime_error( "input_manager::get_input_event called in test mode" );
+        throw std::runtime_error( "input_manager::get_device_input_event called in test mode" );
     }
 
 #if !defined(__ANDROID__) && !(defined(TARGET_OS_IPHONE) && TARGET_OS_IPHONE == 1)
@@ -182,6 +182,7 @@ void cast_horizontal_zlight_segment(
 
         for( auto this_span = spans.begin(); this_span != spans.end(); ) {
             bool started_block = false;
+            row_intensity_cache<T, calc> span_intensity( numerator, this_span->cumulative_value );
             // TODO: Precalculate min/max delta.z based on start/end and distance
             for( delta.z = 0; delta.z <= distance; delta.z++ ) {
                 // Shadowcasting sweeps from the cardinal to the most extreme edge of the octant
@@ -275,7 +276,7 @@ void cast_horizontal_zlight_segment(
                     }
 
                     const int dist = rl_dist( tripoint_zero, delta ) + offset_distance;
-                    last_intensity = calc( numerator, this_span->cumulative_value, dist );
+                    last_intensity = span_intensity( dist );
 
                     if( !floor_block ) {
                         ( *output_caches[z_index] )[current.x][current.y] =
@@ -370,6 +371,7 @@ void cast_vertical_zlight_segment(
 
         for( auto this_span = spans.begin(); this_span != spans.end(); ) {
             bool started_block = false;
+            row_intensity_cache<T, calc> span_intensity( numerator, this_span->cumulative_value );
             for( delta.y = 0; delta.y <= distance; delta.y++ ) {
                 // See comment above trailing_edge_major and leading_edge_major in above function.
                 const slope trailing_edge_major( delta.y * 2 - 1, delta.z * 2 + 1 );
@@ -447,7 +449,7 @@ void cast_vertical_zlight_segment(
                     }
 
                     const int dist = rl_dist( tripoint_zero, delta ) + offset_distance;
-                    last_intensity = calc( numerator, this_span->cumulative_value, dist );
+                    last_intensity = span_intensity( dist );
 
                     if( !floor_block ) {
                         ( *output_caches[z_index] )[current.x][current.y] =
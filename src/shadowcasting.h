@@ -115,6 +115,32 @@ inline float accumulate_transparency( const float &cumulative_transparency,
     return ( ( distance - 1 ) * cumulative_transparency + current_transparency ) / distance;
 }
 
+// Within a single row (or span) of a shadowcast the numerator and the cumulative transparency
+// are fixed, so the intensity only changes with the distance, which with square distances is
+// constant along the whole row.  Remembering the last result skips most of the exp() calls
+// in sight_calc without changing its output.
+template<typename T, T( *calc )( const T &, const T &, const int & )>
+class row_intensity_cache
+{
+    public:
+        row_intensity_cache( const T &numerator, const T &transparency ) :
+            numerator( numerator ), transparency( transparency ) {}
+
+        const T &operator()( const int distance ) {
+            if( distance != last_distance ) {
+                last_distance = distance;
+                intensity = calc( numerator, transparency, distance );
+            }
+            return intensity;
+        }
+
+    private:
+        T numerator;
+        T transparency;
+        T intensity = T( 0.0 );
+        int last_distance = -1;
+};
+
 template<typename T, typename Out, T( *calc )( const T &, const T &, const int & ),
          bool( *check )( const T &, const T & ),
          void( *update_output )( Out &, const T &, quadrant ),
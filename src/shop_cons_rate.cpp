@@ -23,12 +23,17 @@ bool icg_entry::operator==( icg_entry const &rhs ) const
 
 bool icg_entry::matches( item const &it, npc const &beta ) const
 {
+    // Setting up the dialogue for the condition costs far more than the other checks
+    if( !( itype.is_empty() || it.typeId() == itype ) ||
+        !( category.is_empty() || it.get_category_shallow().id == category ) ||
+        !( item_group.is_empty() || item_group::group_contains_item( item_group, it.typeId() ) ) ) {
+        return false;
+    }
+    if( !condition ) {
+        return true;
+    }
     dialogue temp( get_talker_for( get_avatar() ), get_talker_for( beta ) );
-    return ( !condition || condition( temp ) ) &&
-           ( itype.is_empty() || it.typeId() == itype ) &&
-           ( category.is_empty() || it.get_category_shallow().id == category ) &&
-           ( item_group.is_empty() ||
-             item_group::group_contains_item( item_group, it.typeId() ) );
+    return condition( temp );
 }
 
 /** @relates string_id */
@@ -1,5 +1,7 @@
 #include "simple_pathfinding.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <limits>
 #include <queue>
@@ -39,6 +41,45 @@ struct point_node {
 
 } // namespace
 
+namespace
+{
+// Search state of greedy_path, kept between calls. Overmap generation lays out dozens of
+// connections, each would otherwise allocate and clear arrays the size of the whole overmap.
+// An entry only counts when its stamp matches the current search, so nothing is cleared.
+struct greedy_path_scratch {
+    std::vector<unsigned int> stamp;
+    std::vector<bool> closed;
+    std::vector<int> open;
+    std::vector<short> dirs;
+    std::vector<point_node> heap;
+    unsigned int current = 0;
+
+    void start( const size_t map_size ) {
+        if( stamp.size() < map_size ) {
+            stamp.assign( map_size, 0 );
+            closed.resize( map_size );
+            open.resize( map_size );
+            dirs.resize( map_size );
+            current = 0;
+        }
+        if( ++current == 0 ) {
+            std::fill( stamp.begin(), stamp.end(), 0 );
+            current = 1;
+        }
+        heap.clear();
+    }
+    // Makes the entry at n valid for this search, as neither visited nor queued.
+    void touch( const size_t n ) {
+        if( stamp[n] != current ) {
+            stamp[n] = current;
+            closed[n] = false;
+            open[n] = 0;
+            dirs[n] = 0;
+        }
+    }
+};
+} // namespace
+
 directed_path<point> greedy_path( const point &source, const point &dest, const point &max,
                                   const two_node_scoring_fn<point> &scorer )
 {
@@ -62,27 +103,31 @@ directed_path<point> greedy_path( const point &source, const point &dest, const
                 std::nullopt ).node_cost < 0 ) {
         return res;
     }
-    const size_t map_size = static_cast<size_t>( max.x ) * max.y;
-    std::vector<bool> closed( map_size, false );
-    std::vector<int> open( map_size, 0 );
-    std::vector<short> dirs( map_size, 0 );
-    std::array<std::priority_queue<Node, std::vector<Node>>, 2> nodes;
+    static thread_local greedy_path_scratch scratch;
+    scratch.start( static_cast<size_t>( max.x ) * max.y );
+    std::vector<point_node> &heap = scratch.heap;
 
-    int i = 0;
-    nodes[i].push( first_node );
-    open[map_index( source )] = std::numeric_limits<int>::max();
-    while( !nodes[i].empty() ) {
-        const Node mn( nodes[i].top() ); // get the best-looking node
-        nodes[i].pop();
+    heap.push_back( first_node );
+    scratch.touch( map_index( source ) );
+    scratch.open[map_index( source )] = std::numeric_limits<int>::max();
+    while( !heap.empty() ) {
+        // get the best-looking node
+        std::pop_heap( heap.begin(), heap.end() );
+        const Node mn( heap.back() );
+        heap.pop_back();
+        const int mn_index = map_index( mn.pos );
+        // A node whose priority improved is queued again, the outdated entries are skipped
+        if( scratch.closed[mn_index] ) {
+            continue;
+        }
         // mark it visited
-        closed[map_index( mn.pos )] = true;
+        scratch.closed[mn_index] = true;
         // if we've reached the end, draw the path and return
         if( mn.pos == dest ) {
             point p = mn.pos;
-            res.nodes.reserve( nodes[i].size() );
             while( p != source ) {
                 const int n = map_index( p );
-                const om_direction::type dir = static_cast<om_direction::type>( dirs[n] );
+                const om_direction::type dir = static_cast<om_direction::type>( scratch.dirs[n] );
                 res.nodes.emplace_back( p, dir );
                 p += om_direction::displace( dir );
             }
@@ -91,9 +136,13 @@ directed_path<point> greedy_path( const point &source, const point &dest, const
         }
         for( om_direction::type dir : om_direction::all ) {
             const point p = mn.pos + om_direction::displace( dir );
-            const int n = map_index( p );
             // don't allow out of bounds or already traversed tiles
-            if( !inbounds( p ) || closed[n] ) {
+            if( !inbounds( p ) ) {
+                continue;
+            }
+            const int n = map_index( p );
+            scratch.touch( n );
+            if( scratch.closed[n] ) {
                 continue;
             }
             const node_score score = scorer( directed_node<point>( p, dir ), directed_node<point>( mn.pos,
@@ -103,25 +152,11 @@ directed_path<point> greedy_path( const point &source, const point &dest, const
             }
             const int priority = score.node_cost + score.estimated_dest_cost;
             // record direction to shortest path
-            if( open[n] == 0 || open[n] > priority ) {
-                dirs[n] = ( static_cast<int>( dir ) + 2 ) % 4;
-                if( open[n] != 0 ) {
-                    while( nodes[i].top().pos != p ) {
-                        nodes[1 - i].push( nodes[i].top() );
-                        nodes[i].pop();
-                    }
-                    nodes[i].pop();
-                    if( nodes[i].size() > nodes[1 - i].size() ) {
-                        i = 1 - i;
-                    }
-                    while( !nodes[i].empty() ) {
-                        nodes[1 - i].push( nodes[i].top() );
-                        nodes[i].pop();
-                    }
-                    i = 1 - i;
-                }
-                open[n] = priority;
-                nodes[i].emplace( p, dir, priority );
+            if( scratch.open[n] == 0 || scratch.open[n] > priority ) {
+                scratch.dirs[n] = ( static_cast<int>( dir ) + 2 ) % 4;
+                scratch.open[n] = priority;
+                heap.emplace_back( p, dir, priority );
+                std::push_heap( heap.begin(), heap.end() );
             }
         }
     }
@@ -17,6 +17,7 @@
 
 #include "simplexnoise.h"
 
+#include <algorithm>
 #include <cmath>
 
 /* 2D, 3D and 4D Simplex Noise functions return 'random' values in (-1, 1).
@@ -141,6 +142,37 @@ float scaled_octave_noise_3d( const float octaves, const float persistence, cons
                             z ) * ( hiBound - loBound ) / 2 + ( hiBound + loBound ) / 2;
 }
 
+// 3D Scaled Multi-octave Simplex noise for a row of points.
+//
+// Goes through the octaves one at a time for the whole row, so the values that only depend
+// on the octave are worked out once per row. The order of the additions for each point is
+// the same as in scaled_octave_noise_3d, so the results are identical.
+void scaled_octave_noise_3d_row( const float octaves, const float persistence, const float scale,
+                                 const float loBound, const float hiBound, const float x, const float y, const float z,
+                                 const int count, float *const out )
+{
+    std::fill( out, out + count, 0.0f );
+    float frequency = scale;
+    float amplitude = 1.0f;
+    float maxAmplitude = 0.0f;
+
+    for( int i = 0; i < octaves; i++ ) {
+        const float fy = y * frequency;
+        const float fz = z * frequency;
+        for( int n = 0; n < count; n++ ) {
+            out[n] += raw_noise_3d( ( x + n ) * frequency, fy, fz ) * amplitude;
+        }
+
+        frequency *= 2;
+        maxAmplitude += amplitude;
+        amplitude *= persistence;
+    }
+
+    for( int n = 0; n < count; n++ ) {
+        out[n] = out[n] / maxAmplitude * ( hiBound - loBound ) / 2 + ( hiBound + loBound ) / 2;
+    }
+}
+
 // 4D Scaled Multi-octave Simplex noise.
 //
 // Returned value will be between loBound and hiBound.
@@ -94,6 +94,19 @@ float scaled_octave_noise_4d( float octaves,
                               float z,
                               float w );
 
+// Scaled Multi-octave Simplex noise for the row of points ( x + n, y, z ) for n in [0, count),
+// written to out. Gives the same results as scaled_octave_noise_3d for each point.
+void scaled_octave_noise_3d_row( float octaves,
+                                 float persistence,
+                                 float scale,
+                                 float loBound,
+                                 float hiBound,
+                                 float x,
+                                 float y,
+                                 float z,
+                                 int count,
+                                 float *out );
+
 // Scaled Raw Simplex noise
 // The result will be between the two parameters passed.
 float scaled_raw_noise_2d( float loBound,
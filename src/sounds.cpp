@@ -15,6 +15,7 @@
 #include "coordinate_conversions.h"
 #include "coordinates.h"
 #include "creature_tracker.h"
+#include "cuboid_rectangle.h"
 #include "debug.h"
 #include "effect.h"
 #include "enums.h"
@@ -53,6 +54,8 @@
 #   else
 #      include <SDL_mixer.h>
 #   endif
+#   include <condition_variable>
+#   include <mutex>
 #   include <thread>
 #   if defined(_WIN32) && !defined(_MSC_VER)
 #       include "mingw.thread.h"
@@ -243,6 +246,43 @@ static std::vector<std::pair<tripoint, sound_event>> sounds_since_last_turn;
 // The sound events currently displayed to the player.
 static std::unordered_map<tripoint, sound_event> sound_markers;
 
+namespace
+{
+// The entries of sounds_since_last_turn made in one submap, so a listener can skip all
+// of them at once when even the loudest is out of earshot.
+struct heard_sound_cell {
+    // First tile of the submap
+    tripoint origin;
+    int max_volume = 0;
+};
+} // namespace
+static std::vector<heard_sound_cell> heard_sound_cells;
+static std::unordered_map<tripoint, size_t> heard_sound_cell_index;
+// Cell of each entry of sounds_since_last_turn
+static std::vector<size_t> heard_sound_cell_of;
+
+static void add_heard_sound( const tripoint &p, sound_event &&sound )
+{
+    const tripoint origin( divide_round_down( p.x, SEEX ) * SEEX,
+                           divide_round_down( p.y, SEEY ) * SEEY, p.z );
+    const auto inserted = heard_sound_cell_index.emplace( origin, heard_sound_cells.size() );
+    if( inserted.second ) {
+        heard_sound_cells.push_back( { origin, 0 } );
+    }
+    heard_sound_cell &cell = heard_sound_cells[inserted.first->second];
+    cell.max_volume = std::max( cell.max_volume, sound.volume );
+    heard_sound_cell_of.push_back( inserted.first->second );
+    sounds_since_last_turn.emplace_back( p, std::move( sound ) );
+}
+
+static void clear_heard_sounds()
+{
+    sounds_since_last_turn.clear();
+    heard_sound_cells.clear();
+    heard_sound_cell_index.clear();
+    heard_sound_cell_of.clear();
+}
+
 // This is an attempt to handle attenuation of sound for underground areas.
 // The main issue it addresses is that you can hear activity
 // relatively deep underground while on the surface.
@@ -327,9 +367,8 @@ void sounds::sound( const tripoint &p, int vol, sound_t category, const std::str
     const season_type seas = season_of_year( calendar::turn );
     const std::string seas_str = season_str( seas );
     recent_sounds.emplace_back( p, monster_sound_event{ vol, is_provocative( category ) } );
-    sounds_since_last_turn.emplace_back( p,
-                                         sound_event { vol, category, description, ambient,
-                                                 false, id, variant, seas_str } );
+    add_heard_sound( p, sound_event { vol, category, description, ambient,
+                                      false, id, variant, seas_str } );
 }
 
 void sounds::sound( const tripoint &p, int vol, sound_t category, const translation &description,
@@ -343,8 +382,8 @@ void sounds::add_footstep( const tripoint &p, int volume, int, monster *,
 {
     const season_type seas = season_of_year( calendar::turn );
     const std::string seas_str = season_str( seas );
-    sounds_since_last_turn.emplace_back( p, sound_event { volume,
-                                         sound_t::movement, footstep, false, true, "", "", seas_str} );
+    add_heard_sound( p, sound_event { volume,
+                                      sound_t::movement, footstep, false, true, "", "", seas_str} );
 }
 
 template <typename C>
@@ -474,14 +513,20 @@ void sounds::process_sounds()
             overmap_buffer.signal_hordes( target, sig_power );
         }
         // Alert all monsters (that can hear) to the sound.
-        for( monster &critter : g->all_monsters() ) {
+        // Monsters farther away than this horizontally certainly won't hear it.
+        const int max_dist = vol * 2 - 1;
+        const tripoint_abs_ms abs_source = get_map().getglobal( source );
+        const inclusive_cuboid<tripoint_abs_ms> hearing_area(
+            tripoint_abs_ms( abs_source.xy() - point( max_dist, max_dist ), -OVERMAP_DEPTH ),
+            tripoint_abs_ms( abs_source.xy() + point( max_dist, max_dist ), OVERMAP_HEIGHT ) );
+        get_creature_tracker().for_each_in_rect( hearing_area, [&]( monster & critter ) {
             // TODO: Generalize this to Creature::hear_sound
             const int dist = sound_distance( source, critter.pos() );
             if( vol * 2 > dist ) {
                 // Exclude monsters that certainly won't hear the sound
                 critter.hear_sound( source, vol, dist, this_centroid.provocative );
             }
-        }
+        } );
         // Trigger sound-triggered traps and ensure they are still valid
         for( const trap *trapType : trap::get_sound_triggered_traps() ) {
             for( const tripoint &tp : get_map().trap_locations( trapType->id ) ) {
@@ -552,8 +597,28 @@ void sounds::process_sound_markers( Character *you )
     bool is_deaf = you->is_deaf();
     const float volume_multiplier = you->hearing_ability();
     const int weather_vol = get_weather().weather_id->sound_attn;
+    // Whether each cell of heard_sound_cells is in earshot, filled in as cells are reached
+    std::vector<signed char> cell_in_earshot;
     // NOLINTNEXTLINE(modernize-loop-convert)
     for( std::size_t i = 0; i < sounds_since_last_turn.size(); i++ ) {
+        const size_t cell_idx = heard_sound_cell_of[i];
+        if( cell_idx >= cell_in_earshot.size() ) {
+            cell_in_earshot.resize( heard_sound_cells.size(), -1 );
+        }
+        if( cell_in_earshot[cell_idx] < 0 ) {
+            // Nearest point of the cell, the loudest sound there can't be heard or deafen
+            // beyond this much
+            const heard_sound_cell &cell = heard_sound_cells[cell_idx];
+            const tripoint nearest( clamp( you->posx(), cell.origin.x, cell.origin.x + SEEX - 1 ),
+                                    clamp( you->posy(), cell.origin.y, cell.origin.y + SEEY - 1 ),
+                                    cell.origin.z );
+            const float reach = std::max<float>( cell.max_volume,
+                                                 ( cell.max_volume - weather_vol ) * volume_multiplier );
+            cell_in_earshot[cell_idx] = sound_distance( you->pos(), nearest ) <= reach;
+        }
+        if( !cell_in_earshot[cell_idx] ) {
+            continue;
+        }
         // copy values instead of making references here to fix use-after-free error
         // sounds_since_last_turn may be inserted with new elements inside the loop
         // so the references may become invalid after the vector enlarged its internal buffer
@@ -739,14 +804,14 @@ void sounds::process_sound_markers( Character *you )
         }
     }
     if( you->is_avatar() ) {
-        sounds_since_last_turn.clear();
+        clear_heard_sounds();
     }
 }
 
 void sounds::reset_sounds()
 {
     recent_sounds.clear();
-    sounds_since_last_turn.clear();
+    clear_heard_sounds();
     sound_markers.clear();
 }
 
@@ -1328,13 +1393,35 @@ void sfx::generate_gun_sound( const Character &source_arg, const item &firing )
 
 namespace sfx
 {
-struct sound_thread {
-    sound_thread( const tripoint &source, const tripoint &target, bool hit, bool targ_mon,
-                  const std::string &material );
+namespace
+{
+// Sounds asked for within this long of each other count as one
+constexpr std::chrono::milliseconds sound_dedup_window( 16 );
 
+/** A positional sound for the worker to play once it is due. */
+struct queued_sound {
+    std::chrono::steady_clock::time_point due;
+    std::string id;
+    std::string variant;
+    std::string season;
+    bool indoors = false;
+    bool night = false;
+    int volume = 0;
+    units::angle angle = 0_degrees;
+};
+
+/** A melee swing and its hit, turned into timed @ref queued_sound by the worker. */
+struct melee_sound {
+    melee_sound( const tripoint &source, const tripoint &target, bool hit, bool targ_mon,
+                 const std::string &material );
+
+    std::chrono::steady_clock::time_point requested;
     bool hit;
     bool targ_mon;
     std::string material;
+    std::string season;
+    bool indoors;
+    bool night;
 
     skill_id weapon_skill;
     int weapon_volume;
@@ -1344,11 +1431,163 @@ struct sound_thread {
     int vol_targ;
     units::angle ang_targ;
 
-    // Operator overload required for thread API.
-    void operator()() const;
+    void expand( std::vector<queued_sound> &out ) const;
 };
+
+/**
+ * Plays positional sound effects on one long-lived thread, so a burst of gunfire or melee
+ * hits doesn't start a thread for each of them.
+ *
+ * Requests are only copied into the queue on the calling thread. The worker sleeps until
+ * the next sound is due, and a sound asked for again from the same direction within
+ * @ref sound_dedup_window is played once, at the louder volume.
+ */
+class sound_worker
+{
+    public:
+        ~sound_worker() {
+            stop();
+        }
+
+        void push( melee_sound &&sound );
+        void push( queued_sound &&sound );
+        /** Drops what is still queued and joins the thread. Started again on the next push. */
+        void stop();
+
+    private:
+        // Expects mutex to be held
+        bool start();
+        void add( queued_sound &&sound );
+        void run();
+
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::vector<melee_sound> melee;
+        std::vector<queued_sound> pending;
+        std::thread thread;
+        bool stopping = false;
+};
+
+sound_worker &get_sound_worker()
+{
+    static sound_worker worker;
+    return worker;
+}
+} // namespace
 } // namespace sfx
 
+void sfx::sound_worker::push( melee_sound &&sound )
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        if( !start() ) {
+            return;
+        }
+        melee.push_back( std::move( sound ) );
+    }
+    wake.notify_one();
+}
+
+void sfx::sound_worker::push( queued_sound &&sound )
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        if( !start() ) {
+            return;
+        }
+        add( std::move( sound ) );
+    }
+    wake.notify_one();
+}
+
+void sfx::sound_worker::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        if( !thread.joinable() ) {
+            return;
+        }
+        stopping = true;
+    }
+    wake.notify_one();
+    thread.join();
+    std::lock_guard<std::mutex> lock( mutex );
+    stopping = false;
+    melee.clear();
+    pending.clear();
+}
+
+bool sfx::sound_worker::start()
+{
+    if( thread.joinable() ) {
+        return true;
+    }
+    try {
+        thread = std::thread( &sound_worker::run, this );
+    } catch( std::system_error &err ) {
+        // not a big deal, just skip playing the sound.
+        dbg( D_ERROR ) << "Failed to create sound thread: std::system_error: " << err.what();
+        return false;
+    }
+    return true;
+}
+
+void sfx::sound_worker::add( queued_sound &&sound )
+{
+    for( queued_sound &other : pending ) {
+        if( other.id == sound.id && other.variant == sound.variant && other.angle == sound.angle &&
+            other.due - sound.due < sound_dedup_window &&
+            sound.due - other.due < sound_dedup_window ) {
+            other.volume = std::max( other.volume, sound.volume );
+            return;
+        }
+    }
+    pending.push_back( std::move( sound ) );
+}
+
+void sfx::sound_worker::run()
+{
+    // Pitch and delay rolls come from a stream of this thread's own, the game's rolls are
+    // left alone
+    const rng_stream_scope rng_scope( static_cast<unsigned int>(
+                                          std::chrono::steady_clock::now().time_since_epoch().count() ) );
+    std::vector<queued_sound> expanded;
+    std::unique_lock<std::mutex> lock( mutex );
+    while( !stopping ) {
+        for( const melee_sound &sound : melee ) {
+            sound.expand( expanded );
+        }
+        melee.clear();
+        for( queued_sound &sound : expanded ) {
+            add( std::move( sound ) );
+        }
+        expanded.clear();
+        if( pending.empty() ) {
+            wake.wait( lock );
+            continue;
+        }
+        const auto next = std::min_element( pending.begin(), pending.end(),
+        []( const queued_sound & lhs, const queued_sound & rhs ) {
+            return lhs.due < rhs.due;
+        } );
+        if( next->due > std::chrono::steady_clock::now() ) {
+            wake.wait_until( lock, next->due );
+            continue;
+        }
+        const queued_sound sound = std::move( *next );
+        pending.erase( next );
+        lock.unlock();
+        play_variant_sound( sound.id, sound.variant, sound.season, sound.indoors, sound.night,
+                            sound.volume, sound.angle, 0.8, 1.2 );
+        lock.lock();
+    }
+}
+
+void sfx::stop_sound_worker()
+{
+    get_sound_worker().stop();
+}
+
 void sfx::generate_melee_sound( const tripoint &source, const tripoint &target, bool hit,
                                 bool targ_mon,
                                 const std::string &material )
@@ -1356,29 +1595,18 @@ void sfx::generate_melee_sound( const tripoint &source, const tripoint &target,
     if( test_mode ) {
         return;
     }
-    // If creating a new thread for each invocation is to much, we have to consider a thread
-    // pool or maybe a single thread that works continuously, but that requires a queue or similar
-    // to coordinate its work.
-    try {
-        std::thread the_thread( sound_thread( source, target, hit, targ_mon, material ) );
-        try {
-            if( the_thread.joinable() ) {
-                the_thread.detach();
-            }
-        } catch( std::system_error &err ) {
-            dbg( D_ERROR ) << "Failed to detach melee sound thread: std::system_error: " << err.what();
-        }
-    } catch( std::system_error &err ) {
-        // not a big deal, just skip playing the sound.
-        dbg( D_ERROR ) << "Failed to create melee sound thread: std::system_error: " << err.what();
-    }
+    get_sound_worker().push( melee_sound( source, target, hit, targ_mon, material ) );
 }
 
-sfx::sound_thread::sound_thread( const tripoint &source, const tripoint &target, const bool hit,
-                                 const bool targ_mon, const std::string &material )
-    : hit( hit )
+sfx::melee_sound::melee_sound( const tripoint &source, const tripoint &target, const bool hit,
+                               const bool targ_mon, const std::string &material )
+    : requested( std::chrono::steady_clock::now() )
+    , hit( hit )
     , targ_mon( targ_mon )
     , material( material )
+    , season( season_str( season_of_year( calendar::turn ) ) )
+    , indoors( !is_creature_outside( get_player_character() ) )
+    , night( is_night( calendar::turn ) )
 {
     // This is function is run in the main thread.
     const int heard_volume = get_heard_volume( source );
@@ -1401,60 +1629,44 @@ sfx::sound_thread::sound_thread( const tripoint &source, const tripoint &target,
     weapon_volume = weapon ? weapon->volume() / units::legacy_volume_factor : 0;
 }
 
-// Operator overload required for thread API.
-void sfx::sound_thread::operator()() const
+void sfx::melee_sound::expand( std::vector<queued_sound> &out ) const
 {
-    // This is function is run in a separate thread. One must be careful and not access game data
-    // that might change (e.g. g->u.weapon, the character could switch weapons while this thread
-    // runs).
-    std::this_thread::sleep_for( std::chrono::milliseconds( rng( 1, 2 ) ) );
+    // This function is run in the sound thread. It must only use what the constructor
+    // copied, game data may change while it runs.
+    const auto make = [this]( const std::chrono::steady_clock::time_point due,
+    const std::string & id, const std::string & variant, int volume, units::angle angle ) {
+        return queued_sound{ due, id, variant, season, indoors, night, volume, angle };
+    };
     std::string variant_used;
-    const season_type seas = season_of_year( calendar::turn );
-    const std::string seas_str = season_str( seas );
-    const bool indoors = !is_creature_outside( get_player_character() );
-    const bool night = is_night( calendar::turn );
-
     if( weapon_skill == skill_bashing && weapon_volume <= 8 ) {
         variant_used = "small_bash";
-        play_variant_sound( "melee_swing", "small_bash", seas_str, indoors, night,
-                            vol_src, ang_src, 0.8, 1.2 );
     } else if( weapon_skill == skill_bashing && weapon_volume >= 9 ) {
         variant_used = "big_bash";
-        play_variant_sound( "melee_swing", "big_bash", seas_str, indoors, night,
-                            vol_src, ang_src, 0.8, 1.2 );
     } else if( ( weapon_skill == skill_cutting || weapon_skill == skill_stabbing ) &&
                weapon_volume <= 6 ) {
         variant_used = "small_cutting";
-        play_variant_sound( "melee_swing", "small_cutting", seas_str, indoors, night,
-                            vol_src, ang_src, 0.8, 1.2 );
     } else if( ( weapon_skill == skill_cutting || weapon_skill == skill_stabbing ) &&
                weapon_volume >= 7 ) {
         variant_used = "big_cutting";
-        play_variant_sound( "melee_swing", "big_cutting", seas_str, indoors, night,
-                            vol_src, ang_src, 0.8, 1.2 );
     } else {
         variant_used = "default";
-        play_variant_sound( "melee_swing", "default", seas_str, indoors, night,
-                            vol_src, ang_src, 0.8, 1.2 );
     }
+    const std::chrono::steady_clock::time_point swing = requested +
+            std::chrono::milliseconds( rng( 1, 2 ) );
+    out.push_back( make( swing, "melee_swing", variant_used, vol_src, ang_src ) );
     if( hit ) {
         if( targ_mon ) {
+            const std::chrono::steady_clock::time_point impact = swing +
+                    std::chrono::milliseconds( rng( weapon_volume * 12, weapon_volume * 16 ) );
             if( material == "steel" ) {
-                std::this_thread::sleep_for( std::chrono::milliseconds( rng( weapon_volume * 12,
-                                             weapon_volume * 16 ) ) );
-                play_variant_sound( "melee_hit_metal", variant_used, seas_str, indoors,
-                                    night, vol_targ, ang_targ, 0.8, 1.2 );
+                out.push_back( make( impact, "melee_hit_metal", variant_used, vol_targ, ang_targ ) );
             } else {
-                std::this_thread::sleep_for( std::chrono::milliseconds( rng( weapon_volume * 12,
-                                             weapon_volume * 16 ) ) );
-                play_variant_sound( "melee_hit_flesh", variant_used, seas_str, indoors,
-                                    night, vol_targ, ang_targ, 0.8, 1.2 );
+                out.push_back( make( impact, "melee_hit_flesh", variant_used, vol_targ, ang_targ ) );
             }
         } else {
-            std::this_thread::sleep_for( std::chrono::milliseconds( rng( weapon_volume * 9,
-                                         weapon_volume * 12 ) ) );
-            play_variant_sound( "melee_hit_flesh", variant_used, seas_str, indoors,
-                                night, vol_targ, ang_targ, 0.8, 1.2 );
+            const std::chrono::steady_clock::time_point impact = swing +
+                    std::chrono::milliseconds( rng( weapon_volume * 9, weapon_volume * 12 ) );
+            out.push_back( make( impact, "melee_hit_flesh", variant_used, vol_targ, ang_targ ) );
         }
     }
 }
@@ -1465,12 +1677,15 @@ void sfx::do_projectile_hit( const Creature &target )
         return;
     }
 
-    const int heard_volume = sfx::get_heard_volume( target.pos() );
-    const units::angle angle = get_heard_angle( target.pos() );
-    const season_type seas = season_of_year( calendar::turn );
-    const std::string seas_str = season_str( seas );
-    const bool indoors = !is_creature_outside( get_player_character() );
-    const bool night = is_night( calendar::turn );
+    queued_sound sound;
+    sound.due = std::chrono::steady_clock::now();
+    sound.id = "bullet_hit";
+    sound.variant = "hit_flesh";
+    sound.season = season_str( season_of_year( calendar::turn ) );
+    sound.indoors = !is_creature_outside( get_player_character() );
+    sound.night = is_night( calendar::turn );
+    sound.volume = sfx::get_heard_volume( target.pos() );
+    sound.angle = get_heard_angle( target.pos() );
     if( target.is_monster() ) {
         const monster &mon = dynamic_cast<const monster &>( target );
         static const std::set<material_id> fleshy = {
@@ -1485,21 +1700,12 @@ void sfx::do_projectile_hit( const Creature &target )
         } );
 
         if( !is_fleshy && mon.made_of( material_stone ) ) {
-            play_variant_sound( "bullet_hit", "hit_wall", seas_str, indoors, night,
-                                heard_volume, angle, 0.8, 1.2 );
-            return;
+            sound.variant = "hit_wall";
         } else if( !is_fleshy && mon.made_of( material_steel ) ) {
-            play_variant_sound( "bullet_hit", "hit_metal", seas_str, indoors, night,
-                                heard_volume, angle, 0.8, 1.2 );
-            return;
-        } else {
-            play_variant_sound( "bullet_hit", "hit_flesh", seas_str, indoors, night,
-                                heard_volume, angle, 0.8, 1.2 );
-            return;
+            sound.variant = "hit_metal";
         }
     }
-    play_variant_sound( "bullet_hit", "hit_flesh", seas_str, indoors, night,
-                        heard_volume, angle, 0.8, 1.2 );
+    get_sound_worker().push( std::move( sound ) );
 }
 
 void sfx::do_player_death_hurt( const Character &target, bool death )
@@ -1970,6 +2176,7 @@ void sfx::generate_melee_sound( const tripoint &, const tripoint &, bool, bool,
 void sfx::do_hearing_loss( int ) { }
 void sfx::remove_hearing_loss() { }
 void sfx::do_projectile_hit( const Creature & ) { }
+void sfx::stop_sound_worker() { }
 void sfx::do_footstep() { }
 void sfx::do_danger_music() { }
 void sfx::do_vehicle_engine_sfx() { }
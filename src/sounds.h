@@ -164,6 +164,8 @@ void generate_melee_sound( const tripoint &source, const tripoint &target, bool
 void do_hearing_loss( int turns = -1 );
 void remove_hearing_loss();
 void do_projectile_hit( const Creature &target );
+/** Stops the thread playing melee and projectile hit sounds, before the mixer is closed. */
+void stop_sound_worker();
 int get_heard_volume( const tripoint &source );
 units::angle get_heard_angle( const tripoint &source );
 void do_footstep();
@@ -0,0 +1,136 @@
+#pragma once
+#ifndef CATA_SRC_SPARSE_TILE_LAYER_H
+#define CATA_SRC_SPARSE_TILE_LAYER_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "game_constants.h"
+#include "point.h"
+
+/**
+ * One value for each tile of a submap, for data that nearly always holds the same value
+ * everywhere (no trap, no radiation, no light).
+ *
+ * The tiles holding another value are kept in a small vector sorted by tile. Once more
+ * than @ref max_sparse tiles are set, the layer switches to a dense array so lookups stay
+ * cheap, and it stays dense until the next @ref fill.
+ */
+template<typename T>
+class sparse_tile_layer
+{
+    private:
+        static constexpr size_t elements = SEEX * SEEY;
+        static_assert( elements <= 256, "tile index must fit in a uint8_t" );
+
+        using dense_type = std::array<T, elements>;
+        using entry = std::pair<std::uint8_t, T>;
+
+    public:
+        static constexpr size_t max_sparse = elements / 8;
+
+        sparse_tile_layer() = default;
+        sparse_tile_layer( const sparse_tile_layer &other ) :
+            sparse_( other.sparse_ ),
+            dense_( other.dense_ ? std::make_unique<dense_type>( *other.dense_ ) : nullptr ),
+            fill_( other.fill_ ) {}
+        sparse_tile_layer( sparse_tile_layer && ) noexcept = default;
+        sparse_tile_layer &operator=( const sparse_tile_layer &other ) {
+            if( this != &other ) {
+                *this = sparse_tile_layer( other );
+            }
+            return *this;
+        }
+        sparse_tile_layer &operator=( sparse_tile_layer && ) noexcept = default;
+
+        T get( const point &p ) const {
+            const std::uint8_t idx = index( p );
+            if( dense_ ) {
+                return ( *dense_ )[idx];
+            }
+            const auto it = find( idx );
+            return it != sparse_.end() && it->first == idx ? it->second : fill_;
+        }
+
+        void set( const point &p, const T &value ) {
+            const std::uint8_t idx = index( p );
+            if( dense_ ) {
+                ( *dense_ )[idx] = value;
+                return;
+            }
+            const auto it = find( idx );
+            if( it != sparse_.end() && it->first == idx ) {
+                if( value == fill_ ) {
+                    sparse_.erase( it );
+                } else {
+                    it->second = value;
+                }
+            } else if( value != fill_ ) {
+                if( sparse_.size() < max_sparse ) {
+                    sparse_.insert( it, entry( idx, value ) );
+                } else {
+                    make_dense();
+                    ( *dense_ )[idx] = value;
+                }
+            }
+        }
+
+        /** Sets every tile to @p value and goes back to the sparse form. */
+        void fill( const T &value ) {
+            fill_ = value;
+            sparse_.clear();
+            sparse_.shrink_to_fit();
+            dense_.reset();
+        }
+
+        void swap_tiles( const point &p1, const point &p2 ) {
+            const T first = get( p1 );
+            set( p1, get( p2 ) );
+            set( p2, first );
+        }
+
+        bool is_dense() const {
+            return static_cast<bool>( dense_ );
+        }
+
+        /** Heap memory held, in bytes. */
+        size_t memory_usage() const {
+            return sparse_.capacity() * sizeof( entry ) + ( dense_ ? sizeof( dense_type ) : 0 );
+        }
+
+    private:
+        static std::uint8_t index( const point &p ) {
+            return static_cast<std::uint8_t>( p.x * SEEY + p.y );
+        }
+
+        typename std::vector<entry>::iterator find( std::uint8_t idx ) {
+            return std::lower_bound( sparse_.begin(), sparse_.end(), idx, compare_index );
+        }
+        typename std::vector<entry>::const_iterator find( std::uint8_t idx ) const {
+            return std::lower_bound( sparse_.begin(), sparse_.end(), idx, compare_index );
+        }
+        static bool compare_index( const entry &e, std::uint8_t idx ) {
+            return e.first < idx;
+        }
+
+        void make_dense() {
+            dense_ = std::make_unique<dense_type>();
+            dense_->fill( fill_ );
+            for( const entry &e : sparse_ ) {
+                ( *dense_ )[e.first] = e.second;
+            }
+            sparse_.clear();
+            sparse_.shrink_to_fit();
+        }
+
+        std::vector<entry> sparse_;
+        std::unique_ptr<dense_type> dense_;
+        T fill_ = T();
+};
+
+#endif // CATA_SRC_SPARSE_TILE_LAYER_H
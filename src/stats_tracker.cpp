@@ -83,15 +83,6 @@ void event_multiset::set_type( event_type type )
     type_ = type;
 }
 
-int event_multiset::count() const
-{
-    int total = 0;
-    for( const auto &pair : summaries_ ) {
-        total += pair.second.count;
-    }
-    return total;
-}
-
 int event_multiset::count( const cata::event::data_type &criteria ) const
 {
     int total = 0;
@@ -186,11 +177,13 @@ std::optional<event_multiset::summaries_type::value_type> event_multiset::last()
 void event_multiset::add( const cata::event &e )
 {
     summaries_[e.data()].add( e );
+    ++count_;
 }
 
 void event_multiset::add( const summaries_type::value_type &e )
 {
     summaries_[e.first].add( e.second );
+    count_ += e.second.count;
 }
 
 base_watcher::~base_watcher()
@@ -237,11 +230,22 @@ event_multiset &stats_tracker::get_events( event_type type )
 event_multiset stats_tracker::get_events(
     const string_id<event_transformation> &transform_id )
 {
+    // A watched transformation is kept up to date as events arrive, so
+    // there is no need to transform the whole source again.
+    auto it = event_transformation_states.find( transform_id );
+    if( it != event_transformation_states.end() ) {
+        return static_cast<const stats_tracker_multiset_state &>( *it->second ).get_events();
+    }
     return transform_id->value( *this );
 }
 
 cata_variant stats_tracker::value_of( const string_id<event_statistic> &stat )
 {
+    // Likewise for watched statistics
+    auto it = stat_states.find( stat );
+    if( it != stat_states.end() ) {
+        return it->second->get_value();
+    }
     return stat->value( *this );
 }
 
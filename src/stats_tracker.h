@@ -85,7 +85,11 @@ class event_multiset
         // some values that must be matched in the events of that type.  You can
         // provide just a subset of the relevant keys from the event_type in
         // your criteria.
-        int count() const;
+        // count() with no criteria is kept as a running total, so it does not
+        // scan the partitions.
+        int count() const {
+            return count_;
+        }
         int count( const cata::event::data_type &criteria ) const;
         int total( const std::string &field ) const;
         int total( const std::string &field, const cata::event::data_type &criteria ) const;
@@ -102,6 +106,8 @@ class event_multiset
     private:
         event_type type_; // NOLINT(cata-serialize)
         summaries_type summaries_;
+        // Sum of the counts in summaries_; recomputed on deserialization
+        int count_ = 0; // NOLINT(cata-serialize)
 };
 
 class base_watcher
@@ -182,6 +188,7 @@ class stats_tracker_multiset_state : public stats_tracker_state
 {
     public:
         [[noreturn]] const cata_variant &get_value() const override;
+        virtual const event_multiset &get_events() const = 0;
 };
 
 class stats_tracker : public event_subscriber
@@ -2,6 +2,8 @@
 #ifndef CATA_SRC_STRING_FORMATTER_H
 #define CATA_SRC_STRING_FORMATTER_H
 
+#include <array>
+#include <charconv>
 #include <cstddef>
 #include <iosfwd>
 #include <new>
@@ -277,16 +279,35 @@ class string_formatter
             }
             const char c = consume_next_input();
             current_format.push_back( c );
+            // Without flags, width and precision the most common conversions don't need printf
+            const bool plain = current_format.size() == 2;
             switch( c ) {
                 case 'c':
+                    if( plain ) {
+                        const int value = get_nth_arg_as<int, 0>( format_arg_index,
+                                          std::forward<Args>( args )... );
+                        output.push_back( static_cast<char>( value ) );
+                        return;
+                    }
                     return do_formatting( get_nth_arg_as<int, 0>( format_arg_index, std::forward<Args>( args )... ) );
                 case 'd':
                 case 'i':
+                    if( plain ) {
+                        return append_integer( get_nth_arg_as<signed long long int, 0>(
+                                               format_arg_index, std::forward<Args>( args )... ) );
+                    }
                     add_long_long_length_modifier();
                     return do_formatting( get_nth_arg_as<signed long long int, 0>( format_arg_index,
                                           std::forward<Args>( args )... ) );
-                case 'o':
                 case 'u':
+                    if( plain ) {
+                        return append_integer( get_nth_arg_as<unsigned long long int, 0>(
+                                               format_arg_index, std::forward<Args>( args )... ) );
+                    }
+                    add_long_long_length_modifier();
+                    return do_formatting( get_nth_arg_as<unsigned long long int, 0>(
+                                              format_arg_index, std::forward<Args>( args )... ) );
+                case 'o':
                 case 'x':
                 case 'X':
                     add_long_long_length_modifier();
@@ -305,9 +326,15 @@ class string_formatter
                 case 'p':
                     return do_formatting( get_nth_arg_as<void *, 0>( format_arg_index,
                                           std::forward<Args>( args )... ) );
-                case 's':
-                    return do_formatting( get_nth_arg_as<const char *, 0>( format_arg_index,
-                                          std::forward<Args>( args )... ) );
+                case 's': {
+                    const char *const text = get_nth_arg_as<const char *, 0>( format_arg_index,
+                                             std::forward<Args>( args )... );
+                    if( plain && text != nullptr ) {
+                        output.append( text );
+                        return;
+                    }
+                    return do_formatting( text );
+                }
                 default:
                     throw_error( "Unsupported format conversion: " + std::string( 1, c ) );
             }
@@ -318,6 +345,15 @@ class string_formatter
             output.append( raw_string_format( current_format.c_str(), value ) );
         }
 
+        // Same as "%lld" / "%llu", which don't depend on the locale either
+        template<typename T>
+        void append_integer( const T value ) {
+            std::array<char, 24> buf;
+            const std::to_chars_result res = std::to_chars( buf.data(), buf.data() + buf.size(),
+                                             value );
+            output.append( buf.data(), res.ptr );
+        }
+
     public:
         /// @param format The format string as required by `sprintf`.
         explicit string_formatter( std::string_view format ) : format( format ) { }
@@ -330,8 +366,13 @@ class string_formatter
         /// Note: @ref string_format is a wrapper that handles those exceptions.
         template<typename ...Args>
         void parse( Args &&... args ) {
-            output.reserve( format.size() );
             output.resize( 0 );
+            append( std::forward<Args>( args )... );
+        }
+        /// Like @ref parse, but keeps what is already in the output and appends to it.
+        template<typename ...Args>
+        void append( Args &&... args ) {
+            output.reserve( output.size() + format.size() );
             current_index_in_format = 0;
             current_argument_index = 0;
             while( const char c = consume_next_input() ) {
@@ -361,6 +402,15 @@ class string_formatter
         std::string get_output() const {
             return output;
         }
+        /// Moves the formatted string out, leaving the output empty.
+        std::string take_output() {
+            return std::move( output );
+        }
+        /// Exchanges the output with @p other, so that @ref append can write into a string
+        /// owned by someone else.
+        void swap_output( std::string &other ) {
+            output.swap( other );
+        }
 #if defined(__clang__)
 #define PRINTF_LIKE(a,b) __attribute__((format(printf,a,b)))
 #elif defined(__GNUC__)
@@ -419,7 +469,7 @@ inline std::string string_format( std::string_view format, Args &&...args )
     try {
         cata::string_formatter formatter( format );
         formatter.parse( std::forward<Args>( args )... );
-        return formatter.get_output();
+        return formatter.take_output();
     } catch( ... ) {
         return cata::handle_string_format_error();
     }
@@ -432,4 +482,25 @@ string_format( T &&format, Args &&...args )
 }
 /**@}*/
 
+/**
+ * Same as @ref string_format, but appends the result to @p out instead of returning a new
+ * string, so building text piece by piece can reuse the memory of @p out.
+ * On error, the error string is appended instead.
+ */
+template<typename ...Args>
+inline void append_format( std::string &out, std::string_view format, Args &&...args )
+{
+    const size_t old_size = out.size();
+    cata::string_formatter formatter( format );
+    formatter.swap_output( out );
+    try {
+        formatter.append( std::forward<Args>( args )... );
+        formatter.swap_output( out );
+    } catch( ... ) {
+        formatter.swap_output( out );
+        out.resize( old_size );
+        out += cata::handle_string_format_error();
+    }
+}
+
 #endif // CATA_SRC_STRING_FORMATTER_H
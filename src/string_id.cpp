@@ -1,58 +1,67 @@
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
 #include <unordered_map>
-#include <vector>
+
 #include "string_id.h"
 
 namespace
 {
-using InternMapType = std::unordered_map<std::string, int>;
-using ReverseLookupVecType = std::vector<const std::string *>;
-} // namespace
+// Interned strings live in fixed-size chunks that are never reallocated, so a string's
+// address stays valid for the whole run and readers need no lock.
+constexpr int chunk_bits = 12;
+constexpr int chunk_size = 1 << chunk_bits;
+constexpr int max_chunks = 1 << 12;
 
-static InternMapType &get_intern_map()
-{
-    static InternMapType map{};
-    return map;
-}
+struct intern_storage {
+    std::array<std::atomic<std::string *>, max_chunks> chunks{};
+    // Owns the chunks, only touched when interning
+    std::array<std::unique_ptr<std::string[]>, max_chunks> owned;
+    int size = 0;
+    // Keys view the strings held in the chunks
+    std::unordered_map<std::string_view, int> ids;
+};
+} // namespace
 
-static ReverseLookupVecType &get_reverse_lookup_vec()
+static intern_storage &get_storage()
 {
-    static ReverseLookupVecType vec{};
-    return vec;
+    static intern_storage storage;
+    return storage;
 }
 
-template<typename S>
-static int universal_string_id_intern( S &&s )
+int string_identity_static::string_id_intern( const std::string_view s )
 {
-    int next_id = get_reverse_lookup_vec().size();
-    const auto &pair = get_intern_map().emplace( std::forward<S>( s ), next_id );
-    if( pair.second ) { // inserted
-        get_reverse_lookup_vec().push_back( &pair.first->first );
+    intern_storage &storage = get_storage();
+    const auto iter = storage.ids.find( s );
+    if( iter != storage.ids.end() ) {
+        return iter->second;
     }
-    return pair.first->second;
-}
-
-int string_identity_static::string_id_intern( const std::string &s )
-{
-    return universal_string_id_intern( s );
-}
-
-int string_identity_static::string_id_intern( std::string &s )
-{
-    return universal_string_id_intern( s );
-}
-
-int string_identity_static::string_id_intern( std::string &&s )
-{
-    return universal_string_id_intern( std::move( s ) );
+    const int id = storage.size;
+    const int chunk = id >> chunk_bits;
+    if( chunk >= max_chunks ) {
+        std::abort();
+    }
+    if( !storage.owned[chunk] ) {
+        storage.owned[chunk] = std::make_unique<std::string[]>( chunk_size );
+        storage.chunks[chunk].store( storage.owned[chunk].get(), std::memory_order_release );
+    }
+    std::string &slot = storage.owned[chunk][id & ( chunk_size - 1 )];
+    slot = std::string( s );
+    storage.ids.emplace( slot, id );
+    ++storage.size;
+    return id;
 }
 
 const std::string &string_identity_static::get_interned_string( int id )
 {
-    return *get_reverse_lookup_vec()[id];
+    const std::string *chunk = get_storage().chunks[id >> chunk_bits].load(
+                                   std::memory_order_acquire );
+    return chunk[id & ( chunk_size - 1 )];
 }
 
 int string_identity_static::empty_interned_string()
 {
-    static int empty_string_id = string_id_intern( "" );
+    static int empty_string_id = string_id_intern( std::string_view() );
     return empty_string_id;
 }
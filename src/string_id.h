@@ -7,6 +7,7 @@
 #include <functional>
 #include <iosfwd>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 constexpr int64_t INVALID_VERSION = -1;
@@ -61,7 +62,8 @@ struct lexicographic;
  *
  * `string_id` is a bit slower than int_id, but it's safe to use the same instance between game reloads.
  *    That means that string_id can be static (and should be for maximal performance).
- *    Comparison of string ids is relatively slow (same as std::string comparison).
+ *    Comparison of interned string ids is an int comparison, building one from a string costs
+ *    a single hash lookup in the intern table.
  *    for newly created string_id (i.e. inline constant or local variable), first method invocation:
  *     `::id` call is relatively slow (string hash map lookup)
  *     `::obj` lookup is slow (string hash map lookup + array read)
@@ -110,6 +112,9 @@ template<> struct string_id_params<Trait_group> {
 /**
  * "static" here means std::string inside is interned.
  * Can be used only if all string_id values are fixed in number and not generated dynamically.
+ *
+ * Interned strings never move once added, so @ref str may be called from worker threads
+ * without locking while the main thread interns new ids. Interning itself is main thread only.
  */
 class string_identity_static
 {
@@ -130,7 +135,14 @@ class string_identity_static
 
         template<typename S, class = std::enable_if_t<std::is_convertible_v<S, std::string>>>
                  explicit string_identity_static( S && id )
-                     : _id( string_id_intern( std::forward<S>( id ) ) )
+                     : _id( intern_any( std::forward<S>( id ) ) )
+#ifdef CATA_STRING_ID_DEBUGGING
+            , _string_id( str().c_str() )
+#endif
+        {}
+
+        explicit string_identity_static( const std::string_view id )
+            : _id( string_id_intern( id ) )
 #ifdef CATA_STRING_ID_DEBUGGING
             , _string_id( str().c_str() )
 #endif
@@ -144,10 +156,18 @@ class string_identity_static
             return _id == empty_interned_string();
         }
 
+        // Literals and std::strings are looked up in place, without building a new std::string
+        template<typename S>
+        static int intern_any( S &&id ) {
+            if constexpr( std::is_convertible_v<S, std::string_view> ) {
+                return string_id_intern( std::string_view( id ) );
+            } else {
+                return string_id_intern( std::string( std::forward<S>( id ) ) );
+            }
+        }
+
         /** Returns unique int identifier for this string */
-        static int string_id_intern( std::string &&s );
-        static int string_id_intern( std::string &s );
-        static int string_id_intern( const std::string &s );
+        static int string_id_intern( std::string_view s );
 
         /** Returns string by its unique identifier */
         static const std::string &get_interned_string( int id );
@@ -178,6 +198,8 @@ class string_identity_dynamic
         template<typename S, class = std::enable_if_t<std::is_convertible_v<S, std::string>>>
                  explicit string_identity_dynamic( S && id ) : _id( std::forward<S>( id ) )  {}
 
+        explicit string_identity_dynamic( const std::string_view id ) : _id( id ) {}
+
         inline const std::string &str() const {
             return _id;
         }
@@ -217,7 +239,7 @@ public:
 
     // string_view is not implicitly convertible to std::string, so need a
     // separate constructor for that
-    explicit string_id( const std::string_view id ) : string_id( std::string( id ) ) {}
+    explicit string_id( const std::string_view id ) : _id( id ) {}
     /**
      * Default constructor constructs an empty id string.
      * Note that this id class does not enforce empty id strings (or any specific string at all)
@@ -19,11 +19,16 @@ void maptile_soa::swap_soa_tile( const point &p1, const point &p2 )
 {
     std::swap( ter[p1.x][p1.y], ter[p2.x][p2.y] );
     std::swap( frn[p1.x][p1.y], frn[p2.x][p2.y] );
-    std::swap( lum[p1.x][p1.y], lum[p2.x][p2.y] );
+    lum.swap_tiles( p1, p2 );
     std::swap( itm[p1.x][p1.y], itm[p2.x][p2.y] );
     std::swap( fld[p1.x][p1.y], fld[p2.x][p2.y] );
-    std::swap( trp[p1.x][p1.y], trp[p2.x][p2.y] );
-    std::swap( rad[p1.x][p1.y], rad[p2.x][p2.y] );
+    trp.swap_tiles( p1, p2 );
+    rad.swap_tiles( p1, p2 );
+}
+
+size_t maptile_soa::memory_usage() const
+{
+    return lum.memory_usage() + trp.memory_usage() + rad.memory_usage();
 }
 
 submap::submap( submap && ) noexcept( map_is_noexcept ) = default;
@@ -225,6 +230,11 @@ void submap::rotate( int turns )
         return;
     }
     turns = turns % 4;
+    ++display_version;
+    // Fields move along with their tiles, so any tile may hold one afterwards.
+    if( field_count > 0 ) {
+        field_tiles.set();
+    }
 
     if( turns == 0 ) {
         return;
@@ -301,6 +311,10 @@ void submap::mirror( bool horizontally )
     if( is_uniform() ) {
         return;
     }
+    ++display_version;
+    if( field_count > 0 ) {
+        field_tiles.set();
+    }
     std::map<point, computer> mirror_comp;
 
     if( horizontally ) {
@@ -343,6 +357,7 @@ void submap::mirror( bool horizontally )
 void submap::revert_submap( submap &sr )
 {
     reverted = true;
+    pristine = false;
     if( sr.is_uniform() ) {
         m.reset();
         set_all_ter( sr.get_ter( point_zero ), true );
@@ -355,7 +370,7 @@ void submap::revert_submap( submap &sr )
             point pt( x, y );
             m->frn[x][y] = sr.get_furn( pt );
             m->ter[x][y] = sr.get_ter( pt );
-            m->trp[x][y] = sr.get_trap( pt );
+            m->trp.set( pt, sr.get_trap( pt ) );
             m->itm[x][y] = sr.get_items( pt );
             for( item &itm : m->itm[x][y] ) {
                 if( itm.is_emissive() ) {
@@ -378,13 +393,44 @@ submap submap::get_revert_submap() const
     return ret;
 }
 
+bool submap::compact()
+{
+    if( is_uniform() || field_count > 0 || legacy_computer || !computers.empty() ||
+        !cosmetics.empty() || !active_items.empty() || !vehicles.empty() ||
+        !partial_constructions.empty() || camp ) {
+        return false;
+    }
+    const ter_id ter = m->ter[0][0];
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            const point p( x, y );
+            if( m->ter[x][y] != ter || m->frn[x][y] != f_null || m->trp.get( p ) != tr_null ||
+                m->rad.get( p ) != 0 || m->lum.get( p ) != 0 || !m->itm[x][y].empty() ) {
+                return false;
+            }
+        }
+    }
+    for( const auto &elem : ephemeral_data ) {
+        if( elem.second.damage != 0 ) {
+            return false;
+        }
+    }
+    ephemeral_data.clear();
+    m.reset();
+    uniform_ter = ter;
+    compacted = true;
+    return true;
+}
+
 void submap::update_lum_rem( const point &p, const item &i )
 {
     ensure_nonuniform();
     if( !i.is_emissive() ) {
         return;
-    } else if( m->lum[p.x][p.y] && m->lum[p.x][p.y] < 255 ) {
-        m->lum[p.x][p.y]--;
+    }
+    const uint8_t lum = m->lum.get( p );
+    if( lum && lum < 255 ) {
+        m->lum.set( p, lum - 1 );
         return;
     }
 
@@ -398,6 +444,6 @@ void submap::update_lum_rem( const point &p, const item &i )
     }
 
     if( count <= 256 ) {
-        m->lum[p.x][p.y] = static_cast<uint8_t>( count - 1 );
+        m->lum.set( p, static_cast<uint8_t>( count - 1 ) );
     }
 }
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_SUBMAP_H
 #define CATA_SRC_SUBMAP_H
 
+#include <bitset>
 #include <cstddef>
 #include <cstdint>
 #include <iosfwd>
@@ -26,6 +27,7 @@
 #include "mapgen.h"
 #include "mdarray.h"
 #include "point.h"
+#include "sparse_tile_layer.h"
 #include "trap.h"
 #include "type_id.h"
 #include "vehicle.h"
@@ -57,13 +59,15 @@ struct spawn_point {
 struct maptile_soa {
     cata::mdarray<ter_id, point_sm_ms>             ter; // Terrain on each square
     cata::mdarray<furn_id, point_sm_ms>            frn; // Furniture on each square
-    cata::mdarray<std::uint8_t, point_sm_ms>       lum; // Num items emitting light on each square
+    sparse_tile_layer<std::uint8_t>                lum; // Num items emitting light on each square
     cata::mdarray<cata::colony<item>, point_sm_ms> itm; // Items on each square
     cata::mdarray<field, point_sm_ms>              fld; // Field on each square
-    cata::mdarray<trap_id, point_sm_ms>            trp; // Trap on each square
-    cata::mdarray<int, point_sm_ms>                rad; // Irradiation of each square
+    sparse_tile_layer<trap_id>                     trp; // Trap on each square
+    sparse_tile_layer<int>                         rad; // Irradiation of each square
 
     void swap_soa_tile( const point &p1, const point &p2 );
+    /** Heap memory held by the sparse layers, in bytes. */
+    size_t memory_usage() const;
 };
 
 class submap
@@ -80,31 +84,47 @@ class submap
                 m = std::make_unique<maptile_soa>();
                 std::uninitialized_fill_n( &m->ter[0][0], elements, uniform_ter );
                 std::uninitialized_fill_n( &m->frn[0][0], elements, f_null );
-                std::uninitialized_fill_n( &m->lum[0][0], elements, 0 );
-                std::uninitialized_fill_n( &m->trp[0][0], elements, tr_null );
-                std::uninitialized_fill_n( &m->rad[0][0], elements, 0 );
+                m->lum.fill( 0 );
+                m->trp.fill( tr_null );
+                m->rad.fill( 0 );
             }
         }
 
+        /** Bytes held by the tile arrays, none for a uniform submap. */
+        size_t tile_memory_usage() const {
+            return is_uniform() ? 0 : sizeof( maptile_soa ) + m->memory_usage();
+        }
+
         void revert_submap( submap &sr );
 
+        /**
+         * Drops the tile arrays if every tile holds the same terrain and nothing else, so
+         * the submap takes the memory of a uniform one. Used on freshly generated and loaded
+         * submaps, most of the open wilderness ends up like this.
+         * @return whether the submap was made uniform
+         */
+        bool compact();
+
         submap get_revert_submap() const;
 
         trap_id get_trap( const point &p ) const {
             if( is_uniform() ) {
                 return tr_null;
             }
-            return m->trp[p.x][p.y];
+            return m->trp.get( p );
         }
 
         void set_trap( const point &p, trap_id trap ) {
+            if( is_uniform() && trap == tr_null ) {
+                return;
+            }
             ensure_nonuniform();
-            m->trp[p.x][p.y] = trap;
+            m->trp.set( p, trap );
         }
 
         void set_all_traps( const trap_id &trap ) {
             ensure_nonuniform();
-            std::uninitialized_fill_n( &m->trp[0][0], elements, trap );
+            m->trp.fill( trap );
         }
 
         furn_id get_furn( const point &p ) const {
@@ -115,13 +135,18 @@ class submap
         }
 
         void set_furn( const point &p, furn_id furn ) {
+            if( is_uniform() && furn == f_null ) {
+                return;
+            }
             ensure_nonuniform();
             m->frn[p.x][p.y] = furn;
+            ++display_version;
         }
 
         void set_all_furn( const furn_id &furn ) {
             ensure_nonuniform();
             std::uninitialized_fill_n( &m->frn[0][0], elements, furn );
+            ++display_version;
         }
         int get_map_damage( const point_sm_ms &p ) const {
             auto it = ephemeral_data.find( p );
@@ -143,8 +168,12 @@ class submap
         }
 
         void set_ter( const point &p, ter_id terr ) {
+            if( is_uniform() && terr == uniform_ter ) {
+                return;
+            }
             ensure_nonuniform();
             m->ter[p.x][p.y] = terr;
+            ++display_version;
         }
 
         void set_all_ter( const ter_id &terr, bool uniform_ok = false ) {
@@ -156,36 +185,44 @@ class submap
             } else {
                 std::uninitialized_fill_n( &m->ter[0][0], elements, terr );
             }
+            ++display_version;
         }
 
         int get_radiation( const point &p ) const {
             if( is_uniform() ) {
                 return 0;
             }
-            return m->rad[p.x][p.y];
+            return m->rad.get( p );
         }
 
         void set_radiation( const point &p, const int radiation ) {
+            if( is_uniform() && radiation == 0 ) {
+                return;
+            }
             ensure_nonuniform();
-            m->rad[p.x][p.y] = radiation;
+            m->rad.set( p, radiation );
         }
 
         uint8_t get_lum( const point &p ) const {
             if( is_uniform() ) {
                 return 0;
             }
-            return m->lum[p.x][p.y];
+            return m->lum.get( p );
         }
 
         void set_lum( const point &p, uint8_t luminance ) {
+            if( is_uniform() && luminance == 0 ) {
+                return;
+            }
             ensure_nonuniform();
-            m->lum[p.x][p.y] = luminance;
+            m->lum.set( p, luminance );
         }
 
         void update_lum_add( const point &p, const item &i ) {
             ensure_nonuniform();
-            if( i.is_emissive() && m->lum[p.x][p.y] < 255 ) {
-                m->lum[p.x][p.y]++;
+            const std::uint8_t lum = m->lum.get( p );
+            if( i.is_emissive() && lum < 255 ) {
+                m->lum.set( p, lum + 1 );
             }
         }
 
@@ -227,6 +264,19 @@ class submap
 
         void clear_fields( const point &p );
 
+        // Tiles that may hold fields. This is a superset of the tiles that actually do: bits are
+        // set whenever a field is added and only cleared by field processing once it finds the
+        // tile empty, so processing can skip the rest of the submap without missing anything.
+        bool may_have_field( const point &p ) const {
+            return field_tiles[p.x * SEEY + p.y];
+        }
+        void mark_field_tile( const point &p ) {
+            field_tiles.set( p.x * SEEY + p.y );
+        }
+        void clear_field_tile( const point &p ) {
+            field_tiles.reset( p.x * SEEY + p.y );
+        }
+
         struct cosmetic_t {
             point pos;
             std::string type;
@@ -294,8 +344,23 @@ class submap
         active_item_cache active_items;
 
         int field_count = 0;
+        std::bitset<SEEX *SEEY> field_tiles; // NOLINT(cata-serialize)
         time_point last_touched = calendar::turn_zero;
         bool reverted = false; // NOLINT(cata-serialize)
+        /** Bumped whenever terrain or furniture changes, for caches of what the tiles look like. */
+        int display_version = 0; // NOLINT(cata-serialize)
+        /**
+         * Made uniform by @ref compact. Unlike a submap from generate_uniform, regenerating
+         * it might not give the same terrain, so it is still saved.
+         */
+        bool compacted = false; // NOLINT(cata-serialize)
+        /**
+         * Still exactly as @ref generate_omt made it from these, so it is saved as them instead.
+         * Cleared once a map loads it, as anything may change it from there.
+         */
+        bool pristine = false; // NOLINT(cata-serialize)
+        unsigned int mapgen_seed = 0; // NOLINT(cata-serialize)
+        time_point generated_at = calendar::turn_zero; // NOLINT(cata-serialize)
         std::vector<spawn_point> spawns;
         /**
          * Vehicles on this submap (their (0,0) point is on this submap).
@@ -319,6 +384,8 @@ class submap
         int temperature_mod = 0; // delta in F
 
         void update_legacy_computer();
+        /** Writes the members kept outside of the tile arrays. */
+        void store_objects( JsonOut &jsout ) const;
 
         static constexpr size_t elements = SEEX * SEEY;
 };
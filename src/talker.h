@@ -9,6 +9,7 @@
 #include "type_id.h"
 #include "units.h"
 #include "units_fwd.h"
+#include "var_storage.h"
 #include <list>
 
 class computer;
@@ -350,6 +351,17 @@ class talker
         }
         virtual void set_value( const std::string &, const std::string & ) {}
         virtual void remove_value( const std::string & ) {}
+        // Same as the above, with the variable name interned beforehand. Talkers backed
+        // by a Creature override these; the rest simply go by name.
+        virtual std::optional<std::string> maybe_get_var( const var_key &key ) const {
+            return maybe_get_value( key.str() );
+        }
+        virtual void set_var( const var_key &key, const std::string &value ) {
+            set_value( key.str(), value );
+        }
+        virtual void remove_var( const var_key &key ) {
+            remove_value( key.str() );
+        }
 
         // inventory, buying, and selling
         virtual bool is_wearing( const itype_id & ) const {
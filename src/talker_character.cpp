@@ -459,6 +459,11 @@ const
     return me_chr_const->maybe_get_value( var_name );
 }
 
+std::optional<std::string> talker_character_const::maybe_get_var( const var_key &key ) const
+{
+    return me_chr_const->maybe_get_value( key );
+}
+
 void talker_character::set_value( const std::string &var_name, const std::string &value )
 {
     me_chr->set_value( var_name, value );
@@ -469,6 +474,16 @@ void talker_character::remove_value( const std::string &var_name )
     me_chr->remove_value( var_name );
 }
 
+void talker_character::set_var( const var_key &key, const std::string &value )
+{
+    me_chr->set_value( key, value );
+}
+
+void talker_character::remove_var( const var_key &key )
+{
+    me_chr->remove_value( key );
+}
+
 bool talker_character_const::is_wearing( const itype_id &item_id ) const
 {
     return me_chr_const->is_wearing( item_id );
@@ -112,6 +112,7 @@ class talker_character_const: public talker_cloner<talker_character_const>
         bool is_deaf() const override;
         bool is_mute() const override;
         std::optional<std::string> maybe_get_value( const std::string &var_name ) const override;
+        std::optional<std::string> maybe_get_var( const var_key &key ) const override;
 
         // stats, skills, traits, bionics, magic, and proficiencies
         std::vector<skill_id> skills_teacheable() const override;
@@ -254,6 +255,8 @@ class talker_character: public talker_cloner<talker_character, talker_character_
         void remove_effect( const efftype_id &old_effect, const std::string &bp ) override;
         void set_value( const std::string &var_name, const std::string &value ) override;
         void remove_value( const std::string &var_name ) override;
+        void set_var( const var_key &key, const std::string &value ) override;
+        void remove_var( const var_key &key ) override;
 
         // inventory, buying, and selling
         std::vector<item *> items_with( const std::function<bool( const item & )> &filter ) const override;
@@ -102,6 +102,11 @@ const
     return me_mon_const->maybe_get_value( var_name );
 }
 
+std::optional<std::string> talker_monster_const::maybe_get_var( const var_key &key ) const
+{
+    return me_mon_const->maybe_get_value( key );
+}
+
 bool talker_monster_const::has_flag( const flag_id &f ) const
 {
     add_msg_debug( debugmode::DF_TALKER, "Monster %s checked for flag %s", me_mon_const->name(),
@@ -133,6 +138,16 @@ void talker_monster::remove_value( const std::string &var_name )
     me_mon->remove_value( var_name );
 }
 
+void talker_monster::set_var( const var_key &key, const std::string &value )
+{
+    me_mon->set_value( key, value );
+}
+
+void talker_monster::remove_var( const var_key &key )
+{
+    me_mon->remove_value( key );
+}
+
 std::string talker_monster_const::short_description() const
 {
     return me_mon_const->type->get_description();
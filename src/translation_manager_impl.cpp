@@ -9,31 +9,36 @@
 #include "translations.h"
 #include "translation_manager_impl.h"
 
-std::uint32_t TranslationManager::Impl::Hash( const char *str )
+// FNV-1a, computing the length in the same pass
+std::uint32_t TranslationManager::Impl::Hash( const char *str, std::size_t &length )
 {
-    std::uint32_t hash = 5381U;
+    std::uint32_t hash = 2166136261U;
+    const char *const begin = str;
     while( *str != '\0' ) {
-        hash = hash * 33 + ( *str++ );
+        hash = ( hash ^ static_cast<unsigned char>( *str++ ) ) * 16777619U;
     }
+    length = str - begin;
     return hash;
 }
 
 std::optional<std::pair<std::size_t, std::size_t>> TranslationManager::Impl::LookupString(
             const char *query ) const
 {
-    if( strings.empty() ) {
+    if( catalogue.empty() ) {
         return std::nullopt;
     }
-    std::uint32_t hash = Hash( query );
-    auto it = strings.find( hash );
-    if( it == strings.end() ) {
-        return std::nullopt;
-    }
-    for( const std::pair<size_t, size_t> &entry : it->second ) {
-        const std::size_t document = entry.first;
-        const std::size_t index = entry.second;
-        if( strcmp( documents[document].GetOriginalString( index ), query ) == 0 ) {
-            return std::optional<std::pair<std::size_t, std::size_t>> { entry };
+    std::size_t length = 0;
+    const std::uint32_t hash = Hash( query, length );
+    const std::size_t mask = catalogue.size() - 1;
+    // Entries were inserted in document order, so the first match is the one of the
+    // earliest document, same as before
+    for( std::size_t slot = hash & mask; catalogue[slot].length != 0; slot = ( slot + 1 ) & mask ) {
+        const CatalogueEntry &entry = catalogue[slot];
+        if( entry.hash == hash && entry.length == length &&
+            memcmp( documents[entry.document].GetOriginalString( entry.index ), query,
+                    length ) == 0 ) {
+            return std::make_pair( static_cast<std::size_t>( entry.document ),
+                                   static_cast<std::size_t>( entry.index ) );
         }
     }
     return std::nullopt;
@@ -85,8 +90,8 @@ void TranslationManager::Impl::ScanTranslationDocuments()
 void TranslationManager::Impl::Reset()
 {
     documents.clear();
-    strings.clear();
-    strings.max_load_factor( 1.0f );
+    catalogue.clear();
+    catalogue.shrink_to_fit();
 }
 
 TranslationManager::Impl::Impl()
@@ -145,16 +150,37 @@ void TranslationManager::Impl::LoadDocuments( const std::vector<std::string> &fi
             DebugLog( D_ERROR, DC_ALL ) << e.what();
         }
     }
+    std::size_t total = 0;
+    for( const TranslationDocument &document : documents ) {
+        total += document.Count();
+    }
+    if( total == 0 ) {
+        return;
+    }
+    // At most half full, so a miss usually ends on the first empty slot
+    std::size_t size = 16;
+    while( size < total * 2 ) {
+        size *= 2;
+    }
+    catalogue.assign( size, CatalogueEntry() );
+    const std::size_t mask = size - 1;
     for( std::size_t document = 0; document < documents.size(); document++ ) {
         for( std::size_t i = 0; i < documents[document].Count(); i++ ) {
             const char *message = documents[document].GetOriginalString( i );
-            if( message[0] != '\0' ) {
-                const std::uint32_t hash = Hash( message );
-                if( strings.count( hash ) == 0 ) {
-                    strings[hash] = std::vector<std::pair<std::size_t, std::size_t>>( 1 );
-                }
-                strings[hash].emplace_back( document, i );
+            if( message[0] == '\0' ) {
+                continue;
+            }
+            std::size_t length = 0;
+            const std::uint32_t hash = Hash( message, length );
+            std::size_t slot = hash & mask;
+            while( catalogue[slot].length != 0 ) {
+                slot = ( slot + 1 ) & mask;
             }
+            CatalogueEntry &entry = catalogue[slot];
+            entry.hash = hash;
+            entry.length = static_cast<std::uint32_t>( length );
+            entry.document = static_cast<std::uint32_t>( document );
+            entry.index = static_cast<std::uint32_t>( i );
         }
     }
 }
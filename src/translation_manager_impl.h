@@ -15,8 +15,17 @@ class TranslationManager::Impl
     private:
         std::vector<TranslationDocument> documents;
 
-        std::unordered_map<std::uint32_t, std::vector<std::pair<std::size_t, std::size_t>>> strings;
-        static std::uint32_t Hash( const char *str );
+        // One slot of the catalogue, an open addressing table over the original strings of
+        // every document. Built once per language, sized so that lookups rarely probe twice.
+        struct CatalogueEntry {
+            std::uint32_t hash = 0;
+            // 0 marks an empty slot, empty strings are never looked up
+            std::uint32_t length = 0;
+            std::uint32_t document = 0;
+            std::uint32_t index = 0;
+        };
+        std::vector<CatalogueEntry> catalogue;
+        static std::uint32_t Hash( const char *str, std::size_t &length );
         std::optional<std::pair<std::size_t, std::size_t>> LookupString( const char *query ) const;
 
         std::unordered_map<std::string, std::vector<std::string>> mo_files;
@@ -0,0 +1,161 @@
+#pragma once
+#ifndef CATA_SRC_TRIPOINT_MAP_H
+#define CATA_SRC_TRIPOINT_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "point.h"
+
+namespace cata
+{
+
+/**
+ * A hash for tripoints that mixes all bits of the coordinates. std::hash<tripoint> is cheap,
+ * but leaves nearby points in nearby buckets, which open addressing can't live with.
+ */
+struct tripoint_hash {
+    std::size_t operator()( const tripoint &p ) const noexcept {
+        std::uint64_t val = static_cast<std::uint32_t>( p.x );
+        val = ( val << 24 ) ^ static_cast<std::uint32_t>( p.y );
+        val = ( val << 8 ) ^ static_cast<std::uint8_t>( p.z );
+        // finalizer of MurmurHash3
+        val ^= val >> 33;
+        val *= 0xff51afd7ed558ccdULL;
+        val ^= val >> 33;
+        val *= 0xc4ceb9fe1a85ec53ULL;
+        val ^= val >> 33;
+        return static_cast<std::size_t>( val );
+    }
+};
+
+/**
+ * Map from tripoint to @p T, kept in a single array with linear probing.
+ *
+ * Lookups touch one or two neighboring slots instead of following a bucket list, and nothing
+ * is allocated per entry. Inserting may move every value, so don't keep pointers from
+ * @ref find or @ref operator[] across insertions. Meant for small, cheap to copy values.
+ */
+template<typename T>
+class tripoint_map
+{
+    public:
+        size_t size() const {
+            return count;
+        }
+        bool empty() const {
+            return count == 0;
+        }
+
+        /** The value at @p p, or nullptr if there is none. */
+        T *find( const tripoint &p ) {
+            if( count == 0 ) {
+                return nullptr;
+            }
+            slot &s = slots[probe( p )];
+            return s.used ? &s.value : nullptr;
+        }
+        const T *find( const tripoint &p ) const {
+            if( count == 0 ) {
+                return nullptr;
+            }
+            const slot &s = slots[probe( p )];
+            return s.used ? &s.value : nullptr;
+        }
+
+        /** The value at @p p, default constructed if there was none. */
+        T &operator[]( const tripoint &p ) {
+            // Keep at most half the slots used so probe sequences stay short
+            if( ( count + 1 ) * 2 > slots.size() ) {
+                grow();
+            }
+            slot &s = slots[probe( p )];
+            if( !s.used ) {
+                s.key = p;
+                s.value = T();
+                s.used = true;
+                ++count;
+            }
+            return s.value;
+        }
+
+        /** Removes the value at @p p, returns whether there was one. */
+        bool erase( const tripoint &p ) {
+            if( count == 0 ) {
+                return false;
+            }
+            size_t hole = probe( p );
+            if( !slots[hole].used ) {
+                return false;
+            }
+            // Move later entries of the same probe sequence back, so no tombstones are needed
+            const size_t mask = slots.size() - 1;
+            for( size_t next = ( hole + 1 ) & mask; slots[next].used; next = ( next + 1 ) & mask ) {
+                const size_t home = home_of( slots[next].key );
+                const bool stays = hole <= next ? hole < home && home <= next :
+                                   hole < home || home <= next;
+                if( !stays ) {
+                    slots[hole] = std::move( slots[next] );
+                    hole = next;
+                }
+            }
+            slots[hole].used = false;
+            slots[hole].value = T();
+            --count;
+            return true;
+        }
+
+        /** Removes every value, keeping the memory for the next ones. */
+        void clear() {
+            if( count == 0 ) {
+                return;
+            }
+            for( slot &s : slots ) {
+                if( s.used ) {
+                    s.used = false;
+                    s.value = T();
+                }
+            }
+            count = 0;
+        }
+
+    private:
+        struct slot {
+            tripoint key;
+            T value = T();
+            bool used = false;
+        };
+
+        std::vector<slot> slots;
+        size_t count = 0;
+
+        size_t home_of( const tripoint &p ) const {
+            return tripoint_hash()( p ) & ( slots.size() - 1 );
+        }
+
+        // The slot holding p, or the free slot where it belongs. There is always a free slot.
+        size_t probe( const tripoint &p ) const {
+            const size_t mask = slots.size() - 1;
+            size_t i = home_of( p );
+            while( slots[i].used && slots[i].key != p ) {
+                i = ( i + 1 ) & mask;
+            }
+            return i;
+        }
+
+        void grow() {
+            std::vector<slot> old = std::move( slots );
+            slots = std::vector<slot>( old.empty() ? 16 : old.size() * 2 );
+            for( slot &s : old ) {
+                if( s.used ) {
+                    slots[probe( s.key )] = std::move( s );
+                }
+            }
+        }
+};
+
+} // namespace cata
+
+#endif // CATA_SRC_TRIPOINT_MAP_H
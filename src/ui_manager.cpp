@@ -1,5 +1,6 @@
 #include "ui_manager.h"
 
+#include <chrono>
 #include <functional>
 #include <iterator>
 #include <optional>
@@ -23,6 +24,7 @@ using ui_stack_t = std::vector<std::reference_wrapper<ui_adaptor>>;
 static bool redraw_in_progress = false;
 static bool showing_debug_message = false;
 static bool restart_redrawing = false;
+static std::chrono::steady_clock::time_point last_redraw;
 #if defined( TILES )
 static std::optional<SDL_Rect> prev_clip_rect;
 #endif
@@ -325,6 +327,20 @@ void ui_adaptor::redraw()
     redraw_invalidated();
 }
 
+bool ui_adaptor::redraw_scheduled()
+{
+    if( redraw_rate_cap > 0 && std::chrono::steady_clock::now() - last_redraw <
+        std::chrono::microseconds( 1000000 / redraw_rate_cap ) ) {
+        // Picked up by the next redraw
+        if( !ui_stack.empty() ) {
+            ui_stack.back().get().invalidated = true;
+        }
+        return false;
+    }
+    redraw();
+    return true;
+}
+
 void ui_adaptor::redraw_invalidated()
 {
     if( test_mode || ui_stack.empty() ) {
@@ -400,6 +416,7 @@ void ui_adaptor::redraw_invalidated()
             }
         }
         if( !restart_redrawing && needs_redraw ) {
+            last_redraw = std::chrono::steady_clock::now();
             if( !ui_stack_copy ) {
                 // Callbacks may change the UI stack; make a copy of the original one.
                 ui_stack_copy = std::make_unique<ui_stack_t>( *ui_stack_orig );
@@ -477,6 +494,11 @@ void redraw_invalidated()
     ui_adaptor::redraw_invalidated();
 }
 
+bool redraw_scheduled()
+{
+    return ui_adaptor::redraw_scheduled();
+}
+
 void screen_resized()
 {
     ui_adaptor::screen_resized();
@@ -212,6 +212,7 @@ class ui_adaptor
         static void invalidate( const rectangle<point> &rect, bool reenable_uis_below );
         static void redraw();
         static void redraw_invalidated();
+        static bool redraw_scheduled();
         static void screen_resized();
     private:
         static void invalidation_consistency_and_optimization();
@@ -271,6 +272,13 @@ void redraw();
  * Redraw all invalidated windows without invalidating the top window.
  **/
 void redraw_invalidated();
+/**
+ * Like `redraw`, for redraws the game does on its own while turns pass. If the last redraw
+ * was less than a frame ago (see the REDRAW_RATE_CAP option), only the top window is
+ * invalidated, and the next redraw picks it up.
+ * @return whether the windows were redrawn.
+ **/
+bool redraw_scheduled();
 /**
  * Handle resize of the game window.
  * Not supposed to be directly called by the user.
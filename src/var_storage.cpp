@@ -0,0 +1,125 @@
+#include "var_storage.h"
+
+#include <algorithm>
+
+#include "json.h"
+
+namespace
+{
+
+struct var_key_table {
+    std::unordered_map<std::string, int> index_of;
+    std::vector<const std::string *> names;
+
+    var_key_table() {
+        intern( std::string() );
+    }
+
+    int intern( const std::string &name ) {
+        const auto ins = index_of.emplace( name, static_cast<int>( names.size() ) );
+        if( ins.second ) {
+            names.push_back( &ins.first->first );
+        }
+        return ins.first->second;
+    }
+};
+
+var_key_table &get_var_key_table()
+{
+    static var_key_table table;
+    return table;
+}
+
+bool key_less( const std::pair<var_key, std::string> &entry, const var_key &key )
+{
+    return entry.first < key;
+}
+
+} // namespace
+
+var_key::var_key( const std::string &name ) : index_( get_var_key_table().intern( name ) )
+{
+}
+
+const std::string &var_key::str() const
+{
+    return *get_var_key_table().names[index_];
+}
+
+std::optional<std::string> var_storage::get( const var_key &key ) const
+{
+    const auto it = std::lower_bound( entries.begin(), entries.end(), key, key_less );
+    if( it == entries.end() || it->first != key ) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void var_storage::set( const var_key &key, const std::string &value )
+{
+    const auto it = std::lower_bound( entries.begin(), entries.end(), key, key_less );
+    if( it != entries.end() && it->first == key ) {
+        it->second = value;
+    } else {
+        entries.emplace( it, key, value );
+    }
+}
+
+void var_storage::remove( const var_key &key )
+{
+    const auto it = std::lower_bound( entries.begin(), entries.end(), key, key_less );
+    if( it != entries.end() && it->first == key ) {
+        entries.erase( it );
+    }
+}
+
+void var_storage::migrate( const std::map<std::string, std::string> &migrations )
+{
+    for( const std::pair<const std::string, std::string> &migration : migrations ) {
+        const var_key from( migration.first );
+        std::optional<std::string> value = get( from );
+        if( !value ) {
+            continue;
+        }
+        remove( from );
+        // An existing variable under the new name wins
+        const var_key to( migration.second );
+        if( !get( to ) ) {
+            set( to, *value );
+        }
+    }
+}
+
+std::unordered_map<std::string, std::string> var_storage::to_map() const
+{
+    std::unordered_map<std::string, std::string> ret;
+    for( const std::pair<var_key, std::string> &entry : entries ) {
+        ret.emplace( entry.first.str(), entry.second );
+    }
+    return ret;
+}
+
+void var_storage::assign( const std::unordered_map<std::string, std::string> &values )
+{
+    entries.clear();
+    entries.reserve( values.size() );
+    for( const std::pair<const std::string, std::string> &value : values ) {
+        entries.emplace_back( var_key( value.first ), value.second );
+    }
+    std::sort( entries.begin(), entries.end() );
+}
+
+void var_storage::serialize( JsonOut &jsout ) const
+{
+    jsout.write( to_map() );
+}
+
+void var_storage::deserialize( const JsonObject &jo )
+{
+    std::unordered_map<std::string, std::string> values;
+    jo.allow_omitted_members();
+    for( const JsonMember &member : jo ) {
+        values[member.name()] = member.get_string();
+    }
+    assign( values );
+}
@@ -0,0 +1,90 @@
+#pragma once
+#ifndef CATA_SRC_VAR_STORAGE_H
+#define CATA_SRC_VAR_STORAGE_H
+
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class JsonObject;
+class JsonOut;
+
+/**
+ * Interned name of a dialogue variable.
+ *
+ * Interning happens once, when the key is constructed (usually while loading
+ * the JSON that refers to the variable); comparisons afterwards are plain
+ * integer comparisons. Interned names are never released.
+ */
+class var_key
+{
+    public:
+        var_key() = default;
+        explicit var_key( const std::string &name );
+
+        const std::string &str() const;
+        int index() const {
+            return index_;
+        }
+
+        bool operator==( const var_key &rhs ) const {
+            return index_ == rhs.index_;
+        }
+        bool operator!=( const var_key &rhs ) const {
+            return index_ != rhs.index_;
+        }
+        bool operator<( const var_key &rhs ) const {
+            return index_ < rhs.index_;
+        }
+    private:
+        // 0 is the empty string
+        int index_ = 0;
+};
+
+/**
+ * Variable name -> value store of a Creature or of the global variables.
+ *
+ * Entries are kept in a flat vector sorted by interned key, so lookups by
+ * @ref var_key are a binary search over integers. The string overloads intern
+ * their argument first. Saved games keep using the plain name -> value object.
+ */
+class var_storage
+{
+    public:
+        std::optional<std::string> get( const var_key &key ) const;
+        void set( const var_key &key, const std::string &value );
+        void remove( const var_key &key );
+
+        std::optional<std::string> get( const std::string &key ) const {
+            return get( var_key( key ) );
+        }
+        void set( const std::string &key, const std::string &value ) {
+            set( var_key( key ), value );
+        }
+        void remove( const std::string &key ) {
+            remove( var_key( key ) );
+        }
+
+        bool empty() const {
+            return entries.empty();
+        }
+        void clear() {
+            entries.clear();
+        }
+
+        /** Renames variables according to `from -> to` pairs, used when loading saves. */
+        void migrate( const std::map<std::string, std::string> &migrations );
+
+        std::unordered_map<std::string, std::string> to_map() const;
+        void assign( const std::unordered_map<std::string, std::string> &values );
+
+        void serialize( JsonOut &jsout ) const;
+        void deserialize( const JsonObject &jo );
+    private:
+        std::vector<std::pair<var_key, std::string>> entries;
+};
+
+#endif // CATA_SRC_VAR_STORAGE_H
@@ -8,6 +8,7 @@
 #include <complex>
 #include <cstdint>
 #include <cstdlib>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <numeric>
@@ -136,6 +137,11 @@ static const std::string flag_APPLIANCE( "APPLIANCE" );
 static const std::string flag_CANT_DRAG( "CANT_DRAG" );
 static const std::string flag_WIRING( "WIRING" );
 
+// Flags vehicle::idle() and vehicle::on_move() check for on every turn or move
+static const std::array<std::string, 7> turn_effect_flags = {
+    "STEREO", "CHIMES", "CRASH_TERRAIN_AROUND", "TRANSFORM_TERRAIN", "SCOOP", "PLANTER", "REAPER"
+};
+
 static bool is_sm_tile_outside( const tripoint &real_global_pos );
 static bool is_sm_tile_over_water( const tripoint &real_global_pos );
 
@@ -205,6 +211,9 @@ units::volume vehicle_stack::max_volume() const
     return std::min( vpi.size, 10000_liter );
 }
 
+// Bumped whenever a vehicle is refreshed or destroyed, which invalidates every power_grid_cache
+static int power_grid_version = 0;
+
 // Vehicle class methods.
 
 vehicle::vehicle( const vproto_id &proto_id )
@@ -229,7 +238,10 @@ vehicle::vehicle( const vproto_id &proto_id )
     }
 }
 
-vehicle::~vehicle() = default;
+vehicle::~vehicle()
+{
+    ++power_grid_version;
+}
 
 turret_cpu::~turret_cpu() = default;
 
@@ -2753,6 +2765,17 @@ bool vehicle::has_part( const std::string &flag, bool enabled ) const
     return false;
 }
 
+bool vehicle::has_turn_effect_part( const std::string &flag ) const
+{
+    for( const int p : turn_effect_parts ) {
+        const vehicle_part &vp = parts[p];
+        if( !vp.removed && vp.enabled && !vp.is_broken() && vp.info().has_flag( flag ) ) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool vehicle::has_part( const tripoint &pos, const std::string &flag, bool enabled ) const
 {
     const tripoint relative_pos = pos - global_pos3();
@@ -3163,9 +3186,9 @@ int vehicle::part_displayed_at( const point &dp, bool include_fake, bool below_r
     // it's clear where the magic number comes from.
     const int ON_ROOF_Z = 9;
 
-    std::vector<int> parts_in_square = parts_at_relative( dp, true, include_fake );
-
-    if( parts_in_square.empty() ) {
+    // Walk the cached parts in place, this runs for every drawn vehicle tile
+    const auto parts_in_square = relative_parts.find( dp );
+    if( parts_in_square == relative_parts.end() ) {
         return -1;
     }
 
@@ -3179,23 +3202,18 @@ int vehicle::part_displayed_at( const point &dp, bool include_fake, bool below_r
 
     int top_part = -1;
     int top_z_order = ( below_roof ? 0 : ON_ROOF_Z ) - 1;
-    for( size_t index = 0; index < parts_in_square.size(); index++ ) {
-        int test_index = parts_in_square[index];
+    for( const int test_index : parts_in_square->second ) {
         const vehicle_part &vp = parts.at( test_index );
-        if( !vp.is_real_or_active_fake() ) {
+        if( ( !include_fake && vp.is_fake ) || !vp.is_real_or_active_fake() ) {
             continue;
         }
         int test_z_order = vp.info().z_order;
         if( ( top_z_order < test_z_order ) && ( test_z_order < hide_z_at_or_above ) ) {
-            top_part = index;
+            top_part = test_index;
             top_z_order = test_z_order;
         }
     }
-    if( top_part < 0 ) {
-        return top_part;
-    }
-
-    return parts_in_square[top_part];
+    return top_part;
 }
 
 int vehicle::roof_at_part( const int part ) const
@@ -3252,19 +3270,50 @@ void vehicle::precalc_mounts( int idir, const units::angle &dir,
     if( idir < 0 || idir > 1 ) {
         idir = 0;
     }
-    tileray tdir( dir );
-    std::unordered_map<point, tripoint> mount_to_precalc;
-    for( vehicle_part &p : parts ) {
+    const auto matches = [&]( const precalc_cache_entry & entry ) {
+        if( entry.dir != dir || entry.pivot != pivot || entry.mounts.size() != parts.size() ) {
+            return false;
+        }
+        for( size_t i = 0; i < parts.size(); i++ ) {
+            if( entry.mounts[i] != parts[i].mount ) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto cached = std::find_if( precalc_cache.begin(), precalc_cache.end(), matches );
+    if( cached == precalc_cache.end() ) {
+        if( precalc_cache.size() >= max_precalc_cache_size ) {
+            precalc_cache.pop_back();
+        }
+        precalc_cache_entry entry{ dir, pivot, {}, {} };
+        entry.mounts.reserve( parts.size() );
+        entry.positions.reserve( parts.size() );
+        tileray tdir( dir );
+        std::unordered_map<point, point> mount_to_precalc;
+        for( const vehicle_part &p : parts ) {
+            auto q = mount_to_precalc.find( p.mount );
+            if( q == mount_to_precalc.end() ) {
+                tripoint translated;
+                coord_translate( tdir, pivot, p.mount, translated );
+                q = mount_to_precalc.emplace( p.mount, translated.xy() ).first;
+            }
+            entry.mounts.push_back( p.mount );
+            entry.positions.push_back( q->second );
+        }
+        cached = precalc_cache.insert( precalc_cache.begin(), std::move( entry ) );
+    } else if( cached != precalc_cache.begin() ) {
+        std::rotate( precalc_cache.begin(), cached, std::next( cached ) );
+        cached = precalc_cache.begin();
+    }
+    for( size_t i = 0; i < parts.size(); i++ ) {
+        vehicle_part &p = parts[i];
         if( p.removed ) {
             continue;
         }
-        auto q = mount_to_precalc.find( p.mount );
-        if( q == mount_to_precalc.end() ) {
-            coord_translate( tdir, pivot, p.mount, p.precalc[idir] );
-            mount_to_precalc.insert( { p.mount, p.precalc[idir] } );
-        } else {
-            p.precalc[idir] = q->second;
-        }
+        // The z offset belongs to the part, only the rotated x/y come from the cache
+        p.precalc[idir].x = cached->positions[i].x;
+        p.precalc[idir].y = cached->positions[i].y;
     }
     pivot_anchor[idir] = pivot;
     pivot_rotation[idir] = dir;
@@ -5278,7 +5327,8 @@ vehicle *vehicle::find_vehicle( const tripoint_abs_ms &where )
 }
 
 template<typename Vehicle> // Templated to support const and non-const vehicle*
-std::map<Vehicle *, float> vehicle::search_connected_vehicles( Vehicle *start )
+std::map<Vehicle *, float> vehicle::search_connected_vehicles( Vehicle *start,
+        bool *missing_target )
 {
     std::map<Vehicle *, float> distances; // distance represents sum of cable losses
     std::vector<Vehicle *> queue;
@@ -5303,6 +5353,9 @@ std::map<Vehicle *, float> vehicle::search_connected_vehicles( Vehicle *start )
 
             Vehicle *const v_next = find_vehicle( tripoint_abs_ms( vp.target.second ) );
             if( v_next == nullptr ) { // vehicle's rolled away or off-map
+                if( missing_target != nullptr ) {
+                    *missing_target = true;
+                }
                 continue;
             }
             // try insert infinity for initial unvisited node distance
@@ -5319,14 +5372,45 @@ std::map<Vehicle *, float> vehicle::search_connected_vehicles( Vehicle *start )
     return distances;
 }
 
+const std::map<vehicle *, float> &vehicle::cached_connected_vehicles() const
+{
+    power_grid_cache &cache = grid_cache;
+    bool valid = cache.owner == this && cache.version == power_grid_version;
+    if( valid ) {
+        auto location = cache.locations.begin();
+        for( const std::pair<vehicle *const, float> &pair : cache.distances ) {
+            if( pair.first->global_square_location() != *location++ ) {
+                valid = false;
+                break;
+            }
+        }
+    }
+    if( valid ) {
+        return cache.distances;
+    }
+    // A search may load submaps and with them vehicles, so take the version first
+    const int version = power_grid_version;
+    bool missing_target = false;
+    cache.distances = search_connected_vehicles( const_cast<vehicle *>( this ), &missing_target );
+    cache.locations.clear();
+    for( const std::pair<vehicle *const, float> &pair : cache.distances ) {
+        cache.locations.push_back( pair.first->global_square_location() );
+    }
+    // A cable leading nowhere may find a vehicle that arrives later, so don't keep those
+    cache.owner = missing_target ? nullptr : this;
+    cache.version = version;
+    return cache.distances;
+}
+
 std::map<vehicle *, float> vehicle::search_connected_vehicles()
 {
-    return search_connected_vehicles( this );
+    return cached_connected_vehicles();
 }
 
 std::map<const vehicle *, float> vehicle::search_connected_vehicles() const
 {
-    return search_connected_vehicles( this );
+    const std::map<vehicle *, float> &distances = cached_connected_vehicles();
+    return std::map<const vehicle *, float>( distances.begin(), distances.end() );
 }
 
 void vehicle::get_connected_vehicles( std::unordered_set<vehicle *> &dest )
@@ -5601,15 +5685,15 @@ void vehicle::idle( bool on_map )
         }
     }
 
-    if( has_part( "STEREO", true ) ) {
+    if( has_turn_effect_part( "STEREO" ) ) {
         play_music();
     }
 
-    if( has_part( "CHIMES", true ) ) {
+    if( has_turn_effect_part( "CHIMES" ) ) {
         play_chimes();
     }
 
-    if( has_part( "CRASH_TERRAIN_AROUND", true ) ) {
+    if( has_turn_effect_part( "CRASH_TERRAIN_AROUND" ) ) {
         crash_terrain_around();
     }
 
@@ -5634,16 +5718,16 @@ void vehicle::idle( bool on_map )
 
 void vehicle::on_move()
 {
-    if( has_part( "TRANSFORM_TERRAIN", true ) ) {
+    if( has_turn_effect_part( "TRANSFORM_TERRAIN" ) ) {
         transform_terrain();
     }
-    if( has_part( "SCOOP", true ) ) {
+    if( has_turn_effect_part( "SCOOP" ) ) {
         operate_scoop();
     }
-    if( has_part( "PLANTER", true ) ) {
+    if( has_turn_effect_part( "PLANTER" ) ) {
         operate_planter();
     }
-    if( has_part( "REAPER", true ) ) {
+    if( has_turn_effect_part( "REAPER" ) ) {
         operate_reaper();
     }
 
@@ -6087,6 +6171,8 @@ void vehicle::refresh_active_item_cache()
  */
 void vehicle::refresh( const bool remove_fakes )
 {
+    // Parts, and with them the cables, may have changed
+    ++power_grid_version;
     if( no_refresh ) {
         return;
     }
@@ -6116,6 +6202,7 @@ void vehicle::refresh( const bool remove_fakes )
     accessories.clear();
     cable_ports.clear();
     control_req_parts.clear();
+    turn_effect_parts.clear();
 
     alternator_load = 0;
     extra_drag = 0_W;
@@ -6172,6 +6259,13 @@ void vehicle::refresh( const bool remove_fakes )
                                                !( vp.part().health_percent() < vp.part().floating_leak_threshold() ) ) ) {
             floating.push_back( p );
         }
+        // has_part() doesn't skip carried parts, so neither may this
+        for( const std::string &flag : turn_effect_flags ) {
+            if( vpi.has_flag( flag ) ) {
+                turn_effect_parts.push_back( p );
+                break;
+            }
+        }
 
         if( vp.part().is_unavailable() ) {
             continue;
@@ -6385,6 +6479,51 @@ void vehicle::refresh( const bool remove_fakes )
     refresh_active_item_cache();
 }
 
+void vehicle::refresh_broken_part( const int p )
+{
+    if( no_refresh ) {
+        return;
+    }
+    if( p < 0 || p >= part_count() ) {
+        refresh( false );
+        return;
+    }
+    const vehicle_part &vp = parts[p];
+    const vpart_info &vpi = vp.info();
+    // Rail wheels shape the rail bounding box, controllers toggle other parts, and extra drag
+    // depends on whether the part was enabled back when the caches were built.
+    if( ( vpi.has_flag( VPFLAG_WHEEL ) && vpi.has_flag( VPFLAG_RAIL ) ) ||
+        vpi.has_flag( "SMART_ENGINE_CONTROLLER" ) || vpi.has_flag( "TURRET_CONTROLS" ) ||
+        vpi.has_flag( "EXTRA_DRAG" ) ) {
+        refresh( false );
+        return;
+    }
+
+    const auto drop = [p]( std::vector<int> &cache ) {
+        cache.erase( std::remove( cache.begin(), cache.end(), p ), cache.end() );
+    };
+    // Everything refresh() fills with available parts only.
+    for( std::vector<int> *cache : {
+             &alternators, &engines, &reactors, &solar_panels, &rotors, &batteries,
+             &fuel_containers, &turret_locations, &wind_turbines, &sails, &water_wheels, &funnels,
+             &loose_parts, &emitters, &wheelcache, &steering, &speciality, &mufflers, &planters,
+             &accessories, &cable_ports, &control_req_parts
+         } ) {
+        drop( *cache );
+    }
+    if( !vpi.has_flag( VPFLAG_NO_LEAK ) && vp.health_percent() < vp.floating_leak_threshold() ) {
+        drop( floating );
+    }
+
+    // The part stays where it is, so the mount and fake part caches are still valid.
+    check_environmental_effects = true;
+    insides_dirty = true;
+    zones_dirty = true;
+    coeff_air_dirty = true;
+    invalidate_mass();
+    occupied_cache_pos = { -1, -1, -1 };
+}
+
 vpart_edge_info vehicle::get_edge_info( const point &mount ) const
 {
     point forward = mount + point_east;
@@ -7368,7 +7507,7 @@ int vehicle::damage_direct( map &here, vehicle_part &vp, int dmg, const damage_t
 
         // refresh cache in case the broken part has changed the status
         // do not remove fakes parts in case external vehicle part references get invalidated
-        refresh( false );
+        refresh_broken_part( index_of_part( &vp, /* include_removed = */ true ) );
     }
 
     if( vp.is_fuel_store() ) {
@@ -7760,9 +7899,25 @@ void vehicle::update_time( const time_point &update_to )
     if( funnels.empty() && solar_panels.empty() && wind_turbines.empty() && water_wheels.empty() ) {
         return;
     }
-    // Get one weather data set per vehicle, they don't differ much across vehicle area
-    const weather_sum accum_weather = sum_conditions( update_from, update_to,
-                                      global_square_location() );
+    units::power solar_epower = 0_W;
+    for( const int p : solar_panels ) {
+        const vehicle_part &vp = parts[p];
+        const tripoint pos = global_part_pos3( vp );
+        if( vp.is_unavailable() || !is_sm_tile_outside( here.getabs( pos ) ) ) {
+            continue;
+        }
+        solar_epower += part_epower( vp );
+    }
+    // Get one weather data set per vehicle, they don't differ much across vehicle area.
+    // Only rain and sunlight use it, wind turbines and water wheels run at their current output.
+    weather_sum accum_weather;
+    if( solar_epower != 0_W ) {
+        accum_weather = sum_conditions( update_from, update_to, global_square_location() );
+    } else if( !funnels.empty() ) {
+        // Rain alone comes from the shared rainfall table, without sampling the weather
+        accum_weather.rain_amount = rain_amount_between( update_from, update_to,
+                                    global_square_location() );
+    }
     // make some reference objects to use to check for reload
     const item water( "water" );
     const item water_clean( "water_clean" );
@@ -7804,19 +7959,10 @@ void vehicle::update_time( const time_point &update_to )
         }
     }
 
-    if( !solar_panels.empty() ) {
-        units::power epower = 0_W;
-        for( const int p : solar_panels ) {
-            const vehicle_part &vp = parts[p];
-            const tripoint pos = global_part_pos3( vp );
-            if( vp.is_unavailable() || !is_sm_tile_outside( here.getabs( pos ) ) ) {
-                continue;
-            }
-            epower += part_epower( vp );
-        }
+    if( solar_epower != 0_W ) {
         double intensity = accum_weather.radiant_exposure / max_sun_irradiance() / to_seconds<float>
                            ( elapsed );
-        int energy_bat = power_to_energy_bat( epower * intensity, elapsed );
+        int energy_bat = power_to_energy_bat( solar_epower * intensity, elapsed );
         if( energy_bat > 0 ) {
             add_msg_debug( debugmode::DF_VEHICLE, "%s got %d kJ energy from solar panels", name, energy_bat );
             charge_battery( energy_bat );
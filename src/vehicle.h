@@ -854,8 +854,21 @@ class vehicle
         /// Values are line loss, 0.01 corresponds to 1% charge loss to wire resistance
         /// May load the connected vehicles' submaps
         /// Templated to support const and non-const vehicle*
+        /// @param missing_target set to true if any POWER_TRANSFER part leads to no vehicle
         template<typename Vehicle>
-        static std::map<Vehicle *, float> search_connected_vehicles( Vehicle *start );
+        static std::map<Vehicle *, float> search_connected_vehicles( Vehicle *start,
+                bool *missing_target = nullptr );
+        /// Result of the last search_connected_vehicles() started from this vehicle
+        struct power_grid_cache {
+            const vehicle *owner = nullptr;
+            int version = -1;
+            std::map<vehicle *, float> distances;
+            // Where each vehicle in distances was at the time of the search
+            std::vector<tripoint_abs_ms> locations;
+        };
+        /// Returns the connected vehicles from the cache, searching again if it went stale
+        const std::map<vehicle *, float> &cached_connected_vehicles() const;
+        mutable power_grid_cache grid_cache; // NOLINT(cata-serialize)
     public:
         /**
          * Find a possibly off-map vehicle. If necessary, loads up its submap through
@@ -895,6 +908,12 @@ class vehicle
         void enable_refresh();
         //Refresh all caches and re-locate all parts
         void refresh( bool remove_fakes = true );
+        /**
+         * Cheaper refresh( false ) for when part @p p has just broken: takes it out of the
+         * caches of usable parts instead of rebuilding all of them. Falls back to a full
+         * refresh for parts whose breaking affects more than their own entries.
+         */
+        void refresh_broken_part( int p );
 
         // Refresh active_item cache for vehicle parts
         void refresh_active_item_cache();
@@ -2109,6 +2128,9 @@ class vehicle
         // For a given mount point, returns its adjacency info
         vpart_edge_info get_edge_info( const point &mount ) const;
 
+        // Like has_part( flag, true ), but only looks at @ref turn_effect_parts
+        bool has_turn_effect_part( const std::string &flag ) const;
+
         // Removes fake parts from the parts vector
         void remove_fake_parts( bool cleanup = true );
         bool should_enable_fake( const tripoint &fake_precalc, const tripoint &parent_precalc,
@@ -2179,6 +2201,8 @@ class vehicle
         std::vector<int> cable_ports; // NOLINT(cata-serialize)
         std::vector<int> fake_parts; // NOLINT(cata-serialize)
         std::vector<int> control_req_parts; // NOLINT(cata-serialize)
+        // Parts with one of the flags idle() and on_move() look for on every turn or move
+        std::vector<int> turn_effect_parts; // NOLINT(cata-serialize)
 
         // config values
         std::string name;   // vehicle name
@@ -2224,6 +2248,17 @@ class vehicle
         mutable point mount_min; // NOLINT(cata-serialize)
         mutable point mass_center_precalc; // NOLINT(cata-serialize)
         mutable point mass_center_no_precalc; // NOLINT(cata-serialize)
+        // Rotated mount positions for a facing and pivot, as produced by precalc_mounts().
+        // Only valid while every part still has the mount it had when the entry was made.
+        struct precalc_cache_entry {
+            units::angle dir;
+            point pivot;
+            std::vector<point> mounts;
+            std::vector<point> positions;
+        };
+        static constexpr size_t max_precalc_cache_size = 4;
+        // Recently used facings, most recent first
+        std::vector<precalc_cache_entry> precalc_cache; // NOLINT(cata-serialize)
         tripoint autodrive_local_target = tripoint_zero; // current node the autopilot is aiming for
         class autodrive_controller;
         std::shared_ptr<autodrive_controller> active_autodrive_controller; // NOLINT(cata-serialize)
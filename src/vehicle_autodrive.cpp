@@ -11,6 +11,7 @@
 #include <optional>
 #include <queue>
 #include <string>
+#include <tuple>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -179,6 +180,23 @@ struct vehicle_profile {
     std::vector<point> collision_points;
 };
 
+using vehicle_profiles = std::array<vehicle_profile, NUM_ORIENTATIONS>;
+
+/**
+ * What the vehicle profiles depend on. Vehicles with the same footprint share their profiles.
+ */
+struct vehicle_footprint {
+    point pivot;
+    // mount points of the parts, sorted and without duplicates
+    std::vector<point> mounts;
+    // mount point and radius of every rotor
+    std::vector<std::pair<point, int>> rotors;
+
+    bool operator<( const vehicle_footprint &rhs ) const {
+        return std::tie( pivot, mounts, rotors ) < std::tie( rhs.pivot, rhs.mounts, rhs.rotors );
+    }
+};
+
 /**
  * Data type describing how what driving actions to perform at a given location
  * in order to follow the current path to destination.
@@ -305,7 +323,7 @@ struct auto_navigation_data {
     // max amount of steering actions per turn
     int max_steer;
 
-    std::array<vehicle_profile, NUM_ORIENTATIONS> profiles;
+    std::shared_ptr<const vehicle_profiles> profiles;
     // known obstacles on the view map
     cata::mdarray<bool, point, NAV_VIEW_SIZE_X, NAV_VIEW_SIZE_Y> is_obstacle;
     // z-level of where the ground is per point on the view map
@@ -326,11 +344,8 @@ struct auto_navigation_data {
         current_omt = { 0, 0, -100 };
         path.clear();
     }
-    vehicle_profile &profile( orientation dir ) {
-        return profiles.at( static_cast<int>( dir ) );
-    }
     const vehicle_profile &profile( orientation dir ) const {
-        return profiles.at( static_cast<int>( dir ) );
+        return profiles->at( static_cast<int>( dir ) );
     }
     bool &valid_position( orientation dir, point p ) {
         return valid_positions[static_cast<int>( dir )][p.x][p.y];
@@ -387,6 +402,8 @@ class vehicle::autodrive_controller
         void enqueue_if_ramp( point_queue &ramp_points, const map &here, const tripoint_bub_ms &p ) const;
         void compute_obstacles_from_enqueued_ramp_points( point_queue &ramp_points, const map &here );
         vehicle_profile compute_profile( orientation facing ) const;
+        vehicle_footprint compute_footprint() const;
+        std::shared_ptr<const vehicle_profiles> get_profiles() const;
         void compute_valid_positions();
         void compute_goal_zone();
         void precompute_data();
@@ -687,6 +704,47 @@ vehicle_profile vehicle::autodrive_controller::compute_profile( orientation faci
     return ret;
 }
 
+vehicle_footprint vehicle::autodrive_controller::compute_footprint() const
+{
+    vehicle_footprint ret;
+    ret.pivot = driven_veh.pivot_point();
+    for( const vehicle_part &part : driven_veh.parts ) {
+        if( !part.removed ) {
+            ret.mounts.emplace_back( part.mount );
+        }
+    }
+    std::sort( ret.mounts.begin(), ret.mounts.end() );
+    ret.mounts.erase( std::unique( ret.mounts.begin(), ret.mounts.end() ), ret.mounts.end() );
+    for( int part_num : driven_veh.rotors ) {
+        const vehicle_part &part = driven_veh.part( part_num );
+        ret.rotors.emplace_back( part.mount, ( part.info().rotor_info->rotor_diameter + 1 ) / 2 );
+    }
+    return ret;
+}
+
+// The profiles only depend on the footprint, so they are kept for the next omt, trip or
+// vehicle of the same shape rather than being redone for every omt.
+std::shared_ptr<const vehicle_profiles> vehicle::autodrive_controller::get_profiles() const
+{
+    static std::map<vehicle_footprint, std::shared_ptr<const vehicle_profiles>> known_profiles;
+    // a handful of vehicles are driven in a game, this only bounds rebuilt ones
+    constexpr size_t max_known_profiles = 16;
+    vehicle_footprint footprint = compute_footprint();
+    const auto found = known_profiles.find( footprint );
+    if( found != known_profiles.end() ) {
+        return found->second;
+    }
+    std::shared_ptr<vehicle_profiles> ret = std::make_shared<vehicle_profiles>();
+    for( orientation dir : all_orientations() ) {
+        ret->at( static_cast<int>( dir ) ) = compute_profile( dir );
+    }
+    if( known_profiles.size() >= max_known_profiles ) {
+        known_profiles.clear();
+    }
+    known_profiles.emplace( std::move( footprint ), ret );
+    return ret;
+}
+
 // Return true if the map tile at the given position (in map coordinates)
 // can be driven on (not an obstacle).
 // The logic should match what is in vehicle::part_collision().
@@ -858,13 +916,20 @@ void vehicle::autodrive_controller::compute_valid_positions()
     const coord_transformation veh_rot = {point_zero, -data.nav_to_map.rotation, point_zero};
     for( orientation facing : all_orientations() ) {
         const vehicle_profile &profile = data.profile( data.nav_to_map.transform( facing ) );
+        // the rotated zone is the same for every position, only its offset changes
+        const point rot_origin = veh_rot.transform( point_zero );
+        std::vector<point> zone_offsets;
+        zone_offsets.reserve( profile.occupied_zone.size() );
+        for( const point &veh_pt : profile.occupied_zone ) {
+            zone_offsets.emplace_back( veh_rot.transform( veh_pt ) - rot_origin );
+        }
         for( int mx = 0; mx < NAV_MAP_SIZE_X; mx++ ) {
             for( int my = 0; my < NAV_MAP_SIZE_Y; my++ ) {
                 const point nav_pt( mx, my );
+                const point view_nav_pt = data.nav_to_view.transform( nav_pt );
                 bool valid = true;
-                for( const point &veh_pt : profile.occupied_zone ) {
-                    const point view_pt = data.nav_to_view.transform( nav_pt ) + veh_rot.transform(
-                                              veh_pt ) - veh_rot.transform( point_zero );
+                for( const point &offset : zone_offsets ) {
+                    const point view_pt = view_nav_pt + offset;
                     if( !data.view_bounds.contains( view_pt ) || data.is_obstacle[view_pt.x][view_pt.y] ) {
                         valid = false;
                         break;
@@ -934,9 +999,7 @@ void vehicle::autodrive_controller::precompute_data()
         // TODO: change it during simulation based on vehicle speed and terrain
         // or maybe just keep track of player moves?
         data.max_steer = 1;
-        for( orientation dir : all_orientations() ) {
-            data.profile( dir ) = compute_profile( dir );
-        }
+        data.profiles = get_profiles();
 
         // initialize navigation data
         compute_coordinates();
@@ -94,22 +94,42 @@ vpart_display vehicle::get_display_of_tile( const point &dp, bool rotate, bool i
         ret.symbol_curses = vpart_variant::get_symbol_curses( ret.symbol );
     }
 
+    // Find the parts that override the color in one pass over the tile, like
+    // part_with_feature would with unbroken parts
+    int curtains = -1;
+    bool window = false;
+    int parm = -1;
+    int cargo_part = -1;
+    for( const int p : relative_parts.at( dp ) ) {
+        const vehicle_part &vp_here = parts[p];
+        if( vp_here.is_fake || vp_here.is_broken() ) {
+            continue;
+        }
+        const vpart_info &vpi_here = vp_here.info();
+        if( curtains < 0 && vpi_here.has_flag( VPFLAG_CURTAIN ) ) {
+            curtains = p;
+        }
+        window = window || vpi_here.has_flag( VPFLAG_WINDOW );
+        if( parm < 0 && vpi_here.has_flag( VPFLAG_ARMOR ) ) {
+            parm = p;
+        }
+        if( cargo_part < 0 && vpi_here.has_flag( VPFLAG_CARGO ) ) {
+            cargo_part = p;
+        }
+    }
+
     // curtain color override
-    const int curtains = part_with_feature( dp, VPFLAG_CURTAIN, true );
     if( curtains >= 0 ) {
         const vehicle_part &vp_curtain = parts[curtains];
-        if( !vp_curtain.open && part_with_feature( dp, VPFLAG_WINDOW, true ) >= 0 ) {
+        if( !vp_curtain.open && window ) {
             ret.color = vp_curtain.info().color;
         }
     }
 
     // armor color override
-    if( get_option<bool>( "VEHICLE_ARMOR_COLOR" ) ) {
-        const int parm = part_with_feature( dp, VPFLAG_ARMOR, true );
-        if( parm != -1 ) {
-            const vehicle_part &vp_armor = parts[parm];
-            ret.color = vp_armor.info().color;
-        }
+    if( parm != -1 && get_option<bool>( "VEHICLE_ARMOR_COLOR" ) ) {
+        const vehicle_part &vp_armor = parts[parm];
+        ret.color = vp_armor.info().color;
     }
 
     // blood color override
@@ -120,7 +140,6 @@ vpart_display vehicle::get_display_of_tile( const point &dp, bool rotate, bool i
     }
 
     // if cargo has items color is inverted
-    const int cargo_part = part_with_feature( dp, VPFLAG_CARGO, true );
     if( cargo_part >= 0 && !get_items( part( cargo_part ) ).empty() ) {
         ret.has_cargo = true;
         ret.color = invert_color( ret.color );
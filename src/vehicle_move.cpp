@@ -17,6 +17,7 @@
 #include "character.h"
 #include "creature.h"
 #include "creature_tracker.h"
+#include "cuboid_rectangle.h"
 #include "debug.h"
 #include "enums.h"
 #include "explosion.h"
@@ -29,6 +30,7 @@
 #include "material.h"
 #include "messages.h"
 #include "monster.h"
+#include "npc.h"
 #include "options.h"
 #include "rng.h"
 #include "sounds.h"
@@ -682,6 +684,22 @@ void vehicle::stop()
     }
 }
 
+// Whether any creature stands in the box between @p from and @p to, in map coordinates.
+static bool creatures_in_area( const map &here, const tripoint &from, const tripoint &to )
+{
+    const inclusive_cuboid<tripoint_abs_ms> area( here.getglobal( from ), here.getglobal( to ) );
+    if( area.contains( get_player_character().get_location() ) ||
+        !get_creature_tracker().find_all_in( area ).empty() ) {
+        return true;
+    }
+    for( const npc &guy : g->all_npcs() ) {
+        if( area.contains( guy.get_location() ) ) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool vehicle::collision( std::vector<veh_collision> &colls,
                          const tripoint &dp,
                          bool just_detect, bool bash_floor )
@@ -727,6 +745,22 @@ bool vehicle::collision( std::vector<veh_collision> &colls,
     const int sign_before = sgn( velocity_before );
     bool empty = true;
     map &here = get_map();
+    const tripoint veh_pos = global_pos3();
+    // Broad phase: unless someone stands where the vehicle is going, a part moving onto flat,
+    // open ground that no other vehicle is on can't hit anything, see part_collision().
+    bool open_ground_is_free = false;
+    if( !bash_floor ) {
+        tripoint from = tripoint_max;
+        tripoint to = tripoint_min;
+        for( const vehicle_part &vp : parts ) {
+            if( !vp.removed ) {
+                const tripoint dsp = veh_pos + dp + vp.precalc[1];
+                from = tripoint( std::min( from.x, dsp.x ), std::min( from.y, dsp.y ), std::min( from.z, dsp.z ) );
+                to = tripoint( std::max( to.x, dsp.x ), std::max( to.y, dsp.y ), std::max( to.z, dsp.z ) );
+            }
+        }
+        open_ground_is_free = from.x <= to.x && !creatures_in_area( here, from, to );
+    }
     for( int p = 0; p < part_count(); p++ ) {
         const vehicle_part &vp = parts.at( p );
         if( vp.removed || !vp.is_real_or_active_fake() ) {
@@ -740,7 +774,14 @@ bool vehicle::collision( std::vector<veh_collision> &colls,
         empty = false;
         // Coordinates of where part will go due to movement (dx/dy/dz)
         //  and turning (precalc[1])
-        const tripoint dsp = global_pos3() + dp + vp.precalc[1];
+        const tripoint dsp = veh_pos + dp + vp.precalc[1];
+        if( open_ground_is_free && !info.has_flag( VPFLAG_ROTOR ) &&
+            here.move_cost_ter_furn( dsp ) == 2 ) {
+            const optional_vpart_position ovp = here.veh_at( dsp );
+            if( !ovp || &ovp->vehicle() == this ) {
+                continue;
+            }
+        }
         veh_collision coll = part_collision( p, dsp, just_detect, bash_floor );
         if( coll.type == veh_coll_nothing && info.has_flag( VPFLAG_ROTOR ) ) {
             size_t radius = static_cast<size_t>( std::round( info.rotor_info->rotor_diameter / 2.0f ) );
@@ -1971,6 +2012,11 @@ vehicle *vehicle::act_on_map()
         }
     }
 
+    if( pl_ctrl && g->remoteveh() != this && dp.xy() != point_zero ) {
+        // The map follows the player, so read the submaps ahead before the vehicle gets there.
+        here.prefetch_submaps( dp.xy() );
+    }
+
     return here.move_vehicle( *this, dp, mdir );
 }
 
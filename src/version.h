@@ -0,0 +1,2 @@
+// NOLINT(cata-header-guard)
+#define VERSION "ba8fce6"
@@ -152,19 +152,31 @@ bool read_only_visitable::has_quality( const quality_id &qual, int level, int qt
 /** @relates visitable */
 bool inventory::has_quality( const quality_id &qual, int level, int qty ) const
 {
-    const quality_query query{ qual, level, qty };
-
-    if( qualities_cache.find( query ) == qualities_cache.end() ) {
-        int res = 0;
+    auto iter = quality_levels.find( qual );
+    if( iter == quality_levels.end() ) {
+        std::map<int, int> &levels = quality_levels[qual];
         for( const auto &stack : this->items ) {
-            res += stack.size() * has_quality_internal( stack.front(), qual, level, qty );
-            if( res >= qty ) {
-                qualities_cache[query] = true;
-            }
+            const int stack_size = stack.size();
+            stack.front().visit_items( [&qual, &levels, stack_size]( item * e, item * ) {
+                const int item_level = e->get_quality( qual );
+                if( item_level != INT_MIN ) {
+                    int &count = levels[item_level];
+                    count = sum_no_wrap( count, stack_size * static_cast<int>( e->count() ) );
+                }
+                return VisitResponse::NEXT;
+            } );
         }
+        iter = quality_levels.find( qual );
     }
 
-    return qualities_cache[query];
+    int res = 0;
+    for( auto it = iter->second.lower_bound( level ); it != iter->second.end(); ++it ) {
+        res = sum_no_wrap( res, it->second );
+        if( res >= qty ) {
+            return true;
+        }
+    }
+    return false;
 }
 
 /** @relates visitable */
@@ -905,9 +917,10 @@ int inventory::charges_of( const itype_id &what, int limit,
                            const std::function<void( int )> &visitor, bool in_tools ) const
 {
     const itype_bin &binned = get_binned_items();
-    const auto iter = std::find_if( binned.begin(),
+    // Only the UPS needs a scan, any item with the UPS flag counts for it
+    const auto iter = what != itype_UPS ? binned.find( what ) : std::find_if( binned.begin(),
     binned.end(), [&what]( itype_bin::value_type const & it ) {
-        return it.first == what || ( what == itype_UPS && it.first->has_flag( flag_IS_UPS ) );
+        return it.first == what || it.first->has_flag( flag_IS_UPS );
     } );
     if( iter == binned.end() ) {
         return 0;
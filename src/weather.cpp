@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <cmath>
 #include <functional>
+#include <limits>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -144,27 +147,26 @@ float incident_sun_irradiance( const weather_type_id &wtype, const time_point &t
     return std::max<float>( 0.0f, sun_irradiance( t ) * wtype->sun_multiplier );
 }
 
-static void proc_weather_sum( const weather_type_id &wtype, weather_sum &data,
-                              const time_point &t, const time_duration &tick_size )
+static int rain_per_turn( const weather_type_id &wtype )
 {
-    int amount = 0;
-    if( wtype->rains ) {
-        switch( wtype->precip ) {
-            case precip_class::very_light:
-                amount = 1 * to_turns<int>( tick_size );
-                break;
-            case precip_class::light:
-                amount = 4 * to_turns<int>( tick_size );
-                break;
-            case precip_class::heavy:
-                amount = 8 * to_turns<int>( tick_size );
-                break;
-            default:
-                break;
-        }
+    if( !wtype->rains ) {
+        return 0;
     }
-    data.rain_amount += amount;
+    switch( wtype->precip ) {
+        case precip_class::very_light:
+            return 1;
+        case precip_class::light:
+            return 4;
+        case precip_class::heavy:
+            return 8;
+        default:
+            return 0;
+    }
+}
 
+static void proc_weather_sum( const weather_type_id &wtype, weather_sum &data,
+                              const time_point &t, const time_duration &tick_size )
+{
     // TODO: Change this sunlight "sampling" here into a proper interpolation
     const float tick_sunlight = incident_sunlight( wtype, t );
     data.sunlight += tick_sunlight * to_turns<int>( tick_size );
@@ -175,13 +177,140 @@ static void proc_weather_sum( const weather_type_id &wtype, weather_sum &data,
 weather_type_id current_weather( const tripoint_abs_ms &location, const time_point &t )
 {
     weather_manager &weather = get_weather();
-    const weather_generator wgen = weather.get_cur_weather_gen();
+    const weather_generator &wgen = weather.get_cur_weather_gen();
     if( weather.weather_override != WEATHER_NULL ) {
         return weather.weather_override;
     }
     return wgen.get_weather_conditions( location, t, g->get_seed() );
 }
 
+namespace
+{
+/**
+ * Rain that fell on one overmap terrain, sampled in fixed steps aligned to turn zero, with
+ * prefix sums so that the rain of any span is the difference of two lookups.
+ */
+struct rainfall_table {
+    // Index of the first step, counted from turn zero
+    int64_t first_step = 0;
+    // Rain per turn during each step
+    std::vector<int> rates;
+    // Rain of the steps before each step, one entry longer than rates
+    std::vector<int64_t> prefix = { 0 };
+};
+
+// Past this many steps a table is started over instead of being extended
+constexpr int64_t max_rainfall_steps = 24 * 366 * 4;
+// Past this many tables all of them are dropped
+constexpr size_t max_rainfall_tables = 512;
+
+struct rainfall_cache {
+    unsigned int seed = 0;
+    weather_type_id override = WEATHER_NULL;
+    // Keyed by overmap terrain and step length in turns
+    std::map<std::pair<tripoint_abs_omt, int>, rainfall_table> tables;
+};
+} // namespace
+
+static rainfall_cache &get_rainfall_cache()
+{
+    static rainfall_cache cache;
+    const weather_type_id &override = get_weather().weather_override;
+    if( cache.seed != g->get_seed() || cache.override != override ) {
+        cache.seed = g->get_seed();
+        cache.override = override;
+        cache.tables.clear();
+    }
+    return cache;
+}
+
+static int64_t floor_div( int64_t num, int64_t den )
+{
+    return num / den - ( num % den < 0 ? 1 : 0 );
+}
+
+// Makes the table cover the steps [first, last)
+static void extend_rainfall_table( rainfall_table &table, int64_t first, int64_t last, int step,
+                                   const tripoint_abs_ms &location )
+{
+    const int64_t have_first = table.first_step;
+    const int64_t have_last = have_first + static_cast<int64_t>( table.rates.size() );
+    const int64_t span = std::max( last, have_last ) - std::min( first, have_first );
+    if( table.rates.empty() || span > max_rainfall_steps ) {
+        table.rates.clear();
+        table.first_step = first;
+    } else if( first >= have_first && last <= have_last ) {
+        return;
+    }
+    const auto rate_at = [&]( int64_t i ) {
+        const time_point t = calendar::turn_zero + time_duration::from_turns( i * step );
+        return rain_per_turn( current_weather( location, t ) );
+    };
+    if( !table.rates.empty() && first < table.first_step ) {
+        std::vector<int> front;
+        front.reserve( table.first_step - first );
+        for( int64_t i = first; i < table.first_step; i++ ) {
+            front.push_back( rate_at( i ) );
+        }
+        table.rates.insert( table.rates.begin(), front.begin(), front.end() );
+        table.first_step = first;
+    }
+    const int64_t filled = table.first_step + static_cast<int64_t>( table.rates.size() );
+    for( int64_t i = filled; i < last; i++ ) {
+        table.rates.push_back( rate_at( i ) );
+    }
+    table.prefix.resize( table.rates.size() + 1 );
+    table.prefix[0] = 0;
+    for( size_t i = 0; i < table.rates.size(); i++ ) {
+        table.prefix[i + 1] = table.prefix[i] + static_cast<int64_t>( table.rates[i] ) * step;
+    }
+}
+
+// Rain of the table from its start up to turn, which the table must cover
+static int64_t rainfall_before( const rainfall_table &table, int64_t turn, int step )
+{
+    const int64_t offset = turn - table.first_step * step;
+    const size_t i = static_cast<size_t>( offset / step );
+    if( i >= table.rates.size() ) {
+        return table.prefix.back();
+    }
+    return table.prefix[i] + static_cast<int64_t>( table.rates[i] ) * ( offset % step );
+}
+
+static int64_t rainfall_between( int64_t start, int64_t end, const time_duration &step_size,
+                                 const tripoint_abs_omt &omt )
+{
+    if( start >= end ) {
+        return 0;
+    }
+    rainfall_cache &cache = get_rainfall_cache();
+    const int step = to_turns<int>( step_size );
+    const std::pair<tripoint_abs_omt, int> key( omt, step );
+    if( cache.tables.size() >= max_rainfall_tables && cache.tables.count( key ) == 0 ) {
+        cache.tables.clear();
+    }
+    rainfall_table &table = cache.tables[key];
+    extend_rainfall_table( table, floor_div( start, step ), floor_div( end - 1, step ) + 1, step,
+                           project_to<coords::ms>( omt ) );
+    return rainfall_before( table, end, step ) - rainfall_before( table, start, step );
+}
+
+int rain_amount_between( const time_point &start, const time_point &end,
+                         const tripoint_abs_ms &location )
+{
+    if( start >= end ) {
+        return 0;
+    }
+    // Like the weather sampling elsewhere, anything older than a week only needs hourly steps
+    const tripoint_abs_omt omt = project_to<coords::omt>( location );
+    const int64_t from = to_turns<int64_t>( start - calendar::turn_zero );
+    const int64_t to = to_turns<int64_t>( end - calendar::turn_zero );
+    const int64_t split = std::max( from, to_turns<int64_t>( end - 7_days - calendar::turn_zero ) );
+    const int64_t rain = rainfall_between( from, split, 1_hours, omt ) +
+                         rainfall_between( split, to, 1_minutes, omt );
+    return static_cast<int>( std::min<int64_t>( rain, std::numeric_limits<int>::max() ) );
+}
+
 ////// Funnels.
 weather_sum sum_conditions( const time_point &start, const time_point &end,
                             const tripoint_abs_ms &location )
@@ -189,7 +318,15 @@ weather_sum sum_conditions( const time_point &start, const time_point &end,
     time_duration tick_size = 0_turns;
     weather_sum data;
 
+    // Wind is taken as it is now for the whole span, so it doesn't need to be sampled per tick
     weather_manager &weather = get_weather();
+    const int local_windpower = get_local_windpower( weather.windspeed,
+                                overmap_buffer.ter( project_to<coords::omt>( location ) ),
+                                location, weather.winddirection, false );
+    if( start < end ) {
+        data.wind_amount = local_windpower * to_turns<int>( end - start );
+    }
+    data.rain_amount = rain_amount_between( start, end, location );
     for( time_point t = start; t < end; t += tick_size ) {
         const time_duration diff = end - t;
         if( diff < 10_turns ) {
@@ -202,10 +339,6 @@ weather_sum sum_conditions( const time_point &start, const time_point &end,
 
         weather_type_id wtype = current_weather( location, t );
         proc_weather_sum( wtype, data, t, tick_size );
-        data.wind_amount += get_local_windpower( weather.windspeed,
-                            overmap_buffer.ter( project_to<coords::omt>( location ) ),
-                            location,
-                            weather.winddirection, false ) * to_turns<int>( tick_size );
     }
     return data;
 }
@@ -222,11 +355,11 @@ void retroactively_fill_from_funnel( item &it, const trap &tr, const time_point
 
     // bday == last fill check
     it.set_birthday( end );
-    weather_sum data = sum_conditions( start, end, pos );
+    const int rain_amount = rain_amount_between( start, end, pos );
 
     // Technically 0.0 division is OK, but it will be cleaner without it
-    if( data.rain_amount > 0 ) {
-        const int rain = roll_remainder( 1.0 / tr.funnel_turns_per_charge( data.rain_amount ) );
+    if( rain_amount > 0 ) {
+        const int rain = roll_remainder( 1.0 / tr.funnel_turns_per_charge( rain_amount ) );
         it.add_rain_to_container( rain );
         // add_msg_debug( "Retroactively adding %d water from turn %d to %d", rain, startturn, endturn);
     }
@@ -559,7 +692,7 @@ std::string weather_forecast( const point_abs_sm &abs_sm_pos )
                                  1_hours;
     for( int d = 0; d < 6; d++ ) {
         weather_type_id forecast = WEATHER_NULL;
-        const weather_generator wgen = get_weather().get_cur_weather_gen();
+        const weather_generator &wgen = get_weather().get_cur_weather_gen();
         for( time_point i = last_hour + d * 12_hours; i < last_hour + ( d + 1 ) * 12_hours; i += 1_hours ) {
             w_point w = wgen.get_weather( abs_ms_pos, i, g->get_seed() );
             *weather.weather_precise = w;
@@ -985,9 +1118,19 @@ units::temperature weather_manager::get_temperature( const tripoint_abs_omt &loc
     return location.z() < 0 ? AVERAGE_ANNUAL_TEMPERATURE : temperature;
 }
 
+const heat_sources &weather_manager::get_heat_sources( const tripoint &location )
+{
+    const auto cached = heat_source_cache.find( location );
+    if( cached != heat_source_cache.end() ) {
+        return cached->second;
+    }
+    return heat_source_cache.emplace( location, scan_heat_sources( location ) ).first->second;
+}
+
 void weather_manager::clear_temp_cache()
 {
     temperature_cache.clear();
+    heat_source_cache.clear();
 }
 
 const weather_manager &get_weather_const()
@@ -144,6 +144,13 @@ int get_local_humidity( double humidity, const weather_type_id &weather, bool sh
 int get_local_windpower( int windpower, const oter_id &omter, const tripoint_abs_ms &location,
                          const int &winddirection,
                          bool sheltered = false );
+/**
+ * Rain that fell at @p location between @p start and @p end, as summed up in
+ * @ref weather_sum::rain_amount. Served from prefix sums shared by everything on the same
+ * overmap terrain, so repeated queries don't sample the weather again.
+ */
+int rain_amount_between( const time_point &start, const time_point &end,
+                         const tripoint_abs_ms &location );
 weather_sum sum_conditions( const time_point &start,
                             const time_point &end,
                             const tripoint_abs_ms &location );
@@ -195,6 +202,14 @@ float incident_sun_irradiance( const weather_type_id &wtype,
 
 void weather_sound( const translation &sound_message, const std::string &sound_effect );
 
+/** Heat reaching a tile from fires and hot terrain nearby. */
+struct heat_sources {
+    // Temperature modifier from direct heat radiation
+    units::temperature_delta radiation = 0_C_delta;
+    // Heat intensity of the hottest adjacent fire
+    int best_fire = 0;
+};
+
 class weather_manager
 {
     public:
@@ -223,6 +238,10 @@ class weather_manager
         time_point nextweather;
         /** temperature cache, cleared every turn, sparse map of map tripoints to temperatures */
         std::unordered_map< tripoint, units::temperature > temperature_cache;
+        /** Heat sources around map tripoints, cleared along with @ref temperature_cache */
+        std::unordered_map< tripoint, heat_sources > heat_source_cache;
+        // Heat sources around given location, shared by everything standing there this turn
+        const heat_sources &get_heat_sources( const tripoint &location );
         // Returns outdoor or indoor temperature of given location
         units::temperature get_temperature( const tripoint &location );
         // Returns outdoor or indoor temperature of given location
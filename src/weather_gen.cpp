@@ -47,20 +47,12 @@ struct weather_gen_common {
     season_type season = season_type::SPRING;
 };
 
-static weather_gen_common get_common_data( const tripoint &location, const time_point &real_t,
-        unsigned seed )
+// The parts of weather_gen_common that only depend on the time.
+static void set_time_data( weather_gen_common &result, const time_point &real_t,
+                           const season_effective_time &t )
 {
-    season_effective_time t( real_t );
-    weather_gen_common result;
-    // Integer x position / widening factor of the Perlin function.
-    result.x = location.x / 2000.0;
-    // Integer y position / widening factor of the Perlin function.
-    result.y = location.y / 2000.0;
     // Integer turn / widening factor of the Perlin function.
     result.z = to_days<double>( real_t - calendar::turn_zero );
-    // Limit the random seed during noise calculation, a large value flattens the noise generator to zero
-    // Windows has a rand limit of 32768, other operating systems can have higher limits
-    result.modSEED = seed % SIMPLEX_NOISE_RANDOM_SEED_LIMIT;
     const double year_fraction( time_past_new_year( t.t ) /
                                 calendar::year_length() ); // [0,1)
 
@@ -70,6 +62,21 @@ static weather_gen_common get_common_data( const tripoint &location, const time_
     // start when spring starts. Gregorian years start when
     // winter starts.)
     result.season = season_of_year( t.t );
+}
+
+static weather_gen_common get_common_data( const tripoint &location, const time_point &real_t,
+        unsigned seed )
+{
+    season_effective_time t( real_t );
+    weather_gen_common result;
+    // Integer x position / widening factor of the Perlin function.
+    result.x = location.x / 2000.0;
+    // Integer y position / widening factor of the Perlin function.
+    result.y = location.y / 2000.0;
+    // Limit the random seed during noise calculation, a large value flattens the noise generator to zero
+    // Windows has a rand limit of 32768, other operating systems can have higher limits
+    result.modSEED = seed % SIMPLEX_NOISE_RANDOM_SEED_LIMIT;
+    set_time_data( result, real_t, t );
 
     return result;
 }
@@ -111,6 +118,22 @@ units::temperature weather_generator::get_weather_temperature(
     return weather_temperature_from_common_data( *this, get_common_data( location, real_t, seed ),
             season_effective_time( real_t ) );
 }
+std::vector<units::temperature> weather_generator::get_weather_temperatures(
+    const tripoint &location, const time_point &first, const time_duration &step, const int count,
+    const unsigned seed ) const
+{
+    std::vector<units::temperature> temperatures;
+    temperatures.reserve( std::max( count, 0 ) );
+    weather_gen_common common = get_common_data( location, first, seed );
+    for( int i = 0; i < count; ++i ) {
+        const time_point real_t = first + step * i;
+        const season_effective_time t( real_t );
+        set_time_data( common, real_t, t );
+        temperatures.push_back( weather_temperature_from_common_data( *this, common, t ) );
+    }
+    return temperatures;
+}
+
 w_point weather_generator::get_weather( const tripoint_abs_ms &location, const time_point &real_t,
                                         unsigned seed ) const
 {
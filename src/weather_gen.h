@@ -70,6 +70,13 @@ class weather_generator
         void test_weather( unsigned seed ) const;
         void sort_weather();
         units::temperature get_weather_temperature( const tripoint &, const time_point &, unsigned ) const;
+        /**
+         * Same as calling get_weather_temperature() for the @p count times
+         * first, first + step, first + 2 * step, ... at one location, but shares the work that
+         * only depends on the location between them.
+         */
+        std::vector<units::temperature> get_weather_temperatures( const tripoint &location,
+                const time_point &first, const time_duration &step, int count, unsigned seed ) const;
 
         static weather_generator load( const JsonObject &jo );
 };
@@ -1,5 +1,9 @@
 #include "widget.h"
 
+#include <map>
+#include <tuple>
+
+#include "calendar.h"
 #include "character_martial_arts.h"
 #include "color.h"
 #include "condition.h"
@@ -44,6 +48,7 @@ void widget::load_widget( const JsonObject &jo, const std::string &src )
 
 void widget::reset()
 {
+    clear_draw_cache();
     widget_factory.reset();
 }
 
@@ -518,6 +523,7 @@ int widget::finalize_label_width_recursive( const widget_id &id )
 void widget::finalize_inherited_fields_recursive( const widget_id &id,
         const std::string &label_separator, const int col_padding )
 {
+    clear_draw_cache();
     widget *w = nullptr;
     // Get the original widget from the widget factory.
     for( const widget &wgt : widget::get_all() ) {
@@ -908,6 +914,124 @@ int widget::custom_draw_multiline( const std::string &widget_string, const catac
     return row_num;
 }
 
+namespace
+{
+// How long the text shown for a widget var stays valid in the sidebar
+enum class widget_var_lifetime : int {
+    // Toggled without spending moves, so evaluated on every draw
+    draw,
+    // Changes only when the avatar acts or the turn advances
+    action,
+    // Changes only when the hour rolls over
+    hour
+};
+
+struct widget_text_cache_entry {
+    std::string text;
+    // Layout may adjust the height of the widget it ran on
+    int height = 0;
+    const avatar *ava = nullptr;
+    time_point turn;
+    int moves = 0;
+};
+
+using widget_text_cache_key = std::tuple<widget_id, int, int, bool>;
+
+std::map<widget_id, widget_var_lifetime> &get_lifetime_cache()
+{
+    static std::map<widget_id, widget_var_lifetime> lifetimes;
+    return lifetimes;
+}
+
+std::map<widget_text_cache_key, widget_text_cache_entry> &get_text_cache()
+{
+    static std::map<widget_text_cache_key, widget_text_cache_entry> texts;
+    return texts;
+}
+} // namespace
+
+static widget_var_lifetime var_lifetime( const widget_var var )
+{
+    switch( var ) {
+        case widget_var::move_count_mode_text:
+        case widget_var::safe_mode_text:
+        case widget_var::safe_mode_classic_text:
+        case widget_var::style_text:
+        case widget_var::veh_azimuth_text:
+        case widget_var::veh_cruise_text:
+        case widget_var::veh_fuel_text:
+        case widget_var::wielding_text:
+        case widget_var::wielding_mode_text:
+        case widget_var::wielding_ammo_text:
+            return widget_var_lifetime::draw;
+        case widget_var::date_text:
+            return widget_var_lifetime::hour;
+        default:
+            return widget_var_lifetime::action;
+    }
+}
+
+// Shortest lifetime of the widget and every child any of its clauses may lay out
+static widget_var_lifetime widget_lifetime( const widget_id &wid )
+{
+    std::map<widget_id, widget_var_lifetime> &lifetimes = get_lifetime_cache();
+    const auto iter = lifetimes.find( wid );
+    if( iter != lifetimes.end() ) {
+        return iter->second;
+    }
+    const widget &wgt = wid.obj();
+    widget_var_lifetime ret = widget_var_lifetime::hour;
+    if( wgt._style == "layout" ) {
+        for( const widget_id &child : wgt.possible_widgets() ) {
+            ret = std::min( ret, widget_lifetime( child ) );
+        }
+    } else if( wgt._var != widget_var::last ) {
+        ret = var_lifetime( wgt._var );
+    }
+    // Clause conditions may read any avatar state
+    if( !wgt._clauses.empty() ) {
+        ret = std::min( ret, widget_var_lifetime::action );
+    }
+    lifetimes.emplace( wid, ret );
+    return ret;
+}
+
+// Lay out a sidebar widget, reusing the text from an earlier draw while none of its vars
+// can have changed. Only the panel drawing goes through this, direct layout() calls always
+// evaluate every var.
+static std::string cached_layout( widget &wgt, const avatar &ava, const int width,
+                                  const int label_width, const bool skip_pad )
+{
+    const widget_var_lifetime lifetime = widget_lifetime( wgt.getId() );
+    if( lifetime == widget_var_lifetime::draw ) {
+        return wgt.layout( ava, width, label_width, skip_pad );
+    }
+    time_point turn = calendar::turn;
+    int moves = ava.get_moves();
+    if( lifetime == widget_var_lifetime::hour ) {
+        turn = calendar::turn_zero + 1_hours * to_hours<int>( calendar::turn - calendar::turn_zero );
+        moves = 0;
+    }
+    widget_text_cache_entry &entry = get_text_cache()[widget_text_cache_key( wgt.getId(), width,
+                                     label_width, skip_pad )];
+    if( entry.ava != &ava || entry.turn != turn || entry.moves != moves ) {
+        entry.text = wgt.layout( ava, width, label_width, skip_pad );
+        entry.height = wgt._height;
+        entry.ava = &ava;
+        entry.turn = turn;
+        entry.moves = moves;
+    } else {
+        wgt._height = entry.height;
+    }
+    return entry.text;
+}
+
+void widget::clear_draw_cache()
+{
+    get_lifetime_cache().clear();
+    get_text_cache().clear();
+}
+
 // Drawing function, provided as a callback to the window_panel constructor.
 // Handles rendering a widget's content into a window panel.
 static int custom_draw_func( const draw_args &args )
@@ -943,8 +1067,8 @@ static int custom_draw_func( const draw_args &args )
             for( const widget_id &row_wid : widgets ) {
                 widget row_widget = row_wid.obj();
 
-                const std::string txt = row_widget.layout( u, widt, wgt->_label_width,
-                                        skip_pad || row_wid->has_flag( json_flag_W_NO_PADDING ) );
+                const std::string txt = cached_layout( row_widget, u, widt, wgt->_label_width,
+                                                       skip_pad || row_wid->has_flag( json_flag_W_NO_PADDING ) );
                 if( row_wid->has_flag( json_flag_W_DISABLED_WHEN_EMPTY ) && txt.empty() ) {
                     // reclaim the skipped height in the sidebar
                     height_diff -= row_widget._height;
@@ -966,7 +1090,7 @@ static int custom_draw_func( const draw_args &args )
             // For now, this is the default when calling layout()
             // So, just layout self on a single line
 
-            const std::string txt = wgt->layout( u, widt, wgt->_label_width, skip_pad );
+            const std::string txt = cached_layout( *wgt, u, widt, wgt->_label_width, skip_pad );
             if( disable_empty && txt.empty() ) {
                 // reclaim the skipped height in the sidebar
                 height_diff -= wgt->_height;
@@ -977,7 +1101,7 @@ static int custom_draw_func( const draw_args &args )
         }
     } else {
         // No layout, just a widget
-        const std::string txt = wgt->layout( u, widt, 0, skip_pad );
+        const std::string txt = cached_layout( *wgt, u, widt, 0, skip_pad );
         if( disable_empty && txt.empty() ) {
             // reclaim the skipped height in the sidebar
             height_diff -= wgt->_height;
@@ -1376,6 +1500,15 @@ std::string widget::sym_text( bool from_condition, int width )
     return _string.translated();
 }
 
+std::vector<widget_id> widget::possible_widgets() const
+{
+    std::vector<widget_id> ret = _widgets;
+    for( const widget_clause &clause : _clauses ) {
+        ret.insert( ret.end(), clause.widgets.begin(), clause.widgets.end() );
+    }
+    return ret;
+}
+
 std::vector<string_id<widget>> widget::widgets( bool from_condition )
 {
     if( from_condition ) {
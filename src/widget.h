@@ -311,6 +311,8 @@ class widget
         // label area, so the returned string is equal to max_width.
         std::string layout( const avatar &ava, unsigned int max_width = 0, int label_width = 0,
                             bool skip_pad = false );
+        // Drop the text kept from earlier sidebar draws, for when widget definitions change
+        static void clear_draw_cache();
         // Display labeled widget, with value (number, graph, or string) from an avatar
         std::string show( const avatar &ava, unsigned int max_width );
         // Return a window_panel for rendering this widget at given width (and possibly height)
@@ -359,6 +361,8 @@ class widget
         std::vector<string_id<widget>> widgets( bool from_condition );
         // Return the widgets from all true conditional clauses in this widget
         std::vector<string_id<widget>> widgets_cond();
+        // Return every widget this layout may show, whichever of its clauses hold
+        std::vector<widget_id> possible_widgets() const;
         // Return the graph part of this widget, rendered with "bucket" or "pool" fill
         std::string graph( int value ) const;
         // Takes a string generated by widget::layout and draws the text to the window w.
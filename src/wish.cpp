@@ -951,16 +951,16 @@ class wish_item_callback: public uilist_callback
 
                 if( !tmp.type->snippet_category.empty() ) {
                     if( renew_snippet ) {
-                        last_snippet_id = tmp.snip_id.str();
+                        last_snippet_id = tmp.get_snippet_id().str();
                         renew_snippet = false;
                     } else if( chosen_snippet_id.first == entnum && !chosen_snippet_id.second.empty() ) {
                         std::string snip = chosen_snippet_id.second;
                         if( snippet_id( snip ).is_valid() || snippet_id( snip ) == snippet_id::NULL_ID() ) {
-                            tmp.snip_id = snippet_id( snip );
+                            tmp.set_snippet( snippet_id( snip ) );
                             last_snippet_id = snip;
                         }
                     } else {
-                        tmp.snip_id = snippet_id( last_snippet_id );
+                        tmp.set_snippet( snippet_id( last_snippet_id ) );
                     }
                 }
 
@@ -1091,7 +1091,7 @@ void debug_menu::wishitem( Character *you, const tripoint &pos )
             }
             if( !granted.type->snippet_category.empty() && ( snippet_id( snipped_id_str ).is_valid() ||
                     snippet_id( snipped_id_str ) == snippet_id::NULL_ID() ) ) {
-                granted.snip_id = snippet_id( snipped_id_str );
+                granted.set_snippet( snippet_id( snipped_id_str ) );
             }
 
             prev_amount = amount;
@@ -0,0 +1,108 @@
+#include "worker_pool.h"
+
+#include <algorithm>
+
+// Set while a thread is running a job, so nested batches run inline instead of deadlocking.
+static thread_local bool running_pool_job = false;
+
+worker_pool::worker_pool( const unsigned int num_workers )
+{
+    workers.reserve( num_workers );
+    for( unsigned int i = 0; i < num_workers; ++i ) {
+        workers.emplace_back( &worker_pool::worker_loop, this );
+    }
+}
+
+worker_pool::~worker_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock( mut );
+        stopping = true;
+    }
+    batch_ready.notify_all();
+    for( std::thread &t : workers ) {
+        t.join();
+    }
+}
+
+void worker_pool::parallel_for( const size_t count, const std::function<void( size_t )> &job )
+{
+    if( workers.empty() || count < 2 || running_pool_job ) {
+        for( size_t i = 0; i < count; ++i ) {
+            job( i );
+        }
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock( mut );
+    current_job = &job;
+    next_index = 0;
+    job_count = count;
+    ++generation;
+    batch_ready.notify_all();
+
+    run_jobs( lock );
+    batch_done.wait( lock, [this] {
+        return next_index >= job_count && jobs_running == 0;
+    } );
+
+    current_job = nullptr;
+    std::exception_ptr error = first_error;
+    first_error = nullptr;
+    lock.unlock();
+
+    if( error ) {
+        std::rethrow_exception( error );
+    }
+}
+
+void worker_pool::run_jobs( std::unique_lock<std::mutex> &lock )
+{
+    while( current_job != nullptr && next_index < job_count ) {
+        const std::function<void( size_t )> &job = *current_job;
+        const size_t index = next_index++;
+        ++jobs_running;
+        lock.unlock();
+
+        std::exception_ptr error;
+        running_pool_job = true;
+        try {
+            job( index );
+        } catch( ... ) {
+            error = std::current_exception();
+        }
+        running_pool_job = false;
+
+        lock.lock();
+        if( error && !first_error ) {
+            first_error = error;
+        }
+        --jobs_running;
+    }
+    if( jobs_running == 0 ) {
+        batch_done.notify_all();
+    }
+}
+
+void worker_pool::worker_loop()
+{
+    unsigned int seen_generation = 0;
+    std::unique_lock<std::mutex> lock( mut );
+    while( true ) {
+        batch_ready.wait( lock, [&] {
+            return stopping || generation != seen_generation;
+        } );
+        if( stopping ) {
+            return;
+        }
+        seen_generation = generation;
+        run_jobs( lock );
+    }
+}
+
+worker_pool &get_worker_pool()
+{
+    // Leave a core for the main thread, which also takes part in every batch.
+    static worker_pool pool( std::clamp( std::thread::hardware_concurrency(), 1U, 8U ) - 1 );
+    return pool;
+}
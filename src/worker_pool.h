@@ -0,0 +1,74 @@
+#pragma once
+#ifndef CATA_SRC_WORKER_POOL_H
+#define CATA_SRC_WORKER_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#else
+#   include <thread>
+#endif
+
+/**
+ * A small fixed-size pool of worker threads for splitting independent,
+ * CPU-bound work (e.g. per-z-level cache rebuilds) across cores.
+ *
+ * The pool only runs one batch at a time, and the calling thread takes part
+ * in the batch, so a pool with zero workers degrades to a plain serial loop.
+ * Jobs must not touch shared mutable state; in particular they must not call
+ * into the UI, the message log or anything else that is only safe on the
+ * main thread.
+ */
+class worker_pool
+{
+    public:
+        explicit worker_pool( unsigned int num_workers );
+        ~worker_pool();
+
+        worker_pool( const worker_pool & ) = delete;
+        worker_pool &operator=( const worker_pool & ) = delete;
+
+        /**
+         * Calls @p job once for every index in [0, count), spread across the
+         * workers and the calling thread, and returns once all calls have
+         * finished. The order in which indices are processed is unspecified.
+         * If any call throws, the first exception is rethrown here after the
+         * whole batch has completed.
+         */
+        void parallel_for( size_t count, const std::function<void( size_t )> &job );
+
+        /** Number of worker threads, not counting the calling thread. */
+        size_t num_workers() const {
+            return workers.size();
+        }
+
+    private:
+        void worker_loop();
+        // Runs jobs from the current batch until none are left. Expects @ref mut to be held.
+        void run_jobs( std::unique_lock<std::mutex> &lock );
+
+        std::vector<std::thread> workers;
+        std::mutex mut;
+        std::condition_variable batch_ready;
+        std::condition_variable batch_done;
+
+        const std::function<void( size_t )> *current_job = nullptr;
+        size_t next_index = 0;
+        size_t job_count = 0;
+        size_t jobs_running = 0;
+        // Incremented for every batch, so sleeping workers can tell a new batch from a spurious wakeup.
+        unsigned int generation = 0;
+        bool stopping = false;
+        std::exception_ptr first_error;
+};
+
+/** Shared pool sized for the host machine, created on first use. */
+worker_pool &get_worker_pool();
+
+#endif // CATA_SRC_WORKER_POOL_H
@@ -265,7 +265,7 @@ WORLD *worldfactory::make_new_world( special_game_type special_type )
     // Look through all worlds and see if a world named worldname already exists. If so, then just return it instead of
     // making a new world.
     if( has_world( worldname ) ) {
-        return all_worlds[worldname].get();
+        return get_world( worldname );
     }
 
     std::unique_ptr<WORLD> special_world = std::make_unique<WORLD>();
@@ -284,6 +284,7 @@ void worldfactory::set_active_world( WORLD *world )
 {
     world_generator->active_world = world;
     if( world ) {
+        world->load_details();
         get_options().set_world_options( &world->WORLD_OPTIONS );
     } else {
         get_options().set_world_options( nullptr );
@@ -361,21 +362,14 @@ void worldfactory::init()
         worldname = world_dir.substr( name_index + 1 );
 
         // create and store the world
-        all_worlds[worldname] = std::make_unique<WORLD>();
-        // give the world a name
-        all_worlds[worldname]->world_name = worldname;
+        all_worlds[worldname] = std::make_unique<WORLD>( worldname );
         // add sav files
         for( auto &world_sav_file : world_sav_files ) {
             all_worlds[worldname]->world_saves.push_back( save_t::from_base_path( world_sav_file ) );
         }
-        mman->load_mods_list( all_worlds[worldname].get() );
-
-        // load options into the world
-        if( !all_worlds[worldname]->load_options() ) {
-            all_worlds[worldname]->WORLD_OPTIONS = get_options().get_world_defaults();
-            all_worlds[worldname]->WORLD_OPTIONS["WORLD_END"].setValue( "delete" );
-            all_worlds[worldname]->save();
-        }
+        // Mods and options are only read once the world is used, so that listing many
+        // worlds stays quick.
+        all_worlds[worldname]->details_loaded = false;
     };
 
     // This returns files as well, but they are going to be discarded later as
@@ -394,7 +388,8 @@ void worldfactory::init()
         // @TODO import directly into the new world instead of having this dummy "save" world.
         add_existing_world( "save" );
 
-        const WORLD &old_world = *all_worlds["save"];
+        WORLD &old_world = *all_worlds["save"];
+        old_world.load_details();
 
         std::unique_ptr<WORLD> newworld = std::make_unique<WORLD>();
         newworld->world_name = get_next_valid_worldname();
@@ -450,7 +445,7 @@ WORLD *worldfactory::pick_world( bool show_prompt, bool empty_only )
     // Filter out special worlds (TUTORIAL | DEFENSE) from world_names.
     for( std::vector<std::string>::iterator it = world_names.begin(); it != world_names.end(); ) {
         if( *it == "TUTORIAL" || *it == "DEFENSE" ||
-            ( empty_only && !get_world( *it )->world_saves.empty() ) ) {
+            ( empty_only && !all_worlds.at( *it )->world_saves.empty() ) ) {
             it = world_names.erase( it );
         } else {
             ++it;
@@ -467,7 +462,7 @@ WORLD *worldfactory::pick_world( bool show_prompt, bool empty_only )
     // If we're skipping prompts, return the world with 0 save if there is one
     else if( !show_prompt ) {
         for( const std::string &name : world_names ) {
-            if( get_world( name )->world_saves.empty() ) {
+            if( all_worlds.at( name )->world_saves.empty() ) {
                 return get_world( name );
             }
         }
@@ -583,7 +578,7 @@ WORLD *worldfactory::pick_world( bool show_prompt, bool empty_only )
             wmove( w_worlds, point( 4, static_cast<int>( i ) ) );
 
             std::string world_name = ( world_pages[selpage] )[i];
-            size_t saves_num = get_world( world_name )->world_saves.size();
+            size_t saves_num = all_worlds.at( world_name )->world_saves.size();
 
             if( sel_this ) {
                 wprintz( w_worlds, hilite( c_yellow ), "» " );
@@ -1983,6 +1978,20 @@ void WORLD::load_options( const JsonArray &options_json )
     }
 }
 
+void WORLD::load_details()
+{
+    if( details_loaded ) {
+        return;
+    }
+    details_loaded = true;
+    world_generator->get_mod_manager().load_mods_list( this );
+    if( !load_options() ) {
+        WORLD_OPTIONS = get_options().get_world_defaults();
+        WORLD_OPTIONS["WORLD_END"].setValue( "delete" );
+        save();
+    }
+}
+
 bool WORLD::load_options()
 {
     WORLD_OPTIONS = get_options().get_world_defaults();
@@ -2050,6 +2059,7 @@ WORLD *worldfactory::get_world( const std::string &name )
         debugmsg( "Requested non-existing world %s, prepare for crash", name );
         return nullptr;
     }
+    iter->second->load_details();
     return iter->second.get();
 }
 
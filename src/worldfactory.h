@@ -67,6 +67,11 @@ struct WORLD {
          * should be loaded for this world.
          */
         std::vector<mod_id> active_mod_order;
+        /**
+         * False for worlds that were only listed by @ref worldfactory::init, whose mods
+         * and options are read by @ref load_details once the world is used.
+         */
+        bool details_loaded = true;
 
         WORLD();
         explicit WORLD( const std::string &name );
@@ -79,6 +84,8 @@ struct WORLD {
 
         void load_options( const JsonArray &options_json );
         bool load_options();
+        /** Reads the mod list and options of the world, unless that happened already. */
+        void load_details();
 };
 
 class mod_manager;
@@ -97,7 +104,7 @@ class worldfactory
         // Used for unit tests - does NOT verify if the mods can be loaded
         WORLD *make_new_world( const std::string &name, const std::vector<mod_id> &mods );
         WORLD *make_new_world( const std::vector<mod_id> &mods );
-        /// Returns the *existing* world of given name.
+        /// Returns the *existing* world of given name, with its mods and options loaded.
         WORLD *get_world( const std::string &name );
         /// Returns the *existing* world's name from its index in the world list.
         std::string get_world_name( size_t index );
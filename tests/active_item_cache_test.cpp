@@ -1,5 +1,8 @@
+#include <list>
 #include <set>
+#include <vector>
 
+#include "active_item_cache.h"
 #include "calendar.h"
 #include "cata_catch.h"
 #include "game_constants.h"
@@ -40,3 +43,94 @@ TEST_CASE( "place_active_item_at_various_coordinates", "[item]" )
         }
     }
 }
+
+TEST_CASE( "low_priority_items_are_spread_over_more_turns", "[item]" )
+{
+    // Food is processed every 10 minutes, i.e. a 600th of the list each turn.
+    std::list<item> apples( 1200, item( "apple" ) );
+    active_item_cache cache;
+    for( item &apple : apples ) {
+        REQUIRE( apple.processing_speed() == to_turns<int>( 10_minutes ) );
+        cache.add( apple, point_zero );
+    }
+    CHECK( cache.low_priority_per_turn() == 3 );
+
+    std::vector<item_reference> to_process;
+    cache.get_for_processing( to_process );
+    CHECK( to_process.size() == 3 );
+    cache.get_for_processing( to_process, 2 );
+    CHECK( to_process.size() == 2 );
+    cache.get_for_processing( to_process, 4 );
+    CHECK( to_process.size() == 1 );
+
+    // Stretched out, every item still gets its turn.
+    std::set<const item *> seen;
+    for( int turn = 0; turn < 1200; ++turn ) {
+        cache.get_for_processing( to_process, 2 );
+        for( item_reference &ref : to_process ) {
+            seen.insert( ref.item_ref.get() );
+        }
+    }
+    CHECK( seen.size() == apples.size() );
+}
+
+TEST_CASE( "active_item_cache_skips_duplicates_and_destroyed_items", "[item]" )
+{
+    std::list<item> apples( 10, item( "apple" ) );
+    active_item_cache cache;
+    for( item &apple : apples ) {
+        cache.add( apple, point_zero );
+        cache.add( apple, point_zero );
+    }
+    CHECK( cache.get().size() == apples.size() );
+
+    apples.pop_front();
+    std::vector<item_reference> to_process;
+    for( int turn = 0; turn < to_turns<int>( 10_minutes ); ++turn ) {
+        cache.get_for_processing( to_process );
+    }
+    CHECK( cache.get().size() == apples.size() );
+
+    // Items added after references were dropped are still recognized.
+    apples.emplace_back( "apple" );
+    cache.add( apples.back(), point_zero );
+    cache.add( apples.back(), point_zero );
+    CHECK( cache.get().size() == apples.size() );
+}
+
+TEST_CASE( "active_item_cache_benchmark", "[.][item][benchmark]" )
+{
+    std::list<item> apples( 10000, item( "apple" ) );
+    std::list<item> lit( 1000, item( "firecracker_act", calendar::turn_zero,
+                                     item::default_charges_tag() ) );
+    for( item &it : lit ) {
+        it.activate();
+    }
+
+    BENCHMARK( "add 11000 items" ) {
+        active_item_cache cache;
+        for( item &it : apples ) {
+            cache.add( it, point_zero );
+        }
+        for( item &it : lit ) {
+            cache.add( it, point_zero );
+        }
+        return cache.empty();
+    };
+
+    active_item_cache cache;
+    for( item &it : apples ) {
+        cache.add( it, point_zero );
+    }
+    for( item &it : lit ) {
+        cache.add( it, point_zero );
+    }
+    std::vector<item_reference> to_process;
+    BENCHMARK( "get_for_processing" ) {
+        cache.get_for_processing( to_process );
+        return to_process.size();
+    };
+    BENCHMARK( "get" ) {
+        return cache.get().size();
+    };
+}
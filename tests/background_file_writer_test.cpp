@@ -0,0 +1,28 @@
+#include <string>
+
+#include "background_file_writer.h"
+#include "cata_catch.h"
+#include "filesystem.h"
+#include "path_info.h"
+
+TEST_CASE( "background_file_writer_writes_and_removes_in_order", "[save]" )
+{
+    const cata_path path = PATH_INFO::savedir_path() / "background_file_writer_test.txt";
+    const fs::path real_path = path.get_unrelative_path();
+    background_file_writer writer;
+
+    writer.write( path, "first" );
+    writer.write( path, "second" );
+    writer.flush( path );
+    CHECK( writer.idle() );
+    CHECK( read_entire_file( real_path ) == "second" );
+
+    writer.remove( path );
+    writer.write( path, "third" );
+    writer.flush();
+    CHECK( read_entire_file( real_path ) == "third" );
+
+    writer.remove( path );
+    writer.flush();
+    CHECK_FALSE( fs::exists( real_path ) );
+}
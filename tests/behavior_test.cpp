@@ -2,14 +2,17 @@
 #include <iosfwd>
 #include <list>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "behavior.h"
+#include "behavior_oracle.h"
 #include "behavior_strategy.h"
 #include "cata_catch.h"
 #include "character_oracle.h"
 #include "item.h"
 #include "item_location.h"
+#include "json_loader.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "map_iterator.h"
@@ -151,6 +154,54 @@ TEST_CASE( "behavior_tree", "[behavior]" )
     CHECK( maslows.tick( nullptr ) == "idle" );
 }
 
+static behavior::node_t load_test_node( const std::string &json )
+{
+    behavior::node_t node;
+    const JsonValue jsin = json_loader::from_string( json );
+    node.load( jsin.get_object(), "test" );
+    return node;
+}
+
+TEST_CASE( "behavior_predicates_answered_once_per_tick", "[behavior]" )
+{
+    int asked = 0;
+    behavior::predicate_map.emplace( "test_counted_predicate",
+    [&asked]( const behavior::oracle_t *, const std::string_view ) {
+        asked++;
+        return behavior::status_t::success;
+    } );
+    const std::string conditions =
+        R"("conditions": [ { "predicate": "test_counted_predicate", "argument": "x" } ])";
+    behavior::node_t first = load_test_node( R"({ "goal": "first", )" + conditions + " }" );
+    behavior::node_t second = load_test_node( R"({ "goal": "second", )" + conditions + " }" );
+    behavior::node_t root;
+    root.set_strategy( &behavior::default_until_done );
+    root.add_child( &first );
+    root.add_child( &second );
+    behavior::tree tree;
+    tree.add( &root );
+
+    behavior::reset_predicate_counts();
+    behavior::set_predicate_counting( true );
+    behavior::oracle_t oracle;
+    CHECK( tree.tick( &oracle ) == "idle" );
+    CHECK( asked == 1 );
+    // The subject may have changed between ticks
+    CHECK( tree.tick( &oracle ) == "idle" );
+    CHECK( asked == 2 );
+    // Without a subject nothing can be remembered
+    CHECK( tree.tick( nullptr ) == "idle" );
+    CHECK( asked == 4 );
+    behavior::set_predicate_counting( false );
+
+    const behavior::predicate_count &count =
+        behavior::predicate_counts().at( "test_counted_predicate" );
+    CHECK( count.evaluated == 2 );
+    CHECK( count.reused == 2 );
+    behavior::reset_predicate_counts();
+    behavior::predicate_map.erase( "test_counted_predicate" );
+}
+
 // Make assertions about loaded behaviors.
 TEST_CASE( "check_npc_behavior_tree", "[npc][behavior]" )
 {
@@ -11,6 +11,8 @@
 #include "cata_utility.h"
 #include "cata_catch.h"
 #include "debug_menu.h"
+#include "filesystem.h"
+#include "path_info.h"
 #include "units.h"
 #include "units_utility.h"
 
@@ -408,4 +410,33 @@ TEST_CASE( "lcmatch", "[utility][nogame]" )
 
     CHECK( lcmatch( "無効", "無" ) == true );
     CHECK( lcmatch( "無効", "無效" ) == false );
+
+    const std::u32string prepared = lcmatch_prepare( "BÖ" );
+    CHECK( lcmatch( "bö", prepared ) == true );
+    CHECK( lcmatch( "xBÖx", prepared ) == true );
+    CHECK( lcmatch( "bo", prepared ) == false );
+    CHECK( lcmatch( "anything", lcmatch_prepare( "" ) ) == true );
+}
+
+TEST_CASE( "gzip_round_trip", "[utility][save]" )
+{
+    std::string data;
+    for( int i = 0; i < 100000; ++i ) {
+        data += "{\"ter\":\"t_grass\"," + std::to_string( i % 97 ) + "}";
+    }
+    // Larger than the buffers, so data is deflated in several passes
+    const std::string compressed = gzip_compress( data );
+    CHECK( is_gzip( compressed ) );
+    CHECK_FALSE( is_gzip( data ) );
+    CHECK( compressed.size() < data.size() / 4 );
+    CHECK( gzip_decompress( compressed ) == data );
+    CHECK( gzip_decompress( gzip_compress( "" ) ).empty() );
+    CHECK_THROWS( gzip_decompress( compressed.substr( 0, compressed.size() / 2 ) ) );
+
+    const cata_path path = PATH_INFO::savedir_path() / "gzip_round_trip_test.json";
+    write_to_file_compressed( path, [&data]( std::ostream & fout ) {
+        fout << data;
+    } );
+    CHECK( read_whole_file( path.get_unrelative_path() ) == data );
+    fs::remove( path.get_unrelative_path() );
 }
@@ -0,0 +1,58 @@
+#include <vector>
+
+#include "cata_catch.h"
+#include "cellular_automata.h"
+#include "point.h"
+#include "rng.h"
+
+// The rules as written, one checked neighbor at a time
+static std::vector<std::vector<int>> reference_automaton( int width, int height, int alive,
+        int iterations, int birth_limit, int stasis_limit )
+{
+    std::vector<std::vector<int>> current( width, std::vector<int>( height, 0 ) );
+    for( int i = 0; i < width; i++ ) {
+        for( int j = 0; j < height; j++ ) {
+            current[i][j] = x_in_y( alive, 100 );
+        }
+    }
+    for( int iteration = 0; iteration < iterations; iteration++ ) {
+        std::vector<std::vector<int>> next( width, std::vector<int>( height, 0 ) );
+        for( int i = 1; i < width - 1; i++ ) {
+            for( int j = 1; j < height - 1; j++ ) {
+                const int neighbors = CellularAutomata::neighbor_count( current, width, height,
+                                      point( i, j ) );
+                next[i][j] = neighbors > ( current[i][j] ? stasis_limit : birth_limit );
+            }
+        }
+        current = next;
+    }
+    return current;
+}
+
+TEST_CASE( "cellular_automaton_matches_its_rules", "[cellular_automata][nogame]" )
+{
+    const int width = GENERATE( 1, 2, 3, 17, 48 );
+    const int height = GENERATE( 1, 3, 24, 33 );
+    const int iterations = GENERATE( 0, 1, 5 );
+    CAPTURE( width, height, iterations );
+
+    rng_set_engine_seed( 1234 );
+    const std::vector<std::vector<int>> expected = reference_automaton( width, height, 55,
+            iterations, 5, 4 );
+    rng_set_engine_seed( 1234 );
+    CHECK( CellularAutomata::generate_cellular_automaton( width, height, 55, iterations, 5, 4 ) ==
+           expected );
+}
+
+TEST_CASE( "cellular_automaton_benchmark", "[.][cellular_automata][benchmark][nogame]" )
+{
+    BENCHMARK( "reference, 132x132" ) {
+        return reference_automaton( 132, 132, 55, 5, 5, 4 ).size();
+    };
+    BENCHMARK( "nested vectors, 132x132" ) {
+        return CellularAutomata::generate_cellular_automaton( 132, 132, 55, 5, 5, 4 ).size();
+    };
+    BENCHMARK( "flat grid, 132x132" ) {
+        return CellularAutomata::generate_cell_grid( 132, 132, 55, 5, 5, 4 ).cells.size();
+    };
+}
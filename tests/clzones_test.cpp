@@ -314,3 +314,27 @@ TEST_CASE( "zone_sorting_comestibles_", "[zones][items][food][activities]" )
         }
     }
 }
+
+TEST_CASE( "zone_range_queries", "[zones]" )
+{
+    clear_map();
+    zone_manager &zm = zone_manager::get_manager();
+    zm.clear();
+    const tripoint_abs_ms origin_pos;
+    zm.add( "Unsorted", zone_type_LOOT_UNSORTED, faction_your_followers, false, true,
+            tripoint( 5, 0, 0 ), tripoint( 7, 2, 0 ) );
+
+    CHECK_FALSE( zm.has_near( zone_type_LOOT_UNSORTED, origin_pos, 4, faction_your_followers ) );
+    CHECK( zm.has_near( zone_type_LOOT_UNSORTED, origin_pos, 5, faction_your_followers ) );
+    CHECK_FALSE( zm.has_near( zone_type_LOOT_FOOD, origin_pos, 50, faction_your_followers ) );
+
+    // only the part of the zone within range
+    CHECK( zm.get_near( zone_type_LOOT_UNSORTED, origin_pos, 6, nullptr,
+                        faction_your_followers ).size() == 6 );
+    CHECK( zm.get_near( zone_type_LOOT_UNSORTED, origin_pos, 60, nullptr,
+                        faction_your_followers ).size() == 9 );
+
+    CHECK( zm.get_nearest( zone_type_LOOT_UNSORTED, origin_pos, 10, faction_your_followers ) ==
+           tripoint_abs_ms( 5, 0, 0 ) );
+    CHECK_FALSE( zm.get_nearest( zone_type_LOOT_UNSORTED, origin_pos, 4, faction_your_followers ) );
+}
@@ -205,6 +205,32 @@ TEST_CASE( "recipe_subset" )
     }
 }
 
+TEST_CASE( "recipe_requirement_indices_cover_every_recipe", "[recipes]" )
+{
+    for( const auto &e : recipe_dict ) {
+        const recipe *r = &e.second;
+        const requirement_data &reqs = r->simple_requirements();
+        for( const std::vector<item_comp> &opts : reqs.get_components() ) {
+            for( const item_comp &comp : opts ) {
+                CAPTURE( r->ident().str(), comp.type.str() );
+                CHECK( recipe_dict.of_component( comp.type ).count( r ) == 1 );
+            }
+        }
+        for( const std::vector<tool_comp> &opts : reqs.get_tools() ) {
+            for( const tool_comp &tool : opts ) {
+                CAPTURE( r->ident().str(), tool.type.str() );
+                CHECK( recipe_dict.of_tool( tool.type ).count( r ) == 1 );
+            }
+        }
+        for( const std::vector<quality_requirement> &opts : reqs.get_qualities() ) {
+            for( const quality_requirement &qual : opts ) {
+                CAPTURE( r->ident().str(), qual.type.str() );
+                CHECK( recipe_dict.of_quality( qual.type ).count( r ) == 1 );
+            }
+        }
+    }
+}
+
 TEST_CASE( "available_recipes", "[recipes]" )
 {
     const recipe *r = &recipe_magazine_battery_light_mod.obj();
@@ -174,3 +174,23 @@ TEST_CASE( "tiny_character", "[encumbrance]" )
         test_encumbrance_items( { i }, "torso", longshirt_e, add_trait( "SMALL2" ) );
     }
 }
+
+TEST_CASE( "encumbrance_after_body_mass_change_matches_full_recalculation", "[encumbrance]" )
+{
+    Character &p = get_player_character();
+    p.set_body();
+    p.clear_mutations();
+    p.clear_worn();
+    p.worn.wear_item( p, item( "test_longshirt" ), false, false, false );
+    p.worn.wear_item( p, item( "test_jacket_jean" ), false, false, false );
+    p.set_stored_kcal( p.get_healthy_kcal() );
+    p.calc_encumbrance();
+
+    // Only reapplies the body mass penalties on top of the worn items
+    p.set_stored_kcal( p.get_healthy_kcal() * 3 );
+    const encumbrance_data updated = p.get_part_encumbrance_data( bodypart_id( "torso" ) );
+    p.calc_encumbrance();
+    const encumbrance_data full = p.get_part_encumbrance_data( bodypart_id( "torso" ) );
+    CHECK( updated.encumbrance == full.encumbrance );
+    CHECK( updated.layer_penalty == full.layer_penalty );
+}
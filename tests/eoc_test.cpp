@@ -1321,3 +1321,49 @@ TEST_CASE( "EOC_string_test", "[eoc]" )
     CHECK( get_avatar().get_value( "npctalk_var_key2" ) == "nest3" );
     CHECK( get_avatar().get_value( "npctalk_var_key3" ) == "nest4" );
 }
+
+TEST_CASE( "queued_eocs_take_due", "[eoc]" )
+{
+    const time_point start = calendar::turn_zero + 1_days;
+    queued_eocs queue;
+    // Spread over both the wheel and the overflow heap, pushed out of order
+    const std::vector<time_duration> delays = { 3_days, 5_seconds, 90_minutes, 0_seconds, 1_hours,
+                                                5_seconds, 30_days, 61_seconds
+                                              };
+    for( const time_duration &delay : delays ) {
+        queue.push( queued_eoc{ effect_on_condition_EOC_alive_test, start + delay, {} } );
+    }
+
+    CHECK( queue.take_due( start - 1_seconds ).empty() );
+
+    std::vector<queued_eocs::storage_iter> due = queue.take_due( start + 5_seconds );
+    REQUIRE( due.size() == 3 );
+    CHECK( due[0]->time == start );
+    CHECK( due[2]->time == start + 5_seconds );
+
+    // A recurring entry goes back on the schedule
+    due[0]->time = start + 2_hours;
+    queue.reschedule( due[0] );
+    queue.list.erase( due[1] );
+    queue.list.erase( due[2] );
+    CHECK( queue.take_due( start + 5_seconds ).empty() );
+
+    // A big jump collects everything in between, in order
+    due = queue.take_due( start + 4_days );
+    REQUIRE( due.size() == 5 );
+    for( size_t i = 1; i < due.size(); ++i ) {
+        CHECK( due[i - 1]->time <= due[i]->time );
+    }
+    CHECK( due[0]->time == start + 61_seconds );
+    CHECK( due[4]->time == start + 3_days );
+    for( const queued_eocs::storage_iter &it : due ) {
+        queue.list.erase( it );
+    }
+
+    due = queue.take_due( start + 31_days );
+    REQUIRE( due.size() == 1 );
+    CHECK( due[0]->time == start + 30_days );
+
+    queued_eocs copy( queue );
+    CHECK( copy.list.size() == queue.list.size() );
+}
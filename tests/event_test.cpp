@@ -97,3 +97,40 @@ TEST_CASE( "notify_subscriber_2", "[event]" )
     sub.notify( original_event );
     REQUIRE( sub.found );
 }
+
+struct picky_subscriber : public test_subscriber {
+    bool is_interested_in( event_type type ) override {
+        return type == wanted;
+    }
+    void want( event_type type ) {
+        wanted = type;
+        interests_changed();
+    }
+    event_type wanted = event_type::character_kills_monster;
+};
+
+TEST_CASE( "bus_delivers_only_wanted_event_types", "[event]" )
+{
+    event_bus bus;
+    picky_subscriber picky;
+    test_subscriber all;
+    bus.subscribe( &picky );
+    bus.subscribe( &all );
+
+    std::vector<cata::event> burst;
+    for( int i = 0; i < 3; ++i ) {
+        burst.push_back( cata::event::make<event_type::character_kills_monster>(
+                             character_id( 5 ), zombie, i ) );
+    }
+    burst.push_back( cata::event::make<event_type::character_wakes_up>( character_id( 5 ) ) );
+    bus.send( burst );
+    CHECK( picky.events.size() == 3 );
+    CHECK( all.events.size() == 4 );
+    REQUIRE( !picky.events.empty() );
+    CHECK( picky.events.back().get<int>( "exp" ) == 2 );
+
+    picky.want( event_type::character_wakes_up );
+    bus.send( burst );
+    CHECK( picky.events.size() == 4 );
+    CHECK( all.events.size() == 8 );
+}
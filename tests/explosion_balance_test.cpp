@@ -226,3 +226,24 @@ TEST_CASE( "grenade_vs_vehicle", "[grenade],[explosion],[balance]" )
         check_vehicle_damage( "grenade_act", "humvee", 5, 1 );
     }
 }
+
+TEST_CASE( "explosions_queued_together_all_throw_fragments", "[explosion]" )
+{
+    clear_map_and_put_player_underground();
+    clear_creatures();
+    // Far enough apart that each monster is only in reach of one explosion
+    const std::vector<tripoint> origins = { tripoint( 20, 20, 0 ), tripoint( 100, 100, 0 ) };
+    std::vector<monster *> targets;
+    for( const tripoint &origin : origins ) {
+        monster &target = spawn_test_monster( "mon_zombie", origin + point_east );
+        target.no_extra_death_drops = true;
+        targets.push_back( &target );
+        // No blast, only fragments
+        explosion_handler::explosion( nullptr, origin, 50, 0.0f, false, 500, 0.5f );
+    }
+    explosion_handler::process_explosions();
+    CHECK( explosion_handler::_explosions.empty() );
+    for( const monster *target : targets ) {
+        CHECK( target->get_hp() < target->get_hp_max() );
+    }
+}
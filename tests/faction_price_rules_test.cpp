@@ -144,6 +144,16 @@ TEST_CASE( "faction_price_rules", "[npc][factions][trade]" )
         guy.set_value( "npctalk_var_bool_preference_vegan", "yes" );
         REQUIRE( guy.get_price_rules( pants_fur )->markup == -100 );
     }
+    WHEN( "price rules are remembered during a trade" ) {
+        clear_character( guy );
+        faction_price_rule const *const rule = guy.get_price_rules( pants_fur );
+        guy.set_price_rules_cached( true );
+        CHECK( guy.get_price_rules( pants_fur ) == rule );
+        guy.set_value( "npctalk_var_bool_preference_vegan", "yes" );
+        CHECK( guy.get_price_rules( pants_fur ) == rule );
+        guy.set_price_rules_cached( false );
+        CHECK( guy.get_price_rules( pants_fur )->markup == -100 );
+    }
     WHEN( "price rule affects magazine contents" ) {
         clear_character( guy );
         item const battery( "battery" );
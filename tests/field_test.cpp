@@ -2,8 +2,10 @@
 #include <vector>
 
 #include "avatar.h"
+#include "cached_options.h"
 #include "calendar.h"
 #include "cata_catch.h"
+#include "cata_scope_helpers.h"
 #include "effect.h"
 #include "field.h"
 #include "field_type.h"
@@ -349,6 +351,35 @@ TEST_CASE( "wandering_field_test", "[field]" )
     fields_test_cleanup();
 }
 
+TEST_CASE( "deferred_gas_spread", "[field]" )
+{
+    fields_test_setup();
+    restore_on_out_of_scope<bool> restore_deferred( deferred_gas_spread );
+    deferred_gas_spread = true;
+
+    const tripoint p{ 33, 33, 0 };
+    map &m = get_map();
+    // 1 second old, so gets processed right away
+    m.add_field( p, fd_smoke, 3, 1_seconds );
+
+    for( int i = 0; i < 100 && count_fields( fd_smoke ) < 2; ++i ) {
+        calendar::turn += 1_turns;
+        m.process_fields();
+    }
+
+    {
+        INFO( "fd_smoke should have spread once the queued transfers were applied" );
+        REQUIRE( count_fields( fd_smoke ) >= 2 );
+    }
+    for( const tripoint &pnt : m.points_on_zlevel() ) {
+        if( m.get_field( pnt, fd_smoke ) ) {
+            CHECK( square_dist( pnt, p ) <= 2 );
+        }
+    }
+
+    fields_test_cleanup();
+}
+
 TEST_CASE( "radioactive_field", "[field]" )
 {
     fields_test_setup();
@@ -0,0 +1,93 @@
+#include <cstddef>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "flood_fill.h"
+#include "game_constants.h"
+#include "point.h"
+
+// A grid the size of the reality bubble with a wall every few columns, each with a gap
+static bool open_tile( const point &p )
+{
+    return p.x >= 0 && p.x < MAPSIZE_X && p.y >= 0 && p.y < MAPSIZE_Y &&
+           !( p.x % 7 == 3 && p.y % 11 != 0 );
+}
+
+static size_t fill_level( const tripoint_bub_ms &start, ff::flood_fill_scratch *scratch )
+{
+    size_t visited = 0;
+    const auto predicate = []( const tripoint_bub_ms & p, int direction ) {
+        return direction == 0 && open_tile( p.xy().raw() );
+    };
+    const auto visitor = [&visited]( const tripoint_bub_ms & ) {
+        visited++;
+    };
+    if( scratch ) {
+        ff::flood_fill_visit_10_connected( start, predicate, visitor, *scratch );
+    } else {
+        ff::flood_fill_visit_10_connected( start, predicate, visitor );
+    }
+    return visited;
+}
+
+TEST_CASE( "flood_fill_reuses_scratch", "[flood_fill][nogame]" )
+{
+    size_t open_tiles = 0;
+    for( int x = 0; x < MAPSIZE_X; x++ ) {
+        for( int y = 0; y < MAPSIZE_Y; y++ ) {
+            open_tiles += open_tile( point( x, y ) ) ? 1 : 0;
+        }
+    }
+    const tripoint_bub_ms start( 0, 0, 0 );
+    CHECK( fill_level( start, nullptr ) == open_tiles );
+
+    std::unique_ptr<ff::flood_fill_scratch> scratch = std::make_unique<ff::flood_fill_scratch>();
+    CHECK( fill_level( start, scratch.get() ) == open_tiles );
+    // Nothing may be left over from the first fill
+    CHECK( fill_level( start, scratch.get() ) == open_tiles );
+    CHECK( fill_level( tripoint_bub_ms( 0, 0, 1 ), scratch.get() ) == open_tiles );
+}
+
+TEST_CASE( "flood_fill_visit_matches_collected_points", "[flood_fill][nogame]" )
+{
+    std::unordered_set<point> visited_collect;
+    const std::vector<point> collected = ff::point_flood_fill_4_connected( point_zero,
+                                         visited_collect, open_tile );
+
+    std::unordered_set<point> visited_visit;
+    std::vector<point> visited_points;
+    ff::point_flood_fill_4_connected_visit( point_zero, visited_visit, open_tile,
+    [&visited_points]( const point & p ) {
+        visited_points.push_back( p );
+    } );
+    CHECK( visited_points == collected );
+}
+
+TEST_CASE( "flood_fill_benchmark", "[.][flood_fill][benchmark][nogame]" )
+{
+    const tripoint_bub_ms start( 0, 0, 0 );
+    std::unique_ptr<ff::flood_fill_scratch> scratch = std::make_unique<ff::flood_fill_scratch>();
+
+    BENCHMARK( "10 connected, fresh memory" ) {
+        return fill_level( start, nullptr );
+    };
+    BENCHMARK( "10 connected, reused scratch" ) {
+        return fill_level( start, scratch.get() );
+    };
+    BENCHMARK( "4 connected, collected" ) {
+        std::unordered_set<point> visited;
+        return ff::point_flood_fill_4_connected( point_zero, visited, open_tile ).size();
+    };
+    BENCHMARK( "4 connected, visited" ) {
+        std::unordered_set<point> visited;
+        size_t filled = 0;
+        ff::point_flood_fill_4_connected_visit( point_zero, visited, open_tile,
+        [&filled]( const point & ) {
+            filled++;
+        } );
+        return filled;
+    };
+}
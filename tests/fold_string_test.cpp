@@ -106,3 +106,18 @@ TEST_CASE( "fold-string" )
         check_equal( folded.begin(), folded.end(), expected.begin(), expected.end() );
     }
 }
+
+TEST_CASE( "formatted_text_spans", "[output]" )
+{
+    const formatted_text text( "ab<color_red>cé</color>d<color_white></color>", c_white );
+    const std::vector<formatted_text::span> &spans = text.spans();
+    REQUIRE( spans.size() == 3 );
+    CHECK( spans[0].color == c_white );
+    CHECK( spans[0].text == "ab" );
+    CHECK( spans[1].color == c_red );
+    CHECK( spans[1].text == "cé" );
+    CHECK( spans[1].width == 2 );
+    CHECK( spans[2].color == c_white );
+    CHECK( spans[2].text == "d" );
+    CHECK( text.width() == 5 );
+}
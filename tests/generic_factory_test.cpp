@@ -123,6 +123,30 @@ TEST_CASE( "generic_factory_repeated_invalidation", "[generic_factory]" )
     }
 }
 
+TEST_CASE( "generic_factory_lookup_after_finalize", "[generic_factory]" )
+{
+    generic_factory<test_obj> test_factory( "test_factory" );
+    for( int i = 0; i < 100; ++i ) {
+        test_factory.insert( { test_obj_id( "id_" + std::to_string( i ) ), std::to_string( i ) } );
+    }
+    test_factory.finalize();
+
+    // Fresh ids, so the lookup goes through the factory's index rather than the cached cid
+    for( int i = 0; i < 100; ++i ) {
+        const test_obj_id id( "id_" + std::to_string( i ) );
+        CAPTURE( id );
+        REQUIRE( test_factory.is_valid( id ) );
+        CHECK( test_factory.obj( id ).value == std::to_string( i ) );
+    }
+    CHECK_FALSE( test_factory.is_valid( test_obj_id( "id_100" ) ) );
+    CHECK_FALSE( test_factory.is_valid( test_obj_non_existent_id ) );
+
+    // Changes after finalize are still seen
+    test_factory.insert( { test_obj_id( "id_100" ), "100" } );
+    CHECK( test_factory.is_valid( test_obj_id( "id_100" ) ) );
+    CHECK( test_factory.obj( test_obj_id( "id_5" ) ).value == "5" );
+}
+
 TEST_CASE( "generic_factory_common_null_ids", "[generic_factory]" )
 {
     CHECK( itype_id::NULL_ID().is_null() );
@@ -222,6 +246,19 @@ TEST_CASE( "generic_factory_lookup_benchmark", "[.][generic_factory][benchmark]"
     BENCHMARK( "single lookup" ) {
         return test_factory.obj( id_200 ).value;
     };
+
+    // Copies carry no cached cid, so every call probes the id index
+    const test_obj_id uncached( "id_300" );
+    BENCHMARK( "uncached lookup" ) {
+        const test_obj_id id = uncached;
+        return test_factory.obj( id ).value;
+    };
+
+    test_factory.finalize();
+    BENCHMARK( "uncached lookup, finalized" ) {
+        const test_obj_id id = uncached;
+        return test_factory.obj( id ).value;
+    };
 }
 
 TEST_CASE( "string_id_compare_benchmark", "[.][generic_factory][string_id][benchmark]" )
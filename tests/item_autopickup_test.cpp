@@ -617,3 +617,21 @@ TEST_CASE( "auto_pickup_should_not_implicitly_pickup_corpses", "[autopickup][ite
         }
     }
 }
+
+TEST_CASE( "auto_pickup_rules_apply_to_items_checked_before", "[autopickup][item]" )
+{
+    clear_everything();
+    auto_pickup::player_settings &rules = get_auto_pickup();
+
+    const item pebble( itype_pebble );
+    const std::string name = pebble.tname( 1, false );
+    // No rule matches, this must be remembered without hiding rules added later
+    REQUIRE( rules.match_item( pebble, name ) == rule_state::NONE );
+    REQUIRE( rules.match_item( pebble, name ) == rule_state::NONE );
+
+    add_autopickup_rule( &pebble, true );
+    CHECK( rules.match_item( pebble, name ) == rule_state::WHITELISTED );
+
+    rules.clear_character_rules();
+    CHECK( rules.match_item( pebble, name ) == rule_state::NONE );
+}
@@ -14,7 +14,9 @@
 #include "options_helpers.h"
 #include "type_id.h"
 
+static const itype_id itype_2x4( "2x4" );
 static const itype_id itype_match( "match" );
+static const itype_id itype_test_rock( "test_rock" );
 
 TEST_CASE( "truncate_spawn_when_items_dont_fit", "[item_group]" )
 {
@@ -261,3 +263,28 @@ TEST_CASE( "Event-based_item_spawns_do_not_spawn_outside_event", "[item_group]"
         CHECK( items[0].typeId() == test_rock );
     }
 }
+
+TEST_CASE( "distribution_picks_entries_by_weight", "[item_group]" )
+{
+    Item_group group( Item_group::G_DISTRIBUTION, 100, 0, 0, "test distribution" );
+    group.add_item_entry( itype_2x4, 1 );
+    group.add_item_entry( itype_test_rock, 3 );
+    const Item_spawn_data &spawn = group;
+
+    const int rolls = 1000;
+    int rocks = 0;
+    for( int i = 0; i < rolls; ++i ) {
+        const item spawned = spawn.create_single( calendar::turn );
+        REQUIRE( ( spawned.typeId() == itype_2x4 || spawned.typeId() == itype_test_rock ) );
+        if( spawned.typeId() == itype_test_rock ) {
+            rocks++;
+        }
+    }
+    CHECK( rocks == Approx( rolls * 3 / 4 ).margin( 100 ) );
+
+    // The running sums have to follow removed entries
+    group.remove_item( itype_test_rock );
+    for( int i = 0; i < 10; ++i ) {
+        CHECK( spawn.create_single( calendar::turn ).typeId() == itype_2x4 );
+    }
+}
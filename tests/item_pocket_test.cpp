@@ -54,6 +54,7 @@ static const item_group_id Item_spawn_data_wallet_stylish_full( "wallet_stylish_
 
 static const itype_id itype_test_backpack( "test_backpack" );
 static const itype_id itype_test_jug_plastic( "test_jug_plastic" );
+static const itype_id itype_test_rock( "test_rock" );
 static const itype_id itype_test_socks( "test_socks" );
 static const itype_id
 itype_test_watertight_open_sealed_container_1L( "test_watertight_open_sealed_container_1L" );
@@ -2869,3 +2870,57 @@ TEST_CASE( "pocket_mods", "[pocket][toolmod][gunmod]" )
         }
     }
 }
+
+TEST_CASE( "nested_pocket_weight_volume_benchmark", "[.][pocket][benchmark]" )
+{
+    // 50 backpacks of 100 rocks each, all inside one more backpack
+    item top( itype_test_backpack );
+    for( int i = 0; i < 50; ++i ) {
+        item pack( itype_test_backpack );
+        for( int j = 0; j < 100; ++j ) {
+            pack.force_insert_item( item( itype_test_rock ), pocket_type::CONTAINER );
+        }
+        top.force_insert_item( pack, pocket_type::CONTAINER );
+    }
+    REQUIRE( top.all_items_ptr().size() == 5050 );
+
+    BENCHMARK( "weight and volume" ) {
+        return units::to_gram( top.weight() ) + units::to_milliliter( top.volume() );
+    };
+    BENCHMARK( "weight and volume, remembering pocket totals" ) {
+        item_pocket::totals_scope const totals;
+        return units::to_gram( top.weight() ) + units::to_milliliter( top.volume() );
+    };
+    BENCHMARK( "visit items" ) {
+        int count = 0;
+        top.visit_items( [&count]( const item *, const item * ) {
+            count++;
+            return VisitResponse::NEXT;
+        } );
+        return count;
+    };
+}
+
+TEST_CASE( "pocket_totals_scope", "[item][pocket]" )
+{
+    item pack( itype_test_backpack );
+    item inner( itype_test_backpack );
+    inner.force_insert_item( item( itype_test_rock ), pocket_type::CONTAINER );
+    pack.force_insert_item( inner, pocket_type::CONTAINER );
+    const units::mass weight = pack.weight();
+    const units::volume volume = pack.volume();
+
+    units::mass weight_in_scope;
+    {
+        item_pocket::totals_scope const totals;
+        CHECK( pack.weight() == weight );
+        CHECK( pack.volume() == volume );
+        CHECK( pack.weight() == weight );
+
+        // changing any pocket forgets the remembered totals
+        pack.force_insert_item( item( itype_test_rock ), pocket_type::CONTAINER );
+        weight_in_scope = pack.weight();
+        CHECK( weight_in_scope > weight );
+    }
+    CHECK( pack.weight() == weight_in_scope );
+}
@@ -5,6 +5,7 @@
 #include <initializer_list>
 #include <limits>
 #include <memory>
+#include <sstream>
 #include <vector>
 
 #include "avatar.h"
@@ -15,6 +16,8 @@
 #include "game.h"
 #include "item_category.h"
 #include "item_factory.h"
+#include "json.h"
+#include "json_loader.h"
 #include "itype.h"
 #include "math_defines.h"
 #include "monstergenerator.h"
@@ -39,6 +42,7 @@ static const item_category_id item_category_guns( "guns" );
 static const item_category_id item_category_spare_parts( "spare_parts" );
 static const item_category_id item_category_tools( "tools" );
 
+static const itype_id itype_neccowafers( "neccowafers" );
 static const itype_id itype_test_backpack( "test_backpack" );
 static const itype_id itype_test_duffelbag( "test_duffelbag" );
 static const itype_id itype_test_mp3( "test_mp3" );
@@ -100,6 +104,20 @@ TEST_CASE( "stacking_cash_cards", "[item]" )
 
 // second minute hour day week season year
 
+TEST_CASE( "items_copied_from_spawn_prototype", "[item]" )
+{
+    const time_point birthday = calendar::turn_zero + 3_days;
+    const item food( itype_neccowafers, birthday );
+    CHECK( food.birthday() == birthday );
+    CHECK( food.charges == food.type->charges_default() );
+    CHECK( food.active );
+    CHECK( item( itype_neccowafers, birthday, 2 ).charges == 2 );
+
+    const item pack( itype_test_backpack );
+    CHECK( !pack.get_all_contained_pockets().empty() );
+    CHECK( pack.stacks_with( item( itype_test_backpack ) ) );
+}
+
 TEST_CASE( "stacking_over_time", "[item]" )
 {
     item A( "neccowafers" );
@@ -271,6 +289,35 @@ TEST_CASE( "item_length_sanity_check", "[item]" )
     }
 }
 
+static item save_and_load( const item &it )
+{
+    std::ostringstream os;
+    JsonOut jsout( os );
+    it.serialize( jsout );
+    const JsonValue jsin = json_loader::from_string( os.str() );
+    item loaded;
+    loaded.deserialize( jsin.get_object() );
+    return loaded;
+}
+
+TEST_CASE( "rarely_set_item_data_survives_save_and_load", "[item]" )
+{
+    const item plain( itype_neccowafers );
+    CHECK( plain.get_corpse_name().empty() );
+    CHECK( plain.get_dropped_from().is_null() );
+    CHECK( save_and_load( plain ).get_corpse_name().empty() );
+
+    const item corpse = item::make_corpse( mtype_id::NULL_ID(), calendar::turn, "Joan" );
+    CHECK( corpse.get_corpse_name() == "Joan" );
+    const item loaded = save_and_load( corpse );
+    CHECK( loaded.get_corpse_name() == "Joan" );
+    // A copy keeps its own cold data
+    item copy = loaded;
+    copy.set_dropped_from( harvest_drop_type_id( "flesh" ) );
+    CHECK( loaded.get_dropped_from().is_null() );
+    CHECK( copy.get_corpse_name() == "Joan" );
+}
+
 TEST_CASE( "corpse_length_sanity_check", "[item]" )
 {
     for( const mtype &type : MonsterGenerator::generator().get_all_mtypes() ) {
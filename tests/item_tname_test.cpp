@@ -947,3 +947,16 @@ TEST_CASE( "nested_items_tname", "[item][tname]" )
         }
     }
 }
+
+TEST_CASE( "tname_cache_scope", "[item][tname]" )
+{
+    item rag( "rag" );
+    {
+        tname::cache_scope const names;
+        CHECK( rag.tname() == "rag" );
+        // remembered for the rest of the scope, even though the item changed
+        rag.set_flag( flag_WET );
+        CHECK( rag.tname() == "rag" );
+    }
+    CHECK( rag.tname() == "rag (wet)" );
+}
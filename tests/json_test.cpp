@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <functional>
 #include <iterator>
 #include <list>
@@ -20,11 +21,14 @@
 #include "damage.h"
 #include "debug.h"
 #include "enum_bitset.h"
+#include "filesystem.h"
+#include "flexbuffer_cache.h"
 #include "item.h"
 #include "json.h"
 #include "json_loader.h"
 #include "magic.h"
 #include "mutation.h"
+#include "path_info.h"
 #include "sounds.h"
 #include "string_formatter.h"
 #include "translations.h"
@@ -190,6 +194,132 @@ TEST_CASE( "serialize_set", "[json]" )
     test_serialization( string_id_set, R"(["foo"])" );
 }
 
+static void write_mixed_values( JsonOut &jsout, int count )
+{
+    jsout.start_array();
+    for( int i = 0; i < count; ++i ) {
+        jsout.start_object();
+        jsout.member( "int", i - count / 2 );
+        jsout.member( "unsigned", static_cast<unsigned long long>( i ) * 1000000007ULL );
+        jsout.member( "double", i * 0.37 );
+        jsout.member( "float", i * -1.5f );
+        jsout.member( "huge", 1e300 );
+        jsout.member( "bool", i % 2 == 0 );
+        jsout.member( "char", static_cast<char>( i % 100 ) );
+        jsout.member( "string", std::string( "quote\" back\\slash\n\x01/ ok" ) );
+        jsout.end_object();
+    }
+    jsout.end_array();
+}
+
+TEST_CASE( "buffered_jsonout_matches_jsonout", "[json]" )
+{
+    std::ostringstream plain_os;
+    {
+        JsonOut jsout( plain_os, true );
+        write_mixed_values( jsout, 3 );
+    }
+    CHECK( plain_os.str().find( R"("string": "quote\" back\\slash\n\u0001/ ok")" ) !=
+           std::string::npos );
+    CHECK( plain_os.str().find( R"("double": 0.370000)" ) != std::string::npos );
+    CHECK( plain_os.str().find( R"("bool": false)" ) != std::string::npos );
+
+    // Enough output to be handed to the stream in several blocks
+    for( int count : { 3, 5000 } ) {
+        for( bool pretty : { false, true } ) {
+            CAPTURE( count, pretty );
+            std::ostringstream expected;
+            {
+                JsonOut jsout( expected, pretty );
+                write_mixed_values( jsout, count );
+            }
+            std::ostringstream buffered;
+            {
+                BufferedJsonOut jsout( buffered, pretty );
+                write_mixed_values( jsout, count );
+            }
+            CHECK( buffered.str() == expected.str() );
+        }
+    }
+}
+
+TEST_CASE( "json_loader_reads_binary_flexbuffers", "[json]" )
+{
+    const std::string json = R"([{"version":1,"coordinates":[1,-2,3],"name":"foo"},null])";
+    std::shared_ptr<parsed_flexbuffer> parsed = flexbuffer_cache::parse_buffer( json );
+    const uint8_t *data = parsed->get_storage()->data();
+    std::vector<uint8_t> binary( data, data + parsed->get_storage()->size() );
+
+    JsonArray ja = json_loader::from_binary( std::move( binary ), cata_path() );
+    REQUIRE( ja.size() == 2 );
+    JsonObject jo = ja.get_object( 0 );
+    CHECK( jo.get_int( "version" ) == 1 );
+    CHECK( jo.get_array( "coordinates" ).get_int( 1 ) == -2 );
+    CHECK( jo.get_string( "name" ) == "foo" );
+    CHECK( ja[1].test_null() );
+
+    // errors are still reported, based on json rebuilt from the binary data
+    CHECK_THROWS_AS( jo.get_int( "name" ), JsonError );
+
+    CHECK_THROWS( json_loader::from_binary( { 1, 2, 3 }, cata_path() ) );
+}
+
+TEST_CASE( "flexbuffer_cache_packs_cached_files", "[json]" )
+{
+    const fs::path root =
+        ( PATH_INFO::savedir_path() / "flexbuffer_pack_test" ).get_unrelative_path();
+    const fs::path cache_dir = root / "cache";
+    const fs::path source = ( root / "source.json" ).lexically_normal();
+    fs::remove_all( root );
+    REQUIRE( assure_dir_exist( root ) );
+    write_to_file( source.u8string(), []( std::ostream & fout ) {
+        fout << R"([{"name":"foo"}])";
+    } );
+    const auto read_name = [&]( flexbuffer_cache & cache ) {
+        std::shared_ptr<parsed_flexbuffer> parsed = cache.parse_and_cache( source );
+        flexbuffers::Reference buffer_root = flexbuffer_root_from_storage( parsed->get_storage() );
+        JsonArray ja = JsonValue( std::move( parsed ), buffer_root, nullptr, 0 );
+        return ja.get_object( 0 ).get_string( "name" );
+    };
+    const auto loose_files = [&]() {
+        return get_files_from_path( ".fb", cache_dir.u8string(), true, true ).size();
+    };
+
+    {
+        flexbuffer_cache cache( cache_dir, root );
+        CHECK( read_name( cache ) == "foo" );
+        CHECK( loose_files() == 1 );
+        cache.write_pack();
+        CHECK( loose_files() == 0 );
+        CHECK( file_exist( cache_dir / "flexbuffers.pack" ) );
+        // Still readable after the pack replaced the loose file
+        CHECK( read_name( cache ) == "foo" );
+    }
+    {
+        // Read back from the pack without writing a loose file again
+        flexbuffer_cache cache( cache_dir, root );
+        CHECK( read_name( cache ) == "foo" );
+        CHECK( loose_files() == 0 );
+    }
+
+    write_to_file( source.u8string(), []( std::ostream & fout ) {
+        fout << R"([{"name":"bar"}])";
+    } );
+    fs::last_write_time( source, fs::last_write_time( source ) + std::chrono::seconds( 10 ) );
+    {
+        // A changed source is parsed again instead of using the stale packed copy
+        flexbuffer_cache cache( cache_dir, root );
+        CHECK( read_name( cache ) == "bar" );
+        cache.write_pack();
+    }
+    {
+        flexbuffer_cache cache( cache_dir, root );
+        CHECK( read_name( cache ) == "bar" );
+        CHECK( loose_files() == 0 );
+    }
+    fs::remove_all( root );
+}
+
 template<typename Matcher>
 static void test_translation_text_style_check( Matcher &&matcher, const std::string &json )
 {
@@ -438,6 +438,28 @@ TEST_CASE( "line_to_boundaries", "[line]" )
     }
 }
 
+TEST_CASE( "line_offsets_match_line_to", "[line]" )
+{
+    for( int i = -20; i <= 20; ++i ) {
+        for( int j = -20; j <= 20; ++j ) {
+            for( int t = -3; t <= 3; ++t ) {
+                const point d( i, j );
+                CAPTURE( d, t );
+                // Asked twice, the second answer comes from the table
+                CHECK( line_offsets( d, t ) == line_to( point_zero, d, t ) );
+                CHECK( line_offsets( d, t ) == line_to( point_zero, d, t ) );
+            }
+        }
+    }
+    const point start( 7, -4 );
+    const point end( -12, 9 );
+    std::vector<point> moved;
+    for( const point &p : line_offsets( end - start ) ) {
+        moved.push_back( start + p );
+    }
+    CHECK( moved == line_to( start, end ) );
+}
+
 TEST_CASE( "line_to_regression", "[line]" )
 {
     line_to_comparison( 1 );
@@ -1,11 +1,13 @@
 #include <bitset>
 #include <cstdio>
 #include <sstream>
+#include <string>
 #include <type_traits>
 
 #include "cata_catch.h"
 #include "game_constants.h"
 #include "json.h"
+#include "json_loader.h"
 #include "lru_cache.h"
 #include "map.h"
 #include "map_memory.h"
@@ -122,7 +124,109 @@ TEST_CASE( "map_memory_forgets", "[map_memory]" )
     CHECK( mt.get_dec_rotation() == 0 );
 }
 
-// TODO: map memory save / load
+static shared_ptr_fast<mm_region> round_trip( const mm_region &reg )
+{
+    std::ostringstream os;
+    JsonOut jsout( os );
+    reg.serialize( jsout );
+    shared_ptr_fast<mm_region> loaded = make_shared_fast<mm_region>();
+    loaded->deserialize( json_loader::from_string( os.str() ) );
+    return loaded;
+}
+
+TEST_CASE( "map_memory_region_save_load", "[map_memory]" )
+{
+    mm_region reg;
+    for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+        for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+            reg.submaps[x][y] = make_shared_fast<mm_submap>();
+        }
+    }
+    memorized_tile a;
+    a.symbol = 'a';
+    a.set_ter_id( "t_foo" );
+    a.set_ter_subtile( 1 );
+    a.set_ter_rotation( 2 );
+    memorized_tile b = a;
+    b.set_dec_id( "vp_bar" );
+    b.set_dec_subtile( 3 );
+    b.set_dec_rotation( 1 );
+    for( int x = 0; x < SEEX; x++ ) {
+        reg.submaps[2][5]->set_tile( point_sm_ms( x, 3 ), x % 3 == 0 ? b : a );
+        reg.submaps[7][0]->set_tile( point_sm_ms( 0, x ), b );
+    }
+
+    const shared_ptr_fast<mm_region> loaded = round_trip( reg );
+    for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+        for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+            CAPTURE( x, y );
+            const mm_submap &orig = *reg.submaps[x][y];
+            const mm_submap &sm = *loaded->submaps[x][y];
+            REQUIRE( orig.is_empty() == sm.is_empty() );
+            for( int sx = 0; sx < SEEX; sx++ ) {
+                for( int sy = 0; sy < SEEY; sy++ ) {
+                    CHECK( orig.get_tile( point_sm_ms( sx, sy ) ) == sm.get_tile( point_sm_ms( sx, sy ) ) );
+                }
+            }
+        }
+    }
+    const memorized_tile &mt = loaded->submaps[2][5]->get_tile( point_sm_ms( 3, 3 ) );
+    CHECK( mt.get_ter_id() == "t_foo" );
+    CHECK( mt.get_dec_id() == "vp_bar" );
+    CHECK( mt.get_dec_subtile() == 3 );
+    CHECK( mt.get_dec_rotation() == 1 );
+}
+
+TEST_CASE( "map_memory_region_tracks_changes", "[map_memory]" )
+{
+    mm_region reg;
+    for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+        for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+            reg.submaps[x][y] = make_shared_fast<mm_submap>();
+        }
+    }
+    CHECK_FALSE( reg.is_dirty() );
+    memorized_tile a;
+    a.set_ter_id( "t_foo" );
+    reg.submaps[1][2]->set_tile( point_sm_ms( 3, 4 ), a );
+    CHECK( reg.is_dirty() );
+    reg.mark_saved();
+    CHECK_FALSE( reg.is_dirty() );
+    // Memorizing the same tile again changes nothing
+    reg.submaps[1][2]->set_tile( point_sm_ms( 3, 4 ), a );
+    CHECK_FALSE( reg.is_dirty() );
+    a.set_ter_rotation( 1 );
+    reg.submaps[1][2]->set_tile( point_sm_ms( 3, 4 ), a );
+    CHECK( reg.is_dirty() );
+
+    const shared_ptr_fast<mm_region> loaded = round_trip( reg );
+    CHECK_FALSE( loaded->is_dirty() );
+}
+
+TEST_CASE( "map_memory_loads_version_1_regions", "[map_memory]" )
+{
+    // version 1 regions store the ids inline instead of using a dictionary
+    std::string json = R"({"version":1,"data":[)";
+    json += R"([[1,97,"t_foo",1,2,"f_bar",3,1],[)" + std::to_string( SEEX * SEEY - 1 ) +
+            R"(,0,"",0,0]])";
+    for( int i = 1; i < MM_REG_SIZE * MM_REG_SIZE; i++ ) {
+        json += ",null";
+    }
+    json += "]}";
+
+    mm_region reg;
+    reg.deserialize( json_loader::from_string( json ) );
+    const memorized_tile &mt = reg.submaps[0][0]->get_tile( point_sm_ms( 0, 0 ) );
+    CHECK( mt.symbol == 'a' );
+    CHECK( mt.get_ter_id() == "t_foo" );
+    CHECK( mt.get_ter_subtile() == 1 );
+    CHECK( mt.get_ter_rotation() == 2 );
+    CHECK( mt.get_dec_id() == "f_bar" );
+    CHECK( mt.get_dec_subtile() == 3 );
+    CHECK( mt.get_dec_rotation() == 1 );
+    CHECK( reg.submaps[0][0]->get_tile( point_sm_ms( 1, 0 ) ) == mm_submap::default_tile );
+    CHECK( reg.submaps[1][0]->is_empty() );
+}
 
 #include <chrono>
 
@@ -0,0 +1,52 @@
+#include <optional>
+#include <string>
+
+#include "cata_catch.h"
+#include "cata_utility.h"
+#include "filesystem.h"
+#include "map_region_file.h"
+#include "path_info.h"
+
+TEST_CASE( "map_region_file_round_trip", "[map][save]" )
+{
+    const cata_path region_path = PATH_INFO::savedir_path() / "map_region_file_test.mapr";
+    const fs::path path = region_path.get_unrelative_path();
+    const point first( 0, 0 );
+    const point middle( 5, 17 );
+    const point last( SEG_SIZE - 1, SEG_SIZE - 1 );
+
+    map_region_file region;
+    CHECK( region.empty() );
+    region.set_quad( first, "[{\"first\":1}]" );
+    region.set_quad( middle, std::string( "binary\0data", 11 ) );
+    region.set_quad( last, "[]" );
+    CHECK_FALSE( region.empty() );
+    write_to_file( region_path, [&]( std::ostream & fout ) {
+        fout << region.serialize();
+    } );
+
+    CHECK( map_region_file::read_quad( path, first ) == "[{\"first\":1}]" );
+    CHECK( map_region_file::read_quad( path, middle ) == std::string( "binary\0data", 11 ) );
+    CHECK( map_region_file::read_quad( path, last ) == "[]" );
+    CHECK( map_region_file::read_quad( path, point( 1, 0 ) ) == std::nullopt );
+
+    map_region_file loaded = map_region_file::load( path );
+    loaded.remove_quad( middle );
+    loaded.set_quad( first, "[2]" );
+    write_to_file( region_path, [&]( std::ostream & fout ) {
+        fout << loaded.serialize();
+    } );
+    CHECK( map_region_file::read_quad( path, first ) == "[2]" );
+    CHECK( map_region_file::read_quad( path, middle ) == std::nullopt );
+    CHECK( map_region_file::read_quad( path, last ) == "[]" );
+
+    write_to_file( region_path, []( std::ostream & fout ) {
+        fout << "[not a region file]";
+    } );
+    CHECK_THROWS( map_region_file::read_quad( path, first ) );
+    CHECK_THROWS( map_region_file::load( path ) );
+
+    fs::remove( path );
+    CHECK( map_region_file::read_quad( path, first ) == std::nullopt );
+    CHECK( map_region_file::load( path ).empty() );
+}
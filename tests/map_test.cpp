@@ -1,20 +1,37 @@
 #include "cata_catch.h"
 #include "map.h"
 
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstring>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "avatar.h"
+#include "cached_options.h"
+#include "cata_scope_helpers.h"
 #include "coordinates.h"
 #include "enums.h"
+#include "field_type.h"
 #include "itype.h"
 #include "game.h"
 #include "game_constants.h"
+#include "level_cache.h"
+#include "line.h"
 #include "map_helpers.h"
+#include "map_iterator.h"
+#include "pathfinding.h"
 #include "point.h"
 #include "submap.h"
 #include "type_id.h"
 
+static const ter_str_id ter_t_flat_roof( "t_flat_roof" );
+static const ter_str_id ter_t_floor( "t_floor" );
+static const ter_str_id ter_t_open_air( "t_open_air" );
+static const ter_str_id ter_t_wall( "t_wall" );
+
 TEST_CASE( "map_coordinate_conversion_functions" )
 {
     map &here = get_map();
@@ -310,3 +327,297 @@ TEST_CASE( "active_monster_drops", "[active_item][map]" )
     }
     CHECK( dropped_bag.empty() );
 }
+
+namespace
+{
+struct level_cache_snapshot {
+    cata::mdarray<bool, point_bub_ms> outside_cache;
+    cata::mdarray<bool, point_bub_ms> floor_cache;
+    cata::mdarray<float, point_bub_ms> transparency_cache;
+    std::array<std::bitset<MAPSIZE_Y>, MAPSIZE_X> transparent_cache_wo_fields;
+    std::array<std::bitset<MAPSIZE_Y>, MAPSIZE_X> transparent_cache;
+    bool no_floor_gaps;
+};
+} // namespace
+
+static std::vector<level_cache_snapshot> snapshot_caches()
+{
+    map &here = get_map();
+    std::vector<level_cache_snapshot> result;
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; ++z ) {
+        const level_cache &ch = here.get_cache_ref( z );
+        result.push_back( { ch.outside_cache, ch.floor_cache, ch.transparency_cache,
+                            ch.transparent_cache_wo_fields, ch.transparent_cache, ch.no_floor_gaps } );
+    }
+    return result;
+}
+
+static std::vector<level_cache_snapshot> rebuild_and_snapshot_caches( bool parallel )
+{
+    map &here = get_map();
+    restore_on_out_of_scope<bool> restore_parallel( parallel_map_cache );
+    parallel_map_cache = parallel;
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; ++z ) {
+        here.invalidate_map_cache( z );
+    }
+    here.build_map_cache( 0, true );
+    return snapshot_caches();
+}
+
+TEST_CASE( "parallel_map_cache_build_matches_serial", "[map][vision]" )
+{
+    clear_map();
+    map &here = get_map();
+
+    // A walled, roofed building with smoke inside, a hole in its roof and a pit into the rock below.
+    for( int x = 10; x <= 30; ++x ) {
+        for( int y = 10; y <= 30; ++y ) {
+            const bool edge = x == 10 || x == 30 || y == 10 || y == 30;
+            here.ter_set( tripoint( x, y, 0 ), edge ? ter_t_wall : ter_t_floor );
+            here.ter_set( tripoint( x, y, 1 ), ter_t_flat_roof );
+        }
+    }
+    for( int x = 18; x <= 22; ++x ) {
+        here.ter_set( tripoint( x, 20, 1 ), ter_t_open_air );
+        here.add_field( tripoint( x, 15, 0 ), fd_smoke, 3 );
+    }
+    here.ter_set( tripoint( 40, 40, 0 ), ter_t_open_air );
+
+    const std::vector<level_cache_snapshot> serial = rebuild_and_snapshot_caches( false );
+    const std::vector<level_cache_snapshot> parallel = rebuild_and_snapshot_caches( true );
+    REQUIRE( serial.size() == parallel.size() );
+    for( size_t i = 0; i < serial.size(); ++i ) {
+        CAPTURE( static_cast<int>( i ) - OVERMAP_DEPTH );
+        const level_cache_snapshot &a = serial[i];
+        const level_cache_snapshot &b = parallel[i];
+        CHECK( a.no_floor_gaps == b.no_floor_gaps );
+        CHECK( a.transparent_cache_wo_fields == b.transparent_cache_wo_fields );
+        CHECK( std::memcmp( &a.outside_cache, &b.outside_cache, sizeof( a.outside_cache ) ) == 0 );
+        CHECK( std::memcmp( &a.floor_cache, &b.floor_cache, sizeof( a.floor_cache ) ) == 0 );
+        CHECK( std::memcmp( &a.transparency_cache, &b.transparency_cache,
+                            sizeof( a.transparency_cache ) ) == 0 );
+    }
+}
+
+TEST_CASE( "transparency_cache_moved_by_shift_matches_rebuild", "[map][vision]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint start = get_avatar().pos();
+    const on_out_of_scope restore_player( [start]() {
+        g->place_player( start );
+    } );
+
+    // Walls, smoke and a roofed room spread over several submaps, some of them near the edge
+    // that goes out of the map.
+    for( int x = 4; x < MAPSIZE_X - 4; x += 9 ) {
+        for( int y = 6; y < MAPSIZE_Y - 6; y += 7 ) {
+            here.ter_set( tripoint( x, y, 0 ), ter_t_wall );
+            here.add_field( tripoint( x + 2, y, 0 ), fd_smoke, 3 );
+        }
+    }
+    for( int x = 60; x <= 70; ++x ) {
+        for( int y = 60; y <= 70; ++y ) {
+            here.ter_set( tripoint( x, y, 1 ), ter_t_flat_roof );
+        }
+    }
+    here.build_map_cache( 0, true );
+
+    const point step = GENERATE( point_east, point_south_west );
+    CAPTURE( step );
+    g->place_player( start + tripoint( step.x * SEEX, step.y * SEEY, 0 ) );
+    here.build_map_cache( 0, true );
+    const std::vector<level_cache_snapshot> shifted = snapshot_caches();
+    const std::vector<level_cache_snapshot> rebuilt = rebuild_and_snapshot_caches( false );
+    REQUIRE( shifted.size() == rebuilt.size() );
+    for( size_t i = 0; i < shifted.size(); ++i ) {
+        CAPTURE( static_cast<int>( i ) - OVERMAP_DEPTH );
+        const level_cache_snapshot &a = shifted[i];
+        const level_cache_snapshot &b = rebuilt[i];
+        CHECK( a.transparent_cache_wo_fields == b.transparent_cache_wo_fields );
+        CHECK( a.transparent_cache == b.transparent_cache );
+        CHECK( std::memcmp( &a.transparency_cache, &b.transparency_cache,
+                            sizeof( a.transparency_cache ) ) == 0 );
+    }
+}
+
+TEST_CASE( "traps_move_with_their_submaps_when_shifting", "[map]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint start = get_avatar().pos();
+    const on_out_of_scope restore_player( [start]() {
+        g->place_player( start );
+    } );
+
+    const tripoint kept( 60, 61, 0 );
+    here.trap_set( kept, tr_pit );
+    here.trap_set( tripoint( 2, 61, 0 ), tr_pit );
+    CHECK( here.trap_locations( tr_pit ).size() == 2 );
+    CHECK( here.may_have_trap( kept + point_east ) );
+    CHECK_FALSE( here.may_have_trap( kept + point( SEEX, 0 ) ) );
+
+    g->place_player( start + tripoint( SEEX, 0, 0 ) );
+    const tripoint moved = kept - tripoint( SEEX, 0, 0 );
+    const std::vector<tripoint> locations = here.trap_locations( tr_pit );
+    CHECK( std::count( locations.begin(), locations.end(), moved ) == 1 );
+    for( const tripoint &p : locations ) {
+        CHECK( here.tr_at( p ).id == tr_pit );
+    }
+    CHECK( here.may_have_trap( moved ) );
+    here.remove_trap( moved );
+    const std::vector<tripoint> after_removal = here.trap_locations( tr_pit );
+    CHECK( std::count( after_removal.begin(), after_removal.end(), moved ) == 0 );
+}
+
+TEST_CASE( "primed_sight_lines_match_traced_ones", "[map][vision]" )
+{
+    clear_map();
+    map &here = get_map();
+
+    // A few pillars and a wall with a gap, so some of the lines are blocked.
+    for( int y = 50; y <= 70; ++y ) {
+        if( y != 60 ) {
+            here.ter_set( tripoint( 60, y, 0 ), ter_t_wall );
+        }
+    }
+    here.ter_set( tripoint( 55, 55, 0 ), ter_t_wall );
+    here.ter_set( tripoint( 66, 64, 0 ), ter_t_wall );
+
+    std::vector<std::pair<tripoint, tripoint>> lines;
+    for( int x = 50; x <= 70; x += 4 ) {
+        for( int y = 50; y <= 70; y += 5 ) {
+            lines.emplace_back( tripoint( 52, 60, 0 ), tripoint( x, y, 0 ) );
+            lines.emplace_back( tripoint( x, y, 0 ), tripoint( 68, 57, 0 ) );
+        }
+    }
+    // Lines across z-levels are left to sees().
+    lines.emplace_back( tripoint( 52, 60, 0 ), tripoint( 52, 60, -1 ) );
+
+    const auto clear_sight_cache = [&here]() {
+        here.invalidate_map_cache( 0 );
+        here.build_map_cache( 0, true );
+    };
+    clear_sight_cache();
+    std::vector<bool> expected;
+    for( const std::pair<tripoint, tripoint> &line : lines ) {
+        expected.push_back( here.sees( line.first, line.second, -1 ) );
+    }
+    CHECK( std::count( expected.begin(), expected.end(), false ) > 0 );
+    CHECK( std::count( expected.begin(), expected.end(), true ) > 0 );
+
+    clear_sight_cache();
+    here.prime_sees_cache( lines );
+    for( size_t i = 0; i < lines.size(); ++i ) {
+        CAPTURE( lines[i].first, lines[i].second );
+        if( lines[i].first.z == lines[i].second.z ) {
+            // Already in the cache, so a blocked line is known to be blocked.
+            CHECK( here.has_potential_los( lines[i].first, lines[i].second ) == expected[i] );
+        }
+        CHECK( here.sees( lines[i].first, lines[i].second, -1 ) == expected[i] );
+    }
+}
+
+TEST_CASE( "route_into_reused_buffer_matches_returned_route", "[map][pathfinding]" )
+{
+    clear_map();
+    map &here = get_map();
+
+    // A wall with a single gap, so the direct line is blocked and A* has to go around.
+    for( int y = 50; y <= 70; ++y ) {
+        if( y != 52 ) {
+            here.ter_set( tripoint( 60, y, 0 ), ter_t_wall );
+        }
+    }
+    const pathfinding_settings settings( 0, 30, 60, 0, false, false, false, true, false, false );
+    const tripoint from( 55, 65, 0 );
+    const tripoint to( 65, 65, 0 );
+
+    const std::vector<tripoint> expected = here.route( from, to, settings );
+    REQUIRE( !expected.empty() );
+    CHECK( expected.back() == to );
+    CHECK( std::find( expected.begin(), expected.end(), tripoint( 60, 52, 0 ) ) != expected.end() );
+
+    // Stale contents of the buffer must be replaced, not appended to.
+    std::vector<tripoint> path( 100, tripoint_zero );
+    here.route( path, from, to, settings );
+    CHECK( path == expected );
+
+    // Reusing the same buffer for an unobstructed straight line.
+    const tripoint straight_to( 55, 75, 0 );
+    here.route( path, from, straight_to, settings );
+    CHECK( path == here.route( from, straight_to, settings ) );
+    CHECK( path.back() == straight_to );
+}
+
+TEST_CASE( "flow_field_route_goes_around_walls_and_sees_map_changes", "[map][pathfinding]" )
+{
+    clear_map();
+    map &here = get_map();
+
+    for( int y = 50; y <= 70; ++y ) {
+        if( y != 52 ) {
+            here.ter_set( tripoint( 60, y, 0 ), ter_t_wall );
+        }
+    }
+    const pathfinding_settings settings( 0, 30, 150, 0, false, false, false, true, false, false );
+    const tripoint from( 55, 65, 0 );
+    const tripoint to( 65, 65, 0 );
+
+    std::vector<tripoint> path;
+    REQUIRE( here.flow_field_route( path, from, to, settings ) );
+    REQUIRE( !path.empty() );
+    CHECK( path.back() == to );
+    CHECK( std::find( path.begin(), path.end(), tripoint( 60, 52, 0 ) ) != path.end() );
+    for( size_t i = 1; i < path.size(); ++i ) {
+        CHECK( square_dist( path[i - 1], path[i] ) == 1 );
+    }
+
+    // Opening a shorter gap must be picked up by the cached field.
+    here.ter_set( tripoint( 60, 65, 0 ), ter_t_floor );
+    REQUIRE( here.flow_field_route( path, from, to, settings ) );
+    CHECK( path.size() == 10 );
+
+    // Walling the target in leaves the caller to fall back to A*.
+    for( const tripoint &p : here.points_in_radius( to, 1 ) ) {
+        if( p != to ) {
+            here.ter_set( p, ter_t_wall );
+        }
+    }
+    CHECK_FALSE( here.flow_field_route( path, from, to, settings ) );
+    CHECK( path.empty() );
+}
+
+TEST_CASE( "hierarchical_route_crosses_the_whole_bubble", "[map][pathfinding]" )
+{
+    clear_map();
+    map &here = get_map();
+
+    // A long wall across the bubble with a single gap near its end.
+    for( int y = 0; y < MAPSIZE_Y; ++y ) {
+        if( y != 120 ) {
+            here.ter_set( tripoint( 66, y, 0 ), ter_t_wall );
+        }
+    }
+    const pathfinding_settings settings( 0, 1000, 1000, 0, false, false, false, true, false, false );
+    const tripoint from( 5, 20, 0 );
+    const tripoint to( 125, 20, 0 );
+
+    // Follow the partial routes the way a caller would, repathing at the end of each one.
+    tripoint cur = from;
+    std::vector<tripoint> path;
+    bool went_through_gap = false;
+    for( int i = 0; i < 50 && cur != to; ++i ) {
+        here.hierarchical_route( path, cur, to, settings );
+        REQUIRE( !path.empty() );
+        CHECK( square_dist( cur, path.front() ) == 1 );
+        for( size_t j = 1; j < path.size(); ++j ) {
+            CHECK( square_dist( path[j - 1], path[j] ) == 1 );
+        }
+        went_through_gap |= std::find( path.begin(), path.end(),
+                                       tripoint( 66, 120, 0 ) ) != path.end();
+        cur = path.back();
+    }
+    CHECK( cur == to );
+    CHECK( went_through_gap );
+}
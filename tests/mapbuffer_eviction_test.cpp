@@ -0,0 +1,54 @@
+#include <chrono>
+
+#include "avatar.h"
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapbuffer.h"
+#include "mapgen_queue.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "submap.h"
+#include "type_id.h"
+
+static const furn_str_id furn_f_chair( "f_chair" );
+
+static bool is_buffered( const tripoint_abs_sm &p )
+{
+    for( auto &elem : MAPBUFFER ) {
+        if( elem.first == p ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+TEST_CASE( "mapbuffer_evicts_and_reloads_quads_outside_the_bubble", "[mapbuffer]" )
+{
+    clear_avatar();
+    clear_map();
+    MAPBUFFER.clear_outside_reality_bubble();
+    mapgen_queue::clear();
+
+    const tripoint_abs_omt ahead = get_avatar().global_omt_location() + point( 6, 0 );
+    const tripoint_abs_sm ahead_sm = project_to<coords::sm>( ahead );
+    mapgen_queue::request( ahead );
+    mapgen_queue::process( std::chrono::milliseconds( 60000 ) );
+    REQUIRE( is_buffered( ahead_sm ) );
+    MAPBUFFER.lookup_submap( ahead_sm )->set_furn( point_south_east, furn_f_chair.id() );
+
+    const tripoint_abs_sm in_bubble = get_map().get_abs_sub();
+    REQUIRE( is_buffered( in_bubble ) );
+
+    CHECK( MAPBUFFER.evict( 0, false ) > 0 );
+    CHECK_FALSE( is_buffered( ahead_sm ) );
+    CHECK( is_buffered( in_bubble ) );
+
+    // Written out before it was dropped
+    const int misses = MAPBUFFER.get_stats().misses;
+    submap *reloaded = MAPBUFFER.lookup_submap( ahead_sm );
+    REQUIRE( reloaded != nullptr );
+    CHECK( reloaded->get_furn( point_south_east ) == furn_f_chair.id() );
+    CHECK( MAPBUFFER.get_stats().misses == misses + 1 );
+}
@@ -0,0 +1,107 @@
+#include <chrono>
+#include <vector>
+
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_catch.h"
+#include "cata_scope_helpers.h"
+#include "coordinates.h"
+#include "game_constants.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapbuffer.h"
+#include "mapgen_queue.h"
+#include "overmapbuffer.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "submap.h"
+#include "type_id.h"
+
+static const oter_str_id oter_field( "field" );
+
+TEST_CASE( "mapgen_queue_generates_requested_tiles_ahead", "[mapgen]" )
+{
+    clear_avatar();
+    clear_map();
+    MAPBUFFER.clear_outside_reality_bubble();
+    mapgen_queue::clear();
+
+    const tripoint_abs_omt here = get_avatar().global_omt_location();
+    const tripoint_abs_omt ahead = here + point( 6, 0 );
+    const tripoint_abs_omt far_away = here + point( 30, 0 );
+    REQUIRE( MAPBUFFER.lookup_submap( project_to<coords::sm>( ahead ) ) == nullptr );
+
+    mapgen_queue::request( ahead );
+    mapgen_queue::request( ahead );
+    mapgen_queue::request( far_away );
+    CHECK( mapgen_queue::pending() == 2 );
+
+    // The far one is dropped as stale
+    CHECK( mapgen_queue::process( std::chrono::milliseconds( 60000 ) ) == 1 );
+    CHECK( mapgen_queue::pending() == 0 );
+    CHECK( MAPBUFFER.lookup_submap( project_to<coords::sm>( ahead ) ) != nullptr );
+
+    // Already there, nothing left to do
+    mapgen_queue::request( ahead );
+    CHECK( mapgen_queue::process( std::chrono::milliseconds( 60000 ) ) == 0 );
+}
+
+static std::vector<submap *> omt_submaps( const tripoint_abs_omt &omt )
+{
+    std::vector<submap *> ret;
+    for( const point &offset : { point_zero, point_south, point_east, point_south_east } ) {
+        submap *sm = MAPBUFFER.lookup_submap( project_to<coords::sm>( omt ) + offset );
+        REQUIRE( sm != nullptr );
+        ret.push_back( sm );
+    }
+    return ret;
+}
+
+static std::vector<int> omt_contents( const tripoint_abs_omt &omt )
+{
+    std::vector<int> contents;
+    for( const submap *sm : omt_submaps( omt ) ) {
+        for( int x = 0; x < SEEX; x++ ) {
+            for( int y = 0; y < SEEY; y++ ) {
+                contents.push_back( sm->get_ter( point( x, y ) ).to_i() );
+                contents.push_back( sm->get_furn( point( x, y ) ).to_i() );
+                contents.push_back( static_cast<int>( sm->get_items( point( x, y ) ).size() ) );
+            }
+        }
+    }
+    return contents;
+}
+
+TEST_CASE( "pristine_tiles_regenerate_the_same", "[mapgen]" )
+{
+    clear_avatar();
+    clear_map();
+    MAPBUFFER.clear_outside_reality_bubble();
+
+    const tripoint_abs_omt omt = get_avatar().global_omt_location() + point( 6, 0 );
+    overmap_buffer.ter_set( omt, oter_field.id() );
+    REQUIRE( MAPBUFFER.lookup_submap( project_to<coords::sm>( omt ) ) == nullptr );
+
+    const time_point when = calendar::turn;
+    generate_omt( omt, when, 1234 );
+    const std::vector<int> generated = omt_contents( omt );
+    for( const submap *sm : omt_submaps( omt ) ) {
+        CHECK( sm->pristine );
+        CHECK( sm->mapgen_seed == 1234 );
+        CHECK( sm->generated_at == when );
+    }
+
+    MAPBUFFER.clear_outside_reality_bubble();
+    REQUIRE( MAPBUFFER.lookup_submap( project_to<coords::sm>( omt ) ) == nullptr );
+    restore_on_out_of_scope<time_point> restore_turn( calendar::turn );
+    calendar::turn += 1_hours;
+    generate_omt( omt, when, 1234 );
+    CHECK( omt_contents( omt ) == generated );
+
+    // Loaded into a map, it may be changed from there on
+    tinymap tm;
+    tm.load( project_to<coords::sm>( omt ), false );
+    for( const submap *sm : omt_submaps( omt ) ) {
+        CHECK_FALSE( sm->pristine );
+    }
+}
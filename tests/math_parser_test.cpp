@@ -2,6 +2,8 @@
 
 #include <cmath>
 #include <locale>
+#include <string>
+#include <vector>
 
 #include "avatar.h"
 #include "dialogue.h"
@@ -348,3 +350,63 @@ TEST_CASE( "math_parser_dialogue_integration", "[math_parser]" )
         CHECK_FALSE( testexp.parse( "val( 'stamina' ) * 3", true ) ); // eval expression in assignment tree
     } );
 }
+
+static const std::vector<std::string> bytecode_test_expressions = {
+    "50 + 2 * 3 ^ 2",
+    "-3^-2",
+    "!(1 == 0)",
+    "1?0?-1:-2:1",
+    "(1==1?2:3)?4:5",
+    "cos( sin( min( 1 + 2, -50 ) ) )",
+    "max( 1, 2, 3, 4, 5, 6 )",
+    "x + u_x * n_x",
+    "x > 50 ? u_x : n_x",
+    "x > 500 ? u_x : ( n_x < 0 ? 1 : clamp( x, u_x, n_x ) )",
+    "value_or(_ctx, 13) * 2 + has_var(_ctx)",
+    "((((((((5+7)*7.123)-3)-((5+7)-(7.123*3)))-((5*(7-(7.123*3)))/((5*7)+(7.123+3))))-((((5+7)-(7.123*3))+((5/7)+(7.123+3)))+(((5*7)+(7.123+3))*((5/7)/(7.123-3)))))-(((((5/7)-(7.321/3))*((5-7)+(7.321+3)))*(((5-7)-(7.321+3))+((5-7)*(7.321/3))))*((((5-7)+(7.321+3))-((5*7)*(7.321+3)))-(((5-7)*(7.321/3))/(5+((7/7.321)+3)))))))",
+};
+
+TEST_CASE( "math_parser_bytecode_matches_tree", "[math_parser]" )
+{
+    standard_npc dude;
+    dialogue d( get_talker_for( get_avatar() ), get_talker_for( &dude ) );
+    get_globals().set_global_value( "npctalk_var_x", "100" );
+    get_avatar().set_value( "npctalk_var_x", "92" );
+    dude.set_value( "npctalk_var_x", "21" );
+
+    math_exp testexp;
+    for( const std::string &expr : bytecode_test_expressions ) {
+        CAPTURE( expr );
+        REQUIRE( testexp.parse( expr ) );
+        CHECK( testexp.eval( d ) == Approx( testexp.eval_tree( d ) ) );
+    }
+}
+
+TEST_CASE( "math_parser_bytecode_benchmark", "[.][math_parser][benchmark]" )
+{
+    standard_npc dude;
+    dialogue d( get_talker_for( get_avatar() ), get_talker_for( &dude ) );
+    get_globals().set_global_value( "npctalk_var_x", "100" );
+    get_avatar().set_value( "npctalk_var_x", "92" );
+    dude.set_value( "npctalk_var_x", "21" );
+
+    std::vector<math_exp> exps( bytecode_test_expressions.size() );
+    for( size_t i = 0; i < exps.size(); ++i ) {
+        REQUIRE( exps[i].parse( bytecode_test_expressions[i] ) );
+    }
+
+    BENCHMARK( "tree" ) {
+        double sum = 0;
+        for( const math_exp &e : exps ) {
+            sum += e.eval_tree( d );
+        }
+        return sum;
+    };
+    BENCHMARK( "bytecode" ) {
+        double sum = 0;
+        for( const math_exp &e : exps ) {
+            sum += e.eval( d );
+        }
+        return sum;
+    };
+}
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "cata_catch.h"
 
 #include "mdarray.h"
@@ -14,3 +16,33 @@ TEST_CASE( "mdarray_default_size_sensible", "[mdarray]" )
     static_assert( mdarray<int, point_om_omt>::size_x == OMAPX );
     static_assert( mdarray<int, point_om_omt>::size_y == OMAPY );
 }
+
+TEST_CASE( "mdarray_bulk_operations", "[mdarray]" )
+{
+    cata::mdarray<int, point_sm_ms> a( 3 );
+    CHECK( a.count_if( []( int v ) {
+        return v == 3;
+    } ) == SEEX * SEEY );
+
+    a[point_sm_ms( 2, 5 )] = 7;
+    CHECK( a.data()[2 * SEEY + 5] == 7 );
+
+    cata::mdarray<int, point_sm_ms> b;
+    b.copy_from( a );
+    CHECK( b[point_sm_ms( 2, 5 )] == 7 );
+    CHECK( b[point_sm_ms( 5, 2 )] == 3 );
+
+    cata::mdarray<bool, point_sm_ms> big;
+    big.transform_from( b, []( int v ) {
+        return v > 5;
+    } );
+    CHECK( big[point_sm_ms( 2, 5 )] );
+    CHECK( big.count_if( []( bool v ) {
+        return v;
+    } ) == 1 );
+
+    b.fill( 0 );
+    CHECK( std::all_of( b.begin(), b.end(), []( int v ) {
+        return v == 0;
+    } ) );
+}
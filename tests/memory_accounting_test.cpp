@@ -0,0 +1,41 @@
+#include <string>
+#include <vector>
+
+#include "calendar.h"
+#include "cata_catch.h"
+#include "item.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "memory_accounting.h"
+#include "point.h"
+#include "type_id.h"
+
+static const itype_id itype_2x4( "2x4" );
+
+static memory_accounting::usage find_usage( const std::string &name )
+{
+    for( const memory_accounting::subsystem_usage &entry : memory_accounting::estimate() ) {
+        if( entry.name == name ) {
+            return entry.use;
+        }
+    }
+    FAIL( "No memory accounting entry " << name );
+    return {};
+}
+
+TEST_CASE( "memory_accounting_counts_items_on_the_map", "[memory_accounting]" )
+{
+    clear_map();
+    const memory_accounting::usage before = find_usage( "items" );
+    map &here = get_map();
+    for( int i = 0; i < 10; ++i ) {
+        here.add_item( tripoint( 60, 60 + i, 0 ), item( itype_2x4, calendar::turn ) );
+    }
+    const memory_accounting::usage after = find_usage( "items" );
+    CHECK( after.count == before.count + 10 );
+    CHECK( after.bytes == before.bytes + 10 * sizeof( item ) );
+
+    CHECK( find_usage( "mapbuffer submaps" ).count > 0 );
+    CHECK( find_usage( "item types" ).count > 0 );
+    CHECK( memory_accounting::report().find( "total" ) != std::string::npos );
+}
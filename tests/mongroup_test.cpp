@@ -5,6 +5,7 @@
 #include "cata_utility.h"
 #include "coordinates.h"
 #include "game.h"
+#include "horde_map.h"
 #include "item.h"
 #include "map.h"
 #include "map_helpers.h"
@@ -412,3 +413,34 @@ TEST_CASE( "mongroup_multi_spawn_restrictions", "[mongroup]" )
         CHECK( counts.count( mon_test_zombie_cop ) > 0 );
     }
 }
+
+TEST_CASE( "horde_map_finds_groups_after_moving_in_place", "[mongroup]" )
+{
+    horde_map hordes;
+    const tripoint_abs_sm origin( 10, 10, 0 );
+    const tripoint_om_sm here( origin.raw() );
+    for( int i = 0; i < 5; ++i ) {
+        const mongroup group( GROUP_PET_DOGS, origin + tripoint( 4 - i, 0, 0 ), i + 1 );
+        hordes.emplace( group.rel_pos(), group );
+    }
+    REQUIRE( hordes.size() == 5 );
+
+    auto at_origin = hordes.equal_range( here );
+    REQUIRE( std::distance( at_origin.first, at_origin.second ) == 1 );
+    CHECK( at_origin.first->second.population == 5 );
+
+    // Move every group onto the origin
+    for( horde_map::value_type &entry : hordes ) {
+        entry.second.abs_pos = origin;
+    }
+    hordes.update_positions();
+    at_origin = hordes.equal_range( here );
+    CHECK( std::distance( at_origin.first, at_origin.second ) == 5 );
+    const auto beside = hordes.equal_range( here + tripoint_east );
+    CHECK( beside.first == beside.second );
+
+    hordes.erase_if( []( const mongroup & group ) {
+        return group.population % 2 == 0;
+    } );
+    CHECK( hordes.size() == 3 );
+}
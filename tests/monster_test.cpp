@@ -4,6 +4,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -13,6 +14,7 @@
 #include "cata_catch.h"
 #include "cata_scope_helpers.h"
 #include "character.h"
+#include "creature_tracker.h"
 #include "filesystem.h"
 #include "game.h"
 #include "game_constants.h"
@@ -25,6 +27,7 @@
 #include "options.h"
 #include "options_helpers.h"
 #include "point.h"
+#include "scent_map.h"
 #include "test_statistics.h"
 #include "type_id.h"
 
@@ -401,3 +404,64 @@ TEST_CASE( "limit_mod_size_bonus", "[monster]" )
     test_monster2.mod_size_bonus( 3 );
     CHECK( test_monster2.get_size() == creature_size::huge );
 }
+
+TEST_CASE( "creature_tracker_area_queries_follow_monsters", "[monster]" )
+{
+    clear_map();
+    creature_tracker &creatures = get_creature_tracker();
+    map &here = get_map();
+    const tripoint origin( 60, 60, 0 );
+    monster &close = spawn_test_monster( "mon_zombie", origin + point( 2, 1 ) );
+    monster &distant = spawn_test_monster( "mon_zombie", origin + point( 30, 0 ) );
+
+    const auto found_within = [&]( const int radius ) {
+        std::set<const monster *> found;
+        creatures.for_each_in_radius( here.getglobal( origin ), radius, [&]( monster & critter ) {
+            found.insert( &critter );
+        } );
+        return found;
+    };
+
+    CHECK( found_within( 5 ) == std::set<const monster *> { &close } );
+    CHECK( found_within( 40 ) == std::set<const monster *> { &close, &distant } );
+
+    // Moving a monster to another submap keeps the index current.
+    distant.setpos( origin + point( 3, 3 ) );
+    CHECK( found_within( 5 ) == std::set<const monster *> { &close, &distant } );
+
+    close.setpos( origin + point( 40, 10 ) );
+    CHECK( found_within( 5 ) == std::set<const monster *> { &distant } );
+    CHECK( creatures.find_all_in( inclusive_cuboid<tripoint_abs_ms>(
+                                      here.getglobal( origin + point( 35, 5 ) ),
+                                      here.getglobal( origin + point( 45, 15 ) ) ) ).size() == 1 );
+}
+
+TEST_CASE( "distant_idle_monsters_go_dormant_until_disturbed", "[monster]" )
+{
+    clear_map();
+    get_scent().reset();
+    get_player_character().setpos( tripoint( 10, 10, 0 ) );
+    monster &zombie = spawn_test_monster( "mon_zombie", tripoint( 100, 100, 0 ) );
+    CHECK( !zombie.is_dormant() );
+
+    // Nothing to see out here, so it soon stops paying attention.
+    for( int i = 0; i < 20; ++i ) {
+        zombie.plan();
+    }
+    REQUIRE( zombie.is_dormant() );
+    int skipped = 0;
+    for( int i = 0; i < 10; ++i ) {
+        skipped += zombie.skip_dormant_turn() ? 1 : 0;
+    }
+    CHECK( skipped == 8 );
+
+    SECTION( "a sound wakes it up" ) {
+        zombie.wander_to( zombie.get_location() + point( 5, 0 ), 10 );
+        CHECK( !zombie.is_dormant() );
+        CHECK( !zombie.skip_dormant_turn() );
+    }
+    SECTION( "a character coming close wakes it up" ) {
+        get_player_character().setpos( tripoint( 80, 90, 0 ) );
+        CHECK( !zombie.is_dormant() );
+    }
+}
@@ -2,6 +2,7 @@
 #include "calendar.h"
 #include "cata_catch.h"
 #include "cata_scope_helpers.h"
+#include "creature.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "mapdata.h"
@@ -71,3 +72,34 @@ TEST_CASE( "monsters_should_not_see_through_floors", "[vision]" )
     CHECK( sky.sees( distant ) );
     CHECK( distant.sees( sky ) );
 }
+
+TEST_CASE( "sight_memo_remembers_until_something_changes", "[vision]" )
+{
+    calendar::turn = midday;
+    clear_map();
+    restore_on_out_of_scope<bool> restore_memo( memoize_sight );
+    memoize_sight = true;
+    map &here = get_map();
+    monster &watcher = spawn_and_clear( { 5, 5, 0 }, true );
+    monster &target = spawn_and_clear( { 5, 10, 0 }, true );
+    here.build_map_cache( 0 );
+
+    sight_memo::reset_counters();
+    CHECK( watcher.sees( target ) );
+    CHECK( watcher.sees( target ) );
+    CHECK( sight_memo::get_counters().misses == 1 );
+    CHECK( sight_memo::get_counters().hits == 1 );
+
+    // A moved creature is looked at again.
+    target.setpos( { 6, 10, 0 } );
+    CHECK( watcher.sees( target ) );
+    CHECK( sight_memo::get_counters().misses == 2 );
+
+    // So is everything once the map changes.
+    here.ter_set( tripoint( 5, 8, 0 ), t_wall );
+    here.ter_set( tripoint( 6, 8, 0 ), t_wall );
+    here.build_map_cache( 0 );
+    CHECK( !watcher.sees( target ) );
+    CHECK( sight_memo::get_counters().misses == 3 );
+    CHECK( sight_memo::get_counters().hits == 1 );
+}
@@ -14,6 +14,8 @@
 
 static const effect_on_condition_id effect_on_condition_changing_mutate2( "changing_mutate2" );
 
+static const json_character_flag json_flag_LARGE( "LARGE" );
+
 static const morale_type morale_perm_debug( "morale_perm_debug" );
 
 static const mutation_category_id mutation_category_ALPHA( "ALPHA" );
@@ -27,6 +29,7 @@ static const mutation_category_id mutation_category_REMOVAL_TEST( "REMOVAL_TEST"
 
 static const trait_id trait_EAGLEEYED( "EAGLEEYED" );
 static const trait_id trait_GOURMAND( "GOURMAND" );
+static const trait_id trait_LARGE( "LARGE" );
 static const trait_id trait_SMELLY( "SMELLY" );
 static const trait_id trait_TEST_REMOVAL_0( "TEST_REMOVAL_0" );
 static const trait_id trait_TEST_REMOVAL_1( "TEST_REMOVAL_1" );
@@ -652,3 +655,19 @@ TEST_CASE( "The_mutation_flags_are_associated_to_the_corresponding_base_mutation
     verify_mutation_flag( dummy, "COLDBLOOD4", "ECTOTHERM" );
 }
 
+
+TEST_CASE( "trait_flags_follow_added_and_removed_mutations", "[mutations][flags]" )
+{
+    Character &dummy = get_player_character();
+    clear_avatar();
+    REQUIRE_FALSE( dummy.has_trait_flag( json_flag_LARGE ) );
+    CHECK( dummy.count_trait_flag( json_flag_LARGE ) == 0 );
+
+    dummy.set_mutation( trait_LARGE );
+    CHECK( dummy.has_trait_flag( json_flag_LARGE ) );
+    CHECK( dummy.count_trait_flag( json_flag_LARGE ) == 1 );
+
+    dummy.unset_mutation( trait_LARGE );
+    CHECK_FALSE( dummy.has_trait_flag( json_flag_LARGE ) );
+    CHECK( dummy.count_trait_flag( json_flag_LARGE ) == 0 );
+}
@@ -309,6 +309,44 @@ TEST_CASE( "NPC_faces_zombies", "[npc_attack]" )
     }
 }
 
+TEST_CASE( "NPC_reuses_weapon_choice_while_nothing_changes", "[npc_attack]" )
+{
+    get_player_character().setpos( main_npc_start_tripoint );
+    clear_map_and_put_player_underground();
+    clear_vehicles();
+    scoped_weather_override sunny_weather( weather_sunny );
+    npc &main_npc = npc_attack_setup::respawn_main_npc();
+    main_npc.set_fac( faction_your_followers );
+
+    monster *zombie = npc_attack_setup::spawn_zombie_at_range( 1 );
+    item weapon( "knife_chef" );
+    main_npc.set_wielded_item( weapon );
+
+    main_npc.evaluate_best_weapon( zombie );
+    const std::shared_ptr<npc_attack> first = main_npc.get_current_attack();
+    REQUIRE( first );
+
+    main_npc.evaluate_best_weapon( zombie );
+    CHECK( main_npc.get_current_attack() == first );
+
+    WHEN( "the target moves" ) {
+        zombie->setpos( zombie->pos() + tripoint_south );
+        main_npc.evaluate_best_weapon( zombie );
+        THEN( "the attack is evaluated again" ) {
+            CHECK( main_npc.get_current_attack() != first );
+        }
+    }
+    WHEN( "the NPC's inventory changes" ) {
+        const unsigned int inventory_version = main_npc.get_inventory_version();
+        main_npc.i_add( item( "rock" ) );
+        REQUIRE( main_npc.get_inventory_version() != inventory_version );
+        main_npc.evaluate_best_weapon( zombie );
+        THEN( "the attack is evaluated again" ) {
+            CHECK( main_npc.get_current_attack() != first );
+        }
+    }
+}
+
 // TODO: Add scenarios for:
 // - NPCs carrying a mix of weapons
 // - NPCs trying to shoot through allies
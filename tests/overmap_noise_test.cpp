@@ -1,3 +1,5 @@
+#include <vector>
+
 #include "cata_catch.h"
 #include "coordinates.h"
 #include "filesystem.h"
@@ -65,3 +67,45 @@ TEST_CASE( "om_noise_layer_lake_export", "[.]" )
     export_raw_noise( "lake-map-raw.pgm", f, OMAPX * 5, OMAPY * 5 );
     export_interpreted_noise( "lake-map-interp.pgm", f, OMAPX * 5, OMAPY * 5, 0.25 );
 }
+
+TEST_CASE( "om_noise_layer_precomputed_matches_source", "[overmap][noise]" )
+{
+    const om_noise::om_noise_layer_lake source( point_abs_omt( 540, -180 ), 1920237457 );
+    const om_noise::om_noise_layer_precomputed precomputed( source );
+
+    // Including locations well outside of the precomputed border.
+    for( int x = -20; x < OMAPX + 20; x++ ) {
+        for( int y = -20; y < OMAPY + 20; y++ ) {
+            const point_om_omt p( x, y );
+            if( precomputed.noise_at( p ) != source.noise_at( p ) ) {
+                CAPTURE( p );
+                FAIL( "precomputed noise differs" );
+            }
+        }
+    }
+}
+
+static void check_noise_row( const om_noise::om_noise_layer &noise )
+{
+    std::vector<float> row( OMAPX );
+    for( int y = 0; y < OMAPY; y += 7 ) {
+        noise.noise_row( point_om_omt( -3, y ), OMAPX, row.data() );
+        for( int x = 0; x < OMAPX; x++ ) {
+            const point_om_omt p( x - 3, y );
+            if( row[x] != noise.noise_at( p ) ) {
+                CAPTURE( p );
+                FAIL( "noise of row differs" );
+            }
+        }
+    }
+}
+
+TEST_CASE( "om_noise_layer_rows_match_single_locations", "[overmap][noise]" )
+{
+    const point_abs_omt base( -360, 720 );
+    const unsigned seed = 1920237457;
+    check_noise_row( om_noise::om_noise_layer_forest( base, seed ) );
+    check_noise_row( om_noise::om_noise_layer_floodplain( base, seed ) );
+    check_noise_row( om_noise::om_noise_layer_lake( base, seed ) );
+    check_noise_row( om_noise::om_noise_layer_ocean( base, seed ) );
+}
@@ -1,4 +1,7 @@
+#include <algorithm>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "all_enum_values.h"
@@ -10,6 +13,7 @@
 #include "enums.h"
 #include "game_constants.h"
 #include "global_vars.h"
+#include "json_loader.h"
 #include "map.h"
 #include "mapbuffer.h"
 #include "omdata.h"
@@ -111,6 +115,98 @@ TEST_CASE( "set_and_get_overmap_scents", "[overmap]" )
     REQUIRE( test_overmap->scent_at( { 75, 85, 0} ).initial_strength == 90 );
 }
 
+TEST_CASE( "overmap_terrain_survives_save_and_load", "[overmap]" )
+{
+    std::unique_ptr<overmap> saved = std::make_unique<overmap>( point_abs_om() );
+    saved->ter_set( { 10, 20, 0 }, oter_cabin.id() );
+    saved->ter_set( { 30, 40, -2 }, oter_cabin_north.id() );
+    saved->ter_set( { 50, 60, 3 }, oter_cabin_east.id() );
+
+    std::ostringstream os;
+    saved->serialize( os );
+    const std::string data = os.str();
+    // Skip the version line.
+    const JsonValue jsin = json_loader::from_string( data.substr( data.find( '\n' ) + 1 ) );
+
+    std::unique_ptr<overmap> loaded = std::make_unique<overmap>( point_abs_om() );
+    loaded->unserialize( jsin.get_object() );
+
+    // Layers are decoded on first access, so look at every one of them.
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; ++z ) {
+        for( int x = 0; x < OMAPX; x += 10 ) {
+            for( int y = 0; y < OMAPY; y += 10 ) {
+                const tripoint_om_omt p( x, y, z );
+                CAPTURE( p );
+                CHECK( loaded->ter( p ) == saved->ter( p ) );
+            }
+        }
+    }
+    CHECK( loaded->ter( { 10, 20, 0 } ) == oter_cabin.id() );
+    CHECK( loaded->ter( { 30, 40, -2 } ) == oter_cabin_north.id() );
+    CHECK( loaded->ter( { 50, 60, 3 } ) == oter_cabin_east.id() );
+
+    // Saving again writes out the layers whether they have been decoded or not.
+    std::unique_ptr<overmap> reloaded = std::make_unique<overmap>( point_abs_om() );
+    reloaded->unserialize( jsin.get_object() );
+    std::ostringstream os2;
+    reloaded->serialize( os2 );
+    CHECK( os2.str() == data );
+}
+
+TEST_CASE( "overmap_terrain_search_finds_closest_first", "[overmap]" )
+{
+    overmap_special_batch no_specials( point_abs_om(), {} );
+    overmap_buffer.create_custom_overmap( point_abs_om(), no_specials );
+
+    // High up in the sky, where nothing else is placed.
+    const tripoint_abs_omt origin( 90, 90, 5 );
+    const std::vector<tripoint_abs_omt> cabins = {
+        origin + point( 3, 1 ), origin + point( -20, 5 ), origin + point( 40, -40 )
+    };
+    const oter_id sky = overmap_buffer.ter( cabins[0] );
+    for( const tripoint_abs_omt &p : cabins ) {
+        overmap_buffer.ter_set( p, oter_cabin.id() );
+    }
+
+    omt_find_params params;
+    params.types.emplace_back( "cabin", ot_match_type::type );
+    params.search_range = 50;
+    params.existing_only = true;
+    CHECK( overmap_buffer.find_all( origin, params ) == cabins );
+    CHECK( overmap_buffer.find_closest( origin, params ) == cabins[0] );
+
+    params.min_distance = 10;
+    CHECK( overmap_buffer.find_all( origin, params ) ==
+           std::vector<tripoint_abs_omt> { cabins[1], cabins[2] } );
+    CHECK( overmap_buffer.find_closest( origin, params ) == cabins[1] );
+
+    // Later searches see changed terrain.
+    params.min_distance = 0;
+    overmap_buffer.ter_set( cabins[0], sky );
+    CHECK( overmap_buffer.find_closest( origin, params ) == cabins[1] );
+
+    params.search_range = 10;
+    CHECK( overmap_buffer.find_all( origin, params ).empty() );
+
+    overmap_buffer.clear();
+}
+
+TEST_CASE( "evicted_overmaps_load_back_unchanged", "[overmap]" )
+{
+    const point_abs_om far_away( 10, 10 );
+    overmap_special_batch no_specials( far_away, {} );
+    overmap_buffer.create_custom_overmap( far_away, no_specials );
+    const tripoint_abs_omt cabin = project_to<coords::omt>( tripoint_abs_om( far_away, 0 ) ) +
+                                   point( 20, 30 );
+    overmap_buffer.ter_set( cabin, oter_cabin.id() );
+
+    CHECK( overmap_buffer.evict( 0 ) > 0 );
+    // Loaded again on the next use
+    CHECK( overmap_buffer.ter( cabin ) == oter_cabin.id() );
+
+    overmap_buffer.clear();
+}
+
 TEST_CASE( "default_overmap_generation_always_succeeds", "[overmap][slow]" )
 {
     int overmaps_to_construct = 10;
@@ -187,6 +283,27 @@ TEST_CASE( "default_overmap_generation_has_non_mandatory_specials_at_origin", "[
     overmap_buffer.clear();
 }
 
+TEST_CASE( "overmap_special_fits_at_matches_its_locations", "[overmap]" )
+{
+    const std::vector<tripoint_om_omt> points = {
+        { 0, 0, 0 }, { 1, 1, 0 }, { 2, 3, 0 }, { OMAPX / 2, OMAPY / 2, 0 },
+        { OMAPX - 2, 5, 0 }, { 7, OMAPY - 3, 0 }, { OMAPX - 1, OMAPY - 1, 0 }
+    };
+    for( const overmap_special &special : overmap_specials::get_all() ) {
+        for( const tripoint_om_omt &p : points ) {
+            for( om_direction::type r : om_direction::all ) {
+                const std::vector<overmap_special_locations> &locs = special.required_locations();
+                const bool expected = std::all_of( locs.begin(), locs.end(),
+                [&]( const overmap_special_locations & loc ) {
+                    return overmap::inbounds( p + om_direction::rotate( loc.p, r ), 1 );
+                } );
+                CAPTURE( special.id.str(), p, io::enum_to_string( r ) );
+                CHECK( special.fits_at( p, r ) == expected );
+            }
+        }
+    }
+}
+
 TEST_CASE( "is_ot_match", "[overmap][terrain]" )
 {
     SECTION( "exact match" ) {
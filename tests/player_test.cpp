@@ -183,3 +183,31 @@ TEST_CASE( "sweating", "[char][suffer][.bodytemp]" )
 
     }
 }
+
+TEST_CASE( "body_temperature_at_rest_follows_a_change_of_weather", "[char][bodytemp]" )
+{
+    avatar &dummy = get_avatar();
+    clear_character( dummy );
+    weather_manager &weather = get_weather();
+
+    weather.temperature = units::from_fahrenheit( 64 );
+    weather.clear_temp_cache();
+    dummy.set_all_parts_temp_cur( BODYTEMP_NORM );
+    dummy.set_all_parts_temp_conv( BODYTEMP_NORM );
+    const bodypart_id torso( "torso" );
+    units::temperature settled = 0_K;
+    for( int i = 0; i < 10000 && settled != dummy.get_part_temp_cur( torso ); i++ ) {
+        settled = dummy.get_part_temp_cur( torso );
+        dummy.update_bodytemp();
+    }
+    REQUIRE( dummy.get_part_temp_cur( torso ) == settled );
+    for( int i = 0; i < 10; i++ ) {
+        dummy.update_bodytemp();
+    }
+    CHECK( dummy.get_part_temp_cur( torso ) == settled );
+
+    weather.temperature = units::from_fahrenheit( 20 );
+    weather.clear_temp_cache();
+    dummy.update_bodytemp();
+    CHECK( dummy.get_part_temp_cur( torso ) < settled );
+}
@@ -0,0 +1,34 @@
+#include "cata_catch.h"
+#include "profile_zones.h"
+
+TEST_CASE( "profile_zones_collect_per_turn_totals", "[profile_zones]" )
+{
+    profile_zones::reset();
+    profile_zones::set_enabled( true );
+    for( int i = 0; i < 3; ++i ) {
+        {
+            profile_zones::scoped_zone first( profile_zones::zone::process_fields );
+        }
+        {
+            profile_zones::scoped_zone second( profile_zones::zone::process_fields );
+        }
+        profile_zones::end_turn();
+    }
+    // A turn without the zone does not add a sample.
+    profile_zones::end_turn();
+
+    const profile_zones::zone_stats stats = profile_zones::get_stats(
+            profile_zones::zone::process_fields );
+    CHECK( stats.turns == 3 );
+    CHECK( stats.min_ms <= stats.avg_ms );
+    CHECK( stats.min_ms <= stats.p99_ms );
+    CHECK( profile_zones::get_stats( profile_zones::zone::vehmove ).turns == 0 );
+
+    profile_zones::set_enabled( false );
+    {
+        profile_zones::scoped_zone ignored( profile_zones::zone::vehmove );
+    }
+    profile_zones::end_turn();
+    CHECK( profile_zones::get_stats( profile_zones::zone::vehmove ).turns == 0 );
+    profile_zones::reset();
+}
@@ -2,7 +2,15 @@
 #include <optional>
 #include <vector>
 
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#else
+#   include <thread>
+#endif
+
+#include "calendar.h"
 #include "cata_catch.h"
+#include "point.h"
 #include "rng.h"
 #include "test_statistics.h"
 
@@ -78,3 +86,57 @@ TEST_CASE( "random_entry_preserves_constness", "[rng]" )
     i1 = 5678;
     CHECK( v1[0] == 5678 );
 }
+
+static std::vector<int> draw_ints()
+{
+    std::vector<int> ret;
+    for( int i = 0; i < 8; ++i ) {
+        ret.push_back( rng( 0, 1000000 ) );
+    }
+    return ret;
+}
+
+static std::vector<int> draw_sequence()
+{
+    std::vector<int> ret = draw_ints();
+    ret.push_back( static_cast<int>( normal_roll( 0.0, 1000.0 ) ) );
+    return ret;
+}
+
+static std::vector<int> draw_stream( unsigned int seed )
+{
+    const rng_stream_scope scope( seed );
+    return draw_sequence();
+}
+
+TEST_CASE( "rng_streams_are_reproducible_and_independent", "[rng]" )
+{
+    const time_point turn = calendar::turn_zero + 10_days;
+    const unsigned int seed = rng_stream_seed( 1234, "mapgen", tripoint( 3, 4, 0 ), turn );
+    CHECK( seed == rng_stream_seed( 1234, "mapgen", tripoint( 3, 4, 0 ), turn ) );
+    CHECK( seed != rng_stream_seed( 1235, "mapgen", tripoint( 3, 4, 0 ), turn ) );
+    CHECK( seed != rng_stream_seed( 1234, "fields", tripoint( 3, 4, 0 ), turn ) );
+    CHECK( seed != rng_stream_seed( 1234, "mapgen", tripoint( 4, 3, 0 ), turn ) );
+    CHECK( seed != rng_stream_seed( 1234, "mapgen", tripoint( 3, 4, 0 ), turn + 1_turns ) );
+
+    const std::vector<int> stream = draw_stream( seed );
+    CHECK( draw_stream( seed ) == stream );
+    CHECK( draw_stream( seed + 1 ) != stream );
+
+    SECTION( "a stream doesn't disturb the global sequence" ) {
+        rng_set_engine_seed( 42 );
+        const std::vector<int> plain = draw_ints();
+        rng_set_engine_seed( 42 );
+        CHECK( draw_stream( seed ) == stream );
+        CHECK( draw_ints() == plain );
+    }
+
+    SECTION( "other threads get the same stream" ) {
+        std::vector<int> on_thread;
+        std::thread worker( [&on_thread, seed]() {
+            on_thread = draw_stream( seed );
+        } );
+        worker.join();
+        CHECK( on_thread == stream );
+    }
+}
@@ -1,5 +1,7 @@
+#include "cached_options.h"
 #include "calendar.h"
 #include "cata_catch.h"
+#include "cata_scope_helpers.h"
 #include "enums.h"
 #include "item.h"
 #include "map.h"
@@ -99,6 +101,37 @@ TEST_CASE( "Items_rot_away", "[rot]" )
     }
 }
 
+TEST_CASE( "Fast_rot_catch_up_matches_hourly_steps", "[rot]" )
+{
+    if( calendar::turn <= calendar::start_of_cataclysm ) {
+        calendar::turn = calendar::start_of_cataclysm + 1_minutes;
+    }
+
+    item hourly_item( "meat_cooked" );
+    item fast_item( "meat_cooked" );
+    hourly_item.process( get_map(), nullptr, tripoint_zero, 1, temperature_flag::FRIDGE );
+    fast_item.process( get_map(), nullptr, tripoint_zero, 1, temperature_flag::FRIDGE );
+
+    // Come back after long enough that most of the absence is caught up in one go.
+    calendar::turn += 5_days;
+    const bool hourly_gone = hourly_item.process_temperature_rot( 1, tripoint_zero, get_map(), nullptr,
+                             temperature_flag::FRIDGE );
+    bool fast_gone = false;
+    {
+        restore_on_out_of_scope<bool> restore_fast( fast_rot_catch_up );
+        fast_rot_catch_up = true;
+        fast_gone = fast_item.process_temperature_rot( 1, tripoint_zero, get_map(), nullptr,
+                    temperature_flag::FRIDGE );
+    }
+
+    CHECK( fast_gone == hourly_gone );
+    if( !hourly_gone ) {
+        CHECK( hourly_item.get_rot() > 0_turns );
+        CHECK( to_turns<double>( fast_item.get_rot() ) ==
+               Approx( to_turns<double>( hourly_item.get_rot() ) ).epsilon( 0.05 ) );
+    }
+}
+
 TEST_CASE( "Hourly_rotpoints", "[rot]" )
 {
     item normal_item( "meat_cooked" );
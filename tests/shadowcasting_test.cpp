@@ -356,6 +356,63 @@ static void shadowcasting_float_quad(
     REQUIRE( passed );
 }
 
+// Reports how many output cells per second castLightAll fills in for the lightmap
+// (four_quadrants) and field of view (float) variants.
+static void shadowcasting_cells_per_second( const int iterations,
+        const unsigned int denominator = DENOMINATOR )
+{
+    struct test_grids {
+        cata::mdarray<float, point_bub_ms> lit_squares_float = {};
+        cata::mdarray<four_quadrants, point_bub_ms> lit_squares_quad = {};
+        cata::mdarray<float, point_bub_ms> transparency_cache = {};
+    };
+
+    std::unique_ptr<test_grids> grids = std::make_unique<test_grids>();
+    randomly_fill_transparency( grids->transparency_cache, NUMERATOR, denominator );
+
+    const point offset( 65, 65 );
+
+    // Every cast covers the same cells, so count them once up front.
+    castLightAll<float, float, sight_calc, sight_check, update_light, accumulate_transparency>(
+        grids->lit_squares_float, grids->transparency_cache, offset );
+    long long cells_per_cast = 0;
+    for( int x = 0; x < MAPSIZE_X; ++x ) {
+        for( int y = 0; y < MAPSIZE_Y; ++y ) {
+            if( grids->lit_squares_float[x][y] > 0.0f ) {
+                ++cells_per_cast;
+            }
+        }
+    }
+    REQUIRE( cells_per_cast > 0 );
+
+    const std::chrono::high_resolution_clock::time_point start1 =
+        std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < iterations; i++ ) {
+        castLightAll<float, four_quadrants, sight_calc, sight_check, update_light_quadrants,
+                     accumulate_transparency>(
+                         grids->lit_squares_quad, grids->transparency_cache, offset );
+    }
+    const std::chrono::high_resolution_clock::time_point end1 =
+        std::chrono::high_resolution_clock::now();
+
+    const std::chrono::high_resolution_clock::time_point start2 =
+        std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < iterations; i++ ) {
+        castLightAll<float, float, sight_calc, sight_check, update_light, accumulate_transparency>(
+            grids->lit_squares_float, grids->transparency_cache, offset );
+    }
+    const std::chrono::high_resolution_clock::time_point end2 =
+        std::chrono::high_resolution_clock::now();
+
+    const double seconds1 = std::chrono::duration<double>( end1 - start1 ).count();
+    const double seconds2 = std::chrono::duration<double>( end2 - start2 ).count();
+    const double cells = static_cast<double>( cells_per_cast ) * iterations;
+    printf( "castLight on four_quadrants (denominator %u): %.3g cells/second.\n",
+            denominator, cells / std::max( seconds1, 1e-9 ) );
+    printf( "castLight on floats (denominator %u): %.3g cells/second.\n",
+            denominator, cells / std::max( seconds2, 1e-9 ) );
+}
+
 static void do_3d_benchmark(
     const array_of_grids_of<const float> &transparency_caches,
     const int iterations )
@@ -1133,6 +1190,12 @@ TEST_CASE( "shadowcasting_float_quad_performance", "[.]" )
     shadowcasting_float_quad( 1000000, 100 );
 }
 
+TEST_CASE( "shadowcasting_cells_per_second", "[.]" )
+{
+    shadowcasting_cells_per_second( 100000 );
+    shadowcasting_cells_per_second( 100000, 100 );
+}
+
 // I'm not sure this will ever work.
 TEST_CASE( "bresenham_vs_shadowcasting", "[.]" )
 {
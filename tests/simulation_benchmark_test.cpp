@@ -0,0 +1,254 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "game.h"
+#include "game_constants.h"
+#include "item.h"
+#include "json.h"
+#include "json_loader.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "monster.h"
+#include "monster_helpers.h"
+#include "overmap.h"
+#include "overmapbuffer.h"
+#include "pathfinding.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "scent_map.h"
+#include "type_id.h"
+#include "units.h"
+
+// Benchmarks of the parts of a game turn that dominate play time, each on a fixture that
+// stresses it. They are hidden; run them all with `make cata_bench` (or the cata_bench
+// CMake target), which writes Catch's XML report, benchmark samples included, to
+// cata_bench.xml for comparing across releases.
+//
+// The fixtures are built from scratch on the test map, with a fixed rng seed from the
+// bench target, so runs on the same build are comparable.
+
+static const field_type_str_id field_fd_fire( "fd_fire" );
+
+static const itype_id itype_2x4( "2x4" );
+static const itype_id itype_apple( "apple" );
+
+static const ter_str_id ter_t_floor( "t_floor" );
+static const ter_str_id ter_t_grass( "t_grass" );
+static const ter_str_id ter_t_pavement( "t_pavement" );
+static const ter_str_id ter_t_wall( "t_wall" );
+
+static const vproto_id vehicle_prototype_car( "car" );
+
+static const tripoint bench_center( 66, 66, 0 );
+
+static void build_open_ground()
+{
+    clear_map();
+    clear_avatar();
+    set_time_to_day();
+    build_test_map( ter_t_pavement.id() );
+    get_avatar().setpos( bench_center );
+}
+
+// A grid of walled 10x10 buildings with doorways, separated by streets
+static void build_city_block()
+{
+    build_open_ground();
+    map &here = get_map();
+    for( int bx = 12; bx + 10 < MAPSIZE_X - 12; bx += 14 ) {
+        for( int by = 12; by + 10 < MAPSIZE_Y - 12; by += 14 ) {
+            for( int x = bx; x < bx + 10; ++x ) {
+                for( int y = by; y < by + 10; ++y ) {
+                    const bool edge = x == bx || x == bx + 9 || y == by || y == by + 9;
+                    const bool door = y == by + 9 && x == bx + 4;
+                    here.ter_set( tripoint( x, y, 0 ), edge && !door ? ter_t_wall : ter_t_floor );
+                }
+            }
+        }
+    }
+    here.invalidate_map_cache( 0 );
+    here.build_map_cache( 0, true );
+}
+
+// 300 zombies on open ground around the avatar
+static void spawn_horde()
+{
+    for( int i = 0; i < 300; ++i ) {
+        const tripoint p( 21 + ( i % 30 ) * 3, 21 + ( i / 30 ) * 9, 0 );
+        if( p != bench_center ) {
+            spawn_test_monster( "mon_zombie", p );
+        }
+    }
+}
+
+// 20 cars parked in rows
+static void spawn_convoy()
+{
+    map &here = get_map();
+    for( int i = 0; i < 20; ++i ) {
+        const tripoint p( 16 + ( i % 5 ) * 20, 16 + ( i / 5 ) * 25, 0 );
+        here.add_vehicle( vehicle_prototype_car, p, 0_degrees, 100, 0 );
+    }
+}
+
+// A 40x40 field of grass with fire across it
+static void light_field()
+{
+    map &here = get_map();
+    for( int x = 20; x < 60; ++x ) {
+        for( int y = 20; y < 60; ++y ) {
+            const tripoint p( x, y, 0 );
+            here.ter_set( p, ter_t_grass );
+            if( ( x + y ) % 3 == 0 ) {
+                here.add_field( p, field_fd_fire, 2 );
+            }
+        }
+    }
+}
+
+// A base packed with loose items, 20 per tile over 30x30 tiles
+static void stock_base()
+{
+    map &here = get_map();
+    const item plank( itype_2x4, calendar::turn );
+    const item apple( itype_apple, calendar::turn );
+    for( int x = 50; x < 80; ++x ) {
+        for( int y = 50; y < 80; ++y ) {
+            for( int i = 0; i < 10; ++i ) {
+                here.add_item( tripoint( x, y, 0 ), plank );
+                here.add_item( tripoint( x, y, 0 ), apple );
+            }
+        }
+    }
+}
+
+static void monsters_turn()
+{
+    for( monster &critter : g->all_monsters() ) {
+        move_monster_turn( critter );
+    }
+}
+
+TEST_CASE( "simulation_benchmark_city_block", "[.][simulation][benchmark]" )
+{
+    build_city_block();
+    map &here = get_map();
+    const pathfinding_settings settings( 0, 200, 1000, 0, true, false, false, false, false, false );
+
+    BENCHMARK( "build_map_cache" ) {
+        here.invalidate_map_cache( 0 );
+        here.build_map_cache( 0 );
+    };
+    BENCHMARK( "route across the block" ) {
+        return here.route( tripoint( 5, 5, 0 ), tripoint( MAPSIZE_X - 6, MAPSIZE_Y - 6, 0 ),
+                           settings ).size();
+    };
+    BENCHMARK( "scent_map::update" ) {
+        get_scent().update( bench_center, here );
+        return get_scent().get( bench_center );
+    };
+}
+
+TEST_CASE( "simulation_benchmark_horde", "[.][simulation][benchmark]" )
+{
+    build_open_ground();
+    spawn_horde();
+
+    BENCHMARK( "300 monsters move" ) {
+        monsters_turn();
+        return g->num_creatures();
+    };
+}
+
+TEST_CASE( "simulation_benchmark_convoy", "[.][simulation][benchmark]" )
+{
+    build_open_ground();
+    spawn_convoy();
+    map &here = get_map();
+
+    BENCHMARK( "vehmove" ) {
+        here.vehmove();
+        return here.get_vehicles().size();
+    };
+    BENCHMARK( "build_map_cache with vehicles" ) {
+        here.invalidate_map_cache( 0 );
+        here.build_map_cache( 0 );
+    };
+}
+
+TEST_CASE( "simulation_benchmark_burning_field", "[.][simulation][benchmark]" )
+{
+    build_open_ground();
+    map &here = get_map();
+
+    BENCHMARK_ADVANCED( "process_fields" )( Catch::Benchmark::Chronometer meter ) {
+        // The fire burns out and spreads, so start every sample from the same field
+        clear_fields( 0 );
+        light_field();
+        meter.measure( [&here] {
+            here.process_fields();
+        } );
+    };
+}
+
+TEST_CASE( "simulation_benchmark_base", "[.][simulation][benchmark]" )
+{
+    build_city_block();
+    stock_base();
+    map &here = get_map();
+
+    BENCHMARK( "process_items" ) {
+        here.process_items();
+        return here.i_at( bench_center ).size();
+    };
+
+    BENCHMARK( "avatar save and load" ) {
+        std::ostringstream os;
+        JsonOut jsout( os );
+        get_avatar().serialize( jsout );
+        const JsonValue jsin = json_loader::from_string( os.str() );
+        avatar loaded;
+        loaded.deserialize( jsin.get_object() );
+        return loaded.get_name().size();
+    };
+
+    const overmap &om = overmap_buffer.get( point_abs_om() );
+    BENCHMARK( "overmap save and load" ) {
+        std::ostringstream os;
+        om.serialize( os );
+        const std::string data = os.str();
+        // Skip the version line
+        const JsonValue jsin = json_loader::from_string( data.substr( data.find( '\n' ) + 1 ) );
+        std::unique_ptr<overmap> loaded = std::make_unique<overmap>( point_abs_om() );
+        loaded->unserialize( jsin.get_object() );
+        return data.size();
+    };
+}
+
+TEST_CASE( "simulation_benchmark_turn", "[.][simulation][benchmark]" )
+{
+    // Everything at once: the closest a test can get to do_turn, which waits for input
+    build_city_block();
+    spawn_horde();
+    spawn_convoy();
+    light_field();
+    stock_base();
+    map &here = get_map();
+
+    BENCHMARK( "world turn" ) {
+        monsters_turn();
+        here.vehmove();
+        here.process_fields();
+        here.process_items();
+        get_scent().update( bench_center, here );
+        here.build_map_cache( 0 );
+        calendar::turn += 1_turns;
+        return g->num_creatures();
+    };
+}
@@ -548,6 +548,12 @@ TEST_CASE( "stats_tracker_watchers", "[stats]" )
         b.send( other_kill );
         CHECK( kills_watcher.value == cata_variant( 2 ) );
         CHECK( zombie_kills_watcher.value == cata_variant( 1 ) );
+
+        // Watched statistics are answered from the tracked state, which must
+        // agree with a full recomputation
+        CHECK( s.value_of( event_statistic_num_avatar_monster_kills ) == kills_watcher.value );
+        CHECK( event_statistic_num_avatar_monster_kills->value( s ) == kills_watcher.value );
+        CHECK( s.get_events( event_type::character_kills_monster ).count() == 3 );
     }
 
     SECTION( "damage" ) {
@@ -605,3 +605,42 @@ TEST_CASE( "string_formatter_errors" )
 
     CHECK_THROWS( test_for_error( "%d %d %d %d %d", 1, 2, 3, 4 ) );
 }
+
+TEST_CASE( "append_format" )
+{
+    std::string text = "Values:";
+    append_format( text, " %d, %u, %s, %c", -12, 34U, std::string( "text" ), 'x' );
+    CHECK( text == "Values: -12, 34, text, x" );
+    append_format( text, " %5.1f", 2.25 );
+    CHECK( text == "Values: -12, 34, text, x " + string_format( "%5.1f", 2.25 ) );
+
+    // Errors replace the partial output, but keep what was there before
+    std::string broken = "Start ";
+    append_format( broken, "%d %d", 1 );
+    CHECK( broken.rfind( "Start Requested argument", 0 ) == 0 );
+}
+
+TEST_CASE( "string_formatter_benchmark", "[.][benchmark]" )
+{
+    const std::string name = "zombie";
+    BENCHMARK( "plain conversions" ) {
+        return string_format( "The %s hits you for %d damage (%d left).", name, 12, 345 );
+    };
+    BENCHMARK( "conversions with flags" ) {
+        return string_format( "%-10s|%5d|%05d|%.2f", name, 12, 345, 6.789 );
+    };
+    BENCHMARK( "appending to one string" ) {
+        std::string text;
+        for( int i = 0; i < 10; ++i ) {
+            append_format( text, "%s: %d\n", name, i );
+        }
+        return text;
+    };
+    BENCHMARK( "concatenating formatted strings" ) {
+        std::string text;
+        for( int i = 0; i < 10; ++i ) {
+            text += string_format( "%s: %d\n", name, i );
+        }
+        return text;
+    };
+}
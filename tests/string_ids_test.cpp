@@ -3,6 +3,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -68,6 +69,30 @@ TEST_CASE( "string_ids_intern_test", "[string_id]" )
     }
 }
 
+TEST_CASE( "string_ids_intern_from_any_string_type", "[string_id]" )
+{
+    struct test_obj {};
+    using id = string_id<test_obj>;
+
+    const std::string owned = "test_intern_source";
+    const std::string_view view = owned;
+    const id from_string( owned );
+    const id from_view( view );
+    // NOLINTNEXTLINE(cata-static-string_id-constants)
+    const id from_literal( "test_intern_source" );
+    CHECK( from_string == from_view );
+    CHECK( from_string == from_literal );
+    CHECK( from_view.str() == owned );
+
+    // Interned strings keep their address while more are added
+    const std::string *before = &from_string.str();
+    for( int i = 0; i < 10000; ++i ) {
+        id( "test_intern_growth" + std::to_string( i ) );
+    }
+    CHECK( &from_string.str() == before );
+    CHECK( id( std::string_view() ).is_empty() );
+}
+
 TEST_CASE( "string_ids_collection_equality", "[string_id]" )
 {
     struct test_obj {};
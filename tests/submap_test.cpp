@@ -3,6 +3,7 @@
 
 #include "game_constants.h"
 #include "point.h"
+#include "sparse_tile_layer.h"
 #include "type_id.h"
 
 TEST_CASE( "submap_rotation", "[submap]" )
@@ -115,3 +116,72 @@ TEST_CASE( "submap_rotation2", "[submap]" )
         }
     }
 }
+
+TEST_CASE( "submap_compacts_to_uniform", "[submap]" )
+{
+    submap sm;
+    // Writing what a uniform submap already holds keeps it uniform
+    sm.set_ter( point_zero, t_null );
+    sm.set_furn( point_zero, f_null );
+    sm.set_radiation( point_zero, 0 );
+    CHECK( sm.is_uniform() );
+
+    sm.set_ter( point_zero, ter_id( 1 ) );
+    REQUIRE_FALSE( sm.is_uniform() );
+
+    SECTION( "a single terrain compacts" ) {
+        sm.set_all_ter( ter_id( 1 ) );
+        CHECK( sm.compact() );
+        CHECK( sm.is_uniform() );
+        CHECK( sm.compacted );
+        CHECK( sm.get_ter( point( SEEX - 1, SEEY - 1 ) ) == ter_id( 1 ) );
+    }
+
+    SECTION( "mixed terrain does not" ) {
+        CHECK_FALSE( sm.compact() );
+        CHECK( sm.get_ter( point_zero ) == ter_id( 1 ) );
+        CHECK( sm.get_ter( point_south_east ) == t_null );
+    }
+
+    SECTION( "furniture does not" ) {
+        sm.set_all_ter( ter_id( 1 ) );
+        sm.set_furn( point_south_east, furn_id( 1 ) );
+        CHECK_FALSE( sm.compact() );
+        CHECK( sm.get_furn( point_south_east ) == furn_id( 1 ) );
+    }
+}
+
+TEST_CASE( "sparse_tile_layer_promotes_to_dense", "[submap]" )
+{
+    sparse_tile_layer<int> layer;
+    layer.fill( 0 );
+    layer.set( point( 3, 4 ), 7 );
+    layer.set( point( 1, 2 ), 5 );
+    CHECK( layer.get( point( 3, 4 ) ) == 7 );
+    CHECK( layer.get( point( 1, 2 ) ) == 5 );
+    CHECK( layer.get( point_zero ) == 0 );
+
+    // Setting the fill value back drops the entry
+    layer.set( point( 1, 2 ), 0 );
+    CHECK( layer.get( point( 1, 2 ) ) == 0 );
+
+    layer.swap_tiles( point( 3, 4 ), point_zero );
+    CHECK( layer.get( point_zero ) == 7 );
+    CHECK( layer.get( point( 3, 4 ) ) == 0 );
+    CHECK_FALSE( layer.is_dense() );
+
+    for( int x = 0; x < SEEX; x++ ) {
+        layer.set( point( x, 1 ), x + 1 );
+        layer.set( point( x, 2 ), x + 1 );
+    }
+    CHECK( layer.is_dense() );
+    CHECK( layer.get( point_zero ) == 7 );
+    CHECK( layer.get( point( SEEX - 1, 2 ) ) == SEEX );
+
+    const sparse_tile_layer<int> copy = layer;
+    CHECK( copy.get( point( 5, 1 ) ) == 6 );
+
+    layer.fill( 2 );
+    CHECK_FALSE( layer.is_dense() );
+    CHECK( layer.get( point( 5, 1 ) ) == 2 );
+}
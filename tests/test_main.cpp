@@ -10,6 +10,8 @@
 #include <cstring>
 #include <ctime>
 #include <exception>
+#include <functional>
+#include <istream>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -24,6 +26,10 @@
 #else
 #include <unistd.h>
 #endif
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/wait.h>
+#endif
 
 #include "avatar.h"
 #include "cached_options.h"
@@ -68,6 +74,18 @@ static bool fail_to_init_game_state{ false };
 
 static bool needs_game{ false };
 
+// Running a part of the tests in this process, see --shard-count
+static int shard_count{ 0 };
+static int shard_index{ 0 };
+// Spawning worker processes that each run a part of the tests, see --shards
+static int shards{ 0 };
+static int slowest_count{ 0 };
+static std::string timings_file;
+
+using test_timing_t = std::pair<double, std::string>;
+static std::vector<test_timing_t> test_timings;
+static std::chrono::steady_clock::time_point test_case_start;
+
 static std::vector<mod_id> extract_mod_selection( const std::string_view mod_string )
 {
     std::vector<std::string> mod_names = string_split( mod_string, ',' );
@@ -199,6 +217,166 @@ static option_overrides_t extract_option_overrides( const std::string_view optio
     return ret;
 }
 
+// Escapes the characters that have a meaning in a Catch2 test spec, even in a quoted name
+static std::string escape_test_name( const std::string &name )
+{
+    std::string ret;
+    ret.reserve( name.size() );
+    for( const char c : name ) {
+        if( c == '\\' || c == ',' || c == '"' ) {
+            ret.push_back( '\\' );
+        }
+        ret.push_back( c );
+    }
+    return ret;
+}
+
+// Restricts the tests the session runs to every shard_count-th one, starting at shard_index.
+// Returns whether any test was left.
+static bool select_shard( Catch::Session &session )
+{
+    using namespace Catch;
+    std::vector<TestCase> const tcs = filterTests( getAllTestCasesSorted( session.config() ),
+                                      session.config().testSpec(), session.config() );
+    ConfigData data = session.configData();
+    data.testsOrTags.clear();
+    for( size_t i = static_cast<size_t>( shard_index ); i < tcs.size(); i += shard_count ) {
+        if( !data.testsOrTags.empty() ) {
+            data.testsOrTags.emplace_back( "," );
+        }
+        data.testsOrTags.push_back( '"' + escape_test_name( tcs[i].getTestCaseInfo().name ) + '"' );
+    }
+    if( data.testsOrTags.empty() ) {
+        return false;
+    }
+    session.useConfigData( data );
+    return true;
+}
+
+static void write_test_timings( const std::string &path, const std::vector<test_timing_t> &timings )
+{
+    write_to_file( path, [&timings]( std::ostream & fout ) {
+        for( const test_timing_t &timing : timings ) {
+            fout << timing.first << '\t' << timing.second << '\n';
+        }
+    }, "test timings" );
+}
+
+static void read_test_timings( const std::string &path, std::vector<test_timing_t> &timings )
+{
+    read_from_file_optional( path, [&timings]( std::istream & fin ) {
+        double seconds;
+        std::string name;
+        while( fin >> seconds && fin.get() == '\t' && std::getline( fin, name ) ) {
+            timings.emplace_back( seconds, name );
+        }
+        // Reaching the end fails the last read, which isn't an error
+        fin.clear();
+    } );
+}
+
+static void print_slowest_tests( std::vector<test_timing_t> timings, const int count )
+{
+    std::sort( timings.begin(), timings.end(), std::greater<>() );
+    if( timings.size() > static_cast<size_t>( count ) ) {
+        timings.resize( count );
+    }
+    printf( "\nSlowest tests:\n" );
+    for( const test_timing_t &timing : timings ) {
+        printf( "%9.3fs  %s\n", timing.first, timing.second.c_str() );
+    }
+}
+
+// Runs this executable again in @ref shards worker processes, each with its own user dir and
+// a part of the tests, and waits for all of them.
+static int run_shards( const std::vector<const char *> &arg_vec )
+{
+#if defined(_WIN32)
+    ( void ) arg_vec;
+    printf( "--shards is not supported on Windows, run processes with --shard-count and "
+            "--shard-index instead.\n" );
+    return EXIT_FAILURE;
+#else
+    // Everything but the options only meant for this process is handed on
+    std::vector<std::string> base_args;
+    for( size_t i = 0; i < arg_vec.size(); ++i ) {
+        const std::string arg = arg_vec[i];
+        if( arg == "--shards" || arg == "--slowest" ) {
+            ++i;
+        } else if( !string_starts_with( arg, "--shards=" ) &&
+                   !string_starts_with( arg, "--slowest=" ) ) {
+            base_args.push_back( arg );
+        }
+    }
+
+    struct worker {
+        pid_t pid = -1;
+        std::string dir;
+        int status = 0;
+    };
+    std::vector<worker> workers( shards );
+    const auto start_time = std::chrono::steady_clock::now();
+    for( int i = 0; i < shards; ++i ) {
+        worker &w = workers[i];
+        w.dir = user_dir + "shard" + std::to_string( i ) + "/";
+        if( !assure_dir_exist( w.dir ) ) {
+            printf( "Unable to make directory '%s'.\n", w.dir.c_str() );
+            return EXIT_FAILURE;
+        }
+        std::vector<std::string> args = base_args;
+        args.insert( args.end(), {
+            "--user-dir", w.dir, "--shard-count", std::to_string( shards ),
+            "--shard-index", std::to_string( i ), "--timings-file", w.dir + "test_timings.txt"
+        } );
+        std::vector<char *> argv;
+        for( std::string &arg : args ) {
+            argv.push_back( &arg[0] );
+        }
+        argv.push_back( nullptr );
+        const std::string log_path = w.dir + "test_log.txt";
+
+        fflush( stdout );
+        w.pid = fork();
+        if( w.pid == 0 ) {
+            const int fd = open( log_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+            if( fd >= 0 ) {
+                dup2( fd, STDOUT_FILENO );
+                dup2( fd, STDERR_FILENO );
+                close( fd );
+            }
+            execvp( argv[0], argv.data() );
+            _exit( 127 );
+        } else if( w.pid < 0 ) {
+            printf( "Unable to start worker process %d.\n", i );
+            return EXIT_FAILURE;
+        }
+    }
+
+    int failed = 0;
+    std::vector<test_timing_t> timings;
+    for( int i = 0; i < shards; ++i ) {
+        worker &w = workers[i];
+        waitpid( w.pid, &w.status, 0 );
+        const bool passed = WIFEXITED( w.status ) && WEXITSTATUS( w.status ) == 0;
+        failed += passed ? 0 : 1;
+        printf( "Shard %d %s, log in %stest_log.txt\n", i, passed ? "passed" : "FAILED",
+                w.dir.c_str() );
+        read_test_timings( w.dir + "test_timings.txt", timings );
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    double test_seconds = 0.0;
+    for( const test_timing_t &timing : timings ) {
+        test_seconds += timing.first;
+    }
+    printf( "%d of %d shards failed, ran %zu tests taking %.1f seconds in %.1f seconds.\n",
+            failed, shards, timings.size(), test_seconds, elapsed.count() );
+    if( slowest_count > 0 ) {
+        print_slowest_tests( timings, slowest_count );
+    }
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+#endif
+}
+
 struct CataListener : Catch::TestEventListenerBase {
     using TestEventListenerBase::TestEventListenerBase;
 
@@ -226,6 +404,19 @@ struct CataListener : Catch::TestEventListenerBase {
         end = std::chrono::system_clock::now();
     }
 
+    void testCaseStarting( Catch::TestCaseInfo const &testInfo ) override {
+        TestEventListenerBase::testCaseStarting( testInfo );
+        test_case_start = std::chrono::steady_clock::now();
+    }
+
+    void testCaseEnded( Catch::TestCaseStats const &testCaseStats ) override {
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() -
+                test_case_start;
+        // NOLINTNEXTLINE(cata-tests-must-restore-global-state)
+        test_timings.emplace_back( elapsed.count(), testCaseStats.testInfo.name );
+        TestEventListenerBase::testCaseEnded( testCaseStats );
+    }
+
     void sectionStarting( Catch::SectionInfo const &sectionInfo ) override {
         TestEventListenerBase::sectionStarting( sectionInfo );
         // Initialize the cata RNG with the Catch seed for reproducible tests
@@ -321,6 +512,21 @@ int main( int argc, const char *argv[] )
                  | Opt( check_plural_str, "none|certain|possbile" )
                  ["--check-plural"]
                  ( "[CataclysmDDA] (TBW)" )
+                 | Opt( shards, "count" )
+                 ["--shards"]
+                 ( "[CataclysmDDA] Run the tests in this many worker processes at once." )
+                 | Opt( shard_count, "count" )
+                 ["--shard-count"]
+                 ( "[CataclysmDDA] Split the tests into this many parts, see --shard-index." )
+                 | Opt( shard_index, "index" )
+                 ["--shard-index"]
+                 ( "[CataclysmDDA] Only run the part of the tests with this 0-based index." )
+                 | Opt( slowest_count, "count" )
+                 ["--slowest"]
+                 ( "[CataclysmDDA] Print the wall times of this many slowest tests at the end." )
+                 | Opt( timings_file, "filename" )
+                 ["--timings-file"]
+                 ( "[CataclysmDDA] Write the wall time of every test to this file." )
                  ;
     session.cli( cli );
 
@@ -370,6 +576,18 @@ int main( int argc, const char *argv[] )
         return EXIT_FAILURE;
     }
 
+    if( shard_count > 0 && ( shard_index < 0 || shard_index >= shard_count ) ) {
+        printf( "Shard index %d is not below the shard count %d", shard_index, shard_count );
+        return EXIT_FAILURE;
+    }
+    if( shards > 0 ) {
+        return run_shards( arg_vec );
+    }
+    if( shard_count > 0 && !select_shard( session ) ) {
+        printf( "Nothing to run in shard %d of %d\n", shard_index, shard_count );
+        return EXIT_SUCCESS;
+    }
+
     // NOLINTNEXTLINE(cata-tests-must-restore-global-state)
     test_mode = true;
 
@@ -441,6 +659,12 @@ int main( int argc, const char *argv[] )
 
     std::chrono::duration<double> elapsed_seconds = end - start;
     DebugLog( D_INFO, DC_ALL ) << "Finished in " << elapsed_seconds.count() << " seconds";
+    if( !timings_file.empty() ) {
+        write_test_timings( timings_file, test_timings );
+    }
+    if( slowest_count > 0 ) {
+        print_slowest_tests( test_timings, slowest_count );
+    }
 
     if( seed ) {
         // Also print the seed at the end so it can be easily found
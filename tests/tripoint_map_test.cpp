@@ -0,0 +1,44 @@
+#include <unordered_map>
+
+#include "cata_catch.h"
+#include "point.h"
+#include "rng.h"
+#include "tripoint_map.h"
+
+TEST_CASE( "tripoint_map_matches_unordered_map", "[tripoint_map][nogame]" )
+{
+    rng_set_engine_seed( 4321 );
+    cata::tripoint_map<int> map;
+    std::unordered_map<tripoint, int> expected;
+    // A small area, so inserts, lookups and erases keep hitting the same keys
+    for( int i = 0; i < 20000; i++ ) {
+        const tripoint p( rng( -6, 6 ), rng( -6, 6 ), rng( -1, 1 ) );
+        switch( rng( 0, 2 ) ) {
+            case 0:
+                map[p] = i;
+                expected[p] = i;
+                break;
+            case 1:
+                CHECK( map.erase( p ) == ( expected.erase( p ) == 1 ) );
+                break;
+            default: {
+                const int *found = map.find( p );
+                const auto it = expected.find( p );
+                REQUIRE( ( found != nullptr ) == ( it != expected.end() ) );
+                if( found ) {
+                    CHECK( *found == it->second );
+                }
+                break;
+            }
+        }
+        REQUIRE( map.size() == expected.size() );
+    }
+    for( const std::pair<const tripoint, int> &entry : expected ) {
+        const int *found = map.find( entry.first );
+        REQUIRE( found != nullptr );
+        CHECK( *found == entry.second );
+    }
+    map.clear();
+    CHECK( map.empty() );
+    CHECK( map.find( expected.begin()->first ) == nullptr );
+}
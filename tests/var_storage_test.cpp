@@ -0,0 +1,62 @@
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+
+#include "cata_catch.h"
+#include "json.h"
+#include "json_loader.h"
+#include "var_storage.h"
+
+TEST_CASE( "var_key_interning", "[var][nogame]" )
+{
+    const var_key a( "npctalk_var_test_a" );
+    const var_key a2( std::string( "npctalk_var_" ) + "test_a" );
+    const var_key b( "npctalk_var_test_b" );
+    CHECK( a == a2 );
+    CHECK( a != b );
+    CHECK( a.str() == "npctalk_var_test_a" );
+    CHECK( var_key().str().empty() );
+}
+
+TEST_CASE( "var_storage_set_get_remove", "[var][nogame]" )
+{
+    var_storage vars;
+    CHECK( vars.empty() );
+    CHECK( !vars.get( "npctalk_var_test_a" ) );
+
+    vars.set( "npctalk_var_test_b", "2" );
+    vars.set( var_key( "npctalk_var_test_a" ), "1" );
+    vars.set( "npctalk_var_test_c", "3" );
+    CHECK( vars.get( "npctalk_var_test_a" ) == "1" );
+    CHECK( vars.get( var_key( "npctalk_var_test_b" ) ) == "2" );
+    CHECK( vars.get( "npctalk_var_test_c" ) == "3" );
+
+    vars.set( "npctalk_var_test_b", "5" );
+    CHECK( vars.get( "npctalk_var_test_b" ) == "5" );
+    vars.remove( "npctalk_var_test_b" );
+    CHECK( !vars.get( "npctalk_var_test_b" ) );
+    CHECK( vars.to_map().size() == 2 );
+
+    std::map<std::string, std::string> migrations{ { "npctalk_var_test_a", "npctalk_var_test_d" } };
+    vars.migrate( migrations );
+    CHECK( !vars.get( "npctalk_var_test_a" ) );
+    CHECK( vars.get( "npctalk_var_test_d" ) == "1" );
+}
+
+TEST_CASE( "var_storage_round_trip", "[var][nogame]" )
+{
+    var_storage vars;
+    vars.set( "npctalk_var_test_a", "1" );
+    vars.set( "npctalk_var_test_b", "two" );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    vars.serialize( jsout );
+
+    var_storage loaded;
+    JsonValue jsin = json_loader::from_string( os.str() );
+    loaded.deserialize( jsin.get_object() );
+    CHECK( loaded.to_map() == vars.to_map() );
+    CHECK( loaded.get( "npctalk_var_test_b" ) == "two" );
+}
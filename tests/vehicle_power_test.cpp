@@ -1,4 +1,5 @@
 #include <cstdlib>
+#include <map>
 #include <vector>
 
 #include "calendar.h"
@@ -11,6 +12,7 @@
 #include "type_id.h"
 #include "units.h"
 #include "vehicle.h"
+#include "vpart_position.h"
 #include "weather.h"
 #include "weather_type.h"
 
@@ -76,6 +78,46 @@ TEST_CASE( "vehicle_power_with_reactor", "[vehicle][power]" )
     }
 }
 
+static void connect_debug_cord( map &here, const tripoint &source, const tripoint &target )
+{
+    const optional_vpart_position target_vp = here.veh_at( target );
+    const optional_vpart_position source_vp = here.veh_at( source );
+
+    item cord( "test_power_cord_25_loss" );
+    cord.set_var( "source_x", source.x );
+    cord.set_var( "source_y", source.y );
+    cord.set_var( "source_z", source.z );
+    cord.set_var( "state", "pay_out_cable" );
+    cord.active = true;
+
+    if( !target_vp ) {
+        debugmsg( "missing target at %s", target.to_string() );
+    }
+    vehicle *const target_veh = &target_vp->vehicle();
+    vehicle *const source_veh = &source_vp->vehicle();
+    if( source_veh == target_veh ) {
+        debugmsg( "source same as target" );
+    }
+
+    tripoint target_global = here.getabs( target );
+    const vpart_id vpid( cord.typeId().str() );
+
+    point vcoords = source_vp->mount();
+    vehicle_part source_part( vpid, item( cord ) );
+    source_part.target.first = target_global;
+    source_part.target.second = target_veh->global_square_location().raw();
+    source_veh->install_part( vcoords, std::move( source_part ) );
+
+    vcoords = target_vp->mount();
+    vehicle_part target_part( vpid, item( cord ) );
+    tripoint source_global( cord.get_var( "source_x", 0 ),
+                            cord.get_var( "source_y", 0 ),
+                            cord.get_var( "source_z", 0 ) );
+    target_part.target.first = here.getabs( source_global );
+    target_part.target.second = source_veh->global_square_location().raw();
+    target_veh->install_part( vcoords, std::move( target_part ) );
+}
+
 TEST_CASE( "power_loss_to_cables", "[vehicle][power]" )
 {
     clear_vehicles();
@@ -83,46 +125,6 @@ TEST_CASE( "power_loss_to_cables", "[vehicle][power]" )
     build_test_map( ter_id( "t_pavement" ) );
     map &here = get_map();
 
-    const auto connect_debug_cord = [&here]( const tripoint & source,
-    const tripoint & target ) {
-        const optional_vpart_position target_vp = here.veh_at( target );
-        const optional_vpart_position source_vp = here.veh_at( source );
-
-        item cord( "test_power_cord_25_loss" );
-        cord.set_var( "source_x", source.x );
-        cord.set_var( "source_y", source.y );
-        cord.set_var( "source_z", source.z );
-        cord.set_var( "state", "pay_out_cable" );
-        cord.active = true;
-
-        if( !target_vp ) {
-            debugmsg( "missing target at %s", target.to_string() );
-        }
-        vehicle *const target_veh = &target_vp->vehicle();
-        vehicle *const source_veh = &source_vp->vehicle();
-        if( source_veh == target_veh ) {
-            debugmsg( "source same as target" );
-        }
-
-        tripoint target_global = here.getabs( target );
-        const vpart_id vpid( cord.typeId().str() );
-
-        point vcoords = source_vp->mount();
-        vehicle_part source_part( vpid, item( cord ) );
-        source_part.target.first = target_global;
-        source_part.target.second = target_veh->global_square_location().raw();
-        source_veh->install_part( vcoords, std::move( source_part ) );
-
-        vcoords = target_vp->mount();
-        vehicle_part target_part( vpid, item( cord ) );
-        tripoint source_global( cord.get_var( "source_x", 0 ),
-                                cord.get_var( "source_y", 0 ),
-                                cord.get_var( "source_z", 0 ) );
-        target_part.target.first = here.getabs( source_global );
-        target_part.target.second = source_veh->global_square_location().raw();
-        target_veh->install_part( vcoords, std::move( target_part ) );
-    };
-
     const std::vector<tripoint> placements { { 4, 10, 0 }, { 6, 10, 0 }, { 8, 10, 0 } };
     std::vector<vpart_reference> batteries;
     for( const tripoint &p : placements ) {
@@ -140,7 +142,7 @@ TEST_CASE( "power_loss_to_cables", "[vehicle][power]" )
     // connect first to second and second to third, each cord is 25% lossy
     // third battery will on average take twice as many charges to charge as the first
     for( size_t i = 0; i < placements.size() - 1; i++ ) {
-        connect_debug_cord( placements[i], placements[i + 1] );
+        connect_debug_cord( here, placements[i], placements[i + 1] );
     }
     const optional_vpart_position ovp_first = here.veh_at( placements[0] );
     REQUIRE( ovp_first.has_value() );
@@ -170,6 +172,41 @@ TEST_CASE( "power_loss_to_cables", "[vehicle][power]" )
     }
 }
 
+TEST_CASE( "connected_vehicles_follow_grid_changes", "[vehicle][power]" )
+{
+    clear_vehicles();
+    reset_player();
+    build_test_map( ter_id( "t_pavement" ) );
+    map &here = get_map();
+
+    const std::vector<tripoint> placements { { 4, 10, 0 }, { 6, 10, 0 }, { 8, 10, 0 } };
+    for( const tripoint &p : placements ) {
+        vehicle *veh = here.add_vehicle( vehicle_prototype_none, p, 0_degrees, 0, 0 );
+        REQUIRE( veh != nullptr );
+        REQUIRE( veh->install_part( point_zero, vpart_frame ) != -1 );
+        REQUIRE( veh->install_part( point_zero, vpart_small_storage_battery ) != -1 );
+        here.add_vehicle_to_cache( veh );
+    }
+    vehicle &first = here.veh_at( placements[0] )->vehicle();
+    vehicle &last = here.veh_at( placements[2] )->vehicle();
+    CHECK( first.search_connected_vehicles().size() == 1 );
+
+    connect_debug_cord( here, placements[0], placements[1] );
+    CHECK( first.search_connected_vehicles().size() == 2 );
+    connect_debug_cord( here, placements[1], placements[2] );
+    CHECK( first.search_connected_vehicles().size() == 3 );
+    // Asking again without any change gives the same grid
+    CHECK( first.search_connected_vehicles().size() == 3 );
+    CHECK( first.search_connected_batteries().size() == 3 );
+
+    const std::map<vehicle *, float> grid = first.search_connected_vehicles();
+    REQUIRE( grid.count( &last ) == 1 );
+    CHECK( grid.at( &last ) > grid.at( &here.veh_at( placements[1] )->vehicle() ) );
+
+    here.destroy_vehicle( &last );
+    CHECK( first.search_connected_vehicles().size() == 2 );
+}
+
 TEST_CASE( "Solar_power", "[vehicle][power]" )
 {
     clear_vehicles();
@@ -52,6 +52,68 @@ TEST_CASE( "detaching_vehicle_unboards_passengers", "[vehicle]" )
     REQUIRE( !player_character.in_vehicle );
 }
 
+TEST_CASE( "breaking_parts_updates_caches_like_a_full_refresh", "[vehicle]" )
+{
+    clear_map();
+    map &here = get_map();
+    vehicle *veh_ptr = here.add_vehicle( vehicle_prototype_car, tripoint( 60, 60, 0 ), 0_degrees,
+                                         0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+    REQUIRE( veh.total_power( false ) > 0_W );
+
+    for( int p = 0; p < veh.part_count(); ++p ) {
+        vehicle_part &vp = veh.part( p );
+        if( vp.removed || vp.is_fake || vp.is_broken() ) {
+            continue;
+        }
+        CAPTURE( vp.name() );
+        item base = vp.get_base();
+        base.set_damage( base.max_damage() );
+        vp.set_base( std::move( base ) );
+        REQUIRE( vp.is_broken() );
+        veh.refresh_broken_part( p );
+
+        const units::power power = veh.total_power( false );
+        const int wheel_area = veh.wheel_area();
+        const float steering = veh.steering_effectiveness();
+        veh.refresh( false );
+        CHECK( veh.total_power( false ) == power );
+        CHECK( veh.wheel_area() == wheel_area );
+        CHECK( veh.steering_effectiveness() == steering );
+    }
+    CHECK( veh.total_power( false ) == 0_W );
+}
+
+TEST_CASE( "precalc_mounts_is_unchanged_when_flipping_between_facings", "[vehicle]" )
+{
+    clear_map();
+    map &here = get_map();
+    vehicle *veh_ptr = here.add_vehicle( vehicle_prototype_car, tripoint( 60, 60, 0 ), 0_degrees,
+                                         0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+    const point pivot = veh.pivot_point();
+
+    // More distinct facings than the cache holds, revisited out of order
+    for( const units::angle &dir : {
+             0_degrees, 15_degrees, 0_degrees, 30_degrees, 45_degrees, 60_degrees, 75_degrees,
+             15_degrees, 0_degrees, 15_degrees
+         } ) {
+        CAPTURE( units::to_degrees( dir ) );
+        veh.precalc_mounts( 1, dir, pivot );
+        for( int p = 0; p < veh.part_count(); ++p ) {
+            const vehicle_part &vp = veh.part( p );
+            if( vp.removed ) {
+                continue;
+            }
+            tripoint expected;
+            veh.coord_translate( dir, pivot, vp.mount, expected );
+            CHECK( vp.precalc[1].xy() == expected.xy() );
+        }
+    }
+}
+
 TEST_CASE( "destroy_grabbed_vehicle_section", "[vehicle]" )
 {
     GIVEN( "A vehicle grabbed by the player" ) {
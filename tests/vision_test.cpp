@@ -1,3 +1,4 @@
+#include <cstring>
 #include <functional>
 #include <list>
 #include <memory>
@@ -14,6 +15,7 @@
 #include "character.h"
 #include "game.h"
 #include "item.h"
+#include "level_cache.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "map_test_case.h"
@@ -42,6 +44,7 @@ static const mtype_id mon_zombie_electric( "mon_zombie_electric" );
 static const ter_str_id ter_t_brick_wall( "t_brick_wall" );
 static const ter_str_id ter_t_flat_roof( "t_flat_roof" );
 static const ter_str_id ter_t_floor( "t_floor" );
+static const ter_str_id ter_t_grass( "t_grass" );
 static const ter_str_id ter_t_utility_light( "t_utility_light" );
 static const ter_str_id ter_t_window_frame( "t_window_frame" );
 
@@ -1147,3 +1150,48 @@ TEST_CASE( "pl_sees-oob-nocrash", "[vision]" )
 
     clear_avatar();
 }
+
+static void check_lightmap_matches_full_rebuild()
+{
+    map &here = get_map();
+    here.build_map_cache( 0 );
+    const level_cache &ch = here.get_cache_ref( 0 );
+    const cata::mdarray<four_quadrants, point_bub_ms> incremental_lm = ch.lm;
+    const cata::mdarray<float, point_bub_ms> incremental_sm = ch.sm;
+
+    here.invalidate_map_cache( 0 );
+    here.build_map_cache( 0 );
+    CHECK( std::memcmp( &incremental_lm, &ch.lm, sizeof( ch.lm ) ) == 0 );
+    CHECK( std::memcmp( &incremental_sm, &ch.sm, sizeof( ch.sm ) ) == 0 );
+}
+
+TEST_CASE( "incremental_lightmap_matches_full_rebuild", "[shadowcasting][vision]" )
+{
+    clear_avatar();
+    clear_map();
+    set_time( midnight );
+    map &here = get_map();
+
+    const tripoint lamp_a( 30, 30, 0 );
+    const tripoint lamp_b( 70, 70, 0 );
+    const tripoint lamp_c( 72, 70, 0 );
+    for( int y = 20; y < 40; ++y ) {
+        here.ter_set( tripoint( 35, y, 0 ), ter_t_brick_wall );
+    }
+    here.ter_set( lamp_a, ter_t_utility_light );
+    here.ter_set( lamp_b, ter_t_utility_light );
+    here.invalidate_map_cache( 0 );
+    here.build_map_cache( 0 );
+
+    SECTION( "nothing changed" ) {
+        check_lightmap_matches_full_rebuild();
+    }
+    SECTION( "light removed" ) {
+        here.ter_set( lamp_b, ter_t_grass );
+        check_lightmap_matches_full_rebuild();
+    }
+    SECTION( "light added next to another light" ) {
+        here.ter_set( lamp_c, ter_t_utility_light );
+        check_lightmap_matches_full_rebuild();
+    }
+}
@@ -9,6 +9,9 @@
 
 static const itype_id itype_water( "water" );
 
+static const quality_id qual_DIG( "DIG" );
+static const quality_id qual_HAMMER( "HAMMER" );
+
 TEST_CASE( "visitable_summation" )
 {
     inventory test_inv;
@@ -24,3 +27,20 @@ TEST_CASE( "visitable_summation" )
 
     CHECK( test_inv.charges_of( itype_water, item::INFINITE_CHARGES ) > 1 );
 }
+
+TEST_CASE( "inventory_quality_levels" )
+{
+    inventory test_inv;
+    test_inv.add_item( item( "test_halligan" ) );
+    test_inv.add_item( item( "test_halligan" ) );
+
+    // Answered for any level and count from one pass over the items
+    CHECK( test_inv.has_quality( qual_HAMMER, 1, 2 ) );
+    CHECK( test_inv.has_quality( qual_HAMMER, 2, 2 ) );
+    CHECK_FALSE( test_inv.has_quality( qual_HAMMER, 2, 3 ) );
+    CHECK_FALSE( test_inv.has_quality( qual_HAMMER, 3 ) );
+    CHECK( test_inv.has_quality( qual_DIG ) );
+
+    test_inv.clear();
+    CHECK_FALSE( test_inv.has_quality( qual_HAMMER ) );
+}
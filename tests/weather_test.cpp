@@ -6,6 +6,7 @@
 #include "calendar.h"
 #include "cata_catch.h"
 #include "cata_scope_helpers.h"
+#include "coordinates.h"
 #include "options_helpers.h"
 #include "point.h"
 #include "type_id.h"
@@ -178,6 +179,42 @@ TEST_CASE( "eternal_season", "[weather]" )
     }
 }
 
+TEST_CASE( "batched_weather_temperatures_match_single_lookups", "[weather]" )
+{
+    const weather_generator &wgen = get_weather().get_cur_weather_gen();
+    const tripoint location( 30, 70, 0 );
+    const time_point first = calendar::turn_zero + 3_days + 17_minutes;
+    for( unsigned int seed : seeds ) {
+        const std::vector<units::temperature> batch =
+            wgen.get_weather_temperatures( location, first, 1_hours, 200, seed );
+        REQUIRE( batch.size() == 200 );
+        for( int i = 0; i < 200; ++i ) {
+            CAPTURE( seed, i );
+            CHECK( batch[i] == wgen.get_weather_temperature( location, first + i * 1_hours, seed ) );
+        }
+    }
+}
+
+TEST_CASE( "rainfall_spans_add_up", "[weather]" )
+{
+    const tripoint_abs_ms location( 30, 50, 0 );
+    const time_point start = calendar::turn_zero + 10_days + 17_turns;
+    const time_point middle = start + 2_days + 3_hours + 41_turns;
+    const time_point end = middle + 1_days + 5_minutes;
+    SECTION( "generated weather" ) {
+        const int whole = rain_amount_between( start, end, location );
+        CHECK( whole == rain_amount_between( start, middle, location ) +
+               rain_amount_between( middle, end, location ) );
+        CHECK( whole == sum_conditions( start, end, location ).rain_amount );
+        // Same overmap terrain, same table
+        CHECK( whole == rain_amount_between( start, end, location + tripoint( 5, 7, 0 ) ) );
+    }
+    SECTION( "no rain while the weather is clear" ) {
+        scoped_weather_override weather_clear( WEATHER_CLEAR );
+        CHECK( rain_amount_between( start, end, location ) == 0 );
+    }
+}
+
 TEST_CASE( "local_wind_chill_calculation", "[weather][wind_chill]" )
 {
     // `get_local_windchill` returns degrees F offset from current temperature,